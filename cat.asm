@@ -0,0 +1,664 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+   6:	eb 15                	jmp    1d <cat+0x1d>
+    write(1, buf, n);
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 c0 05 00 00       	push   $0x5c0
+  13:	6a 01                	push   $0x1
+  15:	e8 1d 01 00 00       	call   137 <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	68 00 02 00 00       	push   $0x200
+  25:	68 c0 05 00 00       	push   $0x5c0
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	e8 fd 00 00 00       	call   12f <read>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3c:	7f ca                	jg     8 <cat+0x8>
+  if(n < 0){
+  3e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  42:	79 17                	jns    5b <cat+0x5b>
+    printf(1, "cat: read error\n");
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	68 ad 04 00 00       	push   $0x4ad
+  4c:	6a 01                	push   $0x1
+  4e:	e8 c8 02 00 00       	call   31b <printf>
+  53:	83 c4 10             	add    $0x10,%esp
+    exit();
+  56:	e8 bc 00 00 00       	call   117 <exit>
+  }
+}
+  5b:	90                   	nop
+  5c:	c9                   	leave
+  5d:	c3                   	ret
+
+0000005e <main>:
+
+int
+main(int argc, char *argv[])
+{
+  5e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  62:	83 e4 f0             	and    $0xfffffff0,%esp
+  65:	ff 71 fc             	push   -0x4(%ecx)
+  68:	55                   	push   %ebp
+  69:	89 e5                	mov    %esp,%ebp
+  6b:	53                   	push   %ebx
+  6c:	51                   	push   %ecx
+  6d:	83 ec 10             	sub    $0x10,%esp
+  70:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  72:	83 3b 01             	cmpl   $0x1,(%ebx)
+  75:	7f 12                	jg     89 <main+0x2b>
+    cat(0);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	6a 00                	push   $0x0
+  7c:	e8 7f ff ff ff       	call   0 <cat>
+  81:	83 c4 10             	add    $0x10,%esp
+    exit();
+  84:	e8 8e 00 00 00       	call   117 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  89:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  90:	eb 71                	jmp    103 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  95:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  9f:	01 d0                	add    %edx,%eax
+  a1:	8b 00                	mov    (%eax),%eax
+  a3:	83 ec 08             	sub    $0x8,%esp
+  a6:	6a 00                	push   $0x0
+  a8:	50                   	push   %eax
+  a9:	e8 a9 00 00 00       	call   157 <open>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b8:	79 29                	jns    e3 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  bd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  c7:	01 d0                	add    %edx,%eax
+  c9:	8b 00                	mov    (%eax),%eax
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	50                   	push   %eax
+  cf:	68 be 04 00 00       	push   $0x4be
+  d4:	6a 01                	push   $0x1
+  d6:	e8 40 02 00 00       	call   31b <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+      exit();
+  de:	e8 34 00 00 00       	call   117 <exit>
+    }
+    cat(fd);
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	ff 75 f0             	push   -0x10(%ebp)
+  e9:	e8 12 ff ff ff       	call   0 <cat>
+  ee:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	ff 75 f0             	push   -0x10(%ebp)
+  f7:	e8 43 00 00 00       	call   13f <close>
+  fc:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+  ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 106:	3b 03                	cmp    (%ebx),%eax
+ 108:	7c 88                	jl     92 <main+0x34>
+  }
+  exit();
+ 10a:	e8 08 00 00 00       	call   117 <exit>
+
+0000010f <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 10f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 114:	cd 40                	int    $0x40
+ 116:	c3                   	ret
+
+00000117 <exit>:
+SYSCALL(exit)
+ 117:	b8 02 00 00 00       	mov    $0x2,%eax
+ 11c:	cd 40                	int    $0x40
+ 11e:	c3                   	ret
+
+0000011f <wait>:
+SYSCALL(wait)
+ 11f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 124:	cd 40                	int    $0x40
+ 126:	c3                   	ret
+
+00000127 <pipe>:
+SYSCALL(pipe)
+ 127:	b8 04 00 00 00       	mov    $0x4,%eax
+ 12c:	cd 40                	int    $0x40
+ 12e:	c3                   	ret
+
+0000012f <read>:
+SYSCALL(read)
+ 12f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 134:	cd 40                	int    $0x40
+ 136:	c3                   	ret
+
+00000137 <write>:
+SYSCALL(write)
+ 137:	b8 10 00 00 00       	mov    $0x10,%eax
+ 13c:	cd 40                	int    $0x40
+ 13e:	c3                   	ret
+
+0000013f <close>:
+SYSCALL(close)
+ 13f:	b8 15 00 00 00       	mov    $0x15,%eax
+ 144:	cd 40                	int    $0x40
+ 146:	c3                   	ret
+
+00000147 <kill>:
+SYSCALL(kill)
+ 147:	b8 06 00 00 00       	mov    $0x6,%eax
+ 14c:	cd 40                	int    $0x40
+ 14e:	c3                   	ret
+
+0000014f <exec>:
+SYSCALL(exec)
+ 14f:	b8 07 00 00 00       	mov    $0x7,%eax
+ 154:	cd 40                	int    $0x40
+ 156:	c3                   	ret
+
+00000157 <open>:
+SYSCALL(open)
+ 157:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 15c:	cd 40                	int    $0x40
+ 15e:	c3                   	ret
+
+0000015f <mknod>:
+SYSCALL(mknod)
+ 15f:	b8 11 00 00 00       	mov    $0x11,%eax
+ 164:	cd 40                	int    $0x40
+ 166:	c3                   	ret
+
+00000167 <unlink>:
+SYSCALL(unlink)
+ 167:	b8 12 00 00 00       	mov    $0x12,%eax
+ 16c:	cd 40                	int    $0x40
+ 16e:	c3                   	ret
+
+0000016f <fstat>:
+SYSCALL(fstat)
+ 16f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 174:	cd 40                	int    $0x40
+ 176:	c3                   	ret
+
+00000177 <link>:
+SYSCALL(link)
+ 177:	b8 13 00 00 00       	mov    $0x13,%eax
+ 17c:	cd 40                	int    $0x40
+ 17e:	c3                   	ret
+
+0000017f <mkdir>:
+SYSCALL(mkdir)
+ 17f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 184:	cd 40                	int    $0x40
+ 186:	c3                   	ret
+
+00000187 <chdir>:
+SYSCALL(chdir)
+ 187:	b8 09 00 00 00       	mov    $0x9,%eax
+ 18c:	cd 40                	int    $0x40
+ 18e:	c3                   	ret
+
+0000018f <dup>:
+SYSCALL(dup)
+ 18f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 194:	cd 40                	int    $0x40
+ 196:	c3                   	ret
+
+00000197 <getpid>:
+SYSCALL(getpid)
+ 197:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 19c:	cd 40                	int    $0x40
+ 19e:	c3                   	ret
+
+0000019f <sbrk>:
+SYSCALL(sbrk)
+ 19f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 1a4:	cd 40                	int    $0x40
+ 1a6:	c3                   	ret
+
+000001a7 <sleep>:
+SYSCALL(sleep)
+ 1a7:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 1ac:	cd 40                	int    $0x40
+ 1ae:	c3                   	ret
+
+000001af <uptime>:
+SYSCALL(uptime)
+ 1af:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1b4:	cd 40                	int    $0x40
+ 1b6:	c3                   	ret
+
+000001b7 <saveProc>:
+SYSCALL(saveProc)
+ 1b7:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1bc:	cd 40                	int    $0x40
+ 1be:	c3                   	ret
+
+000001bf <loadProc>:
+SYSCALL(loadProc)
+ 1bf:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1c4:	cd 40                	int    $0x40
+ 1c6:	c3                   	ret
+
+000001c7 <setpriority>:
+SYSCALL(setpriority)
+ 1c7:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1cc:	cd 40                	int    $0x40
+ 1ce:	c3                   	ret
+
+000001cf <setaffinity>:
+SYSCALL(setaffinity)
+ 1cf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1d4:	cd 40                	int    $0x40
+ 1d6:	c3                   	ret
+
+000001d7 <getaffinity>:
+SYSCALL(getaffinity)
+ 1d7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1dc:	cd 40                	int    $0x40
+ 1de:	c3                   	ret
+
+000001df <nanosleep>:
+SYSCALL(nanosleep)
+ 1df:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1e4:	cd 40                	int    $0x40
+ 1e6:	c3                   	ret
+
+000001e7 <cpustat>:
+SYSCALL(cpustat)
+ 1e7:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1ec:	cd 40                	int    $0x40
+ 1ee:	c3                   	ret
+
+000001ef <nanouptime>:
+SYSCALL(nanouptime)
+ 1ef:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1f4:	cd 40                	int    $0x40
+ 1f6:	c3                   	ret
+
+000001f7 <settickets>:
+SYSCALL(settickets)
+ 1f7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1fc:	cd 40                	int    $0x40
+ 1fe:	c3                   	ret
+
+000001ff <setdeadline>:
+SYSCALL(setdeadline)
+ 1ff:	b8 20 00 00 00       	mov    $0x20,%eax
+ 204:	cd 40                	int    $0x40
+ 206:	c3                   	ret
+
+00000207 <rtstat>:
+SYSCALL(rtstat)
+ 207:	b8 21 00 00 00       	mov    $0x21,%eax
+ 20c:	cd 40                	int    $0x40
+ 20e:	c3                   	ret
+
+0000020f <schedstat>:
+SYSCALL(schedstat)
+ 20f:	b8 22 00 00 00       	mov    $0x22,%eax
+ 214:	cd 40                	int    $0x40
+ 216:	c3                   	ret
+
+00000217 <waitpid>:
+SYSCALL(waitpid)
+ 217:	b8 23 00 00 00       	mov    $0x23,%eax
+ 21c:	cd 40                	int    $0x40
+ 21e:	c3                   	ret
+
+0000021f <clone>:
+SYSCALL(clone)
+ 21f:	b8 24 00 00 00       	mov    $0x24,%eax
+ 224:	cd 40                	int    $0x40
+ 226:	c3                   	ret
+
+00000227 <futexwait>:
+SYSCALL(futexwait)
+ 227:	b8 25 00 00 00       	mov    $0x25,%eax
+ 22c:	cd 40                	int    $0x40
+ 22e:	c3                   	ret
+
+0000022f <futexwake>:
+SYSCALL(futexwake)
+ 22f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 234:	cd 40                	int    $0x40
+ 236:	c3                   	ret
+
+00000237 <lockstat>:
+SYSCALL(lockstat)
+ 237:	b8 27 00 00 00       	mov    $0x27,%eax
+ 23c:	cd 40                	int    $0x40
+ 23e:	c3                   	ret
+
+0000023f <dcachestat>:
+SYSCALL(dcachestat)
+ 23f:	b8 28 00 00 00       	mov    $0x28,%eax
+ 244:	cd 40                	int    $0x40
+ 246:	c3                   	ret
+
+00000247 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 247:	55                   	push   %ebp
+ 248:	89 e5                	mov    %esp,%ebp
+ 24a:	83 ec 18             	sub    $0x18,%esp
+ 24d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 250:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 253:	83 ec 04             	sub    $0x4,%esp
+ 256:	6a 01                	push   $0x1
+ 258:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 25b:	50                   	push   %eax
+ 25c:	ff 75 08             	push   0x8(%ebp)
+ 25f:	e8 d3 fe ff ff       	call   137 <write>
+ 264:	83 c4 10             	add    $0x10,%esp
+}
+ 267:	90                   	nop
+ 268:	c9                   	leave
+ 269:	c3                   	ret
+
+0000026a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 26a:	55                   	push   %ebp
+ 26b:	89 e5                	mov    %esp,%ebp
+ 26d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 270:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 277:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 27b:	74 17                	je     294 <printint+0x2a>
+ 27d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 281:	79 11                	jns    294 <printint+0x2a>
+    neg = 1;
+ 283:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	f7 d8                	neg    %eax
+ 28f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 292:	eb 06                	jmp    29a <printint+0x30>
+  } else {
+    x = xx;
+ 294:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 297:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 29a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 2a1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2a4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 2a7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2ac:	f7 f1                	div    %ecx
+ 2ae:	89 d1                	mov    %edx,%ecx
+ 2b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b3:	8d 50 01             	lea    0x1(%eax),%edx
+ 2b6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2b9:	0f b6 91 9c 05 00 00 	movzbl 0x59c(%ecx),%edx
+ 2c0:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 2c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 2ca:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2cf:	f7 f1                	div    %ecx
+ 2d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 2d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2d8:	75 c7                	jne    2a1 <printint+0x37>
+  if(neg)
+ 2da:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2de:	74 2d                	je     30d <printint+0xa3>
+    buf[i++] = '-';
+ 2e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e3:	8d 50 01             	lea    0x1(%eax),%edx
+ 2e6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2e9:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 2ee:	eb 1d                	jmp    30d <printint+0xa3>
+    putc(fd, buf[i]);
+ 2f0:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 2f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f6:	01 d0                	add    %edx,%eax
+ 2f8:	0f b6 00             	movzbl (%eax),%eax
+ 2fb:	0f be c0             	movsbl %al,%eax
+ 2fe:	83 ec 08             	sub    $0x8,%esp
+ 301:	50                   	push   %eax
+ 302:	ff 75 08             	push   0x8(%ebp)
+ 305:	e8 3d ff ff ff       	call   247 <putc>
+ 30a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 30d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 311:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 315:	79 d9                	jns    2f0 <printint+0x86>
+}
+ 317:	90                   	nop
+ 318:	90                   	nop
+ 319:	c9                   	leave
+ 31a:	c3                   	ret
+
+0000031b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 31b:	55                   	push   %ebp
+ 31c:	89 e5                	mov    %esp,%ebp
+ 31e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 321:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 328:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 32b:	83 c0 04             	add    $0x4,%eax
+ 32e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 331:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 338:	e9 59 01 00 00       	jmp    496 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 33d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 340:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 343:	01 d0                	add    %edx,%eax
+ 345:	0f b6 00             	movzbl (%eax),%eax
+ 348:	0f be c0             	movsbl %al,%eax
+ 34b:	25 ff 00 00 00       	and    $0xff,%eax
+ 350:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 353:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 357:	75 2c                	jne    385 <printf+0x6a>
+      if(c == '%'){
+ 359:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 35d:	75 0c                	jne    36b <printf+0x50>
+        state = '%';
+ 35f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 366:	e9 27 01 00 00       	jmp    492 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 36b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 36e:	0f be c0             	movsbl %al,%eax
+ 371:	83 ec 08             	sub    $0x8,%esp
+ 374:	50                   	push   %eax
+ 375:	ff 75 08             	push   0x8(%ebp)
+ 378:	e8 ca fe ff ff       	call   247 <putc>
+ 37d:	83 c4 10             	add    $0x10,%esp
+ 380:	e9 0d 01 00 00       	jmp    492 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 385:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 389:	0f 85 03 01 00 00    	jne    492 <printf+0x177>
+      if(c == 'd'){
+ 38f:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 393:	75 1e                	jne    3b3 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 395:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 398:	8b 00                	mov    (%eax),%eax
+ 39a:	6a 01                	push   $0x1
+ 39c:	6a 0a                	push   $0xa
+ 39e:	50                   	push   %eax
+ 39f:	ff 75 08             	push   0x8(%ebp)
+ 3a2:	e8 c3 fe ff ff       	call   26a <printint>
+ 3a7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3aa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3ae:	e9 d8 00 00 00       	jmp    48b <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 3b3:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 3b7:	74 06                	je     3bf <printf+0xa4>
+ 3b9:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 3bd:	75 1e                	jne    3dd <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 3bf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3c2:	8b 00                	mov    (%eax),%eax
+ 3c4:	6a 00                	push   $0x0
+ 3c6:	6a 10                	push   $0x10
+ 3c8:	50                   	push   %eax
+ 3c9:	ff 75 08             	push   0x8(%ebp)
+ 3cc:	e8 99 fe ff ff       	call   26a <printint>
+ 3d1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3d4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3d8:	e9 ae 00 00 00       	jmp    48b <printf+0x170>
+      } else if(c == 's'){
+ 3dd:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 3e1:	75 43                	jne    426 <printf+0x10b>
+        s = (char*)*ap;
+ 3e3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3e6:	8b 00                	mov    (%eax),%eax
+ 3e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 3eb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 3ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3f3:	75 25                	jne    41a <printf+0xff>
+          s = "(null)";
+ 3f5:	c7 45 f4 d3 04 00 00 	movl   $0x4d3,-0xc(%ebp)
+        while(*s != 0){
+ 3fc:	eb 1c                	jmp    41a <printf+0xff>
+          putc(fd, *s);
+ 3fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 401:	0f b6 00             	movzbl (%eax),%eax
+ 404:	0f be c0             	movsbl %al,%eax
+ 407:	83 ec 08             	sub    $0x8,%esp
+ 40a:	50                   	push   %eax
+ 40b:	ff 75 08             	push   0x8(%ebp)
+ 40e:	e8 34 fe ff ff       	call   247 <putc>
+ 413:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 416:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 41a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 41d:	0f b6 00             	movzbl (%eax),%eax
+ 420:	84 c0                	test   %al,%al
+ 422:	75 da                	jne    3fe <printf+0xe3>
+ 424:	eb 65                	jmp    48b <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 426:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 42a:	75 1d                	jne    449 <printf+0x12e>
+        putc(fd, *ap);
+ 42c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 42f:	8b 00                	mov    (%eax),%eax
+ 431:	0f be c0             	movsbl %al,%eax
+ 434:	83 ec 08             	sub    $0x8,%esp
+ 437:	50                   	push   %eax
+ 438:	ff 75 08             	push   0x8(%ebp)
+ 43b:	e8 07 fe ff ff       	call   247 <putc>
+ 440:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 443:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 447:	eb 42                	jmp    48b <printf+0x170>
+      } else if(c == '%'){
+ 449:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 44d:	75 17                	jne    466 <printf+0x14b>
+        putc(fd, c);
+ 44f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 452:	0f be c0             	movsbl %al,%eax
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	50                   	push   %eax
+ 459:	ff 75 08             	push   0x8(%ebp)
+ 45c:	e8 e6 fd ff ff       	call   247 <putc>
+ 461:	83 c4 10             	add    $0x10,%esp
+ 464:	eb 25                	jmp    48b <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 466:	83 ec 08             	sub    $0x8,%esp
+ 469:	6a 25                	push   $0x25
+ 46b:	ff 75 08             	push   0x8(%ebp)
+ 46e:	e8 d4 fd ff ff       	call   247 <putc>
+ 473:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 476:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 479:	0f be c0             	movsbl %al,%eax
+ 47c:	83 ec 08             	sub    $0x8,%esp
+ 47f:	50                   	push   %eax
+ 480:	ff 75 08             	push   0x8(%ebp)
+ 483:	e8 bf fd ff ff       	call   247 <putc>
+ 488:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 48b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 492:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 496:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 499:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 49c:	01 d0                	add    %edx,%eax
+ 49e:	0f b6 00             	movzbl (%eax),%eax
+ 4a1:	84 c0                	test   %al,%al
+ 4a3:	0f 85 94 fe ff ff    	jne    33d <printf+0x22>
+    }
+  }
+}
+ 4a9:	90                   	nop
+ 4aa:	90                   	nop
+ 4ab:	c9                   	leave
+ 4ac:	c3                   	ret
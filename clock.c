@@ -0,0 +1,250 @@
+// Kernel clock and timed sleeps.
+//
+// Timed sleeps count in subticks, SUBTICK to a scheduler tick.
+// A process in timedsleep() hangs on the timer wheel slot for
+// its deadline.  The timer interrupts once per tick, but CPU 0
+// runs it in one-shot mode, programmed for the next tick or the
+// earliest sleeper due before it.  Each interrupt on CPU 0 moves
+// subticks up to the time read from the TSC, looking only at the
+// slots passed and waking the sleepers whose deadline has come.
+// Every sleeper waits on its own channel, so it is woken once.
+//
+// nanotime() reads the TSC, which clockinit() calibrates against
+// the LAPIC timer.  Each other CPU measures its TSC's offset from
+// the boot CPU's as it starts, so all CPUs agree on the time.
+
+#include "types.h"
+#include "defs.h"
+#include "date.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "x86.h"
+#include "traps.h"
+
+#define NWHEEL 256  // timer wheel slots, one per subtick
+#define NSYNC  8    // TSC offset measurements per CPU
+
+static uint subticks;
+static uint nextfire;  // subtick CPU 0's timer is set for
+static struct proc *wheel[NWHEEL];
+
+// ns = cycles * tscmult >> tscshift, cycles counted from tscboot.
+static uint64 tscboot;
+static uint tscmult;
+static int tscshift;
+
+// Handshake between the boot CPU and a starting CPU.
+static volatile uint syncstate;  // 0 idle, 1 asked, 2 answered
+static volatile uint64 synctsc;  // boot CPU's TSC in the answer
+
+// n / d, where the quotient must fit in 32 bits.
+// The kernel has no 64-bit division routine.
+uint
+div64(uint64 n, uint d, uint *rem)
+{
+  uint q, r;
+
+  asm("divl %4" : "=a" (q), "=d" (r)
+      : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+  if(rem)
+    *rem = r;
+  return q;
+}
+
+// Calibrate the TSC.  Runs on the boot CPU, interrupts off.
+void
+clockinit(void)
+{
+  uint cycles;
+
+  if((cycles = lapiccalibrate()) == 0)
+    return;  // no LAPIC: nanotime() falls back to subticks
+  // Largest shift that keeps tscmult within 32 bits.
+  for(tscshift = 32; ((uint64)10000000 << tscshift) >> 32 >= cycles; tscshift--)
+    ;
+  tscmult = div64((uint64)10000000 << tscshift, cycles, 0);
+  tscboot = rdtsc();
+}
+
+// Convert TSC cycles to nanoseconds; 0 if uncalibrated.
+uint64
+tsctons(uint64 t)
+{
+  return ((uint64)(uint)t * tscmult >> tscshift) +
+         (((uint64)(uint)(t >> 32) * tscmult) << (32 - tscshift));
+}
+
+// Nanoseconds since boot.
+uint64
+nanotime(void)
+{
+  uint64 t;
+
+  if(tscmult == 0)
+    return (uint64)subticks * NSPERSUBTICK;
+  pushcli();
+  t = rdtsc() - cpu->tscoff - tscboot;
+  popcli();
+  return tsctons(t);
+}
+
+// Fill in *ts with the time since boot.
+void
+nanouptime(struct timespec *ts)
+{
+  uint nsec;
+
+  ts->sec = div64(nanotime(), 1000000000, &nsec);
+  ts->nsec = nsec;
+}
+
+// A starting CPU measures its TSC offset from the boot CPU's,
+// which runs clocksyncbsp() at the same time.  Each round
+// brackets the boot CPU's reading between two of ours; the
+// round with the shortest round trip gives the offset.
+void
+clocksyncap(void)
+{
+  uint64 t0, t1, best, off;
+  int i;
+
+  if(tscmult == 0)
+    return;
+  best = ~0ULL;
+  off = 0;
+  for(i = 0; i < NSYNC; i++){
+    t0 = rdtsc();
+    xchg(&syncstate, 1);
+    while(syncstate != 2)
+      ;
+    t1 = rdtsc();
+    if(t1 - t0 < best){
+      best = t1 - t0;
+      off = t0 + (t1 - t0) / 2 - synctsc;
+    }
+    xchg(&syncstate, 0);
+  }
+  cpu->tscoff = off;
+}
+
+// Answer a starting CPU's clocksyncap().
+void
+clocksyncbsp(void)
+{
+  int i;
+
+  if(tscmult == 0)
+    return;
+  for(i = 0; i < NSYNC; i++){
+    while(syncstate != 1)
+      ;
+    synctsc = rdtsc();
+    xchg(&syncstate, 2);
+    while(syncstate == 2)
+      ;
+  }
+}
+
+// Set CPU 0's timer for the next tick or the earliest sleeper
+// due before it.  Caller must hold tickslock, on CPU 0.
+static void
+arm(void)
+{
+  struct proc *p;
+  uint64 at, now;
+  uint s;
+
+  if(tscmult == 0)
+    return;  // the PIT interrupts once per tick
+  nextfire = subticks - subticks % SUBTICK + SUBTICK;
+  for(s = subticks + 1; s != nextfire; s++){
+    for(p = wheel[s % NWHEEL]; p; p = p->timernext)
+      if(p->deadline == s)
+        goto found;
+  }
+found:
+  nextfire = s;
+  at = (uint64)nextfire * NSPERSUBTICK;
+  now = nanotime();
+  lapiconeshot(at > now ? (uint)(at - now) : 0);
+}
+
+// Called by CPU 0 on every timer interrupt.
+// Return 1 if a scheduler tick has gone by.
+int
+clockintr(void)
+{
+  struct proc **pp, *p;
+  uint now, t0;
+
+  acquire(&tickslock);
+  t0 = ticks;
+  if(tscmult)
+    now = div64(nanotime(), NSPERSUBTICK, 0);
+  else
+    now = subticks + SUBTICK;
+  while((int)(now - subticks) > 0){
+    subticks++;
+    if(subticks % SUBTICK == 0)
+      ticks++;
+    pp = &wheel[subticks % NWHEEL];
+    while((p = *pp) != 0){
+      if(p->deadline == subticks){
+        *pp = p->timernext;
+        wakeup(&p->deadline);
+      } else
+        pp = &p->timernext;
+    }
+  }
+  arm();
+  release(&tickslock);
+  return ticks != t0;
+}
+
+// Take proc off the wheel if it is still there.
+// Caller must hold tickslock.
+static void
+unhook(void)
+{
+  struct proc **pp;
+
+  for(pp = &wheel[proc->deadline % NWHEEL]; *pp; pp = &(*pp)->timernext){
+    if(*pp == proc){
+      *pp = proc->timernext;
+      break;
+    }
+  }
+}
+
+// Sleep for n subticks.
+// Return -1 if killed first, 0 otherwise.
+int
+timedsleep(uint n)
+{
+  int r;
+
+  r = 0;
+  acquire(&tickslock);
+  proc->deadline = subticks + n;
+  while((int)(proc->deadline - subticks) > 0){
+    if(proc->killed){
+      r = -1;
+      break;
+    }
+    proc->timernext = wheel[proc->deadline % NWHEEL];
+    wheel[proc->deadline % NWHEEL] = proc;
+    // Bring CPU 0's timer forward if it would fire too late.
+    if(tscmult && (int)(proc->deadline - nextfire) < 0){
+      if(cpu->id == 0)
+        arm();
+      else
+        lapicipi(0, T_IRQ0 + IRQ_TIMER);
+    }
+    sleep(&proc->deadline, &tickslock);
+    unhook();
+  }
+  release(&tickslock);
+  return r;
+}
@@ -0,0 +1,605 @@
+
+_cm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+//
+
+#include "user.h"
+
+int main()
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+    int first_fork = fork();
+  11:	e8 74 00 00 00       	call   8a <fork>
+  16:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    printf(2, "executing new Proc: %d\n", first_fork);
+  19:	83 ec 04             	sub    $0x4,%esp
+  1c:	ff 75 f4             	push   -0xc(%ebp)
+  1f:	68 28 04 00 00       	push   $0x428
+  24:	6a 02                	push   $0x2
+  26:	e8 6b 02 00 00       	call   296 <printf>
+  2b:	83 c4 10             	add    $0x10,%esp
+    if (first_fork == 0) //child
+  2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  32:	75 1f                	jne    53 <main+0x53>
+    {
+        char *name = "counter";
+  34:	c7 45 ec 40 04 00 00 	movl   $0x440,-0x14(%ebp)
+        char argv[1][1] = {{""}};
+  3b:	c6 45 eb 00          	movb   $0x0,-0x15(%ebp)
+        exec(name, (char **) argv);
+  3f:	83 ec 08             	sub    $0x8,%esp
+  42:	8d 45 eb             	lea    -0x15(%ebp),%eax
+  45:	50                   	push   %eax
+  46:	ff 75 ec             	push   -0x14(%ebp)
+  49:	e8 7c 00 00 00       	call   ca <exec>
+  4e:	83 c4 10             	add    $0x10,%esp
+  51:	eb 32                	jmp    85 <main+0x85>
+    }
+    else
+    {
+        saveProc();
+  53:	e8 da 00 00 00       	call   132 <saveProc>
+        wait();
+  58:	e8 3d 00 00 00       	call   9a <wait>
+
+
+        int fork_pid = loadProc();
+  5d:	e8 d8 00 00 00       	call   13a <loadProc>
+  62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+        printf(2, "loading new Proc: %d\n", fork_pid);
+  65:	83 ec 04             	sub    $0x4,%esp
+  68:	ff 75 f0             	push   -0x10(%ebp)
+  6b:	68 48 04 00 00       	push   $0x448
+  70:	6a 02                	push   $0x2
+  72:	e8 1f 02 00 00       	call   296 <printf>
+  77:	83 c4 10             	add    $0x10,%esp
+        if (fork_pid != 0)//parent
+  7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  7e:	74 05                	je     85 <main+0x85>
+            wait();
+  80:	e8 15 00 00 00       	call   9a <wait>
+    }
+    exit();
+  85:	e8 08 00 00 00       	call   92 <exit>
+
+0000008a <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  8a:	b8 01 00 00 00       	mov    $0x1,%eax
+  8f:	cd 40                	int    $0x40
+  91:	c3                   	ret
+
+00000092 <exit>:
+SYSCALL(exit)
+  92:	b8 02 00 00 00       	mov    $0x2,%eax
+  97:	cd 40                	int    $0x40
+  99:	c3                   	ret
+
+0000009a <wait>:
+SYSCALL(wait)
+  9a:	b8 03 00 00 00       	mov    $0x3,%eax
+  9f:	cd 40                	int    $0x40
+  a1:	c3                   	ret
+
+000000a2 <pipe>:
+SYSCALL(pipe)
+  a2:	b8 04 00 00 00       	mov    $0x4,%eax
+  a7:	cd 40                	int    $0x40
+  a9:	c3                   	ret
+
+000000aa <read>:
+SYSCALL(read)
+  aa:	b8 05 00 00 00       	mov    $0x5,%eax
+  af:	cd 40                	int    $0x40
+  b1:	c3                   	ret
+
+000000b2 <write>:
+SYSCALL(write)
+  b2:	b8 10 00 00 00       	mov    $0x10,%eax
+  b7:	cd 40                	int    $0x40
+  b9:	c3                   	ret
+
+000000ba <close>:
+SYSCALL(close)
+  ba:	b8 15 00 00 00       	mov    $0x15,%eax
+  bf:	cd 40                	int    $0x40
+  c1:	c3                   	ret
+
+000000c2 <kill>:
+SYSCALL(kill)
+  c2:	b8 06 00 00 00       	mov    $0x6,%eax
+  c7:	cd 40                	int    $0x40
+  c9:	c3                   	ret
+
+000000ca <exec>:
+SYSCALL(exec)
+  ca:	b8 07 00 00 00       	mov    $0x7,%eax
+  cf:	cd 40                	int    $0x40
+  d1:	c3                   	ret
+
+000000d2 <open>:
+SYSCALL(open)
+  d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  d7:	cd 40                	int    $0x40
+  d9:	c3                   	ret
+
+000000da <mknod>:
+SYSCALL(mknod)
+  da:	b8 11 00 00 00       	mov    $0x11,%eax
+  df:	cd 40                	int    $0x40
+  e1:	c3                   	ret
+
+000000e2 <unlink>:
+SYSCALL(unlink)
+  e2:	b8 12 00 00 00       	mov    $0x12,%eax
+  e7:	cd 40                	int    $0x40
+  e9:	c3                   	ret
+
+000000ea <fstat>:
+SYSCALL(fstat)
+  ea:	b8 08 00 00 00       	mov    $0x8,%eax
+  ef:	cd 40                	int    $0x40
+  f1:	c3                   	ret
+
+000000f2 <link>:
+SYSCALL(link)
+  f2:	b8 13 00 00 00       	mov    $0x13,%eax
+  f7:	cd 40                	int    $0x40
+  f9:	c3                   	ret
+
+000000fa <mkdir>:
+SYSCALL(mkdir)
+  fa:	b8 14 00 00 00       	mov    $0x14,%eax
+  ff:	cd 40                	int    $0x40
+ 101:	c3                   	ret
+
+00000102 <chdir>:
+SYSCALL(chdir)
+ 102:	b8 09 00 00 00       	mov    $0x9,%eax
+ 107:	cd 40                	int    $0x40
+ 109:	c3                   	ret
+
+0000010a <dup>:
+SYSCALL(dup)
+ 10a:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 10f:	cd 40                	int    $0x40
+ 111:	c3                   	ret
+
+00000112 <getpid>:
+SYSCALL(getpid)
+ 112:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 117:	cd 40                	int    $0x40
+ 119:	c3                   	ret
+
+0000011a <sbrk>:
+SYSCALL(sbrk)
+ 11a:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 11f:	cd 40                	int    $0x40
+ 121:	c3                   	ret
+
+00000122 <sleep>:
+SYSCALL(sleep)
+ 122:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 127:	cd 40                	int    $0x40
+ 129:	c3                   	ret
+
+0000012a <uptime>:
+SYSCALL(uptime)
+ 12a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 12f:	cd 40                	int    $0x40
+ 131:	c3                   	ret
+
+00000132 <saveProc>:
+SYSCALL(saveProc)
+ 132:	b8 16 00 00 00       	mov    $0x16,%eax
+ 137:	cd 40                	int    $0x40
+ 139:	c3                   	ret
+
+0000013a <loadProc>:
+SYSCALL(loadProc)
+ 13a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 13f:	cd 40                	int    $0x40
+ 141:	c3                   	ret
+
+00000142 <setpriority>:
+SYSCALL(setpriority)
+ 142:	b8 19 00 00 00       	mov    $0x19,%eax
+ 147:	cd 40                	int    $0x40
+ 149:	c3                   	ret
+
+0000014a <setaffinity>:
+SYSCALL(setaffinity)
+ 14a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 14f:	cd 40                	int    $0x40
+ 151:	c3                   	ret
+
+00000152 <getaffinity>:
+SYSCALL(getaffinity)
+ 152:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 157:	cd 40                	int    $0x40
+ 159:	c3                   	ret
+
+0000015a <nanosleep>:
+SYSCALL(nanosleep)
+ 15a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 15f:	cd 40                	int    $0x40
+ 161:	c3                   	ret
+
+00000162 <cpustat>:
+SYSCALL(cpustat)
+ 162:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 167:	cd 40                	int    $0x40
+ 169:	c3                   	ret
+
+0000016a <nanouptime>:
+SYSCALL(nanouptime)
+ 16a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 16f:	cd 40                	int    $0x40
+ 171:	c3                   	ret
+
+00000172 <settickets>:
+SYSCALL(settickets)
+ 172:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 177:	cd 40                	int    $0x40
+ 179:	c3                   	ret
+
+0000017a <setdeadline>:
+SYSCALL(setdeadline)
+ 17a:	b8 20 00 00 00       	mov    $0x20,%eax
+ 17f:	cd 40                	int    $0x40
+ 181:	c3                   	ret
+
+00000182 <rtstat>:
+SYSCALL(rtstat)
+ 182:	b8 21 00 00 00       	mov    $0x21,%eax
+ 187:	cd 40                	int    $0x40
+ 189:	c3                   	ret
+
+0000018a <schedstat>:
+SYSCALL(schedstat)
+ 18a:	b8 22 00 00 00       	mov    $0x22,%eax
+ 18f:	cd 40                	int    $0x40
+ 191:	c3                   	ret
+
+00000192 <waitpid>:
+SYSCALL(waitpid)
+ 192:	b8 23 00 00 00       	mov    $0x23,%eax
+ 197:	cd 40                	int    $0x40
+ 199:	c3                   	ret
+
+0000019a <clone>:
+SYSCALL(clone)
+ 19a:	b8 24 00 00 00       	mov    $0x24,%eax
+ 19f:	cd 40                	int    $0x40
+ 1a1:	c3                   	ret
+
+000001a2 <futexwait>:
+SYSCALL(futexwait)
+ 1a2:	b8 25 00 00 00       	mov    $0x25,%eax
+ 1a7:	cd 40                	int    $0x40
+ 1a9:	c3                   	ret
+
+000001aa <futexwake>:
+SYSCALL(futexwake)
+ 1aa:	b8 26 00 00 00       	mov    $0x26,%eax
+ 1af:	cd 40                	int    $0x40
+ 1b1:	c3                   	ret
+
+000001b2 <lockstat>:
+SYSCALL(lockstat)
+ 1b2:	b8 27 00 00 00       	mov    $0x27,%eax
+ 1b7:	cd 40                	int    $0x40
+ 1b9:	c3                   	ret
+
+000001ba <dcachestat>:
+SYSCALL(dcachestat)
+ 1ba:	b8 28 00 00 00       	mov    $0x28,%eax
+ 1bf:	cd 40                	int    $0x40
+ 1c1:	c3                   	ret
+
+000001c2 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1c2:	55                   	push   %ebp
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	83 ec 18             	sub    $0x18,%esp
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1ce:	83 ec 04             	sub    $0x4,%esp
+ 1d1:	6a 01                	push   $0x1
+ 1d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 1d6:	50                   	push   %eax
+ 1d7:	ff 75 08             	push   0x8(%ebp)
+ 1da:	e8 d3 fe ff ff       	call   b2 <write>
+ 1df:	83 c4 10             	add    $0x10,%esp
+}
+ 1e2:	90                   	nop
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+
+000001e5 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1e5:	55                   	push   %ebp
+ 1e6:	89 e5                	mov    %esp,%ebp
+ 1e8:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1eb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 1f2:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 1f6:	74 17                	je     20f <printint+0x2a>
+ 1f8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 1fc:	79 11                	jns    20f <printint+0x2a>
+    neg = 1;
+ 1fe:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 205:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 208:	f7 d8                	neg    %eax
+ 20a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 20d:	eb 06                	jmp    215 <printint+0x30>
+  } else {
+    x = xx;
+ 20f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 212:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 215:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 21c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 222:	ba 00 00 00 00       	mov    $0x0,%edx
+ 227:	f7 f1                	div    %ecx
+ 229:	89 d1                	mov    %edx,%ecx
+ 22b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 22e:	8d 50 01             	lea    0x1(%eax),%edx
+ 231:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 234:	0f b6 91 04 05 00 00 	movzbl 0x504(%ecx),%edx
+ 23b:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 23f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 242:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 245:	ba 00 00 00 00       	mov    $0x0,%edx
+ 24a:	f7 f1                	div    %ecx
+ 24c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 24f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 253:	75 c7                	jne    21c <printint+0x37>
+  if(neg)
+ 255:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 259:	74 2d                	je     288 <printint+0xa3>
+    buf[i++] = '-';
+ 25b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25e:	8d 50 01             	lea    0x1(%eax),%edx
+ 261:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 264:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 269:	eb 1d                	jmp    288 <printint+0xa3>
+    putc(fd, buf[i]);
+ 26b:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 26e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 271:	01 d0                	add    %edx,%eax
+ 273:	0f b6 00             	movzbl (%eax),%eax
+ 276:	0f be c0             	movsbl %al,%eax
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	50                   	push   %eax
+ 27d:	ff 75 08             	push   0x8(%ebp)
+ 280:	e8 3d ff ff ff       	call   1c2 <putc>
+ 285:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 288:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 28c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 290:	79 d9                	jns    26b <printint+0x86>
+}
+ 292:	90                   	nop
+ 293:	90                   	nop
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+
+00000296 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 296:	55                   	push   %ebp
+ 297:	89 e5                	mov    %esp,%ebp
+ 299:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 29c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 2a3:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 2a6:	83 c0 04             	add    $0x4,%eax
+ 2a9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 2ac:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 2b3:	e9 59 01 00 00       	jmp    411 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 2b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2bb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2be:	01 d0                	add    %edx,%eax
+ 2c0:	0f b6 00             	movzbl (%eax),%eax
+ 2c3:	0f be c0             	movsbl %al,%eax
+ 2c6:	25 ff 00 00 00       	and    $0xff,%eax
+ 2cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 2ce:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2d2:	75 2c                	jne    300 <printf+0x6a>
+      if(c == '%'){
+ 2d4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 2d8:	75 0c                	jne    2e6 <printf+0x50>
+        state = '%';
+ 2da:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 2e1:	e9 27 01 00 00       	jmp    40d <printf+0x177>
+      } else {
+        putc(fd, c);
+ 2e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2e9:	0f be c0             	movsbl %al,%eax
+ 2ec:	83 ec 08             	sub    $0x8,%esp
+ 2ef:	50                   	push   %eax
+ 2f0:	ff 75 08             	push   0x8(%ebp)
+ 2f3:	e8 ca fe ff ff       	call   1c2 <putc>
+ 2f8:	83 c4 10             	add    $0x10,%esp
+ 2fb:	e9 0d 01 00 00       	jmp    40d <printf+0x177>
+      }
+    } else if(state == '%'){
+ 300:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 304:	0f 85 03 01 00 00    	jne    40d <printf+0x177>
+      if(c == 'd'){
+ 30a:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 30e:	75 1e                	jne    32e <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 310:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 313:	8b 00                	mov    (%eax),%eax
+ 315:	6a 01                	push   $0x1
+ 317:	6a 0a                	push   $0xa
+ 319:	50                   	push   %eax
+ 31a:	ff 75 08             	push   0x8(%ebp)
+ 31d:	e8 c3 fe ff ff       	call   1e5 <printint>
+ 322:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 325:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 329:	e9 d8 00 00 00       	jmp    406 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 32e:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 332:	74 06                	je     33a <printf+0xa4>
+ 334:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 338:	75 1e                	jne    358 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 33a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 33d:	8b 00                	mov    (%eax),%eax
+ 33f:	6a 00                	push   $0x0
+ 341:	6a 10                	push   $0x10
+ 343:	50                   	push   %eax
+ 344:	ff 75 08             	push   0x8(%ebp)
+ 347:	e8 99 fe ff ff       	call   1e5 <printint>
+ 34c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 34f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 353:	e9 ae 00 00 00       	jmp    406 <printf+0x170>
+      } else if(c == 's'){
+ 358:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 35c:	75 43                	jne    3a1 <printf+0x10b>
+        s = (char*)*ap;
+ 35e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 361:	8b 00                	mov    (%eax),%eax
+ 363:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 366:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 36a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 36e:	75 25                	jne    395 <printf+0xff>
+          s = "(null)";
+ 370:	c7 45 f4 5e 04 00 00 	movl   $0x45e,-0xc(%ebp)
+        while(*s != 0){
+ 377:	eb 1c                	jmp    395 <printf+0xff>
+          putc(fd, *s);
+ 379:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 37c:	0f b6 00             	movzbl (%eax),%eax
+ 37f:	0f be c0             	movsbl %al,%eax
+ 382:	83 ec 08             	sub    $0x8,%esp
+ 385:	50                   	push   %eax
+ 386:	ff 75 08             	push   0x8(%ebp)
+ 389:	e8 34 fe ff ff       	call   1c2 <putc>
+ 38e:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 391:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 395:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 398:	0f b6 00             	movzbl (%eax),%eax
+ 39b:	84 c0                	test   %al,%al
+ 39d:	75 da                	jne    379 <printf+0xe3>
+ 39f:	eb 65                	jmp    406 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 3a1:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 3a5:	75 1d                	jne    3c4 <printf+0x12e>
+        putc(fd, *ap);
+ 3a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3aa:	8b 00                	mov    (%eax),%eax
+ 3ac:	0f be c0             	movsbl %al,%eax
+ 3af:	83 ec 08             	sub    $0x8,%esp
+ 3b2:	50                   	push   %eax
+ 3b3:	ff 75 08             	push   0x8(%ebp)
+ 3b6:	e8 07 fe ff ff       	call   1c2 <putc>
+ 3bb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3be:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3c2:	eb 42                	jmp    406 <printf+0x170>
+      } else if(c == '%'){
+ 3c4:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 3c8:	75 17                	jne    3e1 <printf+0x14b>
+        putc(fd, c);
+ 3ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3cd:	0f be c0             	movsbl %al,%eax
+ 3d0:	83 ec 08             	sub    $0x8,%esp
+ 3d3:	50                   	push   %eax
+ 3d4:	ff 75 08             	push   0x8(%ebp)
+ 3d7:	e8 e6 fd ff ff       	call   1c2 <putc>
+ 3dc:	83 c4 10             	add    $0x10,%esp
+ 3df:	eb 25                	jmp    406 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3e1:	83 ec 08             	sub    $0x8,%esp
+ 3e4:	6a 25                	push   $0x25
+ 3e6:	ff 75 08             	push   0x8(%ebp)
+ 3e9:	e8 d4 fd ff ff       	call   1c2 <putc>
+ 3ee:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 3f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3f4:	0f be c0             	movsbl %al,%eax
+ 3f7:	83 ec 08             	sub    $0x8,%esp
+ 3fa:	50                   	push   %eax
+ 3fb:	ff 75 08             	push   0x8(%ebp)
+ 3fe:	e8 bf fd ff ff       	call   1c2 <putc>
+ 403:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 406:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 40d:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 411:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 414:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 417:	01 d0                	add    %edx,%eax
+ 419:	0f b6 00             	movzbl (%eax),%eax
+ 41c:	84 c0                	test   %al,%al
+ 41e:	0f 85 94 fe ff ff    	jne    2b8 <printf+0x22>
+    }
+  }
+}
+ 424:	90                   	nop
+ 425:	90                   	nop
+ 426:	c9                   	leave
+ 427:	c3                   	ret
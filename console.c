@@ -7,6 +7,7 @@
 #include "param.h"
 #include "traps.h"
 #include "spinlock.h"
+#include "sleeplock.h"
 #include "fs.h"
 #include "file.h"
 #include "memlayout.h"
@@ -235,14 +236,14 @@ consoleread(struct inode *ip, char *dst, int n)
   uint target;
   int c;
 
-  iunlock(ip);
+  iunlockshared(ip);
   target = n;
   acquire(&cons.lock);
   while(n > 0){
     while(input.r == input.w){
       if(proc->killed){
         release(&cons.lock);
-        ilock(ip);
+        ilockshared(ip);
         return -1;
       }
       sleep(&input.r, &cons.lock);
@@ -262,7 +263,7 @@ consoleread(struct inode *ip, char *dst, int n)
       break;
   }
   release(&cons.lock);
-  ilock(ip);
+  ilockshared(ip);
 
   return target - n;
 }
@@ -0,0 +1,143 @@
+// Coroutines: cooperative threads of control within one process.
+//
+// coro_create() queues a coroutine, and coro_run() runs queued
+// coroutines until all have returned.  A coroutine runs until it
+// calls coro_yield(), which switches straight to the next one on
+// the queue, or returns.  Stacks come from malloc().  None of this
+// enters the kernel, and none of it is safe to use from more than
+// one clone()d thread.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define CSTACK 4096  // bytes of stack per coroutine
+
+struct coro {
+  uint *sp;            // saved stack pointer while not running
+  void (*fn)(void*);
+  void *arg;
+  char *stack;
+  struct coro *next;   // next on the run queue
+};
+
+void coroswtch(uint **old, uint *new);
+
+static struct coro runner;     // the caller of coro_run()
+static struct coro *cur;       // running coroutine
+static struct coro *head, *tail;  // ready to run, in order
+static struct coro *dead;      // returned; free once off its stack
+
+static void
+enqueue(struct coro *c)
+{
+  c->next = 0;
+  if(tail)
+    tail->next = c;
+  else
+    head = c;
+  tail = c;
+}
+
+static struct coro*
+dequeue(void)
+{
+  struct coro *c;
+
+  if((c = head) != 0 && (head = c->next) == 0)
+    tail = 0;
+  return c;
+}
+
+// Free the coroutine that returned last, now that
+// we are off its stack.
+static void
+reap(void)
+{
+  if(dead){
+    free(dead->stack);
+    free(dead);
+    dead = 0;
+  }
+}
+
+// Switch from the running coroutine to c.
+static void
+switchto(struct coro *c)
+{
+  struct coro *prev;
+
+  prev = cur;
+  cur = c;
+  coroswtch(&prev->sp, c->sp);
+  reap();
+}
+
+// First code a new coroutine runs.
+static void
+corostart(void)
+{
+  struct coro *next;
+
+  reap();
+  cur->fn(cur->arg);
+  dead = cur;
+  if((next = dequeue()) == 0)
+    next = &runner;
+  switchto(next);
+}
+
+// Queue fn(arg) to run as a coroutine.  Return 0, or -1 if
+// out of memory.
+int
+coro_create(void (*fn)(void*), void *arg)
+{
+  struct coro *c;
+  uint *sp;
+
+  if((c = malloc(sizeof(*c))) == 0)
+    return -1;
+  if((c->stack = malloc(CSTACK)) == 0){
+    free(c);
+    return -1;
+  }
+  c->fn = fn;
+  c->arg = arg;
+
+  // A frame for coroswtch() to pop: four registers,
+  // then corostart() as the return address.
+  sp = (uint*)(c->stack + CSTACK);
+  *--sp = 0;              // corostart()'s return address; never used
+  *--sp = (uint)corostart;
+  sp -= 4;
+  memset(sp, 0, 4 * sizeof(uint));
+  c->sp = sp;
+  enqueue(c);
+  return 0;
+}
+
+// Let the other queued coroutines run.
+// Does nothing outside coro_run().
+void
+coro_yield(void)
+{
+  struct coro *next;
+
+  if(cur == 0 || (next = dequeue()) == 0)
+    return;
+  enqueue(cur);
+  switchto(next);
+}
+
+// Run queued coroutines until every one has returned.
+void
+coro_run(void)
+{
+  struct coro *next;
+
+  if((next = dequeue()) == 0)
+    return;
+  cur = &runner;
+  switchto(next);
+  cur = 0;
+}
@@ -0,0 +1,2049 @@
+
+_corobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <yielder>:
+
+static int nyield;
+
+static void
+yielder(void *arg)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < nyield; i++)
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+   d:	eb 09                	jmp    18 <yielder+0x18>
+    coro_yield();
+   f:	e8 8f 0a 00 00       	call   aa3 <coro_yield>
+  for(i = 0; i < nyield; i++)
+  14:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  18:	a1 a0 13 00 00       	mov    0x13a0,%eax
+  1d:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+  20:	7c ed                	jl     f <yielder+0xf>
+}
+  22:	90                   	nop
+  23:	90                   	nop
+  24:	c9                   	leave
+  25:	c3                   	ret
+
+00000026 <perswitch>:
+
+// Nanoseconds per switch for n switches in us microseconds.
+static uint
+perswitch(uint us, int n)
+{
+  26:	55                   	push   %ebp
+  27:	89 e5                	mov    %esp,%ebp
+  29:	53                   	push   %ebx
+  return us / n * 1000 + us % n * 1000 / n;
+  2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  30:	ba 00 00 00 00       	mov    $0x0,%edx
+  35:	f7 f1                	div    %ecx
+  37:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+  3d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  40:	8b 45 08             	mov    0x8(%ebp),%eax
+  43:	ba 00 00 00 00       	mov    $0x0,%edx
+  48:	f7 f3                	div    %ebx
+  4a:	89 d0                	mov    %edx,%eax
+  4c:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  55:	ba 00 00 00 00       	mov    $0x0,%edx
+  5a:	f7 f3                	div    %ebx
+  5c:	01 c8                	add    %ecx,%eax
+}
+  5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  61:	c9                   	leave
+  62:	c3                   	ret
+
+00000063 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  63:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  67:	83 e4 f0             	and    $0xfffffff0,%esp
+  6a:	ff 71 fc             	push   -0x4(%ecx)
+  6d:	55                   	push   %ebp
+  6e:	89 e5                	mov    %esp,%ebp
+  70:	51                   	push   %ecx
+  71:	83 ec 34             	sub    $0x34,%esp
+  74:	89 c8                	mov    %ecx,%eax
+  int n, i, ping[2], pong[2];
+  uint t0, us;
+  char c;
+
+  n = 100000;
+  76:	c7 45 f4 a0 86 01 00 	movl   $0x186a0,-0xc(%ebp)
+  if(argc > 1 && (n = atoi(argv[1])) < 2){
+  7d:	83 38 01             	cmpl   $0x1,(%eax)
+  80:	7e 34                	jle    b6 <main+0x53>
+  82:	8b 40 04             	mov    0x4(%eax),%eax
+  85:	83 c0 04             	add    $0x4,%eax
+  88:	8b 00                	mov    (%eax),%eax
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	50                   	push   %eax
+  8e:	e8 b8 03 00 00       	call   44b <atoi>
+  93:	83 c4 10             	add    $0x10,%esp
+  96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  99:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+  9d:	7f 17                	jg     b6 <main+0x53>
+    printf(2, "usage: corobench [switches]\n");
+  9f:	83 ec 08             	sub    $0x8,%esp
+  a2:	68 d0 0e 00 00       	push   $0xed0
+  a7:	6a 02                	push   $0x2
+  a9:	e8 64 06 00 00       	call   712 <printf>
+  ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+  b1:	e8 58 04 00 00       	call   50e <exit>
+  }
+
+  nyield = n / 2;
+  b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b9:	89 c2                	mov    %eax,%edx
+  bb:	c1 ea 1f             	shr    $0x1f,%edx
+  be:	01 d0                	add    %edx,%eax
+  c0:	d1 f8                	sar    %eax
+  c2:	a3 a0 13 00 00       	mov    %eax,0x13a0
+  if(coro_create(yielder, 0) < 0 || coro_create(yielder, 0) < 0){
+  c7:	83 ec 08             	sub    $0x8,%esp
+  ca:	6a 00                	push   $0x0
+  cc:	68 00 00 00 00       	push   $0x0
+  d1:	e8 04 09 00 00       	call   9da <coro_create>
+  d6:	83 c4 10             	add    $0x10,%esp
+  d9:	85 c0                	test   %eax,%eax
+  db:	78 16                	js     f3 <main+0x90>
+  dd:	83 ec 08             	sub    $0x8,%esp
+  e0:	6a 00                	push   $0x0
+  e2:	68 00 00 00 00       	push   $0x0
+  e7:	e8 ee 08 00 00       	call   9da <coro_create>
+  ec:	83 c4 10             	add    $0x10,%esp
+  ef:	85 c0                	test   %eax,%eax
+  f1:	79 17                	jns    10a <main+0xa7>
+    printf(2, "corobench: out of memory\n");
+  f3:	83 ec 08             	sub    $0x8,%esp
+  f6:	68 ed 0e 00 00       	push   $0xeed
+  fb:	6a 02                	push   $0x2
+  fd:	e8 10 06 00 00       	call   712 <printf>
+ 102:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 105:	e8 04 04 00 00       	call   50e <exit>
+  }
+  t0 = uptimeus();
+ 10a:	e8 c6 03 00 00       	call   4d5 <uptimeus>
+ 10f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  coro_run();
+ 112:	e8 ca 09 00 00       	call   ae1 <coro_run>
+  us = uptimeus() - t0;
+ 117:	e8 b9 03 00 00       	call   4d5 <uptimeus>
+ 11c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 11f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  printf(1, "coroutine: %d switches in %dus, %dns each\n",
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	ff 75 f4             	push   -0xc(%ebp)
+ 128:	ff 75 e8             	push   -0x18(%ebp)
+ 12b:	e8 f6 fe ff ff       	call   26 <perswitch>
+ 130:	83 c4 10             	add    $0x10,%esp
+ 133:	83 ec 0c             	sub    $0xc,%esp
+ 136:	50                   	push   %eax
+ 137:	ff 75 e8             	push   -0x18(%ebp)
+ 13a:	ff 75 f4             	push   -0xc(%ebp)
+ 13d:	68 08 0f 00 00       	push   $0xf08
+ 142:	6a 01                	push   $0x1
+ 144:	e8 c9 05 00 00       	call   712 <printf>
+ 149:	83 c4 20             	add    $0x20,%esp
+         n, us, perswitch(us, n));
+
+  if(setaffinity(getpid(), 1) < 0 || pipe(ping) < 0 || pipe(pong) < 0){
+ 14c:	e8 3d 04 00 00       	call   58e <getpid>
+ 151:	83 ec 08             	sub    $0x8,%esp
+ 154:	6a 01                	push   $0x1
+ 156:	50                   	push   %eax
+ 157:	e8 6a 04 00 00       	call   5c6 <setaffinity>
+ 15c:	83 c4 10             	add    $0x10,%esp
+ 15f:	85 c0                	test   %eax,%eax
+ 161:	78 26                	js     189 <main+0x126>
+ 163:	83 ec 0c             	sub    $0xc,%esp
+ 166:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 169:	50                   	push   %eax
+ 16a:	e8 af 03 00 00       	call   51e <pipe>
+ 16f:	83 c4 10             	add    $0x10,%esp
+ 172:	85 c0                	test   %eax,%eax
+ 174:	78 13                	js     189 <main+0x126>
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 17c:	50                   	push   %eax
+ 17d:	e8 9c 03 00 00       	call   51e <pipe>
+ 182:	83 c4 10             	add    $0x10,%esp
+ 185:	85 c0                	test   %eax,%eax
+ 187:	79 17                	jns    1a0 <main+0x13d>
+    printf(2, "corobench: cannot set up processes\n");
+ 189:	83 ec 08             	sub    $0x8,%esp
+ 18c:	68 34 0f 00 00       	push   $0xf34
+ 191:	6a 02                	push   $0x2
+ 193:	e8 7a 05 00 00       	call   712 <printf>
+ 198:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 19b:	e8 6e 03 00 00       	call   50e <exit>
+  }
+  if(fork() == 0){
+ 1a0:	e8 61 03 00 00       	call   506 <fork>
+ 1a5:	85 c0                	test   %eax,%eax
+ 1a7:	75 4d                	jne    1f6 <main+0x193>
+    for(i = 0; i < n / 2; i++){
+ 1a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 1b0:	eb 2e                	jmp    1e0 <main+0x17d>
+      read(ping[0], &c, 1);
+ 1b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1b5:	83 ec 04             	sub    $0x4,%esp
+ 1b8:	6a 01                	push   $0x1
+ 1ba:	8d 55 d7             	lea    -0x29(%ebp),%edx
+ 1bd:	52                   	push   %edx
+ 1be:	50                   	push   %eax
+ 1bf:	e8 62 03 00 00       	call   526 <read>
+ 1c4:	83 c4 10             	add    $0x10,%esp
+      write(pong[1], &c, 1);
+ 1c7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1ca:	83 ec 04             	sub    $0x4,%esp
+ 1cd:	6a 01                	push   $0x1
+ 1cf:	8d 55 d7             	lea    -0x29(%ebp),%edx
+ 1d2:	52                   	push   %edx
+ 1d3:	50                   	push   %eax
+ 1d4:	e8 55 03 00 00       	call   52e <write>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n / 2; i++){
+ 1dc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 1e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e3:	89 c2                	mov    %eax,%edx
+ 1e5:	c1 ea 1f             	shr    $0x1f,%edx
+ 1e8:	01 d0                	add    %edx,%eax
+ 1ea:	d1 f8                	sar    %eax
+ 1ec:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+ 1ef:	7c c1                	jl     1b2 <main+0x14f>
+    }
+    exit();
+ 1f1:	e8 18 03 00 00       	call   50e <exit>
+  }
+  t0 = uptimeus();
+ 1f6:	e8 da 02 00 00       	call   4d5 <uptimeus>
+ 1fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < n / 2; i++){
+ 1fe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 205:	eb 2f                	jmp    236 <main+0x1d3>
+    write(ping[1], "x", 1);
+ 207:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 20a:	83 ec 04             	sub    $0x4,%esp
+ 20d:	6a 01                	push   $0x1
+ 20f:	68 58 0f 00 00       	push   $0xf58
+ 214:	50                   	push   %eax
+ 215:	e8 14 03 00 00       	call   52e <write>
+ 21a:	83 c4 10             	add    $0x10,%esp
+    read(pong[0], &c, 1);
+ 21d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	8d 55 d7             	lea    -0x29(%ebp),%edx
+ 228:	52                   	push   %edx
+ 229:	50                   	push   %eax
+ 22a:	e8 f7 02 00 00       	call   526 <read>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n / 2; i++){
+ 232:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 236:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 239:	89 c2                	mov    %eax,%edx
+ 23b:	c1 ea 1f             	shr    $0x1f,%edx
+ 23e:	01 d0                	add    %edx,%eax
+ 240:	d1 f8                	sar    %eax
+ 242:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+ 245:	7c c0                	jl     207 <main+0x1a4>
+  }
+  us = uptimeus() - t0;
+ 247:	e8 89 02 00 00       	call   4d5 <uptimeus>
+ 24c:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 24f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  wait();
+ 252:	e8 bf 02 00 00       	call   516 <wait>
+  printf(1, "process:   %d switches in %dus, %dns each\n",
+ 257:	83 ec 08             	sub    $0x8,%esp
+ 25a:	ff 75 f4             	push   -0xc(%ebp)
+ 25d:	ff 75 e8             	push   -0x18(%ebp)
+ 260:	e8 c1 fd ff ff       	call   26 <perswitch>
+ 265:	83 c4 10             	add    $0x10,%esp
+ 268:	83 ec 0c             	sub    $0xc,%esp
+ 26b:	50                   	push   %eax
+ 26c:	ff 75 e8             	push   -0x18(%ebp)
+ 26f:	ff 75 f4             	push   -0xc(%ebp)
+ 272:	68 5c 0f 00 00       	push   $0xf5c
+ 277:	6a 01                	push   $0x1
+ 279:	e8 94 04 00 00       	call   712 <printf>
+ 27e:	83 c4 20             	add    $0x20,%esp
+         n, us, perswitch(us, n));
+  exit();
+ 281:	e8 88 02 00 00       	call   50e <exit>
+
+00000286 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 286:	55                   	push   %ebp
+ 287:	89 e5                	mov    %esp,%ebp
+ 289:	57                   	push   %edi
+ 28a:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 28b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 28e:	8b 55 10             	mov    0x10(%ebp),%edx
+ 291:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 294:	89 cb                	mov    %ecx,%ebx
+ 296:	89 df                	mov    %ebx,%edi
+ 298:	89 d1                	mov    %edx,%ecx
+ 29a:	fc                   	cld
+ 29b:	f3 aa                	rep stos %al,%es:(%edi)
+ 29d:	89 ca                	mov    %ecx,%edx
+ 29f:	89 fb                	mov    %edi,%ebx
+ 2a1:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2a4:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 2a7:	90                   	nop
+ 2a8:	5b                   	pop    %ebx
+ 2a9:	5f                   	pop    %edi
+ 2aa:	5d                   	pop    %ebp
+ 2ab:	c3                   	ret
+
+000002ac <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2ac:	55                   	push   %ebp
+ 2ad:	89 e5                	mov    %esp,%ebp
+ 2af:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 2b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2b8:	90                   	nop
+ 2b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2bc:	8d 42 01             	lea    0x1(%edx),%eax
+ 2bf:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2c8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2cb:	0f b6 12             	movzbl (%edx),%edx
+ 2ce:	88 10                	mov    %dl,(%eax)
+ 2d0:	0f b6 00             	movzbl (%eax),%eax
+ 2d3:	84 c0                	test   %al,%al
+ 2d5:	75 e2                	jne    2b9 <strcpy+0xd>
+    ;
+  return os;
+ 2d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2da:	c9                   	leave
+ 2db:	c3                   	ret
+
+000002dc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2dc:	55                   	push   %ebp
+ 2dd:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2df:	eb 08                	jmp    2e9 <strcmp+0xd>
+    p++, q++;
+ 2e1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2e5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ec:	0f b6 00             	movzbl (%eax),%eax
+ 2ef:	84 c0                	test   %al,%al
+ 2f1:	74 10                	je     303 <strcmp+0x27>
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 10             	movzbl (%eax),%edx
+ 2f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fc:	0f b6 00             	movzbl (%eax),%eax
+ 2ff:	38 c2                	cmp    %al,%dl
+ 301:	74 de                	je     2e1 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 00             	movzbl (%eax),%eax
+ 309:	0f b6 d0             	movzbl %al,%edx
+ 30c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 30f:	0f b6 00             	movzbl (%eax),%eax
+ 312:	0f b6 c0             	movzbl %al,%eax
+ 315:	29 c2                	sub    %eax,%edx
+ 317:	89 d0                	mov    %edx,%eax
+}
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <strlen>:
+
+uint
+strlen(char *s)
+{
+ 31b:	55                   	push   %ebp
+ 31c:	89 e5                	mov    %esp,%ebp
+ 31e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 321:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 328:	eb 04                	jmp    32e <strlen+0x13>
+ 32a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 32e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 331:	8b 45 08             	mov    0x8(%ebp),%eax
+ 334:	01 d0                	add    %edx,%eax
+ 336:	0f b6 00             	movzbl (%eax),%eax
+ 339:	84 c0                	test   %al,%al
+ 33b:	75 ed                	jne    32a <strlen+0xf>
+    ;
+  return n;
+ 33d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 340:	c9                   	leave
+ 341:	c3                   	ret
+
+00000342 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 342:	55                   	push   %ebp
+ 343:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 345:	8b 45 10             	mov    0x10(%ebp),%eax
+ 348:	50                   	push   %eax
+ 349:	ff 75 0c             	push   0xc(%ebp)
+ 34c:	ff 75 08             	push   0x8(%ebp)
+ 34f:	e8 32 ff ff ff       	call   286 <stosb>
+ 354:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 357:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+
+0000035c <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 35c:	55                   	push   %ebp
+ 35d:	89 e5                	mov    %esp,%ebp
+ 35f:	83 ec 04             	sub    $0x4,%esp
+ 362:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 365:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 368:	eb 14                	jmp    37e <strchr+0x22>
+    if(*s == c)
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	0f b6 00             	movzbl (%eax),%eax
+ 370:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 373:	75 05                	jne    37a <strchr+0x1e>
+      return (char*)s;
+ 375:	8b 45 08             	mov    0x8(%ebp),%eax
+ 378:	eb 13                	jmp    38d <strchr+0x31>
+  for(; *s; s++)
+ 37a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 37e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 381:	0f b6 00             	movzbl (%eax),%eax
+ 384:	84 c0                	test   %al,%al
+ 386:	75 e2                	jne    36a <strchr+0xe>
+  return 0;
+ 388:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 38d:	c9                   	leave
+ 38e:	c3                   	ret
+
+0000038f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 38f:	55                   	push   %ebp
+ 390:	89 e5                	mov    %esp,%ebp
+ 392:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 395:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 39c:	eb 42                	jmp    3e0 <gets+0x51>
+    cc = read(0, &c, 1);
+ 39e:	83 ec 04             	sub    $0x4,%esp
+ 3a1:	6a 01                	push   $0x1
+ 3a3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3a6:	50                   	push   %eax
+ 3a7:	6a 00                	push   $0x0
+ 3a9:	e8 78 01 00 00       	call   526 <read>
+ 3ae:	83 c4 10             	add    $0x10,%esp
+ 3b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3b8:	7e 33                	jle    3ed <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3bd:	8d 50 01             	lea    0x1(%eax),%edx
+ 3c0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3c3:	89 c2                	mov    %eax,%edx
+ 3c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c8:	01 c2                	add    %eax,%edx
+ 3ca:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3ce:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3d0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3d4:	3c 0a                	cmp    $0xa,%al
+ 3d6:	74 16                	je     3ee <gets+0x5f>
+ 3d8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3dc:	3c 0d                	cmp    $0xd,%al
+ 3de:	74 0e                	je     3ee <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3e3:	83 c0 01             	add    $0x1,%eax
+ 3e6:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3e9:	7f b3                	jg     39e <gets+0xf>
+ 3eb:	eb 01                	jmp    3ee <gets+0x5f>
+      break;
+ 3ed:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3ee:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f4:	01 d0                	add    %edx,%eax
+ 3f6:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3f9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3fc:	c9                   	leave
+ 3fd:	c3                   	ret
+
+000003fe <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 3fe:	55                   	push   %ebp
+ 3ff:	89 e5                	mov    %esp,%ebp
+ 401:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 404:	83 ec 08             	sub    $0x8,%esp
+ 407:	6a 00                	push   $0x0
+ 409:	ff 75 08             	push   0x8(%ebp)
+ 40c:	e8 3d 01 00 00       	call   54e <open>
+ 411:	83 c4 10             	add    $0x10,%esp
+ 414:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 417:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 41b:	79 07                	jns    424 <stat+0x26>
+    return -1;
+ 41d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 422:	eb 25                	jmp    449 <stat+0x4b>
+  r = fstat(fd, st);
+ 424:	83 ec 08             	sub    $0x8,%esp
+ 427:	ff 75 0c             	push   0xc(%ebp)
+ 42a:	ff 75 f4             	push   -0xc(%ebp)
+ 42d:	e8 34 01 00 00       	call   566 <fstat>
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 438:	83 ec 0c             	sub    $0xc,%esp
+ 43b:	ff 75 f4             	push   -0xc(%ebp)
+ 43e:	e8 f3 00 00 00       	call   536 <close>
+ 443:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 446:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 449:	c9                   	leave
+ 44a:	c3                   	ret
+
+0000044b <atoi>:
+
+int
+atoi(const char *s)
+{
+ 44b:	55                   	push   %ebp
+ 44c:	89 e5                	mov    %esp,%ebp
+ 44e:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 451:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 458:	eb 25                	jmp    47f <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 45a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 45d:	89 d0                	mov    %edx,%eax
+ 45f:	c1 e0 02             	shl    $0x2,%eax
+ 462:	01 d0                	add    %edx,%eax
+ 464:	01 c0                	add    %eax,%eax
+ 466:	89 c1                	mov    %eax,%ecx
+ 468:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46b:	8d 50 01             	lea    0x1(%eax),%edx
+ 46e:	89 55 08             	mov    %edx,0x8(%ebp)
+ 471:	0f b6 00             	movzbl (%eax),%eax
+ 474:	0f be c0             	movsbl %al,%eax
+ 477:	01 c8                	add    %ecx,%eax
+ 479:	83 e8 30             	sub    $0x30,%eax
+ 47c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 47f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 482:	0f b6 00             	movzbl (%eax),%eax
+ 485:	3c 2f                	cmp    $0x2f,%al
+ 487:	7e 0a                	jle    493 <atoi+0x48>
+ 489:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48c:	0f b6 00             	movzbl (%eax),%eax
+ 48f:	3c 39                	cmp    $0x39,%al
+ 491:	7e c7                	jle    45a <atoi+0xf>
+  return n;
+ 493:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 496:	c9                   	leave
+ 497:	c3                   	ret
+
+00000498 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 498:	55                   	push   %ebp
+ 499:	89 e5                	mov    %esp,%ebp
+ 49b:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 49e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4aa:	eb 17                	jmp    4c3 <memmove+0x2b>
+    *dst++ = *src++;
+ 4ac:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4af:	8d 42 01             	lea    0x1(%edx),%eax
+ 4b2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4b8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4bb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4be:	0f b6 12             	movzbl (%edx),%edx
+ 4c1:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4c3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4c6:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4c9:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4cc:	85 c0                	test   %eax,%eax
+ 4ce:	7f dc                	jg     4ac <memmove+0x14>
+  return vdst;
+ 4d0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4d3:	c9                   	leave
+ 4d4:	c3                   	ret
+
+000004d5 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 4d5:	55                   	push   %ebp
+ 4d6:	89 e5                	mov    %esp,%ebp
+ 4d8:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 4db:	83 ec 0c             	sub    $0xc,%esp
+ 4de:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 ff 00 00 00       	call   5e6 <nanouptime>
+ 4e7:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 4ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4ed:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 4f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4f6:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 4fb:	f7 e2                	mul    %edx
+ 4fd:	89 d0                	mov    %edx,%eax
+ 4ff:	c1 e8 06             	shr    $0x6,%eax
+ 502:	01 c8                	add    %ecx,%eax
+}
+ 504:	c9                   	leave
+ 505:	c3                   	ret
+
+00000506 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 506:	b8 01 00 00 00       	mov    $0x1,%eax
+ 50b:	cd 40                	int    $0x40
+ 50d:	c3                   	ret
+
+0000050e <exit>:
+SYSCALL(exit)
+ 50e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 513:	cd 40                	int    $0x40
+ 515:	c3                   	ret
+
+00000516 <wait>:
+SYSCALL(wait)
+ 516:	b8 03 00 00 00       	mov    $0x3,%eax
+ 51b:	cd 40                	int    $0x40
+ 51d:	c3                   	ret
+
+0000051e <pipe>:
+SYSCALL(pipe)
+ 51e:	b8 04 00 00 00       	mov    $0x4,%eax
+ 523:	cd 40                	int    $0x40
+ 525:	c3                   	ret
+
+00000526 <read>:
+SYSCALL(read)
+ 526:	b8 05 00 00 00       	mov    $0x5,%eax
+ 52b:	cd 40                	int    $0x40
+ 52d:	c3                   	ret
+
+0000052e <write>:
+SYSCALL(write)
+ 52e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 533:	cd 40                	int    $0x40
+ 535:	c3                   	ret
+
+00000536 <close>:
+SYSCALL(close)
+ 536:	b8 15 00 00 00       	mov    $0x15,%eax
+ 53b:	cd 40                	int    $0x40
+ 53d:	c3                   	ret
+
+0000053e <kill>:
+SYSCALL(kill)
+ 53e:	b8 06 00 00 00       	mov    $0x6,%eax
+ 543:	cd 40                	int    $0x40
+ 545:	c3                   	ret
+
+00000546 <exec>:
+SYSCALL(exec)
+ 546:	b8 07 00 00 00       	mov    $0x7,%eax
+ 54b:	cd 40                	int    $0x40
+ 54d:	c3                   	ret
+
+0000054e <open>:
+SYSCALL(open)
+ 54e:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 553:	cd 40                	int    $0x40
+ 555:	c3                   	ret
+
+00000556 <mknod>:
+SYSCALL(mknod)
+ 556:	b8 11 00 00 00       	mov    $0x11,%eax
+ 55b:	cd 40                	int    $0x40
+ 55d:	c3                   	ret
+
+0000055e <unlink>:
+SYSCALL(unlink)
+ 55e:	b8 12 00 00 00       	mov    $0x12,%eax
+ 563:	cd 40                	int    $0x40
+ 565:	c3                   	ret
+
+00000566 <fstat>:
+SYSCALL(fstat)
+ 566:	b8 08 00 00 00       	mov    $0x8,%eax
+ 56b:	cd 40                	int    $0x40
+ 56d:	c3                   	ret
+
+0000056e <link>:
+SYSCALL(link)
+ 56e:	b8 13 00 00 00       	mov    $0x13,%eax
+ 573:	cd 40                	int    $0x40
+ 575:	c3                   	ret
+
+00000576 <mkdir>:
+SYSCALL(mkdir)
+ 576:	b8 14 00 00 00       	mov    $0x14,%eax
+ 57b:	cd 40                	int    $0x40
+ 57d:	c3                   	ret
+
+0000057e <chdir>:
+SYSCALL(chdir)
+ 57e:	b8 09 00 00 00       	mov    $0x9,%eax
+ 583:	cd 40                	int    $0x40
+ 585:	c3                   	ret
+
+00000586 <dup>:
+SYSCALL(dup)
+ 586:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 58b:	cd 40                	int    $0x40
+ 58d:	c3                   	ret
+
+0000058e <getpid>:
+SYSCALL(getpid)
+ 58e:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 593:	cd 40                	int    $0x40
+ 595:	c3                   	ret
+
+00000596 <sbrk>:
+SYSCALL(sbrk)
+ 596:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 59b:	cd 40                	int    $0x40
+ 59d:	c3                   	ret
+
+0000059e <sleep>:
+SYSCALL(sleep)
+ 59e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5a3:	cd 40                	int    $0x40
+ 5a5:	c3                   	ret
+
+000005a6 <uptime>:
+SYSCALL(uptime)
+ 5a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5ab:	cd 40                	int    $0x40
+ 5ad:	c3                   	ret
+
+000005ae <saveProc>:
+SYSCALL(saveProc)
+ 5ae:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b3:	cd 40                	int    $0x40
+ 5b5:	c3                   	ret
+
+000005b6 <loadProc>:
+SYSCALL(loadProc)
+ 5b6:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5bb:	cd 40                	int    $0x40
+ 5bd:	c3                   	ret
+
+000005be <setpriority>:
+SYSCALL(setpriority)
+ 5be:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5c3:	cd 40                	int    $0x40
+ 5c5:	c3                   	ret
+
+000005c6 <setaffinity>:
+SYSCALL(setaffinity)
+ 5c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5cb:	cd 40                	int    $0x40
+ 5cd:	c3                   	ret
+
+000005ce <getaffinity>:
+SYSCALL(getaffinity)
+ 5ce:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d3:	cd 40                	int    $0x40
+ 5d5:	c3                   	ret
+
+000005d6 <nanosleep>:
+SYSCALL(nanosleep)
+ 5d6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5db:	cd 40                	int    $0x40
+ 5dd:	c3                   	ret
+
+000005de <cpustat>:
+SYSCALL(cpustat)
+ 5de:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e3:	cd 40                	int    $0x40
+ 5e5:	c3                   	ret
+
+000005e6 <nanouptime>:
+SYSCALL(nanouptime)
+ 5e6:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5eb:	cd 40                	int    $0x40
+ 5ed:	c3                   	ret
+
+000005ee <settickets>:
+SYSCALL(settickets)
+ 5ee:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f3:	cd 40                	int    $0x40
+ 5f5:	c3                   	ret
+
+000005f6 <setdeadline>:
+SYSCALL(setdeadline)
+ 5f6:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5fb:	cd 40                	int    $0x40
+ 5fd:	c3                   	ret
+
+000005fe <rtstat>:
+SYSCALL(rtstat)
+ 5fe:	b8 21 00 00 00       	mov    $0x21,%eax
+ 603:	cd 40                	int    $0x40
+ 605:	c3                   	ret
+
+00000606 <schedstat>:
+SYSCALL(schedstat)
+ 606:	b8 22 00 00 00       	mov    $0x22,%eax
+ 60b:	cd 40                	int    $0x40
+ 60d:	c3                   	ret
+
+0000060e <waitpid>:
+SYSCALL(waitpid)
+ 60e:	b8 23 00 00 00       	mov    $0x23,%eax
+ 613:	cd 40                	int    $0x40
+ 615:	c3                   	ret
+
+00000616 <clone>:
+SYSCALL(clone)
+ 616:	b8 24 00 00 00       	mov    $0x24,%eax
+ 61b:	cd 40                	int    $0x40
+ 61d:	c3                   	ret
+
+0000061e <futexwait>:
+SYSCALL(futexwait)
+ 61e:	b8 25 00 00 00       	mov    $0x25,%eax
+ 623:	cd 40                	int    $0x40
+ 625:	c3                   	ret
+
+00000626 <futexwake>:
+SYSCALL(futexwake)
+ 626:	b8 26 00 00 00       	mov    $0x26,%eax
+ 62b:	cd 40                	int    $0x40
+ 62d:	c3                   	ret
+
+0000062e <lockstat>:
+SYSCALL(lockstat)
+ 62e:	b8 27 00 00 00       	mov    $0x27,%eax
+ 633:	cd 40                	int    $0x40
+ 635:	c3                   	ret
+
+00000636 <dcachestat>:
+SYSCALL(dcachestat)
+ 636:	b8 28 00 00 00       	mov    $0x28,%eax
+ 63b:	cd 40                	int    $0x40
+ 63d:	c3                   	ret
+
+0000063e <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 63e:	55                   	push   %ebp
+ 63f:	89 e5                	mov    %esp,%ebp
+ 641:	83 ec 18             	sub    $0x18,%esp
+ 644:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 647:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 64a:	83 ec 04             	sub    $0x4,%esp
+ 64d:	6a 01                	push   $0x1
+ 64f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 652:	50                   	push   %eax
+ 653:	ff 75 08             	push   0x8(%ebp)
+ 656:	e8 d3 fe ff ff       	call   52e <write>
+ 65b:	83 c4 10             	add    $0x10,%esp
+}
+ 65e:	90                   	nop
+ 65f:	c9                   	leave
+ 660:	c3                   	ret
+
+00000661 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 661:	55                   	push   %ebp
+ 662:	89 e5                	mov    %esp,%ebp
+ 664:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 667:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 66e:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 672:	74 17                	je     68b <printint+0x2a>
+ 674:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 678:	79 11                	jns    68b <printint+0x2a>
+    neg = 1;
+ 67a:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 681:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 684:	f7 d8                	neg    %eax
+ 686:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 689:	eb 06                	jmp    691 <printint+0x30>
+  } else {
+    x = xx;
+ 68b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 68e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 691:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 698:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 69b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 69e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6a3:	f7 f1                	div    %ecx
+ 6a5:	89 d1                	mov    %edx,%ecx
+ 6a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6aa:	8d 50 01             	lea    0x1(%eax),%edx
+ 6ad:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6b0:	0f b6 91 78 13 00 00 	movzbl 0x1378(%ecx),%edx
+ 6b7:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6be:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6c1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6c6:	f7 f1                	div    %ecx
+ 6c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6cf:	75 c7                	jne    698 <printint+0x37>
+  if(neg)
+ 6d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6d5:	74 2d                	je     704 <printint+0xa3>
+    buf[i++] = '-';
+ 6d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6da:	8d 50 01             	lea    0x1(%eax),%edx
+ 6dd:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6e0:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6e5:	eb 1d                	jmp    704 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6e7:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6ed:	01 d0                	add    %edx,%eax
+ 6ef:	0f b6 00             	movzbl (%eax),%eax
+ 6f2:	0f be c0             	movsbl %al,%eax
+ 6f5:	83 ec 08             	sub    $0x8,%esp
+ 6f8:	50                   	push   %eax
+ 6f9:	ff 75 08             	push   0x8(%ebp)
+ 6fc:	e8 3d ff ff ff       	call   63e <putc>
+ 701:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 704:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 708:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 70c:	79 d9                	jns    6e7 <printint+0x86>
+}
+ 70e:	90                   	nop
+ 70f:	90                   	nop
+ 710:	c9                   	leave
+ 711:	c3                   	ret
+
+00000712 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 712:	55                   	push   %ebp
+ 713:	89 e5                	mov    %esp,%ebp
+ 715:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 718:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 71f:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 722:	83 c0 04             	add    $0x4,%eax
+ 725:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 728:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 72f:	e9 59 01 00 00       	jmp    88d <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 734:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 737:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 73a:	01 d0                	add    %edx,%eax
+ 73c:	0f b6 00             	movzbl (%eax),%eax
+ 73f:	0f be c0             	movsbl %al,%eax
+ 742:	25 ff 00 00 00       	and    $0xff,%eax
+ 747:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 74a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 74e:	75 2c                	jne    77c <printf+0x6a>
+      if(c == '%'){
+ 750:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 754:	75 0c                	jne    762 <printf+0x50>
+        state = '%';
+ 756:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 75d:	e9 27 01 00 00       	jmp    889 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 762:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 765:	0f be c0             	movsbl %al,%eax
+ 768:	83 ec 08             	sub    $0x8,%esp
+ 76b:	50                   	push   %eax
+ 76c:	ff 75 08             	push   0x8(%ebp)
+ 76f:	e8 ca fe ff ff       	call   63e <putc>
+ 774:	83 c4 10             	add    $0x10,%esp
+ 777:	e9 0d 01 00 00       	jmp    889 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 77c:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 780:	0f 85 03 01 00 00    	jne    889 <printf+0x177>
+      if(c == 'd'){
+ 786:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 78a:	75 1e                	jne    7aa <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 78c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 78f:	8b 00                	mov    (%eax),%eax
+ 791:	6a 01                	push   $0x1
+ 793:	6a 0a                	push   $0xa
+ 795:	50                   	push   %eax
+ 796:	ff 75 08             	push   0x8(%ebp)
+ 799:	e8 c3 fe ff ff       	call   661 <printint>
+ 79e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7a1:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7a5:	e9 d8 00 00 00       	jmp    882 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7aa:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ae:	74 06                	je     7b6 <printf+0xa4>
+ 7b0:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7b4:	75 1e                	jne    7d4 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7b9:	8b 00                	mov    (%eax),%eax
+ 7bb:	6a 00                	push   $0x0
+ 7bd:	6a 10                	push   $0x10
+ 7bf:	50                   	push   %eax
+ 7c0:	ff 75 08             	push   0x8(%ebp)
+ 7c3:	e8 99 fe ff ff       	call   661 <printint>
+ 7c8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7cb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7cf:	e9 ae 00 00 00       	jmp    882 <printf+0x170>
+      } else if(c == 's'){
+ 7d4:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7d8:	75 43                	jne    81d <printf+0x10b>
+        s = (char*)*ap;
+ 7da:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7dd:	8b 00                	mov    (%eax),%eax
+ 7df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7e2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7ea:	75 25                	jne    811 <printf+0xff>
+          s = "(null)";
+ 7ec:	c7 45 f4 87 0f 00 00 	movl   $0xf87,-0xc(%ebp)
+        while(*s != 0){
+ 7f3:	eb 1c                	jmp    811 <printf+0xff>
+          putc(fd, *s);
+ 7f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7f8:	0f b6 00             	movzbl (%eax),%eax
+ 7fb:	0f be c0             	movsbl %al,%eax
+ 7fe:	83 ec 08             	sub    $0x8,%esp
+ 801:	50                   	push   %eax
+ 802:	ff 75 08             	push   0x8(%ebp)
+ 805:	e8 34 fe ff ff       	call   63e <putc>
+ 80a:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 80d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 814:	0f b6 00             	movzbl (%eax),%eax
+ 817:	84 c0                	test   %al,%al
+ 819:	75 da                	jne    7f5 <printf+0xe3>
+ 81b:	eb 65                	jmp    882 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 81d:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 821:	75 1d                	jne    840 <printf+0x12e>
+        putc(fd, *ap);
+ 823:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 826:	8b 00                	mov    (%eax),%eax
+ 828:	0f be c0             	movsbl %al,%eax
+ 82b:	83 ec 08             	sub    $0x8,%esp
+ 82e:	50                   	push   %eax
+ 82f:	ff 75 08             	push   0x8(%ebp)
+ 832:	e8 07 fe ff ff       	call   63e <putc>
+ 837:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 83a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 83e:	eb 42                	jmp    882 <printf+0x170>
+      } else if(c == '%'){
+ 840:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 844:	75 17                	jne    85d <printf+0x14b>
+        putc(fd, c);
+ 846:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 849:	0f be c0             	movsbl %al,%eax
+ 84c:	83 ec 08             	sub    $0x8,%esp
+ 84f:	50                   	push   %eax
+ 850:	ff 75 08             	push   0x8(%ebp)
+ 853:	e8 e6 fd ff ff       	call   63e <putc>
+ 858:	83 c4 10             	add    $0x10,%esp
+ 85b:	eb 25                	jmp    882 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 85d:	83 ec 08             	sub    $0x8,%esp
+ 860:	6a 25                	push   $0x25
+ 862:	ff 75 08             	push   0x8(%ebp)
+ 865:	e8 d4 fd ff ff       	call   63e <putc>
+ 86a:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 86d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 870:	0f be c0             	movsbl %al,%eax
+ 873:	83 ec 08             	sub    $0x8,%esp
+ 876:	50                   	push   %eax
+ 877:	ff 75 08             	push   0x8(%ebp)
+ 87a:	e8 bf fd ff ff       	call   63e <putc>
+ 87f:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 882:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 889:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 88d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 890:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 893:	01 d0                	add    %edx,%eax
+ 895:	0f b6 00             	movzbl (%eax),%eax
+ 898:	84 c0                	test   %al,%al
+ 89a:	0f 85 94 fe ff ff    	jne    734 <printf+0x22>
+    }
+  }
+}
+ 8a0:	90                   	nop
+ 8a1:	90                   	nop
+ 8a2:	c9                   	leave
+ 8a3:	c3                   	ret
+
+000008a4 <enqueue>:
+static struct coro *head, *tail;  // ready to run, in order
+static struct coro *dead;      // returned; free once off its stack
+
+static void
+enqueue(struct coro *c)
+{
+ 8a4:	55                   	push   %ebp
+ 8a5:	89 e5                	mov    %esp,%ebp
+  c->next = 0;
+ 8a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8aa:	c7 40 10 00 00 00 00 	movl   $0x0,0x10(%eax)
+  if(tail)
+ 8b1:	a1 c0 13 00 00       	mov    0x13c0,%eax
+ 8b6:	85 c0                	test   %eax,%eax
+ 8b8:	74 0d                	je     8c7 <enqueue+0x23>
+    tail->next = c;
+ 8ba:	a1 c0 13 00 00       	mov    0x13c0,%eax
+ 8bf:	8b 55 08             	mov    0x8(%ebp),%edx
+ 8c2:	89 50 10             	mov    %edx,0x10(%eax)
+ 8c5:	eb 08                	jmp    8cf <enqueue+0x2b>
+  else
+    head = c;
+ 8c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ca:	a3 bc 13 00 00       	mov    %eax,0x13bc
+  tail = c;
+ 8cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d2:	a3 c0 13 00 00       	mov    %eax,0x13c0
+}
+ 8d7:	90                   	nop
+ 8d8:	5d                   	pop    %ebp
+ 8d9:	c3                   	ret
+
+000008da <dequeue>:
+
+static struct coro*
+dequeue(void)
+{
+ 8da:	55                   	push   %ebp
+ 8db:	89 e5                	mov    %esp,%ebp
+ 8dd:	83 ec 10             	sub    $0x10,%esp
+  struct coro *c;
+
+  if((c = head) != 0 && (head = c->next) == 0)
+ 8e0:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ 8e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 8e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ 8ec:	74 1e                	je     90c <dequeue+0x32>
+ 8ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f1:	8b 40 10             	mov    0x10(%eax),%eax
+ 8f4:	a3 bc 13 00 00       	mov    %eax,0x13bc
+ 8f9:	a1 bc 13 00 00       	mov    0x13bc,%eax
+ 8fe:	85 c0                	test   %eax,%eax
+ 900:	75 0a                	jne    90c <dequeue+0x32>
+    tail = 0;
+ 902:	c7 05 c0 13 00 00 00 	movl   $0x0,0x13c0
+ 909:	00 00 00 
+  return c;
+ 90c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 90f:	c9                   	leave
+ 910:	c3                   	ret
+
+00000911 <reap>:
+
+// Free the coroutine that returned last, now that
+// we are off its stack.
+static void
+reap(void)
+{
+ 911:	55                   	push   %ebp
+ 912:	89 e5                	mov    %esp,%ebp
+ 914:	83 ec 08             	sub    $0x8,%esp
+  if(dead){
+ 917:	a1 c4 13 00 00       	mov    0x13c4,%eax
+ 91c:	85 c0                	test   %eax,%eax
+ 91e:	74 2f                	je     94f <reap+0x3e>
+    free(dead->stack);
+ 920:	a1 c4 13 00 00       	mov    0x13c4,%eax
+ 925:	8b 40 0c             	mov    0xc(%eax),%eax
+ 928:	83 ec 0c             	sub    $0xc,%esp
+ 92b:	50                   	push   %eax
+ 92c:	e8 6e 04 00 00       	call   d9f <free>
+ 931:	83 c4 10             	add    $0x10,%esp
+    free(dead);
+ 934:	a1 c4 13 00 00       	mov    0x13c4,%eax
+ 939:	83 ec 0c             	sub    $0xc,%esp
+ 93c:	50                   	push   %eax
+ 93d:	e8 5d 04 00 00       	call   d9f <free>
+ 942:	83 c4 10             	add    $0x10,%esp
+    dead = 0;
+ 945:	c7 05 c4 13 00 00 00 	movl   $0x0,0x13c4
+ 94c:	00 00 00 
+  }
+}
+ 94f:	90                   	nop
+ 950:	c9                   	leave
+ 951:	c3                   	ret
+
+00000952 <switchto>:
+
+// Switch from the running coroutine to c.
+static void
+switchto(struct coro *c)
+{
+ 952:	55                   	push   %ebp
+ 953:	89 e5                	mov    %esp,%ebp
+ 955:	83 ec 18             	sub    $0x18,%esp
+  struct coro *prev;
+
+  prev = cur;
+ 958:	a1 b8 13 00 00       	mov    0x13b8,%eax
+ 95d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cur = c;
+ 960:	8b 45 08             	mov    0x8(%ebp),%eax
+ 963:	a3 b8 13 00 00       	mov    %eax,0x13b8
+  coroswtch(&prev->sp, c->sp);
+ 968:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96b:	8b 10                	mov    (%eax),%edx
+ 96d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 970:	83 ec 08             	sub    $0x8,%esp
+ 973:	52                   	push   %edx
+ 974:	50                   	push   %eax
+ 975:	e8 a2 01 00 00       	call   b1c <coroswtch>
+ 97a:	83 c4 10             	add    $0x10,%esp
+  reap();
+ 97d:	e8 8f ff ff ff       	call   911 <reap>
+}
+ 982:	90                   	nop
+ 983:	c9                   	leave
+ 984:	c3                   	ret
+
+00000985 <corostart>:
+
+// First code a new coroutine runs.
+static void
+corostart(void)
+{
+ 985:	55                   	push   %ebp
+ 986:	89 e5                	mov    %esp,%ebp
+ 988:	83 ec 18             	sub    $0x18,%esp
+  struct coro *next;
+
+  reap();
+ 98b:	e8 81 ff ff ff       	call   911 <reap>
+  cur->fn(cur->arg);
+ 990:	a1 b8 13 00 00       	mov    0x13b8,%eax
+ 995:	8b 40 04             	mov    0x4(%eax),%eax
+ 998:	8b 15 b8 13 00 00    	mov    0x13b8,%edx
+ 99e:	8b 52 08             	mov    0x8(%edx),%edx
+ 9a1:	83 ec 0c             	sub    $0xc,%esp
+ 9a4:	52                   	push   %edx
+ 9a5:	ff d0                	call   *%eax
+ 9a7:	83 c4 10             	add    $0x10,%esp
+  dead = cur;
+ 9aa:	a1 b8 13 00 00       	mov    0x13b8,%eax
+ 9af:	a3 c4 13 00 00       	mov    %eax,0x13c4
+  if((next = dequeue()) == 0)
+ 9b4:	e8 21 ff ff ff       	call   8da <dequeue>
+ 9b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9c0:	75 07                	jne    9c9 <corostart+0x44>
+    next = &runner;
+ 9c2:	c7 45 f4 a4 13 00 00 	movl   $0x13a4,-0xc(%ebp)
+  switchto(next);
+ 9c9:	83 ec 0c             	sub    $0xc,%esp
+ 9cc:	ff 75 f4             	push   -0xc(%ebp)
+ 9cf:	e8 7e ff ff ff       	call   952 <switchto>
+ 9d4:	83 c4 10             	add    $0x10,%esp
+}
+ 9d7:	90                   	nop
+ 9d8:	c9                   	leave
+ 9d9:	c3                   	ret
+
+000009da <coro_create>:
+
+// Queue fn(arg) to run as a coroutine.  Return 0, or -1 if
+// out of memory.
+int
+coro_create(void (*fn)(void*), void *arg)
+{
+ 9da:	55                   	push   %ebp
+ 9db:	89 e5                	mov    %esp,%ebp
+ 9dd:	83 ec 18             	sub    $0x18,%esp
+  struct coro *c;
+  uint *sp;
+
+  if((c = malloc(sizeof(*c))) == 0)
+ 9e0:	83 ec 0c             	sub    $0xc,%esp
+ 9e3:	6a 14                	push   $0x14
+ 9e5:	e8 0a 04 00 00       	call   df4 <malloc>
+ 9ea:	83 c4 10             	add    $0x10,%esp
+ 9ed:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 9f0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9f4:	75 0a                	jne    a00 <coro_create+0x26>
+    return -1;
+ 9f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9fb:	e9 a1 00 00 00       	jmp    aa1 <coro_create+0xc7>
+  if((c->stack = malloc(CSTACK)) == 0){
+ a00:	83 ec 0c             	sub    $0xc,%esp
+ a03:	68 00 10 00 00       	push   $0x1000
+ a08:	e8 e7 03 00 00       	call   df4 <malloc>
+ a0d:	83 c4 10             	add    $0x10,%esp
+ a10:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ a13:	89 42 0c             	mov    %eax,0xc(%edx)
+ a16:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a19:	8b 40 0c             	mov    0xc(%eax),%eax
+ a1c:	85 c0                	test   %eax,%eax
+ a1e:	75 15                	jne    a35 <coro_create+0x5b>
+    free(c);
+ a20:	83 ec 0c             	sub    $0xc,%esp
+ a23:	ff 75 f4             	push   -0xc(%ebp)
+ a26:	e8 74 03 00 00       	call   d9f <free>
+ a2b:	83 c4 10             	add    $0x10,%esp
+    return -1;
+ a2e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a33:	eb 6c                	jmp    aa1 <coro_create+0xc7>
+  }
+  c->fn = fn;
+ a35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a38:	8b 55 08             	mov    0x8(%ebp),%edx
+ a3b:	89 50 04             	mov    %edx,0x4(%eax)
+  c->arg = arg;
+ a3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a41:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a44:	89 50 08             	mov    %edx,0x8(%eax)
+
+  // A frame for coroswtch() to pop: four registers,
+  // then corostart() as the return address.
+  sp = (uint*)(c->stack + CSTACK);
+ a47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a4a:	8b 40 0c             	mov    0xc(%eax),%eax
+ a4d:	05 00 10 00 00       	add    $0x1000,%eax
+ a52:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  *--sp = 0;              // corostart()'s return address; never used
+ a55:	83 6d f0 04          	subl   $0x4,-0x10(%ebp)
+ a59:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a5c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  *--sp = (uint)corostart;
+ a62:	83 6d f0 04          	subl   $0x4,-0x10(%ebp)
+ a66:	ba 85 09 00 00       	mov    $0x985,%edx
+ a6b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a6e:	89 10                	mov    %edx,(%eax)
+  sp -= 4;
+ a70:	83 6d f0 10          	subl   $0x10,-0x10(%ebp)
+  memset(sp, 0, 4 * sizeof(uint));
+ a74:	83 ec 04             	sub    $0x4,%esp
+ a77:	6a 10                	push   $0x10
+ a79:	6a 00                	push   $0x0
+ a7b:	ff 75 f0             	push   -0x10(%ebp)
+ a7e:	e8 bf f8 ff ff       	call   342 <memset>
+ a83:	83 c4 10             	add    $0x10,%esp
+  c->sp = sp;
+ a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a89:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ a8c:	89 10                	mov    %edx,(%eax)
+  enqueue(c);
+ a8e:	83 ec 0c             	sub    $0xc,%esp
+ a91:	ff 75 f4             	push   -0xc(%ebp)
+ a94:	e8 0b fe ff ff       	call   8a4 <enqueue>
+ a99:	83 c4 10             	add    $0x10,%esp
+  return 0;
+ a9c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ aa1:	c9                   	leave
+ aa2:	c3                   	ret
+
+00000aa3 <coro_yield>:
+
+// Let the other queued coroutines run.
+// Does nothing outside coro_run().
+void
+coro_yield(void)
+{
+ aa3:	55                   	push   %ebp
+ aa4:	89 e5                	mov    %esp,%ebp
+ aa6:	83 ec 18             	sub    $0x18,%esp
+  struct coro *next;
+
+  if(cur == 0 || (next = dequeue()) == 0)
+ aa9:	a1 b8 13 00 00       	mov    0x13b8,%eax
+ aae:	85 c0                	test   %eax,%eax
+ ab0:	74 2c                	je     ade <coro_yield+0x3b>
+ ab2:	e8 23 fe ff ff       	call   8da <dequeue>
+ ab7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aba:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ abe:	74 1e                	je     ade <coro_yield+0x3b>
+    return;
+  enqueue(cur);
+ ac0:	a1 b8 13 00 00       	mov    0x13b8,%eax
+ ac5:	50                   	push   %eax
+ ac6:	e8 d9 fd ff ff       	call   8a4 <enqueue>
+ acb:	83 c4 04             	add    $0x4,%esp
+  switchto(next);
+ ace:	83 ec 0c             	sub    $0xc,%esp
+ ad1:	ff 75 f4             	push   -0xc(%ebp)
+ ad4:	e8 79 fe ff ff       	call   952 <switchto>
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	eb 01                	jmp    adf <coro_yield+0x3c>
+    return;
+ ade:	90                   	nop
+}
+ adf:	c9                   	leave
+ ae0:	c3                   	ret
+
+00000ae1 <coro_run>:
+
+// Run queued coroutines until every one has returned.
+void
+coro_run(void)
+{
+ ae1:	55                   	push   %ebp
+ ae2:	89 e5                	mov    %esp,%ebp
+ ae4:	83 ec 18             	sub    $0x18,%esp
+  struct coro *next;
+
+  if((next = dequeue()) == 0)
+ ae7:	e8 ee fd ff ff       	call   8da <dequeue>
+ aec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ aef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ af3:	74 24                	je     b19 <coro_run+0x38>
+    return;
+  cur = &runner;
+ af5:	c7 05 b8 13 00 00 a4 	movl   $0x13a4,0x13b8
+ afc:	13 00 00 
+  switchto(next);
+ aff:	83 ec 0c             	sub    $0xc,%esp
+ b02:	ff 75 f4             	push   -0xc(%ebp)
+ b05:	e8 48 fe ff ff       	call   952 <switchto>
+ b0a:	83 c4 10             	add    $0x10,%esp
+  cur = 0;
+ b0d:	c7 05 b8 13 00 00 00 	movl   $0x0,0x13b8
+ b14:	00 00 00 
+ b17:	eb 01                	jmp    b1a <coro_run+0x39>
+    return;
+ b19:	90                   	nop
+}
+ b1a:	c9                   	leave
+ b1b:	c3                   	ret
+
+00000b1c <coroswtch>:
+# the stack pointer in *old, then switch to stack new and load
+# the registers saved there.
+
+.globl coroswtch
+coroswtch:
+  movl 4(%esp), %eax
+ b1c:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+ b20:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-save registers
+  pushl %ebp
+ b24:	55                   	push   %ebp
+  pushl %ebx
+ b25:	53                   	push   %ebx
+  pushl %esi
+ b26:	56                   	push   %esi
+  pushl %edi
+ b27:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+ b28:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+ b2a:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-save registers
+  popl %edi
+ b2c:	5f                   	pop    %edi
+  popl %esi
+ b2d:	5e                   	pop    %esi
+  popl %ebx
+ b2e:	5b                   	pop    %ebx
+  popl %ebp
+ b2f:	5d                   	pop    %ebp
+  ret
+ b30:	c3                   	ret
+
+00000b31 <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+ b31:	55                   	push   %ebp
+ b32:	89 e5                	mov    %esp,%ebp
+ b34:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+ b37:	8b 15 08 14 00 00    	mov    0x1408,%edx
+ b3d:	a1 04 14 00 00       	mov    0x1404,%eax
+ b42:	29 c2                	sub    %eax,%edx
+ b44:	89 d0                	mov    %edx,%eax
+ b46:	3b 45 08             	cmp    0x8(%ebp),%eax
+ b49:	0f 83 ed 00 00 00    	jae    c3c <carve+0x10b>
+    n = size > growsz ? size : growsz;
+ b4f:	a1 8c 13 00 00       	mov    0x138c,%eax
+ b54:	8b 55 08             	mov    0x8(%ebp),%edx
+ b57:	39 c2                	cmp    %eax,%edx
+ b59:	0f 43 c2             	cmovae %edx,%eax
+ b5c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+ b5f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b62:	05 ff 0f 00 00       	add    $0xfff,%eax
+ b67:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ b6c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+ b6f:	a1 8c 13 00 00       	mov    0x138c,%eax
+ b74:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+ b79:	77 0c                	ja     b87 <carve+0x56>
+      growsz *= 2;
+ b7b:	a1 8c 13 00 00       	mov    0x138c,%eax
+ b80:	01 c0                	add    %eax,%eax
+ b82:	a3 8c 13 00 00       	mov    %eax,0x138c
+    p = sbrk(n);
+ b87:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b8a:	83 ec 0c             	sub    $0xc,%esp
+ b8d:	50                   	push   %eax
+ b8e:	e8 03 fa ff ff       	call   596 <sbrk>
+ b93:	83 c4 10             	add    $0x10,%esp
+ b96:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+ b99:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b9d:	75 2a                	jne    bc9 <carve+0x98>
+ b9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ba2:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ba5:	73 22                	jae    bc9 <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+ ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+ baa:	05 ff 0f 00 00       	add    $0xfff,%eax
+ baf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ bb4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+ bb7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bba:	83 ec 0c             	sub    $0xc,%esp
+ bbd:	50                   	push   %eax
+ bbe:	e8 d3 f9 ff ff       	call   596 <sbrk>
+ bc3:	83 c4 10             	add    $0x10,%esp
+ bc6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+ bc9:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bcd:	75 0a                	jne    bd9 <carve+0xa8>
+      return 0;
+ bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+ bd4:	e9 86 00 00 00       	jmp    c5f <carve+0x12e>
+    if(p != limit){
+ bd9:	a1 08 14 00 00       	mov    0x1408,%eax
+ bde:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ be1:	74 4c                	je     c2f <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+ be3:	8b 15 08 14 00 00    	mov    0x1408,%edx
+ be9:	a1 04 14 00 00       	mov    0x1404,%eax
+ bee:	29 c2                	sub    %eax,%edx
+ bf0:	83 fa 0f             	cmp    $0xf,%edx
+ bf3:	7e 32                	jle    c27 <carve+0xf6>
+        b = (Block*)top;
+ bf5:	a1 04 14 00 00       	mov    0x1404,%eax
+ bfa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+ bfd:	8b 15 08 14 00 00    	mov    0x1408,%edx
+ c03:	a1 04 14 00 00       	mov    0x1404,%eax
+ c08:	29 c2                	sub    %eax,%edx
+ c0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c0d:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+ c0f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c12:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+ c19:	83 ec 0c             	sub    $0xc,%esp
+ c1c:	ff 75 ec             	push   -0x14(%ebp)
+ c1f:	e8 3d 00 00 00       	call   c61 <lfree>
+ c24:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+ c27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2a:	a3 04 14 00 00       	mov    %eax,0x1404
+    }
+    limit = p + n;
+ c2f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c32:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c35:	01 d0                	add    %edx,%eax
+ c37:	a3 08 14 00 00       	mov    %eax,0x1408
+  }
+  b = (Block*)top;
+ c3c:	a1 04 14 00 00       	mov    0x1404,%eax
+ c41:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+ c44:	8b 15 04 14 00 00    	mov    0x1404,%edx
+ c4a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4d:	01 d0                	add    %edx,%eax
+ c4f:	a3 04 14 00 00       	mov    %eax,0x1404
+  b->h.size = size;
+ c54:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c57:	8b 55 08             	mov    0x8(%ebp),%edx
+ c5a:	89 10                	mov    %edx,(%eax)
+  return b;
+ c5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ c5f:	c9                   	leave
+ c60:	c3                   	ret
+
+00000c61 <lfree>:
+
+static void
+lfree(Block *b)
+{
+ c61:	55                   	push   %ebp
+ c62:	89 e5                	mov    %esp,%ebp
+ c64:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+ c67:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ c6e:	a1 00 14 00 00       	mov    0x1400,%eax
+ c73:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c76:	eb 0f                	jmp    c87 <lfree+0x26>
+    prev = p;
+ c78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ c7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c81:	8b 40 08             	mov    0x8(%eax),%eax
+ c84:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c87:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ c8b:	74 08                	je     c95 <lfree+0x34>
+ c8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c90:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c93:	72 e3                	jb     c78 <lfree+0x17>
+  b->next = p;
+ c95:	8b 45 08             	mov    0x8(%ebp),%eax
+ c98:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ c9b:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+ c9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ ca2:	74 2c                	je     cd0 <lfree+0x6f>
+ ca4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca7:	8b 10                	mov    (%eax),%edx
+ ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+ cac:	01 d0                	add    %edx,%eax
+ cae:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cb1:	75 1d                	jne    cd0 <lfree+0x6f>
+    b->h.size += p->h.size;
+ cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ cb6:	8b 10                	mov    (%eax),%edx
+ cb8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cbb:	8b 00                	mov    (%eax),%eax
+ cbd:	01 c2                	add    %eax,%edx
+ cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc2:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+ cc4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc7:	8b 50 08             	mov    0x8(%eax),%edx
+ cca:	8b 45 08             	mov    0x8(%ebp),%eax
+ ccd:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+ cd0:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ cd4:	74 2e                	je     d04 <lfree+0xa3>
+ cd6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cd9:	8b 10                	mov    (%eax),%edx
+ cdb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cde:	01 d0                	add    %edx,%eax
+ ce0:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ce3:	75 1f                	jne    d04 <lfree+0xa3>
+    prev->h.size += b->h.size;
+ ce5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ce8:	8b 10                	mov    (%eax),%edx
+ cea:	8b 45 08             	mov    0x8(%ebp),%eax
+ ced:	8b 00                	mov    (%eax),%eax
+ cef:	01 c2                	add    %eax,%edx
+ cf1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cf4:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+ cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+ cf9:	8b 50 08             	mov    0x8(%eax),%edx
+ cfc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cff:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+ d02:	eb 19                	jmp    d1d <lfree+0xbc>
+  } else if(prev)
+ d04:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ d08:	74 0b                	je     d15 <lfree+0xb4>
+    prev->next = b;
+ d0a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d0d:	8b 55 08             	mov    0x8(%ebp),%edx
+ d10:	89 50 08             	mov    %edx,0x8(%eax)
+}
+ d13:	eb 08                	jmp    d1d <lfree+0xbc>
+    large = b;
+ d15:	8b 45 08             	mov    0x8(%ebp),%eax
+ d18:	a3 00 14 00 00       	mov    %eax,0x1400
+}
+ d1d:	90                   	nop
+ d1e:	c9                   	leave
+ d1f:	c3                   	ret
+
+00000d20 <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ d26:	c7 45 f0 00 14 00 00 	movl   $0x1400,-0x10(%ebp)
+ d2d:	eb 52                	jmp    d81 <lalloc+0x61>
+    if(p->h.size < size)
+ d2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d32:	8b 00                	mov    (%eax),%eax
+ d34:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d37:	72 3e                	jb     d77 <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+ d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d3c:	8b 00                	mov    (%eax),%eax
+ d3e:	2b 45 08             	sub    0x8(%ebp),%eax
+ d41:	83 f8 0f             	cmp    $0xf,%eax
+ d44:	76 21                	jbe    d67 <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+ d46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d49:	8b 00                	mov    (%eax),%eax
+ d4b:	2b 45 08             	sub    0x8(%ebp),%eax
+ d4e:	89 c2                	mov    %eax,%edx
+ d50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d53:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+ d55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d58:	8b 00                	mov    (%eax),%eax
+ d5a:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+ d5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d60:	8b 55 08             	mov    0x8(%ebp),%edx
+ d63:	89 10                	mov    %edx,(%eax)
+ d65:	eb 0b                	jmp    d72 <lalloc+0x52>
+    } else
+      *pp = p->next;
+ d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6a:	8b 50 08             	mov    0x8(%eax),%edx
+ d6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d70:	89 10                	mov    %edx,(%eax)
+    return p;
+ d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d75:	eb 26                	jmp    d9d <lalloc+0x7d>
+      continue;
+ d77:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ d78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d7b:	83 c0 08             	add    $0x8,%eax
+ d7e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d81:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d84:	8b 00                	mov    (%eax),%eax
+ d86:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d89:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d8d:	75 a0                	jne    d2f <lalloc+0xf>
+  }
+  return carve(size);
+ d8f:	83 ec 0c             	sub    $0xc,%esp
+ d92:	ff 75 08             	push   0x8(%ebp)
+ d95:	e8 97 fd ff ff       	call   b31 <carve>
+ d9a:	83 c4 10             	add    $0x10,%esp
+}
+ d9d:	c9                   	leave
+ d9e:	c3                   	ret
+
+00000d9f <free>:
+
+void
+free(void *ap)
+{
+ d9f:	55                   	push   %ebp
+ da0:	89 e5                	mov    %esp,%ebp
+ da2:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+ da5:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ da9:	74 46                	je     df1 <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+ dab:	8b 45 08             	mov    0x8(%ebp),%eax
+ dae:	83 e8 08             	sub    $0x8,%eax
+ db1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+ db4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ db7:	8b 40 04             	mov    0x4(%eax),%eax
+ dba:	83 f8 07             	cmp    $0x7,%eax
+ dbd:	77 25                	ja     de4 <free+0x45>
+    b->next = bins[b->h.bin];
+ dbf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dc2:	8b 40 04             	mov    0x4(%eax),%eax
+ dc5:	8b 14 85 e0 13 00 00 	mov    0x13e0(,%eax,4),%edx
+ dcc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dcf:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+ dd2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dd5:	8b 40 04             	mov    0x4(%eax),%eax
+ dd8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ ddb:	89 14 85 e0 13 00 00 	mov    %edx,0x13e0(,%eax,4)
+ de2:	eb 0e                	jmp    df2 <free+0x53>
+  } else
+    lfree(b);
+ de4:	ff 75 fc             	push   -0x4(%ebp)
+ de7:	e8 75 fe ff ff       	call   c61 <lfree>
+ dec:	83 c4 04             	add    $0x4,%esp
+ def:	eb 01                	jmp    df2 <free+0x53>
+    return;
+ df1:	90                   	nop
+}
+ df2:	c9                   	leave
+ df3:	c3                   	ret
+
+00000df4 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ df4:	55                   	push   %ebp
+ df5:	89 e5                	mov    %esp,%ebp
+ df7:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+ dfa:	8b 45 08             	mov    0x8(%ebp),%eax
+ dfd:	83 c0 08             	add    $0x8,%eax
+ e00:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+ e03:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e06:	3b 45 08             	cmp    0x8(%ebp),%eax
+ e09:	73 0a                	jae    e15 <malloc+0x21>
+    return 0;
+ e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+ e10:	e9 b8 00 00 00       	jmp    ecd <malloc+0xd9>
+  if(size <= MAXSMALL){
+ e15:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+ e1c:	77 6f                	ja     e8d <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+ e1e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ e25:	eb 04                	jmp    e2b <malloc+0x37>
+ e27:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ e2b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e2e:	ba 10 00 00 00       	mov    $0x10,%edx
+ e33:	89 c1                	mov    %eax,%ecx
+ e35:	d3 e2                	shl    %cl,%edx
+ e37:	89 d0                	mov    %edx,%eax
+ e39:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e3c:	72 e9                	jb     e27 <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+ e3e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e41:	8b 04 85 e0 13 00 00 	mov    0x13e0(,%eax,4),%eax
+ e48:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e4b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e4f:	74 12                	je     e63 <malloc+0x6f>
+      bins[bin] = b->next;
+ e51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e54:	8b 50 08             	mov    0x8(%eax),%edx
+ e57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e5a:	89 14 85 e0 13 00 00 	mov    %edx,0x13e0(,%eax,4)
+ e61:	eb 5b                	jmp    ebe <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+ e63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e66:	ba 10 00 00 00       	mov    $0x10,%edx
+ e6b:	89 c1                	mov    %eax,%ecx
+ e6d:	d3 e2                	shl    %cl,%edx
+ e6f:	89 d0                	mov    %edx,%eax
+ e71:	83 ec 0c             	sub    $0xc,%esp
+ e74:	50                   	push   %eax
+ e75:	e8 b7 fc ff ff       	call   b31 <carve>
+ e7a:	83 c4 10             	add    $0x10,%esp
+ e7d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e80:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e84:	75 38                	jne    ebe <malloc+0xca>
+      return 0;
+ e86:	b8 00 00 00 00       	mov    $0x0,%eax
+ e8b:	eb 40                	jmp    ecd <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ e8d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e90:	83 c0 07             	add    $0x7,%eax
+ e93:	83 e0 f8             	and    $0xfffffff8,%eax
+ e96:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+ e99:	83 ec 0c             	sub    $0xc,%esp
+ e9c:	ff 75 ec             	push   -0x14(%ebp)
+ e9f:	e8 7c fe ff ff       	call   d20 <lalloc>
+ ea4:	83 c4 10             	add    $0x10,%esp
+ ea7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ eaa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ eae:	75 07                	jne    eb7 <malloc+0xc3>
+      return 0;
+ eb0:	b8 00 00 00 00       	mov    $0x0,%eax
+ eb5:	eb 16                	jmp    ecd <malloc+0xd9>
+    bin = LARGE;
+ eb7:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+ ebe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ec1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ ec4:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+ ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eca:	83 c0 08             	add    $0x8,%eax
+}
+ ecd:	c9                   	leave
+ ece:	c3                   	ret
@@ -0,0 +1,73 @@
+// Compare the cost of switching between coroutines with that of
+// switching between processes: two coroutines yield to each other,
+// then two processes pinned to one CPU bounce a byte through a
+// pair of pipes.  corobench [switches]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static int nyield;
+
+static void
+yielder(void *arg)
+{
+  int i;
+
+  for(i = 0; i < nyield; i++)
+    coro_yield();
+}
+
+// Nanoseconds per switch for n switches in us microseconds.
+static uint
+perswitch(uint us, int n)
+{
+  return us / n * 1000 + us % n * 1000 / n;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, ping[2], pong[2];
+  uint t0, us;
+  char c;
+
+  n = 100000;
+  if(argc > 1 && (n = atoi(argv[1])) < 2){
+    printf(2, "usage: corobench [switches]\n");
+    exit();
+  }
+
+  nyield = n / 2;
+  if(coro_create(yielder, 0) < 0 || coro_create(yielder, 0) < 0){
+    printf(2, "corobench: out of memory\n");
+    exit();
+  }
+  t0 = uptimeus();
+  coro_run();
+  us = uptimeus() - t0;
+  printf(1, "coroutine: %d switches in %dus, %dns each\n",
+         n, us, perswitch(us, n));
+
+  if(setaffinity(getpid(), 1) < 0 || pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "corobench: cannot set up processes\n");
+    exit();
+  }
+  if(fork() == 0){
+    for(i = 0; i < n / 2; i++){
+      read(ping[0], &c, 1);
+      write(pong[1], &c, 1);
+    }
+    exit();
+  }
+  t0 = uptimeus();
+  for(i = 0; i < n / 2; i++){
+    write(ping[1], "x", 1);
+    read(pong[0], &c, 1);
+  }
+  us = uptimeus() - t0;
+  wait();
+  printf(1, "process:   %d switches in %dus, %dns each\n",
+         n, us, perswitch(us, n));
+  exit();
+}
@@ -0,0 +1,575 @@
+
+_counter:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#include "user.h"
+#include "fcntl.h"
+
+int main()
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+    int i = 0;
+  11:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    for(; i < 100; i++ )
+  18:	eb 19                	jmp    33 <main+0x33>
+    {
+        printf(2, "counter %d\n", i);
+  1a:	83 ec 04             	sub    $0x4,%esp
+  1d:	ff 75 f4             	push   -0xc(%ebp)
+  20:	68 dc 03 00 00       	push   $0x3dc
+  25:	6a 02                	push   $0x2
+  27:	e8 1e 02 00 00       	call   24a <printf>
+  2c:	83 c4 10             	add    $0x10,%esp
+    for(; i < 100; i++ )
+  2f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  33:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+  37:	7e e1                	jle    1a <main+0x1a>
+//        if (i == 5)
+//        {
+//            saveProc();
+//        }
+    }
+    exit();
+  39:	e8 08 00 00 00       	call   46 <exit>
+
+0000003e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  3e:	b8 01 00 00 00       	mov    $0x1,%eax
+  43:	cd 40                	int    $0x40
+  45:	c3                   	ret
+
+00000046 <exit>:
+SYSCALL(exit)
+  46:	b8 02 00 00 00       	mov    $0x2,%eax
+  4b:	cd 40                	int    $0x40
+  4d:	c3                   	ret
+
+0000004e <wait>:
+SYSCALL(wait)
+  4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  53:	cd 40                	int    $0x40
+  55:	c3                   	ret
+
+00000056 <pipe>:
+SYSCALL(pipe)
+  56:	b8 04 00 00 00       	mov    $0x4,%eax
+  5b:	cd 40                	int    $0x40
+  5d:	c3                   	ret
+
+0000005e <read>:
+SYSCALL(read)
+  5e:	b8 05 00 00 00       	mov    $0x5,%eax
+  63:	cd 40                	int    $0x40
+  65:	c3                   	ret
+
+00000066 <write>:
+SYSCALL(write)
+  66:	b8 10 00 00 00       	mov    $0x10,%eax
+  6b:	cd 40                	int    $0x40
+  6d:	c3                   	ret
+
+0000006e <close>:
+SYSCALL(close)
+  6e:	b8 15 00 00 00       	mov    $0x15,%eax
+  73:	cd 40                	int    $0x40
+  75:	c3                   	ret
+
+00000076 <kill>:
+SYSCALL(kill)
+  76:	b8 06 00 00 00       	mov    $0x6,%eax
+  7b:	cd 40                	int    $0x40
+  7d:	c3                   	ret
+
+0000007e <exec>:
+SYSCALL(exec)
+  7e:	b8 07 00 00 00       	mov    $0x7,%eax
+  83:	cd 40                	int    $0x40
+  85:	c3                   	ret
+
+00000086 <open>:
+SYSCALL(open)
+  86:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8b:	cd 40                	int    $0x40
+  8d:	c3                   	ret
+
+0000008e <mknod>:
+SYSCALL(mknod)
+  8e:	b8 11 00 00 00       	mov    $0x11,%eax
+  93:	cd 40                	int    $0x40
+  95:	c3                   	ret
+
+00000096 <unlink>:
+SYSCALL(unlink)
+  96:	b8 12 00 00 00       	mov    $0x12,%eax
+  9b:	cd 40                	int    $0x40
+  9d:	c3                   	ret
+
+0000009e <fstat>:
+SYSCALL(fstat)
+  9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  a3:	cd 40                	int    $0x40
+  a5:	c3                   	ret
+
+000000a6 <link>:
+SYSCALL(link)
+  a6:	b8 13 00 00 00       	mov    $0x13,%eax
+  ab:	cd 40                	int    $0x40
+  ad:	c3                   	ret
+
+000000ae <mkdir>:
+SYSCALL(mkdir)
+  ae:	b8 14 00 00 00       	mov    $0x14,%eax
+  b3:	cd 40                	int    $0x40
+  b5:	c3                   	ret
+
+000000b6 <chdir>:
+SYSCALL(chdir)
+  b6:	b8 09 00 00 00       	mov    $0x9,%eax
+  bb:	cd 40                	int    $0x40
+  bd:	c3                   	ret
+
+000000be <dup>:
+SYSCALL(dup)
+  be:	b8 0a 00 00 00       	mov    $0xa,%eax
+  c3:	cd 40                	int    $0x40
+  c5:	c3                   	ret
+
+000000c6 <getpid>:
+SYSCALL(getpid)
+  c6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  cb:	cd 40                	int    $0x40
+  cd:	c3                   	ret
+
+000000ce <sbrk>:
+SYSCALL(sbrk)
+  ce:	b8 0c 00 00 00       	mov    $0xc,%eax
+  d3:	cd 40                	int    $0x40
+  d5:	c3                   	ret
+
+000000d6 <sleep>:
+SYSCALL(sleep)
+  d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  db:	cd 40                	int    $0x40
+  dd:	c3                   	ret
+
+000000de <uptime>:
+SYSCALL(uptime)
+  de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  e3:	cd 40                	int    $0x40
+  e5:	c3                   	ret
+
+000000e6 <saveProc>:
+SYSCALL(saveProc)
+  e6:	b8 16 00 00 00       	mov    $0x16,%eax
+  eb:	cd 40                	int    $0x40
+  ed:	c3                   	ret
+
+000000ee <loadProc>:
+SYSCALL(loadProc)
+  ee:	b8 17 00 00 00       	mov    $0x17,%eax
+  f3:	cd 40                	int    $0x40
+  f5:	c3                   	ret
+
+000000f6 <setpriority>:
+SYSCALL(setpriority)
+  f6:	b8 19 00 00 00       	mov    $0x19,%eax
+  fb:	cd 40                	int    $0x40
+  fd:	c3                   	ret
+
+000000fe <setaffinity>:
+SYSCALL(setaffinity)
+  fe:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 103:	cd 40                	int    $0x40
+ 105:	c3                   	ret
+
+00000106 <getaffinity>:
+SYSCALL(getaffinity)
+ 106:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 10b:	cd 40                	int    $0x40
+ 10d:	c3                   	ret
+
+0000010e <nanosleep>:
+SYSCALL(nanosleep)
+ 10e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 113:	cd 40                	int    $0x40
+ 115:	c3                   	ret
+
+00000116 <cpustat>:
+SYSCALL(cpustat)
+ 116:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 11b:	cd 40                	int    $0x40
+ 11d:	c3                   	ret
+
+0000011e <nanouptime>:
+SYSCALL(nanouptime)
+ 11e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 123:	cd 40                	int    $0x40
+ 125:	c3                   	ret
+
+00000126 <settickets>:
+SYSCALL(settickets)
+ 126:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 12b:	cd 40                	int    $0x40
+ 12d:	c3                   	ret
+
+0000012e <setdeadline>:
+SYSCALL(setdeadline)
+ 12e:	b8 20 00 00 00       	mov    $0x20,%eax
+ 133:	cd 40                	int    $0x40
+ 135:	c3                   	ret
+
+00000136 <rtstat>:
+SYSCALL(rtstat)
+ 136:	b8 21 00 00 00       	mov    $0x21,%eax
+ 13b:	cd 40                	int    $0x40
+ 13d:	c3                   	ret
+
+0000013e <schedstat>:
+SYSCALL(schedstat)
+ 13e:	b8 22 00 00 00       	mov    $0x22,%eax
+ 143:	cd 40                	int    $0x40
+ 145:	c3                   	ret
+
+00000146 <waitpid>:
+SYSCALL(waitpid)
+ 146:	b8 23 00 00 00       	mov    $0x23,%eax
+ 14b:	cd 40                	int    $0x40
+ 14d:	c3                   	ret
+
+0000014e <clone>:
+SYSCALL(clone)
+ 14e:	b8 24 00 00 00       	mov    $0x24,%eax
+ 153:	cd 40                	int    $0x40
+ 155:	c3                   	ret
+
+00000156 <futexwait>:
+SYSCALL(futexwait)
+ 156:	b8 25 00 00 00       	mov    $0x25,%eax
+ 15b:	cd 40                	int    $0x40
+ 15d:	c3                   	ret
+
+0000015e <futexwake>:
+SYSCALL(futexwake)
+ 15e:	b8 26 00 00 00       	mov    $0x26,%eax
+ 163:	cd 40                	int    $0x40
+ 165:	c3                   	ret
+
+00000166 <lockstat>:
+SYSCALL(lockstat)
+ 166:	b8 27 00 00 00       	mov    $0x27,%eax
+ 16b:	cd 40                	int    $0x40
+ 16d:	c3                   	ret
+
+0000016e <dcachestat>:
+SYSCALL(dcachestat)
+ 16e:	b8 28 00 00 00       	mov    $0x28,%eax
+ 173:	cd 40                	int    $0x40
+ 175:	c3                   	ret
+
+00000176 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 176:	55                   	push   %ebp
+ 177:	89 e5                	mov    %esp,%ebp
+ 179:	83 ec 18             	sub    $0x18,%esp
+ 17c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 182:	83 ec 04             	sub    $0x4,%esp
+ 185:	6a 01                	push   $0x1
+ 187:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 18a:	50                   	push   %eax
+ 18b:	ff 75 08             	push   0x8(%ebp)
+ 18e:	e8 d3 fe ff ff       	call   66 <write>
+ 193:	83 c4 10             	add    $0x10,%esp
+}
+ 196:	90                   	nop
+ 197:	c9                   	leave
+ 198:	c3                   	ret
+
+00000199 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 199:	55                   	push   %ebp
+ 19a:	89 e5                	mov    %esp,%ebp
+ 19c:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 19f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 1a6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 1aa:	74 17                	je     1c3 <printint+0x2a>
+ 1ac:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 1b0:	79 11                	jns    1c3 <printint+0x2a>
+    neg = 1;
+ 1b2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 1b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bc:	f7 d8                	neg    %eax
+ 1be:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 1c1:	eb 06                	jmp    1c9 <printint+0x30>
+  } else {
+    x = xx;
+ 1c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 1c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 1d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1d6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1db:	f7 f1                	div    %ecx
+ 1dd:	89 d1                	mov    %edx,%ecx
+ 1df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e2:	8d 50 01             	lea    0x1(%eax),%edx
+ 1e5:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1e8:	0f b6 91 8c 04 00 00 	movzbl 0x48c(%ecx),%edx
+ 1ef:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 1f3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1f9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 1fe:	f7 f1                	div    %ecx
+ 200:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 203:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 207:	75 c7                	jne    1d0 <printint+0x37>
+  if(neg)
+ 209:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 20d:	74 2d                	je     23c <printint+0xa3>
+    buf[i++] = '-';
+ 20f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 212:	8d 50 01             	lea    0x1(%eax),%edx
+ 215:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 218:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 21d:	eb 1d                	jmp    23c <printint+0xa3>
+    putc(fd, buf[i]);
+ 21f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 222:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 225:	01 d0                	add    %edx,%eax
+ 227:	0f b6 00             	movzbl (%eax),%eax
+ 22a:	0f be c0             	movsbl %al,%eax
+ 22d:	83 ec 08             	sub    $0x8,%esp
+ 230:	50                   	push   %eax
+ 231:	ff 75 08             	push   0x8(%ebp)
+ 234:	e8 3d ff ff ff       	call   176 <putc>
+ 239:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 23c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 240:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 244:	79 d9                	jns    21f <printint+0x86>
+}
+ 246:	90                   	nop
+ 247:	90                   	nop
+ 248:	c9                   	leave
+ 249:	c3                   	ret
+
+0000024a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 24a:	55                   	push   %ebp
+ 24b:	89 e5                	mov    %esp,%ebp
+ 24d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 250:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 257:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 25a:	83 c0 04             	add    $0x4,%eax
+ 25d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 260:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 267:	e9 59 01 00 00       	jmp    3c5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 26c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 26f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 272:	01 d0                	add    %edx,%eax
+ 274:	0f b6 00             	movzbl (%eax),%eax
+ 277:	0f be c0             	movsbl %al,%eax
+ 27a:	25 ff 00 00 00       	and    $0xff,%eax
+ 27f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 282:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 286:	75 2c                	jne    2b4 <printf+0x6a>
+      if(c == '%'){
+ 288:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 28c:	75 0c                	jne    29a <printf+0x50>
+        state = '%';
+ 28e:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 295:	e9 27 01 00 00       	jmp    3c1 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 29a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 29d:	0f be c0             	movsbl %al,%eax
+ 2a0:	83 ec 08             	sub    $0x8,%esp
+ 2a3:	50                   	push   %eax
+ 2a4:	ff 75 08             	push   0x8(%ebp)
+ 2a7:	e8 ca fe ff ff       	call   176 <putc>
+ 2ac:	83 c4 10             	add    $0x10,%esp
+ 2af:	e9 0d 01 00 00       	jmp    3c1 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 2b4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 2b8:	0f 85 03 01 00 00    	jne    3c1 <printf+0x177>
+      if(c == 'd'){
+ 2be:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 2c2:	75 1e                	jne    2e2 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 2c4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2c7:	8b 00                	mov    (%eax),%eax
+ 2c9:	6a 01                	push   $0x1
+ 2cb:	6a 0a                	push   $0xa
+ 2cd:	50                   	push   %eax
+ 2ce:	ff 75 08             	push   0x8(%ebp)
+ 2d1:	e8 c3 fe ff ff       	call   199 <printint>
+ 2d6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 2d9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 2dd:	e9 d8 00 00 00       	jmp    3ba <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 2e2:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 2e6:	74 06                	je     2ee <printf+0xa4>
+ 2e8:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 2ec:	75 1e                	jne    30c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 2ee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2f1:	8b 00                	mov    (%eax),%eax
+ 2f3:	6a 00                	push   $0x0
+ 2f5:	6a 10                	push   $0x10
+ 2f7:	50                   	push   %eax
+ 2f8:	ff 75 08             	push   0x8(%ebp)
+ 2fb:	e8 99 fe ff ff       	call   199 <printint>
+ 300:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 303:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 307:	e9 ae 00 00 00       	jmp    3ba <printf+0x170>
+      } else if(c == 's'){
+ 30c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 310:	75 43                	jne    355 <printf+0x10b>
+        s = (char*)*ap;
+ 312:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 315:	8b 00                	mov    (%eax),%eax
+ 317:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 31a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 31e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 322:	75 25                	jne    349 <printf+0xff>
+          s = "(null)";
+ 324:	c7 45 f4 e8 03 00 00 	movl   $0x3e8,-0xc(%ebp)
+        while(*s != 0){
+ 32b:	eb 1c                	jmp    349 <printf+0xff>
+          putc(fd, *s);
+ 32d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 330:	0f b6 00             	movzbl (%eax),%eax
+ 333:	0f be c0             	movsbl %al,%eax
+ 336:	83 ec 08             	sub    $0x8,%esp
+ 339:	50                   	push   %eax
+ 33a:	ff 75 08             	push   0x8(%ebp)
+ 33d:	e8 34 fe ff ff       	call   176 <putc>
+ 342:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 345:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 349:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 34c:	0f b6 00             	movzbl (%eax),%eax
+ 34f:	84 c0                	test   %al,%al
+ 351:	75 da                	jne    32d <printf+0xe3>
+ 353:	eb 65                	jmp    3ba <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 355:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 359:	75 1d                	jne    378 <printf+0x12e>
+        putc(fd, *ap);
+ 35b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 35e:	8b 00                	mov    (%eax),%eax
+ 360:	0f be c0             	movsbl %al,%eax
+ 363:	83 ec 08             	sub    $0x8,%esp
+ 366:	50                   	push   %eax
+ 367:	ff 75 08             	push   0x8(%ebp)
+ 36a:	e8 07 fe ff ff       	call   176 <putc>
+ 36f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 372:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 376:	eb 42                	jmp    3ba <printf+0x170>
+      } else if(c == '%'){
+ 378:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 37c:	75 17                	jne    395 <printf+0x14b>
+        putc(fd, c);
+ 37e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 381:	0f be c0             	movsbl %al,%eax
+ 384:	83 ec 08             	sub    $0x8,%esp
+ 387:	50                   	push   %eax
+ 388:	ff 75 08             	push   0x8(%ebp)
+ 38b:	e8 e6 fd ff ff       	call   176 <putc>
+ 390:	83 c4 10             	add    $0x10,%esp
+ 393:	eb 25                	jmp    3ba <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 395:	83 ec 08             	sub    $0x8,%esp
+ 398:	6a 25                	push   $0x25
+ 39a:	ff 75 08             	push   0x8(%ebp)
+ 39d:	e8 d4 fd ff ff       	call   176 <putc>
+ 3a2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 3a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3a8:	0f be c0             	movsbl %al,%eax
+ 3ab:	83 ec 08             	sub    $0x8,%esp
+ 3ae:	50                   	push   %eax
+ 3af:	ff 75 08             	push   0x8(%ebp)
+ 3b2:	e8 bf fd ff ff       	call   176 <putc>
+ 3b7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 3ba:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 3c1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 3c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3cb:	01 d0                	add    %edx,%eax
+ 3cd:	0f b6 00             	movzbl (%eax),%eax
+ 3d0:	84 c0                	test   %al,%al
+ 3d2:	0f 85 94 fe ff ff    	jne    26c <printf+0x22>
+    }
+  }
+}
+ 3d8:	90                   	nop
+ 3d9:	90                   	nop
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
@@ -0,0 +1,1154 @@
+
+_cpustat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define MAXCPU 8
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	81 ec dc 06 00 00    	sub    $0x6dc,%esp
+  16:	89 c8                	mov    %ecx,%eax
+  struct cpustat a[MAXCPU], b;
+  int c, n, t, interval;
+
+  interval = 100;
+  18:	c7 45 d8 64 00 00 00 	movl   $0x64,-0x28(%ebp)
+  if(argc > 1 && (interval = atoi(argv[1])) <= 0){
+  1f:	83 38 01             	cmpl   $0x1,(%eax)
+  22:	7e 34                	jle    58 <main+0x58>
+  24:	8b 40 04             	mov    0x4(%eax),%eax
+  27:	83 c0 04             	add    $0x4,%eax
+  2a:	8b 00                	mov    (%eax),%eax
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	50                   	push   %eax
+  30:	e8 9c 03 00 00       	call   3d1 <atoi>
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  3b:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  3f:	7f 17                	jg     58 <main+0x58>
+    printf(2, "usage: cpustat [ticks]\n");
+  41:	83 ec 08             	sub    $0x8,%esp
+  44:	68 2c 08 00 00       	push   $0x82c
+  49:	6a 02                	push   $0x2
+  4b:	e8 48 06 00 00       	call   698 <printf>
+  50:	83 c4 10             	add    $0x10,%esp
+    exit();
+  53:	e8 3c 04 00 00       	call   494 <exit>
+  }
+
+  for(n = 0; n < MAXCPU && cpustat(n, &a[n]) == 0; n++)
+  58:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  5f:	eb 04                	jmp    65 <main+0x65>
+  61:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+  65:	83 7d e0 07          	cmpl   $0x7,-0x20(%ebp)
+  69:	7f 27                	jg     92 <main+0x92>
+  6b:	8d 8d d8 f9 ff ff    	lea    -0x628(%ebp),%ecx
+  71:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  74:	89 d0                	mov    %edx,%eax
+  76:	01 c0                	add    %eax,%eax
+  78:	01 d0                	add    %edx,%eax
+  7a:	c1 e0 06             	shl    $0x6,%eax
+  7d:	01 c8                	add    %ecx,%eax
+  7f:	83 ec 08             	sub    $0x8,%esp
+  82:	50                   	push   %eax
+  83:	ff 75 e0             	push   -0x20(%ebp)
+  86:	e8 d9 04 00 00       	call   564 <cpustat>
+  8b:	83 c4 10             	add    $0x10,%esp
+  8e:	85 c0                	test   %eax,%eax
+  90:	74 cf                	je     61 <main+0x61>
+    ;
+  sleep(interval);
+  92:	83 ec 0c             	sub    $0xc,%esp
+  95:	ff 75 d8             	push   -0x28(%ebp)
+  98:	e8 87 04 00 00       	call   524 <sleep>
+  9d:	83 c4 10             	add    $0x10,%esp
+  for(c = 0; c < n; c++){
+  a0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  a7:	e9 4c 01 00 00       	jmp    1f8 <main+0x1f8>
+    if(cpustat(c, &b) < 0)
+  ac:	83 ec 08             	sub    $0x8,%esp
+  af:	8d 85 18 f9 ff ff    	lea    -0x6e8(%ebp),%eax
+  b5:	50                   	push   %eax
+  b6:	ff 75 e4             	push   -0x1c(%ebp)
+  b9:	e8 a6 04 00 00       	call   564 <cpustat>
+  be:	83 c4 10             	add    $0x10,%esp
+  c1:	85 c0                	test   %eax,%eax
+  c3:	0f 88 3d 01 00 00    	js     206 <main+0x206>
+      break;
+    t = b.ticks - a[c].ticks;
+  c9:	8b 8d 18 f9 ff ff    	mov    -0x6e8(%ebp),%ecx
+  cf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  d2:	89 d0                	mov    %edx,%eax
+  d4:	01 c0                	add    %eax,%eax
+  d6:	01 d0                	add    %edx,%eax
+  d8:	c1 e0 06             	shl    $0x6,%eax
+  db:	8d 40 e8             	lea    -0x18(%eax),%eax
+  de:	01 e8                	add    %ebp,%eax
+  e0:	2d 10 06 00 00       	sub    $0x610,%eax
+  e5:	8b 00                	mov    (%eax),%eax
+  e7:	29 c1                	sub    %eax,%ecx
+  e9:	89 ca                	mov    %ecx,%edx
+  eb:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    if(t == 0)
+  ee:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  f2:	75 07                	jne    fb <main+0xfb>
+      t = 1;
+  f4:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+    printf(1, "cpu%d: %d%% idle (%d of %d ticks)",
+           c, (b.idle - a[c].idle) * 100 / t, b.idle - a[c].idle, t);
+  fb:	8b 8d 1c f9 ff ff    	mov    -0x6e4(%ebp),%ecx
+ 101:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 104:	89 d0                	mov    %edx,%eax
+ 106:	01 c0                	add    %eax,%eax
+ 108:	01 d0                	add    %edx,%eax
+ 10a:	c1 e0 06             	shl    $0x6,%eax
+ 10d:	8d 40 e8             	lea    -0x18(%eax),%eax
+ 110:	01 e8                	add    %ebp,%eax
+ 112:	2d 0c 06 00 00       	sub    $0x60c,%eax
+ 117:	8b 00                	mov    (%eax),%eax
+    printf(1, "cpu%d: %d%% idle (%d of %d ticks)",
+ 119:	29 c1                	sub    %eax,%ecx
+           c, (b.idle - a[c].idle) * 100 / t, b.idle - a[c].idle, t);
+ 11b:	8b 9d 1c f9 ff ff    	mov    -0x6e4(%ebp),%ebx
+ 121:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 124:	89 d0                	mov    %edx,%eax
+ 126:	01 c0                	add    %eax,%eax
+ 128:	01 d0                	add    %edx,%eax
+ 12a:	c1 e0 06             	shl    $0x6,%eax
+ 12d:	8d 40 e8             	lea    -0x18(%eax),%eax
+ 130:	01 e8                	add    %ebp,%eax
+ 132:	2d 0c 06 00 00       	sub    $0x60c,%eax
+ 137:	8b 00                	mov    (%eax),%eax
+ 139:	29 c3                	sub    %eax,%ebx
+ 13b:	89 da                	mov    %ebx,%edx
+ 13d:	6b c2 64             	imul   $0x64,%edx,%eax
+    printf(1, "cpu%d: %d%% idle (%d of %d ticks)",
+ 140:	8b 75 dc             	mov    -0x24(%ebp),%esi
+ 143:	ba 00 00 00 00       	mov    $0x0,%edx
+ 148:	f7 f6                	div    %esi
+ 14a:	83 ec 08             	sub    $0x8,%esp
+ 14d:	ff 75 dc             	push   -0x24(%ebp)
+ 150:	51                   	push   %ecx
+ 151:	50                   	push   %eax
+ 152:	ff 75 e4             	push   -0x1c(%ebp)
+ 155:	68 44 08 00 00       	push   $0x844
+ 15a:	6a 01                	push   $0x1
+ 15c:	e8 37 05 00 00       	call   698 <printf>
+ 161:	83 c4 20             	add    $0x20,%esp
+    if(b.rtutil || b.rtmisses)
+ 164:	8b 85 20 f9 ff ff    	mov    -0x6e0(%ebp),%eax
+ 16a:	85 c0                	test   %eax,%eax
+ 16c:	75 0a                	jne    178 <main+0x178>
+ 16e:	8b 85 24 f9 ff ff    	mov    -0x6dc(%ebp),%eax
+ 174:	85 c0                	test   %eax,%eax
+ 176:	74 6a                	je     1e2 <main+0x1e2>
+      printf(1, ", edf %d.%d%% reserved, %d missed",
+             b.rtutil / 10, b.rtutil % 10, b.rtmisses - a[c].rtmisses);
+ 178:	8b 8d 24 f9 ff ff    	mov    -0x6dc(%ebp),%ecx
+ 17e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 181:	89 d0                	mov    %edx,%eax
+ 183:	01 c0                	add    %eax,%eax
+ 185:	01 d0                	add    %edx,%eax
+ 187:	c1 e0 06             	shl    $0x6,%eax
+ 18a:	8d 40 e8             	lea    -0x18(%eax),%eax
+ 18d:	01 e8                	add    %ebp,%eax
+ 18f:	2d 04 06 00 00       	sub    $0x604,%eax
+ 194:	8b 00                	mov    (%eax),%eax
+      printf(1, ", edf %d.%d%% reserved, %d missed",
+ 196:	89 ce                	mov    %ecx,%esi
+ 198:	29 c6                	sub    %eax,%esi
+             b.rtutil / 10, b.rtutil % 10, b.rtmisses - a[c].rtmisses);
+ 19a:	8b 9d 20 f9 ff ff    	mov    -0x6e0(%ebp),%ebx
+      printf(1, ", edf %d.%d%% reserved, %d missed",
+ 1a0:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ 1a5:	89 d8                	mov    %ebx,%eax
+ 1a7:	f7 e2                	mul    %edx
+ 1a9:	89 d1                	mov    %edx,%ecx
+ 1ab:	c1 e9 03             	shr    $0x3,%ecx
+ 1ae:	89 c8                	mov    %ecx,%eax
+ 1b0:	c1 e0 02             	shl    $0x2,%eax
+ 1b3:	01 c8                	add    %ecx,%eax
+ 1b5:	01 c0                	add    %eax,%eax
+ 1b7:	29 c3                	sub    %eax,%ebx
+ 1b9:	89 d9                	mov    %ebx,%ecx
+             b.rtutil / 10, b.rtutil % 10, b.rtmisses - a[c].rtmisses);
+ 1bb:	8b 85 20 f9 ff ff    	mov    -0x6e0(%ebp),%eax
+      printf(1, ", edf %d.%d%% reserved, %d missed",
+ 1c1:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ 1c6:	f7 e2                	mul    %edx
+ 1c8:	89 d0                	mov    %edx,%eax
+ 1ca:	c1 e8 03             	shr    $0x3,%eax
+ 1cd:	83 ec 0c             	sub    $0xc,%esp
+ 1d0:	56                   	push   %esi
+ 1d1:	51                   	push   %ecx
+ 1d2:	50                   	push   %eax
+ 1d3:	68 68 08 00 00       	push   $0x868
+ 1d8:	6a 01                	push   $0x1
+ 1da:	e8 b9 04 00 00       	call   698 <printf>
+ 1df:	83 c4 20             	add    $0x20,%esp
+    printf(1, "\n");
+ 1e2:	83 ec 08             	sub    $0x8,%esp
+ 1e5:	68 8a 08 00 00       	push   $0x88a
+ 1ea:	6a 01                	push   $0x1
+ 1ec:	e8 a7 04 00 00       	call   698 <printf>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+  for(c = 0; c < n; c++){
+ 1f4:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 1f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1fb:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+ 1fe:	0f 8c a8 fe ff ff    	jl     ac <main+0xac>
+ 204:	eb 01                	jmp    207 <main+0x207>
+      break;
+ 206:	90                   	nop
+  }
+  exit();
+ 207:	e8 88 02 00 00       	call   494 <exit>
+
+0000020c <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 20c:	55                   	push   %ebp
+ 20d:	89 e5                	mov    %esp,%ebp
+ 20f:	57                   	push   %edi
+ 210:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 211:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 214:	8b 55 10             	mov    0x10(%ebp),%edx
+ 217:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21a:	89 cb                	mov    %ecx,%ebx
+ 21c:	89 df                	mov    %ebx,%edi
+ 21e:	89 d1                	mov    %edx,%ecx
+ 220:	fc                   	cld
+ 221:	f3 aa                	rep stos %al,%es:(%edi)
+ 223:	89 ca                	mov    %ecx,%edx
+ 225:	89 fb                	mov    %edi,%ebx
+ 227:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 22a:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 22d:	90                   	nop
+ 22e:	5b                   	pop    %ebx
+ 22f:	5f                   	pop    %edi
+ 230:	5d                   	pop    %ebp
+ 231:	c3                   	ret
+
+00000232 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 232:	55                   	push   %ebp
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 238:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 23e:	90                   	nop
+ 23f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 242:	8d 42 01             	lea    0x1(%edx),%eax
+ 245:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 248:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 24e:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 251:	0f b6 12             	movzbl (%edx),%edx
+ 254:	88 10                	mov    %dl,(%eax)
+ 256:	0f b6 00             	movzbl (%eax),%eax
+ 259:	84 c0                	test   %al,%al
+ 25b:	75 e2                	jne    23f <strcpy+0xd>
+    ;
+  return os;
+ 25d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 260:	c9                   	leave
+ 261:	c3                   	ret
+
+00000262 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 262:	55                   	push   %ebp
+ 263:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 265:	eb 08                	jmp    26f <strcmp+0xd>
+    p++, q++;
+ 267:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 26b:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 26f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 272:	0f b6 00             	movzbl (%eax),%eax
+ 275:	84 c0                	test   %al,%al
+ 277:	74 10                	je     289 <strcmp+0x27>
+ 279:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27c:	0f b6 10             	movzbl (%eax),%edx
+ 27f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 282:	0f b6 00             	movzbl (%eax),%eax
+ 285:	38 c2                	cmp    %al,%dl
+ 287:	74 de                	je     267 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 289:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28c:	0f b6 00             	movzbl (%eax),%eax
+ 28f:	0f b6 d0             	movzbl %al,%edx
+ 292:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 295:	0f b6 00             	movzbl (%eax),%eax
+ 298:	0f b6 c0             	movzbl %al,%eax
+ 29b:	29 c2                	sub    %eax,%edx
+ 29d:	89 d0                	mov    %edx,%eax
+}
+ 29f:	5d                   	pop    %ebp
+ 2a0:	c3                   	ret
+
+000002a1 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+ 2a4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2a7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2ae:	eb 04                	jmp    2b4 <strlen+0x13>
+ 2b0:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2b4:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	01 d0                	add    %edx,%eax
+ 2bc:	0f b6 00             	movzbl (%eax),%eax
+ 2bf:	84 c0                	test   %al,%al
+ 2c1:	75 ed                	jne    2b0 <strlen+0xf>
+    ;
+  return n;
+ 2c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c6:	c9                   	leave
+ 2c7:	c3                   	ret
+
+000002c8 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2c8:	55                   	push   %ebp
+ 2c9:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2cb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2ce:	50                   	push   %eax
+ 2cf:	ff 75 0c             	push   0xc(%ebp)
+ 2d2:	ff 75 08             	push   0x8(%ebp)
+ 2d5:	e8 32 ff ff ff       	call   20c <stosb>
+ 2da:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2dd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2e0:	c9                   	leave
+ 2e1:	c3                   	ret
+
+000002e2 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2e2:	55                   	push   %ebp
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	83 ec 04             	sub    $0x4,%esp
+ 2e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2eb:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2ee:	eb 14                	jmp    304 <strchr+0x22>
+    if(*s == c)
+ 2f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f3:	0f b6 00             	movzbl (%eax),%eax
+ 2f6:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2f9:	75 05                	jne    300 <strchr+0x1e>
+      return (char*)s;
+ 2fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fe:	eb 13                	jmp    313 <strchr+0x31>
+  for(; *s; s++)
+ 300:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+ 307:	0f b6 00             	movzbl (%eax),%eax
+ 30a:	84 c0                	test   %al,%al
+ 30c:	75 e2                	jne    2f0 <strchr+0xe>
+  return 0;
+ 30e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+
+00000315 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 315:	55                   	push   %ebp
+ 316:	89 e5                	mov    %esp,%ebp
+ 318:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 31b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 322:	eb 42                	jmp    366 <gets+0x51>
+    cc = read(0, &c, 1);
+ 324:	83 ec 04             	sub    $0x4,%esp
+ 327:	6a 01                	push   $0x1
+ 329:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 32c:	50                   	push   %eax
+ 32d:	6a 00                	push   $0x0
+ 32f:	e8 78 01 00 00       	call   4ac <read>
+ 334:	83 c4 10             	add    $0x10,%esp
+ 337:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 33a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 33e:	7e 33                	jle    373 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 340:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 343:	8d 50 01             	lea    0x1(%eax),%edx
+ 346:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 349:	89 c2                	mov    %eax,%edx
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	01 c2                	add    %eax,%edx
+ 350:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 354:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 356:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 35a:	3c 0a                	cmp    $0xa,%al
+ 35c:	74 16                	je     374 <gets+0x5f>
+ 35e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 362:	3c 0d                	cmp    $0xd,%al
+ 364:	74 0e                	je     374 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 366:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 369:	83 c0 01             	add    $0x1,%eax
+ 36c:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 36f:	7f b3                	jg     324 <gets+0xf>
+ 371:	eb 01                	jmp    374 <gets+0x5f>
+      break;
+ 373:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 374:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 377:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37a:	01 d0                	add    %edx,%eax
+ 37c:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 37f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 382:	c9                   	leave
+ 383:	c3                   	ret
+
+00000384 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 384:	55                   	push   %ebp
+ 385:	89 e5                	mov    %esp,%ebp
+ 387:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 38a:	83 ec 08             	sub    $0x8,%esp
+ 38d:	6a 00                	push   $0x0
+ 38f:	ff 75 08             	push   0x8(%ebp)
+ 392:	e8 3d 01 00 00       	call   4d4 <open>
+ 397:	83 c4 10             	add    $0x10,%esp
+ 39a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 39d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3a1:	79 07                	jns    3aa <stat+0x26>
+    return -1;
+ 3a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3a8:	eb 25                	jmp    3cf <stat+0x4b>
+  r = fstat(fd, st);
+ 3aa:	83 ec 08             	sub    $0x8,%esp
+ 3ad:	ff 75 0c             	push   0xc(%ebp)
+ 3b0:	ff 75 f4             	push   -0xc(%ebp)
+ 3b3:	e8 34 01 00 00       	call   4ec <fstat>
+ 3b8:	83 c4 10             	add    $0x10,%esp
+ 3bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3be:	83 ec 0c             	sub    $0xc,%esp
+ 3c1:	ff 75 f4             	push   -0xc(%ebp)
+ 3c4:	e8 f3 00 00 00       	call   4bc <close>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3cc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3cf:	c9                   	leave
+ 3d0:	c3                   	ret
+
+000003d1 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3d1:	55                   	push   %ebp
+ 3d2:	89 e5                	mov    %esp,%ebp
+ 3d4:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 3d7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3de:	eb 25                	jmp    405 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3e0:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3e3:	89 d0                	mov    %edx,%eax
+ 3e5:	c1 e0 02             	shl    $0x2,%eax
+ 3e8:	01 d0                	add    %edx,%eax
+ 3ea:	01 c0                	add    %eax,%eax
+ 3ec:	89 c1                	mov    %eax,%ecx
+ 3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f1:	8d 50 01             	lea    0x1(%eax),%edx
+ 3f4:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3f7:	0f b6 00             	movzbl (%eax),%eax
+ 3fa:	0f be c0             	movsbl %al,%eax
+ 3fd:	01 c8                	add    %ecx,%eax
+ 3ff:	83 e8 30             	sub    $0x30,%eax
+ 402:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 405:	8b 45 08             	mov    0x8(%ebp),%eax
+ 408:	0f b6 00             	movzbl (%eax),%eax
+ 40b:	3c 2f                	cmp    $0x2f,%al
+ 40d:	7e 0a                	jle    419 <atoi+0x48>
+ 40f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 412:	0f b6 00             	movzbl (%eax),%eax
+ 415:	3c 39                	cmp    $0x39,%al
+ 417:	7e c7                	jle    3e0 <atoi+0xf>
+  return n;
+ 419:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 41c:	c9                   	leave
+ 41d:	c3                   	ret
+
+0000041e <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 41e:	55                   	push   %ebp
+ 41f:	89 e5                	mov    %esp,%ebp
+ 421:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 424:	8b 45 08             	mov    0x8(%ebp),%eax
+ 427:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 42a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 430:	eb 17                	jmp    449 <memmove+0x2b>
+    *dst++ = *src++;
+ 432:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 435:	8d 42 01             	lea    0x1(%edx),%eax
+ 438:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 43b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 43e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 441:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 444:	0f b6 12             	movzbl (%edx),%edx
+ 447:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 449:	8b 45 10             	mov    0x10(%ebp),%eax
+ 44c:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 44f:	89 55 10             	mov    %edx,0x10(%ebp)
+ 452:	85 c0                	test   %eax,%eax
+ 454:	7f dc                	jg     432 <memmove+0x14>
+  return vdst;
+ 456:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 459:	c9                   	leave
+ 45a:	c3                   	ret
+
+0000045b <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 45b:	55                   	push   %ebp
+ 45c:	89 e5                	mov    %esp,%ebp
+ 45e:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 461:	83 ec 0c             	sub    $0xc,%esp
+ 464:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 467:	50                   	push   %eax
+ 468:	e8 ff 00 00 00       	call   56c <nanouptime>
+ 46d:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 470:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 473:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 479:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47c:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 481:	f7 e2                	mul    %edx
+ 483:	89 d0                	mov    %edx,%eax
+ 485:	c1 e8 06             	shr    $0x6,%eax
+ 488:	01 c8                	add    %ecx,%eax
+}
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+
+0000048c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 48c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <exit>:
+SYSCALL(exit)
+ 494:	b8 02 00 00 00       	mov    $0x2,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <wait>:
+SYSCALL(wait)
+ 49c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <pipe>:
+SYSCALL(pipe)
+ 4a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <read>:
+SYSCALL(read)
+ 4ac:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <write>:
+SYSCALL(write)
+ 4b4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <close>:
+SYSCALL(close)
+ 4bc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <kill>:
+SYSCALL(kill)
+ 4c4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <exec>:
+SYSCALL(exec)
+ 4cc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <open>:
+SYSCALL(open)
+ 4d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <mknod>:
+SYSCALL(mknod)
+ 4dc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <unlink>:
+SYSCALL(unlink)
+ 4e4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <fstat>:
+SYSCALL(fstat)
+ 4ec:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <link>:
+SYSCALL(link)
+ 4f4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <mkdir>:
+SYSCALL(mkdir)
+ 4fc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <chdir>:
+SYSCALL(chdir)
+ 504:	b8 09 00 00 00       	mov    $0x9,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <dup>:
+SYSCALL(dup)
+ 50c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <getpid>:
+SYSCALL(getpid)
+ 514:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <sbrk>:
+SYSCALL(sbrk)
+ 51c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <sleep>:
+SYSCALL(sleep)
+ 524:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <uptime>:
+SYSCALL(uptime)
+ 52c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <saveProc>:
+SYSCALL(saveProc)
+ 534:	b8 16 00 00 00       	mov    $0x16,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <loadProc>:
+SYSCALL(loadProc)
+ 53c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <setpriority>:
+SYSCALL(setpriority)
+ 544:	b8 19 00 00 00       	mov    $0x19,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <setaffinity>:
+SYSCALL(setaffinity)
+ 54c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <getaffinity>:
+SYSCALL(getaffinity)
+ 554:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <nanosleep>:
+SYSCALL(nanosleep)
+ 55c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <cpustat>:
+SYSCALL(cpustat)
+ 564:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <nanouptime>:
+SYSCALL(nanouptime)
+ 56c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <settickets>:
+SYSCALL(settickets)
+ 574:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <setdeadline>:
+SYSCALL(setdeadline)
+ 57c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <rtstat>:
+SYSCALL(rtstat)
+ 584:	b8 21 00 00 00       	mov    $0x21,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <schedstat>:
+SYSCALL(schedstat)
+ 58c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <waitpid>:
+SYSCALL(waitpid)
+ 594:	b8 23 00 00 00       	mov    $0x23,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <clone>:
+SYSCALL(clone)
+ 59c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <futexwait>:
+SYSCALL(futexwait)
+ 5a4:	b8 25 00 00 00       	mov    $0x25,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <futexwake>:
+SYSCALL(futexwake)
+ 5ac:	b8 26 00 00 00       	mov    $0x26,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <lockstat>:
+SYSCALL(lockstat)
+ 5b4:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <dcachestat>:
+SYSCALL(dcachestat)
+ 5bc:	b8 28 00 00 00       	mov    $0x28,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 5c4:	55                   	push   %ebp
+ 5c5:	89 e5                	mov    %esp,%ebp
+ 5c7:	83 ec 18             	sub    $0x18,%esp
+ 5ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5cd:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 5d0:	83 ec 04             	sub    $0x4,%esp
+ 5d3:	6a 01                	push   $0x1
+ 5d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 5d8:	50                   	push   %eax
+ 5d9:	ff 75 08             	push   0x8(%ebp)
+ 5dc:	e8 d3 fe ff ff       	call   4b4 <write>
+ 5e1:	83 c4 10             	add    $0x10,%esp
+}
+ 5e4:	90                   	nop
+ 5e5:	c9                   	leave
+ 5e6:	c3                   	ret
+
+000005e7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e7:	55                   	push   %ebp
+ 5e8:	89 e5                	mov    %esp,%ebp
+ 5ea:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 5ed:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5f4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5f8:	74 17                	je     611 <printint+0x2a>
+ 5fa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5fe:	79 11                	jns    611 <printint+0x2a>
+    neg = 1;
+ 600:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 607:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 60a:	f7 d8                	neg    %eax
+ 60c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 60f:	eb 06                	jmp    617 <printint+0x30>
+  } else {
+    x = xx;
+ 611:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 614:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 617:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 61e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 621:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 624:	ba 00 00 00 00       	mov    $0x0,%edx
+ 629:	f7 f1                	div    %ecx
+ 62b:	89 d1                	mov    %edx,%ecx
+ 62d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 630:	8d 50 01             	lea    0x1(%eax),%edx
+ 633:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 636:	0f b6 91 a0 0a 00 00 	movzbl 0xaa0(%ecx),%edx
+ 63d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 641:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 644:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 647:	ba 00 00 00 00       	mov    $0x0,%edx
+ 64c:	f7 f1                	div    %ecx
+ 64e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 651:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 655:	75 c7                	jne    61e <printint+0x37>
+  if(neg)
+ 657:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 65b:	74 2d                	je     68a <printint+0xa3>
+    buf[i++] = '-';
+ 65d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 660:	8d 50 01             	lea    0x1(%eax),%edx
+ 663:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 666:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 66b:	eb 1d                	jmp    68a <printint+0xa3>
+    putc(fd, buf[i]);
+ 66d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 673:	01 d0                	add    %edx,%eax
+ 675:	0f b6 00             	movzbl (%eax),%eax
+ 678:	0f be c0             	movsbl %al,%eax
+ 67b:	83 ec 08             	sub    $0x8,%esp
+ 67e:	50                   	push   %eax
+ 67f:	ff 75 08             	push   0x8(%ebp)
+ 682:	e8 3d ff ff ff       	call   5c4 <putc>
+ 687:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 68a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 68e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 692:	79 d9                	jns    66d <printint+0x86>
+}
+ 694:	90                   	nop
+ 695:	90                   	nop
+ 696:	c9                   	leave
+ 697:	c3                   	ret
+
+00000698 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 698:	55                   	push   %ebp
+ 699:	89 e5                	mov    %esp,%ebp
+ 69b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 69e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 6a5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 6a8:	83 c0 04             	add    $0x4,%eax
+ 6ab:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6ae:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 6b5:	e9 59 01 00 00       	jmp    813 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 6ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6bd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6c0:	01 d0                	add    %edx,%eax
+ 6c2:	0f b6 00             	movzbl (%eax),%eax
+ 6c5:	0f be c0             	movsbl %al,%eax
+ 6c8:	25 ff 00 00 00       	and    $0xff,%eax
+ 6cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 6d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6d4:	75 2c                	jne    702 <printf+0x6a>
+      if(c == '%'){
+ 6d6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 6da:	75 0c                	jne    6e8 <printf+0x50>
+        state = '%';
+ 6dc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 6e3:	e9 27 01 00 00       	jmp    80f <printf+0x177>
+      } else {
+        putc(fd, c);
+ 6e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6eb:	0f be c0             	movsbl %al,%eax
+ 6ee:	83 ec 08             	sub    $0x8,%esp
+ 6f1:	50                   	push   %eax
+ 6f2:	ff 75 08             	push   0x8(%ebp)
+ 6f5:	e8 ca fe ff ff       	call   5c4 <putc>
+ 6fa:	83 c4 10             	add    $0x10,%esp
+ 6fd:	e9 0d 01 00 00       	jmp    80f <printf+0x177>
+      }
+    } else if(state == '%'){
+ 702:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 706:	0f 85 03 01 00 00    	jne    80f <printf+0x177>
+      if(c == 'd'){
+ 70c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 710:	75 1e                	jne    730 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 712:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 715:	8b 00                	mov    (%eax),%eax
+ 717:	6a 01                	push   $0x1
+ 719:	6a 0a                	push   $0xa
+ 71b:	50                   	push   %eax
+ 71c:	ff 75 08             	push   0x8(%ebp)
+ 71f:	e8 c3 fe ff ff       	call   5e7 <printint>
+ 724:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 727:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 72b:	e9 d8 00 00 00       	jmp    808 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 730:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 734:	74 06                	je     73c <printf+0xa4>
+ 736:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 73a:	75 1e                	jne    75a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 73c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 73f:	8b 00                	mov    (%eax),%eax
+ 741:	6a 00                	push   $0x0
+ 743:	6a 10                	push   $0x10
+ 745:	50                   	push   %eax
+ 746:	ff 75 08             	push   0x8(%ebp)
+ 749:	e8 99 fe ff ff       	call   5e7 <printint>
+ 74e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 751:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 755:	e9 ae 00 00 00       	jmp    808 <printf+0x170>
+      } else if(c == 's'){
+ 75a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 75e:	75 43                	jne    7a3 <printf+0x10b>
+        s = (char*)*ap;
+ 760:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 763:	8b 00                	mov    (%eax),%eax
+ 765:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 768:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 76c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 770:	75 25                	jne    797 <printf+0xff>
+          s = "(null)";
+ 772:	c7 45 f4 8c 08 00 00 	movl   $0x88c,-0xc(%ebp)
+        while(*s != 0){
+ 779:	eb 1c                	jmp    797 <printf+0xff>
+          putc(fd, *s);
+ 77b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 77e:	0f b6 00             	movzbl (%eax),%eax
+ 781:	0f be c0             	movsbl %al,%eax
+ 784:	83 ec 08             	sub    $0x8,%esp
+ 787:	50                   	push   %eax
+ 788:	ff 75 08             	push   0x8(%ebp)
+ 78b:	e8 34 fe ff ff       	call   5c4 <putc>
+ 790:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 793:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79a:	0f b6 00             	movzbl (%eax),%eax
+ 79d:	84 c0                	test   %al,%al
+ 79f:	75 da                	jne    77b <printf+0xe3>
+ 7a1:	eb 65                	jmp    808 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 7a3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 7a7:	75 1d                	jne    7c6 <printf+0x12e>
+        putc(fd, *ap);
+ 7a9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ac:	8b 00                	mov    (%eax),%eax
+ 7ae:	0f be c0             	movsbl %al,%eax
+ 7b1:	83 ec 08             	sub    $0x8,%esp
+ 7b4:	50                   	push   %eax
+ 7b5:	ff 75 08             	push   0x8(%ebp)
+ 7b8:	e8 07 fe ff ff       	call   5c4 <putc>
+ 7bd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7c0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7c4:	eb 42                	jmp    808 <printf+0x170>
+      } else if(c == '%'){
+ 7c6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ca:	75 17                	jne    7e3 <printf+0x14b>
+        putc(fd, c);
+ 7cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7cf:	0f be c0             	movsbl %al,%eax
+ 7d2:	83 ec 08             	sub    $0x8,%esp
+ 7d5:	50                   	push   %eax
+ 7d6:	ff 75 08             	push   0x8(%ebp)
+ 7d9:	e8 e6 fd ff ff       	call   5c4 <putc>
+ 7de:	83 c4 10             	add    $0x10,%esp
+ 7e1:	eb 25                	jmp    808 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 7e3:	83 ec 08             	sub    $0x8,%esp
+ 7e6:	6a 25                	push   $0x25
+ 7e8:	ff 75 08             	push   0x8(%ebp)
+ 7eb:	e8 d4 fd ff ff       	call   5c4 <putc>
+ 7f0:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7f3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7f6:	0f be c0             	movsbl %al,%eax
+ 7f9:	83 ec 08             	sub    $0x8,%esp
+ 7fc:	50                   	push   %eax
+ 7fd:	ff 75 08             	push   0x8(%ebp)
+ 800:	e8 bf fd ff ff       	call   5c4 <putc>
+ 805:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 808:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 80f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 813:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 816:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 819:	01 d0                	add    %edx,%eax
+ 81b:	0f b6 00             	movzbl (%eax),%eax
+ 81e:	84 c0                	test   %al,%al
+ 820:	0f 85 94 fe ff ff    	jne    6ba <printf+0x22>
+    }
+  }
+}
+ 826:	90                   	nop
+ 827:	90                   	nop
+ 828:	c9                   	leave
+ 829:	c3                   	ret
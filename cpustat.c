@@ -0,0 +1,42 @@
+// Print how busy each CPU was over an interval, one second
+// by default, with its EDF reservations and the deadlines
+// missed meanwhile: cpustat [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+#define MAXCPU 8
+
+int
+main(int argc, char **argv)
+{
+  struct cpustat a[MAXCPU], b;
+  int c, n, t, interval;
+
+  interval = 100;
+  if(argc > 1 && (interval = atoi(argv[1])) <= 0){
+    printf(2, "usage: cpustat [ticks]\n");
+    exit();
+  }
+
+  for(n = 0; n < MAXCPU && cpustat(n, &a[n]) == 0; n++)
+    ;
+  sleep(interval);
+  for(c = 0; c < n; c++){
+    if(cpustat(c, &b) < 0)
+      break;
+    t = b.ticks - a[c].ticks;
+    if(t == 0)
+      t = 1;
+    printf(1, "cpu%d: %d%% idle (%d of %d ticks)",
+           c, (b.idle - a[c].idle) * 100 / t, b.idle - a[c].idle, t);
+    if(b.rtutil || b.rtmisses)
+      printf(1, ", edf %d.%d%% reserved, %d missed",
+             b.rtutil / 10, b.rtutil % 10, b.rtmisses - a[c].rtmisses);
+    printf(1, "\n");
+  }
+  exit();
+}
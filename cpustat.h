@@ -0,0 +1,29 @@
+// Dispatch latency record of a CPU or a process.  Bucket 0 of a
+// histogram counts samples under 1us, bucket i those in
+// [2^(i-1), 2^i) us; the last bucket also takes anything longer.
+// Totals are in microseconds and wrap.
+struct schedstat {
+  uint nvcsw;     // switches away because the process slept or exited
+  uint nivcsw;    // switches away because it was preempted
+  uint delayus;   // time spent RUNNABLE before being dispatched
+  uint runus;     // time spent running
+  uint delay[NSCHEDHIST];  // run queue delay of each dispatch
+  uint slice[NSCHEDHIST];  // time run by each dispatch
+};
+
+// Per-CPU scheduler statistics, filled in by cpustat().
+struct cpustat {
+  uint ticks;     // scheduler ticks taken
+  uint idle;      // of those, ones that found no process running
+  uint rtutil;    // EDF reservations, per mille of the CPU
+  uint rtmisses;  // EDF deadlines missed
+  struct schedstat sched;  // everything dispatched here
+};
+
+// A process's EDF reservation and record, filled in by rtstat().
+struct rtstat {
+  uint runtime;   // ticks of CPU per period; 0 if not EDF
+  uint period;    // period length in ticks
+  uint periods;   // periods completed
+  uint misses;    // periods that ended before it got its runtime
+};
@@ -1,3 +1,9 @@
+// Time since boot, from nanouptime().
+struct timespec {
+  uint sec;
+  uint nsec;
+};
+
 struct rtcdate {
   uint second;
   uint minute;
@@ -0,0 +1,6 @@
+// Directory entry cache counters, filled in by dcachestat().
+// Totals wrap.
+struct dcachestat {
+  uint hits;     // path elements found in the cache
+  uint misses;   // ones looked up in the directory instead
+};
@@ -0,0 +1,1471 @@
+
+_dcachetest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <mkpath>:
+
+// Make path the file at depth n below dc, or with f 0 the
+// directory there.
+static void
+mkpath(int n, int f)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  strcpy(path, "dc");
+   6:	83 ec 08             	sub    $0x8,%esp
+   9:	68 28 0b 00 00       	push   $0xb28
+   e:	68 40 0f 00 00       	push   $0xf40
+  13:	e8 17 05 00 00       	call   52f <strcpy>
+  18:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+  1b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  22:	eb 2a                	jmp    4e <mkpath+0x4e>
+    strcpy(path + strlen(path), "/d");
+  24:	83 ec 0c             	sub    $0xc,%esp
+  27:	68 40 0f 00 00       	push   $0xf40
+  2c:	e8 6d 05 00 00       	call   59e <strlen>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	05 40 0f 00 00       	add    $0xf40,%eax
+  39:	83 ec 08             	sub    $0x8,%esp
+  3c:	68 2b 0b 00 00       	push   $0xb2b
+  41:	50                   	push   %eax
+  42:	e8 e8 04 00 00       	call   52f <strcpy>
+  47:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+  4a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  51:	3b 45 08             	cmp    0x8(%ebp),%eax
+  54:	7c ce                	jl     24 <mkpath+0x24>
+  if(f)
+  56:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  5a:	74 26                	je     82 <mkpath+0x82>
+    strcpy(path + strlen(path), "/f");
+  5c:	83 ec 0c             	sub    $0xc,%esp
+  5f:	68 40 0f 00 00       	push   $0xf40
+  64:	e8 35 05 00 00       	call   59e <strlen>
+  69:	83 c4 10             	add    $0x10,%esp
+  6c:	05 40 0f 00 00       	add    $0xf40,%eax
+  71:	83 ec 08             	sub    $0x8,%esp
+  74:	68 2e 0b 00 00       	push   $0xb2e
+  79:	50                   	push   %eax
+  7a:	e8 b0 04 00 00       	call   52f <strcpy>
+  7f:	83 c4 10             	add    $0x10,%esp
+}
+  82:	90                   	nop
+  83:	c9                   	leave
+  84:	c3                   	ret
+
+00000085 <fail>:
+
+static void
+fail(char *what)
+{
+  85:	55                   	push   %ebp
+  86:	89 e5                	mov    %esp,%ebp
+  88:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "dcachetest: %s\n", what);
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	ff 75 08             	push   0x8(%ebp)
+  91:	68 31 0b 00 00       	push   $0xb31
+  96:	6a 01                	push   $0x1
+  98:	e8 f8 08 00 00       	call   995 <printf>
+  9d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "dcachetest failed\n");
+  a0:	83 ec 08             	sub    $0x8,%esp
+  a3:	68 41 0b 00 00       	push   $0xb41
+  a8:	6a 01                	push   $0x1
+  aa:	e8 e6 08 00 00       	call   995 <printf>
+  af:	83 c4 10             	add    $0x10,%esp
+  exit();
+  b2:	e8 da 06 00 00       	call   791 <exit>
+
+000000b7 <writef>:
+}
+
+// Create the file at the bottom with content c.
+static void
+writef(char c)
+{
+  b7:	55                   	push   %ebp
+  b8:	89 e5                	mov    %esp,%ebp
+  ba:	83 ec 28             	sub    $0x28,%esp
+  bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  c0:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  int fd;
+
+  mkpath(DEPTH, 1);
+  c3:	83 ec 08             	sub    $0x8,%esp
+  c6:	6a 01                	push   $0x1
+  c8:	6a 08                	push   $0x8
+  ca:	e8 31 ff ff ff       	call   0 <mkpath>
+  cf:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0)
+  d2:	83 ec 08             	sub    $0x8,%esp
+  d5:	68 02 02 00 00       	push   $0x202
+  da:	68 40 0f 00 00       	push   $0xf40
+  df:	e8 ed 06 00 00       	call   7d1 <open>
+  e4:	83 c4 10             	add    $0x10,%esp
+  e7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  ea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  ee:	79 10                	jns    100 <writef+0x49>
+    fail("cannot create file");
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	68 54 0b 00 00       	push   $0xb54
+  f8:	e8 88 ff ff ff       	call   85 <fail>
+  fd:	83 c4 10             	add    $0x10,%esp
+  write(fd, &c, 1);
+ 100:	83 ec 04             	sub    $0x4,%esp
+ 103:	6a 01                	push   $0x1
+ 105:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+ 108:	50                   	push   %eax
+ 109:	ff 75 f4             	push   -0xc(%ebp)
+ 10c:	e8 a0 06 00 00       	call   7b1 <write>
+ 111:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+ 114:	83 ec 0c             	sub    $0xc,%esp
+ 117:	ff 75 f4             	push   -0xc(%ebp)
+ 11a:	e8 9a 06 00 00       	call   7b9 <close>
+ 11f:	83 c4 10             	add    $0x10,%esp
+}
+ 122:	90                   	nop
+ 123:	c9                   	leave
+ 124:	c3                   	ret
+
+00000125 <readf>:
+
+// Check that the file at the bottom holds c.
+static void
+readf(char c)
+{
+ 125:	55                   	push   %ebp
+ 126:	89 e5                	mov    %esp,%ebp
+ 128:	83 ec 28             	sub    $0x28,%esp
+ 12b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12e:	88 45 e4             	mov    %al,-0x1c(%ebp)
+  char got;
+  int fd;
+
+  mkpath(DEPTH, 1);
+ 131:	83 ec 08             	sub    $0x8,%esp
+ 134:	6a 01                	push   $0x1
+ 136:	6a 08                	push   $0x8
+ 138:	e8 c3 fe ff ff       	call   0 <mkpath>
+ 13d:	83 c4 10             	add    $0x10,%esp
+  if((fd = open(path, O_RDONLY)) < 0)
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	6a 00                	push   $0x0
+ 145:	68 40 0f 00 00       	push   $0xf40
+ 14a:	e8 82 06 00 00       	call   7d1 <open>
+ 14f:	83 c4 10             	add    $0x10,%esp
+ 152:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 155:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 159:	79 10                	jns    16b <readf+0x46>
+    fail("cannot open file");
+ 15b:	83 ec 0c             	sub    $0xc,%esp
+ 15e:	68 67 0b 00 00       	push   $0xb67
+ 163:	e8 1d ff ff ff       	call   85 <fail>
+ 168:	83 c4 10             	add    $0x10,%esp
+  if(read(fd, &got, 1) != 1 || got != c)
+ 16b:	83 ec 04             	sub    $0x4,%esp
+ 16e:	6a 01                	push   $0x1
+ 170:	8d 45 f3             	lea    -0xd(%ebp),%eax
+ 173:	50                   	push   %eax
+ 174:	ff 75 f4             	push   -0xc(%ebp)
+ 177:	e8 2d 06 00 00       	call   7a9 <read>
+ 17c:	83 c4 10             	add    $0x10,%esp
+ 17f:	83 f8 01             	cmp    $0x1,%eax
+ 182:	75 09                	jne    18d <readf+0x68>
+ 184:	0f b6 45 f3          	movzbl -0xd(%ebp),%eax
+ 188:	38 45 e4             	cmp    %al,-0x1c(%ebp)
+ 18b:	74 10                	je     19d <readf+0x78>
+    fail("stale file");
+ 18d:	83 ec 0c             	sub    $0xc,%esp
+ 190:	68 78 0b 00 00       	push   $0xb78
+ 195:	e8 eb fe ff ff       	call   85 <fail>
+ 19a:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+ 19d:	83 ec 0c             	sub    $0xc,%esp
+ 1a0:	ff 75 f4             	push   -0xc(%ebp)
+ 1a3:	e8 11 06 00 00       	call   7b9 <close>
+ 1a8:	83 c4 10             	add    $0x10,%esp
+}
+ 1ab:	90                   	nop
+ 1ac:	c9                   	leave
+ 1ad:	c3                   	ret
+
+000001ae <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 1ae:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 1b2:	83 e4 f0             	and    $0xfffffff0,%esp
+ 1b5:	ff 71 fc             	push   -0x4(%ecx)
+ 1b8:	55                   	push   %ebp
+ 1b9:	89 e5                	mov    %esp,%ebp
+ 1bb:	51                   	push   %ecx
+ 1bc:	83 ec 24             	sub    $0x24,%esp
+  struct dcachestat a, b;
+  uint t0, t1;
+  int i, fd;
+
+  printf(1, "dcachetest\n");
+ 1bf:	83 ec 08             	sub    $0x8,%esp
+ 1c2:	68 83 0b 00 00       	push   $0xb83
+ 1c7:	6a 01                	push   $0x1
+ 1c9:	e8 c7 07 00 00       	call   995 <printf>
+ 1ce:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i <= DEPTH; i++){
+ 1d1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1d8:	eb 38                	jmp    212 <main+0x64>
+    mkpath(i, 0);
+ 1da:	83 ec 08             	sub    $0x8,%esp
+ 1dd:	6a 00                	push   $0x0
+ 1df:	ff 75 f4             	push   -0xc(%ebp)
+ 1e2:	e8 19 fe ff ff       	call   0 <mkpath>
+ 1e7:	83 c4 10             	add    $0x10,%esp
+    if(mkdir(path) < 0)
+ 1ea:	83 ec 0c             	sub    $0xc,%esp
+ 1ed:	68 40 0f 00 00       	push   $0xf40
+ 1f2:	e8 02 06 00 00       	call   7f9 <mkdir>
+ 1f7:	83 c4 10             	add    $0x10,%esp
+ 1fa:	85 c0                	test   %eax,%eax
+ 1fc:	79 10                	jns    20e <main+0x60>
+      fail("mkdir failed");
+ 1fe:	83 ec 0c             	sub    $0xc,%esp
+ 201:	68 8f 0b 00 00       	push   $0xb8f
+ 206:	e8 7a fe ff ff       	call   85 <fail>
+ 20b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i <= DEPTH; i++){
+ 20e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 212:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+ 216:	7e c2                	jle    1da <main+0x2c>
+  }
+  writef('a');
+ 218:	83 ec 0c             	sub    $0xc,%esp
+ 21b:	6a 61                	push   $0x61
+ 21d:	e8 95 fe ff ff       	call   b7 <writef>
+ 222:	83 c4 10             	add    $0x10,%esp
+  readf('a');
+ 225:	83 ec 0c             	sub    $0xc,%esp
+ 228:	6a 61                	push   $0x61
+ 22a:	e8 f6 fe ff ff       	call   125 <readf>
+ 22f:	83 c4 10             	add    $0x10,%esp
+
+  // Every element of a warm path is a hit.
+  dcachestat(&a);
+ 232:	83 ec 0c             	sub    $0xc,%esp
+ 235:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 238:	50                   	push   %eax
+ 239:	e8 7b 06 00 00       	call   8b9 <dcachestat>
+ 23e:	83 c4 10             	add    $0x10,%esp
+  readf('a');
+ 241:	83 ec 0c             	sub    $0xc,%esp
+ 244:	6a 61                	push   $0x61
+ 246:	e8 da fe ff ff       	call   125 <readf>
+ 24b:	83 c4 10             	add    $0x10,%esp
+  dcachestat(&b);
+ 24e:	83 ec 0c             	sub    $0xc,%esp
+ 251:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 254:	50                   	push   %eax
+ 255:	e8 5f 06 00 00       	call   8b9 <dcachestat>
+ 25a:	83 c4 10             	add    $0x10,%esp
+  if(b.hits - a.hits < DEPTH + 2 || b.misses != a.misses)
+ 25d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 260:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 263:	29 c2                	sub    %eax,%edx
+ 265:	83 fa 09             	cmp    $0x9,%edx
+ 268:	76 0a                	jbe    274 <main+0xc6>
+ 26a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 26d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 270:	39 c2                	cmp    %eax,%edx
+ 272:	74 10                	je     284 <main+0xd6>
+    fail("warm path not served from cache");
+ 274:	83 ec 0c             	sub    $0xc,%esp
+ 277:	68 9c 0b 00 00       	push   $0xb9c
+ 27c:	e8 04 fe ff ff       	call   85 <fail>
+ 281:	83 c4 10             	add    $0x10,%esp
+
+  // A cached name must go with its unlink.
+  mkpath(DEPTH, 1);
+ 284:	83 ec 08             	sub    $0x8,%esp
+ 287:	6a 01                	push   $0x1
+ 289:	6a 08                	push   $0x8
+ 28b:	e8 70 fd ff ff       	call   0 <mkpath>
+ 290:	83 c4 10             	add    $0x10,%esp
+  if(unlink(path) < 0)
+ 293:	83 ec 0c             	sub    $0xc,%esp
+ 296:	68 40 0f 00 00       	push   $0xf40
+ 29b:	e8 41 05 00 00       	call   7e1 <unlink>
+ 2a0:	83 c4 10             	add    $0x10,%esp
+ 2a3:	85 c0                	test   %eax,%eax
+ 2a5:	79 10                	jns    2b7 <main+0x109>
+    fail("unlink failed");
+ 2a7:	83 ec 0c             	sub    $0xc,%esp
+ 2aa:	68 bc 0b 00 00       	push   $0xbbc
+ 2af:	e8 d1 fd ff ff       	call   85 <fail>
+ 2b4:	83 c4 10             	add    $0x10,%esp
+  dcachestat(&a);
+ 2b7:	83 ec 0c             	sub    $0xc,%esp
+ 2ba:	8d 45 e0             	lea    -0x20(%ebp),%eax
+ 2bd:	50                   	push   %eax
+ 2be:	e8 f6 05 00 00       	call   8b9 <dcachestat>
+ 2c3:	83 c4 10             	add    $0x10,%esp
+  if(open(path, O_RDONLY) >= 0)
+ 2c6:	83 ec 08             	sub    $0x8,%esp
+ 2c9:	6a 00                	push   $0x0
+ 2cb:	68 40 0f 00 00       	push   $0xf40
+ 2d0:	e8 fc 04 00 00       	call   7d1 <open>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+ 2d8:	85 c0                	test   %eax,%eax
+ 2da:	78 10                	js     2ec <main+0x13e>
+    fail("unlinked file still opens");
+ 2dc:	83 ec 0c             	sub    $0xc,%esp
+ 2df:	68 ca 0b 00 00       	push   $0xbca
+ 2e4:	e8 9c fd ff ff       	call   85 <fail>
+ 2e9:	83 c4 10             	add    $0x10,%esp
+  dcachestat(&b);
+ 2ec:	83 ec 0c             	sub    $0xc,%esp
+ 2ef:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 2f2:	50                   	push   %eax
+ 2f3:	e8 c1 05 00 00       	call   8b9 <dcachestat>
+ 2f8:	83 c4 10             	add    $0x10,%esp
+  if(b.misses == a.misses)
+ 2fb:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 2fe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 301:	39 c2                	cmp    %eax,%edx
+ 303:	75 10                	jne    315 <main+0x167>
+    fail("unlinked name still cached");
+ 305:	83 ec 0c             	sub    $0xc,%esp
+ 308:	68 e4 0b 00 00       	push   $0xbe4
+ 30d:	e8 73 fd ff ff       	call   85 <fail>
+ 312:	83 c4 10             	add    $0x10,%esp
+  writef('b');
+ 315:	83 ec 0c             	sub    $0xc,%esp
+ 318:	6a 62                	push   $0x62
+ 31a:	e8 98 fd ff ff       	call   b7 <writef>
+ 31f:	83 c4 10             	add    $0x10,%esp
+  readf('b');
+ 322:	83 ec 0c             	sub    $0xc,%esp
+ 325:	6a 62                	push   $0x62
+ 327:	e8 f9 fd ff ff       	call   125 <readf>
+ 32c:	83 c4 10             	add    $0x10,%esp
+
+  t0 = uptimeus();
+ 32f:	e8 24 04 00 00       	call   758 <uptimeus>
+ 334:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < NOPEN; i++){
+ 337:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 33e:	eb 3d                	jmp    37d <main+0x1cf>
+    if((fd = open(path, O_RDONLY)) < 0)
+ 340:	83 ec 08             	sub    $0x8,%esp
+ 343:	6a 00                	push   $0x0
+ 345:	68 40 0f 00 00       	push   $0xf40
+ 34a:	e8 82 04 00 00       	call   7d1 <open>
+ 34f:	83 c4 10             	add    $0x10,%esp
+ 352:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 355:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 359:	79 10                	jns    36b <main+0x1bd>
+      fail("open failed");
+ 35b:	83 ec 0c             	sub    $0xc,%esp
+ 35e:	68 ff 0b 00 00       	push   $0xbff
+ 363:	e8 1d fd ff ff       	call   85 <fail>
+ 368:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 36b:	83 ec 0c             	sub    $0xc,%esp
+ 36e:	ff 75 e8             	push   -0x18(%ebp)
+ 371:	e8 43 04 00 00       	call   7b9 <close>
+ 376:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NOPEN; i++){
+ 379:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 37d:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+ 384:	7e ba                	jle    340 <main+0x192>
+  }
+  t1 = uptimeus();
+ 386:	e8 cd 03 00 00       	call   758 <uptimeus>
+ 38b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  printf(1, "dcachetest: %d opens at depth %d, %dus each\n",
+         NOPEN, DEPTH, (t1 - t0) / NOPEN);
+ 38e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 391:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  printf(1, "dcachetest: %d opens at depth %d, %dus each\n",
+ 394:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 399:	f7 e2                	mul    %edx
+ 39b:	89 d0                	mov    %edx,%eax
+ 39d:	c1 e8 06             	shr    $0x6,%eax
+ 3a0:	83 ec 0c             	sub    $0xc,%esp
+ 3a3:	50                   	push   %eax
+ 3a4:	6a 08                	push   $0x8
+ 3a6:	68 e8 03 00 00       	push   $0x3e8
+ 3ab:	68 0c 0c 00 00       	push   $0xc0c
+ 3b0:	6a 01                	push   $0x1
+ 3b2:	e8 de 05 00 00       	call   995 <printf>
+ 3b7:	83 c4 20             	add    $0x20,%esp
+
+  // Tear the tree down and build it again, so that the
+  // directories' inodes are freed and reused.
+  for(i = DEPTH + 1; i >= 0; i--){
+ 3ba:	c7 45 f4 09 00 00 00 	movl   $0x9,-0xc(%ebp)
+ 3c1:	eb 4c                	jmp    40f <main+0x261>
+    mkpath(i > DEPTH ? DEPTH : i, i > DEPTH);
+ 3c3:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+ 3c7:	0f 9f c0             	setg   %al
+ 3ca:	0f b6 d0             	movzbl %al,%edx
+ 3cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3d0:	b9 08 00 00 00       	mov    $0x8,%ecx
+ 3d5:	39 c8                	cmp    %ecx,%eax
+ 3d7:	0f 4f c1             	cmovg  %ecx,%eax
+ 3da:	83 ec 08             	sub    $0x8,%esp
+ 3dd:	52                   	push   %edx
+ 3de:	50                   	push   %eax
+ 3df:	e8 1c fc ff ff       	call   0 <mkpath>
+ 3e4:	83 c4 10             	add    $0x10,%esp
+    if(unlink(path) < 0)
+ 3e7:	83 ec 0c             	sub    $0xc,%esp
+ 3ea:	68 40 0f 00 00       	push   $0xf40
+ 3ef:	e8 ed 03 00 00       	call   7e1 <unlink>
+ 3f4:	83 c4 10             	add    $0x10,%esp
+ 3f7:	85 c0                	test   %eax,%eax
+ 3f9:	79 10                	jns    40b <main+0x25d>
+      fail("cannot remove tree");
+ 3fb:	83 ec 0c             	sub    $0xc,%esp
+ 3fe:	68 39 0c 00 00       	push   $0xc39
+ 403:	e8 7d fc ff ff       	call   85 <fail>
+ 408:	83 c4 10             	add    $0x10,%esp
+  for(i = DEPTH + 1; i >= 0; i--){
+ 40b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 40f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 413:	79 ae                	jns    3c3 <main+0x215>
+  }
+  mkpath(DEPTH, 1);
+ 415:	83 ec 08             	sub    $0x8,%esp
+ 418:	6a 01                	push   $0x1
+ 41a:	6a 08                	push   $0x8
+ 41c:	e8 df fb ff ff       	call   0 <mkpath>
+ 421:	83 c4 10             	add    $0x10,%esp
+  if(open(path, O_RDONLY) >= 0)
+ 424:	83 ec 08             	sub    $0x8,%esp
+ 427:	6a 00                	push   $0x0
+ 429:	68 40 0f 00 00       	push   $0xf40
+ 42e:	e8 9e 03 00 00       	call   7d1 <open>
+ 433:	83 c4 10             	add    $0x10,%esp
+ 436:	85 c0                	test   %eax,%eax
+ 438:	78 10                	js     44a <main+0x29c>
+    fail("removed file still opens");
+ 43a:	83 ec 0c             	sub    $0xc,%esp
+ 43d:	68 4c 0c 00 00       	push   $0xc4c
+ 442:	e8 3e fc ff ff       	call   85 <fail>
+ 447:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i <= DEPTH; i++){
+ 44a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 451:	eb 38                	jmp    48b <main+0x2dd>
+    mkpath(i, 0);
+ 453:	83 ec 08             	sub    $0x8,%esp
+ 456:	6a 00                	push   $0x0
+ 458:	ff 75 f4             	push   -0xc(%ebp)
+ 45b:	e8 a0 fb ff ff       	call   0 <mkpath>
+ 460:	83 c4 10             	add    $0x10,%esp
+    if(mkdir(path) < 0)
+ 463:	83 ec 0c             	sub    $0xc,%esp
+ 466:	68 40 0f 00 00       	push   $0xf40
+ 46b:	e8 89 03 00 00       	call   7f9 <mkdir>
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	85 c0                	test   %eax,%eax
+ 475:	79 10                	jns    487 <main+0x2d9>
+      fail("mkdir again failed");
+ 477:	83 ec 0c             	sub    $0xc,%esp
+ 47a:	68 65 0c 00 00       	push   $0xc65
+ 47f:	e8 01 fc ff ff       	call   85 <fail>
+ 484:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i <= DEPTH; i++){
+ 487:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 48b:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+ 48f:	7e c2                	jle    453 <main+0x2a5>
+  }
+  writef('c');
+ 491:	83 ec 0c             	sub    $0xc,%esp
+ 494:	6a 63                	push   $0x63
+ 496:	e8 1c fc ff ff       	call   b7 <writef>
+ 49b:	83 c4 10             	add    $0x10,%esp
+  readf('c');
+ 49e:	83 ec 0c             	sub    $0xc,%esp
+ 4a1:	6a 63                	push   $0x63
+ 4a3:	e8 7d fc ff ff       	call   125 <readf>
+ 4a8:	83 c4 10             	add    $0x10,%esp
+
+  for(i = DEPTH + 1; i >= 0; i--){
+ 4ab:	c7 45 f4 09 00 00 00 	movl   $0x9,-0xc(%ebp)
+ 4b2:	eb 38                	jmp    4ec <main+0x33e>
+    mkpath(i > DEPTH ? DEPTH : i, i > DEPTH);
+ 4b4:	83 7d f4 08          	cmpl   $0x8,-0xc(%ebp)
+ 4b8:	0f 9f c0             	setg   %al
+ 4bb:	0f b6 d0             	movzbl %al,%edx
+ 4be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4c1:	b9 08 00 00 00       	mov    $0x8,%ecx
+ 4c6:	39 c8                	cmp    %ecx,%eax
+ 4c8:	0f 4f c1             	cmovg  %ecx,%eax
+ 4cb:	83 ec 08             	sub    $0x8,%esp
+ 4ce:	52                   	push   %edx
+ 4cf:	50                   	push   %eax
+ 4d0:	e8 2b fb ff ff       	call   0 <mkpath>
+ 4d5:	83 c4 10             	add    $0x10,%esp
+    unlink(path);
+ 4d8:	83 ec 0c             	sub    $0xc,%esp
+ 4db:	68 40 0f 00 00       	push   $0xf40
+ 4e0:	e8 fc 02 00 00       	call   7e1 <unlink>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+  for(i = DEPTH + 1; i >= 0; i--){
+ 4e8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4f0:	79 c2                	jns    4b4 <main+0x306>
+  }
+  printf(1, "dcachetest ok\n");
+ 4f2:	83 ec 08             	sub    $0x8,%esp
+ 4f5:	68 78 0c 00 00       	push   $0xc78
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	e8 94 04 00 00       	call   995 <printf>
+ 501:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 504:	e8 88 02 00 00       	call   791 <exit>
+
+00000509 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 509:	55                   	push   %ebp
+ 50a:	89 e5                	mov    %esp,%ebp
+ 50c:	57                   	push   %edi
+ 50d:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 50e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 511:	8b 55 10             	mov    0x10(%ebp),%edx
+ 514:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 517:	89 cb                	mov    %ecx,%ebx
+ 519:	89 df                	mov    %ebx,%edi
+ 51b:	89 d1                	mov    %edx,%ecx
+ 51d:	fc                   	cld
+ 51e:	f3 aa                	rep stos %al,%es:(%edi)
+ 520:	89 ca                	mov    %ecx,%edx
+ 522:	89 fb                	mov    %edi,%ebx
+ 524:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 527:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 52a:	90                   	nop
+ 52b:	5b                   	pop    %ebx
+ 52c:	5f                   	pop    %edi
+ 52d:	5d                   	pop    %ebp
+ 52e:	c3                   	ret
+
+0000052f <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 52f:	55                   	push   %ebp
+ 530:	89 e5                	mov    %esp,%ebp
+ 532:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 535:	8b 45 08             	mov    0x8(%ebp),%eax
+ 538:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 53b:	90                   	nop
+ 53c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 53f:	8d 42 01             	lea    0x1(%edx),%eax
+ 542:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 545:	8b 45 08             	mov    0x8(%ebp),%eax
+ 548:	8d 48 01             	lea    0x1(%eax),%ecx
+ 54b:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 54e:	0f b6 12             	movzbl (%edx),%edx
+ 551:	88 10                	mov    %dl,(%eax)
+ 553:	0f b6 00             	movzbl (%eax),%eax
+ 556:	84 c0                	test   %al,%al
+ 558:	75 e2                	jne    53c <strcpy+0xd>
+    ;
+  return os;
+ 55a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 55d:	c9                   	leave
+ 55e:	c3                   	ret
+
+0000055f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 55f:	55                   	push   %ebp
+ 560:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 562:	eb 08                	jmp    56c <strcmp+0xd>
+    p++, q++;
+ 564:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 568:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 56c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56f:	0f b6 00             	movzbl (%eax),%eax
+ 572:	84 c0                	test   %al,%al
+ 574:	74 10                	je     586 <strcmp+0x27>
+ 576:	8b 45 08             	mov    0x8(%ebp),%eax
+ 579:	0f b6 10             	movzbl (%eax),%edx
+ 57c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 57f:	0f b6 00             	movzbl (%eax),%eax
+ 582:	38 c2                	cmp    %al,%dl
+ 584:	74 de                	je     564 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+ 589:	0f b6 00             	movzbl (%eax),%eax
+ 58c:	0f b6 d0             	movzbl %al,%edx
+ 58f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 592:	0f b6 00             	movzbl (%eax),%eax
+ 595:	0f b6 c0             	movzbl %al,%eax
+ 598:	29 c2                	sub    %eax,%edx
+ 59a:	89 d0                	mov    %edx,%eax
+}
+ 59c:	5d                   	pop    %ebp
+ 59d:	c3                   	ret
+
+0000059e <strlen>:
+
+uint
+strlen(char *s)
+{
+ 59e:	55                   	push   %ebp
+ 59f:	89 e5                	mov    %esp,%ebp
+ 5a1:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 5a4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 5ab:	eb 04                	jmp    5b1 <strlen+0x13>
+ 5ad:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 5b1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 5b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b7:	01 d0                	add    %edx,%eax
+ 5b9:	0f b6 00             	movzbl (%eax),%eax
+ 5bc:	84 c0                	test   %al,%al
+ 5be:	75 ed                	jne    5ad <strlen+0xf>
+    ;
+  return n;
+ 5c0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5c3:	c9                   	leave
+ 5c4:	c3                   	ret
+
+000005c5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 5c5:	55                   	push   %ebp
+ 5c6:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 5c8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5cb:	50                   	push   %eax
+ 5cc:	ff 75 0c             	push   0xc(%ebp)
+ 5cf:	ff 75 08             	push   0x8(%ebp)
+ 5d2:	e8 32 ff ff ff       	call   509 <stosb>
+ 5d7:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 5da:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5dd:	c9                   	leave
+ 5de:	c3                   	ret
+
+000005df <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 5df:	55                   	push   %ebp
+ 5e0:	89 e5                	mov    %esp,%ebp
+ 5e2:	83 ec 04             	sub    $0x4,%esp
+ 5e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5e8:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 5eb:	eb 14                	jmp    601 <strchr+0x22>
+    if(*s == c)
+ 5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f0:	0f b6 00             	movzbl (%eax),%eax
+ 5f3:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 5f6:	75 05                	jne    5fd <strchr+0x1e>
+      return (char*)s;
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fb:	eb 13                	jmp    610 <strchr+0x31>
+  for(; *s; s++)
+ 5fd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 601:	8b 45 08             	mov    0x8(%ebp),%eax
+ 604:	0f b6 00             	movzbl (%eax),%eax
+ 607:	84 c0                	test   %al,%al
+ 609:	75 e2                	jne    5ed <strchr+0xe>
+  return 0;
+ 60b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 610:	c9                   	leave
+ 611:	c3                   	ret
+
+00000612 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 612:	55                   	push   %ebp
+ 613:	89 e5                	mov    %esp,%ebp
+ 615:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 618:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 61f:	eb 42                	jmp    663 <gets+0x51>
+    cc = read(0, &c, 1);
+ 621:	83 ec 04             	sub    $0x4,%esp
+ 624:	6a 01                	push   $0x1
+ 626:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 629:	50                   	push   %eax
+ 62a:	6a 00                	push   $0x0
+ 62c:	e8 78 01 00 00       	call   7a9 <read>
+ 631:	83 c4 10             	add    $0x10,%esp
+ 634:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 637:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 63b:	7e 33                	jle    670 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 63d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 640:	8d 50 01             	lea    0x1(%eax),%edx
+ 643:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 646:	89 c2                	mov    %eax,%edx
+ 648:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64b:	01 c2                	add    %eax,%edx
+ 64d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 651:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 653:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 657:	3c 0a                	cmp    $0xa,%al
+ 659:	74 16                	je     671 <gets+0x5f>
+ 65b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 65f:	3c 0d                	cmp    $0xd,%al
+ 661:	74 0e                	je     671 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 666:	83 c0 01             	add    $0x1,%eax
+ 669:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 66c:	7f b3                	jg     621 <gets+0xf>
+ 66e:	eb 01                	jmp    671 <gets+0x5f>
+      break;
+ 670:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 671:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 674:	8b 45 08             	mov    0x8(%ebp),%eax
+ 677:	01 d0                	add    %edx,%eax
+ 679:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 67c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 67f:	c9                   	leave
+ 680:	c3                   	ret
+
+00000681 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 681:	55                   	push   %ebp
+ 682:	89 e5                	mov    %esp,%ebp
+ 684:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 687:	83 ec 08             	sub    $0x8,%esp
+ 68a:	6a 00                	push   $0x0
+ 68c:	ff 75 08             	push   0x8(%ebp)
+ 68f:	e8 3d 01 00 00       	call   7d1 <open>
+ 694:	83 c4 10             	add    $0x10,%esp
+ 697:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 69a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 69e:	79 07                	jns    6a7 <stat+0x26>
+    return -1;
+ 6a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6a5:	eb 25                	jmp    6cc <stat+0x4b>
+  r = fstat(fd, st);
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	ff 75 0c             	push   0xc(%ebp)
+ 6ad:	ff 75 f4             	push   -0xc(%ebp)
+ 6b0:	e8 34 01 00 00       	call   7e9 <fstat>
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 6bb:	83 ec 0c             	sub    $0xc,%esp
+ 6be:	ff 75 f4             	push   -0xc(%ebp)
+ 6c1:	e8 f3 00 00 00       	call   7b9 <close>
+ 6c6:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 6c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 6cc:	c9                   	leave
+ 6cd:	c3                   	ret
+
+000006ce <atoi>:
+
+int
+atoi(const char *s)
+{
+ 6ce:	55                   	push   %ebp
+ 6cf:	89 e5                	mov    %esp,%ebp
+ 6d1:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 6d4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 6db:	eb 25                	jmp    702 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 6dd:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 6e0:	89 d0                	mov    %edx,%eax
+ 6e2:	c1 e0 02             	shl    $0x2,%eax
+ 6e5:	01 d0                	add    %edx,%eax
+ 6e7:	01 c0                	add    %eax,%eax
+ 6e9:	89 c1                	mov    %eax,%ecx
+ 6eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 6f1:	89 55 08             	mov    %edx,0x8(%ebp)
+ 6f4:	0f b6 00             	movzbl (%eax),%eax
+ 6f7:	0f be c0             	movsbl %al,%eax
+ 6fa:	01 c8                	add    %ecx,%eax
+ 6fc:	83 e8 30             	sub    $0x30,%eax
+ 6ff:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 702:	8b 45 08             	mov    0x8(%ebp),%eax
+ 705:	0f b6 00             	movzbl (%eax),%eax
+ 708:	3c 2f                	cmp    $0x2f,%al
+ 70a:	7e 0a                	jle    716 <atoi+0x48>
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	0f b6 00             	movzbl (%eax),%eax
+ 712:	3c 39                	cmp    $0x39,%al
+ 714:	7e c7                	jle    6dd <atoi+0xf>
+  return n;
+ 716:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 719:	c9                   	leave
+ 71a:	c3                   	ret
+
+0000071b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 71b:	55                   	push   %ebp
+ 71c:	89 e5                	mov    %esp,%ebp
+ 71e:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 721:	8b 45 08             	mov    0x8(%ebp),%eax
+ 724:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 727:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 72a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 72d:	eb 17                	jmp    746 <memmove+0x2b>
+    *dst++ = *src++;
+ 72f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 732:	8d 42 01             	lea    0x1(%edx),%eax
+ 735:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 738:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 73e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 741:	0f b6 12             	movzbl (%edx),%edx
+ 744:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 746:	8b 45 10             	mov    0x10(%ebp),%eax
+ 749:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 74c:	89 55 10             	mov    %edx,0x10(%ebp)
+ 74f:	85 c0                	test   %eax,%eax
+ 751:	7f dc                	jg     72f <memmove+0x14>
+  return vdst;
+ 753:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 756:	c9                   	leave
+ 757:	c3                   	ret
+
+00000758 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 758:	55                   	push   %ebp
+ 759:	89 e5                	mov    %esp,%ebp
+ 75b:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 75e:	83 ec 0c             	sub    $0xc,%esp
+ 761:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 764:	50                   	push   %eax
+ 765:	e8 ff 00 00 00       	call   869 <nanouptime>
+ 76a:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 76d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 770:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 776:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 779:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 77e:	f7 e2                	mul    %edx
+ 780:	89 d0                	mov    %edx,%eax
+ 782:	c1 e8 06             	shr    $0x6,%eax
+ 785:	01 c8                	add    %ecx,%eax
+}
+ 787:	c9                   	leave
+ 788:	c3                   	ret
+
+00000789 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 789:	b8 01 00 00 00       	mov    $0x1,%eax
+ 78e:	cd 40                	int    $0x40
+ 790:	c3                   	ret
+
+00000791 <exit>:
+SYSCALL(exit)
+ 791:	b8 02 00 00 00       	mov    $0x2,%eax
+ 796:	cd 40                	int    $0x40
+ 798:	c3                   	ret
+
+00000799 <wait>:
+SYSCALL(wait)
+ 799:	b8 03 00 00 00       	mov    $0x3,%eax
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <pipe>:
+SYSCALL(pipe)
+ 7a1:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <read>:
+SYSCALL(read)
+ 7a9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <write>:
+SYSCALL(write)
+ 7b1:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <close>:
+SYSCALL(close)
+ 7b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7be:	cd 40                	int    $0x40
+ 7c0:	c3                   	ret
+
+000007c1 <kill>:
+SYSCALL(kill)
+ 7c1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
+
+000007c9 <exec>:
+SYSCALL(exec)
+ 7c9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7ce:	cd 40                	int    $0x40
+ 7d0:	c3                   	ret
+
+000007d1 <open>:
+SYSCALL(open)
+ 7d1:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7d6:	cd 40                	int    $0x40
+ 7d8:	c3                   	ret
+
+000007d9 <mknod>:
+SYSCALL(mknod)
+ 7d9:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7de:	cd 40                	int    $0x40
+ 7e0:	c3                   	ret
+
+000007e1 <unlink>:
+SYSCALL(unlink)
+ 7e1:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <fstat>:
+SYSCALL(fstat)
+ 7e9:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <link>:
+SYSCALL(link)
+ 7f1:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+000007f9 <mkdir>:
+SYSCALL(mkdir)
+ 7f9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+00000801 <chdir>:
+SYSCALL(chdir)
+ 801:	b8 09 00 00 00       	mov    $0x9,%eax
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <dup>:
+SYSCALL(dup)
+ 809:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <getpid>:
+SYSCALL(getpid)
+ 811:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <sbrk>:
+SYSCALL(sbrk)
+ 819:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <sleep>:
+SYSCALL(sleep)
+ 821:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+
+00000829 <uptime>:
+SYSCALL(uptime)
+ 829:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <saveProc>:
+SYSCALL(saveProc)
+ 831:	b8 16 00 00 00       	mov    $0x16,%eax
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+00000839 <loadProc>:
+SYSCALL(loadProc)
+ 839:	b8 17 00 00 00       	mov    $0x17,%eax
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+00000841 <setpriority>:
+SYSCALL(setpriority)
+ 841:	b8 19 00 00 00       	mov    $0x19,%eax
+ 846:	cd 40                	int    $0x40
+ 848:	c3                   	ret
+
+00000849 <setaffinity>:
+SYSCALL(setaffinity)
+ 849:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <getaffinity>:
+SYSCALL(getaffinity)
+ 851:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <nanosleep>:
+SYSCALL(nanosleep)
+ 859:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+00000861 <cpustat>:
+SYSCALL(cpustat)
+ 861:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+00000869 <nanouptime>:
+SYSCALL(nanouptime)
+ 869:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 86e:	cd 40                	int    $0x40
+ 870:	c3                   	ret
+
+00000871 <settickets>:
+SYSCALL(settickets)
+ 871:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+00000879 <setdeadline>:
+SYSCALL(setdeadline)
+ 879:	b8 20 00 00 00       	mov    $0x20,%eax
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <rtstat>:
+SYSCALL(rtstat)
+ 881:	b8 21 00 00 00       	mov    $0x21,%eax
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <schedstat>:
+SYSCALL(schedstat)
+ 889:	b8 22 00 00 00       	mov    $0x22,%eax
+ 88e:	cd 40                	int    $0x40
+ 890:	c3                   	ret
+
+00000891 <waitpid>:
+SYSCALL(waitpid)
+ 891:	b8 23 00 00 00       	mov    $0x23,%eax
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+00000899 <clone>:
+SYSCALL(clone)
+ 899:	b8 24 00 00 00       	mov    $0x24,%eax
+ 89e:	cd 40                	int    $0x40
+ 8a0:	c3                   	ret
+
+000008a1 <futexwait>:
+SYSCALL(futexwait)
+ 8a1:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8a6:	cd 40                	int    $0x40
+ 8a8:	c3                   	ret
+
+000008a9 <futexwake>:
+SYSCALL(futexwake)
+ 8a9:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8ae:	cd 40                	int    $0x40
+ 8b0:	c3                   	ret
+
+000008b1 <lockstat>:
+SYSCALL(lockstat)
+ 8b1:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <dcachestat>:
+SYSCALL(dcachestat)
+ 8b9:	b8 28 00 00 00       	mov    $0x28,%eax
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8c1:	55                   	push   %ebp
+ 8c2:	89 e5                	mov    %esp,%ebp
+ 8c4:	83 ec 18             	sub    $0x18,%esp
+ 8c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ca:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8cd:	83 ec 04             	sub    $0x4,%esp
+ 8d0:	6a 01                	push   $0x1
+ 8d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8d5:	50                   	push   %eax
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 d3 fe ff ff       	call   7b1 <write>
+ 8de:	83 c4 10             	add    $0x10,%esp
+}
+ 8e1:	90                   	nop
+ 8e2:	c9                   	leave
+ 8e3:	c3                   	ret
+
+000008e4 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8e4:	55                   	push   %ebp
+ 8e5:	89 e5                	mov    %esp,%ebp
+ 8e7:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8ea:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8f1:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8f5:	74 17                	je     90e <printint+0x2a>
+ 8f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8fb:	79 11                	jns    90e <printint+0x2a>
+    neg = 1;
+ 8fd:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 904:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 907:	f7 d8                	neg    %eax
+ 909:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 90c:	eb 06                	jmp    914 <printint+0x30>
+  } else {
+    x = xx;
+ 90e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 911:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 914:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 91b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 91e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 921:	ba 00 00 00 00       	mov    $0x0,%edx
+ 926:	f7 f1                	div    %ecx
+ 928:	89 d1                	mov    %edx,%ecx
+ 92a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 92d:	8d 50 01             	lea    0x1(%eax),%edx
+ 930:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 933:	0f b6 91 10 0f 00 00 	movzbl 0xf10(%ecx),%edx
+ 93a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 93e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 941:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 944:	ba 00 00 00 00       	mov    $0x0,%edx
+ 949:	f7 f1                	div    %ecx
+ 94b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 94e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 952:	75 c7                	jne    91b <printint+0x37>
+  if(neg)
+ 954:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 958:	74 2d                	je     987 <printint+0xa3>
+    buf[i++] = '-';
+ 95a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 95d:	8d 50 01             	lea    0x1(%eax),%edx
+ 960:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 963:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 968:	eb 1d                	jmp    987 <printint+0xa3>
+    putc(fd, buf[i]);
+ 96a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 96d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 970:	01 d0                	add    %edx,%eax
+ 972:	0f b6 00             	movzbl (%eax),%eax
+ 975:	0f be c0             	movsbl %al,%eax
+ 978:	83 ec 08             	sub    $0x8,%esp
+ 97b:	50                   	push   %eax
+ 97c:	ff 75 08             	push   0x8(%ebp)
+ 97f:	e8 3d ff ff ff       	call   8c1 <putc>
+ 984:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 987:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 98b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 98f:	79 d9                	jns    96a <printint+0x86>
+}
+ 991:	90                   	nop
+ 992:	90                   	nop
+ 993:	c9                   	leave
+ 994:	c3                   	ret
+
+00000995 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 995:	55                   	push   %ebp
+ 996:	89 e5                	mov    %esp,%ebp
+ 998:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 99b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9a5:	83 c0 04             	add    $0x4,%eax
+ 9a8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9ab:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9b2:	e9 59 01 00 00       	jmp    b10 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 9b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9ba:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9bd:	01 d0                	add    %edx,%eax
+ 9bf:	0f b6 00             	movzbl (%eax),%eax
+ 9c2:	0f be c0             	movsbl %al,%eax
+ 9c5:	25 ff 00 00 00       	and    $0xff,%eax
+ 9ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9cd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9d1:	75 2c                	jne    9ff <printf+0x6a>
+      if(c == '%'){
+ 9d3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9d7:	75 0c                	jne    9e5 <printf+0x50>
+        state = '%';
+ 9d9:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9e0:	e9 27 01 00 00       	jmp    b0c <printf+0x177>
+      } else {
+        putc(fd, c);
+ 9e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9e8:	0f be c0             	movsbl %al,%eax
+ 9eb:	83 ec 08             	sub    $0x8,%esp
+ 9ee:	50                   	push   %eax
+ 9ef:	ff 75 08             	push   0x8(%ebp)
+ 9f2:	e8 ca fe ff ff       	call   8c1 <putc>
+ 9f7:	83 c4 10             	add    $0x10,%esp
+ 9fa:	e9 0d 01 00 00       	jmp    b0c <printf+0x177>
+      }
+    } else if(state == '%'){
+ 9ff:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a03:	0f 85 03 01 00 00    	jne    b0c <printf+0x177>
+      if(c == 'd'){
+ a09:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a0d:	75 1e                	jne    a2d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a0f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a12:	8b 00                	mov    (%eax),%eax
+ a14:	6a 01                	push   $0x1
+ a16:	6a 0a                	push   $0xa
+ a18:	50                   	push   %eax
+ a19:	ff 75 08             	push   0x8(%ebp)
+ a1c:	e8 c3 fe ff ff       	call   8e4 <printint>
+ a21:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a24:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a28:	e9 d8 00 00 00       	jmp    b05 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a2d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a31:	74 06                	je     a39 <printf+0xa4>
+ a33:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a37:	75 1e                	jne    a57 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a39:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a3c:	8b 00                	mov    (%eax),%eax
+ a3e:	6a 00                	push   $0x0
+ a40:	6a 10                	push   $0x10
+ a42:	50                   	push   %eax
+ a43:	ff 75 08             	push   0x8(%ebp)
+ a46:	e8 99 fe ff ff       	call   8e4 <printint>
+ a4b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a4e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a52:	e9 ae 00 00 00       	jmp    b05 <printf+0x170>
+      } else if(c == 's'){
+ a57:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a5b:	75 43                	jne    aa0 <printf+0x10b>
+        s = (char*)*ap;
+ a5d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a60:	8b 00                	mov    (%eax),%eax
+ a62:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a65:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a69:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a6d:	75 25                	jne    a94 <printf+0xff>
+          s = "(null)";
+ a6f:	c7 45 f4 87 0c 00 00 	movl   $0xc87,-0xc(%ebp)
+        while(*s != 0){
+ a76:	eb 1c                	jmp    a94 <printf+0xff>
+          putc(fd, *s);
+ a78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7b:	0f b6 00             	movzbl (%eax),%eax
+ a7e:	0f be c0             	movsbl %al,%eax
+ a81:	83 ec 08             	sub    $0x8,%esp
+ a84:	50                   	push   %eax
+ a85:	ff 75 08             	push   0x8(%ebp)
+ a88:	e8 34 fe ff ff       	call   8c1 <putc>
+ a8d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a90:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a97:	0f b6 00             	movzbl (%eax),%eax
+ a9a:	84 c0                	test   %al,%al
+ a9c:	75 da                	jne    a78 <printf+0xe3>
+ a9e:	eb 65                	jmp    b05 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ aa0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ aa4:	75 1d                	jne    ac3 <printf+0x12e>
+        putc(fd, *ap);
+ aa6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ aa9:	8b 00                	mov    (%eax),%eax
+ aab:	0f be c0             	movsbl %al,%eax
+ aae:	83 ec 08             	sub    $0x8,%esp
+ ab1:	50                   	push   %eax
+ ab2:	ff 75 08             	push   0x8(%ebp)
+ ab5:	e8 07 fe ff ff       	call   8c1 <putc>
+ aba:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ abd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ac1:	eb 42                	jmp    b05 <printf+0x170>
+      } else if(c == '%'){
+ ac3:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ ac7:	75 17                	jne    ae0 <printf+0x14b>
+        putc(fd, c);
+ ac9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ acc:	0f be c0             	movsbl %al,%eax
+ acf:	83 ec 08             	sub    $0x8,%esp
+ ad2:	50                   	push   %eax
+ ad3:	ff 75 08             	push   0x8(%ebp)
+ ad6:	e8 e6 fd ff ff       	call   8c1 <putc>
+ adb:	83 c4 10             	add    $0x10,%esp
+ ade:	eb 25                	jmp    b05 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ae0:	83 ec 08             	sub    $0x8,%esp
+ ae3:	6a 25                	push   $0x25
+ ae5:	ff 75 08             	push   0x8(%ebp)
+ ae8:	e8 d4 fd ff ff       	call   8c1 <putc>
+ aed:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ af0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ af3:	0f be c0             	movsbl %al,%eax
+ af6:	83 ec 08             	sub    $0x8,%esp
+ af9:	50                   	push   %eax
+ afa:	ff 75 08             	push   0x8(%ebp)
+ afd:	e8 bf fd ff ff       	call   8c1 <putc>
+ b02:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b05:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b0c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b10:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b13:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b16:	01 d0                	add    %edx,%eax
+ b18:	0f b6 00             	movzbl (%eax),%eax
+ b1b:	84 c0                	test   %al,%al
+ b1d:	0f 85 94 fe ff ff    	jne    9b7 <printf+0x22>
+    }
+  }
+}
+ b23:	90                   	nop
+ b24:	90                   	nop
+ b25:	c9                   	leave
+ b26:	c3                   	ret
@@ -0,0 +1,139 @@
+// Test the directory entry cache: a deep path must resolve to
+// whatever its directories hold as names are unlinked and made
+// again, and repeated opens of it should be served from the
+// cache.  Reports the time per open of a path DEPTH directories
+// down.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "dcachestat.h"
+
+#define DEPTH 8
+#define NOPEN 1000
+
+static char path[3 * DEPTH + 8];
+
+// Make path the file at depth n below dc, or with f 0 the
+// directory there.
+static void
+mkpath(int n, int f)
+{
+  int i;
+
+  strcpy(path, "dc");
+  for(i = 0; i < n; i++)
+    strcpy(path + strlen(path), "/d");
+  if(f)
+    strcpy(path + strlen(path), "/f");
+}
+
+static void
+fail(char *what)
+{
+  printf(1, "dcachetest: %s\n", what);
+  printf(1, "dcachetest failed\n");
+  exit();
+}
+
+// Create the file at the bottom with content c.
+static void
+writef(char c)
+{
+  int fd;
+
+  mkpath(DEPTH, 1);
+  if((fd = open(path, O_CREATE | O_RDWR)) < 0)
+    fail("cannot create file");
+  write(fd, &c, 1);
+  close(fd);
+}
+
+// Check that the file at the bottom holds c.
+static void
+readf(char c)
+{
+  char got;
+  int fd;
+
+  mkpath(DEPTH, 1);
+  if((fd = open(path, O_RDONLY)) < 0)
+    fail("cannot open file");
+  if(read(fd, &got, 1) != 1 || got != c)
+    fail("stale file");
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct dcachestat a, b;
+  uint t0, t1;
+  int i, fd;
+
+  printf(1, "dcachetest\n");
+
+  for(i = 0; i <= DEPTH; i++){
+    mkpath(i, 0);
+    if(mkdir(path) < 0)
+      fail("mkdir failed");
+  }
+  writef('a');
+  readf('a');
+
+  // Every element of a warm path is a hit.
+  dcachestat(&a);
+  readf('a');
+  dcachestat(&b);
+  if(b.hits - a.hits < DEPTH + 2 || b.misses != a.misses)
+    fail("warm path not served from cache");
+
+  // A cached name must go with its unlink.
+  mkpath(DEPTH, 1);
+  if(unlink(path) < 0)
+    fail("unlink failed");
+  dcachestat(&a);
+  if(open(path, O_RDONLY) >= 0)
+    fail("unlinked file still opens");
+  dcachestat(&b);
+  if(b.misses == a.misses)
+    fail("unlinked name still cached");
+  writef('b');
+  readf('b');
+
+  t0 = uptimeus();
+  for(i = 0; i < NOPEN; i++){
+    if((fd = open(path, O_RDONLY)) < 0)
+      fail("open failed");
+    close(fd);
+  }
+  t1 = uptimeus();
+  printf(1, "dcachetest: %d opens at depth %d, %dus each\n",
+         NOPEN, DEPTH, (t1 - t0) / NOPEN);
+
+  // Tear the tree down and build it again, so that the
+  // directories' inodes are freed and reused.
+  for(i = DEPTH + 1; i >= 0; i--){
+    mkpath(i > DEPTH ? DEPTH : i, i > DEPTH);
+    if(unlink(path) < 0)
+      fail("cannot remove tree");
+  }
+  mkpath(DEPTH, 1);
+  if(open(path, O_RDONLY) >= 0)
+    fail("removed file still opens");
+  for(i = 0; i <= DEPTH; i++){
+    mkpath(i, 0);
+    if(mkdir(path) < 0)
+      fail("mkdir again failed");
+  }
+  writef('c');
+  readf('c');
+
+  for(i = DEPTH + 1; i >= 0; i--){
+    mkpath(i > DEPTH ? DEPTH : i, i > DEPTH);
+    unlink(path);
+  }
+  printf(1, "dcachetest ok\n");
+  exit();
+}
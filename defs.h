@@ -1,13 +1,22 @@
 struct buf;
+struct cpustat;
 struct context;
+struct dcachestat;
+struct fdtable;
 struct file;
 struct inode;
+struct lockstat;
 struct pipe;
 struct proc;
+struct rtstat;
+struct schedstat;
 struct rtcdate;
+struct sleeplock;
 struct spinlock;
 struct stat;
 struct superblock;
+struct timespec;
+struct vmspace;
 
 // bio.c
 void            binit(void);
@@ -15,6 +24,17 @@ struct buf*     bread(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
 
+// clock.c
+void            clockinit(void);
+int             clockintr(void);
+void            clocksyncap(void);
+void            clocksyncbsp(void);
+uint64          nanotime(void);
+void            nanouptime(struct timespec*);
+int             timedsleep(uint);
+uint64          tsctons(uint64);
+uint            div64(uint64, uint, uint*);
+
 // console.c
 void            consoleinit(void);
 void            cprintf(char*, ...);
@@ -25,6 +45,10 @@ void            panic(char*) __attribute__((noreturn));
 int             exec(char*, char**);
 
 // file.c
+struct fdtable* fdtablealloc(void);
+struct fdtable* fdtablecopy(struct fdtable*);
+struct fdtable* fdtabledup(struct fdtable*);
+void            fdtableput(struct fdtable*);
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
@@ -33,16 +57,25 @@ int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
 
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
+
 // fs.c
 void            readsb(int dev, struct superblock *sb);
+void            dcacheremove(struct inode*, char*);
+void            getdcachestat(struct dcachestat*);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
+void            iunlockshared(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
@@ -64,9 +97,14 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kallocpages(int);
+char*           kalloc_zeroed(void);
 void            kfree(char*);
+void            kfreepages(char*, int);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+int             kpageorder(char*);
+int             kzerofill(void);
 
 // kbd.c
 void            kbdintr(void);
@@ -77,6 +115,9 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+uint            lapiccalibrate(void);
+void            lapicipi(uchar, int);
+void            lapiconeshot(uint);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -104,20 +145,34 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(uint, uint, uint);
 struct proc*    copyproc(struct proc*);
 void            exit(void);
 int             fork(void);
+int             getaffinity(int);
+int             getcpustat(int, struct cpustat*);
+int             getrtstat(int, struct rtstat*);
+int             getschedstat(int, struct schedstat*);
 int             myFork(struct file *page_file, struct file *flag_file, struct proc *savedProc);
 int             growproc(int);
+void            putvm(pde_t*, struct vmspace*);
 int             kill(int);
 void            pinit(void);
 void            procdump(void);
+void            schedclock(void);
+int             setaffinity(int, uint);
+int             setdeadline(int, int, int);
+int             setpriority(int, int);
+int             settickets(int, int);
+int             timeslice(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
+int             waitpid(int, int);
 void            wakeup(void*);
+int             wakeupn(void*, int);
 void            yield(void);
 void            aquirePtableLock();
 void            releasePtableLock();
@@ -126,11 +181,31 @@ void            myExit(struct proc*);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// rcu.c
+void            rcureadlock(void);
+void            rcureadunlock(void);
+void            synchronizercu(void);
+
+// slab.c
+void            kminit(void);
+void*           kmalloc(uint);
+void            kmfree(void*);
+
+// sleeplock.c
+void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+int             holdingsleep(struct sleeplock*);
+void            initsleeplock(struct sleeplock*, char*);
+void            releasesleep(struct sleeplock*);
+void            releasesleepshared(struct sleeplock*);
+int             sleeplocked(struct sleeplock*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+int             getlockstat(struct lockstat*, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -0,0 +1,585 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 03 04 00 00       	mov    $0x403,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 05 04 00 00       	mov    $0x405,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 07 04 00 00       	push   $0x407
+  4b:	6a 01                	push   $0x1
+  4d:	e8 1f 02 00 00       	call   271 <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 08 00 00 00       	call   6d <exit>
+
+00000065 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  65:	b8 01 00 00 00       	mov    $0x1,%eax
+  6a:	cd 40                	int    $0x40
+  6c:	c3                   	ret
+
+0000006d <exit>:
+SYSCALL(exit)
+  6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  72:	cd 40                	int    $0x40
+  74:	c3                   	ret
+
+00000075 <wait>:
+SYSCALL(wait)
+  75:	b8 03 00 00 00       	mov    $0x3,%eax
+  7a:	cd 40                	int    $0x40
+  7c:	c3                   	ret
+
+0000007d <pipe>:
+SYSCALL(pipe)
+  7d:	b8 04 00 00 00       	mov    $0x4,%eax
+  82:	cd 40                	int    $0x40
+  84:	c3                   	ret
+
+00000085 <read>:
+SYSCALL(read)
+  85:	b8 05 00 00 00       	mov    $0x5,%eax
+  8a:	cd 40                	int    $0x40
+  8c:	c3                   	ret
+
+0000008d <write>:
+SYSCALL(write)
+  8d:	b8 10 00 00 00       	mov    $0x10,%eax
+  92:	cd 40                	int    $0x40
+  94:	c3                   	ret
+
+00000095 <close>:
+SYSCALL(close)
+  95:	b8 15 00 00 00       	mov    $0x15,%eax
+  9a:	cd 40                	int    $0x40
+  9c:	c3                   	ret
+
+0000009d <kill>:
+SYSCALL(kill)
+  9d:	b8 06 00 00 00       	mov    $0x6,%eax
+  a2:	cd 40                	int    $0x40
+  a4:	c3                   	ret
+
+000000a5 <exec>:
+SYSCALL(exec)
+  a5:	b8 07 00 00 00       	mov    $0x7,%eax
+  aa:	cd 40                	int    $0x40
+  ac:	c3                   	ret
+
+000000ad <open>:
+SYSCALL(open)
+  ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+  b2:	cd 40                	int    $0x40
+  b4:	c3                   	ret
+
+000000b5 <mknod>:
+SYSCALL(mknod)
+  b5:	b8 11 00 00 00       	mov    $0x11,%eax
+  ba:	cd 40                	int    $0x40
+  bc:	c3                   	ret
+
+000000bd <unlink>:
+SYSCALL(unlink)
+  bd:	b8 12 00 00 00       	mov    $0x12,%eax
+  c2:	cd 40                	int    $0x40
+  c4:	c3                   	ret
+
+000000c5 <fstat>:
+SYSCALL(fstat)
+  c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  ca:	cd 40                	int    $0x40
+  cc:	c3                   	ret
+
+000000cd <link>:
+SYSCALL(link)
+  cd:	b8 13 00 00 00       	mov    $0x13,%eax
+  d2:	cd 40                	int    $0x40
+  d4:	c3                   	ret
+
+000000d5 <mkdir>:
+SYSCALL(mkdir)
+  d5:	b8 14 00 00 00       	mov    $0x14,%eax
+  da:	cd 40                	int    $0x40
+  dc:	c3                   	ret
+
+000000dd <chdir>:
+SYSCALL(chdir)
+  dd:	b8 09 00 00 00       	mov    $0x9,%eax
+  e2:	cd 40                	int    $0x40
+  e4:	c3                   	ret
+
+000000e5 <dup>:
+SYSCALL(dup)
+  e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  ea:	cd 40                	int    $0x40
+  ec:	c3                   	ret
+
+000000ed <getpid>:
+SYSCALL(getpid)
+  ed:	b8 0b 00 00 00       	mov    $0xb,%eax
+  f2:	cd 40                	int    $0x40
+  f4:	c3                   	ret
+
+000000f5 <sbrk>:
+SYSCALL(sbrk)
+  f5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  fa:	cd 40                	int    $0x40
+  fc:	c3                   	ret
+
+000000fd <sleep>:
+SYSCALL(sleep)
+  fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 102:	cd 40                	int    $0x40
+ 104:	c3                   	ret
+
+00000105 <uptime>:
+SYSCALL(uptime)
+ 105:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 10a:	cd 40                	int    $0x40
+ 10c:	c3                   	ret
+
+0000010d <saveProc>:
+SYSCALL(saveProc)
+ 10d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 112:	cd 40                	int    $0x40
+ 114:	c3                   	ret
+
+00000115 <loadProc>:
+SYSCALL(loadProc)
+ 115:	b8 17 00 00 00       	mov    $0x17,%eax
+ 11a:	cd 40                	int    $0x40
+ 11c:	c3                   	ret
+
+0000011d <setpriority>:
+SYSCALL(setpriority)
+ 11d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 122:	cd 40                	int    $0x40
+ 124:	c3                   	ret
+
+00000125 <setaffinity>:
+SYSCALL(setaffinity)
+ 125:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 12a:	cd 40                	int    $0x40
+ 12c:	c3                   	ret
+
+0000012d <getaffinity>:
+SYSCALL(getaffinity)
+ 12d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 132:	cd 40                	int    $0x40
+ 134:	c3                   	ret
+
+00000135 <nanosleep>:
+SYSCALL(nanosleep)
+ 135:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 13a:	cd 40                	int    $0x40
+ 13c:	c3                   	ret
+
+0000013d <cpustat>:
+SYSCALL(cpustat)
+ 13d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 142:	cd 40                	int    $0x40
+ 144:	c3                   	ret
+
+00000145 <nanouptime>:
+SYSCALL(nanouptime)
+ 145:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 14a:	cd 40                	int    $0x40
+ 14c:	c3                   	ret
+
+0000014d <settickets>:
+SYSCALL(settickets)
+ 14d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 152:	cd 40                	int    $0x40
+ 154:	c3                   	ret
+
+00000155 <setdeadline>:
+SYSCALL(setdeadline)
+ 155:	b8 20 00 00 00       	mov    $0x20,%eax
+ 15a:	cd 40                	int    $0x40
+ 15c:	c3                   	ret
+
+0000015d <rtstat>:
+SYSCALL(rtstat)
+ 15d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 162:	cd 40                	int    $0x40
+ 164:	c3                   	ret
+
+00000165 <schedstat>:
+SYSCALL(schedstat)
+ 165:	b8 22 00 00 00       	mov    $0x22,%eax
+ 16a:	cd 40                	int    $0x40
+ 16c:	c3                   	ret
+
+0000016d <waitpid>:
+SYSCALL(waitpid)
+ 16d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 172:	cd 40                	int    $0x40
+ 174:	c3                   	ret
+
+00000175 <clone>:
+SYSCALL(clone)
+ 175:	b8 24 00 00 00       	mov    $0x24,%eax
+ 17a:	cd 40                	int    $0x40
+ 17c:	c3                   	ret
+
+0000017d <futexwait>:
+SYSCALL(futexwait)
+ 17d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 182:	cd 40                	int    $0x40
+ 184:	c3                   	ret
+
+00000185 <futexwake>:
+SYSCALL(futexwake)
+ 185:	b8 26 00 00 00       	mov    $0x26,%eax
+ 18a:	cd 40                	int    $0x40
+ 18c:	c3                   	ret
+
+0000018d <lockstat>:
+SYSCALL(lockstat)
+ 18d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 192:	cd 40                	int    $0x40
+ 194:	c3                   	ret
+
+00000195 <dcachestat>:
+SYSCALL(dcachestat)
+ 195:	b8 28 00 00 00       	mov    $0x28,%eax
+ 19a:	cd 40                	int    $0x40
+ 19c:	c3                   	ret
+
+0000019d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 19d:	55                   	push   %ebp
+ 19e:	89 e5                	mov    %esp,%ebp
+ 1a0:	83 ec 18             	sub    $0x18,%esp
+ 1a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a6:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1a9:	83 ec 04             	sub    $0x4,%esp
+ 1ac:	6a 01                	push   $0x1
+ 1ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 1b1:	50                   	push   %eax
+ 1b2:	ff 75 08             	push   0x8(%ebp)
+ 1b5:	e8 d3 fe ff ff       	call   8d <write>
+ 1ba:	83 c4 10             	add    $0x10,%esp
+}
+ 1bd:	90                   	nop
+ 1be:	c9                   	leave
+ 1bf:	c3                   	ret
+
+000001c0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1c6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 1cd:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 1d1:	74 17                	je     1ea <printint+0x2a>
+ 1d3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 1d7:	79 11                	jns    1ea <printint+0x2a>
+    neg = 1;
+ 1d9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 1e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e3:	f7 d8                	neg    %eax
+ 1e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 1e8:	eb 06                	jmp    1f0 <printint+0x30>
+  } else {
+    x = xx;
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 1f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 1f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1fa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1fd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 202:	f7 f1                	div    %ecx
+ 204:	89 d1                	mov    %edx,%ecx
+ 206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 209:	8d 50 01             	lea    0x1(%eax),%edx
+ 20c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 20f:	0f b6 91 b4 04 00 00 	movzbl 0x4b4(%ecx),%edx
+ 216:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 21a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 220:	ba 00 00 00 00       	mov    $0x0,%edx
+ 225:	f7 f1                	div    %ecx
+ 227:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 22a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 22e:	75 c7                	jne    1f7 <printint+0x37>
+  if(neg)
+ 230:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 234:	74 2d                	je     263 <printint+0xa3>
+    buf[i++] = '-';
+ 236:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 239:	8d 50 01             	lea    0x1(%eax),%edx
+ 23c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 244:	eb 1d                	jmp    263 <printint+0xa3>
+    putc(fd, buf[i]);
+ 246:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 249:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 24c:	01 d0                	add    %edx,%eax
+ 24e:	0f b6 00             	movzbl (%eax),%eax
+ 251:	0f be c0             	movsbl %al,%eax
+ 254:	83 ec 08             	sub    $0x8,%esp
+ 257:	50                   	push   %eax
+ 258:	ff 75 08             	push   0x8(%ebp)
+ 25b:	e8 3d ff ff ff       	call   19d <putc>
+ 260:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 263:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 267:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 26b:	79 d9                	jns    246 <printint+0x86>
+}
+ 26d:	90                   	nop
+ 26e:	90                   	nop
+ 26f:	c9                   	leave
+ 270:	c3                   	ret
+
+00000271 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 271:	55                   	push   %ebp
+ 272:	89 e5                	mov    %esp,%ebp
+ 274:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 277:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 27e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 281:	83 c0 04             	add    $0x4,%eax
+ 284:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 287:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 28e:	e9 59 01 00 00       	jmp    3ec <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 293:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 296:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 299:	01 d0                	add    %edx,%eax
+ 29b:	0f b6 00             	movzbl (%eax),%eax
+ 29e:	0f be c0             	movsbl %al,%eax
+ 2a1:	25 ff 00 00 00       	and    $0xff,%eax
+ 2a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 2a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2ad:	75 2c                	jne    2db <printf+0x6a>
+      if(c == '%'){
+ 2af:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 2b3:	75 0c                	jne    2c1 <printf+0x50>
+        state = '%';
+ 2b5:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 2bc:	e9 27 01 00 00       	jmp    3e8 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 2c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2c4:	0f be c0             	movsbl %al,%eax
+ 2c7:	83 ec 08             	sub    $0x8,%esp
+ 2ca:	50                   	push   %eax
+ 2cb:	ff 75 08             	push   0x8(%ebp)
+ 2ce:	e8 ca fe ff ff       	call   19d <putc>
+ 2d3:	83 c4 10             	add    $0x10,%esp
+ 2d6:	e9 0d 01 00 00       	jmp    3e8 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 2db:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 2df:	0f 85 03 01 00 00    	jne    3e8 <printf+0x177>
+      if(c == 'd'){
+ 2e5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 2e9:	75 1e                	jne    309 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 2eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2ee:	8b 00                	mov    (%eax),%eax
+ 2f0:	6a 01                	push   $0x1
+ 2f2:	6a 0a                	push   $0xa
+ 2f4:	50                   	push   %eax
+ 2f5:	ff 75 08             	push   0x8(%ebp)
+ 2f8:	e8 c3 fe ff ff       	call   1c0 <printint>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 300:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 304:	e9 d8 00 00 00       	jmp    3e1 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 309:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 30d:	74 06                	je     315 <printf+0xa4>
+ 30f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 313:	75 1e                	jne    333 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 315:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 318:	8b 00                	mov    (%eax),%eax
+ 31a:	6a 00                	push   $0x0
+ 31c:	6a 10                	push   $0x10
+ 31e:	50                   	push   %eax
+ 31f:	ff 75 08             	push   0x8(%ebp)
+ 322:	e8 99 fe ff ff       	call   1c0 <printint>
+ 327:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 32a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 32e:	e9 ae 00 00 00       	jmp    3e1 <printf+0x170>
+      } else if(c == 's'){
+ 333:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 337:	75 43                	jne    37c <printf+0x10b>
+        s = (char*)*ap;
+ 339:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 33c:	8b 00                	mov    (%eax),%eax
+ 33e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 341:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 345:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 349:	75 25                	jne    370 <printf+0xff>
+          s = "(null)";
+ 34b:	c7 45 f4 0c 04 00 00 	movl   $0x40c,-0xc(%ebp)
+        while(*s != 0){
+ 352:	eb 1c                	jmp    370 <printf+0xff>
+          putc(fd, *s);
+ 354:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 357:	0f b6 00             	movzbl (%eax),%eax
+ 35a:	0f be c0             	movsbl %al,%eax
+ 35d:	83 ec 08             	sub    $0x8,%esp
+ 360:	50                   	push   %eax
+ 361:	ff 75 08             	push   0x8(%ebp)
+ 364:	e8 34 fe ff ff       	call   19d <putc>
+ 369:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 36c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 370:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 373:	0f b6 00             	movzbl (%eax),%eax
+ 376:	84 c0                	test   %al,%al
+ 378:	75 da                	jne    354 <printf+0xe3>
+ 37a:	eb 65                	jmp    3e1 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 37c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 380:	75 1d                	jne    39f <printf+0x12e>
+        putc(fd, *ap);
+ 382:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 385:	8b 00                	mov    (%eax),%eax
+ 387:	0f be c0             	movsbl %al,%eax
+ 38a:	83 ec 08             	sub    $0x8,%esp
+ 38d:	50                   	push   %eax
+ 38e:	ff 75 08             	push   0x8(%ebp)
+ 391:	e8 07 fe ff ff       	call   19d <putc>
+ 396:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 399:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 39d:	eb 42                	jmp    3e1 <printf+0x170>
+      } else if(c == '%'){
+ 39f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 3a3:	75 17                	jne    3bc <printf+0x14b>
+        putc(fd, c);
+ 3a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3a8:	0f be c0             	movsbl %al,%eax
+ 3ab:	83 ec 08             	sub    $0x8,%esp
+ 3ae:	50                   	push   %eax
+ 3af:	ff 75 08             	push   0x8(%ebp)
+ 3b2:	e8 e6 fd ff ff       	call   19d <putc>
+ 3b7:	83 c4 10             	add    $0x10,%esp
+ 3ba:	eb 25                	jmp    3e1 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3bc:	83 ec 08             	sub    $0x8,%esp
+ 3bf:	6a 25                	push   $0x25
+ 3c1:	ff 75 08             	push   0x8(%ebp)
+ 3c4:	e8 d4 fd ff ff       	call   19d <putc>
+ 3c9:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 3cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3cf:	0f be c0             	movsbl %al,%eax
+ 3d2:	83 ec 08             	sub    $0x8,%esp
+ 3d5:	50                   	push   %eax
+ 3d6:	ff 75 08             	push   0x8(%ebp)
+ 3d9:	e8 bf fd ff ff       	call   19d <putc>
+ 3de:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 3e1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 3e8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 3ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3f2:	01 d0                	add    %edx,%eax
+ 3f4:	0f b6 00             	movzbl (%eax),%eax
+ 3f7:	84 c0                	test   %al,%al
+ 3f9:	0f 85 94 fe ff ff    	jne    293 <printf+0x22>
+    }
+  }
+}
+ 3ff:	90                   	nop
+ 400:	90                   	nop
+ 401:	c9                   	leave
+ 402:	c3                   	ret
@@ -0,0 +1,1266 @@
+
+_edftest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <periodic>:
+#define PERIOD   10    // ticks
+#define WORK     4000  // microseconds of work per period
+
+static void
+periodic(int out)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  struct rtstat st;
+  uint start, t0;
+  int i, mask;
+
+  if(setdeadline(getpid(), RUNTIME, PERIOD) < 0){
+   6:	e8 da 05 00 00       	call   5e5 <getpid>
+   b:	83 ec 04             	sub    $0x4,%esp
+   e:	6a 0a                	push   $0xa
+  10:	6a 03                	push   $0x3
+  12:	50                   	push   %eax
+  13:	e8 35 06 00 00       	call   64d <setdeadline>
+  18:	83 c4 10             	add    $0x10,%esp
+  1b:	85 c0                	test   %eax,%eax
+  1d:	79 18                	jns    37 <periodic+0x37>
+    printf(1, "edftest: %d/%d not admitted\n", RUNTIME, PERIOD);
+  1f:	6a 0a                	push   $0xa
+  21:	6a 03                	push   $0x3
+  23:	68 fc 08 00 00       	push   $0x8fc
+  28:	6a 01                	push   $0x1
+  2a:	e8 3a 07 00 00       	call   769 <printf>
+  2f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  32:	e8 2e 05 00 00       	call   565 <exit>
+  }
+  mask = getaffinity(getpid());
+  37:	e8 a9 05 00 00       	call   5e5 <getpid>
+  3c:	83 ec 0c             	sub    $0xc,%esp
+  3f:	50                   	push   %eax
+  40:	e8 e0 05 00 00       	call   625 <getaffinity>
+  45:	83 c4 10             	add    $0x10,%esp
+  48:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  write(out, &mask, sizeof(mask));
+  4b:	83 ec 04             	sub    $0x4,%esp
+  4e:	6a 04                	push   $0x4
+  50:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  53:	50                   	push   %eax
+  54:	ff 75 08             	push   0x8(%ebp)
+  57:	e8 29 05 00 00       	call   585 <write>
+  5c:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NPERIOD; i++){
+  5f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  66:	eb 4c                	jmp    b4 <periodic+0xb4>
+    start = uptime();
+  68:	e8 90 05 00 00       	call   5fd <uptime>
+  6d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    t0 = uptimeus();
+  70:	e8 b7 04 00 00       	call   52c <uptimeus>
+  75:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    while(uptimeus() - t0 < WORK)
+  78:	90                   	nop
+  79:	e8 ae 04 00 00       	call   52c <uptimeus>
+  7e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+  81:	3d 9f 0f 00 00       	cmp    $0xf9f,%eax
+  86:	76 f1                	jbe    79 <periodic+0x79>
+      ;
+    if(uptime() - start < PERIOD)
+  88:	e8 70 05 00 00       	call   5fd <uptime>
+  8d:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  90:	83 f8 09             	cmp    $0x9,%eax
+  93:	77 1b                	ja     b0 <periodic+0xb0>
+      sleep(PERIOD - (uptime() - start));
+  95:	e8 63 05 00 00       	call   5fd <uptime>
+  9a:	89 c2                	mov    %eax,%edx
+  9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  9f:	29 d0                	sub    %edx,%eax
+  a1:	83 c0 0a             	add    $0xa,%eax
+  a4:	83 ec 0c             	sub    $0xc,%esp
+  a7:	50                   	push   %eax
+  a8:	e8 48 05 00 00       	call   5f5 <sleep>
+  ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPERIOD; i++){
+  b0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  b4:	83 7d f4 1d          	cmpl   $0x1d,-0xc(%ebp)
+  b8:	7e ae                	jle    68 <periodic+0x68>
+  }
+  rtstat(getpid(), &st);
+  ba:	e8 26 05 00 00       	call   5e5 <getpid>
+  bf:	83 ec 08             	sub    $0x8,%esp
+  c2:	8d 55 dc             	lea    -0x24(%ebp),%edx
+  c5:	52                   	push   %edx
+  c6:	50                   	push   %eax
+  c7:	e8 89 05 00 00       	call   655 <rtstat>
+  cc:	83 c4 10             	add    $0x10,%esp
+  write(out, &st, sizeof(st));
+  cf:	83 ec 04             	sub    $0x4,%esp
+  d2:	6a 10                	push   $0x10
+  d4:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  d7:	50                   	push   %eax
+  d8:	ff 75 08             	push   0x8(%ebp)
+  db:	e8 a5 04 00 00       	call   585 <write>
+  e0:	83 c4 10             	add    $0x10,%esp
+  exit();
+  e3:	e8 7d 04 00 00       	call   565 <exit>
+
+000000e8 <main>:
+}
+
+int
+main(int argc, char *argv[])
+{
+  e8:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  ec:	83 e4 f0             	and    $0xfffffff0,%esp
+  ef:	ff 71 fc             	push   -0x4(%ecx)
+  f2:	55                   	push   %ebp
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	51                   	push   %ecx
+  f7:	83 ec 30             	sub    $0x30,%esp
+  struct rtstat st;
+  int fd[2], hog[NHOG], i, n, mask;
+
+  printf(1, "edftest\n");
+  fa:	83 ec 08             	sub    $0x8,%esp
+  fd:	68 19 09 00 00       	push   $0x919
+ 102:	6a 01                	push   $0x1
+ 104:	e8 60 06 00 00       	call   769 <printf>
+ 109:	83 c4 10             	add    $0x10,%esp
+
+  if(setdeadline(getpid(), PERIOD, PERIOD) != -1 ||
+ 10c:	e8 d4 04 00 00       	call   5e5 <getpid>
+ 111:	83 ec 04             	sub    $0x4,%esp
+ 114:	6a 0a                	push   $0xa
+ 116:	6a 0a                	push   $0xa
+ 118:	50                   	push   %eax
+ 119:	e8 2f 05 00 00       	call   64d <setdeadline>
+ 11e:	83 c4 10             	add    $0x10,%esp
+ 121:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 124:	75 1a                	jne    140 <main+0x58>
+     setdeadline(getpid(), 2, 1) != -1){
+ 126:	e8 ba 04 00 00       	call   5e5 <getpid>
+ 12b:	83 ec 04             	sub    $0x4,%esp
+ 12e:	6a 01                	push   $0x1
+ 130:	6a 02                	push   $0x2
+ 132:	50                   	push   %eax
+ 133:	e8 15 05 00 00       	call   64d <setdeadline>
+ 138:	83 c4 10             	add    $0x10,%esp
+  if(setdeadline(getpid(), PERIOD, PERIOD) != -1 ||
+ 13b:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 13e:	74 17                	je     157 <main+0x6f>
+    printf(1, "edftest: impossible reservation admitted\n");
+ 140:	83 ec 08             	sub    $0x8,%esp
+ 143:	68 24 09 00 00       	push   $0x924
+ 148:	6a 01                	push   $0x1
+ 14a:	e8 1a 06 00 00       	call   769 <printf>
+ 14f:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 152:	e8 0e 04 00 00       	call   565 <exit>
+  }
+
+  if(pipe(fd) < 0){
+ 157:	83 ec 0c             	sub    $0xc,%esp
+ 15a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+ 15d:	50                   	push   %eax
+ 15e:	e8 12 04 00 00       	call   575 <pipe>
+ 163:	83 c4 10             	add    $0x10,%esp
+ 166:	85 c0                	test   %eax,%eax
+ 168:	79 17                	jns    181 <main+0x99>
+    printf(1, "edftest: pipe failed\n");
+ 16a:	83 ec 08             	sub    $0x8,%esp
+ 16d:	68 4e 09 00 00       	push   $0x94e
+ 172:	6a 01                	push   $0x1
+ 174:	e8 f0 05 00 00       	call   769 <printf>
+ 179:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 17c:	e8 e4 03 00 00       	call   565 <exit>
+  }
+  if(fork() == 0){
+ 181:	e8 d7 03 00 00       	call   55d <fork>
+ 186:	85 c0                	test   %eax,%eax
+ 188:	75 1e                	jne    1a8 <main+0xc0>
+    close(fd[0]);
+ 18a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 18d:	83 ec 0c             	sub    $0xc,%esp
+ 190:	50                   	push   %eax
+ 191:	e8 f7 03 00 00       	call   58d <close>
+ 196:	83 c4 10             	add    $0x10,%esp
+    periodic(fd[1]);
+ 199:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 19c:	83 ec 0c             	sub    $0xc,%esp
+ 19f:	50                   	push   %eax
+ 1a0:	e8 5b fe ff ff       	call   0 <periodic>
+ 1a5:	83 c4 10             	add    $0x10,%esp
+  }
+  close(fd[1]);
+ 1a8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1ab:	83 ec 0c             	sub    $0xc,%esp
+ 1ae:	50                   	push   %eax
+ 1af:	e8 d9 03 00 00       	call   58d <close>
+ 1b4:	83 c4 10             	add    $0x10,%esp
+  if(read(fd[0], &mask, sizeof(mask)) != sizeof(mask)){
+ 1b7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1ba:	83 ec 04             	sub    $0x4,%esp
+ 1bd:	6a 04                	push   $0x4
+ 1bf:	8d 55 c8             	lea    -0x38(%ebp),%edx
+ 1c2:	52                   	push   %edx
+ 1c3:	50                   	push   %eax
+ 1c4:	e8 b4 03 00 00       	call   57d <read>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+ 1cc:	83 f8 04             	cmp    $0x4,%eax
+ 1cf:	74 17                	je     1e8 <main+0x100>
+    printf(1, "edftest: periodic task failed\n");
+ 1d1:	83 ec 08             	sub    $0x8,%esp
+ 1d4:	68 64 09 00 00       	push   $0x964
+ 1d9:	6a 01                	push   $0x1
+ 1db:	e8 89 05 00 00       	call   769 <printf>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1e3:	e8 7d 03 00 00       	call   565 <exit>
+  }
+
+  // CPU hogs on the periodic task's CPU.
+  for(i = 0; i < NHOG; i++){
+ 1e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1ef:	eb 35                	jmp    226 <main+0x13e>
+    if((hog[i] = fork()) == 0){
+ 1f1:	e8 67 03 00 00       	call   55d <fork>
+ 1f6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1f9:	89 44 95 cc          	mov    %eax,-0x34(%ebp,%edx,4)
+ 1fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 200:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+ 204:	85 c0                	test   %eax,%eax
+ 206:	75 1a                	jne    222 <main+0x13a>
+      setaffinity(getpid(), mask);
+ 208:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 20b:	89 c3                	mov    %eax,%ebx
+ 20d:	e8 d3 03 00 00       	call   5e5 <getpid>
+ 212:	83 ec 08             	sub    $0x8,%esp
+ 215:	53                   	push   %ebx
+ 216:	50                   	push   %eax
+ 217:	e8 01 04 00 00       	call   61d <setaffinity>
+ 21c:	83 c4 10             	add    $0x10,%esp
+      for(;;)
+ 21f:	90                   	nop
+ 220:	eb fd                	jmp    21f <main+0x137>
+  for(i = 0; i < NHOG; i++){
+ 222:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 226:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 22a:	7e c5                	jle    1f1 <main+0x109>
+        ;
+    }
+  }
+
+  n = read(fd[0], &st, sizeof(st));
+ 22c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 22f:	83 ec 04             	sub    $0x4,%esp
+ 232:	6a 10                	push   $0x10
+ 234:	8d 55 e0             	lea    -0x20(%ebp),%edx
+ 237:	52                   	push   %edx
+ 238:	50                   	push   %eax
+ 239:	e8 3f 03 00 00       	call   57d <read>
+ 23e:	83 c4 10             	add    $0x10,%esp
+ 241:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < NHOG; i++){
+ 244:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 24b:	eb 1c                	jmp    269 <main+0x181>
+    kill(hog[i]);
+ 24d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 250:	8b 44 85 cc          	mov    -0x34(%ebp,%eax,4),%eax
+ 254:	83 ec 0c             	sub    $0xc,%esp
+ 257:	50                   	push   %eax
+ 258:	e8 38 03 00 00       	call   595 <kill>
+ 25d:	83 c4 10             	add    $0x10,%esp
+    wait();
+ 260:	e8 08 03 00 00       	call   56d <wait>
+  for(i = 0; i < NHOG; i++){
+ 265:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 269:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 26d:	7e de                	jle    24d <main+0x165>
+  }
+  wait();
+ 26f:	e8 f9 02 00 00       	call   56d <wait>
+  if(n != sizeof(st)){
+ 274:	83 7d f0 10          	cmpl   $0x10,-0x10(%ebp)
+ 278:	74 17                	je     291 <main+0x1a9>
+    printf(1, "edftest: no statistics\n");
+ 27a:	83 ec 08             	sub    $0x8,%esp
+ 27d:	68 83 09 00 00       	push   $0x983
+ 282:	6a 01                	push   $0x1
+ 284:	e8 e0 04 00 00       	call   769 <printf>
+ 289:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 28c:	e8 d4 02 00 00       	call   565 <exit>
+  }
+  printf(1, "edftest: %d periods, %d missed\n", st.periods, st.misses);
+ 291:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 294:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 297:	52                   	push   %edx
+ 298:	50                   	push   %eax
+ 299:	68 9c 09 00 00       	push   $0x99c
+ 29e:	6a 01                	push   $0x1
+ 2a0:	e8 c4 04 00 00       	call   769 <printf>
+ 2a5:	83 c4 10             	add    $0x10,%esp
+  if(st.misses > 0){
+ 2a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 2ab:	85 c0                	test   %eax,%eax
+ 2ad:	74 17                	je     2c6 <main+0x1de>
+    printf(1, "edftest failed\n");
+ 2af:	83 ec 08             	sub    $0x8,%esp
+ 2b2:	68 bc 09 00 00       	push   $0x9bc
+ 2b7:	6a 01                	push   $0x1
+ 2b9:	e8 ab 04 00 00       	call   769 <printf>
+ 2be:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2c1:	e8 9f 02 00 00       	call   565 <exit>
+  }
+  printf(1, "edftest ok\n");
+ 2c6:	83 ec 08             	sub    $0x8,%esp
+ 2c9:	68 cc 09 00 00       	push   $0x9cc
+ 2ce:	6a 01                	push   $0x1
+ 2d0:	e8 94 04 00 00       	call   769 <printf>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 2d8:	e8 88 02 00 00       	call   565 <exit>
+
+000002dd <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2dd:	55                   	push   %ebp
+ 2de:	89 e5                	mov    %esp,%ebp
+ 2e0:	57                   	push   %edi
+ 2e1:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2eb:	89 cb                	mov    %ecx,%ebx
+ 2ed:	89 df                	mov    %ebx,%edi
+ 2ef:	89 d1                	mov    %edx,%ecx
+ 2f1:	fc                   	cld
+ 2f2:	f3 aa                	rep stos %al,%es:(%edi)
+ 2f4:	89 ca                	mov    %ecx,%edx
+ 2f6:	89 fb                	mov    %edi,%ebx
+ 2f8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2fb:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 2fe:	90                   	nop
+ 2ff:	5b                   	pop    %ebx
+ 300:	5f                   	pop    %edi
+ 301:	5d                   	pop    %ebp
+ 302:	c3                   	ret
+
+00000303 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 303:	55                   	push   %ebp
+ 304:	89 e5                	mov    %esp,%ebp
+ 306:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 30f:	90                   	nop
+ 310:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 313:	8d 42 01             	lea    0x1(%edx),%eax
+ 316:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 319:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 31f:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 322:	0f b6 12             	movzbl (%edx),%edx
+ 325:	88 10                	mov    %dl,(%eax)
+ 327:	0f b6 00             	movzbl (%eax),%eax
+ 32a:	84 c0                	test   %al,%al
+ 32c:	75 e2                	jne    310 <strcpy+0xd>
+    ;
+  return os;
+ 32e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 331:	c9                   	leave
+ 332:	c3                   	ret
+
+00000333 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 333:	55                   	push   %ebp
+ 334:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 336:	eb 08                	jmp    340 <strcmp+0xd>
+    p++, q++;
+ 338:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 33c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 340:	8b 45 08             	mov    0x8(%ebp),%eax
+ 343:	0f b6 00             	movzbl (%eax),%eax
+ 346:	84 c0                	test   %al,%al
+ 348:	74 10                	je     35a <strcmp+0x27>
+ 34a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34d:	0f b6 10             	movzbl (%eax),%edx
+ 350:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 353:	0f b6 00             	movzbl (%eax),%eax
+ 356:	38 c2                	cmp    %al,%dl
+ 358:	74 de                	je     338 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 35a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35d:	0f b6 00             	movzbl (%eax),%eax
+ 360:	0f b6 d0             	movzbl %al,%edx
+ 363:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 366:	0f b6 00             	movzbl (%eax),%eax
+ 369:	0f b6 c0             	movzbl %al,%eax
+ 36c:	29 c2                	sub    %eax,%edx
+ 36e:	89 d0                	mov    %edx,%eax
+}
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+
+00000372 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 372:	55                   	push   %ebp
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 378:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 37f:	eb 04                	jmp    385 <strlen+0x13>
+ 381:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 385:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 388:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38b:	01 d0                	add    %edx,%eax
+ 38d:	0f b6 00             	movzbl (%eax),%eax
+ 390:	84 c0                	test   %al,%al
+ 392:	75 ed                	jne    381 <strlen+0xf>
+    ;
+  return n;
+ 394:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+
+00000399 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 39c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39f:	50                   	push   %eax
+ 3a0:	ff 75 0c             	push   0xc(%ebp)
+ 3a3:	ff 75 08             	push   0x8(%ebp)
+ 3a6:	e8 32 ff ff ff       	call   2dd <stosb>
+ 3ab:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b1:	c9                   	leave
+ 3b2:	c3                   	ret
+
+000003b3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b3:	55                   	push   %ebp
+ 3b4:	89 e5                	mov    %esp,%ebp
+ 3b6:	83 ec 04             	sub    $0x4,%esp
+ 3b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bc:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3bf:	eb 14                	jmp    3d5 <strchr+0x22>
+    if(*s == c)
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	0f b6 00             	movzbl (%eax),%eax
+ 3c7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3ca:	75 05                	jne    3d1 <strchr+0x1e>
+      return (char*)s;
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	eb 13                	jmp    3e4 <strchr+0x31>
+  for(; *s; s++)
+ 3d1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	0f b6 00             	movzbl (%eax),%eax
+ 3db:	84 c0                	test   %al,%al
+ 3dd:	75 e2                	jne    3c1 <strchr+0xe>
+  return 0;
+ 3df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3e4:	c9                   	leave
+ 3e5:	c3                   	ret
+
+000003e6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3e6:	55                   	push   %ebp
+ 3e7:	89 e5                	mov    %esp,%ebp
+ 3e9:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3ec:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3f3:	eb 42                	jmp    437 <gets+0x51>
+    cc = read(0, &c, 1);
+ 3f5:	83 ec 04             	sub    $0x4,%esp
+ 3f8:	6a 01                	push   $0x1
+ 3fa:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3fd:	50                   	push   %eax
+ 3fe:	6a 00                	push   $0x0
+ 400:	e8 78 01 00 00       	call   57d <read>
+ 405:	83 c4 10             	add    $0x10,%esp
+ 408:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 40b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 40f:	7e 33                	jle    444 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 411:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 414:	8d 50 01             	lea    0x1(%eax),%edx
+ 417:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 41a:	89 c2                	mov    %eax,%edx
+ 41c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41f:	01 c2                	add    %eax,%edx
+ 421:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 425:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 427:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 42b:	3c 0a                	cmp    $0xa,%al
+ 42d:	74 16                	je     445 <gets+0x5f>
+ 42f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 433:	3c 0d                	cmp    $0xd,%al
+ 435:	74 0e                	je     445 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 437:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 43a:	83 c0 01             	add    $0x1,%eax
+ 43d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 440:	7f b3                	jg     3f5 <gets+0xf>
+ 442:	eb 01                	jmp    445 <gets+0x5f>
+      break;
+ 444:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 445:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 448:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44b:	01 d0                	add    %edx,%eax
+ 44d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 450:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 453:	c9                   	leave
+ 454:	c3                   	ret
+
+00000455 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 455:	55                   	push   %ebp
+ 456:	89 e5                	mov    %esp,%ebp
+ 458:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 45b:	83 ec 08             	sub    $0x8,%esp
+ 45e:	6a 00                	push   $0x0
+ 460:	ff 75 08             	push   0x8(%ebp)
+ 463:	e8 3d 01 00 00       	call   5a5 <open>
+ 468:	83 c4 10             	add    $0x10,%esp
+ 46b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 46e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 472:	79 07                	jns    47b <stat+0x26>
+    return -1;
+ 474:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 479:	eb 25                	jmp    4a0 <stat+0x4b>
+  r = fstat(fd, st);
+ 47b:	83 ec 08             	sub    $0x8,%esp
+ 47e:	ff 75 0c             	push   0xc(%ebp)
+ 481:	ff 75 f4             	push   -0xc(%ebp)
+ 484:	e8 34 01 00 00       	call   5bd <fstat>
+ 489:	83 c4 10             	add    $0x10,%esp
+ 48c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 48f:	83 ec 0c             	sub    $0xc,%esp
+ 492:	ff 75 f4             	push   -0xc(%ebp)
+ 495:	e8 f3 00 00 00       	call   58d <close>
+ 49a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 49d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4a0:	c9                   	leave
+ 4a1:	c3                   	ret
+
+000004a2 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4a2:	55                   	push   %ebp
+ 4a3:	89 e5                	mov    %esp,%ebp
+ 4a5:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4a8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4af:	eb 25                	jmp    4d6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4b1:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4b4:	89 d0                	mov    %edx,%eax
+ 4b6:	c1 e0 02             	shl    $0x2,%eax
+ 4b9:	01 d0                	add    %edx,%eax
+ 4bb:	01 c0                	add    %eax,%eax
+ 4bd:	89 c1                	mov    %eax,%ecx
+ 4bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c2:	8d 50 01             	lea    0x1(%eax),%edx
+ 4c5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4c8:	0f b6 00             	movzbl (%eax),%eax
+ 4cb:	0f be c0             	movsbl %al,%eax
+ 4ce:	01 c8                	add    %ecx,%eax
+ 4d0:	83 e8 30             	sub    $0x30,%eax
+ 4d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d9:	0f b6 00             	movzbl (%eax),%eax
+ 4dc:	3c 2f                	cmp    $0x2f,%al
+ 4de:	7e 0a                	jle    4ea <atoi+0x48>
+ 4e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e3:	0f b6 00             	movzbl (%eax),%eax
+ 4e6:	3c 39                	cmp    $0x39,%al
+ 4e8:	7e c7                	jle    4b1 <atoi+0xf>
+  return n;
+ 4ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4ed:	c9                   	leave
+ 4ee:	c3                   	ret
+
+000004ef <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4ef:	55                   	push   %ebp
+ 4f0:	89 e5                	mov    %esp,%ebp
+ 4f2:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 4f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4fe:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 501:	eb 17                	jmp    51a <memmove+0x2b>
+    *dst++ = *src++;
+ 503:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 506:	8d 42 01             	lea    0x1(%edx),%eax
+ 509:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 50c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 50f:	8d 48 01             	lea    0x1(%eax),%ecx
+ 512:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 515:	0f b6 12             	movzbl (%edx),%edx
+ 518:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 51a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 51d:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 520:	89 55 10             	mov    %edx,0x10(%ebp)
+ 523:	85 c0                	test   %eax,%eax
+ 525:	7f dc                	jg     503 <memmove+0x14>
+  return vdst;
+ 527:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 52a:	c9                   	leave
+ 52b:	c3                   	ret
+
+0000052c <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 52c:	55                   	push   %ebp
+ 52d:	89 e5                	mov    %esp,%ebp
+ 52f:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 532:	83 ec 0c             	sub    $0xc,%esp
+ 535:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 538:	50                   	push   %eax
+ 539:	e8 ff 00 00 00       	call   63d <nanouptime>
+ 53e:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 541:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 544:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 54a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54d:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 552:	f7 e2                	mul    %edx
+ 554:	89 d0                	mov    %edx,%eax
+ 556:	c1 e8 06             	shr    $0x6,%eax
+ 559:	01 c8                	add    %ecx,%eax
+}
+ 55b:	c9                   	leave
+ 55c:	c3                   	ret
+
+0000055d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 55d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <exit>:
+SYSCALL(exit)
+ 565:	b8 02 00 00 00       	mov    $0x2,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <wait>:
+SYSCALL(wait)
+ 56d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <pipe>:
+SYSCALL(pipe)
+ 575:	b8 04 00 00 00       	mov    $0x4,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <read>:
+SYSCALL(read)
+ 57d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <write>:
+SYSCALL(write)
+ 585:	b8 10 00 00 00       	mov    $0x10,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <close>:
+SYSCALL(close)
+ 58d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <kill>:
+SYSCALL(kill)
+ 595:	b8 06 00 00 00       	mov    $0x6,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <exec>:
+SYSCALL(exec)
+ 59d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <open>:
+SYSCALL(open)
+ 5a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <mknod>:
+SYSCALL(mknod)
+ 5ad:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <unlink>:
+SYSCALL(unlink)
+ 5b5:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <fstat>:
+SYSCALL(fstat)
+ 5bd:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <link>:
+SYSCALL(link)
+ 5c5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <mkdir>:
+SYSCALL(mkdir)
+ 5cd:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <chdir>:
+SYSCALL(chdir)
+ 5d5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <dup>:
+SYSCALL(dup)
+ 5dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <getpid>:
+SYSCALL(getpid)
+ 5e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <sbrk>:
+SYSCALL(sbrk)
+ 5ed:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <sleep>:
+SYSCALL(sleep)
+ 5f5:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <uptime>:
+SYSCALL(uptime)
+ 5fd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <saveProc>:
+SYSCALL(saveProc)
+ 605:	b8 16 00 00 00       	mov    $0x16,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <loadProc>:
+SYSCALL(loadProc)
+ 60d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <setpriority>:
+SYSCALL(setpriority)
+ 615:	b8 19 00 00 00       	mov    $0x19,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <setaffinity>:
+SYSCALL(setaffinity)
+ 61d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <getaffinity>:
+SYSCALL(getaffinity)
+ 625:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <nanosleep>:
+SYSCALL(nanosleep)
+ 62d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <cpustat>:
+SYSCALL(cpustat)
+ 635:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <nanouptime>:
+SYSCALL(nanouptime)
+ 63d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <settickets>:
+SYSCALL(settickets)
+ 645:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <setdeadline>:
+SYSCALL(setdeadline)
+ 64d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <rtstat>:
+SYSCALL(rtstat)
+ 655:	b8 21 00 00 00       	mov    $0x21,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <schedstat>:
+SYSCALL(schedstat)
+ 65d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <waitpid>:
+SYSCALL(waitpid)
+ 665:	b8 23 00 00 00       	mov    $0x23,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <clone>:
+SYSCALL(clone)
+ 66d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <futexwait>:
+SYSCALL(futexwait)
+ 675:	b8 25 00 00 00       	mov    $0x25,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <futexwake>:
+SYSCALL(futexwake)
+ 67d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <lockstat>:
+SYSCALL(lockstat)
+ 685:	b8 27 00 00 00       	mov    $0x27,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <dcachestat>:
+SYSCALL(dcachestat)
+ 68d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 695:	55                   	push   %ebp
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	83 ec 18             	sub    $0x18,%esp
+ 69b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 69e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6a1:	83 ec 04             	sub    $0x4,%esp
+ 6a4:	6a 01                	push   $0x1
+ 6a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6a9:	50                   	push   %eax
+ 6aa:	ff 75 08             	push   0x8(%ebp)
+ 6ad:	e8 d3 fe ff ff       	call   585 <write>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+}
+ 6b5:	90                   	nop
+ 6b6:	c9                   	leave
+ 6b7:	c3                   	ret
+
+000006b8 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6b8:	55                   	push   %ebp
+ 6b9:	89 e5                	mov    %esp,%ebp
+ 6bb:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6be:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6c5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6c9:	74 17                	je     6e2 <printint+0x2a>
+ 6cb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6cf:	79 11                	jns    6e2 <printint+0x2a>
+    neg = 1;
+ 6d1:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6db:	f7 d8                	neg    %eax
+ 6dd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6e0:	eb 06                	jmp    6e8 <printint+0x30>
+  } else {
+    x = xx;
+ 6e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6e8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6ef:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6f5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6fa:	f7 f1                	div    %ecx
+ 6fc:	89 d1                	mov    %edx,%ecx
+ 6fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 701:	8d 50 01             	lea    0x1(%eax),%edx
+ 704:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 707:	0f b6 91 04 0c 00 00 	movzbl 0xc04(%ecx),%edx
+ 70e:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 712:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 715:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 718:	ba 00 00 00 00       	mov    $0x0,%edx
+ 71d:	f7 f1                	div    %ecx
+ 71f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 722:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 726:	75 c7                	jne    6ef <printint+0x37>
+  if(neg)
+ 728:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 72c:	74 2d                	je     75b <printint+0xa3>
+    buf[i++] = '-';
+ 72e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 731:	8d 50 01             	lea    0x1(%eax),%edx
+ 734:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 737:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 73c:	eb 1d                	jmp    75b <printint+0xa3>
+    putc(fd, buf[i]);
+ 73e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 741:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 744:	01 d0                	add    %edx,%eax
+ 746:	0f b6 00             	movzbl (%eax),%eax
+ 749:	0f be c0             	movsbl %al,%eax
+ 74c:	83 ec 08             	sub    $0x8,%esp
+ 74f:	50                   	push   %eax
+ 750:	ff 75 08             	push   0x8(%ebp)
+ 753:	e8 3d ff ff ff       	call   695 <putc>
+ 758:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 75b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 75f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 763:	79 d9                	jns    73e <printint+0x86>
+}
+ 765:	90                   	nop
+ 766:	90                   	nop
+ 767:	c9                   	leave
+ 768:	c3                   	ret
+
+00000769 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 769:	55                   	push   %ebp
+ 76a:	89 e5                	mov    %esp,%ebp
+ 76c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 76f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 776:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 779:	83 c0 04             	add    $0x4,%eax
+ 77c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 77f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 786:	e9 59 01 00 00       	jmp    8e4 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 78b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 78e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 791:	01 d0                	add    %edx,%eax
+ 793:	0f b6 00             	movzbl (%eax),%eax
+ 796:	0f be c0             	movsbl %al,%eax
+ 799:	25 ff 00 00 00       	and    $0xff,%eax
+ 79e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7a1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7a5:	75 2c                	jne    7d3 <printf+0x6a>
+      if(c == '%'){
+ 7a7:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7ab:	75 0c                	jne    7b9 <printf+0x50>
+        state = '%';
+ 7ad:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7b4:	e9 27 01 00 00       	jmp    8e0 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7bc:	0f be c0             	movsbl %al,%eax
+ 7bf:	83 ec 08             	sub    $0x8,%esp
+ 7c2:	50                   	push   %eax
+ 7c3:	ff 75 08             	push   0x8(%ebp)
+ 7c6:	e8 ca fe ff ff       	call   695 <putc>
+ 7cb:	83 c4 10             	add    $0x10,%esp
+ 7ce:	e9 0d 01 00 00       	jmp    8e0 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7d3:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7d7:	0f 85 03 01 00 00    	jne    8e0 <printf+0x177>
+      if(c == 'd'){
+ 7dd:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7e1:	75 1e                	jne    801 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7e3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e6:	8b 00                	mov    (%eax),%eax
+ 7e8:	6a 01                	push   $0x1
+ 7ea:	6a 0a                	push   $0xa
+ 7ec:	50                   	push   %eax
+ 7ed:	ff 75 08             	push   0x8(%ebp)
+ 7f0:	e8 c3 fe ff ff       	call   6b8 <printint>
+ 7f5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7f8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7fc:	e9 d8 00 00 00       	jmp    8d9 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 801:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 805:	74 06                	je     80d <printf+0xa4>
+ 807:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 80b:	75 1e                	jne    82b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 80d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 810:	8b 00                	mov    (%eax),%eax
+ 812:	6a 00                	push   $0x0
+ 814:	6a 10                	push   $0x10
+ 816:	50                   	push   %eax
+ 817:	ff 75 08             	push   0x8(%ebp)
+ 81a:	e8 99 fe ff ff       	call   6b8 <printint>
+ 81f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 822:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 826:	e9 ae 00 00 00       	jmp    8d9 <printf+0x170>
+      } else if(c == 's'){
+ 82b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 82f:	75 43                	jne    874 <printf+0x10b>
+        s = (char*)*ap;
+ 831:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 834:	8b 00                	mov    (%eax),%eax
+ 836:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 839:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 83d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 841:	75 25                	jne    868 <printf+0xff>
+          s = "(null)";
+ 843:	c7 45 f4 d8 09 00 00 	movl   $0x9d8,-0xc(%ebp)
+        while(*s != 0){
+ 84a:	eb 1c                	jmp    868 <printf+0xff>
+          putc(fd, *s);
+ 84c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 84f:	0f b6 00             	movzbl (%eax),%eax
+ 852:	0f be c0             	movsbl %al,%eax
+ 855:	83 ec 08             	sub    $0x8,%esp
+ 858:	50                   	push   %eax
+ 859:	ff 75 08             	push   0x8(%ebp)
+ 85c:	e8 34 fe ff ff       	call   695 <putc>
+ 861:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 864:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 868:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 86b:	0f b6 00             	movzbl (%eax),%eax
+ 86e:	84 c0                	test   %al,%al
+ 870:	75 da                	jne    84c <printf+0xe3>
+ 872:	eb 65                	jmp    8d9 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 874:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 878:	75 1d                	jne    897 <printf+0x12e>
+        putc(fd, *ap);
+ 87a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 87d:	8b 00                	mov    (%eax),%eax
+ 87f:	0f be c0             	movsbl %al,%eax
+ 882:	83 ec 08             	sub    $0x8,%esp
+ 885:	50                   	push   %eax
+ 886:	ff 75 08             	push   0x8(%ebp)
+ 889:	e8 07 fe ff ff       	call   695 <putc>
+ 88e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 891:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 895:	eb 42                	jmp    8d9 <printf+0x170>
+      } else if(c == '%'){
+ 897:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 89b:	75 17                	jne    8b4 <printf+0x14b>
+        putc(fd, c);
+ 89d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a0:	0f be c0             	movsbl %al,%eax
+ 8a3:	83 ec 08             	sub    $0x8,%esp
+ 8a6:	50                   	push   %eax
+ 8a7:	ff 75 08             	push   0x8(%ebp)
+ 8aa:	e8 e6 fd ff ff       	call   695 <putc>
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	eb 25                	jmp    8d9 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8b4:	83 ec 08             	sub    $0x8,%esp
+ 8b7:	6a 25                	push   $0x25
+ 8b9:	ff 75 08             	push   0x8(%ebp)
+ 8bc:	e8 d4 fd ff ff       	call   695 <putc>
+ 8c1:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8c4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8c7:	0f be c0             	movsbl %al,%eax
+ 8ca:	83 ec 08             	sub    $0x8,%esp
+ 8cd:	50                   	push   %eax
+ 8ce:	ff 75 08             	push   0x8(%ebp)
+ 8d1:	e8 bf fd ff ff       	call   695 <putc>
+ 8d6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8d9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8e0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8e7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8ea:	01 d0                	add    %edx,%eax
+ 8ec:	0f b6 00             	movzbl (%eax),%eax
+ 8ef:	84 c0                	test   %al,%al
+ 8f1:	0f 85 94 fe ff ff    	jne    78b <printf+0x22>
+    }
+  }
+}
+ 8f7:	90                   	nop
+ 8f8:	90                   	nop
+ 8f9:	c9                   	leave
+ 8fa:	c3                   	ret
@@ -0,0 +1,98 @@
+// Test the EDF real-time class: admission control must refuse
+// reservations a CPU cannot hold, and a periodic task must meet
+// its deadlines while CPU hogs share its CPU.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+#define NHOG     3
+#define NPERIOD  30
+#define RUNTIME  3     // ticks reserved per period
+#define PERIOD   10    // ticks
+#define WORK     4000  // microseconds of work per period
+
+static void
+periodic(int out)
+{
+  struct rtstat st;
+  uint start, t0;
+  int i, mask;
+
+  if(setdeadline(getpid(), RUNTIME, PERIOD) < 0){
+    printf(1, "edftest: %d/%d not admitted\n", RUNTIME, PERIOD);
+    exit();
+  }
+  mask = getaffinity(getpid());
+  write(out, &mask, sizeof(mask));
+
+  for(i = 0; i < NPERIOD; i++){
+    start = uptime();
+    t0 = uptimeus();
+    while(uptimeus() - t0 < WORK)
+      ;
+    if(uptime() - start < PERIOD)
+      sleep(PERIOD - (uptime() - start));
+  }
+  rtstat(getpid(), &st);
+  write(out, &st, sizeof(st));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct rtstat st;
+  int fd[2], hog[NHOG], i, n, mask;
+
+  printf(1, "edftest\n");
+
+  if(setdeadline(getpid(), PERIOD, PERIOD) != -1 ||
+     setdeadline(getpid(), 2, 1) != -1){
+    printf(1, "edftest: impossible reservation admitted\n");
+    exit();
+  }
+
+  if(pipe(fd) < 0){
+    printf(1, "edftest: pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(fd[0]);
+    periodic(fd[1]);
+  }
+  close(fd[1]);
+  if(read(fd[0], &mask, sizeof(mask)) != sizeof(mask)){
+    printf(1, "edftest: periodic task failed\n");
+    exit();
+  }
+
+  // CPU hogs on the periodic task's CPU.
+  for(i = 0; i < NHOG; i++){
+    if((hog[i] = fork()) == 0){
+      setaffinity(getpid(), mask);
+      for(;;)
+        ;
+    }
+  }
+
+  n = read(fd[0], &st, sizeof(st));
+  for(i = 0; i < NHOG; i++){
+    kill(hog[i]);
+    wait();
+  }
+  wait();
+  if(n != sizeof(st)){
+    printf(1, "edftest: no statistics\n");
+    exit();
+  }
+  printf(1, "edftest: %d periods, %d missed\n", st.periods, st.misses);
+  if(st.misses > 0){
+    printf(1, "edftest failed\n");
+    exit();
+  }
+  printf(1, "edftest ok\n");
+  exit();
+}
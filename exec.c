@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -17,6 +18,7 @@ exec(char *path, char **argv)
     struct inode *ip;
     struct proghdr ph;
     pde_t *pgdir, *oldpgdir;
+    struct vmspace *oldvm;
 
 
     begin_op();
@@ -25,7 +27,7 @@ exec(char *path, char **argv)
         end_op();
         return -1;
     }
-    ilock(ip);
+    ilockshared(ip);
     pgdir = 0;
 
     // Check ELF header
@@ -52,7 +54,8 @@ exec(char *path, char **argv)
         if (loaduvm(pgdir, (char *) ph.vaddr, ip, ph.off, ph.filesz) < 0)
             goto bad;
     }
-    iunlockput(ip);
+    iunlockshared(ip);
+    iput(ip);
     end_op();
     ip = 0;
 
@@ -93,13 +96,16 @@ exec(char *path, char **argv)
     cprintf("exec here after!!!\n");
 
     // Commit to the user image.
+    // A thread leaves the address space it shared.
     oldpgdir = proc->pgdir;
+    oldvm = proc->vm;
     proc->pgdir = pgdir;
+    proc->vm = 0;
     proc->sz = sz;
     proc->tf->eip = elf.entry;  // main
     proc->tf->esp = sp;
     switchuvm(proc);
-    freevm(oldpgdir);
+    putvm(oldpgdir, oldvm);
     return 0;
 
     bad:
@@ -107,7 +113,8 @@ exec(char *path, char **argv)
         freevm(pgdir);
     if (ip)
     {
-        iunlockput(ip);
+        iunlockshared(ip);
+        iput(ip);
         end_op();
     }
     return -1;
@@ -5,14 +5,18 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "stat.h"
 #include "fs.h"
-#include "file.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "file.h"
 
 struct devsw devsw[NDEV];
+
+// Files are allocated with kmalloc; ftable.lock guards
+// their reference counts.
 struct {
   struct spinlock lock;
-  struct file file[NFILE];
 } ftable;
 
 void
@@ -27,16 +31,66 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
-  }
-  release(&ftable.lock);
-  return 0;
+  if((f = kmalloc(sizeof(*f))) == 0)
+    return 0;
+  memset(f, 0, sizeof(*f));
+  initsleeplock(&f->lock, "file");
+  f->ref = 1;
+  return f;
+}
+
+// Allocate an empty file descriptor table.
+struct fdtable*
+fdtablealloc(void)
+{
+  struct fdtable *t;
+
+  if((t = kmalloc(sizeof(*t))) == 0)
+    return 0;
+  memset(t, 0, sizeof(*t));
+  initlock(&t->lock, "fdtable");
+  t->ref = 1;
+  return t;
+}
+
+// Return a new table with its own references to the files
+// in t, as fork() gives the child.
+struct fdtable*
+fdtablecopy(struct fdtable *t)
+{
+  struct fdtable *nt;
+  int fd;
+
+  if((nt = fdtablealloc()) == 0)
+    return 0;
+  acquire(&t->lock);
+  for(fd = 0; fd < NOFILE; fd++)
+    if(t->ofile[fd])
+      nt->ofile[fd] = filedup(t->ofile[fd]);
+  release(&t->lock);
+  return nt;
+}
+
+// Increment ref count for table t, for a thread sharing it.
+struct fdtable*
+fdtabledup(struct fdtable *t)
+{
+  __sync_fetch_and_add(&t->ref, 1);
+  return t;
+}
+
+// Drop a reference to t, closing its files with the last one.
+void
+fdtableput(struct fdtable *t)
+{
+  int fd;
+
+  if(__sync_sub_and_fetch(&t->ref, 1) > 0)
+    return;
+  for(fd = 0; fd < NOFILE; fd++)
+    if(t->ofile[fd])
+      fileclose(t->ofile[fd]);
+  kmfree(t);
 }
 
 // Increment ref count for file f.
@@ -65,9 +119,8 @@ fileclose(struct file *f)
     return;
   }
   ff = *f;
-  f->ref = 0;
-  f->type = FD_NONE;
   release(&ftable.lock);
+  kmfree(f);
   
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -83,9 +136,9 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
-    iunlock(f->ip);
+    iunlockshared(f->ip);
     return 0;
   }
   return -1;
@@ -102,10 +155,18 @@ fileread(struct file *f, char *addr, int n)
   if(f->type == FD_PIPE)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    // Readers share the inode, so f->lock keeps processes
+    // reading through one struct file from using the same
+    // offset.  Devices have no offset, and a console read
+    // that waits for input must not hold up writers to f.
+    if(f->ip->type != T_DEV)
+      acquiresleep(&f->lock);
+    ilockshared(f->ip);
     if((r = readi(f->ip, addr, f->off, n)) > 0)
       f->off += r;
-    iunlock(f->ip);
+    iunlockshared(f->ip);
+    if(f->ip->type != T_DEV)
+      releasesleep(&f->lock);
     return r;
   }
   panic("fileread");
@@ -6,6 +6,15 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  struct sleeplock lock;  // serializes reads at off
+};
+
+// A process's open files, indexed by file descriptor.
+// The threads clone() makes share one table.
+struct fdtable {
+  struct spinlock lock;        // guards ofile[]
+  int ref;                     // processes using the table; atomic
+  struct file *ofile[NOFILE];
 };
 
 
@@ -14,7 +23,8 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  int flags;          // I_BUSY, I_VALID
+  struct sleeplock lock;  // protects everything below here
+  int flags;          // I_VALID
 
   short type;         // copy of disk inode
   short major;
@@ -23,7 +33,6 @@ struct inode {
   uint size;
   uint addrs[NDIRECT+1];
 };
-#define I_BUSY 0x1
 #define I_VALID 0x2
 
 // table mapping major device number to
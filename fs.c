@@ -14,14 +14,18 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "sleeplock.h"
 #include "fs.h"
+#include "dcachestat.h"
 #include "buf.h"
 #include "file.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 static void itrunc(struct inode*);
+static void dcacheinit(void);
+static void dcachedrop(uint, uint, char*);
 struct superblock sb;   // there should be one per dev, but we run with one dev
 
 // Read the super block.
@@ -132,9 +136,12 @@ bfree(int dev, uint b)
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
-//   has first locked the inode. The I_BUSY flag indicates
-//   that the inode is locked. ilock() sets I_BUSY,
-//   while iunlock clears it.
+//   has first locked the inode's sleep lock. ilock() takes
+//   it exclusively, as writei(), dirlink() and itrunc()
+//   require, and iunlock() releases it. Code that only
+//   reads, such as readi(), dirlookup() and stati(), may
+//   instead hold it shared with other readers through
+//   ilockshared() and iunlockshared().
 //
 // Thus a typical sequence is:
 //   ip = iget(dev, inum)
@@ -162,7 +169,12 @@ struct {
 void
 iinit(int dev)
 {
+  int i;
+
   initlock(&icache.lock, "icache");
+  for(i = 0; i < NINODE; i++)
+    initsleeplock(&icache.inode[i].lock, "inode");
+  dcacheinit();
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d inodestart %d bmap start %d\n", sb.size,
           sb.nblocks, sb.ninodes, sb.nlog, sb.logstart, sb.inodestart, sb.bmapstart);
@@ -261,7 +273,7 @@ idup(struct inode *ip)
   return ip;
 }
 
-// Lock the given inode.
+// Lock the given inode exclusively.
 // Reads the inode from disk if necessary.
 void
 ilock(struct inode *ip)
@@ -272,11 +284,7 @@ ilock(struct inode *ip)
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
 
-  acquire(&icache.lock);
-  while(ip->flags & I_BUSY)
-    sleep(ip, &icache.lock);
-  ip->flags |= I_BUSY;
-  release(&icache.lock);
+  acquiresleep(&ip->lock);
 
   if(!(ip->flags & I_VALID)){
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
@@ -298,13 +306,38 @@ ilock(struct inode *ip)
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
-  acquire(&icache.lock);
-  ip->flags &= ~I_BUSY;
-  wakeup(ip);
-  release(&icache.lock);
+  releasesleep(&ip->lock);
+}
+
+// Lock the given inode for reading, sharing it with
+// other readers.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+  if(!(ip->flags & I_VALID)){
+    // Read it in under the exclusive lock.  Our reference
+    // keeps it valid once it is.
+    releasesleepshared(&ip->lock);
+    ilock(ip);
+    iunlock(ip);
+    acquiresleepshared(&ip->lock);
+  }
+}
+
+void
+iunlockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("iunlockshared");
+
+  releasesleepshared(&ip->lock);
 }
 
 // Drop a reference to an in-memory inode.
@@ -320,16 +353,18 @@ iput(struct inode *ip)
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links and no other references: truncate and free.
-    if(ip->flags & I_BUSY)
+    if(sleeplocked(&ip->lock))
       panic("iput busy");
-    ip->flags |= I_BUSY;
     release(&icache.lock);
+    acquiresleep(&ip->lock);
+    if(ip->type == T_DIR)
+      dcachedrop(ip->dev, ip->inum, 0);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
     acquire(&icache.lock);
     ip->flags = 0;
-    wakeup(ip);
+    releasesleep(&ip->lock);
   }
   ip->ref--;
   release(&icache.lock);
@@ -395,6 +430,9 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  if(!holdingsleep(&ip->lock))
+    panic("itrunc");
+
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -465,6 +503,9 @@ writei(struct inode *ip, char *src, uint off, uint n)
   uint tot, m;
   struct buf *bp;
 
+  if(!holdingsleep(&ip->lock))
+    panic("writei");
+
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
       return -1;
@@ -536,6 +577,9 @@ dirlink(struct inode *dp, char *name, uint inum)
   struct dirent de;
   struct inode *ip;
 
+  if(!holdingsleep(&dp->lock))
+    panic("dirlink");
+
   // Check that name is not present.
   if((ip = dirlookup(dp, name, 0)) != 0){
     iput(ip);
@@ -558,6 +602,196 @@ dirlink(struct inode *dp, char *name, uint inum)
   return 0;
 }
 
+//PAGEBREAK!
+// Directory entry cache.
+//
+// namex() finds most path elements in a hash of (directory,
+// name) -> inode number instead of locking and reading the
+// directory.  Only names dirlookup() found are cached, and only
+// while the directory is locked; unlinking a name drops its
+// entry under the directory's exclusive lock, and freeing a
+// directory drops all of its entries, so the cache never
+// disagrees with the disk.  Lookups take no lock: they run in an
+// RCU read section (see rcu.c), and a writer, serialized by
+// dcache.lock, waits out a grace period before freeing an entry
+// it has unlinked.
+
+#define NDHASH  64   // dentry cache hash buckets
+#define NDENTRY 256  // most entries cached at once
+
+struct dentry {
+  struct dentry *next;  // Next in hash bucket
+  struct dentry *dead;  // Next unlinked entry waiting to be freed
+  uint dev;
+  uint dinum;           // Directory holding the name
+  uint inum;            // Inode the name refers to
+  char name[DIRSIZ];
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry *head[NDHASH];
+  int n;                // Entries cached
+  uint hand;            // Next bucket to evict from when full
+  uint hits;            // Lookups answered from the cache
+  uint misses;          // Lookups that read the directory
+} dcache;
+
+static void
+dcacheinit(void)
+{
+  initlock(&dcache.lock, "dcache");
+}
+
+static uint
+dhash(uint dev, uint dinum, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev * 31 + dinum;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + name[i];
+  return h % NDHASH;
+}
+
+static int
+dmatch(struct dentry *d, uint dev, uint dinum, char *name)
+{
+  return d->dinum == dinum && d->dev == dev && namecmp(d->name, name) == 0;
+}
+
+// Return the inode that name in directory dp refers to, with a
+// new reference, if it is cached; otherwise 0.
+static struct inode*
+dcachelookup(struct inode *dp, char *name)
+{
+  struct dentry *d;
+  struct inode *ip;
+
+  ip = 0;
+  rcureadlock();
+  for(d = dcache.head[dhash(dp->dev, dp->inum, name)]; d; d = d->next){
+    if(dmatch(d, dp->dev, dp->inum, name)){
+      // Take the reference before the read section ends, so
+      // that an unlink cannot free the inode first.
+      ip = iget(dp->dev, d->inum);
+      __sync_fetch_and_add(&dcache.hits, 1);
+      break;
+    }
+  }
+  rcureadunlock();
+  return ip;
+}
+
+// Unlink the last entry of the next nonempty bucket.
+// Caller must hold dcache.lock, with the cache full.
+static struct dentry*
+dcacheevict(void)
+{
+  struct dentry **pp, *d;
+
+  do
+    pp = &dcache.head[dcache.hand++ % NDHASH];
+  while(*pp == 0);
+  while((*pp)->next)
+    pp = &(*pp)->next;
+  d = *pp;
+  *pp = 0;
+  dcache.n--;
+  return d;
+}
+
+// Remember that name in directory dp refers to inode inum.
+// dp must be locked.
+static void
+dcacheadd(struct inode *dp, char *name, uint inum)
+{
+  struct dentry *d, *old;
+  uint h;
+
+  if((d = kmalloc(sizeof(*d))) == 0)
+    return;
+  d->dev = dp->dev;
+  d->dinum = dp->inum;
+  d->inum = inum;
+  strncpy(d->name, name, DIRSIZ);
+  h = dhash(dp->dev, dp->inum, name);
+
+  acquire(&dcache.lock);
+  for(old = dcache.head[h]; old; old = old->next){
+    if(dmatch(old, dp->dev, dp->inum, name)){
+      // Another reader of dp got here first.
+      release(&dcache.lock);
+      kmfree(d);
+      return;
+    }
+  }
+  old = dcache.n >= NDENTRY ? dcacheevict() : 0;
+  d->next = dcache.head[h];
+  __sync_synchronize();  // fill in d before readers can see it
+  dcache.head[h] = d;
+  dcache.n++;
+  release(&dcache.lock);
+
+  if(old){
+    synchronizercu();
+    kmfree(old);
+  }
+}
+
+// Drop the entry for name in directory dinum on dev,
+// or with name 0 every entry in that directory.
+static void
+dcachedrop(uint dev, uint dinum, char *name)
+{
+  struct dentry **pp, *d, *dead;
+  int h;
+
+  dead = 0;
+  acquire(&dcache.lock);
+  for(h = 0; h < NDHASH; h++){
+    if(name && h != dhash(dev, dinum, name))
+      continue;
+    for(pp = &dcache.head[h]; (d = *pp) != 0; ){
+      if(d->dinum == dinum && d->dev == dev &&
+         (name == 0 || namecmp(d->name, name) == 0)){
+        // Readers at d may still follow d->next.
+        *pp = d->next;
+        d->dead = dead;
+        dead = d;
+        dcache.n--;
+      } else
+        pp = &d->next;
+    }
+  }
+  release(&dcache.lock);
+
+  if(dead == 0)
+    return;
+  synchronizercu();
+  while((d = dead) != 0){
+    dead = d->dead;
+    kmfree(d);
+  }
+}
+
+// Copy the cache's hit and miss counts to *st.
+void
+getdcachestat(struct dcachestat *st)
+{
+  st->hits = dcache.hits;
+  st->misses = dcache.misses;
+}
+
+// Forget name in directory dp before its entry is removed.
+// dp must be locked exclusively.
+void
+dcacheremove(struct inode *dp, char *name)
+{
+  dcachedrop(dp->dev, dp->inum, name);
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -613,21 +847,32 @@ namex(char *path, int nameiparent, char *name)
     ip = idup(proc->cwd);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    // Only directories have cached entries, so a hit also
+    // settles that ip is one.
+    if(!(nameiparent && *path == '\0') && (next = dcachelookup(ip, name)) != 0){
+      iput(ip);
+      ip = next;
+      continue;
+    }
+    ilockshared(ip);
     if(ip->type != T_DIR){
-      iunlockput(ip);
+      iunlockshared(ip);
+      iput(ip);
       return 0;
     }
     if(nameiparent && *path == '\0'){
       // Stop one level early.
-      iunlock(ip);
+      iunlockshared(ip);
       return ip;
     }
-    if((next = dirlookup(ip, name, 0)) == 0){
-      iunlockput(ip);
+    __sync_fetch_and_add(&dcache.misses, 1);
+    next = dirlookup(ip, name, 0);
+    if(next)
+      dcacheadd(ip, name, next->inum);
+    iunlockshared(ip);
+    iput(ip);
+    if(next == 0)
       return 0;
-    }
-    iunlockput(ip);
     ip = next;
   }
   if(nameiparent){
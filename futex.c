@@ -0,0 +1,78 @@
+// Futexes: sleeping until a word of user memory changes.
+//
+// A futex is named by the kernel address of its user word, so
+// the threads of an address space, which map the same page at
+// the same virtual address, meet on the same channel.
+// futexlock orders futexwait()'s look at the word against
+// futexwake(): a waker changes the word before calling
+// futexwake(), so a waiter either sees the change or is asleep
+// by the time the wakeup comes.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+static struct spinlock futexlock;
+
+void
+futexinit(void)
+{
+  initlock(&futexlock, "futex");
+}
+
+// Kernel address of the aligned user word at uaddr, or 0.
+static uint*
+futexaddr(uint uaddr)
+{
+  char *page;
+
+  if(uaddr % sizeof(uint) != 0 || uaddr >= proc->sz)
+    return 0;
+  if((page = uva2ka(proc->pgdir, (char*)uaddr)) == 0)
+    return 0;
+  return (uint*)(page + (uaddr & (PGSIZE - 1)));
+}
+
+// Sleep until woken by futexwake() if the word at uaddr
+// still holds val.  Return 1 if it did not, -1 if uaddr is
+// bad or the process was killed, 0 otherwise.  Callers must
+// check the word again: wakeups may be spurious.
+int
+futexwait(uint uaddr, uint val)
+{
+  uint *w;
+
+  if((w = futexaddr(uaddr)) == 0)
+    return -1;
+  acquire(&futexlock);
+  if(*w != val){
+    release(&futexlock);
+    return 1;
+  }
+  if(proc->killed){
+    release(&futexlock);
+    return -1;
+  }
+  sleep(w, &futexlock);
+  release(&futexlock);
+  return 0;
+}
+
+// Wake at most n waiters on the word at uaddr, or all of
+// them if n is negative.  Return how many were woken.
+int
+futexwake(uint uaddr, int n)
+{
+  uint *w;
+  int r;
+
+  if((w = futexaddr(uaddr)) == 0)
+    return -1;
+  acquire(&futexlock);
+  r = wakeupn(w, n);
+  release(&futexlock);
+  return r;
+}
@@ -0,0 +1,1734 @@
+
+_futextest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <adder>:
+static volatile int slot, full;
+static volatile uint sum;
+
+static void
+adder(void *arg)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < COUNT; i++){
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+   d:	eb 31                	jmp    40 <adder+0x40>
+    mutex_lock(&lock);
+   f:	83 ec 0c             	sub    $0xc,%esp
+  12:	68 00 11 00 00       	push   $0x1100
+  17:	e8 35 08 00 00       	call   851 <mutex_lock>
+  1c:	83 c4 10             	add    $0x10,%esp
+    counter = counter + 1;
+  1f:	a1 0c 11 00 00       	mov    0x110c,%eax
+  24:	83 c0 01             	add    $0x1,%eax
+  27:	a3 0c 11 00 00       	mov    %eax,0x110c
+    mutex_unlock(&lock);
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	68 00 11 00 00       	push   $0x1100
+  34:	e8 81 08 00 00       	call   8ba <mutex_unlock>
+  39:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < COUNT; i++){
+  3c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  40:	81 7d f4 1f 4e 00 00 	cmpl   $0x4e1f,-0xc(%ebp)
+  47:	7e c6                	jle    f <adder+0xf>
+  }
+}
+  49:	90                   	nop
+  4a:	90                   	nop
+  4b:	c9                   	leave
+  4c:	c3                   	ret
+
+0000004d <producer>:
+
+static void
+producer(void *arg)
+{
+  4d:	55                   	push   %ebp
+  4e:	89 e5                	mov    %esp,%ebp
+  50:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 1; i <= NITEM; i++){
+  53:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  5a:	eb 66                	jmp    c2 <producer+0x75>
+    mutex_lock(&lock);
+  5c:	83 ec 0c             	sub    $0xc,%esp
+  5f:	68 00 11 00 00       	push   $0x1100
+  64:	e8 e8 07 00 00       	call   851 <mutex_lock>
+  69:	83 c4 10             	add    $0x10,%esp
+    while(full)
+  6c:	eb 15                	jmp    83 <producer+0x36>
+      cond_wait(&nonfull, &lock);
+  6e:	83 ec 08             	sub    $0x8,%esp
+  71:	68 00 11 00 00       	push   $0x1100
+  76:	68 08 11 00 00       	push   $0x1108
+  7b:	e8 7f 08 00 00       	call   8ff <cond_wait>
+  80:	83 c4 10             	add    $0x10,%esp
+    while(full)
+  83:	a1 14 11 00 00       	mov    0x1114,%eax
+  88:	85 c0                	test   %eax,%eax
+  8a:	75 e2                	jne    6e <producer+0x21>
+    slot = i;
+  8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8f:	a3 10 11 00 00       	mov    %eax,0x1110
+    full = 1;
+  94:	c7 05 14 11 00 00 01 	movl   $0x1,0x1114
+  9b:	00 00 00 
+    cond_signal(&nonempty);
+  9e:	83 ec 0c             	sub    $0xc,%esp
+  a1:	68 04 11 00 00       	push   $0x1104
+  a6:	e8 ae 08 00 00       	call   959 <cond_signal>
+  ab:	83 c4 10             	add    $0x10,%esp
+    mutex_unlock(&lock);
+  ae:	83 ec 0c             	sub    $0xc,%esp
+  b1:	68 00 11 00 00       	push   $0x1100
+  b6:	e8 ff 07 00 00       	call   8ba <mutex_unlock>
+  bb:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i <= NITEM; i++){
+  be:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  c2:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  c9:	7e 91                	jle    5c <producer+0xf>
+  }
+}
+  cb:	90                   	nop
+  cc:	90                   	nop
+  cd:	c9                   	leave
+  ce:	c3                   	ret
+
+000000cf <consumer>:
+
+static void
+consumer(void *arg)
+{
+  cf:	55                   	push   %ebp
+  d0:	89 e5                	mov    %esp,%ebp
+  d2:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < NITEM; i++){
+  d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  dc:	eb 71                	jmp    14f <consumer+0x80>
+    mutex_lock(&lock);
+  de:	83 ec 0c             	sub    $0xc,%esp
+  e1:	68 00 11 00 00       	push   $0x1100
+  e6:	e8 66 07 00 00       	call   851 <mutex_lock>
+  eb:	83 c4 10             	add    $0x10,%esp
+    while(!full)
+  ee:	eb 15                	jmp    105 <consumer+0x36>
+      cond_wait(&nonempty, &lock);
+  f0:	83 ec 08             	sub    $0x8,%esp
+  f3:	68 00 11 00 00       	push   $0x1100
+  f8:	68 04 11 00 00       	push   $0x1104
+  fd:	e8 fd 07 00 00       	call   8ff <cond_wait>
+ 102:	83 c4 10             	add    $0x10,%esp
+    while(!full)
+ 105:	a1 14 11 00 00       	mov    0x1114,%eax
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	74 e2                	je     f0 <consumer+0x21>
+    sum += slot;
+ 10e:	a1 10 11 00 00       	mov    0x1110,%eax
+ 113:	89 c2                	mov    %eax,%edx
+ 115:	a1 18 11 00 00       	mov    0x1118,%eax
+ 11a:	01 d0                	add    %edx,%eax
+ 11c:	a3 18 11 00 00       	mov    %eax,0x1118
+    full = 0;
+ 121:	c7 05 14 11 00 00 00 	movl   $0x0,0x1114
+ 128:	00 00 00 
+    cond_signal(&nonfull);
+ 12b:	83 ec 0c             	sub    $0xc,%esp
+ 12e:	68 08 11 00 00       	push   $0x1108
+ 133:	e8 21 08 00 00       	call   959 <cond_signal>
+ 138:	83 c4 10             	add    $0x10,%esp
+    mutex_unlock(&lock);
+ 13b:	83 ec 0c             	sub    $0xc,%esp
+ 13e:	68 00 11 00 00       	push   $0x1100
+ 143:	e8 72 07 00 00       	call   8ba <mutex_unlock>
+ 148:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NITEM; i++){
+ 14b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 14f:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+ 156:	7e 86                	jle    de <consumer+0xf>
+  }
+}
+ 158:	90                   	nop
+ 159:	90                   	nop
+ 15a:	c9                   	leave
+ 15b:	c3                   	ret
+
+0000015c <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 15c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 160:	83 e4 f0             	and    $0xfffffff0,%esp
+ 163:	ff 71 fc             	push   -0x4(%ecx)
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	51                   	push   %ecx
+ 16a:	83 ec 24             	sub    $0x24,%esp
+  int tid[NTHREAD], i;
+
+  printf(1, "futextest\n");
+ 16d:	83 ec 08             	sub    $0x8,%esp
+ 170:	68 3c 0d 00 00       	push   $0xd3c
+ 175:	6a 01                	push   $0x1
+ 177:	e8 c2 03 00 00       	call   53e <printf>
+ 17c:	83 c4 10             	add    $0x10,%esp
+  mutex_init(&lock);
+ 17f:	83 ec 0c             	sub    $0xc,%esp
+ 182:	68 00 11 00 00       	push   $0x1100
+ 187:	e8 b6 06 00 00       	call   842 <mutex_init>
+ 18c:	83 c4 10             	add    $0x10,%esp
+  cond_init(&nonempty);
+ 18f:	83 ec 0c             	sub    $0xc,%esp
+ 192:	68 04 11 00 00       	push   $0x1104
+ 197:	e8 54 07 00 00       	call   8f0 <cond_init>
+ 19c:	83 c4 10             	add    $0x10,%esp
+  cond_init(&nonfull);
+ 19f:	83 ec 0c             	sub    $0xc,%esp
+ 1a2:	68 08 11 00 00       	push   $0x1108
+ 1a7:	e8 44 07 00 00       	call   8f0 <cond_init>
+ 1ac:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < NTHREAD; i++)
+ 1af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1b6:	eb 3f                	jmp    1f7 <main+0x9b>
+    if((tid[i] = thread_create(adder, 0)) < 0){
+ 1b8:	83 ec 08             	sub    $0x8,%esp
+ 1bb:	6a 00                	push   $0x0
+ 1bd:	68 00 00 00 00       	push   $0x0
+ 1c2:	e8 48 05 00 00       	call   70f <thread_create>
+ 1c7:	83 c4 10             	add    $0x10,%esp
+ 1ca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1cd:	89 44 95 e4          	mov    %eax,-0x1c(%ebp,%edx,4)
+ 1d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d4:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+ 1d8:	85 c0                	test   %eax,%eax
+ 1da:	79 17                	jns    1f3 <main+0x97>
+      printf(1, "futextest: thread_create failed\n");
+ 1dc:	83 ec 08             	sub    $0x8,%esp
+ 1df:	68 48 0d 00 00       	push   $0xd48
+ 1e4:	6a 01                	push   $0x1
+ 1e6:	e8 53 03 00 00       	call   53e <printf>
+ 1eb:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 1ee:	e8 47 01 00 00       	call   33a <exit>
+  for(i = 0; i < NTHREAD; i++)
+ 1f3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1f7:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 1fb:	7e bb                	jle    1b8 <main+0x5c>
+    }
+  for(i = 0; i < NTHREAD; i++)
+ 1fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 204:	eb 17                	jmp    21d <main+0xc1>
+    thread_join(tid[i]);
+ 206:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 209:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+ 20d:	83 ec 0c             	sub    $0xc,%esp
+ 210:	50                   	push   %eax
+ 211:	e8 aa 05 00 00       	call   7c0 <thread_join>
+ 216:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NTHREAD; i++)
+ 219:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 21d:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 221:	7e e3                	jle    206 <main+0xaa>
+  if(counter != NTHREAD * COUNT){
+ 223:	a1 0c 11 00 00       	mov    0x110c,%eax
+ 228:	3d 80 38 01 00       	cmp    $0x13880,%eax
+ 22d:	74 1f                	je     24e <main+0xf2>
+    printf(1, "futextest: counter %d, want %d\n", counter, NTHREAD * COUNT);
+ 22f:	a1 0c 11 00 00       	mov    0x110c,%eax
+ 234:	68 80 38 01 00       	push   $0x13880
+ 239:	50                   	push   %eax
+ 23a:	68 6c 0d 00 00       	push   $0xd6c
+ 23f:	6a 01                	push   $0x1
+ 241:	e8 f8 02 00 00       	call   53e <printf>
+ 246:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 249:	e8 ec 00 00 00       	call   33a <exit>
+  }
+
+  tid[0] = thread_create(producer, 0);
+ 24e:	83 ec 08             	sub    $0x8,%esp
+ 251:	6a 00                	push   $0x0
+ 253:	68 4d 00 00 00       	push   $0x4d
+ 258:	e8 b2 04 00 00       	call   70f <thread_create>
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  tid[1] = thread_create(consumer, 0);
+ 263:	83 ec 08             	sub    $0x8,%esp
+ 266:	6a 00                	push   $0x0
+ 268:	68 cf 00 00 00       	push   $0xcf
+ 26d:	e8 9d 04 00 00       	call   70f <thread_create>
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(tid[0] < 0 || tid[1] < 0){
+ 278:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 27b:	85 c0                	test   %eax,%eax
+ 27d:	78 07                	js     286 <main+0x12a>
+ 27f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 282:	85 c0                	test   %eax,%eax
+ 284:	79 17                	jns    29d <main+0x141>
+    printf(1, "futextest: thread_create failed\n");
+ 286:	83 ec 08             	sub    $0x8,%esp
+ 289:	68 48 0d 00 00       	push   $0xd48
+ 28e:	6a 01                	push   $0x1
+ 290:	e8 a9 02 00 00       	call   53e <printf>
+ 295:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 298:	e8 9d 00 00 00       	call   33a <exit>
+  }
+  thread_join(tid[0]);
+ 29d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2a0:	83 ec 0c             	sub    $0xc,%esp
+ 2a3:	50                   	push   %eax
+ 2a4:	e8 17 05 00 00       	call   7c0 <thread_join>
+ 2a9:	83 c4 10             	add    $0x10,%esp
+  thread_join(tid[1]);
+ 2ac:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2af:	83 ec 0c             	sub    $0xc,%esp
+ 2b2:	50                   	push   %eax
+ 2b3:	e8 08 05 00 00       	call   7c0 <thread_join>
+ 2b8:	83 c4 10             	add    $0x10,%esp
+  if(sum != NITEM * (NITEM + 1) / 2){
+ 2bb:	a1 18 11 00 00       	mov    0x1118,%eax
+ 2c0:	3d 14 a3 07 00       	cmp    $0x7a314,%eax
+ 2c5:	74 1f                	je     2e6 <main+0x18a>
+    printf(1, "futextest: sum %d, want %d\n", sum, NITEM * (NITEM + 1) / 2);
+ 2c7:	a1 18 11 00 00       	mov    0x1118,%eax
+ 2cc:	68 14 a3 07 00       	push   $0x7a314
+ 2d1:	50                   	push   %eax
+ 2d2:	68 8c 0d 00 00       	push   $0xd8c
+ 2d7:	6a 01                	push   $0x1
+ 2d9:	e8 60 02 00 00       	call   53e <printf>
+ 2de:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2e1:	e8 54 00 00 00       	call   33a <exit>
+  }
+
+  if(futexwait(&counter, counter + 1) != 1){
+ 2e6:	a1 0c 11 00 00       	mov    0x110c,%eax
+ 2eb:	83 c0 01             	add    $0x1,%eax
+ 2ee:	83 ec 08             	sub    $0x8,%esp
+ 2f1:	50                   	push   %eax
+ 2f2:	68 0c 11 00 00       	push   $0x110c
+ 2f7:	e8 4e 01 00 00       	call   44a <futexwait>
+ 2fc:	83 c4 10             	add    $0x10,%esp
+ 2ff:	83 f8 01             	cmp    $0x1,%eax
+ 302:	74 17                	je     31b <main+0x1bf>
+    printf(1, "futextest: futexwait slept on a changed word\n");
+ 304:	83 ec 08             	sub    $0x8,%esp
+ 307:	68 a8 0d 00 00       	push   $0xda8
+ 30c:	6a 01                	push   $0x1
+ 30e:	e8 2b 02 00 00       	call   53e <printf>
+ 313:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 316:	e8 1f 00 00 00       	call   33a <exit>
+  }
+  printf(1, "futextest ok\n");
+ 31b:	83 ec 08             	sub    $0x8,%esp
+ 31e:	68 d6 0d 00 00       	push   $0xdd6
+ 323:	6a 01                	push   $0x1
+ 325:	e8 14 02 00 00       	call   53e <printf>
+ 32a:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 32d:	e8 08 00 00 00       	call   33a <exit>
+
+00000332 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 332:	b8 01 00 00 00       	mov    $0x1,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <exit>:
+SYSCALL(exit)
+ 33a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <wait>:
+SYSCALL(wait)
+ 342:	b8 03 00 00 00       	mov    $0x3,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <pipe>:
+SYSCALL(pipe)
+ 34a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <read>:
+SYSCALL(read)
+ 352:	b8 05 00 00 00       	mov    $0x5,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <write>:
+SYSCALL(write)
+ 35a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <close>:
+SYSCALL(close)
+ 362:	b8 15 00 00 00       	mov    $0x15,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <kill>:
+SYSCALL(kill)
+ 36a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <exec>:
+SYSCALL(exec)
+ 372:	b8 07 00 00 00       	mov    $0x7,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <open>:
+SYSCALL(open)
+ 37a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <mknod>:
+SYSCALL(mknod)
+ 382:	b8 11 00 00 00       	mov    $0x11,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <unlink>:
+SYSCALL(unlink)
+ 38a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <fstat>:
+SYSCALL(fstat)
+ 392:	b8 08 00 00 00       	mov    $0x8,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <link>:
+SYSCALL(link)
+ 39a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <mkdir>:
+SYSCALL(mkdir)
+ 3a2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <chdir>:
+SYSCALL(chdir)
+ 3aa:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <dup>:
+SYSCALL(dup)
+ 3b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <getpid>:
+SYSCALL(getpid)
+ 3ba:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <sbrk>:
+SYSCALL(sbrk)
+ 3c2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <sleep>:
+SYSCALL(sleep)
+ 3ca:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <uptime>:
+SYSCALL(uptime)
+ 3d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <saveProc>:
+SYSCALL(saveProc)
+ 3da:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <loadProc>:
+SYSCALL(loadProc)
+ 3e2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <setpriority>:
+SYSCALL(setpriority)
+ 3ea:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <setaffinity>:
+SYSCALL(setaffinity)
+ 3f2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <getaffinity>:
+SYSCALL(getaffinity)
+ 3fa:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <nanosleep>:
+SYSCALL(nanosleep)
+ 402:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <cpustat>:
+SYSCALL(cpustat)
+ 40a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <nanouptime>:
+SYSCALL(nanouptime)
+ 412:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <settickets>:
+SYSCALL(settickets)
+ 41a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <setdeadline>:
+SYSCALL(setdeadline)
+ 422:	b8 20 00 00 00       	mov    $0x20,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <rtstat>:
+SYSCALL(rtstat)
+ 42a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <schedstat>:
+SYSCALL(schedstat)
+ 432:	b8 22 00 00 00       	mov    $0x22,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <waitpid>:
+SYSCALL(waitpid)
+ 43a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <clone>:
+SYSCALL(clone)
+ 442:	b8 24 00 00 00       	mov    $0x24,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <futexwait>:
+SYSCALL(futexwait)
+ 44a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <futexwake>:
+SYSCALL(futexwake)
+ 452:	b8 26 00 00 00       	mov    $0x26,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <lockstat>:
+SYSCALL(lockstat)
+ 45a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <dcachestat>:
+SYSCALL(dcachestat)
+ 462:	b8 28 00 00 00       	mov    $0x28,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 46a:	55                   	push   %ebp
+ 46b:	89 e5                	mov    %esp,%ebp
+ 46d:	83 ec 18             	sub    $0x18,%esp
+ 470:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 473:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 476:	83 ec 04             	sub    $0x4,%esp
+ 479:	6a 01                	push   $0x1
+ 47b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 47e:	50                   	push   %eax
+ 47f:	ff 75 08             	push   0x8(%ebp)
+ 482:	e8 d3 fe ff ff       	call   35a <write>
+ 487:	83 c4 10             	add    $0x10,%esp
+}
+ 48a:	90                   	nop
+ 48b:	c9                   	leave
+ 48c:	c3                   	ret
+
+0000048d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 48d:	55                   	push   %ebp
+ 48e:	89 e5                	mov    %esp,%ebp
+ 490:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 493:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 49a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 49e:	74 17                	je     4b7 <printint+0x2a>
+ 4a0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4a4:	79 11                	jns    4b7 <printint+0x2a>
+    neg = 1;
+ 4a6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4ad:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b0:	f7 d8                	neg    %eax
+ 4b2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4b5:	eb 06                	jmp    4bd <printint+0x30>
+  } else {
+    x = xx;
+ 4b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4bd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4c7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4ca:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4cf:	f7 f1                	div    %ecx
+ 4d1:	89 d1                	mov    %edx,%ecx
+ 4d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4d6:	8d 50 01             	lea    0x1(%eax),%edx
+ 4d9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4dc:	0f b6 91 e4 10 00 00 	movzbl 0x10e4(%ecx),%edx
+ 4e3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4ed:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f2:	f7 f1                	div    %ecx
+ 4f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4fb:	75 c7                	jne    4c4 <printint+0x37>
+  if(neg)
+ 4fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 501:	74 2d                	je     530 <printint+0xa3>
+    buf[i++] = '-';
+ 503:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 506:	8d 50 01             	lea    0x1(%eax),%edx
+ 509:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 50c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 511:	eb 1d                	jmp    530 <printint+0xa3>
+    putc(fd, buf[i]);
+ 513:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 516:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 519:	01 d0                	add    %edx,%eax
+ 51b:	0f b6 00             	movzbl (%eax),%eax
+ 51e:	0f be c0             	movsbl %al,%eax
+ 521:	83 ec 08             	sub    $0x8,%esp
+ 524:	50                   	push   %eax
+ 525:	ff 75 08             	push   0x8(%ebp)
+ 528:	e8 3d ff ff ff       	call   46a <putc>
+ 52d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 530:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 534:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 538:	79 d9                	jns    513 <printint+0x86>
+}
+ 53a:	90                   	nop
+ 53b:	90                   	nop
+ 53c:	c9                   	leave
+ 53d:	c3                   	ret
+
+0000053e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 53e:	55                   	push   %ebp
+ 53f:	89 e5                	mov    %esp,%ebp
+ 541:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 544:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 54b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 54e:	83 c0 04             	add    $0x4,%eax
+ 551:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 554:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 55b:	e9 59 01 00 00       	jmp    6b9 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 560:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 563:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 566:	01 d0                	add    %edx,%eax
+ 568:	0f b6 00             	movzbl (%eax),%eax
+ 56b:	0f be c0             	movsbl %al,%eax
+ 56e:	25 ff 00 00 00       	and    $0xff,%eax
+ 573:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 576:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 57a:	75 2c                	jne    5a8 <printf+0x6a>
+      if(c == '%'){
+ 57c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 580:	75 0c                	jne    58e <printf+0x50>
+        state = '%';
+ 582:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 589:	e9 27 01 00 00       	jmp    6b5 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 58e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 591:	0f be c0             	movsbl %al,%eax
+ 594:	83 ec 08             	sub    $0x8,%esp
+ 597:	50                   	push   %eax
+ 598:	ff 75 08             	push   0x8(%ebp)
+ 59b:	e8 ca fe ff ff       	call   46a <putc>
+ 5a0:	83 c4 10             	add    $0x10,%esp
+ 5a3:	e9 0d 01 00 00       	jmp    6b5 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5a8:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5ac:	0f 85 03 01 00 00    	jne    6b5 <printf+0x177>
+      if(c == 'd'){
+ 5b2:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5b6:	75 1e                	jne    5d6 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5b8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5bb:	8b 00                	mov    (%eax),%eax
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	6a 0a                	push   $0xa
+ 5c1:	50                   	push   %eax
+ 5c2:	ff 75 08             	push   0x8(%ebp)
+ 5c5:	e8 c3 fe ff ff       	call   48d <printint>
+ 5ca:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5cd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5d1:	e9 d8 00 00 00       	jmp    6ae <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5d6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5da:	74 06                	je     5e2 <printf+0xa4>
+ 5dc:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5e0:	75 1e                	jne    600 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5e2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5e5:	8b 00                	mov    (%eax),%eax
+ 5e7:	6a 00                	push   $0x0
+ 5e9:	6a 10                	push   $0x10
+ 5eb:	50                   	push   %eax
+ 5ec:	ff 75 08             	push   0x8(%ebp)
+ 5ef:	e8 99 fe ff ff       	call   48d <printint>
+ 5f4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5f7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5fb:	e9 ae 00 00 00       	jmp    6ae <printf+0x170>
+      } else if(c == 's'){
+ 600:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 604:	75 43                	jne    649 <printf+0x10b>
+        s = (char*)*ap;
+ 606:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 609:	8b 00                	mov    (%eax),%eax
+ 60b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 60e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 612:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 616:	75 25                	jne    63d <printf+0xff>
+          s = "(null)";
+ 618:	c7 45 f4 e4 0d 00 00 	movl   $0xde4,-0xc(%ebp)
+        while(*s != 0){
+ 61f:	eb 1c                	jmp    63d <printf+0xff>
+          putc(fd, *s);
+ 621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 624:	0f b6 00             	movzbl (%eax),%eax
+ 627:	0f be c0             	movsbl %al,%eax
+ 62a:	83 ec 08             	sub    $0x8,%esp
+ 62d:	50                   	push   %eax
+ 62e:	ff 75 08             	push   0x8(%ebp)
+ 631:	e8 34 fe ff ff       	call   46a <putc>
+ 636:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 639:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 63d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 640:	0f b6 00             	movzbl (%eax),%eax
+ 643:	84 c0                	test   %al,%al
+ 645:	75 da                	jne    621 <printf+0xe3>
+ 647:	eb 65                	jmp    6ae <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 649:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 64d:	75 1d                	jne    66c <printf+0x12e>
+        putc(fd, *ap);
+ 64f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 652:	8b 00                	mov    (%eax),%eax
+ 654:	0f be c0             	movsbl %al,%eax
+ 657:	83 ec 08             	sub    $0x8,%esp
+ 65a:	50                   	push   %eax
+ 65b:	ff 75 08             	push   0x8(%ebp)
+ 65e:	e8 07 fe ff ff       	call   46a <putc>
+ 663:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 666:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 66a:	eb 42                	jmp    6ae <printf+0x170>
+      } else if(c == '%'){
+ 66c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 670:	75 17                	jne    689 <printf+0x14b>
+        putc(fd, c);
+ 672:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 675:	0f be c0             	movsbl %al,%eax
+ 678:	83 ec 08             	sub    $0x8,%esp
+ 67b:	50                   	push   %eax
+ 67c:	ff 75 08             	push   0x8(%ebp)
+ 67f:	e8 e6 fd ff ff       	call   46a <putc>
+ 684:	83 c4 10             	add    $0x10,%esp
+ 687:	eb 25                	jmp    6ae <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 689:	83 ec 08             	sub    $0x8,%esp
+ 68c:	6a 25                	push   $0x25
+ 68e:	ff 75 08             	push   0x8(%ebp)
+ 691:	e8 d4 fd ff ff       	call   46a <putc>
+ 696:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 699:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 69c:	0f be c0             	movsbl %al,%eax
+ 69f:	83 ec 08             	sub    $0x8,%esp
+ 6a2:	50                   	push   %eax
+ 6a3:	ff 75 08             	push   0x8(%ebp)
+ 6a6:	e8 bf fd ff ff       	call   46a <putc>
+ 6ab:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6ae:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6b5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6bc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6bf:	01 d0                	add    %edx,%eax
+ 6c1:	0f b6 00             	movzbl (%eax),%eax
+ 6c4:	84 c0                	test   %al,%al
+ 6c6:	0f 85 94 fe ff ff    	jne    560 <printf+0x22>
+    }
+  }
+}
+ 6cc:	90                   	nop
+ 6cd:	90                   	nop
+ 6ce:	c9                   	leave
+ 6cf:	c3                   	ret
+
+000006d0 <xchg>:
+  return t;
+}
+
+static inline uint
+xchg(volatile uint *addr, uint newval)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	83 ec 10             	sub    $0x10,%esp
+  uint result;
+  
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 6d6:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 6df:	f0 87 02             	lock xchg %eax,(%edx)
+ 6e2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+ 6e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 6e8:	c9                   	leave
+ 6e9:	c3                   	ret
+
+000006ea <threadstart>:
+  void *stack;
+} threads[NTHREAD];
+
+static void
+threadstart(void *a)
+{
+ 6ea:	55                   	push   %ebp
+ 6eb:	89 e5                	mov    %esp,%ebp
+ 6ed:	83 ec 18             	sub    $0x18,%esp
+  struct tstart *t;
+
+  t = a;
+ 6f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t->fn(t->arg);
+ 6f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f9:	8b 00                	mov    (%eax),%eax
+ 6fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 6fe:	8b 52 04             	mov    0x4(%edx),%edx
+ 701:	83 ec 0c             	sub    $0xc,%esp
+ 704:	52                   	push   %edx
+ 705:	ff d0                	call   *%eax
+ 707:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 70a:	e8 2b fc ff ff       	call   33a <exit>
+
+0000070f <thread_create>:
+}
+
+// Start fn(arg) in a new thread and return its id, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 70f:	55                   	push   %ebp
+ 710:	89 e5                	mov    %esp,%ebp
+ 712:	83 ec 18             	sub    $0x18,%esp
+  struct tstart *t;
+  int i, tid;
+
+  for(i = 0; i < NTHREAD && threads[i].stack; i++)
+ 715:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 71c:	eb 04                	jmp    722 <thread_create+0x13>
+ 71e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 722:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ 726:	7f 0e                	jg     736 <thread_create+0x27>
+ 728:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72b:	8b 04 c5 24 11 00 00 	mov    0x1124(,%eax,8),%eax
+ 732:	85 c0                	test   %eax,%eax
+ 734:	75 e8                	jne    71e <thread_create+0xf>
+    ;
+  if(i == NTHREAD || (t = malloc(TSTACK)) == 0)
+ 736:	83 7d f4 40          	cmpl   $0x40,-0xc(%ebp)
+ 73a:	74 19                	je     755 <thread_create+0x46>
+ 73c:	83 ec 0c             	sub    $0xc,%esp
+ 73f:	68 00 10 00 00       	push   $0x1000
+ 744:	e8 15 05 00 00       	call   c5e <malloc>
+ 749:	83 c4 10             	add    $0x10,%esp
+ 74c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 74f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 753:	75 07                	jne    75c <thread_create+0x4d>
+    return -1;
+ 755:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 75a:	eb 62                	jmp    7be <thread_create+0xaf>
+  t->fn = fn;
+ 75c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 75f:	8b 55 08             	mov    0x8(%ebp),%edx
+ 762:	89 10                	mov    %edx,(%eax)
+  t->arg = arg;
+ 764:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 767:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 76a:	89 50 04             	mov    %edx,0x4(%eax)
+  if((tid = clone(threadstart, t, t)) < 0){
+ 76d:	83 ec 04             	sub    $0x4,%esp
+ 770:	ff 75 f0             	push   -0x10(%ebp)
+ 773:	ff 75 f0             	push   -0x10(%ebp)
+ 776:	68 ea 06 00 00       	push   $0x6ea
+ 77b:	e8 c2 fc ff ff       	call   442 <clone>
+ 780:	83 c4 10             	add    $0x10,%esp
+ 783:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 786:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 78a:	79 15                	jns    7a1 <thread_create+0x92>
+    free(t);
+ 78c:	83 ec 0c             	sub    $0xc,%esp
+ 78f:	ff 75 f0             	push   -0x10(%ebp)
+ 792:	e8 72 04 00 00       	call   c09 <free>
+ 797:	83 c4 10             	add    $0x10,%esp
+    return -1;
+ 79a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 79f:	eb 1d                	jmp    7be <thread_create+0xaf>
+  }
+  threads[i].tid = tid;
+ 7a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7a4:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 7a7:	89 14 c5 20 11 00 00 	mov    %edx,0x1120(,%eax,8)
+  threads[i].stack = t;
+ 7ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7b1:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 7b4:	89 14 c5 24 11 00 00 	mov    %edx,0x1124(,%eax,8)
+  return tid;
+ 7bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ 7be:	c9                   	leave
+ 7bf:	c3                   	ret
+
+000007c0 <thread_join>:
+
+// Wait for thread tid to finish and free its stack.
+// Return tid, or -1 if it is not a thread we created.
+int
+thread_join(int tid)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < NTHREAD; i++){
+ 7c6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 7cd:	eb 66                	jmp    835 <thread_join+0x75>
+    if(threads[i].stack && threads[i].tid == tid){
+ 7cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d2:	8b 04 c5 24 11 00 00 	mov    0x1124(,%eax,8),%eax
+ 7d9:	85 c0                	test   %eax,%eax
+ 7db:	74 54                	je     831 <thread_join+0x71>
+ 7dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7e0:	8b 04 c5 20 11 00 00 	mov    0x1120(,%eax,8),%eax
+ 7e7:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 7ea:	75 45                	jne    831 <thread_join+0x71>
+      if(waitpid(tid, 0) != tid)
+ 7ec:	83 ec 08             	sub    $0x8,%esp
+ 7ef:	6a 00                	push   $0x0
+ 7f1:	ff 75 08             	push   0x8(%ebp)
+ 7f4:	e8 41 fc ff ff       	call   43a <waitpid>
+ 7f9:	83 c4 10             	add    $0x10,%esp
+ 7fc:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 7ff:	74 07                	je     808 <thread_join+0x48>
+        return -1;
+ 801:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 806:	eb 38                	jmp    840 <thread_join+0x80>
+      free(threads[i].stack);
+ 808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 80b:	8b 04 c5 24 11 00 00 	mov    0x1124(,%eax,8),%eax
+ 812:	83 ec 0c             	sub    $0xc,%esp
+ 815:	50                   	push   %eax
+ 816:	e8 ee 03 00 00       	call   c09 <free>
+ 81b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ 81e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 821:	c7 04 c5 24 11 00 00 	movl   $0x0,0x1124(,%eax,8)
+ 828:	00 00 00 00 
+      return tid;
+ 82c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 82f:	eb 0f                	jmp    840 <thread_join+0x80>
+  for(i = 0; i < NTHREAD; i++){
+ 831:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 835:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ 839:	7e 94                	jle    7cf <thread_join+0xf>
+    }
+  }
+  return -1;
+ 83b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 840:	c9                   	leave
+ 841:	c3                   	ret
+
+00000842 <mutex_init>:
+// Mutexes and condition variables on futexes.  Neither
+// enters the kernel unless a thread has to wait.
+
+void
+mutex_init(struct mutex *m)
+{
+ 842:	55                   	push   %ebp
+ 843:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 845:	8b 45 08             	mov    0x8(%ebp),%eax
+ 848:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 84e:	90                   	nop
+ 84f:	5d                   	pop    %ebp
+ 850:	c3                   	ret
+
+00000851 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 851:	55                   	push   %ebp
+ 852:	89 e5                	mov    %esp,%ebp
+ 854:	83 ec 18             	sub    $0x18,%esp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ 857:	8b 55 08             	mov    0x8(%ebp),%edx
+ 85a:	b8 00 00 00 00       	mov    $0x0,%eax
+ 85f:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 864:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ 868:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 86b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 86f:	74 46                	je     8b7 <mutex_lock+0x66>
+    return;
+  // Mark the mutex contended, so the holder's unlock wakes us.
+  if(c != 2)
+ 871:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 875:	74 38                	je     8af <mutex_lock+0x5e>
+    c = xchg(&m->state, 2);
+ 877:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87a:	6a 02                	push   $0x2
+ 87c:	50                   	push   %eax
+ 87d:	e8 4e fe ff ff       	call   6d0 <xchg>
+ 882:	83 c4 08             	add    $0x8,%esp
+ 885:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 888:	eb 25                	jmp    8af <mutex_lock+0x5e>
+    futexwait(&m->state, 2);
+ 88a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 88d:	83 ec 08             	sub    $0x8,%esp
+ 890:	6a 02                	push   $0x2
+ 892:	50                   	push   %eax
+ 893:	e8 b2 fb ff ff       	call   44a <futexwait>
+ 898:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 89b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89e:	83 ec 08             	sub    $0x8,%esp
+ 8a1:	6a 02                	push   $0x2
+ 8a3:	50                   	push   %eax
+ 8a4:	e8 27 fe ff ff       	call   6d0 <xchg>
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 8af:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b3:	75 d5                	jne    88a <mutex_lock+0x39>
+ 8b5:	eb 01                	jmp    8b8 <mutex_lock+0x67>
+    return;
+ 8b7:	90                   	nop
+  }
+}
+ 8b8:	c9                   	leave
+ 8b9:	c3                   	ret
+
+000008ba <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 8ba:	55                   	push   %ebp
+ 8bb:	89 e5                	mov    %esp,%ebp
+ 8bd:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ 8c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 8c8:	f7 da                	neg    %edx
+ 8ca:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ 8ce:	83 fa 01             	cmp    $0x1,%edx
+ 8d1:	74 1a                	je     8ed <mutex_unlock+0x33>
+    m->state = 0;
+ 8d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futexwake(&m->state, 1);
+ 8dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8df:	83 ec 08             	sub    $0x8,%esp
+ 8e2:	6a 01                	push   $0x1
+ 8e4:	50                   	push   %eax
+ 8e5:	e8 68 fb ff ff       	call   452 <futexwake>
+ 8ea:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ 8ed:	90                   	nop
+ 8ee:	c9                   	leave
+ 8ef:	c3                   	ret
+
+000008f0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 8f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 8fc:	90                   	nop
+ 8fd:	5d                   	pop    %ebp
+ 8fe:	c3                   	ret
+
+000008ff <cond_wait>:
+
+// Release m and wait for a signal, then take m again.
+// Like any condition variable, it may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 8ff:	55                   	push   %ebp
+ 900:	89 e5                	mov    %esp,%ebp
+ 902:	83 ec 18             	sub    $0x18,%esp
+  uint seq;
+
+  seq = c->seq;
+ 905:	8b 45 08             	mov    0x8(%ebp),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 90d:	83 ec 0c             	sub    $0xc,%esp
+ 910:	ff 75 0c             	push   0xc(%ebp)
+ 913:	e8 a2 ff ff ff       	call   8ba <mutex_unlock>
+ 918:	83 c4 10             	add    $0x10,%esp
+  futexwait(&c->seq, seq);
+ 91b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91e:	83 ec 08             	sub    $0x8,%esp
+ 921:	ff 75 f4             	push   -0xc(%ebp)
+ 924:	50                   	push   %eax
+ 925:	e8 20 fb ff ff       	call   44a <futexwait>
+ 92a:	83 c4 10             	add    $0x10,%esp
+  // Others may be waiting on m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+ 92d:	eb 11                	jmp    940 <cond_wait+0x41>
+    futexwait(&m->state, 2);
+ 92f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 932:	83 ec 08             	sub    $0x8,%esp
+ 935:	6a 02                	push   $0x2
+ 937:	50                   	push   %eax
+ 938:	e8 0d fb ff ff       	call   44a <futexwait>
+ 93d:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 940:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 943:	83 ec 08             	sub    $0x8,%esp
+ 946:	6a 02                	push   $0x2
+ 948:	50                   	push   %eax
+ 949:	e8 82 fd ff ff       	call   6d0 <xchg>
+ 94e:	83 c4 10             	add    $0x10,%esp
+ 951:	85 c0                	test   %eax,%eax
+ 953:	75 da                	jne    92f <cond_wait+0x30>
+}
+ 955:	90                   	nop
+ 956:	90                   	nop
+ 957:	c9                   	leave
+ 958:	c3                   	ret
+
+00000959 <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ 959:	55                   	push   %ebp
+ 95a:	89 e5                	mov    %esp,%ebp
+ 95c:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ 95f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 962:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futexwake(&c->seq, 1);
+ 966:	8b 45 08             	mov    0x8(%ebp),%eax
+ 969:	83 ec 08             	sub    $0x8,%esp
+ 96c:	6a 01                	push   $0x1
+ 96e:	50                   	push   %eax
+ 96f:	e8 de fa ff ff       	call   452 <futexwake>
+ 974:	83 c4 10             	add    $0x10,%esp
+}
+ 977:	90                   	nop
+ 978:	c9                   	leave
+ 979:	c3                   	ret
+
+0000097a <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 97a:	55                   	push   %ebp
+ 97b:	89 e5                	mov    %esp,%ebp
+ 97d:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ 980:	8b 45 08             	mov    0x8(%ebp),%eax
+ 983:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futexwake(&c->seq, -1);
+ 987:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98a:	83 ec 08             	sub    $0x8,%esp
+ 98d:	6a ff                	push   $0xffffffff
+ 98f:	50                   	push   %eax
+ 990:	e8 bd fa ff ff       	call   452 <futexwake>
+ 995:	83 c4 10             	add    $0x10,%esp
+}
+ 998:	90                   	nop
+ 999:	c9                   	leave
+ 99a:	c3                   	ret
+
+0000099b <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+ 99b:	55                   	push   %ebp
+ 99c:	89 e5                	mov    %esp,%ebp
+ 99e:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+ 9a1:	8b 15 48 13 00 00    	mov    0x1348,%edx
+ 9a7:	a1 44 13 00 00       	mov    0x1344,%eax
+ 9ac:	29 c2                	sub    %eax,%edx
+ 9ae:	89 d0                	mov    %edx,%eax
+ 9b0:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 9b3:	0f 83 ed 00 00 00    	jae    aa6 <carve+0x10b>
+    n = size > growsz ? size : growsz;
+ 9b9:	a1 f8 10 00 00       	mov    0x10f8,%eax
+ 9be:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9c1:	39 c2                	cmp    %eax,%edx
+ 9c3:	0f 43 c2             	cmovae %edx,%eax
+ 9c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+ 9c9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9cc:	05 ff 0f 00 00       	add    $0xfff,%eax
+ 9d1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ 9d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+ 9d9:	a1 f8 10 00 00       	mov    0x10f8,%eax
+ 9de:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+ 9e3:	77 0c                	ja     9f1 <carve+0x56>
+      growsz *= 2;
+ 9e5:	a1 f8 10 00 00       	mov    0x10f8,%eax
+ 9ea:	01 c0                	add    %eax,%eax
+ 9ec:	a3 f8 10 00 00       	mov    %eax,0x10f8
+    p = sbrk(n);
+ 9f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f4:	83 ec 0c             	sub    $0xc,%esp
+ 9f7:	50                   	push   %eax
+ 9f8:	e8 c5 f9 ff ff       	call   3c2 <sbrk>
+ 9fd:	83 c4 10             	add    $0x10,%esp
+ a00:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+ a03:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a07:	75 2a                	jne    a33 <carve+0x98>
+ a09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0c:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a0f:	73 22                	jae    a33 <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+ a11:	8b 45 08             	mov    0x8(%ebp),%eax
+ a14:	05 ff 0f 00 00       	add    $0xfff,%eax
+ a19:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ a1e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+ a21:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a24:	83 ec 0c             	sub    $0xc,%esp
+ a27:	50                   	push   %eax
+ a28:	e8 95 f9 ff ff       	call   3c2 <sbrk>
+ a2d:	83 c4 10             	add    $0x10,%esp
+ a30:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+ a33:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ a37:	75 0a                	jne    a43 <carve+0xa8>
+      return 0;
+ a39:	b8 00 00 00 00       	mov    $0x0,%eax
+ a3e:	e9 86 00 00 00       	jmp    ac9 <carve+0x12e>
+    if(p != limit){
+ a43:	a1 48 13 00 00       	mov    0x1348,%eax
+ a48:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ a4b:	74 4c                	je     a99 <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+ a4d:	8b 15 48 13 00 00    	mov    0x1348,%edx
+ a53:	a1 44 13 00 00       	mov    0x1344,%eax
+ a58:	29 c2                	sub    %eax,%edx
+ a5a:	83 fa 0f             	cmp    $0xf,%edx
+ a5d:	7e 32                	jle    a91 <carve+0xf6>
+        b = (Block*)top;
+ a5f:	a1 44 13 00 00       	mov    0x1344,%eax
+ a64:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+ a67:	8b 15 48 13 00 00    	mov    0x1348,%edx
+ a6d:	a1 44 13 00 00       	mov    0x1344,%eax
+ a72:	29 c2                	sub    %eax,%edx
+ a74:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a77:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+ a79:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a7c:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	ff 75 ec             	push   -0x14(%ebp)
+ a89:	e8 3d 00 00 00       	call   acb <lfree>
+ a8e:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+ a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a94:	a3 44 13 00 00       	mov    %eax,0x1344
+    }
+    limit = p + n;
+ a99:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ a9c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a9f:	01 d0                	add    %edx,%eax
+ aa1:	a3 48 13 00 00       	mov    %eax,0x1348
+  }
+  b = (Block*)top;
+ aa6:	a1 44 13 00 00       	mov    0x1344,%eax
+ aab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+ aae:	8b 15 44 13 00 00    	mov    0x1344,%edx
+ ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab7:	01 d0                	add    %edx,%eax
+ ab9:	a3 44 13 00 00       	mov    %eax,0x1344
+  b->h.size = size;
+ abe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ac1:	8b 55 08             	mov    0x8(%ebp),%edx
+ ac4:	89 10                	mov    %edx,(%eax)
+  return b;
+ ac6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ ac9:	c9                   	leave
+ aca:	c3                   	ret
+
+00000acb <lfree>:
+
+static void
+lfree(Block *b)
+{
+ acb:	55                   	push   %ebp
+ acc:	89 e5                	mov    %esp,%ebp
+ ace:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+ ad1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ ad8:	a1 40 13 00 00       	mov    0x1340,%eax
+ add:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ae0:	eb 0f                	jmp    af1 <lfree+0x26>
+    prev = p;
+ ae2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ ae8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aeb:	8b 40 08             	mov    0x8(%eax),%eax
+ aee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ af1:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ af5:	74 08                	je     aff <lfree+0x34>
+ af7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afa:	3b 45 08             	cmp    0x8(%ebp),%eax
+ afd:	72 e3                	jb     ae2 <lfree+0x17>
+  b->next = p;
+ aff:	8b 45 08             	mov    0x8(%ebp),%eax
+ b02:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ b05:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+ b08:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ b0c:	74 2c                	je     b3a <lfree+0x6f>
+ b0e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b11:	8b 10                	mov    (%eax),%edx
+ b13:	8b 45 08             	mov    0x8(%ebp),%eax
+ b16:	01 d0                	add    %edx,%eax
+ b18:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b1b:	75 1d                	jne    b3a <lfree+0x6f>
+    b->h.size += p->h.size;
+ b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b20:	8b 10                	mov    (%eax),%edx
+ b22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b25:	8b 00                	mov    (%eax),%eax
+ b27:	01 c2                	add    %eax,%edx
+ b29:	8b 45 08             	mov    0x8(%ebp),%eax
+ b2c:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+ b2e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b31:	8b 50 08             	mov    0x8(%eax),%edx
+ b34:	8b 45 08             	mov    0x8(%ebp),%eax
+ b37:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+ b3a:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ b3e:	74 2e                	je     b6e <lfree+0xa3>
+ b40:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b43:	8b 10                	mov    (%eax),%edx
+ b45:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b48:	01 d0                	add    %edx,%eax
+ b4a:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b4d:	75 1f                	jne    b6e <lfree+0xa3>
+    prev->h.size += b->h.size;
+ b4f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b52:	8b 10                	mov    (%eax),%edx
+ b54:	8b 45 08             	mov    0x8(%ebp),%eax
+ b57:	8b 00                	mov    (%eax),%eax
+ b59:	01 c2                	add    %eax,%edx
+ b5b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5e:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+ b60:	8b 45 08             	mov    0x8(%ebp),%eax
+ b63:	8b 50 08             	mov    0x8(%eax),%edx
+ b66:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b69:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+ b6c:	eb 19                	jmp    b87 <lfree+0xbc>
+  } else if(prev)
+ b6e:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ b72:	74 0b                	je     b7f <lfree+0xb4>
+    prev->next = b;
+ b74:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b77:	8b 55 08             	mov    0x8(%ebp),%edx
+ b7a:	89 50 08             	mov    %edx,0x8(%eax)
+}
+ b7d:	eb 08                	jmp    b87 <lfree+0xbc>
+    large = b;
+ b7f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b82:	a3 40 13 00 00       	mov    %eax,0x1340
+}
+ b87:	90                   	nop
+ b88:	c9                   	leave
+ b89:	c3                   	ret
+
+00000b8a <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+ b8a:	55                   	push   %ebp
+ b8b:	89 e5                	mov    %esp,%ebp
+ b8d:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ b90:	c7 45 f0 40 13 00 00 	movl   $0x1340,-0x10(%ebp)
+ b97:	eb 52                	jmp    beb <lalloc+0x61>
+    if(p->h.size < size)
+ b99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9c:	8b 00                	mov    (%eax),%eax
+ b9e:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ba1:	72 3e                	jb     be1 <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+ ba3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba6:	8b 00                	mov    (%eax),%eax
+ ba8:	2b 45 08             	sub    0x8(%ebp),%eax
+ bab:	83 f8 0f             	cmp    $0xf,%eax
+ bae:	76 21                	jbe    bd1 <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+ bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb3:	8b 00                	mov    (%eax),%eax
+ bb5:	2b 45 08             	sub    0x8(%ebp),%eax
+ bb8:	89 c2                	mov    %eax,%edx
+ bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bbd:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+ bbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc2:	8b 00                	mov    (%eax),%eax
+ bc4:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+ bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bca:	8b 55 08             	mov    0x8(%ebp),%edx
+ bcd:	89 10                	mov    %edx,(%eax)
+ bcf:	eb 0b                	jmp    bdc <lalloc+0x52>
+    } else
+      *pp = p->next;
+ bd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd4:	8b 50 08             	mov    0x8(%eax),%edx
+ bd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bda:	89 10                	mov    %edx,(%eax)
+    return p;
+ bdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdf:	eb 26                	jmp    c07 <lalloc+0x7d>
+      continue;
+ be1:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ be2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be5:	83 c0 08             	add    $0x8,%eax
+ be8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ beb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bee:	8b 00                	mov    (%eax),%eax
+ bf0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ bf3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bf7:	75 a0                	jne    b99 <lalloc+0xf>
+  }
+  return carve(size);
+ bf9:	83 ec 0c             	sub    $0xc,%esp
+ bfc:	ff 75 08             	push   0x8(%ebp)
+ bff:	e8 97 fd ff ff       	call   99b <carve>
+ c04:	83 c4 10             	add    $0x10,%esp
+}
+ c07:	c9                   	leave
+ c08:	c3                   	ret
+
+00000c09 <free>:
+
+void
+free(void *ap)
+{
+ c09:	55                   	push   %ebp
+ c0a:	89 e5                	mov    %esp,%ebp
+ c0c:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+ c0f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ c13:	74 46                	je     c5b <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+ c15:	8b 45 08             	mov    0x8(%ebp),%eax
+ c18:	83 e8 08             	sub    $0x8,%eax
+ c1b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+ c1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c21:	8b 40 04             	mov    0x4(%eax),%eax
+ c24:	83 f8 07             	cmp    $0x7,%eax
+ c27:	77 25                	ja     c4e <free+0x45>
+    b->next = bins[b->h.bin];
+ c29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2c:	8b 40 04             	mov    0x4(%eax),%eax
+ c2f:	8b 14 85 20 13 00 00 	mov    0x1320(,%eax,4),%edx
+ c36:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c39:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+ c3c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c3f:	8b 40 04             	mov    0x4(%eax),%eax
+ c42:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ c45:	89 14 85 20 13 00 00 	mov    %edx,0x1320(,%eax,4)
+ c4c:	eb 0e                	jmp    c5c <free+0x53>
+  } else
+    lfree(b);
+ c4e:	ff 75 fc             	push   -0x4(%ebp)
+ c51:	e8 75 fe ff ff       	call   acb <lfree>
+ c56:	83 c4 04             	add    $0x4,%esp
+ c59:	eb 01                	jmp    c5c <free+0x53>
+    return;
+ c5b:	90                   	nop
+}
+ c5c:	c9                   	leave
+ c5d:	c3                   	ret
+
+00000c5e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c5e:	55                   	push   %ebp
+ c5f:	89 e5                	mov    %esp,%ebp
+ c61:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+ c64:	8b 45 08             	mov    0x8(%ebp),%eax
+ c67:	83 c0 08             	add    $0x8,%eax
+ c6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+ c6d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ c70:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c73:	73 0a                	jae    c7f <malloc+0x21>
+    return 0;
+ c75:	b8 00 00 00 00       	mov    $0x0,%eax
+ c7a:	e9 b8 00 00 00       	jmp    d37 <malloc+0xd9>
+  if(size <= MAXSMALL){
+ c7f:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+ c86:	77 6f                	ja     cf7 <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+ c88:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ c8f:	eb 04                	jmp    c95 <malloc+0x37>
+ c91:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ c95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c98:	ba 10 00 00 00       	mov    $0x10,%edx
+ c9d:	89 c1                	mov    %eax,%ecx
+ c9f:	d3 e2                	shl    %cl,%edx
+ ca1:	89 d0                	mov    %edx,%eax
+ ca3:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ca6:	72 e9                	jb     c91 <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+ ca8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cab:	8b 04 85 20 13 00 00 	mov    0x1320(,%eax,4),%eax
+ cb2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cb5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cb9:	74 12                	je     ccd <malloc+0x6f>
+      bins[bin] = b->next;
+ cbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cbe:	8b 50 08             	mov    0x8(%eax),%edx
+ cc1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc4:	89 14 85 20 13 00 00 	mov    %edx,0x1320(,%eax,4)
+ ccb:	eb 5b                	jmp    d28 <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+ ccd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cd0:	ba 10 00 00 00       	mov    $0x10,%edx
+ cd5:	89 c1                	mov    %eax,%ecx
+ cd7:	d3 e2                	shl    %cl,%edx
+ cd9:	89 d0                	mov    %edx,%eax
+ cdb:	83 ec 0c             	sub    $0xc,%esp
+ cde:	50                   	push   %eax
+ cdf:	e8 b7 fc ff ff       	call   99b <carve>
+ ce4:	83 c4 10             	add    $0x10,%esp
+ ce7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cea:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cee:	75 38                	jne    d28 <malloc+0xca>
+      return 0;
+ cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+ cf5:	eb 40                	jmp    d37 <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ cf7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ cfa:	83 c0 07             	add    $0x7,%eax
+ cfd:	83 e0 f8             	and    $0xfffffff8,%eax
+ d00:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+ d03:	83 ec 0c             	sub    $0xc,%esp
+ d06:	ff 75 ec             	push   -0x14(%ebp)
+ d09:	e8 7c fe ff ff       	call   b8a <lalloc>
+ d0e:	83 c4 10             	add    $0x10,%esp
+ d11:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d14:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d18:	75 07                	jne    d21 <malloc+0xc3>
+      return 0;
+ d1a:	b8 00 00 00 00       	mov    $0x0,%eax
+ d1f:	eb 16                	jmp    d37 <malloc+0xd9>
+    bin = LARGE;
+ d21:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+ d28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2b:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ d2e:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+ d31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d34:	83 c0 08             	add    $0x8,%eax
+}
+ d37:	c9                   	leave
+ d38:	c3                   	ret
@@ -0,0 +1,105 @@
+// Test futex-based mutexes and condition variables: threads
+// bump a shared counter with plain, non-atomic increments under
+// a mutex, then pass items through a one-slot buffer guarded by
+// a mutex and two condition variables.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NTHREAD 4
+#define COUNT   20000
+#define NITEM   1000
+
+static struct mutex lock;
+static struct cond nonempty, nonfull;
+static volatile uint counter;
+static volatile int slot, full;
+static volatile uint sum;
+
+static void
+adder(void *arg)
+{
+  int i;
+
+  for(i = 0; i < COUNT; i++){
+    mutex_lock(&lock);
+    counter = counter + 1;
+    mutex_unlock(&lock);
+  }
+}
+
+static void
+producer(void *arg)
+{
+  int i;
+
+  for(i = 1; i <= NITEM; i++){
+    mutex_lock(&lock);
+    while(full)
+      cond_wait(&nonfull, &lock);
+    slot = i;
+    full = 1;
+    cond_signal(&nonempty);
+    mutex_unlock(&lock);
+  }
+}
+
+static void
+consumer(void *arg)
+{
+  int i;
+
+  for(i = 0; i < NITEM; i++){
+    mutex_lock(&lock);
+    while(!full)
+      cond_wait(&nonempty, &lock);
+    sum += slot;
+    full = 0;
+    cond_signal(&nonfull);
+    mutex_unlock(&lock);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int tid[NTHREAD], i;
+
+  printf(1, "futextest\n");
+  mutex_init(&lock);
+  cond_init(&nonempty);
+  cond_init(&nonfull);
+
+  for(i = 0; i < NTHREAD; i++)
+    if((tid[i] = thread_create(adder, 0)) < 0){
+      printf(1, "futextest: thread_create failed\n");
+      exit();
+    }
+  for(i = 0; i < NTHREAD; i++)
+    thread_join(tid[i]);
+  if(counter != NTHREAD * COUNT){
+    printf(1, "futextest: counter %d, want %d\n", counter, NTHREAD * COUNT);
+    exit();
+  }
+
+  tid[0] = thread_create(producer, 0);
+  tid[1] = thread_create(consumer, 0);
+  if(tid[0] < 0 || tid[1] < 0){
+    printf(1, "futextest: thread_create failed\n");
+    exit();
+  }
+  thread_join(tid[0]);
+  thread_join(tid[1]);
+  if(sum != NITEM * (NITEM + 1) / 2){
+    printf(1, "futextest: sum %d, want %d\n", sum, NITEM * (NITEM + 1) / 2);
+    exit();
+  }
+
+  if(futexwait(&counter, counter + 1) != 1){
+    printf(1, "futextest: futexwait slept on a changed word\n");
+    exit();
+  }
+  printf(1, "futextest ok\n");
+  exit();
+}
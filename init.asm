@@ -0,0 +1,644 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 a2 04 00 00       	push   $0x4a2
+  1b:	e8 29 01 00 00       	call   149 <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 a2 04 00 00       	push   $0x4a2
+  33:	e8 19 01 00 00       	call   151 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 a2 04 00 00       	push   $0x4a2
+  45:	e8 ff 00 00 00       	call   149 <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 2a 01 00 00       	call   181 <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 1d 01 00 00       	call   181 <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 aa 04 00 00       	push   $0x4aa
+  6f:	6a 01                	push   $0x1
+  71:	e8 97 02 00 00       	call   30d <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 83 00 00 00       	call   101 <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 bd 04 00 00       	push   $0x4bd
+  8f:	6a 01                	push   $0x1
+  91:	e8 77 02 00 00       	call   30d <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 6b 00 00 00       	call   109 <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 94 05 00 00       	push   $0x594
+  ac:	68 9f 04 00 00       	push   $0x49f
+  b1:	e8 8b 00 00 00       	call   141 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 d0 04 00 00       	push   $0x4d0
+  c1:	6a 01                	push   $0x1
+  c3:	e8 45 02 00 00       	call   30d <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 39 00 00 00       	call   109 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 e6 04 00 00       	push   $0x4e6
+  d8:	6a 01                	push   $0x1
+  da:	e8 2e 02 00 00       	call   30d <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 2a 00 00 00       	call   111 <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 101:	b8 01 00 00 00       	mov    $0x1,%eax
+ 106:	cd 40                	int    $0x40
+ 108:	c3                   	ret
+
+00000109 <exit>:
+SYSCALL(exit)
+ 109:	b8 02 00 00 00       	mov    $0x2,%eax
+ 10e:	cd 40                	int    $0x40
+ 110:	c3                   	ret
+
+00000111 <wait>:
+SYSCALL(wait)
+ 111:	b8 03 00 00 00       	mov    $0x3,%eax
+ 116:	cd 40                	int    $0x40
+ 118:	c3                   	ret
+
+00000119 <pipe>:
+SYSCALL(pipe)
+ 119:	b8 04 00 00 00       	mov    $0x4,%eax
+ 11e:	cd 40                	int    $0x40
+ 120:	c3                   	ret
+
+00000121 <read>:
+SYSCALL(read)
+ 121:	b8 05 00 00 00       	mov    $0x5,%eax
+ 126:	cd 40                	int    $0x40
+ 128:	c3                   	ret
+
+00000129 <write>:
+SYSCALL(write)
+ 129:	b8 10 00 00 00       	mov    $0x10,%eax
+ 12e:	cd 40                	int    $0x40
+ 130:	c3                   	ret
+
+00000131 <close>:
+SYSCALL(close)
+ 131:	b8 15 00 00 00       	mov    $0x15,%eax
+ 136:	cd 40                	int    $0x40
+ 138:	c3                   	ret
+
+00000139 <kill>:
+SYSCALL(kill)
+ 139:	b8 06 00 00 00       	mov    $0x6,%eax
+ 13e:	cd 40                	int    $0x40
+ 140:	c3                   	ret
+
+00000141 <exec>:
+SYSCALL(exec)
+ 141:	b8 07 00 00 00       	mov    $0x7,%eax
+ 146:	cd 40                	int    $0x40
+ 148:	c3                   	ret
+
+00000149 <open>:
+SYSCALL(open)
+ 149:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 14e:	cd 40                	int    $0x40
+ 150:	c3                   	ret
+
+00000151 <mknod>:
+SYSCALL(mknod)
+ 151:	b8 11 00 00 00       	mov    $0x11,%eax
+ 156:	cd 40                	int    $0x40
+ 158:	c3                   	ret
+
+00000159 <unlink>:
+SYSCALL(unlink)
+ 159:	b8 12 00 00 00       	mov    $0x12,%eax
+ 15e:	cd 40                	int    $0x40
+ 160:	c3                   	ret
+
+00000161 <fstat>:
+SYSCALL(fstat)
+ 161:	b8 08 00 00 00       	mov    $0x8,%eax
+ 166:	cd 40                	int    $0x40
+ 168:	c3                   	ret
+
+00000169 <link>:
+SYSCALL(link)
+ 169:	b8 13 00 00 00       	mov    $0x13,%eax
+ 16e:	cd 40                	int    $0x40
+ 170:	c3                   	ret
+
+00000171 <mkdir>:
+SYSCALL(mkdir)
+ 171:	b8 14 00 00 00       	mov    $0x14,%eax
+ 176:	cd 40                	int    $0x40
+ 178:	c3                   	ret
+
+00000179 <chdir>:
+SYSCALL(chdir)
+ 179:	b8 09 00 00 00       	mov    $0x9,%eax
+ 17e:	cd 40                	int    $0x40
+ 180:	c3                   	ret
+
+00000181 <dup>:
+SYSCALL(dup)
+ 181:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 186:	cd 40                	int    $0x40
+ 188:	c3                   	ret
+
+00000189 <getpid>:
+SYSCALL(getpid)
+ 189:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 18e:	cd 40                	int    $0x40
+ 190:	c3                   	ret
+
+00000191 <sbrk>:
+SYSCALL(sbrk)
+ 191:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 196:	cd 40                	int    $0x40
+ 198:	c3                   	ret
+
+00000199 <sleep>:
+SYSCALL(sleep)
+ 199:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 19e:	cd 40                	int    $0x40
+ 1a0:	c3                   	ret
+
+000001a1 <uptime>:
+SYSCALL(uptime)
+ 1a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 1a6:	cd 40                	int    $0x40
+ 1a8:	c3                   	ret
+
+000001a9 <saveProc>:
+SYSCALL(saveProc)
+ 1a9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 1ae:	cd 40                	int    $0x40
+ 1b0:	c3                   	ret
+
+000001b1 <loadProc>:
+SYSCALL(loadProc)
+ 1b1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 1b6:	cd 40                	int    $0x40
+ 1b8:	c3                   	ret
+
+000001b9 <setpriority>:
+SYSCALL(setpriority)
+ 1b9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 1be:	cd 40                	int    $0x40
+ 1c0:	c3                   	ret
+
+000001c1 <setaffinity>:
+SYSCALL(setaffinity)
+ 1c1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 1c6:	cd 40                	int    $0x40
+ 1c8:	c3                   	ret
+
+000001c9 <getaffinity>:
+SYSCALL(getaffinity)
+ 1c9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 1ce:	cd 40                	int    $0x40
+ 1d0:	c3                   	ret
+
+000001d1 <nanosleep>:
+SYSCALL(nanosleep)
+ 1d1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 1d6:	cd 40                	int    $0x40
+ 1d8:	c3                   	ret
+
+000001d9 <cpustat>:
+SYSCALL(cpustat)
+ 1d9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 1de:	cd 40                	int    $0x40
+ 1e0:	c3                   	ret
+
+000001e1 <nanouptime>:
+SYSCALL(nanouptime)
+ 1e1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 1e6:	cd 40                	int    $0x40
+ 1e8:	c3                   	ret
+
+000001e9 <settickets>:
+SYSCALL(settickets)
+ 1e9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 1ee:	cd 40                	int    $0x40
+ 1f0:	c3                   	ret
+
+000001f1 <setdeadline>:
+SYSCALL(setdeadline)
+ 1f1:	b8 20 00 00 00       	mov    $0x20,%eax
+ 1f6:	cd 40                	int    $0x40
+ 1f8:	c3                   	ret
+
+000001f9 <rtstat>:
+SYSCALL(rtstat)
+ 1f9:	b8 21 00 00 00       	mov    $0x21,%eax
+ 1fe:	cd 40                	int    $0x40
+ 200:	c3                   	ret
+
+00000201 <schedstat>:
+SYSCALL(schedstat)
+ 201:	b8 22 00 00 00       	mov    $0x22,%eax
+ 206:	cd 40                	int    $0x40
+ 208:	c3                   	ret
+
+00000209 <waitpid>:
+SYSCALL(waitpid)
+ 209:	b8 23 00 00 00       	mov    $0x23,%eax
+ 20e:	cd 40                	int    $0x40
+ 210:	c3                   	ret
+
+00000211 <clone>:
+SYSCALL(clone)
+ 211:	b8 24 00 00 00       	mov    $0x24,%eax
+ 216:	cd 40                	int    $0x40
+ 218:	c3                   	ret
+
+00000219 <futexwait>:
+SYSCALL(futexwait)
+ 219:	b8 25 00 00 00       	mov    $0x25,%eax
+ 21e:	cd 40                	int    $0x40
+ 220:	c3                   	ret
+
+00000221 <futexwake>:
+SYSCALL(futexwake)
+ 221:	b8 26 00 00 00       	mov    $0x26,%eax
+ 226:	cd 40                	int    $0x40
+ 228:	c3                   	ret
+
+00000229 <lockstat>:
+SYSCALL(lockstat)
+ 229:	b8 27 00 00 00       	mov    $0x27,%eax
+ 22e:	cd 40                	int    $0x40
+ 230:	c3                   	ret
+
+00000231 <dcachestat>:
+SYSCALL(dcachestat)
+ 231:	b8 28 00 00 00       	mov    $0x28,%eax
+ 236:	cd 40                	int    $0x40
+ 238:	c3                   	ret
+
+00000239 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 18             	sub    $0x18,%esp
+ 23f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 242:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 245:	83 ec 04             	sub    $0x4,%esp
+ 248:	6a 01                	push   $0x1
+ 24a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 24d:	50                   	push   %eax
+ 24e:	ff 75 08             	push   0x8(%ebp)
+ 251:	e8 d3 fe ff ff       	call   129 <write>
+ 256:	83 c4 10             	add    $0x10,%esp
+}
+ 259:	90                   	nop
+ 25a:	c9                   	leave
+ 25b:	c3                   	ret
+
+0000025c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 25c:	55                   	push   %ebp
+ 25d:	89 e5                	mov    %esp,%ebp
+ 25f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 262:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 269:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 26d:	74 17                	je     286 <printint+0x2a>
+ 26f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 273:	79 11                	jns    286 <printint+0x2a>
+    neg = 1;
+ 275:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 27c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 27f:	f7 d8                	neg    %eax
+ 281:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 284:	eb 06                	jmp    28c <printint+0x30>
+  } else {
+    x = xx;
+ 286:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 289:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 28c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 293:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 296:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 299:	ba 00 00 00 00       	mov    $0x0,%edx
+ 29e:	f7 f1                	div    %ecx
+ 2a0:	89 d1                	mov    %edx,%ecx
+ 2a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2a5:	8d 50 01             	lea    0x1(%eax),%edx
+ 2a8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2ab:	0f b6 91 9c 05 00 00 	movzbl 0x59c(%ecx),%edx
+ 2b2:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 2b6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2b9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 2bc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2c1:	f7 f1                	div    %ecx
+ 2c3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 2c6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2ca:	75 c7                	jne    293 <printint+0x37>
+  if(neg)
+ 2cc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2d0:	74 2d                	je     2ff <printint+0xa3>
+    buf[i++] = '-';
+ 2d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2d5:	8d 50 01             	lea    0x1(%eax),%edx
+ 2d8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2db:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 2e0:	eb 1d                	jmp    2ff <printint+0xa3>
+    putc(fd, buf[i]);
+ 2e2:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 2e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e8:	01 d0                	add    %edx,%eax
+ 2ea:	0f b6 00             	movzbl (%eax),%eax
+ 2ed:	0f be c0             	movsbl %al,%eax
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	50                   	push   %eax
+ 2f4:	ff 75 08             	push   0x8(%ebp)
+ 2f7:	e8 3d ff ff ff       	call   239 <putc>
+ 2fc:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 2ff:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 303:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 307:	79 d9                	jns    2e2 <printint+0x86>
+}
+ 309:	90                   	nop
+ 30a:	90                   	nop
+ 30b:	c9                   	leave
+ 30c:	c3                   	ret
+
+0000030d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 30d:	55                   	push   %ebp
+ 30e:	89 e5                	mov    %esp,%ebp
+ 310:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 313:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 31a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 31d:	83 c0 04             	add    $0x4,%eax
+ 320:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 323:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 32a:	e9 59 01 00 00       	jmp    488 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 32f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 332:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 335:	01 d0                	add    %edx,%eax
+ 337:	0f b6 00             	movzbl (%eax),%eax
+ 33a:	0f be c0             	movsbl %al,%eax
+ 33d:	25 ff 00 00 00       	and    $0xff,%eax
+ 342:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 345:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 349:	75 2c                	jne    377 <printf+0x6a>
+      if(c == '%'){
+ 34b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 34f:	75 0c                	jne    35d <printf+0x50>
+        state = '%';
+ 351:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 358:	e9 27 01 00 00       	jmp    484 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 35d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 360:	0f be c0             	movsbl %al,%eax
+ 363:	83 ec 08             	sub    $0x8,%esp
+ 366:	50                   	push   %eax
+ 367:	ff 75 08             	push   0x8(%ebp)
+ 36a:	e8 ca fe ff ff       	call   239 <putc>
+ 36f:	83 c4 10             	add    $0x10,%esp
+ 372:	e9 0d 01 00 00       	jmp    484 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 377:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 37b:	0f 85 03 01 00 00    	jne    484 <printf+0x177>
+      if(c == 'd'){
+ 381:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 385:	75 1e                	jne    3a5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 387:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 38a:	8b 00                	mov    (%eax),%eax
+ 38c:	6a 01                	push   $0x1
+ 38e:	6a 0a                	push   $0xa
+ 390:	50                   	push   %eax
+ 391:	ff 75 08             	push   0x8(%ebp)
+ 394:	e8 c3 fe ff ff       	call   25c <printint>
+ 399:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 39c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3a0:	e9 d8 00 00 00       	jmp    47d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 3a5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 3a9:	74 06                	je     3b1 <printf+0xa4>
+ 3ab:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 3af:	75 1e                	jne    3cf <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 3b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3b4:	8b 00                	mov    (%eax),%eax
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	6a 10                	push   $0x10
+ 3ba:	50                   	push   %eax
+ 3bb:	ff 75 08             	push   0x8(%ebp)
+ 3be:	e8 99 fe ff ff       	call   25c <printint>
+ 3c3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3c6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3ca:	e9 ae 00 00 00       	jmp    47d <printf+0x170>
+      } else if(c == 's'){
+ 3cf:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 3d3:	75 43                	jne    418 <printf+0x10b>
+        s = (char*)*ap;
+ 3d5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3d8:	8b 00                	mov    (%eax),%eax
+ 3da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 3dd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 3e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3e5:	75 25                	jne    40c <printf+0xff>
+          s = "(null)";
+ 3e7:	c7 45 f4 ef 04 00 00 	movl   $0x4ef,-0xc(%ebp)
+        while(*s != 0){
+ 3ee:	eb 1c                	jmp    40c <printf+0xff>
+          putc(fd, *s);
+ 3f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3f3:	0f b6 00             	movzbl (%eax),%eax
+ 3f6:	0f be c0             	movsbl %al,%eax
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	50                   	push   %eax
+ 3fd:	ff 75 08             	push   0x8(%ebp)
+ 400:	e8 34 fe ff ff       	call   239 <putc>
+ 405:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 408:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 40c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 40f:	0f b6 00             	movzbl (%eax),%eax
+ 412:	84 c0                	test   %al,%al
+ 414:	75 da                	jne    3f0 <printf+0xe3>
+ 416:	eb 65                	jmp    47d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 418:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 41c:	75 1d                	jne    43b <printf+0x12e>
+        putc(fd, *ap);
+ 41e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 421:	8b 00                	mov    (%eax),%eax
+ 423:	0f be c0             	movsbl %al,%eax
+ 426:	83 ec 08             	sub    $0x8,%esp
+ 429:	50                   	push   %eax
+ 42a:	ff 75 08             	push   0x8(%ebp)
+ 42d:	e8 07 fe ff ff       	call   239 <putc>
+ 432:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 435:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 439:	eb 42                	jmp    47d <printf+0x170>
+      } else if(c == '%'){
+ 43b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 43f:	75 17                	jne    458 <printf+0x14b>
+        putc(fd, c);
+ 441:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 444:	0f be c0             	movsbl %al,%eax
+ 447:	83 ec 08             	sub    $0x8,%esp
+ 44a:	50                   	push   %eax
+ 44b:	ff 75 08             	push   0x8(%ebp)
+ 44e:	e8 e6 fd ff ff       	call   239 <putc>
+ 453:	83 c4 10             	add    $0x10,%esp
+ 456:	eb 25                	jmp    47d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 458:	83 ec 08             	sub    $0x8,%esp
+ 45b:	6a 25                	push   $0x25
+ 45d:	ff 75 08             	push   0x8(%ebp)
+ 460:	e8 d4 fd ff ff       	call   239 <putc>
+ 465:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 468:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 46b:	0f be c0             	movsbl %al,%eax
+ 46e:	83 ec 08             	sub    $0x8,%esp
+ 471:	50                   	push   %eax
+ 472:	ff 75 08             	push   0x8(%ebp)
+ 475:	e8 bf fd ff ff       	call   239 <putc>
+ 47a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 47d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 484:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 488:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 48b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 48e:	01 d0                	add    %edx,%eax
+ 490:	0f b6 00             	movzbl (%eax),%eax
+ 493:	84 c0                	test   %al,%al
+ 495:	0f 85 94 fe ff ff    	jne    32f <printf+0x22>
+    }
+  }
+}
+ 49b:	90                   	nop
+ 49c:	90                   	nop
+ 49d:	c9                   	leave
+ 49e:	c3                   	ret
@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Hands out physically contiguous blocks of
+// 2^order 4096-byte pages using a binary buddy system.
 
 #include "types.h"
 #include "defs.h"
@@ -12,16 +13,35 @@
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
 
+#define NPHYSPAGE  (PHYSTOP/PGSIZE)
+#define PG_FREE    0x80  // page heads a free block on a free list
+#define PG_ORDER   0x7f  // order of the block this page heads
+#define NZPAGE     128   // most pre-zeroed pages kept in reserve
+#define ZFILLBATCH 4     // pages zeroed per kzerofill() call
+
+// A free block, linked into the free list of its order.
 struct run {
   struct run *next;
+  struct run *prev;
 };
 
+// pginfo[] has one byte per physical page.  The first page of
+// every block records the block's order, plus PG_FREE while the
+// block sits on a free list.  All other pages hold 0.
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *freelist[MAXORDER+1];
+  uchar pginfo[NPHYSPAGE];
 } kmem;
 
+// Free pages that idle CPUs have already zeroed; see kzerofill().
+struct {
+  struct spinlock lock;
+  struct run *list;
+  int n;
+} kzero;
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
@@ -31,6 +51,7 @@ void
 kinit1(void *vstart, void *vend)
 {
   initlock(&kmem.lock, "kmem");
+  initlock(&kzero.lock, "kzero");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -51,46 +72,200 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+static void
+pushblock(uint pn, int order)
+{
+  struct run *r;
+
+  r = (struct run*)p2v(pn*PGSIZE);
+  r->prev = 0;
+  r->next = kmem.freelist[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.freelist[order] = r;
+  kmem.pginfo[pn] = PG_FREE | order;
+}
+
+static void
+unlinkblock(uint pn, int order)
+{
+  struct run *r;
+
+  r = (struct run*)p2v(pn*PGSIZE);
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.freelist[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.pginfo[pn] = 0;
+}
+
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
+// Free the block of 2^order pages of physical memory pointed
+// at by v, which normally should have been returned by a call
+// to kallocpages(order).  (The exception is when initializing
+// the allocator; see kinit above.)  The block is merged with
+// its buddy for as long as the buddy is free too.
 void
-kfree(char *v)
+kfreepages(char *v, int order)
 {
-  struct run *r;
+  uint pn, buddy;
 
-  if((uint)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
-    panic("kfree");
+  if(order < 0 || order > MAXORDER)
+    panic("kfreepages: order");
+  if(v2p(v) % (PGSIZE << order) || v < end ||
+     v2p(v) + (PGSIZE << order) > PHYSTOP)
+    panic("kfreepages");
 
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  memset(v, 1, PGSIZE << order);
 
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
+  pn = v2p(v) / PGSIZE;
+  if(kmem.pginfo[pn] != order)
+    panic("kfreepages: bad order or double free");
+  kmem.pginfo[pn] = 0;
+  for(; order < MAXORDER; order++){
+    buddy = pn ^ (1 << order);
+    if(buddy >= NPHYSPAGE || kmem.pginfo[buddy] != (PG_FREE | order))
+      break;
+    unlinkblock(buddy, order);
+    pn &= ~(1 << order);
+  }
+  pushblock(pn, order);
   if(kmem.use_lock)
     release(&kmem.lock);
 }
 
-// Allocate one 4096-byte page of physical memory.
+// Allocate a physically contiguous, naturally aligned block of
+// 2^order 4096-byte pages.  Larger free blocks are split as
+// needed and their unused halves go back on the free lists.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
 char*
-kalloc(void)
+kallocpages(int order)
 {
   struct run *r;
+  uint pn;
+  int k;
 
+  if(order < 0 || order > MAXORDER)
+    return 0;
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  for(k = order; k <= MAXORDER && kmem.freelist[k] == 0; k++)
+    ;
+  if(k > MAXORDER){
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return 0;
+  }
+  r = kmem.freelist[k];
+  pn = v2p(r) / PGSIZE;
+  unlinkblock(pn, k);
+  while(k > order){
+    k--;
+    pushblock(pn + (1 << k), k);
+  }
+  kmem.pginfo[pn] = order;
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Return the order of the allocated block starting at v.
+int
+kpageorder(char *v)
+{
+  uchar info;
+
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  info = kmem.pginfo[v2p(v) / PGSIZE];
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(info & PG_FREE)
+    panic("kpageorder");
+  return info & PG_ORDER;
+}
+
+// Free the page of physical memory pointed at by v,
+// which normally should have been returned by a
+// call to kalloc().
+void
+kfree(char *v)
+{
+  kfreepages(v, 0);
+}
+
+static struct run*
+zpop(void)
+{
+  struct run *r;
+
+  if(!kmem.use_lock)
+    return 0;
+  acquire(&kzero.lock);
+  if((r = kzero.list) != 0){
+    kzero.list = r->next;
+    kzero.n--;
+  }
+  release(&kzero.lock);
+  if(r)
+    memset(r, 0, sizeof(*r));
+  return r;
+}
+
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+  char *v;
+
+  if((v = kallocpages(0)) == 0)
+    v = (char*)zpop();
+  return v;
+}
+
+// Allocate one 4096-byte page filled with zeros, preferably
+// one that an idle CPU has already cleared.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc_zeroed(void)
+{
+  char *v;
+
+  if((v = (char*)zpop()) != 0)
+    return v;
+  if((v = kallocpages(0)) != 0)
+    memset(v, 0, PGSIZE);
+  return v;
+}
+
+// Called by scheduler() when it found nothing to run:
+// zero a few free pages ahead of time so that
+// kalloc_zeroed() doesn't have to on the fault or
+// fork path.  Return the number of pages zeroed.
+int
+kzerofill(void)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < ZFILLBATCH && kzero.n < NZPAGE; i++){
+    if((r = (struct run*)kallocpages(0)) == 0)
+      break;
+    memset(r, 0, PGSIZE);
+    acquire(&kzero.lock);
+    r->next = kzero.list;
+    kzero.list = r;
+    kzero.n++;
+    release(&kzero.lock);
+  }
+  return i;
+}
+
@@ -0,0 +1,996 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 90 06 00 00       	push   $0x690
+  21:	6a 02                	push   $0x2
+  23:	e8 d6 04 00 00       	call   4fe <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 ca 02 00 00       	call   2fa <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 e4 01 00 00       	call   237 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 cb 02 00 00       	call   32a <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 88 02 00 00       	call   2fa <exit>
+
+00000072 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  a4:	90                   	nop
+  a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  a8:	8d 42 01             	lea    0x1(%edx),%eax
+  ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  b1:	8d 48 01             	lea    0x1(%eax),%ecx
+  b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  b7:	0f b6 12             	movzbl (%edx),%edx
+  ba:	88 10                	mov    %dl,(%eax)
+  bc:	0f b6 00             	movzbl (%eax),%eax
+  bf:	84 c0                	test   %al,%al
+  c1:	75 e2                	jne    a5 <strcpy+0xd>
+    ;
+  return os;
+  c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  c6:	c9                   	leave
+  c7:	c3                   	ret
+
+000000c8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  c8:	55                   	push   %ebp
+  c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  cb:	eb 08                	jmp    d5 <strcmp+0xd>
+    p++, q++;
+  cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  d8:	0f b6 00             	movzbl (%eax),%eax
+  db:	84 c0                	test   %al,%al
+  dd:	74 10                	je     ef <strcmp+0x27>
+  df:	8b 45 08             	mov    0x8(%ebp),%eax
+  e2:	0f b6 10             	movzbl (%eax),%edx
+  e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e8:	0f b6 00             	movzbl (%eax),%eax
+  eb:	38 c2                	cmp    %al,%dl
+  ed:	74 de                	je     cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  f2:	0f b6 00             	movzbl (%eax),%eax
+  f5:	0f b6 d0             	movzbl %al,%edx
+  f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fb:	0f b6 00             	movzbl (%eax),%eax
+  fe:	0f b6 c0             	movzbl %al,%eax
+ 101:	29 c2                	sub    %eax,%edx
+ 103:	89 d0                	mov    %edx,%eax
+}
+ 105:	5d                   	pop    %ebp
+ 106:	c3                   	ret
+
+00000107 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 107:	55                   	push   %ebp
+ 108:	89 e5                	mov    %esp,%ebp
+ 10a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 10d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 114:	eb 04                	jmp    11a <strlen+0x13>
+ 116:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 11a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 11d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 120:	01 d0                	add    %edx,%eax
+ 122:	0f b6 00             	movzbl (%eax),%eax
+ 125:	84 c0                	test   %al,%al
+ 127:	75 ed                	jne    116 <strlen+0xf>
+    ;
+  return n;
+ 129:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 12c:	c9                   	leave
+ 12d:	c3                   	ret
+
+0000012e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 131:	8b 45 10             	mov    0x10(%ebp),%eax
+ 134:	50                   	push   %eax
+ 135:	ff 75 0c             	push   0xc(%ebp)
+ 138:	ff 75 08             	push   0x8(%ebp)
+ 13b:	e8 32 ff ff ff       	call   72 <stosb>
+ 140:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	83 ec 04             	sub    $0x4,%esp
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 154:	eb 14                	jmp    16a <strchr+0x22>
+    if(*s == c)
+ 156:	8b 45 08             	mov    0x8(%ebp),%eax
+ 159:	0f b6 00             	movzbl (%eax),%eax
+ 15c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 15f:	75 05                	jne    166 <strchr+0x1e>
+      return (char*)s;
+ 161:	8b 45 08             	mov    0x8(%ebp),%eax
+ 164:	eb 13                	jmp    179 <strchr+0x31>
+  for(; *s; s++)
+ 166:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 16a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16d:	0f b6 00             	movzbl (%eax),%eax
+ 170:	84 c0                	test   %al,%al
+ 172:	75 e2                	jne    156 <strchr+0xe>
+  return 0;
+ 174:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 179:	c9                   	leave
+ 17a:	c3                   	ret
+
+0000017b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 17b:	55                   	push   %ebp
+ 17c:	89 e5                	mov    %esp,%ebp
+ 17e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 181:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 188:	eb 42                	jmp    1cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 18a:	83 ec 04             	sub    $0x4,%esp
+ 18d:	6a 01                	push   $0x1
+ 18f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 192:	50                   	push   %eax
+ 193:	6a 00                	push   $0x0
+ 195:	e8 78 01 00 00       	call   312 <read>
+ 19a:	83 c4 10             	add    $0x10,%esp
+ 19d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1a4:	7e 33                	jle    1d9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 1ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1af:	89 c2                	mov    %eax,%edx
+ 1b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b4:	01 c2                	add    %eax,%edx
+ 1b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c0:	3c 0a                	cmp    $0xa,%al
+ 1c2:	74 16                	je     1da <gets+0x5f>
+ 1c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c8:	3c 0d                	cmp    $0xd,%al
+ 1ca:	74 0e                	je     1da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1cf:	83 c0 01             	add    $0x1,%eax
+ 1d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1d5:	7f b3                	jg     18a <gets+0xf>
+ 1d7:	eb 01                	jmp    1da <gets+0x5f>
+      break;
+ 1d9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 1da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	01 d0                	add    %edx,%eax
+ 1e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1e8:	c9                   	leave
+ 1e9:	c3                   	ret
+
+000001ea <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 1ea:	55                   	push   %ebp
+ 1eb:	89 e5                	mov    %esp,%ebp
+ 1ed:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	ff 75 08             	push   0x8(%ebp)
+ 1f8:	e8 3d 01 00 00       	call   33a <open>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	79 07                	jns    210 <stat+0x26>
+    return -1;
+ 209:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 20e:	eb 25                	jmp    235 <stat+0x4b>
+  r = fstat(fd, st);
+ 210:	83 ec 08             	sub    $0x8,%esp
+ 213:	ff 75 0c             	push   0xc(%ebp)
+ 216:	ff 75 f4             	push   -0xc(%ebp)
+ 219:	e8 34 01 00 00       	call   352 <fstat>
+ 21e:	83 c4 10             	add    $0x10,%esp
+ 221:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 224:	83 ec 0c             	sub    $0xc,%esp
+ 227:	ff 75 f4             	push   -0xc(%ebp)
+ 22a:	e8 f3 00 00 00       	call   322 <close>
+ 22f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 232:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 23d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 244:	eb 25                	jmp    26b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 246:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 249:	89 d0                	mov    %edx,%eax
+ 24b:	c1 e0 02             	shl    $0x2,%eax
+ 24e:	01 d0                	add    %edx,%eax
+ 250:	01 c0                	add    %eax,%eax
+ 252:	89 c1                	mov    %eax,%ecx
+ 254:	8b 45 08             	mov    0x8(%ebp),%eax
+ 257:	8d 50 01             	lea    0x1(%eax),%edx
+ 25a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	01 c8                	add    %ecx,%eax
+ 265:	83 e8 30             	sub    $0x30,%eax
+ 268:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	3c 2f                	cmp    $0x2f,%al
+ 273:	7e 0a                	jle    27f <atoi+0x48>
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+ 278:	0f b6 00             	movzbl (%eax),%eax
+ 27b:	3c 39                	cmp    $0x39,%al
+ 27d:	7e c7                	jle    246 <atoi+0xf>
+  return n;
+ 27f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 282:	c9                   	leave
+ 283:	c3                   	ret
+
+00000284 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 284:	55                   	push   %ebp
+ 285:	89 e5                	mov    %esp,%ebp
+ 287:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 28a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 290:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 293:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 296:	eb 17                	jmp    2af <memmove+0x2b>
+    *dst++ = *src++;
+ 298:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 29b:	8d 42 01             	lea    0x1(%edx),%eax
+ 29e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2aa:	0f b6 12             	movzbl (%edx),%edx
+ 2ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2b8:	85 c0                	test   %eax,%eax
+ 2ba:	7f dc                	jg     298 <memmove+0x14>
+  return vdst;
+ 2bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2bf:	c9                   	leave
+ 2c0:	c3                   	ret
+
+000002c1 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 2c1:	55                   	push   %ebp
+ 2c2:	89 e5                	mov    %esp,%ebp
+ 2c4:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 2c7:	83 ec 0c             	sub    $0xc,%esp
+ 2ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 2cd:	50                   	push   %eax
+ 2ce:	e8 ff 00 00 00       	call   3d2 <nanouptime>
+ 2d3:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 2d6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2d9:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 2df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e2:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 2e7:	f7 e2                	mul    %edx
+ 2e9:	89 d0                	mov    %edx,%eax
+ 2eb:	c1 e8 06             	shr    $0x6,%eax
+ 2ee:	01 c8                	add    %ecx,%eax
+}
+ 2f0:	c9                   	leave
+ 2f1:	c3                   	ret
+
+000002f2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 2f2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2f7:	cd 40                	int    $0x40
+ 2f9:	c3                   	ret
+
+000002fa <exit>:
+SYSCALL(exit)
+ 2fa:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2ff:	cd 40                	int    $0x40
+ 301:	c3                   	ret
+
+00000302 <wait>:
+SYSCALL(wait)
+ 302:	b8 03 00 00 00       	mov    $0x3,%eax
+ 307:	cd 40                	int    $0x40
+ 309:	c3                   	ret
+
+0000030a <pipe>:
+SYSCALL(pipe)
+ 30a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 30f:	cd 40                	int    $0x40
+ 311:	c3                   	ret
+
+00000312 <read>:
+SYSCALL(read)
+ 312:	b8 05 00 00 00       	mov    $0x5,%eax
+ 317:	cd 40                	int    $0x40
+ 319:	c3                   	ret
+
+0000031a <write>:
+SYSCALL(write)
+ 31a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 31f:	cd 40                	int    $0x40
+ 321:	c3                   	ret
+
+00000322 <close>:
+SYSCALL(close)
+ 322:	b8 15 00 00 00       	mov    $0x15,%eax
+ 327:	cd 40                	int    $0x40
+ 329:	c3                   	ret
+
+0000032a <kill>:
+SYSCALL(kill)
+ 32a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 32f:	cd 40                	int    $0x40
+ 331:	c3                   	ret
+
+00000332 <exec>:
+SYSCALL(exec)
+ 332:	b8 07 00 00 00       	mov    $0x7,%eax
+ 337:	cd 40                	int    $0x40
+ 339:	c3                   	ret
+
+0000033a <open>:
+SYSCALL(open)
+ 33a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 33f:	cd 40                	int    $0x40
+ 341:	c3                   	ret
+
+00000342 <mknod>:
+SYSCALL(mknod)
+ 342:	b8 11 00 00 00       	mov    $0x11,%eax
+ 347:	cd 40                	int    $0x40
+ 349:	c3                   	ret
+
+0000034a <unlink>:
+SYSCALL(unlink)
+ 34a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 34f:	cd 40                	int    $0x40
+ 351:	c3                   	ret
+
+00000352 <fstat>:
+SYSCALL(fstat)
+ 352:	b8 08 00 00 00       	mov    $0x8,%eax
+ 357:	cd 40                	int    $0x40
+ 359:	c3                   	ret
+
+0000035a <link>:
+SYSCALL(link)
+ 35a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 35f:	cd 40                	int    $0x40
+ 361:	c3                   	ret
+
+00000362 <mkdir>:
+SYSCALL(mkdir)
+ 362:	b8 14 00 00 00       	mov    $0x14,%eax
+ 367:	cd 40                	int    $0x40
+ 369:	c3                   	ret
+
+0000036a <chdir>:
+SYSCALL(chdir)
+ 36a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 36f:	cd 40                	int    $0x40
+ 371:	c3                   	ret
+
+00000372 <dup>:
+SYSCALL(dup)
+ 372:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 377:	cd 40                	int    $0x40
+ 379:	c3                   	ret
+
+0000037a <getpid>:
+SYSCALL(getpid)
+ 37a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 37f:	cd 40                	int    $0x40
+ 381:	c3                   	ret
+
+00000382 <sbrk>:
+SYSCALL(sbrk)
+ 382:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 387:	cd 40                	int    $0x40
+ 389:	c3                   	ret
+
+0000038a <sleep>:
+SYSCALL(sleep)
+ 38a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 38f:	cd 40                	int    $0x40
+ 391:	c3                   	ret
+
+00000392 <uptime>:
+SYSCALL(uptime)
+ 392:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 397:	cd 40                	int    $0x40
+ 399:	c3                   	ret
+
+0000039a <saveProc>:
+SYSCALL(saveProc)
+ 39a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 39f:	cd 40                	int    $0x40
+ 3a1:	c3                   	ret
+
+000003a2 <loadProc>:
+SYSCALL(loadProc)
+ 3a2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3a7:	cd 40                	int    $0x40
+ 3a9:	c3                   	ret
+
+000003aa <setpriority>:
+SYSCALL(setpriority)
+ 3aa:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3af:	cd 40                	int    $0x40
+ 3b1:	c3                   	ret
+
+000003b2 <setaffinity>:
+SYSCALL(setaffinity)
+ 3b2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3b7:	cd 40                	int    $0x40
+ 3b9:	c3                   	ret
+
+000003ba <getaffinity>:
+SYSCALL(getaffinity)
+ 3ba:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3bf:	cd 40                	int    $0x40
+ 3c1:	c3                   	ret
+
+000003c2 <nanosleep>:
+SYSCALL(nanosleep)
+ 3c2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3c7:	cd 40                	int    $0x40
+ 3c9:	c3                   	ret
+
+000003ca <cpustat>:
+SYSCALL(cpustat)
+ 3ca:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 3cf:	cd 40                	int    $0x40
+ 3d1:	c3                   	ret
+
+000003d2 <nanouptime>:
+SYSCALL(nanouptime)
+ 3d2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <settickets>:
+SYSCALL(settickets)
+ 3da:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <setdeadline>:
+SYSCALL(setdeadline)
+ 3e2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <rtstat>:
+SYSCALL(rtstat)
+ 3ea:	b8 21 00 00 00       	mov    $0x21,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <schedstat>:
+SYSCALL(schedstat)
+ 3f2:	b8 22 00 00 00       	mov    $0x22,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <waitpid>:
+SYSCALL(waitpid)
+ 3fa:	b8 23 00 00 00       	mov    $0x23,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <clone>:
+SYSCALL(clone)
+ 402:	b8 24 00 00 00       	mov    $0x24,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <futexwait>:
+SYSCALL(futexwait)
+ 40a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <futexwake>:
+SYSCALL(futexwake)
+ 412:	b8 26 00 00 00       	mov    $0x26,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <lockstat>:
+SYSCALL(lockstat)
+ 41a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <dcachestat>:
+SYSCALL(dcachestat)
+ 422:	b8 28 00 00 00       	mov    $0x28,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 42a:	55                   	push   %ebp
+ 42b:	89 e5                	mov    %esp,%ebp
+ 42d:	83 ec 18             	sub    $0x18,%esp
+ 430:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 433:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 436:	83 ec 04             	sub    $0x4,%esp
+ 439:	6a 01                	push   $0x1
+ 43b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 43e:	50                   	push   %eax
+ 43f:	ff 75 08             	push   0x8(%ebp)
+ 442:	e8 d3 fe ff ff       	call   31a <write>
+ 447:	83 c4 10             	add    $0x10,%esp
+}
+ 44a:	90                   	nop
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 453:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 45a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 45e:	74 17                	je     477 <printint+0x2a>
+ 460:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 464:	79 11                	jns    477 <printint+0x2a>
+    neg = 1;
+ 466:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 46d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 470:	f7 d8                	neg    %eax
+ 472:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 475:	eb 06                	jmp    47d <printint+0x30>
+  } else {
+    x = xx;
+ 477:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 47a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 47d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 484:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 487:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 48a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 48f:	f7 f1                	div    %ecx
+ 491:	89 d1                	mov    %edx,%ecx
+ 493:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 496:	8d 50 01             	lea    0x1(%eax),%edx
+ 499:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 49c:	0f b6 91 b4 08 00 00 	movzbl 0x8b4(%ecx),%edx
+ 4a3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4ad:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4b2:	f7 f1                	div    %ecx
+ 4b4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4b7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 4bb:	75 c7                	jne    484 <printint+0x37>
+  if(neg)
+ 4bd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c1:	74 2d                	je     4f0 <printint+0xa3>
+    buf[i++] = '-';
+ 4c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4c6:	8d 50 01             	lea    0x1(%eax),%edx
+ 4c9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4cc:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 4d1:	eb 1d                	jmp    4f0 <printint+0xa3>
+    putc(fd, buf[i]);
+ 4d3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 4d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4d9:	01 d0                	add    %edx,%eax
+ 4db:	0f b6 00             	movzbl (%eax),%eax
+ 4de:	0f be c0             	movsbl %al,%eax
+ 4e1:	83 ec 08             	sub    $0x8,%esp
+ 4e4:	50                   	push   %eax
+ 4e5:	ff 75 08             	push   0x8(%ebp)
+ 4e8:	e8 3d ff ff ff       	call   42a <putc>
+ 4ed:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 4f0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 4f4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4f8:	79 d9                	jns    4d3 <printint+0x86>
+}
+ 4fa:	90                   	nop
+ 4fb:	90                   	nop
+ 4fc:	c9                   	leave
+ 4fd:	c3                   	ret
+
+000004fe <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 4fe:	55                   	push   %ebp
+ 4ff:	89 e5                	mov    %esp,%ebp
+ 501:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 504:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 50b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 50e:	83 c0 04             	add    $0x4,%eax
+ 511:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 514:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 51b:	e9 59 01 00 00       	jmp    679 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 520:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 523:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 526:	01 d0                	add    %edx,%eax
+ 528:	0f b6 00             	movzbl (%eax),%eax
+ 52b:	0f be c0             	movsbl %al,%eax
+ 52e:	25 ff 00 00 00       	and    $0xff,%eax
+ 533:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 536:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 53a:	75 2c                	jne    568 <printf+0x6a>
+      if(c == '%'){
+ 53c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 540:	75 0c                	jne    54e <printf+0x50>
+        state = '%';
+ 542:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 549:	e9 27 01 00 00       	jmp    675 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 54e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 551:	0f be c0             	movsbl %al,%eax
+ 554:	83 ec 08             	sub    $0x8,%esp
+ 557:	50                   	push   %eax
+ 558:	ff 75 08             	push   0x8(%ebp)
+ 55b:	e8 ca fe ff ff       	call   42a <putc>
+ 560:	83 c4 10             	add    $0x10,%esp
+ 563:	e9 0d 01 00 00       	jmp    675 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 568:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 56c:	0f 85 03 01 00 00    	jne    675 <printf+0x177>
+      if(c == 'd'){
+ 572:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 576:	75 1e                	jne    596 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 578:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 57b:	8b 00                	mov    (%eax),%eax
+ 57d:	6a 01                	push   $0x1
+ 57f:	6a 0a                	push   $0xa
+ 581:	50                   	push   %eax
+ 582:	ff 75 08             	push   0x8(%ebp)
+ 585:	e8 c3 fe ff ff       	call   44d <printint>
+ 58a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 58d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 591:	e9 d8 00 00 00       	jmp    66e <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 596:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 59a:	74 06                	je     5a2 <printf+0xa4>
+ 59c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5a0:	75 1e                	jne    5c0 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5a2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5a5:	8b 00                	mov    (%eax),%eax
+ 5a7:	6a 00                	push   $0x0
+ 5a9:	6a 10                	push   $0x10
+ 5ab:	50                   	push   %eax
+ 5ac:	ff 75 08             	push   0x8(%ebp)
+ 5af:	e8 99 fe ff ff       	call   44d <printint>
+ 5b4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5b7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5bb:	e9 ae 00 00 00       	jmp    66e <printf+0x170>
+      } else if(c == 's'){
+ 5c0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 5c4:	75 43                	jne    609 <printf+0x10b>
+        s = (char*)*ap;
+ 5c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c9:	8b 00                	mov    (%eax),%eax
+ 5cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 5ce:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 5d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5d6:	75 25                	jne    5fd <printf+0xff>
+          s = "(null)";
+ 5d8:	c7 45 f4 a4 06 00 00 	movl   $0x6a4,-0xc(%ebp)
+        while(*s != 0){
+ 5df:	eb 1c                	jmp    5fd <printf+0xff>
+          putc(fd, *s);
+ 5e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e4:	0f b6 00             	movzbl (%eax),%eax
+ 5e7:	0f be c0             	movsbl %al,%eax
+ 5ea:	83 ec 08             	sub    $0x8,%esp
+ 5ed:	50                   	push   %eax
+ 5ee:	ff 75 08             	push   0x8(%ebp)
+ 5f1:	e8 34 fe ff ff       	call   42a <putc>
+ 5f6:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 5f9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 5fd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 600:	0f b6 00             	movzbl (%eax),%eax
+ 603:	84 c0                	test   %al,%al
+ 605:	75 da                	jne    5e1 <printf+0xe3>
+ 607:	eb 65                	jmp    66e <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 609:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 60d:	75 1d                	jne    62c <printf+0x12e>
+        putc(fd, *ap);
+ 60f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 612:	8b 00                	mov    (%eax),%eax
+ 614:	0f be c0             	movsbl %al,%eax
+ 617:	83 ec 08             	sub    $0x8,%esp
+ 61a:	50                   	push   %eax
+ 61b:	ff 75 08             	push   0x8(%ebp)
+ 61e:	e8 07 fe ff ff       	call   42a <putc>
+ 623:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 626:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 62a:	eb 42                	jmp    66e <printf+0x170>
+      } else if(c == '%'){
+ 62c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 630:	75 17                	jne    649 <printf+0x14b>
+        putc(fd, c);
+ 632:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 635:	0f be c0             	movsbl %al,%eax
+ 638:	83 ec 08             	sub    $0x8,%esp
+ 63b:	50                   	push   %eax
+ 63c:	ff 75 08             	push   0x8(%ebp)
+ 63f:	e8 e6 fd ff ff       	call   42a <putc>
+ 644:	83 c4 10             	add    $0x10,%esp
+ 647:	eb 25                	jmp    66e <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 649:	83 ec 08             	sub    $0x8,%esp
+ 64c:	6a 25                	push   $0x25
+ 64e:	ff 75 08             	push   0x8(%ebp)
+ 651:	e8 d4 fd ff ff       	call   42a <putc>
+ 656:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 659:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 65c:	0f be c0             	movsbl %al,%eax
+ 65f:	83 ec 08             	sub    $0x8,%esp
+ 662:	50                   	push   %eax
+ 663:	ff 75 08             	push   0x8(%ebp)
+ 666:	e8 bf fd ff ff       	call   42a <putc>
+ 66b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 66e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 675:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 679:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 67c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 67f:	01 d0                	add    %edx,%eax
+ 681:	0f b6 00             	movzbl (%eax),%eax
+ 684:	84 c0                	test   %al,%al
+ 686:	0f 85 94 fe ff ff    	jne    520 <printf+0x22>
+    }
+  }
+}
+ 68c:	90                   	nop
+ 68d:	90                   	nop
+ 68e:	c9                   	leave
+ 68f:	c3                   	ret
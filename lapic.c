@@ -3,6 +3,7 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
 #include "date.h"
 #include "memlayout.h"
 #include "traps.h"
@@ -40,6 +41,8 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+#define LAPICHZ 1000000000  // timer counts per second (bus clock)
+
 volatile uint *lapic;  // Initialized in mp.c
 
 static void
@@ -60,12 +63,14 @@ lapicinit(void)
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
   // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.  
+  // from lapic[TICR] and then issues an interrupt,
+  // once per scheduler tick.  CPU 0 later switches to
+  // one-shot mode; see lapiconeshot().
   // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // LAPICHZ would be calibrated using an external time source.
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000); 
+  lapicw(TICR, LAPICHZ / HZ);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -116,6 +121,56 @@ cpunum(void)
   return 0;
 }
 
+// Return the number of TSC cycles in 10ms of timer counts,
+// or 0 if there is no LAPIC.  Runs the timer in masked one-shot
+// mode while it measures, so interrupts must be off.
+uint
+lapiccalibrate(void)
+{
+  uint start;
+  uint64 t0, t1;
+
+  if(!lapic)
+    return 0;
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  t0 = rdtsc();
+  start = lapic[TCCR];
+  while(start - lapic[TCCR] < LAPICHZ/100)
+    ;
+  t1 = rdtsc();
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, LAPICHZ / HZ);
+  return t1 - t0;
+}
+
+// Make this CPU's timer interrupt once, ns nanoseconds from
+// now, instead of once per tick.
+void
+lapiconeshot(uint ns)
+{
+  uint us;
+
+  if(!lapic)
+    return;
+  if((us = (ns + 999) / 1000) == 0)
+    us = 1;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, us * (LAPICHZ / 1000000));
+}
+
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicipi(uchar apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
@@ -0,0 +1,594 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 12 04 00 00       	push   $0x412
+  1e:	6a 02                	push   $0x2
+  20:	e8 5b 02 00 00       	call   280 <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 4f 00 00 00       	call   7c <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 95 00 00 00       	call   dc <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 25 04 00 00       	push   $0x425
+  65:	6a 02                	push   $0x2
+  67:	e8 14 02 00 00       	call   280 <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 08 00 00 00       	call   7c <exit>
+
+00000074 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  74:	b8 01 00 00 00       	mov    $0x1,%eax
+  79:	cd 40                	int    $0x40
+  7b:	c3                   	ret
+
+0000007c <exit>:
+SYSCALL(exit)
+  7c:	b8 02 00 00 00       	mov    $0x2,%eax
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <wait>:
+SYSCALL(wait)
+  84:	b8 03 00 00 00       	mov    $0x3,%eax
+  89:	cd 40                	int    $0x40
+  8b:	c3                   	ret
+
+0000008c <pipe>:
+SYSCALL(pipe)
+  8c:	b8 04 00 00 00       	mov    $0x4,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <read>:
+SYSCALL(read)
+  94:	b8 05 00 00 00       	mov    $0x5,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <write>:
+SYSCALL(write)
+  9c:	b8 10 00 00 00       	mov    $0x10,%eax
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <close>:
+SYSCALL(close)
+  a4:	b8 15 00 00 00       	mov    $0x15,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <kill>:
+SYSCALL(kill)
+  ac:	b8 06 00 00 00       	mov    $0x6,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <exec>:
+SYSCALL(exec)
+  b4:	b8 07 00 00 00       	mov    $0x7,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <open>:
+SYSCALL(open)
+  bc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  c1:	cd 40                	int    $0x40
+  c3:	c3                   	ret
+
+000000c4 <mknod>:
+SYSCALL(mknod)
+  c4:	b8 11 00 00 00       	mov    $0x11,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <unlink>:
+SYSCALL(unlink)
+  cc:	b8 12 00 00 00       	mov    $0x12,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <fstat>:
+SYSCALL(fstat)
+  d4:	b8 08 00 00 00       	mov    $0x8,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <link>:
+SYSCALL(link)
+  dc:	b8 13 00 00 00       	mov    $0x13,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <mkdir>:
+SYSCALL(mkdir)
+  e4:	b8 14 00 00 00       	mov    $0x14,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <chdir>:
+SYSCALL(chdir)
+  ec:	b8 09 00 00 00       	mov    $0x9,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <dup>:
+SYSCALL(dup)
+  f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <getpid>:
+SYSCALL(getpid)
+  fc:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <sbrk>:
+SYSCALL(sbrk)
+ 104:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <sleep>:
+SYSCALL(sleep)
+ 10c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <uptime>:
+SYSCALL(uptime)
+ 114:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <saveProc>:
+SYSCALL(saveProc)
+ 11c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <loadProc>:
+SYSCALL(loadProc)
+ 124:	b8 17 00 00 00       	mov    $0x17,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <setpriority>:
+SYSCALL(setpriority)
+ 12c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <setaffinity>:
+SYSCALL(setaffinity)
+ 134:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <getaffinity>:
+SYSCALL(getaffinity)
+ 13c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 141:	cd 40                	int    $0x40
+ 143:	c3                   	ret
+
+00000144 <nanosleep>:
+SYSCALL(nanosleep)
+ 144:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 149:	cd 40                	int    $0x40
+ 14b:	c3                   	ret
+
+0000014c <cpustat>:
+SYSCALL(cpustat)
+ 14c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 151:	cd 40                	int    $0x40
+ 153:	c3                   	ret
+
+00000154 <nanouptime>:
+SYSCALL(nanouptime)
+ 154:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 159:	cd 40                	int    $0x40
+ 15b:	c3                   	ret
+
+0000015c <settickets>:
+SYSCALL(settickets)
+ 15c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 161:	cd 40                	int    $0x40
+ 163:	c3                   	ret
+
+00000164 <setdeadline>:
+SYSCALL(setdeadline)
+ 164:	b8 20 00 00 00       	mov    $0x20,%eax
+ 169:	cd 40                	int    $0x40
+ 16b:	c3                   	ret
+
+0000016c <rtstat>:
+SYSCALL(rtstat)
+ 16c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 171:	cd 40                	int    $0x40
+ 173:	c3                   	ret
+
+00000174 <schedstat>:
+SYSCALL(schedstat)
+ 174:	b8 22 00 00 00       	mov    $0x22,%eax
+ 179:	cd 40                	int    $0x40
+ 17b:	c3                   	ret
+
+0000017c <waitpid>:
+SYSCALL(waitpid)
+ 17c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 181:	cd 40                	int    $0x40
+ 183:	c3                   	ret
+
+00000184 <clone>:
+SYSCALL(clone)
+ 184:	b8 24 00 00 00       	mov    $0x24,%eax
+ 189:	cd 40                	int    $0x40
+ 18b:	c3                   	ret
+
+0000018c <futexwait>:
+SYSCALL(futexwait)
+ 18c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 191:	cd 40                	int    $0x40
+ 193:	c3                   	ret
+
+00000194 <futexwake>:
+SYSCALL(futexwake)
+ 194:	b8 26 00 00 00       	mov    $0x26,%eax
+ 199:	cd 40                	int    $0x40
+ 19b:	c3                   	ret
+
+0000019c <lockstat>:
+SYSCALL(lockstat)
+ 19c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 1a1:	cd 40                	int    $0x40
+ 1a3:	c3                   	ret
+
+000001a4 <dcachestat>:
+SYSCALL(dcachestat)
+ 1a4:	b8 28 00 00 00       	mov    $0x28,%eax
+ 1a9:	cd 40                	int    $0x40
+ 1ab:	c3                   	ret
+
+000001ac <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1ac:	55                   	push   %ebp
+ 1ad:	89 e5                	mov    %esp,%ebp
+ 1af:	83 ec 18             	sub    $0x18,%esp
+ 1b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1b5:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1b8:	83 ec 04             	sub    $0x4,%esp
+ 1bb:	6a 01                	push   $0x1
+ 1bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 1c0:	50                   	push   %eax
+ 1c1:	ff 75 08             	push   0x8(%ebp)
+ 1c4:	e8 d3 fe ff ff       	call   9c <write>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+}
+ 1cc:	90                   	nop
+ 1cd:	c9                   	leave
+ 1ce:	c3                   	ret
+
+000001cf <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1d5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 1dc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 1e0:	74 17                	je     1f9 <printint+0x2a>
+ 1e2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 1e6:	79 11                	jns    1f9 <printint+0x2a>
+    neg = 1;
+ 1e8:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 1ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1f2:	f7 d8                	neg    %eax
+ 1f4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 1f7:	eb 06                	jmp    1ff <printint+0x30>
+  } else {
+    x = xx;
+ 1f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 1ff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 206:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 209:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 20c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 211:	f7 f1                	div    %ecx
+ 213:	89 d1                	mov    %edx,%ecx
+ 215:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 218:	8d 50 01             	lea    0x1(%eax),%edx
+ 21b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 21e:	0f b6 91 e0 04 00 00 	movzbl 0x4e0(%ecx),%edx
+ 225:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 229:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 22c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 22f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 234:	f7 f1                	div    %ecx
+ 236:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 239:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 23d:	75 c7                	jne    206 <printint+0x37>
+  if(neg)
+ 23f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 243:	74 2d                	je     272 <printint+0xa3>
+    buf[i++] = '-';
+ 245:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 248:	8d 50 01             	lea    0x1(%eax),%edx
+ 24b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 24e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 253:	eb 1d                	jmp    272 <printint+0xa3>
+    putc(fd, buf[i]);
+ 255:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 258:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 25b:	01 d0                	add    %edx,%eax
+ 25d:	0f b6 00             	movzbl (%eax),%eax
+ 260:	0f be c0             	movsbl %al,%eax
+ 263:	83 ec 08             	sub    $0x8,%esp
+ 266:	50                   	push   %eax
+ 267:	ff 75 08             	push   0x8(%ebp)
+ 26a:	e8 3d ff ff ff       	call   1ac <putc>
+ 26f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 272:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 276:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 27a:	79 d9                	jns    255 <printint+0x86>
+}
+ 27c:	90                   	nop
+ 27d:	90                   	nop
+ 27e:	c9                   	leave
+ 27f:	c3                   	ret
+
+00000280 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 286:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 28d:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 290:	83 c0 04             	add    $0x4,%eax
+ 293:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 296:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 29d:	e9 59 01 00 00       	jmp    3fb <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 2a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2a8:	01 d0                	add    %edx,%eax
+ 2aa:	0f b6 00             	movzbl (%eax),%eax
+ 2ad:	0f be c0             	movsbl %al,%eax
+ 2b0:	25 ff 00 00 00       	and    $0xff,%eax
+ 2b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 2b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2bc:	75 2c                	jne    2ea <printf+0x6a>
+      if(c == '%'){
+ 2be:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 2c2:	75 0c                	jne    2d0 <printf+0x50>
+        state = '%';
+ 2c4:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 2cb:	e9 27 01 00 00       	jmp    3f7 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 2d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2d3:	0f be c0             	movsbl %al,%eax
+ 2d6:	83 ec 08             	sub    $0x8,%esp
+ 2d9:	50                   	push   %eax
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 ca fe ff ff       	call   1ac <putc>
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	e9 0d 01 00 00       	jmp    3f7 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 2ea:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 2ee:	0f 85 03 01 00 00    	jne    3f7 <printf+0x177>
+      if(c == 'd'){
+ 2f4:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 2f8:	75 1e                	jne    318 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 2fa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 2fd:	8b 00                	mov    (%eax),%eax
+ 2ff:	6a 01                	push   $0x1
+ 301:	6a 0a                	push   $0xa
+ 303:	50                   	push   %eax
+ 304:	ff 75 08             	push   0x8(%ebp)
+ 307:	e8 c3 fe ff ff       	call   1cf <printint>
+ 30c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 30f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 313:	e9 d8 00 00 00       	jmp    3f0 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 318:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 31c:	74 06                	je     324 <printf+0xa4>
+ 31e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 322:	75 1e                	jne    342 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 324:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 327:	8b 00                	mov    (%eax),%eax
+ 329:	6a 00                	push   $0x0
+ 32b:	6a 10                	push   $0x10
+ 32d:	50                   	push   %eax
+ 32e:	ff 75 08             	push   0x8(%ebp)
+ 331:	e8 99 fe ff ff       	call   1cf <printint>
+ 336:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 339:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 33d:	e9 ae 00 00 00       	jmp    3f0 <printf+0x170>
+      } else if(c == 's'){
+ 342:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 346:	75 43                	jne    38b <printf+0x10b>
+        s = (char*)*ap;
+ 348:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 34b:	8b 00                	mov    (%eax),%eax
+ 34d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 350:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 354:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 358:	75 25                	jne    37f <printf+0xff>
+          s = "(null)";
+ 35a:	c7 45 f4 39 04 00 00 	movl   $0x439,-0xc(%ebp)
+        while(*s != 0){
+ 361:	eb 1c                	jmp    37f <printf+0xff>
+          putc(fd, *s);
+ 363:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 366:	0f b6 00             	movzbl (%eax),%eax
+ 369:	0f be c0             	movsbl %al,%eax
+ 36c:	83 ec 08             	sub    $0x8,%esp
+ 36f:	50                   	push   %eax
+ 370:	ff 75 08             	push   0x8(%ebp)
+ 373:	e8 34 fe ff ff       	call   1ac <putc>
+ 378:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 37b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 37f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 382:	0f b6 00             	movzbl (%eax),%eax
+ 385:	84 c0                	test   %al,%al
+ 387:	75 da                	jne    363 <printf+0xe3>
+ 389:	eb 65                	jmp    3f0 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 38b:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 38f:	75 1d                	jne    3ae <printf+0x12e>
+        putc(fd, *ap);
+ 391:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 394:	8b 00                	mov    (%eax),%eax
+ 396:	0f be c0             	movsbl %al,%eax
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	50                   	push   %eax
+ 39d:	ff 75 08             	push   0x8(%ebp)
+ 3a0:	e8 07 fe ff ff       	call   1ac <putc>
+ 3a5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3a8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3ac:	eb 42                	jmp    3f0 <printf+0x170>
+      } else if(c == '%'){
+ 3ae:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 3b2:	75 17                	jne    3cb <printf+0x14b>
+        putc(fd, c);
+ 3b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3b7:	0f be c0             	movsbl %al,%eax
+ 3ba:	83 ec 08             	sub    $0x8,%esp
+ 3bd:	50                   	push   %eax
+ 3be:	ff 75 08             	push   0x8(%ebp)
+ 3c1:	e8 e6 fd ff ff       	call   1ac <putc>
+ 3c6:	83 c4 10             	add    $0x10,%esp
+ 3c9:	eb 25                	jmp    3f0 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3cb:	83 ec 08             	sub    $0x8,%esp
+ 3ce:	6a 25                	push   $0x25
+ 3d0:	ff 75 08             	push   0x8(%ebp)
+ 3d3:	e8 d4 fd ff ff       	call   1ac <putc>
+ 3d8:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 3db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3de:	0f be c0             	movsbl %al,%eax
+ 3e1:	83 ec 08             	sub    $0x8,%esp
+ 3e4:	50                   	push   %eax
+ 3e5:	ff 75 08             	push   0x8(%ebp)
+ 3e8:	e8 bf fd ff ff       	call   1ac <putc>
+ 3ed:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 3f0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 3f7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 3fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3fe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 401:	01 d0                	add    %edx,%eax
+ 403:	0f b6 00             	movzbl (%eax),%eax
+ 406:	84 c0                	test   %al,%al
+ 408:	0f 85 94 fe ff ff    	jne    2a2 <printf+0x22>
+    }
+  }
+}
+ 40e:	90                   	nop
+ 40f:	90                   	nop
+ 410:	c9                   	leave
+ 411:	c3                   	ret
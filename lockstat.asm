@@ -0,0 +1,1270 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static struct lockstat ls[MAXLOCK];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 50             	sub    $0x50,%esp
+  12:	89 c8                	mov    %ecx,%eax
+  struct lockstat t;
+  int n, top, i, j, k;
+
+  top = 10;
+  14:	c7 45 f4 0a 00 00 00 	movl   $0xa,-0xc(%ebp)
+  if(argc > 1 && (top = atoi(argv[1])) <= 0){
+  1b:	83 38 01             	cmpl   $0x1,(%eax)
+  1e:	7e 34                	jle    54 <main+0x54>
+  20:	8b 40 04             	mov    0x4(%eax),%eax
+  23:	83 c0 04             	add    $0x4,%eax
+  26:	8b 00                	mov    (%eax),%eax
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	50                   	push   %eax
+  2c:	e8 fd 04 00 00       	call   52e <atoi>
+  31:	83 c4 10             	add    $0x10,%esp
+  34:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  37:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3b:	7f 17                	jg     54 <main+0x54>
+    printf(2, "usage: lockstat [n]\n");
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	68 88 09 00 00       	push   $0x988
+  45:	6a 02                	push   $0x2
+  47:	e8 a9 07 00 00       	call   7f5 <printf>
+  4c:	83 c4 10             	add    $0x10,%esp
+    exit();
+  4f:	e8 9d 05 00 00       	call   5f1 <exit>
+  }
+  if((n = lockstat(ls, MAXLOCK)) < 0){
+  54:	83 ec 08             	sub    $0x8,%esp
+  57:	6a 40                	push   $0x40
+  59:	68 60 0c 00 00       	push   $0xc60
+  5e:	e8 ae 06 00 00       	call   711 <lockstat>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  69:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  6d:	79 17                	jns    86 <main+0x86>
+    printf(2, "lockstat: failed\n");
+  6f:	83 ec 08             	sub    $0x8,%esp
+  72:	68 9d 09 00 00       	push   $0x99d
+  77:	6a 02                	push   $0x2
+  79:	e8 77 07 00 00       	call   7f5 <printf>
+  7e:	83 c4 10             	add    $0x10,%esp
+    exit();
+  81:	e8 6b 05 00 00       	call   5f1 <exit>
+  }
+
+  // Sort by time spent waiting, then by waits.
+  for(i = 1; i < n; i++){
+  86:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  8d:	e9 79 01 00 00       	jmp    20b <main+0x20b>
+    t = ls[i];
+  92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  95:	6b c0 34             	imul   $0x34,%eax,%eax
+  98:	05 60 0c 00 00       	add    $0xc60,%eax
+  9d:	8b 10                	mov    (%eax),%edx
+  9f:	89 55 b0             	mov    %edx,-0x50(%ebp)
+  a2:	8b 50 04             	mov    0x4(%eax),%edx
+  a5:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+  a8:	8b 50 08             	mov    0x8(%eax),%edx
+  ab:	89 55 b8             	mov    %edx,-0x48(%ebp)
+  ae:	8b 50 0c             	mov    0xc(%eax),%edx
+  b1:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  b4:	8b 50 10             	mov    0x10(%eax),%edx
+  b7:	89 55 c0             	mov    %edx,-0x40(%ebp)
+  ba:	8b 50 14             	mov    0x14(%eax),%edx
+  bd:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  c0:	8b 50 18             	mov    0x18(%eax),%edx
+  c3:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  c6:	8b 50 1c             	mov    0x1c(%eax),%edx
+  c9:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  cc:	8b 50 20             	mov    0x20(%eax),%edx
+  cf:	89 55 d0             	mov    %edx,-0x30(%ebp)
+  d2:	8b 50 24             	mov    0x24(%eax),%edx
+  d5:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+  d8:	8b 50 28             	mov    0x28(%eax),%edx
+  db:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  de:	8b 50 2c             	mov    0x2c(%eax),%edx
+  e1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  e4:	8b 40 30             	mov    0x30(%eax),%eax
+  e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(j = i; j > 0 && (ls[j-1].spinus < t.spinus ||
+  ea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  f0:	eb 6a                	jmp    15c <main+0x15c>
+        (ls[j-1].spinus == t.spinus && ls[j-1].ncontend < t.ncontend)); j--)
+      ls[j] = ls[j-1];
+  f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  f5:	8d 50 ff             	lea    -0x1(%eax),%edx
+  f8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  fb:	6b c0 34             	imul   $0x34,%eax,%eax
+  fe:	05 60 0c 00 00       	add    $0xc60,%eax
+ 103:	6b d2 34             	imul   $0x34,%edx,%edx
+ 106:	81 c2 60 0c 00 00    	add    $0xc60,%edx
+ 10c:	8b 0a                	mov    (%edx),%ecx
+ 10e:	89 08                	mov    %ecx,(%eax)
+ 110:	8b 4a 04             	mov    0x4(%edx),%ecx
+ 113:	89 48 04             	mov    %ecx,0x4(%eax)
+ 116:	8b 4a 08             	mov    0x8(%edx),%ecx
+ 119:	89 48 08             	mov    %ecx,0x8(%eax)
+ 11c:	8b 4a 0c             	mov    0xc(%edx),%ecx
+ 11f:	89 48 0c             	mov    %ecx,0xc(%eax)
+ 122:	8b 4a 10             	mov    0x10(%edx),%ecx
+ 125:	89 48 10             	mov    %ecx,0x10(%eax)
+ 128:	8b 4a 14             	mov    0x14(%edx),%ecx
+ 12b:	89 48 14             	mov    %ecx,0x14(%eax)
+ 12e:	8b 4a 18             	mov    0x18(%edx),%ecx
+ 131:	89 48 18             	mov    %ecx,0x18(%eax)
+ 134:	8b 4a 1c             	mov    0x1c(%edx),%ecx
+ 137:	89 48 1c             	mov    %ecx,0x1c(%eax)
+ 13a:	8b 4a 20             	mov    0x20(%edx),%ecx
+ 13d:	89 48 20             	mov    %ecx,0x20(%eax)
+ 140:	8b 4a 24             	mov    0x24(%edx),%ecx
+ 143:	89 48 24             	mov    %ecx,0x24(%eax)
+ 146:	8b 4a 28             	mov    0x28(%edx),%ecx
+ 149:	89 48 28             	mov    %ecx,0x28(%eax)
+ 14c:	8b 4a 2c             	mov    0x2c(%edx),%ecx
+ 14f:	89 48 2c             	mov    %ecx,0x2c(%eax)
+ 152:	8b 52 30             	mov    0x30(%edx),%edx
+ 155:	89 50 30             	mov    %edx,0x30(%eax)
+        (ls[j-1].spinus == t.spinus && ls[j-1].ncontend < t.ncontend)); j--)
+ 158:	83 6d ec 01          	subl   $0x1,-0x14(%ebp)
+    for(j = i; j > 0 && (ls[j-1].spinus < t.spinus ||
+ 15c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 160:	7e 4d                	jle    1af <main+0x1af>
+ 162:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 165:	83 e8 01             	sub    $0x1,%eax
+ 168:	6b c0 34             	imul   $0x34,%eax,%eax
+ 16b:	05 78 0c 00 00       	add    $0xc78,%eax
+ 170:	8b 10                	mov    (%eax),%edx
+ 172:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 175:	39 c2                	cmp    %eax,%edx
+ 177:	0f 82 75 ff ff ff    	jb     f2 <main+0xf2>
+        (ls[j-1].spinus == t.spinus && ls[j-1].ncontend < t.ncontend)); j--)
+ 17d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 180:	83 e8 01             	sub    $0x1,%eax
+ 183:	6b c0 34             	imul   $0x34,%eax,%eax
+ 186:	05 78 0c 00 00       	add    $0xc78,%eax
+ 18b:	8b 10                	mov    (%eax),%edx
+ 18d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    for(j = i; j > 0 && (ls[j-1].spinus < t.spinus ||
+ 190:	39 c2                	cmp    %eax,%edx
+ 192:	75 1b                	jne    1af <main+0x1af>
+        (ls[j-1].spinus == t.spinus && ls[j-1].ncontend < t.ncontend)); j--)
+ 194:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 197:	83 e8 01             	sub    $0x1,%eax
+ 19a:	6b c0 34             	imul   $0x34,%eax,%eax
+ 19d:	05 74 0c 00 00       	add    $0xc74,%eax
+ 1a2:	8b 10                	mov    (%eax),%edx
+ 1a4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1a7:	39 c2                	cmp    %eax,%edx
+ 1a9:	0f 82 43 ff ff ff    	jb     f2 <main+0xf2>
+    ls[j] = t;
+ 1af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 1b2:	6b c0 34             	imul   $0x34,%eax,%eax
+ 1b5:	05 60 0c 00 00       	add    $0xc60,%eax
+ 1ba:	8b 55 b0             	mov    -0x50(%ebp),%edx
+ 1bd:	89 10                	mov    %edx,(%eax)
+ 1bf:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 1c2:	89 50 04             	mov    %edx,0x4(%eax)
+ 1c5:	8b 55 b8             	mov    -0x48(%ebp),%edx
+ 1c8:	89 50 08             	mov    %edx,0x8(%eax)
+ 1cb:	8b 55 bc             	mov    -0x44(%ebp),%edx
+ 1ce:	89 50 0c             	mov    %edx,0xc(%eax)
+ 1d1:	8b 55 c0             	mov    -0x40(%ebp),%edx
+ 1d4:	89 50 10             	mov    %edx,0x10(%eax)
+ 1d7:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 1da:	89 50 14             	mov    %edx,0x14(%eax)
+ 1dd:	8b 55 c8             	mov    -0x38(%ebp),%edx
+ 1e0:	89 50 18             	mov    %edx,0x18(%eax)
+ 1e3:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 1e6:	89 50 1c             	mov    %edx,0x1c(%eax)
+ 1e9:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 1ec:	89 50 20             	mov    %edx,0x20(%eax)
+ 1ef:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 1f2:	89 50 24             	mov    %edx,0x24(%eax)
+ 1f5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 1f8:	89 50 28             	mov    %edx,0x28(%eax)
+ 1fb:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 1fe:	89 50 2c             	mov    %edx,0x2c(%eax)
+ 201:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 204:	89 50 30             	mov    %edx,0x30(%eax)
+  for(i = 1; i < n; i++){
+ 207:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 20b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 20e:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+ 211:	0f 8c 7b fe ff ff    	jl     92 <main+0x92>
+  }
+
+  for(i = 0; i < n && i < top; i++){
+ 217:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 21e:	e9 2a 01 00 00       	jmp    34d <main+0x34d>
+    if(ls[i].nacquire == 0)
+ 223:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 226:	6b c0 34             	imul   $0x34,%eax,%eax
+ 229:	05 70 0c 00 00       	add    $0xc70,%eax
+ 22e:	8b 00                	mov    (%eax),%eax
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 84 2b 01 00 00    	je     363 <main+0x363>
+      break;
+    printf(1, "%s: %d acquired, %d contended, %dus waiting\n",
+ 238:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 23b:	6b c0 34             	imul   $0x34,%eax,%eax
+ 23e:	05 78 0c 00 00       	add    $0xc78,%eax
+ 243:	8b 08                	mov    (%eax),%ecx
+ 245:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 248:	6b c0 34             	imul   $0x34,%eax,%eax
+ 24b:	05 74 0c 00 00       	add    $0xc74,%eax
+ 250:	8b 10                	mov    (%eax),%edx
+ 252:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 255:	6b c0 34             	imul   $0x34,%eax,%eax
+ 258:	05 70 0c 00 00       	add    $0xc70,%eax
+ 25d:	8b 00                	mov    (%eax),%eax
+           ls[i].name, ls[i].nacquire, ls[i].ncontend, ls[i].spinus);
+ 25f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+ 262:	6b db 34             	imul   $0x34,%ebx,%ebx
+ 265:	81 c3 60 0c 00 00    	add    $0xc60,%ebx
+    printf(1, "%s: %d acquired, %d contended, %dus waiting\n",
+ 26b:	83 ec 08             	sub    $0x8,%esp
+ 26e:	51                   	push   %ecx
+ 26f:	52                   	push   %edx
+ 270:	50                   	push   %eax
+ 271:	53                   	push   %ebx
+ 272:	68 b0 09 00 00       	push   $0x9b0
+ 277:	6a 01                	push   $0x1
+ 279:	e8 77 05 00 00       	call   7f5 <printf>
+ 27e:	83 c4 20             	add    $0x20,%esp
+    printf(1, "  longest wait %dns, longest hold %dns\n",
+ 281:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 284:	6b c0 34             	imul   $0x34,%eax,%eax
+ 287:	05 80 0c 00 00       	add    $0xc80,%eax
+ 28c:	8b 10                	mov    (%eax),%edx
+ 28e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 291:	6b c0 34             	imul   $0x34,%eax,%eax
+ 294:	05 7c 0c 00 00       	add    $0xc7c,%eax
+ 299:	8b 00                	mov    (%eax),%eax
+ 29b:	52                   	push   %edx
+ 29c:	50                   	push   %eax
+ 29d:	68 e0 09 00 00       	push   $0x9e0
+ 2a2:	6a 01                	push   $0x1
+ 2a4:	e8 4c 05 00 00       	call   7f5 <printf>
+ 2a9:	83 c4 10             	add    $0x10,%esp
+           ls[i].maxspin, ls[i].maxhold);
+    if(ls[i].ncontend){
+ 2ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2af:	6b c0 34             	imul   $0x34,%eax,%eax
+ 2b2:	05 74 0c 00 00       	add    $0xc74,%eax
+ 2b7:	8b 00                	mov    (%eax),%eax
+ 2b9:	85 c0                	test   %eax,%eax
+ 2bb:	0f 84 88 00 00 00    	je     349 <main+0x349>
+      printf(1, "  longest wait from");
+ 2c1:	83 ec 08             	sub    $0x8,%esp
+ 2c4:	68 08 0a 00 00       	push   $0xa08
+ 2c9:	6a 01                	push   $0x1
+ 2cb:	e8 25 05 00 00       	call   7f5 <printf>
+ 2d0:	83 c4 10             	add    $0x10,%esp
+      for(k = 0; k < NLOCKPCS && ls[i].pcs[k]; k++)
+ 2d3:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+ 2da:	eb 34                	jmp    310 <main+0x310>
+        printf(1, " %x", ls[i].pcs[k]);
+ 2dc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 2df:	89 d0                	mov    %edx,%eax
+ 2e1:	01 c0                	add    %eax,%eax
+ 2e3:	01 d0                	add    %edx,%eax
+ 2e5:	c1 e0 02             	shl    $0x2,%eax
+ 2e8:	01 d0                	add    %edx,%eax
+ 2ea:	8b 55 e8             	mov    -0x18(%ebp),%edx
+ 2ed:	01 d0                	add    %edx,%eax
+ 2ef:	83 c0 08             	add    $0x8,%eax
+ 2f2:	8b 04 85 64 0c 00 00 	mov    0xc64(,%eax,4),%eax
+ 2f9:	83 ec 04             	sub    $0x4,%esp
+ 2fc:	50                   	push   %eax
+ 2fd:	68 1c 0a 00 00       	push   $0xa1c
+ 302:	6a 01                	push   $0x1
+ 304:	e8 ec 04 00 00       	call   7f5 <printf>
+ 309:	83 c4 10             	add    $0x10,%esp
+      for(k = 0; k < NLOCKPCS && ls[i].pcs[k]; k++)
+ 30c:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+ 310:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+ 314:	7f 21                	jg     337 <main+0x337>
+ 316:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 319:	89 d0                	mov    %edx,%eax
+ 31b:	01 c0                	add    %eax,%eax
+ 31d:	01 d0                	add    %edx,%eax
+ 31f:	c1 e0 02             	shl    $0x2,%eax
+ 322:	01 d0                	add    %edx,%eax
+ 324:	8b 55 e8             	mov    -0x18(%ebp),%edx
+ 327:	01 d0                	add    %edx,%eax
+ 329:	83 c0 08             	add    $0x8,%eax
+ 32c:	8b 04 85 64 0c 00 00 	mov    0xc64(,%eax,4),%eax
+ 333:	85 c0                	test   %eax,%eax
+ 335:	75 a5                	jne    2dc <main+0x2dc>
+      printf(1, "\n");
+ 337:	83 ec 08             	sub    $0x8,%esp
+ 33a:	68 20 0a 00 00       	push   $0xa20
+ 33f:	6a 01                	push   $0x1
+ 341:	e8 af 04 00 00       	call   7f5 <printf>
+ 346:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n && i < top; i++){
+ 349:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 34d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 350:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+ 353:	7d 0f                	jge    364 <main+0x364>
+ 355:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 358:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 35b:	0f 8c c2 fe ff ff    	jl     223 <main+0x223>
+ 361:	eb 01                	jmp    364 <main+0x364>
+      break;
+ 363:	90                   	nop
+    }
+  }
+  exit();
+ 364:	e8 88 02 00 00       	call   5f1 <exit>
+
+00000369 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 369:	55                   	push   %ebp
+ 36a:	89 e5                	mov    %esp,%ebp
+ 36c:	57                   	push   %edi
+ 36d:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 36e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 371:	8b 55 10             	mov    0x10(%ebp),%edx
+ 374:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 377:	89 cb                	mov    %ecx,%ebx
+ 379:	89 df                	mov    %ebx,%edi
+ 37b:	89 d1                	mov    %edx,%ecx
+ 37d:	fc                   	cld
+ 37e:	f3 aa                	rep stos %al,%es:(%edi)
+ 380:	89 ca                	mov    %ecx,%edx
+ 382:	89 fb                	mov    %edi,%ebx
+ 384:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 387:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 38a:	90                   	nop
+ 38b:	5b                   	pop    %ebx
+ 38c:	5f                   	pop    %edi
+ 38d:	5d                   	pop    %ebp
+ 38e:	c3                   	ret
+
+0000038f <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 38f:	55                   	push   %ebp
+ 390:	89 e5                	mov    %esp,%ebp
+ 392:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 395:	8b 45 08             	mov    0x8(%ebp),%eax
+ 398:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 39b:	90                   	nop
+ 39c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 39f:	8d 42 01             	lea    0x1(%edx),%eax
+ 3a2:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3ab:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 3ae:	0f b6 12             	movzbl (%edx),%edx
+ 3b1:	88 10                	mov    %dl,(%eax)
+ 3b3:	0f b6 00             	movzbl (%eax),%eax
+ 3b6:	84 c0                	test   %al,%al
+ 3b8:	75 e2                	jne    39c <strcpy+0xd>
+    ;
+  return os;
+ 3ba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3bd:	c9                   	leave
+ 3be:	c3                   	ret
+
+000003bf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3bf:	55                   	push   %ebp
+ 3c0:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3c2:	eb 08                	jmp    3cc <strcmp+0xd>
+    p++, q++;
+ 3c4:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3c8:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	0f b6 00             	movzbl (%eax),%eax
+ 3d2:	84 c0                	test   %al,%al
+ 3d4:	74 10                	je     3e6 <strcmp+0x27>
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	0f b6 10             	movzbl (%eax),%edx
+ 3dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3df:	0f b6 00             	movzbl (%eax),%eax
+ 3e2:	38 c2                	cmp    %al,%dl
+ 3e4:	74 de                	je     3c4 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e9:	0f b6 00             	movzbl (%eax),%eax
+ 3ec:	0f b6 d0             	movzbl %al,%edx
+ 3ef:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f2:	0f b6 00             	movzbl (%eax),%eax
+ 3f5:	0f b6 c0             	movzbl %al,%eax
+ 3f8:	29 c2                	sub    %eax,%edx
+ 3fa:	89 d0                	mov    %edx,%eax
+}
+ 3fc:	5d                   	pop    %ebp
+ 3fd:	c3                   	ret
+
+000003fe <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3fe:	55                   	push   %ebp
+ 3ff:	89 e5                	mov    %esp,%ebp
+ 401:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 404:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 40b:	eb 04                	jmp    411 <strlen+0x13>
+ 40d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 411:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 414:	8b 45 08             	mov    0x8(%ebp),%eax
+ 417:	01 d0                	add    %edx,%eax
+ 419:	0f b6 00             	movzbl (%eax),%eax
+ 41c:	84 c0                	test   %al,%al
+ 41e:	75 ed                	jne    40d <strlen+0xf>
+    ;
+  return n;
+ 420:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 423:	c9                   	leave
+ 424:	c3                   	ret
+
+00000425 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 425:	55                   	push   %ebp
+ 426:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 428:	8b 45 10             	mov    0x10(%ebp),%eax
+ 42b:	50                   	push   %eax
+ 42c:	ff 75 0c             	push   0xc(%ebp)
+ 42f:	ff 75 08             	push   0x8(%ebp)
+ 432:	e8 32 ff ff ff       	call   369 <stosb>
+ 437:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 43a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 43d:	c9                   	leave
+ 43e:	c3                   	ret
+
+0000043f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 43f:	55                   	push   %ebp
+ 440:	89 e5                	mov    %esp,%ebp
+ 442:	83 ec 04             	sub    $0x4,%esp
+ 445:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 448:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 44b:	eb 14                	jmp    461 <strchr+0x22>
+    if(*s == c)
+ 44d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 450:	0f b6 00             	movzbl (%eax),%eax
+ 453:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 456:	75 05                	jne    45d <strchr+0x1e>
+      return (char*)s;
+ 458:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45b:	eb 13                	jmp    470 <strchr+0x31>
+  for(; *s; s++)
+ 45d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 461:	8b 45 08             	mov    0x8(%ebp),%eax
+ 464:	0f b6 00             	movzbl (%eax),%eax
+ 467:	84 c0                	test   %al,%al
+ 469:	75 e2                	jne    44d <strchr+0xe>
+  return 0;
+ 46b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 470:	c9                   	leave
+ 471:	c3                   	ret
+
+00000472 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 472:	55                   	push   %ebp
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 478:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 47f:	eb 42                	jmp    4c3 <gets+0x51>
+    cc = read(0, &c, 1);
+ 481:	83 ec 04             	sub    $0x4,%esp
+ 484:	6a 01                	push   $0x1
+ 486:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 489:	50                   	push   %eax
+ 48a:	6a 00                	push   $0x0
+ 48c:	e8 78 01 00 00       	call   609 <read>
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 497:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 49b:	7e 33                	jle    4d0 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 49d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 4a3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4a6:	89 c2                	mov    %eax,%edx
+ 4a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ab:	01 c2                	add    %eax,%edx
+ 4ad:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4b1:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4b3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4b7:	3c 0a                	cmp    $0xa,%al
+ 4b9:	74 16                	je     4d1 <gets+0x5f>
+ 4bb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4bf:	3c 0d                	cmp    $0xd,%al
+ 4c1:	74 0e                	je     4d1 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4c6:	83 c0 01             	add    $0x1,%eax
+ 4c9:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4cc:	7f b3                	jg     481 <gets+0xf>
+ 4ce:	eb 01                	jmp    4d1 <gets+0x5f>
+      break;
+ 4d0:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d7:	01 d0                	add    %edx,%eax
+ 4d9:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4dc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4df:	c9                   	leave
+ 4e0:	c3                   	ret
+
+000004e1 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4e1:	55                   	push   %ebp
+ 4e2:	89 e5                	mov    %esp,%ebp
+ 4e4:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4e7:	83 ec 08             	sub    $0x8,%esp
+ 4ea:	6a 00                	push   $0x0
+ 4ec:	ff 75 08             	push   0x8(%ebp)
+ 4ef:	e8 3d 01 00 00       	call   631 <open>
+ 4f4:	83 c4 10             	add    $0x10,%esp
+ 4f7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4fa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4fe:	79 07                	jns    507 <stat+0x26>
+    return -1;
+ 500:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 505:	eb 25                	jmp    52c <stat+0x4b>
+  r = fstat(fd, st);
+ 507:	83 ec 08             	sub    $0x8,%esp
+ 50a:	ff 75 0c             	push   0xc(%ebp)
+ 50d:	ff 75 f4             	push   -0xc(%ebp)
+ 510:	e8 34 01 00 00       	call   649 <fstat>
+ 515:	83 c4 10             	add    $0x10,%esp
+ 518:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 51b:	83 ec 0c             	sub    $0xc,%esp
+ 51e:	ff 75 f4             	push   -0xc(%ebp)
+ 521:	e8 f3 00 00 00       	call   619 <close>
+ 526:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 529:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 52c:	c9                   	leave
+ 52d:	c3                   	ret
+
+0000052e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 52e:	55                   	push   %ebp
+ 52f:	89 e5                	mov    %esp,%ebp
+ 531:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 534:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 53b:	eb 25                	jmp    562 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 53d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 540:	89 d0                	mov    %edx,%eax
+ 542:	c1 e0 02             	shl    $0x2,%eax
+ 545:	01 d0                	add    %edx,%eax
+ 547:	01 c0                	add    %eax,%eax
+ 549:	89 c1                	mov    %eax,%ecx
+ 54b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54e:	8d 50 01             	lea    0x1(%eax),%edx
+ 551:	89 55 08             	mov    %edx,0x8(%ebp)
+ 554:	0f b6 00             	movzbl (%eax),%eax
+ 557:	0f be c0             	movsbl %al,%eax
+ 55a:	01 c8                	add    %ecx,%eax
+ 55c:	83 e8 30             	sub    $0x30,%eax
+ 55f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 562:	8b 45 08             	mov    0x8(%ebp),%eax
+ 565:	0f b6 00             	movzbl (%eax),%eax
+ 568:	3c 2f                	cmp    $0x2f,%al
+ 56a:	7e 0a                	jle    576 <atoi+0x48>
+ 56c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56f:	0f b6 00             	movzbl (%eax),%eax
+ 572:	3c 39                	cmp    $0x39,%al
+ 574:	7e c7                	jle    53d <atoi+0xf>
+  return n;
+ 576:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 579:	c9                   	leave
+ 57a:	c3                   	ret
+
+0000057b <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 57b:	55                   	push   %ebp
+ 57c:	89 e5                	mov    %esp,%ebp
+ 57e:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 581:	8b 45 08             	mov    0x8(%ebp),%eax
+ 584:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 587:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 58a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 58d:	eb 17                	jmp    5a6 <memmove+0x2b>
+    *dst++ = *src++;
+ 58f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 592:	8d 42 01             	lea    0x1(%edx),%eax
+ 595:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 598:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 59b:	8d 48 01             	lea    0x1(%eax),%ecx
+ 59e:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5a1:	0f b6 12             	movzbl (%edx),%edx
+ 5a4:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 5a6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5a9:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5ac:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5af:	85 c0                	test   %eax,%eax
+ 5b1:	7f dc                	jg     58f <memmove+0x14>
+  return vdst;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5b6:	c9                   	leave
+ 5b7:	c3                   	ret
+
+000005b8 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 5b8:	55                   	push   %ebp
+ 5b9:	89 e5                	mov    %esp,%ebp
+ 5bb:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 5be:	83 ec 0c             	sub    $0xc,%esp
+ 5c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 5c4:	50                   	push   %eax
+ 5c5:	e8 ff 00 00 00       	call   6c9 <nanouptime>
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 5cd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5d0:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 5d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5d9:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 5de:	f7 e2                	mul    %edx
+ 5e0:	89 d0                	mov    %edx,%eax
+ 5e2:	c1 e8 06             	shr    $0x6,%eax
+ 5e5:	01 c8                	add    %ecx,%eax
+}
+ 5e7:	c9                   	leave
+ 5e8:	c3                   	ret
+
+000005e9 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5e9:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5ee:	cd 40                	int    $0x40
+ 5f0:	c3                   	ret
+
+000005f1 <exit>:
+SYSCALL(exit)
+ 5f1:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f6:	cd 40                	int    $0x40
+ 5f8:	c3                   	ret
+
+000005f9 <wait>:
+SYSCALL(wait)
+ 5f9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <pipe>:
+SYSCALL(pipe)
+ 601:	b8 04 00 00 00       	mov    $0x4,%eax
+ 606:	cd 40                	int    $0x40
+ 608:	c3                   	ret
+
+00000609 <read>:
+SYSCALL(read)
+ 609:	b8 05 00 00 00       	mov    $0x5,%eax
+ 60e:	cd 40                	int    $0x40
+ 610:	c3                   	ret
+
+00000611 <write>:
+SYSCALL(write)
+ 611:	b8 10 00 00 00       	mov    $0x10,%eax
+ 616:	cd 40                	int    $0x40
+ 618:	c3                   	ret
+
+00000619 <close>:
+SYSCALL(close)
+ 619:	b8 15 00 00 00       	mov    $0x15,%eax
+ 61e:	cd 40                	int    $0x40
+ 620:	c3                   	ret
+
+00000621 <kill>:
+SYSCALL(kill)
+ 621:	b8 06 00 00 00       	mov    $0x6,%eax
+ 626:	cd 40                	int    $0x40
+ 628:	c3                   	ret
+
+00000629 <exec>:
+SYSCALL(exec)
+ 629:	b8 07 00 00 00       	mov    $0x7,%eax
+ 62e:	cd 40                	int    $0x40
+ 630:	c3                   	ret
+
+00000631 <open>:
+SYSCALL(open)
+ 631:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <mknod>:
+SYSCALL(mknod)
+ 639:	b8 11 00 00 00       	mov    $0x11,%eax
+ 63e:	cd 40                	int    $0x40
+ 640:	c3                   	ret
+
+00000641 <unlink>:
+SYSCALL(unlink)
+ 641:	b8 12 00 00 00       	mov    $0x12,%eax
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <fstat>:
+SYSCALL(fstat)
+ 649:	b8 08 00 00 00       	mov    $0x8,%eax
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <link>:
+SYSCALL(link)
+ 651:	b8 13 00 00 00       	mov    $0x13,%eax
+ 656:	cd 40                	int    $0x40
+ 658:	c3                   	ret
+
+00000659 <mkdir>:
+SYSCALL(mkdir)
+ 659:	b8 14 00 00 00       	mov    $0x14,%eax
+ 65e:	cd 40                	int    $0x40
+ 660:	c3                   	ret
+
+00000661 <chdir>:
+SYSCALL(chdir)
+ 661:	b8 09 00 00 00       	mov    $0x9,%eax
+ 666:	cd 40                	int    $0x40
+ 668:	c3                   	ret
+
+00000669 <dup>:
+SYSCALL(dup)
+ 669:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 66e:	cd 40                	int    $0x40
+ 670:	c3                   	ret
+
+00000671 <getpid>:
+SYSCALL(getpid)
+ 671:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 676:	cd 40                	int    $0x40
+ 678:	c3                   	ret
+
+00000679 <sbrk>:
+SYSCALL(sbrk)
+ 679:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 67e:	cd 40                	int    $0x40
+ 680:	c3                   	ret
+
+00000681 <sleep>:
+SYSCALL(sleep)
+ 681:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 686:	cd 40                	int    $0x40
+ 688:	c3                   	ret
+
+00000689 <uptime>:
+SYSCALL(uptime)
+ 689:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 68e:	cd 40                	int    $0x40
+ 690:	c3                   	ret
+
+00000691 <saveProc>:
+SYSCALL(saveProc)
+ 691:	b8 16 00 00 00       	mov    $0x16,%eax
+ 696:	cd 40                	int    $0x40
+ 698:	c3                   	ret
+
+00000699 <loadProc>:
+SYSCALL(loadProc)
+ 699:	b8 17 00 00 00       	mov    $0x17,%eax
+ 69e:	cd 40                	int    $0x40
+ 6a0:	c3                   	ret
+
+000006a1 <setpriority>:
+SYSCALL(setpriority)
+ 6a1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a6:	cd 40                	int    $0x40
+ 6a8:	c3                   	ret
+
+000006a9 <setaffinity>:
+SYSCALL(setaffinity)
+ 6a9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <getaffinity>:
+SYSCALL(getaffinity)
+ 6b1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <nanosleep>:
+SYSCALL(nanosleep)
+ 6b9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6be:	cd 40                	int    $0x40
+ 6c0:	c3                   	ret
+
+000006c1 <cpustat>:
+SYSCALL(cpustat)
+ 6c1:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c6:	cd 40                	int    $0x40
+ 6c8:	c3                   	ret
+
+000006c9 <nanouptime>:
+SYSCALL(nanouptime)
+ 6c9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6ce:	cd 40                	int    $0x40
+ 6d0:	c3                   	ret
+
+000006d1 <settickets>:
+SYSCALL(settickets)
+ 6d1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d6:	cd 40                	int    $0x40
+ 6d8:	c3                   	ret
+
+000006d9 <setdeadline>:
+SYSCALL(setdeadline)
+ 6d9:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6de:	cd 40                	int    $0x40
+ 6e0:	c3                   	ret
+
+000006e1 <rtstat>:
+SYSCALL(rtstat)
+ 6e1:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e6:	cd 40                	int    $0x40
+ 6e8:	c3                   	ret
+
+000006e9 <schedstat>:
+SYSCALL(schedstat)
+ 6e9:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6ee:	cd 40                	int    $0x40
+ 6f0:	c3                   	ret
+
+000006f1 <waitpid>:
+SYSCALL(waitpid)
+ 6f1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f6:	cd 40                	int    $0x40
+ 6f8:	c3                   	ret
+
+000006f9 <clone>:
+SYSCALL(clone)
+ 6f9:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6fe:	cd 40                	int    $0x40
+ 700:	c3                   	ret
+
+00000701 <futexwait>:
+SYSCALL(futexwait)
+ 701:	b8 25 00 00 00       	mov    $0x25,%eax
+ 706:	cd 40                	int    $0x40
+ 708:	c3                   	ret
+
+00000709 <futexwake>:
+SYSCALL(futexwake)
+ 709:	b8 26 00 00 00       	mov    $0x26,%eax
+ 70e:	cd 40                	int    $0x40
+ 710:	c3                   	ret
+
+00000711 <lockstat>:
+SYSCALL(lockstat)
+ 711:	b8 27 00 00 00       	mov    $0x27,%eax
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <dcachestat>:
+SYSCALL(dcachestat)
+ 719:	b8 28 00 00 00       	mov    $0x28,%eax
+ 71e:	cd 40                	int    $0x40
+ 720:	c3                   	ret
+
+00000721 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 721:	55                   	push   %ebp
+ 722:	89 e5                	mov    %esp,%ebp
+ 724:	83 ec 18             	sub    $0x18,%esp
+ 727:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 72a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 72d:	83 ec 04             	sub    $0x4,%esp
+ 730:	6a 01                	push   $0x1
+ 732:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 735:	50                   	push   %eax
+ 736:	ff 75 08             	push   0x8(%ebp)
+ 739:	e8 d3 fe ff ff       	call   611 <write>
+ 73e:	83 c4 10             	add    $0x10,%esp
+}
+ 741:	90                   	nop
+ 742:	c9                   	leave
+ 743:	c3                   	ret
+
+00000744 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 744:	55                   	push   %ebp
+ 745:	89 e5                	mov    %esp,%ebp
+ 747:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 74a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 751:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 755:	74 17                	je     76e <printint+0x2a>
+ 757:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 75b:	79 11                	jns    76e <printint+0x2a>
+    neg = 1;
+ 75d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 764:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 767:	f7 d8                	neg    %eax
+ 769:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 76c:	eb 06                	jmp    774 <printint+0x30>
+  } else {
+    x = xx;
+ 76e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 771:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 774:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 77b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 77e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 781:	ba 00 00 00 00       	mov    $0x0,%edx
+ 786:	f7 f1                	div    %ecx
+ 788:	89 d1                	mov    %edx,%ecx
+ 78a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 78d:	8d 50 01             	lea    0x1(%eax),%edx
+ 790:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 793:	0f b6 91 34 0c 00 00 	movzbl 0xc34(%ecx),%edx
+ 79a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 79e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7a1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7a4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7a9:	f7 f1                	div    %ecx
+ 7ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7ae:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7b2:	75 c7                	jne    77b <printint+0x37>
+  if(neg)
+ 7b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 7b8:	74 2d                	je     7e7 <printint+0xa3>
+    buf[i++] = '-';
+ 7ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7bd:	8d 50 01             	lea    0x1(%eax),%edx
+ 7c0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7c3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7c8:	eb 1d                	jmp    7e7 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7ca:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7d0:	01 d0                	add    %edx,%eax
+ 7d2:	0f b6 00             	movzbl (%eax),%eax
+ 7d5:	0f be c0             	movsbl %al,%eax
+ 7d8:	83 ec 08             	sub    $0x8,%esp
+ 7db:	50                   	push   %eax
+ 7dc:	ff 75 08             	push   0x8(%ebp)
+ 7df:	e8 3d ff ff ff       	call   721 <putc>
+ 7e4:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7e7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7eb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7ef:	79 d9                	jns    7ca <printint+0x86>
+}
+ 7f1:	90                   	nop
+ 7f2:	90                   	nop
+ 7f3:	c9                   	leave
+ 7f4:	c3                   	ret
+
+000007f5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7f5:	55                   	push   %ebp
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7fb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 802:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 80b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 812:	e9 59 01 00 00       	jmp    970 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 817:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 81a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 81d:	01 d0                	add    %edx,%eax
+ 81f:	0f b6 00             	movzbl (%eax),%eax
+ 822:	0f be c0             	movsbl %al,%eax
+ 825:	25 ff 00 00 00       	and    $0xff,%eax
+ 82a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 82d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 831:	75 2c                	jne    85f <printf+0x6a>
+      if(c == '%'){
+ 833:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 837:	75 0c                	jne    845 <printf+0x50>
+        state = '%';
+ 839:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 840:	e9 27 01 00 00       	jmp    96c <printf+0x177>
+      } else {
+        putc(fd, c);
+ 845:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 848:	0f be c0             	movsbl %al,%eax
+ 84b:	83 ec 08             	sub    $0x8,%esp
+ 84e:	50                   	push   %eax
+ 84f:	ff 75 08             	push   0x8(%ebp)
+ 852:	e8 ca fe ff ff       	call   721 <putc>
+ 857:	83 c4 10             	add    $0x10,%esp
+ 85a:	e9 0d 01 00 00       	jmp    96c <printf+0x177>
+      }
+    } else if(state == '%'){
+ 85f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 863:	0f 85 03 01 00 00    	jne    96c <printf+0x177>
+      if(c == 'd'){
+ 869:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 86d:	75 1e                	jne    88d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 86f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 872:	8b 00                	mov    (%eax),%eax
+ 874:	6a 01                	push   $0x1
+ 876:	6a 0a                	push   $0xa
+ 878:	50                   	push   %eax
+ 879:	ff 75 08             	push   0x8(%ebp)
+ 87c:	e8 c3 fe ff ff       	call   744 <printint>
+ 881:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 884:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 888:	e9 d8 00 00 00       	jmp    965 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 88d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 891:	74 06                	je     899 <printf+0xa4>
+ 893:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 897:	75 1e                	jne    8b7 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 899:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89c:	8b 00                	mov    (%eax),%eax
+ 89e:	6a 00                	push   $0x0
+ 8a0:	6a 10                	push   $0x10
+ 8a2:	50                   	push   %eax
+ 8a3:	ff 75 08             	push   0x8(%ebp)
+ 8a6:	e8 99 fe ff ff       	call   744 <printint>
+ 8ab:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8ae:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8b2:	e9 ae 00 00 00       	jmp    965 <printf+0x170>
+      } else if(c == 's'){
+ 8b7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 8bb:	75 43                	jne    900 <printf+0x10b>
+        s = (char*)*ap;
+ 8bd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8c0:	8b 00                	mov    (%eax),%eax
+ 8c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8c5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8cd:	75 25                	jne    8f4 <printf+0xff>
+          s = "(null)";
+ 8cf:	c7 45 f4 22 0a 00 00 	movl   $0xa22,-0xc(%ebp)
+        while(*s != 0){
+ 8d6:	eb 1c                	jmp    8f4 <printf+0xff>
+          putc(fd, *s);
+ 8d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8db:	0f b6 00             	movzbl (%eax),%eax
+ 8de:	0f be c0             	movsbl %al,%eax
+ 8e1:	83 ec 08             	sub    $0x8,%esp
+ 8e4:	50                   	push   %eax
+ 8e5:	ff 75 08             	push   0x8(%ebp)
+ 8e8:	e8 34 fe ff ff       	call   721 <putc>
+ 8ed:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8f0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f7:	0f b6 00             	movzbl (%eax),%eax
+ 8fa:	84 c0                	test   %al,%al
+ 8fc:	75 da                	jne    8d8 <printf+0xe3>
+ 8fe:	eb 65                	jmp    965 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 900:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 904:	75 1d                	jne    923 <printf+0x12e>
+        putc(fd, *ap);
+ 906:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 909:	8b 00                	mov    (%eax),%eax
+ 90b:	0f be c0             	movsbl %al,%eax
+ 90e:	83 ec 08             	sub    $0x8,%esp
+ 911:	50                   	push   %eax
+ 912:	ff 75 08             	push   0x8(%ebp)
+ 915:	e8 07 fe ff ff       	call   721 <putc>
+ 91a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 91d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 921:	eb 42                	jmp    965 <printf+0x170>
+      } else if(c == '%'){
+ 923:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 927:	75 17                	jne    940 <printf+0x14b>
+        putc(fd, c);
+ 929:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 92c:	0f be c0             	movsbl %al,%eax
+ 92f:	83 ec 08             	sub    $0x8,%esp
+ 932:	50                   	push   %eax
+ 933:	ff 75 08             	push   0x8(%ebp)
+ 936:	e8 e6 fd ff ff       	call   721 <putc>
+ 93b:	83 c4 10             	add    $0x10,%esp
+ 93e:	eb 25                	jmp    965 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 940:	83 ec 08             	sub    $0x8,%esp
+ 943:	6a 25                	push   $0x25
+ 945:	ff 75 08             	push   0x8(%ebp)
+ 948:	e8 d4 fd ff ff       	call   721 <putc>
+ 94d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 950:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 953:	0f be c0             	movsbl %al,%eax
+ 956:	83 ec 08             	sub    $0x8,%esp
+ 959:	50                   	push   %eax
+ 95a:	ff 75 08             	push   0x8(%ebp)
+ 95d:	e8 bf fd ff ff       	call   721 <putc>
+ 962:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 965:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 96c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 970:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 973:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 976:	01 d0                	add    %edx,%eax
+ 978:	0f b6 00             	movzbl (%eax),%eax
+ 97b:	84 c0                	test   %al,%al
+ 97d:	0f 85 94 fe ff ff    	jne    817 <printf+0x22>
+    }
+  }
+}
+ 983:	90                   	nop
+ 984:	90                   	nop
+ 985:	c9                   	leave
+ 986:	c3                   	ret
@@ -0,0 +1,55 @@
+// Print the most contended kernel spinlocks, by total time
+// spent waiting for them, with the call stack of each one's
+// longest wait (look the addresses up in kernel.asm).
+// lockstat [n] prints the top n, 10 by default.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define MAXLOCK 64
+
+static struct lockstat ls[MAXLOCK];
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat t;
+  int n, top, i, j, k;
+
+  top = 10;
+  if(argc > 1 && (top = atoi(argv[1])) <= 0){
+    printf(2, "usage: lockstat [n]\n");
+    exit();
+  }
+  if((n = lockstat(ls, MAXLOCK)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  // Sort by time spent waiting, then by waits.
+  for(i = 1; i < n; i++){
+    t = ls[i];
+    for(j = i; j > 0 && (ls[j-1].spinus < t.spinus ||
+        (ls[j-1].spinus == t.spinus && ls[j-1].ncontend < t.ncontend)); j--)
+      ls[j] = ls[j-1];
+    ls[j] = t;
+  }
+
+  for(i = 0; i < n && i < top; i++){
+    if(ls[i].nacquire == 0)
+      break;
+    printf(1, "%s: %d acquired, %d contended, %dus waiting\n",
+           ls[i].name, ls[i].nacquire, ls[i].ncontend, ls[i].spinus);
+    printf(1, "  longest wait %dns, longest hold %dns\n",
+           ls[i].maxspin, ls[i].maxhold);
+    if(ls[i].ncontend){
+      printf(1, "  longest wait from");
+      for(k = 0; k < NLOCKPCS && ls[i].pcs[k]; k++)
+        printf(1, " %x", ls[i].pcs[k]);
+      printf(1, "\n");
+    }
+  }
+  exit();
+}
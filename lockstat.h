@@ -0,0 +1,14 @@
+#define NLOCKPCS   4   // callers recorded per lock class
+#define NLOCKCLASS 64  // lock names with their own statistics
+
+// Contention record of the spinlocks sharing one name,
+// filled in by lockstat().
+struct lockstat {
+  char name[16];
+  uint nacquire;        // acquisitions
+  uint ncontend;        // of those, ones that had to wait
+  uint spinus;          // total time spent waiting, microseconds
+  uint maxspin;         // longest wait, nanoseconds
+  uint maxhold;         // longest time held, nanoseconds
+  uint pcs[NLOCKPCS];   // call stack of the longest wait
+};
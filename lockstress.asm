@@ -0,0 +1,1226 @@
+
+_lockstress:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  uint calls;
+};
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	81 ec 10 01 00 00    	sub    $0x110,%esp
+  15:	89 c8                	mov    %ecx,%eax
+  struct cpustat st;
+  struct result r;
+  uint count[MAXCPU], calls, total, min, max, end;
+  int fd[2], n, c, duration;
+
+  duration = 200;
+  17:	c7 45 dc c8 00 00 00 	movl   $0xc8,-0x24(%ebp)
+  if(argc > 1 && (duration = atoi(argv[1])) <= 0){
+  1e:	83 38 01             	cmpl   $0x1,(%eax)
+  21:	7e 34                	jle    57 <main+0x57>
+  23:	8b 40 04             	mov    0x4(%eax),%eax
+  26:	83 c0 04             	add    $0x4,%eax
+  29:	8b 00                	mov    (%eax),%eax
+  2b:	83 ec 0c             	sub    $0xc,%esp
+  2e:	50                   	push   %eax
+  2f:	e8 76 04 00 00       	call   4aa <atoi>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  3a:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  3e:	7f 17                	jg     57 <main+0x57>
+    printf(2, "usage: lockstress [ticks]\n");
+  40:	83 ec 08             	sub    $0x8,%esp
+  43:	68 04 09 00 00       	push   $0x904
+  48:	6a 02                	push   $0x2
+  4a:	e8 22 07 00 00       	call   771 <printf>
+  4f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  52:	e8 16 05 00 00       	call   56d <exit>
+  }
+  for(n = 0; n < MAXCPU && cpustat(n, &st) == 0; n++)
+  57:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  5e:	eb 04                	jmp    64 <main+0x64>
+  60:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  64:	83 7d e4 07          	cmpl   $0x7,-0x1c(%ebp)
+  68:	7f 19                	jg     83 <main+0x83>
+  6a:	83 ec 08             	sub    $0x8,%esp
+  6d:	8d 85 18 ff ff ff    	lea    -0xe8(%ebp),%eax
+  73:	50                   	push   %eax
+  74:	ff 75 e4             	push   -0x1c(%ebp)
+  77:	e8 c1 05 00 00       	call   63d <cpustat>
+  7c:	83 c4 10             	add    $0x10,%esp
+  7f:	85 c0                	test   %eax,%eax
+  81:	74 dd                	je     60 <main+0x60>
+    ;
+  if(pipe(fd) < 0){
+  83:	83 ec 0c             	sub    $0xc,%esp
+  86:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8c:	50                   	push   %eax
+  8d:	e8 eb 04 00 00       	call   57d <pipe>
+  92:	83 c4 10             	add    $0x10,%esp
+  95:	85 c0                	test   %eax,%eax
+  97:	79 17                	jns    b0 <main+0xb0>
+    printf(2, "lockstress: pipe failed\n");
+  99:	83 ec 08             	sub    $0x8,%esp
+  9c:	68 1f 09 00 00       	push   $0x91f
+  a1:	6a 02                	push   $0x2
+  a3:	e8 c9 06 00 00       	call   771 <printf>
+  a8:	83 c4 10             	add    $0x10,%esp
+    exit();
+  ab:	e8 bd 04 00 00       	call   56d <exit>
+  }
+
+  end = uptime() + 10 + duration;
+  b0:	e8 50 05 00 00       	call   605 <uptime>
+  b5:	8d 50 0a             	lea    0xa(%eax),%edx
+  b8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  bb:	01 d0                	add    %edx,%eax
+  bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for(c = 0; c < n; c++){
+  c0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  c7:	e9 a2 00 00 00       	jmp    16e <main+0x16e>
+    if(fork() == 0){
+  cc:	e8 94 04 00 00       	call   565 <fork>
+  d1:	85 c0                	test   %eax,%eax
+  d3:	0f 85 91 00 00 00    	jne    16a <main+0x16a>
+      close(fd[0]);
+  d9:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+  df:	83 ec 0c             	sub    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	e8 ad 04 00 00       	call   595 <close>
+  e8:	83 c4 10             	add    $0x10,%esp
+      setaffinity(getpid(), 1 << c);
+  eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  f3:	89 c1                	mov    %eax,%ecx
+  f5:	d3 e2                	shl    %cl,%edx
+  f7:	89 d0                	mov    %edx,%eax
+  f9:	89 c3                	mov    %eax,%ebx
+  fb:	e8 ed 04 00 00       	call   5ed <getpid>
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	53                   	push   %ebx
+ 104:	50                   	push   %eax
+ 105:	e8 1b 05 00 00       	call   625 <setaffinity>
+ 10a:	83 c4 10             	add    $0x10,%esp
+      // Start together once every CPU has its process.
+      while(uptime() < end - duration)
+ 10d:	90                   	nop
+ 10e:	e8 f2 04 00 00       	call   605 <uptime>
+ 113:	89 c1                	mov    %eax,%ecx
+ 115:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 118:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 11b:	29 c2                	sub    %eax,%edx
+ 11d:	39 d1                	cmp    %edx,%ecx
+ 11f:	72 ed                	jb     10e <main+0x10e>
+        ;
+      for(calls = 0; uptime() < end; calls++)
+ 121:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 128:	eb 04                	jmp    12e <main+0x12e>
+ 12a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 12e:	e8 d2 04 00 00       	call   605 <uptime>
+ 133:	3b 45 d8             	cmp    -0x28(%ebp),%eax
+ 136:	72 f2                	jb     12a <main+0x12a>
+        ;
+      // One write, so that results cannot interleave.
+      r.cpu = c;
+ 138:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 13b:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+      r.calls = calls;
+ 141:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 144:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+      write(fd[1], &r, sizeof(r));
+ 14a:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+ 150:	83 ec 04             	sub    $0x4,%esp
+ 153:	6a 08                	push   $0x8
+ 155:	8d 95 10 ff ff ff    	lea    -0xf0(%ebp),%edx
+ 15b:	52                   	push   %edx
+ 15c:	50                   	push   %eax
+ 15d:	e8 2b 04 00 00       	call   58d <write>
+ 162:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 165:	e8 03 04 00 00       	call   56d <exit>
+  for(c = 0; c < n; c++){
+ 16a:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 16e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 171:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+ 174:	0f 8c 52 ff ff ff    	jl     cc <main+0xcc>
+    }
+  }
+  close(fd[1]);
+ 17a:	8b 85 ec fe ff ff    	mov    -0x114(%ebp),%eax
+ 180:	83 ec 0c             	sub    $0xc,%esp
+ 183:	50                   	push   %eax
+ 184:	e8 0c 04 00 00       	call   595 <close>
+ 189:	83 c4 10             	add    $0x10,%esp
+
+  for(c = 0; c < n; c++)
+ 18c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 193:	eb 12                	jmp    1a7 <main+0x1a7>
+    count[c] = 0;
+ 195:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 198:	c7 84 85 f0 fe ff ff 	movl   $0x0,-0x110(%ebp,%eax,4)
+ 19f:	00 00 00 00 
+  for(c = 0; c < n; c++)
+ 1a3:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 1a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1aa:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+ 1ad:	7c e6                	jl     195 <main+0x195>
+  while(read(fd[0], &r, sizeof(r)) == sizeof(r))
+ 1af:	eb 28                	jmp    1d9 <main+0x1d9>
+    if(r.cpu >= 0 && r.cpu < n)
+ 1b1:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+ 1b7:	85 c0                	test   %eax,%eax
+ 1b9:	78 1e                	js     1d9 <main+0x1d9>
+ 1bb:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+ 1c1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+ 1c4:	7e 13                	jle    1d9 <main+0x1d9>
+      count[r.cpu] = r.calls;
+ 1c6:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+ 1cc:	8b 95 14 ff ff ff    	mov    -0xec(%ebp),%edx
+ 1d2:	89 94 85 f0 fe ff ff 	mov    %edx,-0x110(%ebp,%eax,4)
+  while(read(fd[0], &r, sizeof(r)) == sizeof(r))
+ 1d9:	8b 85 e8 fe ff ff    	mov    -0x118(%ebp),%eax
+ 1df:	83 ec 04             	sub    $0x4,%esp
+ 1e2:	6a 08                	push   $0x8
+ 1e4:	8d 95 10 ff ff ff    	lea    -0xf0(%ebp),%edx
+ 1ea:	52                   	push   %edx
+ 1eb:	50                   	push   %eax
+ 1ec:	e8 94 03 00 00       	call   585 <read>
+ 1f1:	83 c4 10             	add    $0x10,%esp
+ 1f4:	83 f8 08             	cmp    $0x8,%eax
+ 1f7:	74 b8                	je     1b1 <main+0x1b1>
+  while(wait() >= 0)
+ 1f9:	90                   	nop
+ 1fa:	e8 76 03 00 00       	call   575 <wait>
+ 1ff:	85 c0                	test   %eax,%eax
+ 201:	79 f7                	jns    1fa <main+0x1fa>
+    ;
+
+  total = 0;
+ 203:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  min = max = count[0];
+ 20a:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+ 210:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 213:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 216:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(c = 0; c < n; c++){
+ 219:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 220:	eb 66                	jmp    288 <main+0x288>
+    printf(1, "cpu%d: %d acquisitions\n", c, count[c]);
+ 222:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 225:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 22c:	50                   	push   %eax
+ 22d:	ff 75 e0             	push   -0x20(%ebp)
+ 230:	68 38 09 00 00       	push   $0x938
+ 235:	6a 01                	push   $0x1
+ 237:	e8 35 05 00 00       	call   771 <printf>
+ 23c:	83 c4 10             	add    $0x10,%esp
+    total += count[c];
+ 23f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 242:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 249:	01 45 f0             	add    %eax,-0x10(%ebp)
+    if(count[c] < min)
+ 24c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 24f:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 256:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 259:	73 0d                	jae    268 <main+0x268>
+      min = count[c];
+ 25b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 25e:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 265:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(count[c] > max)
+ 268:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 26b:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 272:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 275:	73 0d                	jae    284 <main+0x284>
+      max = count[c];
+ 277:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 27a:	8b 84 85 f0 fe ff ff 	mov    -0x110(%ebp,%eax,4),%eax
+ 281:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(c = 0; c < n; c++){
+ 284:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 288:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 28b:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+ 28e:	7c 92                	jl     222 <main+0x222>
+  }
+  printf(1, "%d cpus, %d acquisitions in %d ticks, %d per tick\n",
+ 290:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+ 293:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 296:	ba 00 00 00 00       	mov    $0x0,%edx
+ 29b:	f7 f3                	div    %ebx
+ 29d:	83 ec 08             	sub    $0x8,%esp
+ 2a0:	50                   	push   %eax
+ 2a1:	ff 75 dc             	push   -0x24(%ebp)
+ 2a4:	ff 75 f0             	push   -0x10(%ebp)
+ 2a7:	ff 75 e4             	push   -0x1c(%ebp)
+ 2aa:	68 50 09 00 00       	push   $0x950
+ 2af:	6a 01                	push   $0x1
+ 2b1:	e8 bb 04 00 00       	call   771 <printf>
+ 2b6:	83 c4 20             	add    $0x20,%esp
+         n, total, duration, total / duration);
+  if(max > 0)
+ 2b9:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+ 2bd:	74 21                	je     2e0 <main+0x2e0>
+    printf(1, "fairness: least-served cpu got %d%% of the most-served\n",
+           min * 100 / max);
+ 2bf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 2c2:	6b c0 64             	imul   $0x64,%eax,%eax
+    printf(1, "fairness: least-served cpu got %d%% of the most-served\n",
+ 2c5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2ca:	f7 75 e8             	divl   -0x18(%ebp)
+ 2cd:	83 ec 04             	sub    $0x4,%esp
+ 2d0:	50                   	push   %eax
+ 2d1:	68 84 09 00 00       	push   $0x984
+ 2d6:	6a 01                	push   $0x1
+ 2d8:	e8 94 04 00 00       	call   771 <printf>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 2e0:	e8 88 02 00 00       	call   56d <exit>
+
+000002e5 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 2e5:	55                   	push   %ebp
+ 2e6:	89 e5                	mov    %esp,%ebp
+ 2e8:	57                   	push   %edi
+ 2e9:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 2ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2ed:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2f3:	89 cb                	mov    %ecx,%ebx
+ 2f5:	89 df                	mov    %ebx,%edi
+ 2f7:	89 d1                	mov    %edx,%ecx
+ 2f9:	fc                   	cld
+ 2fa:	f3 aa                	rep stos %al,%es:(%edi)
+ 2fc:	89 ca                	mov    %ecx,%edx
+ 2fe:	89 fb                	mov    %edi,%ebx
+ 300:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 303:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 306:	90                   	nop
+ 307:	5b                   	pop    %ebx
+ 308:	5f                   	pop    %edi
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+
+0000030b <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 30b:	55                   	push   %ebp
+ 30c:	89 e5                	mov    %esp,%ebp
+ 30e:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+ 314:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 317:	90                   	nop
+ 318:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 31b:	8d 42 01             	lea    0x1(%edx),%eax
+ 31e:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 321:	8b 45 08             	mov    0x8(%ebp),%eax
+ 324:	8d 48 01             	lea    0x1(%eax),%ecx
+ 327:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 32a:	0f b6 12             	movzbl (%edx),%edx
+ 32d:	88 10                	mov    %dl,(%eax)
+ 32f:	0f b6 00             	movzbl (%eax),%eax
+ 332:	84 c0                	test   %al,%al
+ 334:	75 e2                	jne    318 <strcpy+0xd>
+    ;
+  return os;
+ 336:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 339:	c9                   	leave
+ 33a:	c3                   	ret
+
+0000033b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 33b:	55                   	push   %ebp
+ 33c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 33e:	eb 08                	jmp    348 <strcmp+0xd>
+    p++, q++;
+ 340:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 344:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 348:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34b:	0f b6 00             	movzbl (%eax),%eax
+ 34e:	84 c0                	test   %al,%al
+ 350:	74 10                	je     362 <strcmp+0x27>
+ 352:	8b 45 08             	mov    0x8(%ebp),%eax
+ 355:	0f b6 10             	movzbl (%eax),%edx
+ 358:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35b:	0f b6 00             	movzbl (%eax),%eax
+ 35e:	38 c2                	cmp    %al,%dl
+ 360:	74 de                	je     340 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 362:	8b 45 08             	mov    0x8(%ebp),%eax
+ 365:	0f b6 00             	movzbl (%eax),%eax
+ 368:	0f b6 d0             	movzbl %al,%edx
+ 36b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36e:	0f b6 00             	movzbl (%eax),%eax
+ 371:	0f b6 c0             	movzbl %al,%eax
+ 374:	29 c2                	sub    %eax,%edx
+ 376:	89 d0                	mov    %edx,%eax
+}
+ 378:	5d                   	pop    %ebp
+ 379:	c3                   	ret
+
+0000037a <strlen>:
+
+uint
+strlen(char *s)
+{
+ 37a:	55                   	push   %ebp
+ 37b:	89 e5                	mov    %esp,%ebp
+ 37d:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 380:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 387:	eb 04                	jmp    38d <strlen+0x13>
+ 389:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 38d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	01 d0                	add    %edx,%eax
+ 395:	0f b6 00             	movzbl (%eax),%eax
+ 398:	84 c0                	test   %al,%al
+ 39a:	75 ed                	jne    389 <strlen+0xf>
+    ;
+  return n;
+ 39c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3a4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a7:	50                   	push   %eax
+ 3a8:	ff 75 0c             	push   0xc(%ebp)
+ 3ab:	ff 75 08             	push   0x8(%ebp)
+ 3ae:	e8 32 ff ff ff       	call   2e5 <stosb>
+ 3b3:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b9:	c9                   	leave
+ 3ba:	c3                   	ret
+
+000003bb <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3bb:	55                   	push   %ebp
+ 3bc:	89 e5                	mov    %esp,%ebp
+ 3be:	83 ec 04             	sub    $0x4,%esp
+ 3c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c4:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3c7:	eb 14                	jmp    3dd <strchr+0x22>
+    if(*s == c)
+ 3c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cc:	0f b6 00             	movzbl (%eax),%eax
+ 3cf:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3d2:	75 05                	jne    3d9 <strchr+0x1e>
+      return (char*)s;
+ 3d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d7:	eb 13                	jmp    3ec <strchr+0x31>
+  for(; *s; s++)
+ 3d9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e0:	0f b6 00             	movzbl (%eax),%eax
+ 3e3:	84 c0                	test   %al,%al
+ 3e5:	75 e2                	jne    3c9 <strchr+0xe>
+  return 0;
+ 3e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ec:	c9                   	leave
+ 3ed:	c3                   	ret
+
+000003ee <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3ee:	55                   	push   %ebp
+ 3ef:	89 e5                	mov    %esp,%ebp
+ 3f1:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3fb:	eb 42                	jmp    43f <gets+0x51>
+    cc = read(0, &c, 1);
+ 3fd:	83 ec 04             	sub    $0x4,%esp
+ 400:	6a 01                	push   $0x1
+ 402:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 405:	50                   	push   %eax
+ 406:	6a 00                	push   $0x0
+ 408:	e8 78 01 00 00       	call   585 <read>
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 413:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 417:	7e 33                	jle    44c <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 41c:	8d 50 01             	lea    0x1(%eax),%edx
+ 41f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 422:	89 c2                	mov    %eax,%edx
+ 424:	8b 45 08             	mov    0x8(%ebp),%eax
+ 427:	01 c2                	add    %eax,%edx
+ 429:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 42d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 42f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 433:	3c 0a                	cmp    $0xa,%al
+ 435:	74 16                	je     44d <gets+0x5f>
+ 437:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 43b:	3c 0d                	cmp    $0xd,%al
+ 43d:	74 0e                	je     44d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 43f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 442:	83 c0 01             	add    $0x1,%eax
+ 445:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 448:	7f b3                	jg     3fd <gets+0xf>
+ 44a:	eb 01                	jmp    44d <gets+0x5f>
+      break;
+ 44c:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 44d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 450:	8b 45 08             	mov    0x8(%ebp),%eax
+ 453:	01 d0                	add    %edx,%eax
+ 455:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 458:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+
+0000045d <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 45d:	55                   	push   %ebp
+ 45e:	89 e5                	mov    %esp,%ebp
+ 460:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 463:	83 ec 08             	sub    $0x8,%esp
+ 466:	6a 00                	push   $0x0
+ 468:	ff 75 08             	push   0x8(%ebp)
+ 46b:	e8 3d 01 00 00       	call   5ad <open>
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 476:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 47a:	79 07                	jns    483 <stat+0x26>
+    return -1;
+ 47c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 481:	eb 25                	jmp    4a8 <stat+0x4b>
+  r = fstat(fd, st);
+ 483:	83 ec 08             	sub    $0x8,%esp
+ 486:	ff 75 0c             	push   0xc(%ebp)
+ 489:	ff 75 f4             	push   -0xc(%ebp)
+ 48c:	e8 34 01 00 00       	call   5c5 <fstat>
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 497:	83 ec 0c             	sub    $0xc,%esp
+ 49a:	ff 75 f4             	push   -0xc(%ebp)
+ 49d:	e8 f3 00 00 00       	call   595 <close>
+ 4a2:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4a8:	c9                   	leave
+ 4a9:	c3                   	ret
+
+000004aa <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4aa:	55                   	push   %ebp
+ 4ab:	89 e5                	mov    %esp,%ebp
+ 4ad:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 4b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4b7:	eb 25                	jmp    4de <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4b9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4bc:	89 d0                	mov    %edx,%eax
+ 4be:	c1 e0 02             	shl    $0x2,%eax
+ 4c1:	01 d0                	add    %edx,%eax
+ 4c3:	01 c0                	add    %eax,%eax
+ 4c5:	89 c1                	mov    %eax,%ecx
+ 4c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ca:	8d 50 01             	lea    0x1(%eax),%edx
+ 4cd:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4d0:	0f b6 00             	movzbl (%eax),%eax
+ 4d3:	0f be c0             	movsbl %al,%eax
+ 4d6:	01 c8                	add    %ecx,%eax
+ 4d8:	83 e8 30             	sub    $0x30,%eax
+ 4db:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e1:	0f b6 00             	movzbl (%eax),%eax
+ 4e4:	3c 2f                	cmp    $0x2f,%al
+ 4e6:	7e 0a                	jle    4f2 <atoi+0x48>
+ 4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4eb:	0f b6 00             	movzbl (%eax),%eax
+ 4ee:	3c 39                	cmp    $0x39,%al
+ 4f0:	7e c7                	jle    4b9 <atoi+0xf>
+  return n;
+ 4f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4f5:	c9                   	leave
+ 4f6:	c3                   	ret
+
+000004f7 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4f7:	55                   	push   %ebp
+ 4f8:	89 e5                	mov    %esp,%ebp
+ 4fa:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 4fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 500:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 503:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 506:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 509:	eb 17                	jmp    522 <memmove+0x2b>
+    *dst++ = *src++;
+ 50b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 50e:	8d 42 01             	lea    0x1(%edx),%eax
+ 511:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 514:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 517:	8d 48 01             	lea    0x1(%eax),%ecx
+ 51a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 51d:	0f b6 12             	movzbl (%edx),%edx
+ 520:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 522:	8b 45 10             	mov    0x10(%ebp),%eax
+ 525:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 528:	89 55 10             	mov    %edx,0x10(%ebp)
+ 52b:	85 c0                	test   %eax,%eax
+ 52d:	7f dc                	jg     50b <memmove+0x14>
+  return vdst;
+ 52f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 532:	c9                   	leave
+ 533:	c3                   	ret
+
+00000534 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 534:	55                   	push   %ebp
+ 535:	89 e5                	mov    %esp,%ebp
+ 537:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 53a:	83 ec 0c             	sub    $0xc,%esp
+ 53d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 540:	50                   	push   %eax
+ 541:	e8 ff 00 00 00       	call   645 <nanouptime>
+ 546:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 549:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 54c:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 555:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 55a:	f7 e2                	mul    %edx
+ 55c:	89 d0                	mov    %edx,%eax
+ 55e:	c1 e8 06             	shr    $0x6,%eax
+ 561:	01 c8                	add    %ecx,%eax
+}
+ 563:	c9                   	leave
+ 564:	c3                   	ret
+
+00000565 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 565:	b8 01 00 00 00       	mov    $0x1,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <exit>:
+SYSCALL(exit)
+ 56d:	b8 02 00 00 00       	mov    $0x2,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <wait>:
+SYSCALL(wait)
+ 575:	b8 03 00 00 00       	mov    $0x3,%eax
+ 57a:	cd 40                	int    $0x40
+ 57c:	c3                   	ret
+
+0000057d <pipe>:
+SYSCALL(pipe)
+ 57d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 582:	cd 40                	int    $0x40
+ 584:	c3                   	ret
+
+00000585 <read>:
+SYSCALL(read)
+ 585:	b8 05 00 00 00       	mov    $0x5,%eax
+ 58a:	cd 40                	int    $0x40
+ 58c:	c3                   	ret
+
+0000058d <write>:
+SYSCALL(write)
+ 58d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 592:	cd 40                	int    $0x40
+ 594:	c3                   	ret
+
+00000595 <close>:
+SYSCALL(close)
+ 595:	b8 15 00 00 00       	mov    $0x15,%eax
+ 59a:	cd 40                	int    $0x40
+ 59c:	c3                   	ret
+
+0000059d <kill>:
+SYSCALL(kill)
+ 59d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5a2:	cd 40                	int    $0x40
+ 5a4:	c3                   	ret
+
+000005a5 <exec>:
+SYSCALL(exec)
+ 5a5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5aa:	cd 40                	int    $0x40
+ 5ac:	c3                   	ret
+
+000005ad <open>:
+SYSCALL(open)
+ 5ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	c3                   	ret
+
+000005b5 <mknod>:
+SYSCALL(mknod)
+ 5b5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5ba:	cd 40                	int    $0x40
+ 5bc:	c3                   	ret
+
+000005bd <unlink>:
+SYSCALL(unlink)
+ 5bd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <fstat>:
+SYSCALL(fstat)
+ 5c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5ca:	cd 40                	int    $0x40
+ 5cc:	c3                   	ret
+
+000005cd <link>:
+SYSCALL(link)
+ 5cd:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	c3                   	ret
+
+000005d5 <mkdir>:
+SYSCALL(mkdir)
+ 5d5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5da:	cd 40                	int    $0x40
+ 5dc:	c3                   	ret
+
+000005dd <chdir>:
+SYSCALL(chdir)
+ 5dd:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5e2:	cd 40                	int    $0x40
+ 5e4:	c3                   	ret
+
+000005e5 <dup>:
+SYSCALL(dup)
+ 5e5:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5ea:	cd 40                	int    $0x40
+ 5ec:	c3                   	ret
+
+000005ed <getpid>:
+SYSCALL(getpid)
+ 5ed:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <sbrk>:
+SYSCALL(sbrk)
+ 5f5:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5fa:	cd 40                	int    $0x40
+ 5fc:	c3                   	ret
+
+000005fd <sleep>:
+SYSCALL(sleep)
+ 5fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <uptime>:
+SYSCALL(uptime)
+ 605:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 60a:	cd 40                	int    $0x40
+ 60c:	c3                   	ret
+
+0000060d <saveProc>:
+SYSCALL(saveProc)
+ 60d:	b8 16 00 00 00       	mov    $0x16,%eax
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <loadProc>:
+SYSCALL(loadProc)
+ 615:	b8 17 00 00 00       	mov    $0x17,%eax
+ 61a:	cd 40                	int    $0x40
+ 61c:	c3                   	ret
+
+0000061d <setpriority>:
+SYSCALL(setpriority)
+ 61d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 622:	cd 40                	int    $0x40
+ 624:	c3                   	ret
+
+00000625 <setaffinity>:
+SYSCALL(setaffinity)
+ 625:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <getaffinity>:
+SYSCALL(getaffinity)
+ 62d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <nanosleep>:
+SYSCALL(nanosleep)
+ 635:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 63a:	cd 40                	int    $0x40
+ 63c:	c3                   	ret
+
+0000063d <cpustat>:
+SYSCALL(cpustat)
+ 63d:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 642:	cd 40                	int    $0x40
+ 644:	c3                   	ret
+
+00000645 <nanouptime>:
+SYSCALL(nanouptime)
+ 645:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 64a:	cd 40                	int    $0x40
+ 64c:	c3                   	ret
+
+0000064d <settickets>:
+SYSCALL(settickets)
+ 64d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 652:	cd 40                	int    $0x40
+ 654:	c3                   	ret
+
+00000655 <setdeadline>:
+SYSCALL(setdeadline)
+ 655:	b8 20 00 00 00       	mov    $0x20,%eax
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <rtstat>:
+SYSCALL(rtstat)
+ 65d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 662:	cd 40                	int    $0x40
+ 664:	c3                   	ret
+
+00000665 <schedstat>:
+SYSCALL(schedstat)
+ 665:	b8 22 00 00 00       	mov    $0x22,%eax
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <waitpid>:
+SYSCALL(waitpid)
+ 66d:	b8 23 00 00 00       	mov    $0x23,%eax
+ 672:	cd 40                	int    $0x40
+ 674:	c3                   	ret
+
+00000675 <clone>:
+SYSCALL(clone)
+ 675:	b8 24 00 00 00       	mov    $0x24,%eax
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <futexwait>:
+SYSCALL(futexwait)
+ 67d:	b8 25 00 00 00       	mov    $0x25,%eax
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <futexwake>:
+SYSCALL(futexwake)
+ 685:	b8 26 00 00 00       	mov    $0x26,%eax
+ 68a:	cd 40                	int    $0x40
+ 68c:	c3                   	ret
+
+0000068d <lockstat>:
+SYSCALL(lockstat)
+ 68d:	b8 27 00 00 00       	mov    $0x27,%eax
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <dcachestat>:
+SYSCALL(dcachestat)
+ 695:	b8 28 00 00 00       	mov    $0x28,%eax
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 69d:	55                   	push   %ebp
+ 69e:	89 e5                	mov    %esp,%ebp
+ 6a0:	83 ec 18             	sub    $0x18,%esp
+ 6a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a6:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 6a9:	83 ec 04             	sub    $0x4,%esp
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 6b1:	50                   	push   %eax
+ 6b2:	ff 75 08             	push   0x8(%ebp)
+ 6b5:	e8 d3 fe ff ff       	call   58d <write>
+ 6ba:	83 c4 10             	add    $0x10,%esp
+}
+ 6bd:	90                   	nop
+ 6be:	c9                   	leave
+ 6bf:	c3                   	ret
+
+000006c0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 6c6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 6cd:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 6d1:	74 17                	je     6ea <printint+0x2a>
+ 6d3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6d7:	79 11                	jns    6ea <printint+0x2a>
+    neg = 1;
+ 6d9:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 6e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6e3:	f7 d8                	neg    %eax
+ 6e5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6e8:	eb 06                	jmp    6f0 <printint+0x30>
+  } else {
+    x = xx;
+ 6ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 6f0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6fa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6fd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 702:	f7 f1                	div    %ecx
+ 704:	89 d1                	mov    %edx,%ecx
+ 706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 709:	8d 50 01             	lea    0x1(%eax),%edx
+ 70c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 70f:	0f b6 91 cc 0b 00 00 	movzbl 0xbcc(%ecx),%edx
+ 716:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 71a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 71d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 720:	ba 00 00 00 00       	mov    $0x0,%edx
+ 725:	f7 f1                	div    %ecx
+ 727:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 72a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 72e:	75 c7                	jne    6f7 <printint+0x37>
+  if(neg)
+ 730:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 734:	74 2d                	je     763 <printint+0xa3>
+    buf[i++] = '-';
+ 736:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 739:	8d 50 01             	lea    0x1(%eax),%edx
+ 73c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 73f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 744:	eb 1d                	jmp    763 <printint+0xa3>
+    putc(fd, buf[i]);
+ 746:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 749:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 74c:	01 d0                	add    %edx,%eax
+ 74e:	0f b6 00             	movzbl (%eax),%eax
+ 751:	0f be c0             	movsbl %al,%eax
+ 754:	83 ec 08             	sub    $0x8,%esp
+ 757:	50                   	push   %eax
+ 758:	ff 75 08             	push   0x8(%ebp)
+ 75b:	e8 3d ff ff ff       	call   69d <putc>
+ 760:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 763:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 767:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 76b:	79 d9                	jns    746 <printint+0x86>
+}
+ 76d:	90                   	nop
+ 76e:	90                   	nop
+ 76f:	c9                   	leave
+ 770:	c3                   	ret
+
+00000771 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 771:	55                   	push   %ebp
+ 772:	89 e5                	mov    %esp,%ebp
+ 774:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 777:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 77e:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 781:	83 c0 04             	add    $0x4,%eax
+ 784:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 787:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 78e:	e9 59 01 00 00       	jmp    8ec <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 793:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 796:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 799:	01 d0                	add    %edx,%eax
+ 79b:	0f b6 00             	movzbl (%eax),%eax
+ 79e:	0f be c0             	movsbl %al,%eax
+ 7a1:	25 ff 00 00 00       	and    $0xff,%eax
+ 7a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 7a9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 7ad:	75 2c                	jne    7db <printf+0x6a>
+      if(c == '%'){
+ 7af:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 7b3:	75 0c                	jne    7c1 <printf+0x50>
+        state = '%';
+ 7b5:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 7bc:	e9 27 01 00 00       	jmp    8e8 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 7c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7c4:	0f be c0             	movsbl %al,%eax
+ 7c7:	83 ec 08             	sub    $0x8,%esp
+ 7ca:	50                   	push   %eax
+ 7cb:	ff 75 08             	push   0x8(%ebp)
+ 7ce:	e8 ca fe ff ff       	call   69d <putc>
+ 7d3:	83 c4 10             	add    $0x10,%esp
+ 7d6:	e9 0d 01 00 00       	jmp    8e8 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 7db:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 7df:	0f 85 03 01 00 00    	jne    8e8 <printf+0x177>
+      if(c == 'd'){
+ 7e5:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 7e9:	75 1e                	jne    809 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 7eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7ee:	8b 00                	mov    (%eax),%eax
+ 7f0:	6a 01                	push   $0x1
+ 7f2:	6a 0a                	push   $0xa
+ 7f4:	50                   	push   %eax
+ 7f5:	ff 75 08             	push   0x8(%ebp)
+ 7f8:	e8 c3 fe ff ff       	call   6c0 <printint>
+ 7fd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 800:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 804:	e9 d8 00 00 00       	jmp    8e1 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 809:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 80d:	74 06                	je     815 <printf+0xa4>
+ 80f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 813:	75 1e                	jne    833 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 815:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 818:	8b 00                	mov    (%eax),%eax
+ 81a:	6a 00                	push   $0x0
+ 81c:	6a 10                	push   $0x10
+ 81e:	50                   	push   %eax
+ 81f:	ff 75 08             	push   0x8(%ebp)
+ 822:	e8 99 fe ff ff       	call   6c0 <printint>
+ 827:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 82a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 82e:	e9 ae 00 00 00       	jmp    8e1 <printf+0x170>
+      } else if(c == 's'){
+ 833:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 837:	75 43                	jne    87c <printf+0x10b>
+        s = (char*)*ap;
+ 839:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 83c:	8b 00                	mov    (%eax),%eax
+ 83e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 841:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 845:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 849:	75 25                	jne    870 <printf+0xff>
+          s = "(null)";
+ 84b:	c7 45 f4 bc 09 00 00 	movl   $0x9bc,-0xc(%ebp)
+        while(*s != 0){
+ 852:	eb 1c                	jmp    870 <printf+0xff>
+          putc(fd, *s);
+ 854:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 857:	0f b6 00             	movzbl (%eax),%eax
+ 85a:	0f be c0             	movsbl %al,%eax
+ 85d:	83 ec 08             	sub    $0x8,%esp
+ 860:	50                   	push   %eax
+ 861:	ff 75 08             	push   0x8(%ebp)
+ 864:	e8 34 fe ff ff       	call   69d <putc>
+ 869:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 86c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 870:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 873:	0f b6 00             	movzbl (%eax),%eax
+ 876:	84 c0                	test   %al,%al
+ 878:	75 da                	jne    854 <printf+0xe3>
+ 87a:	eb 65                	jmp    8e1 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 87c:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 880:	75 1d                	jne    89f <printf+0x12e>
+        putc(fd, *ap);
+ 882:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 885:	8b 00                	mov    (%eax),%eax
+ 887:	0f be c0             	movsbl %al,%eax
+ 88a:	83 ec 08             	sub    $0x8,%esp
+ 88d:	50                   	push   %eax
+ 88e:	ff 75 08             	push   0x8(%ebp)
+ 891:	e8 07 fe ff ff       	call   69d <putc>
+ 896:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 899:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 89d:	eb 42                	jmp    8e1 <printf+0x170>
+      } else if(c == '%'){
+ 89f:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8a3:	75 17                	jne    8bc <printf+0x14b>
+        putc(fd, c);
+ 8a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a8:	0f be c0             	movsbl %al,%eax
+ 8ab:	83 ec 08             	sub    $0x8,%esp
+ 8ae:	50                   	push   %eax
+ 8af:	ff 75 08             	push   0x8(%ebp)
+ 8b2:	e8 e6 fd ff ff       	call   69d <putc>
+ 8b7:	83 c4 10             	add    $0x10,%esp
+ 8ba:	eb 25                	jmp    8e1 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 8bc:	83 ec 08             	sub    $0x8,%esp
+ 8bf:	6a 25                	push   $0x25
+ 8c1:	ff 75 08             	push   0x8(%ebp)
+ 8c4:	e8 d4 fd ff ff       	call   69d <putc>
+ 8c9:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 8cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8cf:	0f be c0             	movsbl %al,%eax
+ 8d2:	83 ec 08             	sub    $0x8,%esp
+ 8d5:	50                   	push   %eax
+ 8d6:	ff 75 08             	push   0x8(%ebp)
+ 8d9:	e8 bf fd ff ff       	call   69d <putc>
+ 8de:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 8e1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8e8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 8ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8ef:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8f2:	01 d0                	add    %edx,%eax
+ 8f4:	0f b6 00             	movzbl (%eax),%eax
+ 8f7:	84 c0                	test   %al,%al
+ 8f9:	0f 85 94 fe ff ff    	jne    793 <printf+0x22>
+    }
+  }
+}
+ 8ff:	90                   	nop
+ 900:	90                   	nop
+ 901:	c9                   	leave
+ 902:	c3                   	ret
@@ -0,0 +1,82 @@
+// Stress a kernel spinlock from every CPU at once: one process
+// per CPU, pinned there, calls uptime(), which takes tickslock,
+// as fast as it can.  Reports how many acquisitions each CPU got
+// and how evenly they were shared.  lockstress [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+#define MAXCPU 8
+
+struct result {
+  int cpu;
+  uint calls;
+};
+
+int
+main(int argc, char *argv[])
+{
+  struct cpustat st;
+  struct result r;
+  uint count[MAXCPU], calls, total, min, max, end;
+  int fd[2], n, c, duration;
+
+  duration = 200;
+  if(argc > 1 && (duration = atoi(argv[1])) <= 0){
+    printf(2, "usage: lockstress [ticks]\n");
+    exit();
+  }
+  for(n = 0; n < MAXCPU && cpustat(n, &st) == 0; n++)
+    ;
+  if(pipe(fd) < 0){
+    printf(2, "lockstress: pipe failed\n");
+    exit();
+  }
+
+  end = uptime() + 10 + duration;
+  for(c = 0; c < n; c++){
+    if(fork() == 0){
+      close(fd[0]);
+      setaffinity(getpid(), 1 << c);
+      // Start together once every CPU has its process.
+      while(uptime() < end - duration)
+        ;
+      for(calls = 0; uptime() < end; calls++)
+        ;
+      // One write, so that results cannot interleave.
+      r.cpu = c;
+      r.calls = calls;
+      write(fd[1], &r, sizeof(r));
+      exit();
+    }
+  }
+  close(fd[1]);
+
+  for(c = 0; c < n; c++)
+    count[c] = 0;
+  while(read(fd[0], &r, sizeof(r)) == sizeof(r))
+    if(r.cpu >= 0 && r.cpu < n)
+      count[r.cpu] = r.calls;
+  while(wait() >= 0)
+    ;
+
+  total = 0;
+  min = max = count[0];
+  for(c = 0; c < n; c++){
+    printf(1, "cpu%d: %d acquisitions\n", c, count[c]);
+    total += count[c];
+    if(count[c] < min)
+      min = count[c];
+    if(count[c] > max)
+      max = count[c];
+  }
+  printf(1, "%d cpus, %d acquisitions in %d ticks, %d per tick\n",
+         n, total, duration, total / duration);
+  if(max > 0)
+    printf(1, "fairness: least-served cpu got %d%% of the most-served\n",
+           min * 100 / max);
+  exit();
+}
@@ -0,0 +1,1292 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 c7 03 00 00       	call   3d9 <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 95 03 00 00       	call   3d9 <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 7d 03 00 00       	call   3d9 <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 24 0c 00 00       	push   $0xc24
+  6b:	e8 e6 04 00 00       	call   556 <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 5b 03 00 00       	call   3d9 <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 44 03 00 00       	call   3d9 <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 24 0c 00 00       	add    $0xc24,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 57 03 00 00       	call   400 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 24 0c 00 00       	mov    $0xc24,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 3d 05 00 00       	call   60c <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 62 09 00 00       	push   $0x962
+  e6:	6a 02                	push   $0x2
+  e8:	e8 e3 06 00 00       	call   7d0 <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 1d 05 00 00       	call   624 <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 76 09 00 00       	push   $0x976
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 b0 06 00 00       	call   7d0 <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 c6 04 00 00       	call   5f4 <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  switch(st.type){
+ 136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 8a 09 00 00       	push   $0x98a
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 4d 06 00 00       	call   7d0 <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+    break;
+ 186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+  
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 43 02 00 00       	call   3d9 <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 97 09 00 00       	push   $0x997
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 1e 06 00 00       	call   7d0 <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+ 1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+    }
+    strcpy(buf, path);
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1c6:	50                   	push   %eax
+ 1c7:	e8 9e 01 00 00       	call   36a <strcpy>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	e8 fb 01 00 00       	call   3d9 <strlen>
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+ 1e7:	01 d0                	add    %edx,%eax
+ 1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *p++ = '/';
+ 1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+      if(de.inum == 0)
+ 1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+ 204:	66 85 c0             	test   %ax,%ax
+ 207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 0e                	push   $0xe
+ 212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 218:	83 c0 02             	add    $0x2,%eax
+ 21b:	50                   	push   %eax
+ 21c:	ff 75 e0             	push   -0x20(%ebp)
+ 21f:	e8 32 03 00 00       	call   556 <memmove>
+ 224:	83 c4 10             	add    $0x10,%esp
+      p[DIRSIZ] = 0;
+ 227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22a:	83 c0 0e             	add    $0xe,%eax
+ 22d:	c6 00 00             	movb   $0x0,(%eax)
+      if(stat(buf, &st) < 0){
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	e8 76 02 00 00       	call   4bc <stat>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	79 1b                	jns    268 <ls+0x1b2>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	68 76 09 00 00       	push   $0x976
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 6d 05 00 00       	call   7d0 <printf>
+ 263:	83 c4 10             	add    $0x10,%esp
+        continue;
+ 266:	eb 41                	jmp    2a9 <ls+0x1f3>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 27b:	0f bf d8             	movswl %ax,%ebx
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <fmtname>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	50                   	push   %eax
+ 297:	68 8a 09 00 00       	push   $0x98a
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 2d 05 00 00       	call   7d0 <printf>
+ 2a3:	83 c4 20             	add    $0x20,%esp
+ 2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+        continue;
+ 2a8:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	6a 10                	push   $0x10
+ 2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 2b4:	50                   	push   %eax
+ 2b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b8:	e8 27 03 00 00       	call   5e4 <read>
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	83 f8 10             	cmp    $0x10,%eax
+ 2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+    }
+    break;
+ 2c9:	90                   	nop
+  }
+  close(fd);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 e4             	push   -0x1c(%ebp)
+ 2d0:	e8 1f 03 00 00       	call   5f4 <close>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+}
+ 2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5f                   	pop    %edi
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2e7:	ff 71 fc             	push   -0x4(%ecx)
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	53                   	push   %ebx
+ 2ee:	51                   	push   %ecx
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+ 2f2:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+ 2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2f7:	7f 15                	jg     30e <main+0x2e>
+    ls(".");
+ 2f9:	83 ec 0c             	sub    $0xc,%esp
+ 2fc:	68 aa 09 00 00       	push   $0x9aa
+ 301:	e8 b0 fd ff ff       	call   b6 <ls>
+ 306:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 309:	e8 be 02 00 00       	call   5cc <exit>
+  }
+  for(i=1; i<argc; i++)
+ 30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 315:	eb 21                	jmp    338 <main+0x58>
+    ls(argv[i]);
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 321:	8b 43 04             	mov    0x4(%ebx),%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	8b 00                	mov    (%eax),%eax
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	50                   	push   %eax
+ 32c:	e8 85 fd ff ff       	call   b6 <ls>
+ 331:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+ 334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	3b 03                	cmp    (%ebx),%eax
+ 33d:	7c d8                	jl     317 <main+0x37>
+  exit();
+ 33f:	e8 88 02 00 00       	call   5cc <exit>
+
+00000344 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	57                   	push   %edi
+ 348:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 cb                	mov    %ecx,%ebx
+ 354:	89 df                	mov    %ebx,%edi
+ 356:	89 d1                	mov    %edx,%ecx
+ 358:	fc                   	cld
+ 359:	f3 aa                	rep stos %al,%es:(%edi)
+ 35b:	89 ca                	mov    %ecx,%edx
+ 35d:	89 fb                	mov    %edi,%ebx
+ 35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 362:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 365:	90                   	nop
+ 366:	5b                   	pop    %ebx
+ 367:	5f                   	pop    %edi
+ 368:	5d                   	pop    %ebp
+ 369:	c3                   	ret
+
+0000036a <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 36a:	55                   	push   %ebp
+ 36b:	89 e5                	mov    %esp,%ebp
+ 36d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 370:	8b 45 08             	mov    0x8(%ebp),%eax
+ 373:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 376:	90                   	nop
+ 377:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 37a:	8d 42 01             	lea    0x1(%edx),%eax
+ 37d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	8d 48 01             	lea    0x1(%eax),%ecx
+ 386:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 389:	0f b6 12             	movzbl (%edx),%edx
+ 38c:	88 10                	mov    %dl,(%eax)
+ 38e:	0f b6 00             	movzbl (%eax),%eax
+ 391:	84 c0                	test   %al,%al
+ 393:	75 e2                	jne    377 <strcpy+0xd>
+    ;
+  return os;
+ 395:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+
+0000039a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 39d:	eb 08                	jmp    3a7 <strcmp+0xd>
+    p++, q++;
+ 39f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3a3:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	84 c0                	test   %al,%al
+ 3af:	74 10                	je     3c1 <strcmp+0x27>
+ 3b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b4:	0f b6 10             	movzbl (%eax),%edx
+ 3b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ba:	0f b6 00             	movzbl (%eax),%eax
+ 3bd:	38 c2                	cmp    %al,%dl
+ 3bf:	74 de                	je     39f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	0f b6 00             	movzbl (%eax),%eax
+ 3c7:	0f b6 d0             	movzbl %al,%edx
+ 3ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3cd:	0f b6 00             	movzbl (%eax),%eax
+ 3d0:	0f b6 c0             	movzbl %al,%eax
+ 3d3:	29 c2                	sub    %eax,%edx
+ 3d5:	89 d0                	mov    %edx,%eax
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+
+000003d9 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3d9:	55                   	push   %ebp
+ 3da:	89 e5                	mov    %esp,%ebp
+ 3dc:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3e6:	eb 04                	jmp    3ec <strlen+0x13>
+ 3e8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ec:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f2:	01 d0                	add    %edx,%eax
+ 3f4:	0f b6 00             	movzbl (%eax),%eax
+ 3f7:	84 c0                	test   %al,%al
+ 3f9:	75 ed                	jne    3e8 <strlen+0xf>
+    ;
+  return n;
+ 3fb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3fe:	c9                   	leave
+ 3ff:	c3                   	ret
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 403:	8b 45 10             	mov    0x10(%ebp),%eax
+ 406:	50                   	push   %eax
+ 407:	ff 75 0c             	push   0xc(%ebp)
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 32 ff ff ff       	call   344 <stosb>
+ 412:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 415:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+
+0000041a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 41a:	55                   	push   %ebp
+ 41b:	89 e5                	mov    %esp,%ebp
+ 41d:	83 ec 04             	sub    $0x4,%esp
+ 420:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 423:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 426:	eb 14                	jmp    43c <strchr+0x22>
+    if(*s == c)
+ 428:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42b:	0f b6 00             	movzbl (%eax),%eax
+ 42e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 431:	75 05                	jne    438 <strchr+0x1e>
+      return (char*)s;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	eb 13                	jmp    44b <strchr+0x31>
+  for(; *s; s++)
+ 438:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 43c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43f:	0f b6 00             	movzbl (%eax),%eax
+ 442:	84 c0                	test   %al,%al
+ 444:	75 e2                	jne    428 <strchr+0xe>
+  return 0;
+ 446:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 453:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 45a:	eb 42                	jmp    49e <gets+0x51>
+    cc = read(0, &c, 1);
+ 45c:	83 ec 04             	sub    $0x4,%esp
+ 45f:	6a 01                	push   $0x1
+ 461:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 464:	50                   	push   %eax
+ 465:	6a 00                	push   $0x0
+ 467:	e8 78 01 00 00       	call   5e4 <read>
+ 46c:	83 c4 10             	add    $0x10,%esp
+ 46f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 472:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 476:	7e 33                	jle    4ab <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47b:	8d 50 01             	lea    0x1(%eax),%edx
+ 47e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 481:	89 c2                	mov    %eax,%edx
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	01 c2                	add    %eax,%edx
+ 488:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 48c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 48e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 492:	3c 0a                	cmp    $0xa,%al
+ 494:	74 16                	je     4ac <gets+0x5f>
+ 496:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 49a:	3c 0d                	cmp    $0xd,%al
+ 49c:	74 0e                	je     4ac <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 49e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a1:	83 c0 01             	add    $0x1,%eax
+ 4a4:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4a7:	7f b3                	jg     45c <gets+0xf>
+ 4a9:	eb 01                	jmp    4ac <gets+0x5f>
+      break;
+ 4ab:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4ac:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b2:	01 d0                	add    %edx,%eax
+ 4b4:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4b7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+
+000004bc <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4bc:	55                   	push   %ebp
+ 4bd:	89 e5                	mov    %esp,%ebp
+ 4bf:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c2:	83 ec 08             	sub    $0x8,%esp
+ 4c5:	6a 00                	push   $0x0
+ 4c7:	ff 75 08             	push   0x8(%ebp)
+ 4ca:	e8 3d 01 00 00       	call   60c <open>
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4d5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4d9:	79 07                	jns    4e2 <stat+0x26>
+    return -1;
+ 4db:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4e0:	eb 25                	jmp    507 <stat+0x4b>
+  r = fstat(fd, st);
+ 4e2:	83 ec 08             	sub    $0x8,%esp
+ 4e5:	ff 75 0c             	push   0xc(%ebp)
+ 4e8:	ff 75 f4             	push   -0xc(%ebp)
+ 4eb:	e8 34 01 00 00       	call   624 <fstat>
+ 4f0:	83 c4 10             	add    $0x10,%esp
+ 4f3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4f6:	83 ec 0c             	sub    $0xc,%esp
+ 4f9:	ff 75 f4             	push   -0xc(%ebp)
+ 4fc:	e8 f3 00 00 00       	call   5f4 <close>
+ 501:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 504:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 507:	c9                   	leave
+ 508:	c3                   	ret
+
+00000509 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 509:	55                   	push   %ebp
+ 50a:	89 e5                	mov    %esp,%ebp
+ 50c:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 50f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 516:	eb 25                	jmp    53d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 518:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 51b:	89 d0                	mov    %edx,%eax
+ 51d:	c1 e0 02             	shl    $0x2,%eax
+ 520:	01 d0                	add    %edx,%eax
+ 522:	01 c0                	add    %eax,%eax
+ 524:	89 c1                	mov    %eax,%ecx
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	8d 50 01             	lea    0x1(%eax),%edx
+ 52c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 52f:	0f b6 00             	movzbl (%eax),%eax
+ 532:	0f be c0             	movsbl %al,%eax
+ 535:	01 c8                	add    %ecx,%eax
+ 537:	83 e8 30             	sub    $0x30,%eax
+ 53a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 53d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 540:	0f b6 00             	movzbl (%eax),%eax
+ 543:	3c 2f                	cmp    $0x2f,%al
+ 545:	7e 0a                	jle    551 <atoi+0x48>
+ 547:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54a:	0f b6 00             	movzbl (%eax),%eax
+ 54d:	3c 39                	cmp    $0x39,%al
+ 54f:	7e c7                	jle    518 <atoi+0xf>
+  return n;
+ 551:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 554:	c9                   	leave
+ 555:	c3                   	ret
+
+00000556 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 556:	55                   	push   %ebp
+ 557:	89 e5                	mov    %esp,%ebp
+ 559:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 55c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 55f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 562:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 565:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 568:	eb 17                	jmp    581 <memmove+0x2b>
+    *dst++ = *src++;
+ 56a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 56d:	8d 42 01             	lea    0x1(%edx),%eax
+ 570:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 573:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 576:	8d 48 01             	lea    0x1(%eax),%ecx
+ 579:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 57c:	0f b6 12             	movzbl (%edx),%edx
+ 57f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 581:	8b 45 10             	mov    0x10(%ebp),%eax
+ 584:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 587:	89 55 10             	mov    %edx,0x10(%ebp)
+ 58a:	85 c0                	test   %eax,%eax
+ 58c:	7f dc                	jg     56a <memmove+0x14>
+  return vdst;
+ 58e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 591:	c9                   	leave
+ 592:	c3                   	ret
+
+00000593 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 593:	55                   	push   %ebp
+ 594:	89 e5                	mov    %esp,%ebp
+ 596:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 599:	83 ec 0c             	sub    $0xc,%esp
+ 59c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 59f:	50                   	push   %eax
+ 5a0:	e8 ff 00 00 00       	call   6a4 <nanouptime>
+ 5a5:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 5a8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5ab:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 5b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b4:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 5b9:	f7 e2                	mul    %edx
+ 5bb:	89 d0                	mov    %edx,%eax
+ 5bd:	c1 e8 06             	shr    $0x6,%eax
+ 5c0:	01 c8                	add    %ecx,%eax
+}
+ 5c2:	c9                   	leave
+ 5c3:	c3                   	ret
+
+000005c4 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5c4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <exit>:
+SYSCALL(exit)
+ 5cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <wait>:
+SYSCALL(wait)
+ 5d4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <pipe>:
+SYSCALL(pipe)
+ 5dc:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <read>:
+SYSCALL(read)
+ 5e4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <write>:
+SYSCALL(write)
+ 5ec:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <close>:
+SYSCALL(close)
+ 5f4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <kill>:
+SYSCALL(kill)
+ 5fc:	b8 06 00 00 00       	mov    $0x6,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <exec>:
+SYSCALL(exec)
+ 604:	b8 07 00 00 00       	mov    $0x7,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <open>:
+SYSCALL(open)
+ 60c:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <mknod>:
+SYSCALL(mknod)
+ 614:	b8 11 00 00 00       	mov    $0x11,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <unlink>:
+SYSCALL(unlink)
+ 61c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <fstat>:
+SYSCALL(fstat)
+ 624:	b8 08 00 00 00       	mov    $0x8,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <link>:
+SYSCALL(link)
+ 62c:	b8 13 00 00 00       	mov    $0x13,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <mkdir>:
+SYSCALL(mkdir)
+ 634:	b8 14 00 00 00       	mov    $0x14,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <chdir>:
+SYSCALL(chdir)
+ 63c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <dup>:
+SYSCALL(dup)
+ 644:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <getpid>:
+SYSCALL(getpid)
+ 64c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <sbrk>:
+SYSCALL(sbrk)
+ 654:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <sleep>:
+SYSCALL(sleep)
+ 65c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <uptime>:
+SYSCALL(uptime)
+ 664:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <saveProc>:
+SYSCALL(saveProc)
+ 66c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <loadProc>:
+SYSCALL(loadProc)
+ 674:	b8 17 00 00 00       	mov    $0x17,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <setpriority>:
+SYSCALL(setpriority)
+ 67c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <setaffinity>:
+SYSCALL(setaffinity)
+ 684:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <getaffinity>:
+SYSCALL(getaffinity)
+ 68c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <nanosleep>:
+SYSCALL(nanosleep)
+ 694:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <cpustat>:
+SYSCALL(cpustat)
+ 69c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <nanouptime>:
+SYSCALL(nanouptime)
+ 6a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <settickets>:
+SYSCALL(settickets)
+ 6ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <setdeadline>:
+SYSCALL(setdeadline)
+ 6b4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <rtstat>:
+SYSCALL(rtstat)
+ 6bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <schedstat>:
+SYSCALL(schedstat)
+ 6c4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <waitpid>:
+SYSCALL(waitpid)
+ 6cc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <clone>:
+SYSCALL(clone)
+ 6d4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <futexwait>:
+SYSCALL(futexwait)
+ 6dc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <futexwake>:
+SYSCALL(futexwake)
+ 6e4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <lockstat>:
+SYSCALL(lockstat)
+ 6ec:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <dcachestat>:
+SYSCALL(dcachestat)
+ 6f4:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6fc:	55                   	push   %ebp
+ 6fd:	89 e5                	mov    %esp,%ebp
+ 6ff:	83 ec 18             	sub    $0x18,%esp
+ 702:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 705:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 708:	83 ec 04             	sub    $0x4,%esp
+ 70b:	6a 01                	push   $0x1
+ 70d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 710:	50                   	push   %eax
+ 711:	ff 75 08             	push   0x8(%ebp)
+ 714:	e8 d3 fe ff ff       	call   5ec <write>
+ 719:	83 c4 10             	add    $0x10,%esp
+}
+ 71c:	90                   	nop
+ 71d:	c9                   	leave
+ 71e:	c3                   	ret
+
+0000071f <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 71f:	55                   	push   %ebp
+ 720:	89 e5                	mov    %esp,%ebp
+ 722:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 725:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 72c:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 730:	74 17                	je     749 <printint+0x2a>
+ 732:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 736:	79 11                	jns    749 <printint+0x2a>
+    neg = 1;
+ 738:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 73f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 742:	f7 d8                	neg    %eax
+ 744:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 747:	eb 06                	jmp    74f <printint+0x30>
+  } else {
+    x = xx;
+ 749:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 74c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 74f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 756:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 759:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 75c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 761:	f7 f1                	div    %ecx
+ 763:	89 d1                	mov    %edx,%ecx
+ 765:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 768:	8d 50 01             	lea    0x1(%eax),%edx
+ 76b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 76e:	0f b6 91 10 0c 00 00 	movzbl 0xc10(%ecx),%edx
+ 775:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 779:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 77c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 77f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 784:	f7 f1                	div    %ecx
+ 786:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 789:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 78d:	75 c7                	jne    756 <printint+0x37>
+  if(neg)
+ 78f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 793:	74 2d                	je     7c2 <printint+0xa3>
+    buf[i++] = '-';
+ 795:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 798:	8d 50 01             	lea    0x1(%eax),%edx
+ 79b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 79e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7a3:	eb 1d                	jmp    7c2 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7a5:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ab:	01 d0                	add    %edx,%eax
+ 7ad:	0f b6 00             	movzbl (%eax),%eax
+ 7b0:	0f be c0             	movsbl %al,%eax
+ 7b3:	83 ec 08             	sub    $0x8,%esp
+ 7b6:	50                   	push   %eax
+ 7b7:	ff 75 08             	push   0x8(%ebp)
+ 7ba:	e8 3d ff ff ff       	call   6fc <putc>
+ 7bf:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7c2:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7ca:	79 d9                	jns    7a5 <printint+0x86>
+}
+ 7cc:	90                   	nop
+ 7cd:	90                   	nop
+ 7ce:	c9                   	leave
+ 7cf:	c3                   	ret
+
+000007d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7dd:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7e0:	83 c0 04             	add    $0x4,%eax
+ 7e3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7e6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7ed:	e9 59 01 00 00       	jmp    94b <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 7f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7f8:	01 d0                	add    %edx,%eax
+ 7fa:	0f b6 00             	movzbl (%eax),%eax
+ 7fd:	0f be c0             	movsbl %al,%eax
+ 800:	25 ff 00 00 00       	and    $0xff,%eax
+ 805:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 808:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 80c:	75 2c                	jne    83a <printf+0x6a>
+      if(c == '%'){
+ 80e:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 812:	75 0c                	jne    820 <printf+0x50>
+        state = '%';
+ 814:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 81b:	e9 27 01 00 00       	jmp    947 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 820:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 823:	0f be c0             	movsbl %al,%eax
+ 826:	83 ec 08             	sub    $0x8,%esp
+ 829:	50                   	push   %eax
+ 82a:	ff 75 08             	push   0x8(%ebp)
+ 82d:	e8 ca fe ff ff       	call   6fc <putc>
+ 832:	83 c4 10             	add    $0x10,%esp
+ 835:	e9 0d 01 00 00       	jmp    947 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 83a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 83e:	0f 85 03 01 00 00    	jne    947 <printf+0x177>
+      if(c == 'd'){
+ 844:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 848:	75 1e                	jne    868 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 84a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 84d:	8b 00                	mov    (%eax),%eax
+ 84f:	6a 01                	push   $0x1
+ 851:	6a 0a                	push   $0xa
+ 853:	50                   	push   %eax
+ 854:	ff 75 08             	push   0x8(%ebp)
+ 857:	e8 c3 fe ff ff       	call   71f <printint>
+ 85c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 85f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 863:	e9 d8 00 00 00       	jmp    940 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 868:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 86c:	74 06                	je     874 <printf+0xa4>
+ 86e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 872:	75 1e                	jne    892 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 874:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 877:	8b 00                	mov    (%eax),%eax
+ 879:	6a 00                	push   $0x0
+ 87b:	6a 10                	push   $0x10
+ 87d:	50                   	push   %eax
+ 87e:	ff 75 08             	push   0x8(%ebp)
+ 881:	e8 99 fe ff ff       	call   71f <printint>
+ 886:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 889:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 88d:	e9 ae 00 00 00       	jmp    940 <printf+0x170>
+      } else if(c == 's'){
+ 892:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 896:	75 43                	jne    8db <printf+0x10b>
+        s = (char*)*ap;
+ 898:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89b:	8b 00                	mov    (%eax),%eax
+ 89d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8a0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8a4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8a8:	75 25                	jne    8cf <printf+0xff>
+          s = "(null)";
+ 8aa:	c7 45 f4 ac 09 00 00 	movl   $0x9ac,-0xc(%ebp)
+        while(*s != 0){
+ 8b1:	eb 1c                	jmp    8cf <printf+0xff>
+          putc(fd, *s);
+ 8b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b6:	0f b6 00             	movzbl (%eax),%eax
+ 8b9:	0f be c0             	movsbl %al,%eax
+ 8bc:	83 ec 08             	sub    $0x8,%esp
+ 8bf:	50                   	push   %eax
+ 8c0:	ff 75 08             	push   0x8(%ebp)
+ 8c3:	e8 34 fe ff ff       	call   6fc <putc>
+ 8c8:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8cb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d2:	0f b6 00             	movzbl (%eax),%eax
+ 8d5:	84 c0                	test   %al,%al
+ 8d7:	75 da                	jne    8b3 <printf+0xe3>
+ 8d9:	eb 65                	jmp    940 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 8db:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8df:	75 1d                	jne    8fe <printf+0x12e>
+        putc(fd, *ap);
+ 8e1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e4:	8b 00                	mov    (%eax),%eax
+ 8e6:	0f be c0             	movsbl %al,%eax
+ 8e9:	83 ec 08             	sub    $0x8,%esp
+ 8ec:	50                   	push   %eax
+ 8ed:	ff 75 08             	push   0x8(%ebp)
+ 8f0:	e8 07 fe ff ff       	call   6fc <putc>
+ 8f5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8f8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8fc:	eb 42                	jmp    940 <printf+0x170>
+      } else if(c == '%'){
+ 8fe:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 902:	75 17                	jne    91b <printf+0x14b>
+        putc(fd, c);
+ 904:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 907:	0f be c0             	movsbl %al,%eax
+ 90a:	83 ec 08             	sub    $0x8,%esp
+ 90d:	50                   	push   %eax
+ 90e:	ff 75 08             	push   0x8(%ebp)
+ 911:	e8 e6 fd ff ff       	call   6fc <putc>
+ 916:	83 c4 10             	add    $0x10,%esp
+ 919:	eb 25                	jmp    940 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 91b:	83 ec 08             	sub    $0x8,%esp
+ 91e:	6a 25                	push   $0x25
+ 920:	ff 75 08             	push   0x8(%ebp)
+ 923:	e8 d4 fd ff ff       	call   6fc <putc>
+ 928:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 92b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 92e:	0f be c0             	movsbl %al,%eax
+ 931:	83 ec 08             	sub    $0x8,%esp
+ 934:	50                   	push   %eax
+ 935:	ff 75 08             	push   0x8(%ebp)
+ 938:	e8 bf fd ff ff       	call   6fc <putc>
+ 93d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 940:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 947:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 94b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 94e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 951:	01 d0                	add    %edx,%eax
+ 953:	0f b6 00             	movzbl (%eax),%eax
+ 956:	84 c0                	test   %al,%al
+ 958:	0f 85 94 fe ff ff    	jne    7f2 <printf+0x22>
+    }
+  }
+}
+ 95e:	90                   	nop
+ 95f:	90                   	nop
+ 960:	c9                   	leave
+ 961:	c3                   	ret
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -18,9 +19,11 @@ int
 main(void)
 {
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  kminit();        // kernel object allocator
   kvmalloc();      // kernel page table
   mpinit();        // collect info about this machine
   lapicinit();
+  clockinit();     // calibrate the TSC
   seginit();       // set up segments
   cprintf("\ncpu%d: starting xv6\n\n", cpu->id);
   picinit();       // interrupt controller
@@ -31,6 +34,7 @@ main(void)
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  futexinit();     // user-space synchronization
   ideinit();       // disk
   if(!ismp)
     timerinit();   // uniprocessor timer
@@ -48,6 +52,7 @@ mpenter(void)
   switchkvm(); 
   seginit();
   lapicinit();
+  clocksyncap();
   mpmain();
 }
 
@@ -91,6 +96,7 @@ startothers(void)
     *(int**)(code-12) = (void *) v2p(entrypgdir);
 
     lapicstartap(c->id, v2p(code));
+    clocksyncbsp();
 
     // wait for cpu to finish mpmain()
     while(c->started == 0)
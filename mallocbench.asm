@@ -0,0 +1,1924 @@
+
+_mallocbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <krfree>:
+static Header base;
+static Header *freep;
+
+static void
+krfree(void *ap)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	83 e8 08             	sub    $0x8,%eax
+   c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+   f:	a1 88 12 00 00       	mov    0x1288,%eax
+  14:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  17:	eb 24                	jmp    3d <krfree+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+  19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  1c:	8b 00                	mov    (%eax),%eax
+  1e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+  21:	72 12                	jb     35 <krfree+0x35>
+  23:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  26:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+  29:	72 24                	jb     4f <krfree+0x4f>
+  2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  2e:	8b 00                	mov    (%eax),%eax
+  30:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+  33:	72 1a                	jb     4f <krfree+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+  35:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  38:	8b 00                	mov    (%eax),%eax
+  3a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  3d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  40:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+  43:	73 d4                	jae    19 <krfree+0x19>
+  45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+  4d:	73 ca                	jae    19 <krfree+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+  4f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  52:	8b 40 04             	mov    0x4(%eax),%eax
+  55:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  5c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  5f:	01 c2                	add    %eax,%edx
+  61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  64:	8b 00                	mov    (%eax),%eax
+  66:	39 c2                	cmp    %eax,%edx
+  68:	75 24                	jne    8e <krfree+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+  6a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  6d:	8b 50 04             	mov    0x4(%eax),%edx
+  70:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  73:	8b 00                	mov    (%eax),%eax
+  75:	8b 40 04             	mov    0x4(%eax),%eax
+  78:	01 c2                	add    %eax,%edx
+  7a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  7d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+  80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  83:	8b 00                	mov    (%eax),%eax
+  85:	8b 10                	mov    (%eax),%edx
+  87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  8a:	89 10                	mov    %edx,(%eax)
+  8c:	eb 0a                	jmp    98 <krfree+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+  8e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  91:	8b 10                	mov    (%eax),%edx
+  93:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  96:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+  98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  9b:	8b 40 04             	mov    0x4(%eax),%eax
+  9e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+  a5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  a8:	01 d0                	add    %edx,%eax
+  aa:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+  ad:	75 20                	jne    cf <krfree+0xcf>
+    p->s.size += bp->s.size;
+  af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  b2:	8b 50 04             	mov    0x4(%eax),%edx
+  b5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  b8:	8b 40 04             	mov    0x4(%eax),%eax
+  bb:	01 c2                	add    %eax,%edx
+  bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  c0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+  c3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  c6:	8b 10                	mov    (%eax),%edx
+  c8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  cb:	89 10                	mov    %edx,(%eax)
+  cd:	eb 08                	jmp    d7 <krfree+0xd7>
+  } else
+    p->s.ptr = bp;
+  cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  d2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+  d5:	89 10                	mov    %edx,(%eax)
+  freep = p;
+  d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  da:	a3 88 12 00 00       	mov    %eax,0x1288
+}
+  df:	90                   	nop
+  e0:	c9                   	leave
+  e1:	c3                   	ret
+
+000000e2 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+  e2:	55                   	push   %ebp
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+  e8:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+  ef:	77 07                	ja     f8 <morecore+0x16>
+    nu = 4096;
+  f1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+  f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  fb:	c1 e0 03             	shl    $0x3,%eax
+  fe:	83 ec 0c             	sub    $0xc,%esp
+ 101:	50                   	push   %eax
+ 102:	e8 b2 06 00 00       	call   7b9 <sbrk>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ 10d:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ 111:	75 07                	jne    11a <morecore+0x38>
+    return 0;
+ 113:	b8 00 00 00 00       	mov    $0x0,%eax
+ 118:	eb 26                	jmp    140 <morecore+0x5e>
+  hp = (Header*)p;
+ 11a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 11d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ 120:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 123:	8b 55 08             	mov    0x8(%ebp),%edx
+ 126:	89 50 04             	mov    %edx,0x4(%eax)
+  krfree((void*)(hp + 1));
+ 129:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 12c:	83 c0 08             	add    $0x8,%eax
+ 12f:	83 ec 0c             	sub    $0xc,%esp
+ 132:	50                   	push   %eax
+ 133:	e8 c8 fe ff ff       	call   0 <krfree>
+ 138:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ 13b:	a1 88 12 00 00       	mov    0x1288,%eax
+}
+ 140:	c9                   	leave
+ 141:	c3                   	ret
+
+00000142 <krmalloc>:
+
+static void*
+krmalloc(uint nbytes)
+{
+ 142:	55                   	push   %ebp
+ 143:	89 e5                	mov    %esp,%ebp
+ 145:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 148:	8b 45 08             	mov    0x8(%ebp),%eax
+ 14b:	83 c0 07             	add    $0x7,%eax
+ 14e:	c1 e8 03             	shr    $0x3,%eax
+ 151:	83 c0 01             	add    $0x1,%eax
+ 154:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ 157:	a1 88 12 00 00       	mov    0x1288,%eax
+ 15c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 15f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 163:	75 23                	jne    188 <krmalloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ 165:	c7 45 f0 80 12 00 00 	movl   $0x1280,-0x10(%ebp)
+ 16c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 16f:	a3 88 12 00 00       	mov    %eax,0x1288
+ 174:	a1 88 12 00 00       	mov    0x1288,%eax
+ 179:	a3 80 12 00 00       	mov    %eax,0x1280
+    base.s.size = 0;
+ 17e:	c7 05 84 12 00 00 00 	movl   $0x0,0x1284
+ 185:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 188:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 18b:	8b 00                	mov    (%eax),%eax
+ 18d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 190:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 193:	8b 40 04             	mov    0x4(%eax),%eax
+ 196:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ 199:	72 4d                	jb     1e8 <krmalloc+0xa6>
+      if(p->s.size == nunits)
+ 19b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 19e:	8b 40 04             	mov    0x4(%eax),%eax
+ 1a1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 1a4:	75 0c                	jne    1b2 <krmalloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ 1a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a9:	8b 10                	mov    (%eax),%edx
+ 1ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1ae:	89 10                	mov    %edx,(%eax)
+ 1b0:	eb 26                	jmp    1d8 <krmalloc+0x96>
+      else {
+        p->s.size -= nunits;
+ 1b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b5:	8b 40 04             	mov    0x4(%eax),%eax
+ 1b8:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 1bb:	89 c2                	mov    %eax,%edx
+ 1bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ 1c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c6:	8b 40 04             	mov    0x4(%eax),%eax
+ 1c9:	c1 e0 03             	shl    $0x3,%eax
+ 1cc:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ 1cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1d2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ 1d5:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ 1d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1db:	a3 88 12 00 00       	mov    %eax,0x1288
+      return (void*)(p + 1);
+ 1e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e3:	83 c0 08             	add    $0x8,%eax
+ 1e6:	eb 3b                	jmp    223 <krmalloc+0xe1>
+    }
+    if(p == freep)
+ 1e8:	a1 88 12 00 00       	mov    0x1288,%eax
+ 1ed:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 1f0:	75 1e                	jne    210 <krmalloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ 1f2:	83 ec 0c             	sub    $0xc,%esp
+ 1f5:	ff 75 ec             	push   -0x14(%ebp)
+ 1f8:	e8 e5 fe ff ff       	call   e2 <morecore>
+ 1fd:	83 c4 10             	add    $0x10,%esp
+ 200:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 203:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 207:	75 07                	jne    210 <krmalloc+0xce>
+        return 0;
+ 209:	b8 00 00 00 00       	mov    $0x0,%eax
+ 20e:	eb 13                	jmp    223 <krmalloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 210:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 213:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 219:	8b 00                	mov    (%eax),%eax
+ 21b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ 21e:	e9 6d ff ff ff       	jmp    190 <krmalloc+0x4e>
+  }
+}
+ 223:	c9                   	leave
+ 224:	c3                   	ret
+
+00000225 <rand>:
+static char *slot[NSLOT];
+static uint seed;
+
+static uint
+rand(void)
+{
+ 225:	55                   	push   %ebp
+ 226:	89 e5                	mov    %esp,%ebp
+  seed = seed * 1103515245 + 12345;
+ 228:	a1 a0 1a 00 00       	mov    0x1aa0,%eax
+ 22d:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+ 233:	05 39 30 00 00       	add    $0x3039,%eax
+ 238:	a3 a0 1a 00 00       	mov    %eax,0x1aa0
+  return seed >> 8;
+ 23d:	a1 a0 1a 00 00       	mov    0x1aa0,%eax
+ 242:	c1 e8 08             	shr    $0x8,%eax
+}
+ 245:	5d                   	pop    %ebp
+ 246:	c3                   	ret
+
+00000247 <batch>:
+
+// Allocate and free batches of equal small blocks.
+static int
+batch(struct allocator *a)
+{
+ 247:	55                   	push   %ebp
+ 248:	89 e5                	mov    %esp,%ebp
+ 24a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  char *p[NBATCH];
+  int i, r;
+  uint t0;
+
+  t0 = uptimeus();
+ 250:	e8 a3 04 00 00       	call   6f8 <uptimeus>
+ 255:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(r = 0; r < NROUND; r++){
+ 258:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 25f:	eb 72                	jmp    2d3 <batch+0x8c>
+    for(i = 0; i < NBATCH; i++)
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 33                	jmp    29d <batch+0x56>
+      if((p[i] = a->alloc(32)) == 0)
+ 26a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26d:	8b 40 04             	mov    0x4(%eax),%eax
+ 270:	83 ec 0c             	sub    $0xc,%esp
+ 273:	6a 20                	push   $0x20
+ 275:	ff d0                	call   *%eax
+ 277:	83 c4 10             	add    $0x10,%esp
+ 27a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 27d:	89 84 95 ec fe ff ff 	mov    %eax,-0x114(%ebp,%edx,4)
+ 284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 287:	8b 84 85 ec fe ff ff 	mov    -0x114(%ebp,%eax,4),%eax
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	75 07                	jne    299 <batch+0x52>
+        return -1;
+ 292:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 297:	eb 4b                	jmp    2e4 <batch+0x9d>
+    for(i = 0; i < NBATCH; i++)
+ 299:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 29d:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ 2a1:	7e c7                	jle    26a <batch+0x23>
+    for(i = 0; i < NBATCH; i++)
+ 2a3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2aa:	eb 1d                	jmp    2c9 <batch+0x82>
+      a->free(p[i]);
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	8b 40 08             	mov    0x8(%eax),%eax
+ 2b2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2b5:	8b 94 95 ec fe ff ff 	mov    -0x114(%ebp,%edx,4),%edx
+ 2bc:	83 ec 0c             	sub    $0xc,%esp
+ 2bf:	52                   	push   %edx
+ 2c0:	ff d0                	call   *%eax
+ 2c2:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < NBATCH; i++)
+ 2c5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 2c9:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ 2cd:	7e dd                	jle    2ac <batch+0x65>
+  for(r = 0; r < NROUND; r++){
+ 2cf:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 2d3:	81 7d f0 cf 07 00 00 	cmpl   $0x7cf,-0x10(%ebp)
+ 2da:	7e 85                	jle    261 <batch+0x1a>
+  }
+  return uptimeus() - t0;
+ 2dc:	e8 17 04 00 00       	call   6f8 <uptimeus>
+ 2e1:	2b 45 ec             	sub    -0x14(%ebp),%eax
+}
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+
+000002e6 <mixed>:
+
+// Random sizes with random lifetimes, which fragments
+// a first-fit free list.
+static int
+mixed(struct allocator *a)
+{
+ 2e6:	55                   	push   %ebp
+ 2e7:	89 e5                	mov    %esp,%ebp
+ 2e9:	83 ec 18             	sub    $0x18,%esp
+  int i, n;
+  uint t0;
+  uint sz;
+
+  seed = 1;
+ 2ec:	c7 05 a0 1a 00 00 01 	movl   $0x1,0x1aa0
+ 2f3:	00 00 00 
+  t0 = uptimeus();
+ 2f6:	e8 fd 03 00 00       	call   6f8 <uptimeus>
+ 2fb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(n = 0; n < NMIXED; n++){
+ 2fe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 305:	e9 b2 00 00 00       	jmp    3bc <mixed+0xd6>
+    i = rand() % NSLOT;
+ 30a:	e8 16 ff ff ff       	call   225 <rand>
+ 30f:	25 ff 01 00 00       	and    $0x1ff,%eax
+ 314:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(slot[i]){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8b 04 85 a0 12 00 00 	mov    0x12a0(,%eax,4),%eax
+ 321:	85 c0                	test   %eax,%eax
+ 323:	74 29                	je     34e <mixed+0x68>
+      a->free(slot[i]);
+ 325:	8b 45 08             	mov    0x8(%ebp),%eax
+ 328:	8b 40 08             	mov    0x8(%eax),%eax
+ 32b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 32e:	8b 14 95 a0 12 00 00 	mov    0x12a0(,%edx,4),%edx
+ 335:	83 ec 0c             	sub    $0xc,%esp
+ 338:	52                   	push   %edx
+ 339:	ff d0                	call   *%eax
+ 33b:	83 c4 10             	add    $0x10,%esp
+      slot[i] = 0;
+ 33e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 341:	c7 04 85 a0 12 00 00 	movl   $0x0,0x12a0(,%eax,4)
+ 348:	00 00 00 00 
+      continue;
+ 34c:	eb 6a                	jmp    3b8 <mixed+0xd2>
+    }
+    sz = rand() % 16 == 0 ? 4096 + rand() % 8192 : 1 + rand() % 512;
+ 34e:	e8 d2 fe ff ff       	call   225 <rand>
+ 353:	83 e0 0f             	and    $0xf,%eax
+ 356:	85 c0                	test   %eax,%eax
+ 358:	75 11                	jne    36b <mixed+0x85>
+ 35a:	e8 c6 fe ff ff       	call   225 <rand>
+ 35f:	25 ff 1f 00 00       	and    $0x1fff,%eax
+ 364:	05 00 10 00 00       	add    $0x1000,%eax
+ 369:	eb 0d                	jmp    378 <mixed+0x92>
+ 36b:	e8 b5 fe ff ff       	call   225 <rand>
+ 370:	25 ff 01 00 00       	and    $0x1ff,%eax
+ 375:	83 c0 01             	add    $0x1,%eax
+ 378:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if((slot[i] = a->alloc(sz)) == 0)
+ 37b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37e:	8b 40 04             	mov    0x4(%eax),%eax
+ 381:	83 ec 0c             	sub    $0xc,%esp
+ 384:	ff 75 e8             	push   -0x18(%ebp)
+ 387:	ff d0                	call   *%eax
+ 389:	83 c4 10             	add    $0x10,%esp
+ 38c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 38f:	89 04 95 a0 12 00 00 	mov    %eax,0x12a0(,%edx,4)
+ 396:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 399:	8b 04 85 a0 12 00 00 	mov    0x12a0(,%eax,4),%eax
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	75 07                	jne    3ab <mixed+0xc5>
+      return -1;
+ 3a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3a9:	eb 71                	jmp    41c <mixed+0x136>
+    slot[i][0] = 1;
+ 3ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ae:	8b 04 85 a0 12 00 00 	mov    0x12a0(,%eax,4),%eax
+ 3b5:	c6 00 01             	movb   $0x1,(%eax)
+  for(n = 0; n < NMIXED; n++){
+ 3b8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 3bc:	81 7d f0 3f 0d 03 00 	cmpl   $0x30d3f,-0x10(%ebp)
+ 3c3:	0f 8e 41 ff ff ff    	jle    30a <mixed+0x24>
+  }
+  for(i = 0; i < NSLOT; i++){
+ 3c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3d0:	eb 39                	jmp    40b <mixed+0x125>
+    if(slot[i])
+ 3d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3d5:	8b 04 85 a0 12 00 00 	mov    0x12a0(,%eax,4),%eax
+ 3dc:	85 c0                	test   %eax,%eax
+ 3de:	74 19                	je     3f9 <mixed+0x113>
+      a->free(slot[i]);
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	8b 40 08             	mov    0x8(%eax),%eax
+ 3e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3e9:	8b 14 95 a0 12 00 00 	mov    0x12a0(,%edx,4),%edx
+ 3f0:	83 ec 0c             	sub    $0xc,%esp
+ 3f3:	52                   	push   %edx
+ 3f4:	ff d0                	call   *%eax
+ 3f6:	83 c4 10             	add    $0x10,%esp
+    slot[i] = 0;
+ 3f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3fc:	c7 04 85 a0 12 00 00 	movl   $0x0,0x12a0(,%eax,4)
+ 403:	00 00 00 00 
+  for(i = 0; i < NSLOT; i++){
+ 407:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 40b:	81 7d f4 ff 01 00 00 	cmpl   $0x1ff,-0xc(%ebp)
+ 412:	7e be                	jle    3d2 <mixed+0xec>
+  }
+  return uptimeus() - t0;
+ 414:	e8 df 02 00 00       	call   6f8 <uptimeus>
+ 419:	2b 45 ec             	sub    -0x14(%ebp),%eax
+}
+ 41c:	c9                   	leave
+ 41d:	c3                   	ret
+
+0000041e <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 41e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 422:	83 e4 f0             	and    $0xfffffff0,%esp
+ 425:	ff 71 fc             	push   -0x4(%ecx)
+ 428:	55                   	push   %ebp
+ 429:	89 e5                	mov    %esp,%ebp
+ 42b:	51                   	push   %ecx
+ 42c:	83 ec 14             	sub    $0x14,%esp
+  struct allocator *a;
+  int tb, tm;
+
+  printf(1, "mallocbench: %d x %d small blocks, %d mixed ops\n",
+ 42f:	83 ec 0c             	sub    $0xc,%esp
+ 432:	68 40 0d 03 00       	push   $0x30d40
+ 437:	6a 40                	push   $0x40
+ 439:	68 d0 07 00 00       	push   $0x7d0
+ 43e:	68 78 0e 00 00       	push   $0xe78
+ 443:	6a 01                	push   $0x1
+ 445:	e8 eb 04 00 00       	call   935 <printf>
+ 44a:	83 c4 20             	add    $0x20,%esp
+         NROUND, NBATCH, NMIXED);
+  for(a = allocators; a < allocators + sizeof(allocators)/sizeof(allocators[0]); a++){
+ 44d:	c7 45 f4 34 12 00 00 	movl   $0x1234,-0xc(%ebp)
+ 454:	eb 44                	jmp    49a <main+0x7c>
+    tb = batch(a);
+ 456:	83 ec 0c             	sub    $0xc,%esp
+ 459:	ff 75 f4             	push   -0xc(%ebp)
+ 45c:	e8 e6 fd ff ff       	call   247 <batch>
+ 461:	83 c4 10             	add    $0x10,%esp
+ 464:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    tm = mixed(a);
+ 467:	83 ec 0c             	sub    $0xc,%esp
+ 46a:	ff 75 f4             	push   -0xc(%ebp)
+ 46d:	e8 74 fe ff ff       	call   2e6 <mixed>
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    printf(1, "%s: batch %d us, mixed %d us\n", a->name, tb, tm);
+ 478:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47b:	8b 00                	mov    (%eax),%eax
+ 47d:	83 ec 0c             	sub    $0xc,%esp
+ 480:	ff 75 ec             	push   -0x14(%ebp)
+ 483:	ff 75 f0             	push   -0x10(%ebp)
+ 486:	50                   	push   %eax
+ 487:	68 a9 0e 00 00       	push   $0xea9
+ 48c:	6a 01                	push   $0x1
+ 48e:	e8 a2 04 00 00       	call   935 <printf>
+ 493:	83 c4 20             	add    $0x20,%esp
+  for(a = allocators; a < allocators + sizeof(allocators)/sizeof(allocators[0]); a++){
+ 496:	83 45 f4 0c          	addl   $0xc,-0xc(%ebp)
+ 49a:	b8 4c 12 00 00       	mov    $0x124c,%eax
+ 49f:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ 4a2:	72 b2                	jb     456 <main+0x38>
+  }
+  exit();
+ 4a4:	e8 88 02 00 00       	call   731 <exit>
+
+000004a9 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 4a9:	55                   	push   %ebp
+ 4aa:	89 e5                	mov    %esp,%ebp
+ 4ac:	57                   	push   %edi
+ 4ad:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 4ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 4b1:	8b 55 10             	mov    0x10(%ebp),%edx
+ 4b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b7:	89 cb                	mov    %ecx,%ebx
+ 4b9:	89 df                	mov    %ebx,%edi
+ 4bb:	89 d1                	mov    %edx,%ecx
+ 4bd:	fc                   	cld
+ 4be:	f3 aa                	rep stos %al,%es:(%edi)
+ 4c0:	89 ca                	mov    %ecx,%edx
+ 4c2:	89 fb                	mov    %edi,%ebx
+ 4c4:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 4c7:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 4ca:	90                   	nop
+ 4cb:	5b                   	pop    %ebx
+ 4cc:	5f                   	pop    %edi
+ 4cd:	5d                   	pop    %ebp
+ 4ce:	c3                   	ret
+
+000004cf <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 4cf:	55                   	push   %ebp
+ 4d0:	89 e5                	mov    %esp,%ebp
+ 4d2:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 4d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 4db:	90                   	nop
+ 4dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 4df:	8d 42 01             	lea    0x1(%edx),%eax
+ 4e2:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 4e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4eb:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 4ee:	0f b6 12             	movzbl (%edx),%edx
+ 4f1:	88 10                	mov    %dl,(%eax)
+ 4f3:	0f b6 00             	movzbl (%eax),%eax
+ 4f6:	84 c0                	test   %al,%al
+ 4f8:	75 e2                	jne    4dc <strcpy+0xd>
+    ;
+  return os;
+ 4fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4fd:	c9                   	leave
+ 4fe:	c3                   	ret
+
+000004ff <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4ff:	55                   	push   %ebp
+ 500:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 502:	eb 08                	jmp    50c <strcmp+0xd>
+    p++, q++;
+ 504:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 508:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 50c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50f:	0f b6 00             	movzbl (%eax),%eax
+ 512:	84 c0                	test   %al,%al
+ 514:	74 10                	je     526 <strcmp+0x27>
+ 516:	8b 45 08             	mov    0x8(%ebp),%eax
+ 519:	0f b6 10             	movzbl (%eax),%edx
+ 51c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 51f:	0f b6 00             	movzbl (%eax),%eax
+ 522:	38 c2                	cmp    %al,%dl
+ 524:	74 de                	je     504 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 526:	8b 45 08             	mov    0x8(%ebp),%eax
+ 529:	0f b6 00             	movzbl (%eax),%eax
+ 52c:	0f b6 d0             	movzbl %al,%edx
+ 52f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 532:	0f b6 00             	movzbl (%eax),%eax
+ 535:	0f b6 c0             	movzbl %al,%eax
+ 538:	29 c2                	sub    %eax,%edx
+ 53a:	89 d0                	mov    %edx,%eax
+}
+ 53c:	5d                   	pop    %ebp
+ 53d:	c3                   	ret
+
+0000053e <strlen>:
+
+uint
+strlen(char *s)
+{
+ 53e:	55                   	push   %ebp
+ 53f:	89 e5                	mov    %esp,%ebp
+ 541:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 544:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 54b:	eb 04                	jmp    551 <strlen+0x13>
+ 54d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 551:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 554:	8b 45 08             	mov    0x8(%ebp),%eax
+ 557:	01 d0                	add    %edx,%eax
+ 559:	0f b6 00             	movzbl (%eax),%eax
+ 55c:	84 c0                	test   %al,%al
+ 55e:	75 ed                	jne    54d <strlen+0xf>
+    ;
+  return n;
+ 560:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 563:	c9                   	leave
+ 564:	c3                   	ret
+
+00000565 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 565:	55                   	push   %ebp
+ 566:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 568:	8b 45 10             	mov    0x10(%ebp),%eax
+ 56b:	50                   	push   %eax
+ 56c:	ff 75 0c             	push   0xc(%ebp)
+ 56f:	ff 75 08             	push   0x8(%ebp)
+ 572:	e8 32 ff ff ff       	call   4a9 <stosb>
+ 577:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 57a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 57d:	c9                   	leave
+ 57e:	c3                   	ret
+
+0000057f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 57f:	55                   	push   %ebp
+ 580:	89 e5                	mov    %esp,%ebp
+ 582:	83 ec 04             	sub    $0x4,%esp
+ 585:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 588:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 58b:	eb 14                	jmp    5a1 <strchr+0x22>
+    if(*s == c)
+ 58d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 590:	0f b6 00             	movzbl (%eax),%eax
+ 593:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 596:	75 05                	jne    59d <strchr+0x1e>
+      return (char*)s;
+ 598:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59b:	eb 13                	jmp    5b0 <strchr+0x31>
+  for(; *s; s++)
+ 59d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 5a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a4:	0f b6 00             	movzbl (%eax),%eax
+ 5a7:	84 c0                	test   %al,%al
+ 5a9:	75 e2                	jne    58d <strchr+0xe>
+  return 0;
+ 5ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5b0:	c9                   	leave
+ 5b1:	c3                   	ret
+
+000005b2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5b2:	55                   	push   %ebp
+ 5b3:	89 e5                	mov    %esp,%ebp
+ 5b5:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 5b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 5bf:	eb 42                	jmp    603 <gets+0x51>
+    cc = read(0, &c, 1);
+ 5c1:	83 ec 04             	sub    $0x4,%esp
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 5c9:	50                   	push   %eax
+ 5ca:	6a 00                	push   $0x0
+ 5cc:	e8 78 01 00 00       	call   749 <read>
+ 5d1:	83 c4 10             	add    $0x10,%esp
+ 5d4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 5d7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5db:	7e 33                	jle    610 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 5dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e0:	8d 50 01             	lea    0x1(%eax),%edx
+ 5e3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5e6:	89 c2                	mov    %eax,%edx
+ 5e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5eb:	01 c2                	add    %eax,%edx
+ 5ed:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5f1:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 5f3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5f7:	3c 0a                	cmp    $0xa,%al
+ 5f9:	74 16                	je     611 <gets+0x5f>
+ 5fb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 5ff:	3c 0d                	cmp    $0xd,%al
+ 601:	74 0e                	je     611 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 603:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 606:	83 c0 01             	add    $0x1,%eax
+ 609:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 60c:	7f b3                	jg     5c1 <gets+0xf>
+ 60e:	eb 01                	jmp    611 <gets+0x5f>
+      break;
+ 610:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 611:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	01 d0                	add    %edx,%eax
+ 619:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 61c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+
+00000621 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 621:	55                   	push   %ebp
+ 622:	89 e5                	mov    %esp,%ebp
+ 624:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 627:	83 ec 08             	sub    $0x8,%esp
+ 62a:	6a 00                	push   $0x0
+ 62c:	ff 75 08             	push   0x8(%ebp)
+ 62f:	e8 3d 01 00 00       	call   771 <open>
+ 634:	83 c4 10             	add    $0x10,%esp
+ 637:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 63a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 63e:	79 07                	jns    647 <stat+0x26>
+    return -1;
+ 640:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 645:	eb 25                	jmp    66c <stat+0x4b>
+  r = fstat(fd, st);
+ 647:	83 ec 08             	sub    $0x8,%esp
+ 64a:	ff 75 0c             	push   0xc(%ebp)
+ 64d:	ff 75 f4             	push   -0xc(%ebp)
+ 650:	e8 34 01 00 00       	call   789 <fstat>
+ 655:	83 c4 10             	add    $0x10,%esp
+ 658:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 65b:	83 ec 0c             	sub    $0xc,%esp
+ 65e:	ff 75 f4             	push   -0xc(%ebp)
+ 661:	e8 f3 00 00 00       	call   759 <close>
+ 666:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 669:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 66c:	c9                   	leave
+ 66d:	c3                   	ret
+
+0000066e <atoi>:
+
+int
+atoi(const char *s)
+{
+ 66e:	55                   	push   %ebp
+ 66f:	89 e5                	mov    %esp,%ebp
+ 671:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 674:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 67b:	eb 25                	jmp    6a2 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 67d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 680:	89 d0                	mov    %edx,%eax
+ 682:	c1 e0 02             	shl    $0x2,%eax
+ 685:	01 d0                	add    %edx,%eax
+ 687:	01 c0                	add    %eax,%eax
+ 689:	89 c1                	mov    %eax,%ecx
+ 68b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68e:	8d 50 01             	lea    0x1(%eax),%edx
+ 691:	89 55 08             	mov    %edx,0x8(%ebp)
+ 694:	0f b6 00             	movzbl (%eax),%eax
+ 697:	0f be c0             	movsbl %al,%eax
+ 69a:	01 c8                	add    %ecx,%eax
+ 69c:	83 e8 30             	sub    $0x30,%eax
+ 69f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 6a2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a5:	0f b6 00             	movzbl (%eax),%eax
+ 6a8:	3c 2f                	cmp    $0x2f,%al
+ 6aa:	7e 0a                	jle    6b6 <atoi+0x48>
+ 6ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6af:	0f b6 00             	movzbl (%eax),%eax
+ 6b2:	3c 39                	cmp    $0x39,%al
+ 6b4:	7e c7                	jle    67d <atoi+0xf>
+  return n;
+ 6b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 6b9:	c9                   	leave
+ 6ba:	c3                   	ret
+
+000006bb <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 6bb:	55                   	push   %ebp
+ 6bc:	89 e5                	mov    %esp,%ebp
+ 6be:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 6c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 6c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6ca:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 6cd:	eb 17                	jmp    6e6 <memmove+0x2b>
+    *dst++ = *src++;
+ 6cf:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 6d2:	8d 42 01             	lea    0x1(%edx),%eax
+ 6d5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 6d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6db:	8d 48 01             	lea    0x1(%eax),%ecx
+ 6de:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 6e1:	0f b6 12             	movzbl (%edx),%edx
+ 6e4:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 6e6:	8b 45 10             	mov    0x10(%ebp),%eax
+ 6e9:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 6ec:	89 55 10             	mov    %edx,0x10(%ebp)
+ 6ef:	85 c0                	test   %eax,%eax
+ 6f1:	7f dc                	jg     6cf <memmove+0x14>
+  return vdst;
+ 6f3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 6f6:	c9                   	leave
+ 6f7:	c3                   	ret
+
+000006f8 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 6f8:	55                   	push   %ebp
+ 6f9:	89 e5                	mov    %esp,%ebp
+ 6fb:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 6fe:	83 ec 0c             	sub    $0xc,%esp
+ 701:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 704:	50                   	push   %eax
+ 705:	e8 ff 00 00 00       	call   809 <nanouptime>
+ 70a:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 70d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 710:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 719:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 71e:	f7 e2                	mul    %edx
+ 720:	89 d0                	mov    %edx,%eax
+ 722:	c1 e8 06             	shr    $0x6,%eax
+ 725:	01 c8                	add    %ecx,%eax
+}
+ 727:	c9                   	leave
+ 728:	c3                   	ret
+
+00000729 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 729:	b8 01 00 00 00       	mov    $0x1,%eax
+ 72e:	cd 40                	int    $0x40
+ 730:	c3                   	ret
+
+00000731 <exit>:
+SYSCALL(exit)
+ 731:	b8 02 00 00 00       	mov    $0x2,%eax
+ 736:	cd 40                	int    $0x40
+ 738:	c3                   	ret
+
+00000739 <wait>:
+SYSCALL(wait)
+ 739:	b8 03 00 00 00       	mov    $0x3,%eax
+ 73e:	cd 40                	int    $0x40
+ 740:	c3                   	ret
+
+00000741 <pipe>:
+SYSCALL(pipe)
+ 741:	b8 04 00 00 00       	mov    $0x4,%eax
+ 746:	cd 40                	int    $0x40
+ 748:	c3                   	ret
+
+00000749 <read>:
+SYSCALL(read)
+ 749:	b8 05 00 00 00       	mov    $0x5,%eax
+ 74e:	cd 40                	int    $0x40
+ 750:	c3                   	ret
+
+00000751 <write>:
+SYSCALL(write)
+ 751:	b8 10 00 00 00       	mov    $0x10,%eax
+ 756:	cd 40                	int    $0x40
+ 758:	c3                   	ret
+
+00000759 <close>:
+SYSCALL(close)
+ 759:	b8 15 00 00 00       	mov    $0x15,%eax
+ 75e:	cd 40                	int    $0x40
+ 760:	c3                   	ret
+
+00000761 <kill>:
+SYSCALL(kill)
+ 761:	b8 06 00 00 00       	mov    $0x6,%eax
+ 766:	cd 40                	int    $0x40
+ 768:	c3                   	ret
+
+00000769 <exec>:
+SYSCALL(exec)
+ 769:	b8 07 00 00 00       	mov    $0x7,%eax
+ 76e:	cd 40                	int    $0x40
+ 770:	c3                   	ret
+
+00000771 <open>:
+SYSCALL(open)
+ 771:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 776:	cd 40                	int    $0x40
+ 778:	c3                   	ret
+
+00000779 <mknod>:
+SYSCALL(mknod)
+ 779:	b8 11 00 00 00       	mov    $0x11,%eax
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <unlink>:
+SYSCALL(unlink)
+ 781:	b8 12 00 00 00       	mov    $0x12,%eax
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+
+00000789 <fstat>:
+SYSCALL(fstat)
+ 789:	b8 08 00 00 00       	mov    $0x8,%eax
+ 78e:	cd 40                	int    $0x40
+ 790:	c3                   	ret
+
+00000791 <link>:
+SYSCALL(link)
+ 791:	b8 13 00 00 00       	mov    $0x13,%eax
+ 796:	cd 40                	int    $0x40
+ 798:	c3                   	ret
+
+00000799 <mkdir>:
+SYSCALL(mkdir)
+ 799:	b8 14 00 00 00       	mov    $0x14,%eax
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <chdir>:
+SYSCALL(chdir)
+ 7a1:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <dup>:
+SYSCALL(dup)
+ 7a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <getpid>:
+SYSCALL(getpid)
+ 7b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <sbrk>:
+SYSCALL(sbrk)
+ 7b9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7be:	cd 40                	int    $0x40
+ 7c0:	c3                   	ret
+
+000007c1 <sleep>:
+SYSCALL(sleep)
+ 7c1:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
+
+000007c9 <uptime>:
+SYSCALL(uptime)
+ 7c9:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7ce:	cd 40                	int    $0x40
+ 7d0:	c3                   	ret
+
+000007d1 <saveProc>:
+SYSCALL(saveProc)
+ 7d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7d6:	cd 40                	int    $0x40
+ 7d8:	c3                   	ret
+
+000007d9 <loadProc>:
+SYSCALL(loadProc)
+ 7d9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7de:	cd 40                	int    $0x40
+ 7e0:	c3                   	ret
+
+000007e1 <setpriority>:
+SYSCALL(setpriority)
+ 7e1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <setaffinity>:
+SYSCALL(setaffinity)
+ 7e9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <getaffinity>:
+SYSCALL(getaffinity)
+ 7f1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+000007f9 <nanosleep>:
+SYSCALL(nanosleep)
+ 7f9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+00000801 <cpustat>:
+SYSCALL(cpustat)
+ 801:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <nanouptime>:
+SYSCALL(nanouptime)
+ 809:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <settickets>:
+SYSCALL(settickets)
+ 811:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <setdeadline>:
+SYSCALL(setdeadline)
+ 819:	b8 20 00 00 00       	mov    $0x20,%eax
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <rtstat>:
+SYSCALL(rtstat)
+ 821:	b8 21 00 00 00       	mov    $0x21,%eax
+ 826:	cd 40                	int    $0x40
+ 828:	c3                   	ret
+
+00000829 <schedstat>:
+SYSCALL(schedstat)
+ 829:	b8 22 00 00 00       	mov    $0x22,%eax
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <waitpid>:
+SYSCALL(waitpid)
+ 831:	b8 23 00 00 00       	mov    $0x23,%eax
+ 836:	cd 40                	int    $0x40
+ 838:	c3                   	ret
+
+00000839 <clone>:
+SYSCALL(clone)
+ 839:	b8 24 00 00 00       	mov    $0x24,%eax
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+00000841 <futexwait>:
+SYSCALL(futexwait)
+ 841:	b8 25 00 00 00       	mov    $0x25,%eax
+ 846:	cd 40                	int    $0x40
+ 848:	c3                   	ret
+
+00000849 <futexwake>:
+SYSCALL(futexwake)
+ 849:	b8 26 00 00 00       	mov    $0x26,%eax
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <lockstat>:
+SYSCALL(lockstat)
+ 851:	b8 27 00 00 00       	mov    $0x27,%eax
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <dcachestat>:
+SYSCALL(dcachestat)
+ 859:	b8 28 00 00 00       	mov    $0x28,%eax
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+00000861 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 861:	55                   	push   %ebp
+ 862:	89 e5                	mov    %esp,%ebp
+ 864:	83 ec 18             	sub    $0x18,%esp
+ 867:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 86a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 86d:	83 ec 04             	sub    $0x4,%esp
+ 870:	6a 01                	push   $0x1
+ 872:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 875:	50                   	push   %eax
+ 876:	ff 75 08             	push   0x8(%ebp)
+ 879:	e8 d3 fe ff ff       	call   751 <write>
+ 87e:	83 c4 10             	add    $0x10,%esp
+}
+ 881:	90                   	nop
+ 882:	c9                   	leave
+ 883:	c3                   	ret
+
+00000884 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 884:	55                   	push   %ebp
+ 885:	89 e5                	mov    %esp,%ebp
+ 887:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 88a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 891:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 895:	74 17                	je     8ae <printint+0x2a>
+ 897:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 89b:	79 11                	jns    8ae <printint+0x2a>
+    neg = 1;
+ 89d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8a7:	f7 d8                	neg    %eax
+ 8a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8ac:	eb 06                	jmp    8b4 <printint+0x30>
+  } else {
+    x = xx;
+ 8ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8b1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8b4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8be:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8c1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8c6:	f7 f1                	div    %ecx
+ 8c8:	89 d1                	mov    %edx,%ecx
+ 8ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cd:	8d 50 01             	lea    0x1(%eax),%edx
+ 8d0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8d3:	0f b6 91 4c 12 00 00 	movzbl 0x124c(%ecx),%edx
+ 8da:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8de:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8e4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8e9:	f7 f1                	div    %ecx
+ 8eb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8f2:	75 c7                	jne    8bb <printint+0x37>
+  if(neg)
+ 8f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8f8:	74 2d                	je     927 <printint+0xa3>
+    buf[i++] = '-';
+ 8fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8fd:	8d 50 01             	lea    0x1(%eax),%edx
+ 900:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 903:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 908:	eb 1d                	jmp    927 <printint+0xa3>
+    putc(fd, buf[i]);
+ 90a:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 90d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 910:	01 d0                	add    %edx,%eax
+ 912:	0f b6 00             	movzbl (%eax),%eax
+ 915:	0f be c0             	movsbl %al,%eax
+ 918:	83 ec 08             	sub    $0x8,%esp
+ 91b:	50                   	push   %eax
+ 91c:	ff 75 08             	push   0x8(%ebp)
+ 91f:	e8 3d ff ff ff       	call   861 <putc>
+ 924:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 927:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 92b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92f:	79 d9                	jns    90a <printint+0x86>
+}
+ 931:	90                   	nop
+ 932:	90                   	nop
+ 933:	c9                   	leave
+ 934:	c3                   	ret
+
+00000935 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 935:	55                   	push   %ebp
+ 936:	89 e5                	mov    %esp,%ebp
+ 938:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 93b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 942:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 94b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 952:	e9 59 01 00 00       	jmp    ab0 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 957:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95d:	01 d0                	add    %edx,%eax
+ 95f:	0f b6 00             	movzbl (%eax),%eax
+ 962:	0f be c0             	movsbl %al,%eax
+ 965:	25 ff 00 00 00       	and    $0xff,%eax
+ 96a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 96d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 971:	75 2c                	jne    99f <printf+0x6a>
+      if(c == '%'){
+ 973:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 977:	75 0c                	jne    985 <printf+0x50>
+        state = '%';
+ 979:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 980:	e9 27 01 00 00       	jmp    aac <printf+0x177>
+      } else {
+        putc(fd, c);
+ 985:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 988:	0f be c0             	movsbl %al,%eax
+ 98b:	83 ec 08             	sub    $0x8,%esp
+ 98e:	50                   	push   %eax
+ 98f:	ff 75 08             	push   0x8(%ebp)
+ 992:	e8 ca fe ff ff       	call   861 <putc>
+ 997:	83 c4 10             	add    $0x10,%esp
+ 99a:	e9 0d 01 00 00       	jmp    aac <printf+0x177>
+      }
+    } else if(state == '%'){
+ 99f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9a3:	0f 85 03 01 00 00    	jne    aac <printf+0x177>
+      if(c == 'd'){
+ 9a9:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9ad:	75 1e                	jne    9cd <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9af:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b2:	8b 00                	mov    (%eax),%eax
+ 9b4:	6a 01                	push   $0x1
+ 9b6:	6a 0a                	push   $0xa
+ 9b8:	50                   	push   %eax
+ 9b9:	ff 75 08             	push   0x8(%ebp)
+ 9bc:	e8 c3 fe ff ff       	call   884 <printint>
+ 9c1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9c4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c8:	e9 d8 00 00 00       	jmp    aa5 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 9cd:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9d1:	74 06                	je     9d9 <printf+0xa4>
+ 9d3:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9d7:	75 1e                	jne    9f7 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 9d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9dc:	8b 00                	mov    (%eax),%eax
+ 9de:	6a 00                	push   $0x0
+ 9e0:	6a 10                	push   $0x10
+ 9e2:	50                   	push   %eax
+ 9e3:	ff 75 08             	push   0x8(%ebp)
+ 9e6:	e8 99 fe ff ff       	call   884 <printint>
+ 9eb:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9ee:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9f2:	e9 ae 00 00 00       	jmp    aa5 <printf+0x170>
+      } else if(c == 's'){
+ 9f7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9fb:	75 43                	jne    a40 <printf+0x10b>
+        s = (char*)*ap;
+ 9fd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a00:	8b 00                	mov    (%eax),%eax
+ a02:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a05:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a09:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0d:	75 25                	jne    a34 <printf+0xff>
+          s = "(null)";
+ a0f:	c7 45 f4 c7 0e 00 00 	movl   $0xec7,-0xc(%ebp)
+        while(*s != 0){
+ a16:	eb 1c                	jmp    a34 <printf+0xff>
+          putc(fd, *s);
+ a18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1b:	0f b6 00             	movzbl (%eax),%eax
+ a1e:	0f be c0             	movsbl %al,%eax
+ a21:	83 ec 08             	sub    $0x8,%esp
+ a24:	50                   	push   %eax
+ a25:	ff 75 08             	push   0x8(%ebp)
+ a28:	e8 34 fe ff ff       	call   861 <putc>
+ a2d:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a30:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a37:	0f b6 00             	movzbl (%eax),%eax
+ a3a:	84 c0                	test   %al,%al
+ a3c:	75 da                	jne    a18 <printf+0xe3>
+ a3e:	eb 65                	jmp    aa5 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a40:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a44:	75 1d                	jne    a63 <printf+0x12e>
+        putc(fd, *ap);
+ a46:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a49:	8b 00                	mov    (%eax),%eax
+ a4b:	0f be c0             	movsbl %al,%eax
+ a4e:	83 ec 08             	sub    $0x8,%esp
+ a51:	50                   	push   %eax
+ a52:	ff 75 08             	push   0x8(%ebp)
+ a55:	e8 07 fe ff ff       	call   861 <putc>
+ a5a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a5d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a61:	eb 42                	jmp    aa5 <printf+0x170>
+      } else if(c == '%'){
+ a63:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a67:	75 17                	jne    a80 <printf+0x14b>
+        putc(fd, c);
+ a69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a6c:	0f be c0             	movsbl %al,%eax
+ a6f:	83 ec 08             	sub    $0x8,%esp
+ a72:	50                   	push   %eax
+ a73:	ff 75 08             	push   0x8(%ebp)
+ a76:	e8 e6 fd ff ff       	call   861 <putc>
+ a7b:	83 c4 10             	add    $0x10,%esp
+ a7e:	eb 25                	jmp    aa5 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a80:	83 ec 08             	sub    $0x8,%esp
+ a83:	6a 25                	push   $0x25
+ a85:	ff 75 08             	push   0x8(%ebp)
+ a88:	e8 d4 fd ff ff       	call   861 <putc>
+ a8d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a93:	0f be c0             	movsbl %al,%eax
+ a96:	83 ec 08             	sub    $0x8,%esp
+ a99:	50                   	push   %eax
+ a9a:	ff 75 08             	push   0x8(%ebp)
+ a9d:	e8 bf fd ff ff       	call   861 <putc>
+ aa2:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ aa5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ aac:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ab0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ab3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab6:	01 d0                	add    %edx,%eax
+ ab8:	0f b6 00             	movzbl (%eax),%eax
+ abb:	84 c0                	test   %al,%al
+ abd:	0f 85 94 fe ff ff    	jne    957 <printf+0x22>
+    }
+  }
+}
+ ac3:	90                   	nop
+ ac4:	90                   	nop
+ ac5:	c9                   	leave
+ ac6:	c3                   	ret
+
+00000ac7 <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+ ac7:	55                   	push   %ebp
+ ac8:	89 e5                	mov    %esp,%ebp
+ aca:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+ acd:	8b 15 e8 1a 00 00    	mov    0x1ae8,%edx
+ ad3:	a1 e4 1a 00 00       	mov    0x1ae4,%eax
+ ad8:	29 c2                	sub    %eax,%edx
+ ada:	89 d0                	mov    %edx,%eax
+ adc:	3b 45 08             	cmp    0x8(%ebp),%eax
+ adf:	0f 83 ed 00 00 00    	jae    bd2 <carve+0x10b>
+    n = size > growsz ? size : growsz;
+ ae5:	a1 60 12 00 00       	mov    0x1260,%eax
+ aea:	8b 55 08             	mov    0x8(%ebp),%edx
+ aed:	39 c2                	cmp    %eax,%edx
+ aef:	0f 43 c2             	cmovae %edx,%eax
+ af2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+ af5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ af8:	05 ff 0f 00 00       	add    $0xfff,%eax
+ afd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ b02:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+ b05:	a1 60 12 00 00       	mov    0x1260,%eax
+ b0a:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+ b0f:	77 0c                	ja     b1d <carve+0x56>
+      growsz *= 2;
+ b11:	a1 60 12 00 00       	mov    0x1260,%eax
+ b16:	01 c0                	add    %eax,%eax
+ b18:	a3 60 12 00 00       	mov    %eax,0x1260
+    p = sbrk(n);
+ b1d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b20:	83 ec 0c             	sub    $0xc,%esp
+ b23:	50                   	push   %eax
+ b24:	e8 90 fc ff ff       	call   7b9 <sbrk>
+ b29:	83 c4 10             	add    $0x10,%esp
+ b2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+ b2f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b33:	75 2a                	jne    b5f <carve+0x98>
+ b35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b38:	39 45 08             	cmp    %eax,0x8(%ebp)
+ b3b:	73 22                	jae    b5f <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+ b3d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b40:	05 ff 0f 00 00       	add    $0xfff,%eax
+ b45:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ b4a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+ b4d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b50:	83 ec 0c             	sub    $0xc,%esp
+ b53:	50                   	push   %eax
+ b54:	e8 60 fc ff ff       	call   7b9 <sbrk>
+ b59:	83 c4 10             	add    $0x10,%esp
+ b5c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+ b5f:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b63:	75 0a                	jne    b6f <carve+0xa8>
+      return 0;
+ b65:	b8 00 00 00 00       	mov    $0x0,%eax
+ b6a:	e9 86 00 00 00       	jmp    bf5 <carve+0x12e>
+    if(p != limit){
+ b6f:	a1 e8 1a 00 00       	mov    0x1ae8,%eax
+ b74:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ b77:	74 4c                	je     bc5 <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+ b79:	8b 15 e8 1a 00 00    	mov    0x1ae8,%edx
+ b7f:	a1 e4 1a 00 00       	mov    0x1ae4,%eax
+ b84:	29 c2                	sub    %eax,%edx
+ b86:	83 fa 0f             	cmp    $0xf,%edx
+ b89:	7e 32                	jle    bbd <carve+0xf6>
+        b = (Block*)top;
+ b8b:	a1 e4 1a 00 00       	mov    0x1ae4,%eax
+ b90:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+ b93:	8b 15 e8 1a 00 00    	mov    0x1ae8,%edx
+ b99:	a1 e4 1a 00 00       	mov    0x1ae4,%eax
+ b9e:	29 c2                	sub    %eax,%edx
+ ba0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ba3:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+ ba5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ba8:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+ baf:	83 ec 0c             	sub    $0xc,%esp
+ bb2:	ff 75 ec             	push   -0x14(%ebp)
+ bb5:	e8 3d 00 00 00       	call   bf7 <lfree>
+ bba:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+ bbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc0:	a3 e4 1a 00 00       	mov    %eax,0x1ae4
+    }
+    limit = p + n;
+ bc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ bc8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bcb:	01 d0                	add    %edx,%eax
+ bcd:	a3 e8 1a 00 00       	mov    %eax,0x1ae8
+  }
+  b = (Block*)top;
+ bd2:	a1 e4 1a 00 00       	mov    0x1ae4,%eax
+ bd7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+ bda:	8b 15 e4 1a 00 00    	mov    0x1ae4,%edx
+ be0:	8b 45 08             	mov    0x8(%ebp),%eax
+ be3:	01 d0                	add    %edx,%eax
+ be5:	a3 e4 1a 00 00       	mov    %eax,0x1ae4
+  b->h.size = size;
+ bea:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ bed:	8b 55 08             	mov    0x8(%ebp),%edx
+ bf0:	89 10                	mov    %edx,(%eax)
+  return b;
+ bf2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ bf5:	c9                   	leave
+ bf6:	c3                   	ret
+
+00000bf7 <lfree>:
+
+static void
+lfree(Block *b)
+{
+ bf7:	55                   	push   %ebp
+ bf8:	89 e5                	mov    %esp,%ebp
+ bfa:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+ bfd:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ c04:	a1 e0 1a 00 00       	mov    0x1ae0,%eax
+ c09:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c0c:	eb 0f                	jmp    c1d <lfree+0x26>
+    prev = p;
+ c0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c11:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ c14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c17:	8b 40 08             	mov    0x8(%eax),%eax
+ c1a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c1d:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ c21:	74 08                	je     c2b <lfree+0x34>
+ c23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c26:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c29:	72 e3                	jb     c0e <lfree+0x17>
+  b->next = p;
+ c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ c31:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+ c34:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ c38:	74 2c                	je     c66 <lfree+0x6f>
+ c3a:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3d:	8b 10                	mov    (%eax),%edx
+ c3f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c42:	01 d0                	add    %edx,%eax
+ c44:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c47:	75 1d                	jne    c66 <lfree+0x6f>
+    b->h.size += p->h.size;
+ c49:	8b 45 08             	mov    0x8(%ebp),%eax
+ c4c:	8b 10                	mov    (%eax),%edx
+ c4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c51:	8b 00                	mov    (%eax),%eax
+ c53:	01 c2                	add    %eax,%edx
+ c55:	8b 45 08             	mov    0x8(%ebp),%eax
+ c58:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+ c5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5d:	8b 50 08             	mov    0x8(%eax),%edx
+ c60:	8b 45 08             	mov    0x8(%ebp),%eax
+ c63:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+ c66:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ c6a:	74 2e                	je     c9a <lfree+0xa3>
+ c6c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c6f:	8b 10                	mov    (%eax),%edx
+ c71:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c74:	01 d0                	add    %edx,%eax
+ c76:	39 45 08             	cmp    %eax,0x8(%ebp)
+ c79:	75 1f                	jne    c9a <lfree+0xa3>
+    prev->h.size += b->h.size;
+ c7b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c7e:	8b 10                	mov    (%eax),%edx
+ c80:	8b 45 08             	mov    0x8(%ebp),%eax
+ c83:	8b 00                	mov    (%eax),%eax
+ c85:	01 c2                	add    %eax,%edx
+ c87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c8a:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+ c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8f:	8b 50 08             	mov    0x8(%eax),%edx
+ c92:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c95:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+ c98:	eb 19                	jmp    cb3 <lfree+0xbc>
+  } else if(prev)
+ c9a:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ c9e:	74 0b                	je     cab <lfree+0xb4>
+    prev->next = b;
+ ca0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ca3:	8b 55 08             	mov    0x8(%ebp),%edx
+ ca6:	89 50 08             	mov    %edx,0x8(%eax)
+}
+ ca9:	eb 08                	jmp    cb3 <lfree+0xbc>
+    large = b;
+ cab:	8b 45 08             	mov    0x8(%ebp),%eax
+ cae:	a3 e0 1a 00 00       	mov    %eax,0x1ae0
+}
+ cb3:	90                   	nop
+ cb4:	c9                   	leave
+ cb5:	c3                   	ret
+
+00000cb6 <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+ cb6:	55                   	push   %ebp
+ cb7:	89 e5                	mov    %esp,%ebp
+ cb9:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ cbc:	c7 45 f0 e0 1a 00 00 	movl   $0x1ae0,-0x10(%ebp)
+ cc3:	eb 52                	jmp    d17 <lalloc+0x61>
+    if(p->h.size < size)
+ cc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc8:	8b 00                	mov    (%eax),%eax
+ cca:	3b 45 08             	cmp    0x8(%ebp),%eax
+ ccd:	72 3e                	jb     d0d <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+ ccf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd2:	8b 00                	mov    (%eax),%eax
+ cd4:	2b 45 08             	sub    0x8(%ebp),%eax
+ cd7:	83 f8 0f             	cmp    $0xf,%eax
+ cda:	76 21                	jbe    cfd <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+ cdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdf:	8b 00                	mov    (%eax),%eax
+ ce1:	2b 45 08             	sub    0x8(%ebp),%eax
+ ce4:	89 c2                	mov    %eax,%edx
+ ce6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce9:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+ ceb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cee:	8b 00                	mov    (%eax),%eax
+ cf0:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+ cf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf6:	8b 55 08             	mov    0x8(%ebp),%edx
+ cf9:	89 10                	mov    %edx,(%eax)
+ cfb:	eb 0b                	jmp    d08 <lalloc+0x52>
+    } else
+      *pp = p->next;
+ cfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d00:	8b 50 08             	mov    0x8(%eax),%edx
+ d03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d06:	89 10                	mov    %edx,(%eax)
+    return p;
+ d08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0b:	eb 26                	jmp    d33 <lalloc+0x7d>
+      continue;
+ d0d:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ d0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d11:	83 c0 08             	add    $0x8,%eax
+ d14:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d17:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d1a:	8b 00                	mov    (%eax),%eax
+ d1c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d1f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d23:	75 a0                	jne    cc5 <lalloc+0xf>
+  }
+  return carve(size);
+ d25:	83 ec 0c             	sub    $0xc,%esp
+ d28:	ff 75 08             	push   0x8(%ebp)
+ d2b:	e8 97 fd ff ff       	call   ac7 <carve>
+ d30:	83 c4 10             	add    $0x10,%esp
+}
+ d33:	c9                   	leave
+ d34:	c3                   	ret
+
+00000d35 <free>:
+
+void
+free(void *ap)
+{
+ d35:	55                   	push   %ebp
+ d36:	89 e5                	mov    %esp,%ebp
+ d38:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+ d3b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ d3f:	74 46                	je     d87 <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+ d41:	8b 45 08             	mov    0x8(%ebp),%eax
+ d44:	83 e8 08             	sub    $0x8,%eax
+ d47:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+ d4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d4d:	8b 40 04             	mov    0x4(%eax),%eax
+ d50:	83 f8 07             	cmp    $0x7,%eax
+ d53:	77 25                	ja     d7a <free+0x45>
+    b->next = bins[b->h.bin];
+ d55:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d58:	8b 40 04             	mov    0x4(%eax),%eax
+ d5b:	8b 14 85 c0 1a 00 00 	mov    0x1ac0(,%eax,4),%edx
+ d62:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d65:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+ d68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d6b:	8b 40 04             	mov    0x4(%eax),%eax
+ d6e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ d71:	89 14 85 c0 1a 00 00 	mov    %edx,0x1ac0(,%eax,4)
+ d78:	eb 0e                	jmp    d88 <free+0x53>
+  } else
+    lfree(b);
+ d7a:	ff 75 fc             	push   -0x4(%ebp)
+ d7d:	e8 75 fe ff ff       	call   bf7 <lfree>
+ d82:	83 c4 04             	add    $0x4,%esp
+ d85:	eb 01                	jmp    d88 <free+0x53>
+    return;
+ d87:	90                   	nop
+}
+ d88:	c9                   	leave
+ d89:	c3                   	ret
+
+00000d8a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d8a:	55                   	push   %ebp
+ d8b:	89 e5                	mov    %esp,%ebp
+ d8d:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+ d90:	8b 45 08             	mov    0x8(%ebp),%eax
+ d93:	83 c0 08             	add    $0x8,%eax
+ d96:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+ d99:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d9c:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d9f:	73 0a                	jae    dab <malloc+0x21>
+    return 0;
+ da1:	b8 00 00 00 00       	mov    $0x0,%eax
+ da6:	e9 b8 00 00 00       	jmp    e63 <malloc+0xd9>
+  if(size <= MAXSMALL){
+ dab:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+ db2:	77 6f                	ja     e23 <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+ db4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ dbb:	eb 04                	jmp    dc1 <malloc+0x37>
+ dbd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ dc1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dc4:	ba 10 00 00 00       	mov    $0x10,%edx
+ dc9:	89 c1                	mov    %eax,%ecx
+ dcb:	d3 e2                	shl    %cl,%edx
+ dcd:	89 d0                	mov    %edx,%eax
+ dcf:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ dd2:	72 e9                	jb     dbd <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+ dd4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dd7:	8b 04 85 c0 1a 00 00 	mov    0x1ac0(,%eax,4),%eax
+ dde:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ de1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ de5:	74 12                	je     df9 <malloc+0x6f>
+      bins[bin] = b->next;
+ de7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dea:	8b 50 08             	mov    0x8(%eax),%edx
+ ded:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ df0:	89 14 85 c0 1a 00 00 	mov    %edx,0x1ac0(,%eax,4)
+ df7:	eb 5b                	jmp    e54 <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+ df9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dfc:	ba 10 00 00 00       	mov    $0x10,%edx
+ e01:	89 c1                	mov    %eax,%ecx
+ e03:	d3 e2                	shl    %cl,%edx
+ e05:	89 d0                	mov    %edx,%eax
+ e07:	83 ec 0c             	sub    $0xc,%esp
+ e0a:	50                   	push   %eax
+ e0b:	e8 b7 fc ff ff       	call   ac7 <carve>
+ e10:	83 c4 10             	add    $0x10,%esp
+ e13:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e16:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e1a:	75 38                	jne    e54 <malloc+0xca>
+      return 0;
+ e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+ e21:	eb 40                	jmp    e63 <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ e23:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ e26:	83 c0 07             	add    $0x7,%eax
+ e29:	83 e0 f8             	and    $0xfffffff8,%eax
+ e2c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+ e2f:	83 ec 0c             	sub    $0xc,%esp
+ e32:	ff 75 ec             	push   -0x14(%ebp)
+ e35:	e8 7c fe ff ff       	call   cb6 <lalloc>
+ e3a:	83 c4 10             	add    $0x10,%esp
+ e3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e40:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e44:	75 07                	jne    e4d <malloc+0xc3>
+      return 0;
+ e46:	b8 00 00 00 00       	mov    $0x0,%eax
+ e4b:	eb 16                	jmp    e63 <malloc+0xd9>
+    bin = LARGE;
+ e4d:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+ e54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e57:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ e5a:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+ e5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e60:	83 c0 08             	add    $0x8,%eax
+}
+ e63:	c9                   	leave
+ e64:	c3                   	ret
@@ -0,0 +1,185 @@
+// Compare the size-class malloc in umalloc.c with the
+// Kernighan and Ritchie first-fit allocator it replaced.
+// Both run the same workloads; times are in microseconds.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NSLOT   512
+#define NROUND  2000
+#define NBATCH  64
+#define NMIXED  200000
+
+// The old allocator, from The C Programming Language,
+// 2nd ed., Section 8.7, renamed so both can be linked.
+
+typedef long Align;
+
+union header {
+  struct {
+    union header *ptr;
+    uint size;
+  } s;
+  Align x;
+};
+
+typedef union header Header;
+
+static Header base;
+static Header *freep;
+
+static void
+krfree(void *ap)
+{
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+
+static Header*
+morecore(uint nu)
+{
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    nu = 4096;
+  p = sbrk(nu * sizeof(Header));
+  if(p == (char*)-1)
+    return 0;
+  hp = (Header*)p;
+  hp->s.size = nu;
+  krfree((void*)(hp + 1));
+  return freep;
+}
+
+static void*
+krmalloc(uint nbytes)
+{
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+  if((prevp = freep) == 0){
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    if(p->s.size >= nunits){
+      if(p->s.size == nunits)
+        prevp->s.ptr = p->s.ptr;
+      else {
+        p->s.size -= nunits;
+        p += p->s.size;
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+      if((p = morecore(nunits)) == 0)
+        return 0;
+  }
+}
+
+struct allocator {
+  char *name;
+  void *(*alloc)(uint);
+  void (*free)(void*);
+};
+
+static struct allocator allocators[] = {
+  { "k&r",       krmalloc, krfree },
+  { "sizeclass", malloc,   free },
+};
+
+static char *slot[NSLOT];
+static uint seed;
+
+static uint
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Allocate and free batches of equal small blocks.
+static int
+batch(struct allocator *a)
+{
+  char *p[NBATCH];
+  int i, r;
+  uint t0;
+
+  t0 = uptimeus();
+  for(r = 0; r < NROUND; r++){
+    for(i = 0; i < NBATCH; i++)
+      if((p[i] = a->alloc(32)) == 0)
+        return -1;
+    for(i = 0; i < NBATCH; i++)
+      a->free(p[i]);
+  }
+  return uptimeus() - t0;
+}
+
+// Random sizes with random lifetimes, which fragments
+// a first-fit free list.
+static int
+mixed(struct allocator *a)
+{
+  int i, n;
+  uint t0;
+  uint sz;
+
+  seed = 1;
+  t0 = uptimeus();
+  for(n = 0; n < NMIXED; n++){
+    i = rand() % NSLOT;
+    if(slot[i]){
+      a->free(slot[i]);
+      slot[i] = 0;
+      continue;
+    }
+    sz = rand() % 16 == 0 ? 4096 + rand() % 8192 : 1 + rand() % 512;
+    if((slot[i] = a->alloc(sz)) == 0)
+      return -1;
+    slot[i][0] = 1;
+  }
+  for(i = 0; i < NSLOT; i++){
+    if(slot[i])
+      a->free(slot[i]);
+    slot[i] = 0;
+  }
+  return uptimeus() - t0;
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct allocator *a;
+  int tb, tm;
+
+  printf(1, "mallocbench: %d x %d small blocks, %d mixed ops\n",
+         NROUND, NBATCH, NMIXED);
+  for(a = allocators; a < allocators + sizeof(allocators)/sizeof(allocators[0]); a++){
+    tb = batch(a);
+    tm = mixed(a);
+    printf(1, "%s: batch %d us, mixed %d us\n", a->name, tb, tm);
+  }
+  exit();
+}
@@ -0,0 +1,608 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 2e 04 00 00       	push   $0x42e
+  21:	6a 02                	push   $0x2
+  23:	e8 74 02 00 00       	call   29c <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 68 00 00 00       	call   98 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 ad 00 00 00       	call   100 <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 45 04 00 00       	push   $0x445
+  74:	6a 02                	push   $0x2
+  76:	e8 21 02 00 00       	call   29c <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 08 00 00 00       	call   98 <exit>
+
+00000090 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  90:	b8 01 00 00 00       	mov    $0x1,%eax
+  95:	cd 40                	int    $0x40
+  97:	c3                   	ret
+
+00000098 <exit>:
+SYSCALL(exit)
+  98:	b8 02 00 00 00       	mov    $0x2,%eax
+  9d:	cd 40                	int    $0x40
+  9f:	c3                   	ret
+
+000000a0 <wait>:
+SYSCALL(wait)
+  a0:	b8 03 00 00 00       	mov    $0x3,%eax
+  a5:	cd 40                	int    $0x40
+  a7:	c3                   	ret
+
+000000a8 <pipe>:
+SYSCALL(pipe)
+  a8:	b8 04 00 00 00       	mov    $0x4,%eax
+  ad:	cd 40                	int    $0x40
+  af:	c3                   	ret
+
+000000b0 <read>:
+SYSCALL(read)
+  b0:	b8 05 00 00 00       	mov    $0x5,%eax
+  b5:	cd 40                	int    $0x40
+  b7:	c3                   	ret
+
+000000b8 <write>:
+SYSCALL(write)
+  b8:	b8 10 00 00 00       	mov    $0x10,%eax
+  bd:	cd 40                	int    $0x40
+  bf:	c3                   	ret
+
+000000c0 <close>:
+SYSCALL(close)
+  c0:	b8 15 00 00 00       	mov    $0x15,%eax
+  c5:	cd 40                	int    $0x40
+  c7:	c3                   	ret
+
+000000c8 <kill>:
+SYSCALL(kill)
+  c8:	b8 06 00 00 00       	mov    $0x6,%eax
+  cd:	cd 40                	int    $0x40
+  cf:	c3                   	ret
+
+000000d0 <exec>:
+SYSCALL(exec)
+  d0:	b8 07 00 00 00       	mov    $0x7,%eax
+  d5:	cd 40                	int    $0x40
+  d7:	c3                   	ret
+
+000000d8 <open>:
+SYSCALL(open)
+  d8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  dd:	cd 40                	int    $0x40
+  df:	c3                   	ret
+
+000000e0 <mknod>:
+SYSCALL(mknod)
+  e0:	b8 11 00 00 00       	mov    $0x11,%eax
+  e5:	cd 40                	int    $0x40
+  e7:	c3                   	ret
+
+000000e8 <unlink>:
+SYSCALL(unlink)
+  e8:	b8 12 00 00 00       	mov    $0x12,%eax
+  ed:	cd 40                	int    $0x40
+  ef:	c3                   	ret
+
+000000f0 <fstat>:
+SYSCALL(fstat)
+  f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  f5:	cd 40                	int    $0x40
+  f7:	c3                   	ret
+
+000000f8 <link>:
+SYSCALL(link)
+  f8:	b8 13 00 00 00       	mov    $0x13,%eax
+  fd:	cd 40                	int    $0x40
+  ff:	c3                   	ret
+
+00000100 <mkdir>:
+SYSCALL(mkdir)
+ 100:	b8 14 00 00 00       	mov    $0x14,%eax
+ 105:	cd 40                	int    $0x40
+ 107:	c3                   	ret
+
+00000108 <chdir>:
+SYSCALL(chdir)
+ 108:	b8 09 00 00 00       	mov    $0x9,%eax
+ 10d:	cd 40                	int    $0x40
+ 10f:	c3                   	ret
+
+00000110 <dup>:
+SYSCALL(dup)
+ 110:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 115:	cd 40                	int    $0x40
+ 117:	c3                   	ret
+
+00000118 <getpid>:
+SYSCALL(getpid)
+ 118:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 11d:	cd 40                	int    $0x40
+ 11f:	c3                   	ret
+
+00000120 <sbrk>:
+SYSCALL(sbrk)
+ 120:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 125:	cd 40                	int    $0x40
+ 127:	c3                   	ret
+
+00000128 <sleep>:
+SYSCALL(sleep)
+ 128:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 12d:	cd 40                	int    $0x40
+ 12f:	c3                   	ret
+
+00000130 <uptime>:
+SYSCALL(uptime)
+ 130:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 135:	cd 40                	int    $0x40
+ 137:	c3                   	ret
+
+00000138 <saveProc>:
+SYSCALL(saveProc)
+ 138:	b8 16 00 00 00       	mov    $0x16,%eax
+ 13d:	cd 40                	int    $0x40
+ 13f:	c3                   	ret
+
+00000140 <loadProc>:
+SYSCALL(loadProc)
+ 140:	b8 17 00 00 00       	mov    $0x17,%eax
+ 145:	cd 40                	int    $0x40
+ 147:	c3                   	ret
+
+00000148 <setpriority>:
+SYSCALL(setpriority)
+ 148:	b8 19 00 00 00       	mov    $0x19,%eax
+ 14d:	cd 40                	int    $0x40
+ 14f:	c3                   	ret
+
+00000150 <setaffinity>:
+SYSCALL(setaffinity)
+ 150:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 155:	cd 40                	int    $0x40
+ 157:	c3                   	ret
+
+00000158 <getaffinity>:
+SYSCALL(getaffinity)
+ 158:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 15d:	cd 40                	int    $0x40
+ 15f:	c3                   	ret
+
+00000160 <nanosleep>:
+SYSCALL(nanosleep)
+ 160:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 165:	cd 40                	int    $0x40
+ 167:	c3                   	ret
+
+00000168 <cpustat>:
+SYSCALL(cpustat)
+ 168:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 16d:	cd 40                	int    $0x40
+ 16f:	c3                   	ret
+
+00000170 <nanouptime>:
+SYSCALL(nanouptime)
+ 170:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 175:	cd 40                	int    $0x40
+ 177:	c3                   	ret
+
+00000178 <settickets>:
+SYSCALL(settickets)
+ 178:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 17d:	cd 40                	int    $0x40
+ 17f:	c3                   	ret
+
+00000180 <setdeadline>:
+SYSCALL(setdeadline)
+ 180:	b8 20 00 00 00       	mov    $0x20,%eax
+ 185:	cd 40                	int    $0x40
+ 187:	c3                   	ret
+
+00000188 <rtstat>:
+SYSCALL(rtstat)
+ 188:	b8 21 00 00 00       	mov    $0x21,%eax
+ 18d:	cd 40                	int    $0x40
+ 18f:	c3                   	ret
+
+00000190 <schedstat>:
+SYSCALL(schedstat)
+ 190:	b8 22 00 00 00       	mov    $0x22,%eax
+ 195:	cd 40                	int    $0x40
+ 197:	c3                   	ret
+
+00000198 <waitpid>:
+SYSCALL(waitpid)
+ 198:	b8 23 00 00 00       	mov    $0x23,%eax
+ 19d:	cd 40                	int    $0x40
+ 19f:	c3                   	ret
+
+000001a0 <clone>:
+SYSCALL(clone)
+ 1a0:	b8 24 00 00 00       	mov    $0x24,%eax
+ 1a5:	cd 40                	int    $0x40
+ 1a7:	c3                   	ret
+
+000001a8 <futexwait>:
+SYSCALL(futexwait)
+ 1a8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 1ad:	cd 40                	int    $0x40
+ 1af:	c3                   	ret
+
+000001b0 <futexwake>:
+SYSCALL(futexwake)
+ 1b0:	b8 26 00 00 00       	mov    $0x26,%eax
+ 1b5:	cd 40                	int    $0x40
+ 1b7:	c3                   	ret
+
+000001b8 <lockstat>:
+SYSCALL(lockstat)
+ 1b8:	b8 27 00 00 00       	mov    $0x27,%eax
+ 1bd:	cd 40                	int    $0x40
+ 1bf:	c3                   	ret
+
+000001c0 <dcachestat>:
+SYSCALL(dcachestat)
+ 1c0:	b8 28 00 00 00       	mov    $0x28,%eax
+ 1c5:	cd 40                	int    $0x40
+ 1c7:	c3                   	ret
+
+000001c8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 1c8:	55                   	push   %ebp
+ 1c9:	89 e5                	mov    %esp,%ebp
+ 1cb:	83 ec 18             	sub    $0x18,%esp
+ 1ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d1:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 1d4:	83 ec 04             	sub    $0x4,%esp
+ 1d7:	6a 01                	push   $0x1
+ 1d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 1dc:	50                   	push   %eax
+ 1dd:	ff 75 08             	push   0x8(%ebp)
+ 1e0:	e8 d3 fe ff ff       	call   b8 <write>
+ 1e5:	83 c4 10             	add    $0x10,%esp
+}
+ 1e8:	90                   	nop
+ 1e9:	c9                   	leave
+ 1ea:	c3                   	ret
+
+000001eb <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 1f1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 1f8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 1fc:	74 17                	je     215 <printint+0x2a>
+ 1fe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 202:	79 11                	jns    215 <printint+0x2a>
+    neg = 1;
+ 204:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 20b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20e:	f7 d8                	neg    %eax
+ 210:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 213:	eb 06                	jmp    21b <printint+0x30>
+  } else {
+    x = xx;
+ 215:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 218:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 21b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 222:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 225:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 228:	ba 00 00 00 00       	mov    $0x0,%edx
+ 22d:	f7 f1                	div    %ecx
+ 22f:	89 d1                	mov    %edx,%ecx
+ 231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 234:	8d 50 01             	lea    0x1(%eax),%edx
+ 237:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 23a:	0f b6 91 08 05 00 00 	movzbl 0x508(%ecx),%edx
+ 241:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 245:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 248:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 24b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 250:	f7 f1                	div    %ecx
+ 252:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 255:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 259:	75 c7                	jne    222 <printint+0x37>
+  if(neg)
+ 25b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 25f:	74 2d                	je     28e <printint+0xa3>
+    buf[i++] = '-';
+ 261:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 264:	8d 50 01             	lea    0x1(%eax),%edx
+ 267:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 26a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 26f:	eb 1d                	jmp    28e <printint+0xa3>
+    putc(fd, buf[i]);
+ 271:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 274:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 277:	01 d0                	add    %edx,%eax
+ 279:	0f b6 00             	movzbl (%eax),%eax
+ 27c:	0f be c0             	movsbl %al,%eax
+ 27f:	83 ec 08             	sub    $0x8,%esp
+ 282:	50                   	push   %eax
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 3d ff ff ff       	call   1c8 <putc>
+ 28b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 28e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 292:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 296:	79 d9                	jns    271 <printint+0x86>
+}
+ 298:	90                   	nop
+ 299:	90                   	nop
+ 29a:	c9                   	leave
+ 29b:	c3                   	ret
+
+0000029c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 29c:	55                   	push   %ebp
+ 29d:	89 e5                	mov    %esp,%ebp
+ 29f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 2a2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 2a9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 2ac:	83 c0 04             	add    $0x4,%eax
+ 2af:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 2b2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 2b9:	e9 59 01 00 00       	jmp    417 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 2be:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2c4:	01 d0                	add    %edx,%eax
+ 2c6:	0f b6 00             	movzbl (%eax),%eax
+ 2c9:	0f be c0             	movsbl %al,%eax
+ 2cc:	25 ff 00 00 00       	and    $0xff,%eax
+ 2d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 2d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2d8:	75 2c                	jne    306 <printf+0x6a>
+      if(c == '%'){
+ 2da:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 2de:	75 0c                	jne    2ec <printf+0x50>
+        state = '%';
+ 2e0:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 2e7:	e9 27 01 00 00       	jmp    413 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 2ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 2ef:	0f be c0             	movsbl %al,%eax
+ 2f2:	83 ec 08             	sub    $0x8,%esp
+ 2f5:	50                   	push   %eax
+ 2f6:	ff 75 08             	push   0x8(%ebp)
+ 2f9:	e8 ca fe ff ff       	call   1c8 <putc>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	e9 0d 01 00 00       	jmp    413 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 306:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 30a:	0f 85 03 01 00 00    	jne    413 <printf+0x177>
+      if(c == 'd'){
+ 310:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 314:	75 1e                	jne    334 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 316:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 319:	8b 00                	mov    (%eax),%eax
+ 31b:	6a 01                	push   $0x1
+ 31d:	6a 0a                	push   $0xa
+ 31f:	50                   	push   %eax
+ 320:	ff 75 08             	push   0x8(%ebp)
+ 323:	e8 c3 fe ff ff       	call   1eb <printint>
+ 328:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 32b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 32f:	e9 d8 00 00 00       	jmp    40c <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 334:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 338:	74 06                	je     340 <printf+0xa4>
+ 33a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 33e:	75 1e                	jne    35e <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 340:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 343:	8b 00                	mov    (%eax),%eax
+ 345:	6a 00                	push   $0x0
+ 347:	6a 10                	push   $0x10
+ 349:	50                   	push   %eax
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 99 fe ff ff       	call   1eb <printint>
+ 352:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 355:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 359:	e9 ae 00 00 00       	jmp    40c <printf+0x170>
+      } else if(c == 's'){
+ 35e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 362:	75 43                	jne    3a7 <printf+0x10b>
+        s = (char*)*ap;
+ 364:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 367:	8b 00                	mov    (%eax),%eax
+ 369:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 36c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 370:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 374:	75 25                	jne    39b <printf+0xff>
+          s = "(null)";
+ 376:	c7 45 f4 61 04 00 00 	movl   $0x461,-0xc(%ebp)
+        while(*s != 0){
+ 37d:	eb 1c                	jmp    39b <printf+0xff>
+          putc(fd, *s);
+ 37f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 382:	0f b6 00             	movzbl (%eax),%eax
+ 385:	0f be c0             	movsbl %al,%eax
+ 388:	83 ec 08             	sub    $0x8,%esp
+ 38b:	50                   	push   %eax
+ 38c:	ff 75 08             	push   0x8(%ebp)
+ 38f:	e8 34 fe ff ff       	call   1c8 <putc>
+ 394:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 397:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 39b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 39e:	0f b6 00             	movzbl (%eax),%eax
+ 3a1:	84 c0                	test   %al,%al
+ 3a3:	75 da                	jne    37f <printf+0xe3>
+ 3a5:	eb 65                	jmp    40c <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 3a7:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 3ab:	75 1d                	jne    3ca <printf+0x12e>
+        putc(fd, *ap);
+ 3ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 3b0:	8b 00                	mov    (%eax),%eax
+ 3b2:	0f be c0             	movsbl %al,%eax
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	50                   	push   %eax
+ 3b9:	ff 75 08             	push   0x8(%ebp)
+ 3bc:	e8 07 fe ff ff       	call   1c8 <putc>
+ 3c1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 3c4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 3c8:	eb 42                	jmp    40c <printf+0x170>
+      } else if(c == '%'){
+ 3ca:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 3ce:	75 17                	jne    3e7 <printf+0x14b>
+        putc(fd, c);
+ 3d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3d3:	0f be c0             	movsbl %al,%eax
+ 3d6:	83 ec 08             	sub    $0x8,%esp
+ 3d9:	50                   	push   %eax
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 e6 fd ff ff       	call   1c8 <putc>
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	eb 25                	jmp    40c <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 3e7:	83 ec 08             	sub    $0x8,%esp
+ 3ea:	6a 25                	push   $0x25
+ 3ec:	ff 75 08             	push   0x8(%ebp)
+ 3ef:	e8 d4 fd ff ff       	call   1c8 <putc>
+ 3f4:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 3f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 3fa:	0f be c0             	movsbl %al,%eax
+ 3fd:	83 ec 08             	sub    $0x8,%esp
+ 400:	50                   	push   %eax
+ 401:	ff 75 08             	push   0x8(%ebp)
+ 404:	e8 bf fd ff ff       	call   1c8 <putc>
+ 409:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 40c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 413:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 417:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 41a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 41d:	01 d0                	add    %edx,%eax
+ 41f:	0f b6 00             	movzbl (%eax),%eax
+ 422:	84 c0                	test   %al,%al
+ 424:	0f 85 94 fe ff ff    	jne    2be <printf+0x22>
+    }
+  }
+}
+ 42a:	90                   	nop
+ 42b:	90                   	nop
+ 42c:	c9                   	leave
+ 42d:	c3                   	ret
@@ -0,0 +1,1024 @@
+
+_nice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	89 cb                	mov    %ecx,%ebx
+  if(argc < 3){
+  15:	83 3b 02             	cmpl   $0x2,(%ebx)
+  18:	7f 17                	jg     31 <main+0x31>
+    printf(2, "usage: nice level command [arg...]\n");
+  1a:	83 ec 08             	sub    $0x8,%esp
+  1d:	68 d8 06 00 00       	push   $0x6d8
+  22:	6a 02                	push   $0x2
+  24:	e8 1b 05 00 00       	call   544 <printf>
+  29:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2c:	e8 0f 03 00 00       	call   340 <exit>
+  }
+  if(setpriority(getpid(), atoi(argv[1])) < 0){
+  31:	8b 43 04             	mov    0x4(%ebx),%eax
+  34:	83 c0 04             	add    $0x4,%eax
+  37:	8b 00                	mov    (%eax),%eax
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	50                   	push   %eax
+  3d:	e8 3b 02 00 00       	call   27d <atoi>
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	89 c6                	mov    %eax,%esi
+  47:	e8 74 03 00 00       	call   3c0 <getpid>
+  4c:	83 ec 08             	sub    $0x8,%esp
+  4f:	56                   	push   %esi
+  50:	50                   	push   %eax
+  51:	e8 9a 03 00 00       	call   3f0 <setpriority>
+  56:	83 c4 10             	add    $0x10,%esp
+  59:	85 c0                	test   %eax,%eax
+  5b:	79 20                	jns    7d <main+0x7d>
+    printf(2, "nice: bad level %s\n", argv[1]);
+  5d:	8b 43 04             	mov    0x4(%ebx),%eax
+  60:	83 c0 04             	add    $0x4,%eax
+  63:	8b 00                	mov    (%eax),%eax
+  65:	83 ec 04             	sub    $0x4,%esp
+  68:	50                   	push   %eax
+  69:	68 fc 06 00 00       	push   $0x6fc
+  6e:	6a 02                	push   $0x2
+  70:	e8 cf 04 00 00       	call   544 <printf>
+  75:	83 c4 10             	add    $0x10,%esp
+    exit();
+  78:	e8 c3 02 00 00       	call   340 <exit>
+  }
+  exec(argv[2], argv + 2);
+  7d:	8b 43 04             	mov    0x4(%ebx),%eax
+  80:	8d 50 08             	lea    0x8(%eax),%edx
+  83:	8b 43 04             	mov    0x4(%ebx),%eax
+  86:	83 c0 08             	add    $0x8,%eax
+  89:	8b 00                	mov    (%eax),%eax
+  8b:	83 ec 08             	sub    $0x8,%esp
+  8e:	52                   	push   %edx
+  8f:	50                   	push   %eax
+  90:	e8 e3 02 00 00       	call   378 <exec>
+  95:	83 c4 10             	add    $0x10,%esp
+  printf(2, "nice: exec %s failed\n", argv[2]);
+  98:	8b 43 04             	mov    0x4(%ebx),%eax
+  9b:	83 c0 08             	add    $0x8,%eax
+  9e:	8b 00                	mov    (%eax),%eax
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	50                   	push   %eax
+  a4:	68 10 07 00 00       	push   $0x710
+  a9:	6a 02                	push   $0x2
+  ab:	e8 94 04 00 00       	call   544 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+  exit();
+  b3:	e8 88 02 00 00       	call   340 <exit>
+
+000000b8 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  b8:	55                   	push   %ebp
+  b9:	89 e5                	mov    %esp,%ebp
+  bb:	57                   	push   %edi
+  bc:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+  bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c6:	89 cb                	mov    %ecx,%ebx
+  c8:	89 df                	mov    %ebx,%edi
+  ca:	89 d1                	mov    %edx,%ecx
+  cc:	fc                   	cld
+  cd:	f3 aa                	rep stos %al,%es:(%edi)
+  cf:	89 ca                	mov    %ecx,%edx
+  d1:	89 fb                	mov    %edi,%ebx
+  d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  d6:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+  d9:	90                   	nop
+  da:	5b                   	pop    %ebx
+  db:	5f                   	pop    %edi
+  dc:	5d                   	pop    %ebp
+  dd:	c3                   	ret
+
+000000de <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+  de:	55                   	push   %ebp
+  df:	89 e5                	mov    %esp,%ebp
+  e1:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+  e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  e7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  ea:	90                   	nop
+  eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ee:	8d 42 01             	lea    0x1(%edx),%eax
+  f1:	89 45 0c             	mov    %eax,0xc(%ebp)
+  f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  f7:	8d 48 01             	lea    0x1(%eax),%ecx
+  fa:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  fd:	0f b6 12             	movzbl (%edx),%edx
+ 100:	88 10                	mov    %dl,(%eax)
+ 102:	0f b6 00             	movzbl (%eax),%eax
+ 105:	84 c0                	test   %al,%al
+ 107:	75 e2                	jne    eb <strcpy+0xd>
+    ;
+  return os;
+ 109:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 10c:	c9                   	leave
+ 10d:	c3                   	ret
+
+0000010e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10e:	55                   	push   %ebp
+ 10f:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 111:	eb 08                	jmp    11b <strcmp+0xd>
+    p++, q++;
+ 113:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 117:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 11b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11e:	0f b6 00             	movzbl (%eax),%eax
+ 121:	84 c0                	test   %al,%al
+ 123:	74 10                	je     135 <strcmp+0x27>
+ 125:	8b 45 08             	mov    0x8(%ebp),%eax
+ 128:	0f b6 10             	movzbl (%eax),%edx
+ 12b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	38 c2                	cmp    %al,%dl
+ 133:	74 de                	je     113 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 135:	8b 45 08             	mov    0x8(%ebp),%eax
+ 138:	0f b6 00             	movzbl (%eax),%eax
+ 13b:	0f b6 d0             	movzbl %al,%edx
+ 13e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 141:	0f b6 00             	movzbl (%eax),%eax
+ 144:	0f b6 c0             	movzbl %al,%eax
+ 147:	29 c2                	sub    %eax,%edx
+ 149:	89 d0                	mov    %edx,%eax
+}
+ 14b:	5d                   	pop    %ebp
+ 14c:	c3                   	ret
+
+0000014d <strlen>:
+
+uint
+strlen(char *s)
+{
+ 14d:	55                   	push   %ebp
+ 14e:	89 e5                	mov    %esp,%ebp
+ 150:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 153:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 15a:	eb 04                	jmp    160 <strlen+0x13>
+ 15c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 160:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	01 d0                	add    %edx,%eax
+ 168:	0f b6 00             	movzbl (%eax),%eax
+ 16b:	84 c0                	test   %al,%al
+ 16d:	75 ed                	jne    15c <strlen+0xf>
+    ;
+  return n;
+ 16f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 172:	c9                   	leave
+ 173:	c3                   	ret
+
+00000174 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 174:	55                   	push   %ebp
+ 175:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 177:	8b 45 10             	mov    0x10(%ebp),%eax
+ 17a:	50                   	push   %eax
+ 17b:	ff 75 0c             	push   0xc(%ebp)
+ 17e:	ff 75 08             	push   0x8(%ebp)
+ 181:	e8 32 ff ff ff       	call   b8 <stosb>
+ 186:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 189:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 18c:	c9                   	leave
+ 18d:	c3                   	ret
+
+0000018e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 18e:	55                   	push   %ebp
+ 18f:	89 e5                	mov    %esp,%ebp
+ 191:	83 ec 04             	sub    $0x4,%esp
+ 194:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 197:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 19a:	eb 14                	jmp    1b0 <strchr+0x22>
+    if(*s == c)
+ 19c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19f:	0f b6 00             	movzbl (%eax),%eax
+ 1a2:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1a5:	75 05                	jne    1ac <strchr+0x1e>
+      return (char*)s;
+ 1a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1aa:	eb 13                	jmp    1bf <strchr+0x31>
+  for(; *s; s++)
+ 1ac:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b3:	0f b6 00             	movzbl (%eax),%eax
+ 1b6:	84 c0                	test   %al,%al
+ 1b8:	75 e2                	jne    19c <strchr+0xe>
+  return 0;
+ 1ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1bf:	c9                   	leave
+ 1c0:	c3                   	ret
+
+000001c1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1c1:	55                   	push   %ebp
+ 1c2:	89 e5                	mov    %esp,%ebp
+ 1c4:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 1c7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1ce:	eb 42                	jmp    212 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	6a 00                	push   $0x0
+ 1db:	e8 78 01 00 00       	call   358 <read>
+ 1e0:	83 c4 10             	add    $0x10,%esp
+ 1e3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1e6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1ea:	7e 33                	jle    21f <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 1ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1f5:	89 c2                	mov    %eax,%edx
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	01 c2                	add    %eax,%edx
+ 1fc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 200:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 202:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 206:	3c 0a                	cmp    $0xa,%al
+ 208:	74 16                	je     220 <gets+0x5f>
+ 20a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 20e:	3c 0d                	cmp    $0xd,%al
+ 210:	74 0e                	je     220 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 212:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 215:	83 c0 01             	add    $0x1,%eax
+ 218:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 21b:	7f b3                	jg     1d0 <gets+0xf>
+ 21d:	eb 01                	jmp    220 <gets+0x5f>
+      break;
+ 21f:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 220:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	01 d0                	add    %edx,%eax
+ 228:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 236:	83 ec 08             	sub    $0x8,%esp
+ 239:	6a 00                	push   $0x0
+ 23b:	ff 75 08             	push   0x8(%ebp)
+ 23e:	e8 3d 01 00 00       	call   380 <open>
+ 243:	83 c4 10             	add    $0x10,%esp
+ 246:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 249:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 24d:	79 07                	jns    256 <stat+0x26>
+    return -1;
+ 24f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 254:	eb 25                	jmp    27b <stat+0x4b>
+  r = fstat(fd, st);
+ 256:	83 ec 08             	sub    $0x8,%esp
+ 259:	ff 75 0c             	push   0xc(%ebp)
+ 25c:	ff 75 f4             	push   -0xc(%ebp)
+ 25f:	e8 34 01 00 00       	call   398 <fstat>
+ 264:	83 c4 10             	add    $0x10,%esp
+ 267:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 26a:	83 ec 0c             	sub    $0xc,%esp
+ 26d:	ff 75 f4             	push   -0xc(%ebp)
+ 270:	e8 f3 00 00 00       	call   368 <close>
+ 275:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 278:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+
+0000027d <atoi>:
+
+int
+atoi(const char *s)
+{
+ 27d:	55                   	push   %ebp
+ 27e:	89 e5                	mov    %esp,%ebp
+ 280:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 283:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 28a:	eb 25                	jmp    2b1 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 28c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 28f:	89 d0                	mov    %edx,%eax
+ 291:	c1 e0 02             	shl    $0x2,%eax
+ 294:	01 d0                	add    %edx,%eax
+ 296:	01 c0                	add    %eax,%eax
+ 298:	89 c1                	mov    %eax,%ecx
+ 29a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29d:	8d 50 01             	lea    0x1(%eax),%edx
+ 2a0:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2a3:	0f b6 00             	movzbl (%eax),%eax
+ 2a6:	0f be c0             	movsbl %al,%eax
+ 2a9:	01 c8                	add    %ecx,%eax
+ 2ab:	83 e8 30             	sub    $0x30,%eax
+ 2ae:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b4:	0f b6 00             	movzbl (%eax),%eax
+ 2b7:	3c 2f                	cmp    $0x2f,%al
+ 2b9:	7e 0a                	jle    2c5 <atoi+0x48>
+ 2bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2be:	0f b6 00             	movzbl (%eax),%eax
+ 2c1:	3c 39                	cmp    $0x39,%al
+ 2c3:	7e c7                	jle    28c <atoi+0xf>
+  return n;
+ 2c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2dc:	eb 17                	jmp    2f5 <memmove+0x2b>
+    *dst++ = *src++;
+ 2de:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2e1:	8d 42 01             	lea    0x1(%edx),%eax
+ 2e4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2ea:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2ed:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2f0:	0f b6 12             	movzbl (%edx),%edx
+ 2f3:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2fb:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7f dc                	jg     2de <memmove+0x14>
+  return vdst;
+ 302:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 305:	c9                   	leave
+ 306:	c3                   	ret
+
+00000307 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 307:	55                   	push   %ebp
+ 308:	89 e5                	mov    %esp,%ebp
+ 30a:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 30d:	83 ec 0c             	sub    $0xc,%esp
+ 310:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 313:	50                   	push   %eax
+ 314:	e8 ff 00 00 00       	call   418 <nanouptime>
+ 319:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 31c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 31f:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 328:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 32d:	f7 e2                	mul    %edx
+ 32f:	89 d0                	mov    %edx,%eax
+ 331:	c1 e8 06             	shr    $0x6,%eax
+ 334:	01 c8                	add    %ecx,%eax
+}
+ 336:	c9                   	leave
+ 337:	c3                   	ret
+
+00000338 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 338:	b8 01 00 00 00       	mov    $0x1,%eax
+ 33d:	cd 40                	int    $0x40
+ 33f:	c3                   	ret
+
+00000340 <exit>:
+SYSCALL(exit)
+ 340:	b8 02 00 00 00       	mov    $0x2,%eax
+ 345:	cd 40                	int    $0x40
+ 347:	c3                   	ret
+
+00000348 <wait>:
+SYSCALL(wait)
+ 348:	b8 03 00 00 00       	mov    $0x3,%eax
+ 34d:	cd 40                	int    $0x40
+ 34f:	c3                   	ret
+
+00000350 <pipe>:
+SYSCALL(pipe)
+ 350:	b8 04 00 00 00       	mov    $0x4,%eax
+ 355:	cd 40                	int    $0x40
+ 357:	c3                   	ret
+
+00000358 <read>:
+SYSCALL(read)
+ 358:	b8 05 00 00 00       	mov    $0x5,%eax
+ 35d:	cd 40                	int    $0x40
+ 35f:	c3                   	ret
+
+00000360 <write>:
+SYSCALL(write)
+ 360:	b8 10 00 00 00       	mov    $0x10,%eax
+ 365:	cd 40                	int    $0x40
+ 367:	c3                   	ret
+
+00000368 <close>:
+SYSCALL(close)
+ 368:	b8 15 00 00 00       	mov    $0x15,%eax
+ 36d:	cd 40                	int    $0x40
+ 36f:	c3                   	ret
+
+00000370 <kill>:
+SYSCALL(kill)
+ 370:	b8 06 00 00 00       	mov    $0x6,%eax
+ 375:	cd 40                	int    $0x40
+ 377:	c3                   	ret
+
+00000378 <exec>:
+SYSCALL(exec)
+ 378:	b8 07 00 00 00       	mov    $0x7,%eax
+ 37d:	cd 40                	int    $0x40
+ 37f:	c3                   	ret
+
+00000380 <open>:
+SYSCALL(open)
+ 380:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 385:	cd 40                	int    $0x40
+ 387:	c3                   	ret
+
+00000388 <mknod>:
+SYSCALL(mknod)
+ 388:	b8 11 00 00 00       	mov    $0x11,%eax
+ 38d:	cd 40                	int    $0x40
+ 38f:	c3                   	ret
+
+00000390 <unlink>:
+SYSCALL(unlink)
+ 390:	b8 12 00 00 00       	mov    $0x12,%eax
+ 395:	cd 40                	int    $0x40
+ 397:	c3                   	ret
+
+00000398 <fstat>:
+SYSCALL(fstat)
+ 398:	b8 08 00 00 00       	mov    $0x8,%eax
+ 39d:	cd 40                	int    $0x40
+ 39f:	c3                   	ret
+
+000003a0 <link>:
+SYSCALL(link)
+ 3a0:	b8 13 00 00 00       	mov    $0x13,%eax
+ 3a5:	cd 40                	int    $0x40
+ 3a7:	c3                   	ret
+
+000003a8 <mkdir>:
+SYSCALL(mkdir)
+ 3a8:	b8 14 00 00 00       	mov    $0x14,%eax
+ 3ad:	cd 40                	int    $0x40
+ 3af:	c3                   	ret
+
+000003b0 <chdir>:
+SYSCALL(chdir)
+ 3b0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 3b5:	cd 40                	int    $0x40
+ 3b7:	c3                   	ret
+
+000003b8 <dup>:
+SYSCALL(dup)
+ 3b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3bd:	cd 40                	int    $0x40
+ 3bf:	c3                   	ret
+
+000003c0 <getpid>:
+SYSCALL(getpid)
+ 3c0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3c5:	cd 40                	int    $0x40
+ 3c7:	c3                   	ret
+
+000003c8 <sbrk>:
+SYSCALL(sbrk)
+ 3c8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3cd:	cd 40                	int    $0x40
+ 3cf:	c3                   	ret
+
+000003d0 <sleep>:
+SYSCALL(sleep)
+ 3d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3d5:	cd 40                	int    $0x40
+ 3d7:	c3                   	ret
+
+000003d8 <uptime>:
+SYSCALL(uptime)
+ 3d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3dd:	cd 40                	int    $0x40
+ 3df:	c3                   	ret
+
+000003e0 <saveProc>:
+SYSCALL(saveProc)
+ 3e0:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3e5:	cd 40                	int    $0x40
+ 3e7:	c3                   	ret
+
+000003e8 <loadProc>:
+SYSCALL(loadProc)
+ 3e8:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3ed:	cd 40                	int    $0x40
+ 3ef:	c3                   	ret
+
+000003f0 <setpriority>:
+SYSCALL(setpriority)
+ 3f0:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3f5:	cd 40                	int    $0x40
+ 3f7:	c3                   	ret
+
+000003f8 <setaffinity>:
+SYSCALL(setaffinity)
+ 3f8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3fd:	cd 40                	int    $0x40
+ 3ff:	c3                   	ret
+
+00000400 <getaffinity>:
+SYSCALL(getaffinity)
+ 400:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 405:	cd 40                	int    $0x40
+ 407:	c3                   	ret
+
+00000408 <nanosleep>:
+SYSCALL(nanosleep)
+ 408:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 40d:	cd 40                	int    $0x40
+ 40f:	c3                   	ret
+
+00000410 <cpustat>:
+SYSCALL(cpustat)
+ 410:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 415:	cd 40                	int    $0x40
+ 417:	c3                   	ret
+
+00000418 <nanouptime>:
+SYSCALL(nanouptime)
+ 418:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 41d:	cd 40                	int    $0x40
+ 41f:	c3                   	ret
+
+00000420 <settickets>:
+SYSCALL(settickets)
+ 420:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 425:	cd 40                	int    $0x40
+ 427:	c3                   	ret
+
+00000428 <setdeadline>:
+SYSCALL(setdeadline)
+ 428:	b8 20 00 00 00       	mov    $0x20,%eax
+ 42d:	cd 40                	int    $0x40
+ 42f:	c3                   	ret
+
+00000430 <rtstat>:
+SYSCALL(rtstat)
+ 430:	b8 21 00 00 00       	mov    $0x21,%eax
+ 435:	cd 40                	int    $0x40
+ 437:	c3                   	ret
+
+00000438 <schedstat>:
+SYSCALL(schedstat)
+ 438:	b8 22 00 00 00       	mov    $0x22,%eax
+ 43d:	cd 40                	int    $0x40
+ 43f:	c3                   	ret
+
+00000440 <waitpid>:
+SYSCALL(waitpid)
+ 440:	b8 23 00 00 00       	mov    $0x23,%eax
+ 445:	cd 40                	int    $0x40
+ 447:	c3                   	ret
+
+00000448 <clone>:
+SYSCALL(clone)
+ 448:	b8 24 00 00 00       	mov    $0x24,%eax
+ 44d:	cd 40                	int    $0x40
+ 44f:	c3                   	ret
+
+00000450 <futexwait>:
+SYSCALL(futexwait)
+ 450:	b8 25 00 00 00       	mov    $0x25,%eax
+ 455:	cd 40                	int    $0x40
+ 457:	c3                   	ret
+
+00000458 <futexwake>:
+SYSCALL(futexwake)
+ 458:	b8 26 00 00 00       	mov    $0x26,%eax
+ 45d:	cd 40                	int    $0x40
+ 45f:	c3                   	ret
+
+00000460 <lockstat>:
+SYSCALL(lockstat)
+ 460:	b8 27 00 00 00       	mov    $0x27,%eax
+ 465:	cd 40                	int    $0x40
+ 467:	c3                   	ret
+
+00000468 <dcachestat>:
+SYSCALL(dcachestat)
+ 468:	b8 28 00 00 00       	mov    $0x28,%eax
+ 46d:	cd 40                	int    $0x40
+ 46f:	c3                   	ret
+
+00000470 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 470:	55                   	push   %ebp
+ 471:	89 e5                	mov    %esp,%ebp
+ 473:	83 ec 18             	sub    $0x18,%esp
+ 476:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 479:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 47c:	83 ec 04             	sub    $0x4,%esp
+ 47f:	6a 01                	push   $0x1
+ 481:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 484:	50                   	push   %eax
+ 485:	ff 75 08             	push   0x8(%ebp)
+ 488:	e8 d3 fe ff ff       	call   360 <write>
+ 48d:	83 c4 10             	add    $0x10,%esp
+}
+ 490:	90                   	nop
+ 491:	c9                   	leave
+ 492:	c3                   	ret
+
+00000493 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 493:	55                   	push   %ebp
+ 494:	89 e5                	mov    %esp,%ebp
+ 496:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 499:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 4a0:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 4a4:	74 17                	je     4bd <printint+0x2a>
+ 4a6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 4aa:	79 11                	jns    4bd <printint+0x2a>
+    neg = 1;
+ 4ac:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 4b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b6:	f7 d8                	neg    %eax
+ 4b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4bb:	eb 06                	jmp    4c3 <printint+0x30>
+  } else {
+    x = xx;
+ 4bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4c0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 4c3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 4ca:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4d0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4d5:	f7 f1                	div    %ecx
+ 4d7:	89 d1                	mov    %edx,%ecx
+ 4d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4dc:	8d 50 01             	lea    0x1(%eax),%edx
+ 4df:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4e2:	0f b6 91 3c 09 00 00 	movzbl 0x93c(%ecx),%edx
+ 4e9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 4ed:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4f8:	f7 f1                	div    %ecx
+ 4fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 4fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 501:	75 c7                	jne    4ca <printint+0x37>
+  if(neg)
+ 503:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 507:	74 2d                	je     536 <printint+0xa3>
+    buf[i++] = '-';
+ 509:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 50c:	8d 50 01             	lea    0x1(%eax),%edx
+ 50f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 512:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 517:	eb 1d                	jmp    536 <printint+0xa3>
+    putc(fd, buf[i]);
+ 519:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 51c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 51f:	01 d0                	add    %edx,%eax
+ 521:	0f b6 00             	movzbl (%eax),%eax
+ 524:	0f be c0             	movsbl %al,%eax
+ 527:	83 ec 08             	sub    $0x8,%esp
+ 52a:	50                   	push   %eax
+ 52b:	ff 75 08             	push   0x8(%ebp)
+ 52e:	e8 3d ff ff ff       	call   470 <putc>
+ 533:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 536:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 53a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 53e:	79 d9                	jns    519 <printint+0x86>
+}
+ 540:	90                   	nop
+ 541:	90                   	nop
+ 542:	c9                   	leave
+ 543:	c3                   	ret
+
+00000544 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 544:	55                   	push   %ebp
+ 545:	89 e5                	mov    %esp,%ebp
+ 547:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 54a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 551:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 554:	83 c0 04             	add    $0x4,%eax
+ 557:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 55a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 561:	e9 59 01 00 00       	jmp    6bf <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 566:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 569:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 56c:	01 d0                	add    %edx,%eax
+ 56e:	0f b6 00             	movzbl (%eax),%eax
+ 571:	0f be c0             	movsbl %al,%eax
+ 574:	25 ff 00 00 00       	and    $0xff,%eax
+ 579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 57c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 580:	75 2c                	jne    5ae <printf+0x6a>
+      if(c == '%'){
+ 582:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 586:	75 0c                	jne    594 <printf+0x50>
+        state = '%';
+ 588:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 58f:	e9 27 01 00 00       	jmp    6bb <printf+0x177>
+      } else {
+        putc(fd, c);
+ 594:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 597:	0f be c0             	movsbl %al,%eax
+ 59a:	83 ec 08             	sub    $0x8,%esp
+ 59d:	50                   	push   %eax
+ 59e:	ff 75 08             	push   0x8(%ebp)
+ 5a1:	e8 ca fe ff ff       	call   470 <putc>
+ 5a6:	83 c4 10             	add    $0x10,%esp
+ 5a9:	e9 0d 01 00 00       	jmp    6bb <printf+0x177>
+      }
+    } else if(state == '%'){
+ 5ae:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 5b2:	0f 85 03 01 00 00    	jne    6bb <printf+0x177>
+      if(c == 'd'){
+ 5b8:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 5bc:	75 1e                	jne    5dc <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 5be:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c1:	8b 00                	mov    (%eax),%eax
+ 5c3:	6a 01                	push   $0x1
+ 5c5:	6a 0a                	push   $0xa
+ 5c7:	50                   	push   %eax
+ 5c8:	ff 75 08             	push   0x8(%ebp)
+ 5cb:	e8 c3 fe ff ff       	call   493 <printint>
+ 5d0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5d3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 5d7:	e9 d8 00 00 00       	jmp    6b4 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 5dc:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 5e0:	74 06                	je     5e8 <printf+0xa4>
+ 5e2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 5e6:	75 1e                	jne    606 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 5e8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5eb:	8b 00                	mov    (%eax),%eax
+ 5ed:	6a 00                	push   $0x0
+ 5ef:	6a 10                	push   $0x10
+ 5f1:	50                   	push   %eax
+ 5f2:	ff 75 08             	push   0x8(%ebp)
+ 5f5:	e8 99 fe ff ff       	call   493 <printint>
+ 5fa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 5fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 601:	e9 ae 00 00 00       	jmp    6b4 <printf+0x170>
+      } else if(c == 's'){
+ 606:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 60a:	75 43                	jne    64f <printf+0x10b>
+        s = (char*)*ap;
+ 60c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 60f:	8b 00                	mov    (%eax),%eax
+ 611:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 614:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 618:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 61c:	75 25                	jne    643 <printf+0xff>
+          s = "(null)";
+ 61e:	c7 45 f4 26 07 00 00 	movl   $0x726,-0xc(%ebp)
+        while(*s != 0){
+ 625:	eb 1c                	jmp    643 <printf+0xff>
+          putc(fd, *s);
+ 627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62a:	0f b6 00             	movzbl (%eax),%eax
+ 62d:	0f be c0             	movsbl %al,%eax
+ 630:	83 ec 08             	sub    $0x8,%esp
+ 633:	50                   	push   %eax
+ 634:	ff 75 08             	push   0x8(%ebp)
+ 637:	e8 34 fe ff ff       	call   470 <putc>
+ 63c:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 63f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 646:	0f b6 00             	movzbl (%eax),%eax
+ 649:	84 c0                	test   %al,%al
+ 64b:	75 da                	jne    627 <printf+0xe3>
+ 64d:	eb 65                	jmp    6b4 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 64f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 653:	75 1d                	jne    672 <printf+0x12e>
+        putc(fd, *ap);
+ 655:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 658:	8b 00                	mov    (%eax),%eax
+ 65a:	0f be c0             	movsbl %al,%eax
+ 65d:	83 ec 08             	sub    $0x8,%esp
+ 660:	50                   	push   %eax
+ 661:	ff 75 08             	push   0x8(%ebp)
+ 664:	e8 07 fe ff ff       	call   470 <putc>
+ 669:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 66c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 670:	eb 42                	jmp    6b4 <printf+0x170>
+      } else if(c == '%'){
+ 672:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 676:	75 17                	jne    68f <printf+0x14b>
+        putc(fd, c);
+ 678:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 67b:	0f be c0             	movsbl %al,%eax
+ 67e:	83 ec 08             	sub    $0x8,%esp
+ 681:	50                   	push   %eax
+ 682:	ff 75 08             	push   0x8(%ebp)
+ 685:	e8 e6 fd ff ff       	call   470 <putc>
+ 68a:	83 c4 10             	add    $0x10,%esp
+ 68d:	eb 25                	jmp    6b4 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 68f:	83 ec 08             	sub    $0x8,%esp
+ 692:	6a 25                	push   $0x25
+ 694:	ff 75 08             	push   0x8(%ebp)
+ 697:	e8 d4 fd ff ff       	call   470 <putc>
+ 69c:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 69f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 6a2:	0f be c0             	movsbl %al,%eax
+ 6a5:	83 ec 08             	sub    $0x8,%esp
+ 6a8:	50                   	push   %eax
+ 6a9:	ff 75 08             	push   0x8(%ebp)
+ 6ac:	e8 bf fd ff ff       	call   470 <putc>
+ 6b1:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 6b4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 6bb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 6bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6c2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 6c5:	01 d0                	add    %edx,%eax
+ 6c7:	0f b6 00             	movzbl (%eax),%eax
+ 6ca:	84 c0                	test   %al,%al
+ 6cc:	0f 85 94 fe ff ff    	jne    566 <printf+0x22>
+    }
+  }
+}
+ 6d2:	90                   	nop
+ 6d3:	90                   	nop
+ 6d4:	c9                   	leave
+ 6d5:	c3                   	ret
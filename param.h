@@ -1,8 +1,6 @@
-#define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
 #define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
@@ -10,5 +8,13 @@
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
+#define MAXORDER     10  // largest buddy block is 2^MAXORDER pages (4MB)
+#define NMLFQ         4  // scheduler priority levels (nice values)
+#define MLFQTICKETS 100  // stride-class tickets of the MLFQ as a whole
+#define NSCHEDHIST   20  // buckets in scheduler latency histograms
+#define HZ          100  // scheduler ticks per second
+#define SUBTICK      10  // timer wheel slots per tick
+#define NSPERSUBTICK (1000000000/(HZ*SUBTICK))  // nanoseconds per timer wheel slot
+#define MAXSLEEP     0x40000000  // longest timed sleep, in subticks
 
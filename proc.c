@@ -4,15 +4,135 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
-
+#include "proc.h"
+#include "cpustat.h"
+#include "wait.h"
+
+#define NPIDHASH  64   // buckets in the pid hash table
+#define NPROCFREE 32   // reaped procs kept for reuse
+#define CACHEHOT  2    // ticks after running that a process stays cache-hot
+#define BALANCE   10   // timer interrupts between rebalancing passes
+#define BOOST     100  // ticks between MLFQ priority boosts
+#define NWAITQ    64   // sleep channel hash buckets
+#define QUANTUM(l) (1 << (l))  // ticks a process may run at level l
+#define STRIDE    NMLFQ   // run queue level of the stride class
+#define EDF       (NMLFQ+1)  // level of EDF processes with budget left
+#define THROTTLED (NMLFQ+2)  // level of EDF processes waiting for budget
+#define STRIDE1   (1 << 20)  // stride of a process with one ticket
+#define MAXTICKETS 10000
+#define RTMAX     950   // per mille of each CPU that EDF may reserve
+#define RTMAXPERIOD 10000  // longest EDF period, in ticks
+#define RTUTIL(p) ((p)->rtruntime * 1000 / (p)->rtperiod)
+#define ALLOWED(p, c) (((p)->affinity >> (c)) & 1)  // may p run on CPU c?
+
+// Processes are allocated with kmalloc and linked on
+// ptable.list from allocproc() until they are reaped.
+// pidhash finds a live process by pid; free caches reaped
+// procs, kernel stacks included, for the next allocproc().
+//
+// ptable.lock covers only allocation: the list, the pid hash
+// and the free cache.  Everything else about a process is
+// guarded by its own p->lock and its run queue's lock.  p->lock
+// guards p's list of children, and is held by the calls that
+// name a process by pid (see lockproc()) while they change its
+// settings or kill it.  p->parent only changes while p, its old
+// parent and its new one are all locked, so a process holding
+// its own lock may lock its parent without the parent going
+// away.  exit() holds its parent's lock while it wakes the
+// parent and becomes a zombie, and wait() sleeps holding its
+// own, so a parent checking its children cannot miss the wakeup.
+//
+// Lock order: a vmspace lock; ptable.lock; process locks, a
+// child's before its parent's; rtlock; a wait queue lock; run
+// queue locks in array order.
 struct
 {
     struct spinlock lock;
-    struct proc proc[NPROC];
+    struct proc *list;
+    struct proc *pidhash[NPIDHASH];
+    struct proc *free;
+    int nfree;
 } ptable;
 
+// Per-CPU queue of RUNNABLE processes.  A CPU's scheduler holds
+// its run queue lock across the swtch into a process, and a process
+// holds the lock of the CPU it is running on across the swtch back.
+// The lock also guards p->state and p->chan of every process that
+// belongs to the CPU (see p->cpu); p->cpu itself only changes while
+// that queue's lock is held.
+// A queued process is always allowed to run on its queue's CPU
+// (see p->affinity); a process whose CPU it is no longer allowed
+// on is moved when it next stops running there (see evict()).
+struct runq
+{
+    struct spinlock lock;
+    struct proc *head[NMLFQ+3];  // one FIFO per priority level,
+    struct proc *tail[NMLFQ+3];  // the stride class by pass, and
+                                 // EDF and THROTTLED by deadline
+    int n;                     // number of queued processes
+    uint idleticks;            // ticks taken with no process running
+    uint timerticks;           // ticks seen, for schedclock()
+    uint boostgen;             // last priority boost applied here
+    uint pass;                 // pass of the last stride client run here
+    uint mlfqpass;             // pass of the MLFQ as a stride client
+    int rtutil;                // EDF reservations here, per mille; rtlock
+    uint rtmisses;             // EDF deadlines missed here
+    struct schedstat stat;     // dispatch latency of everything run here
+};
+
+static struct runq runqs[NCPU];
+static struct spinlock rtlock;  // admission control across CPUs
+
+// An address space shared by the threads clone() makes.
+// Each thread keeps its own copy of pgdir and sz; growproc()
+// updates every sharer's sz while holding lock.
+struct vmspace
+{
+    struct spinlock lock;
+    int ref;                   // threads sharing the pgdir; atomic
+};
+
+// Sleeping processes, hashed by channel so that wakeup() only
+// looks at processes that may be waiting on its channel.  A
+// process links itself in on entering sleep() and unlinks itself
+// once it runs again, so a bucket may briefly hold woken processes.
+struct waitq
+{
+    struct spinlock lock;
+    struct proc *head;
+};
+
+static struct waitq waitqs[NWAITQ];
+
+// Multi-level feedback queue.  Level 0 is the highest priority.
+// A process that uses up QUANTUM(level) ticks at its level moves
+// one level down; one that sleeps first keeps its level.  Every
+// BOOST ticks all processes return to the level given by their
+// nice value, so CPU-bound work cannot starve.  boostgen counts
+// boosts; processes and run queues catch up with it lazily.
+//
+// Processes given tickets by settickets() leave the MLFQ for the
+// stride class.  Each tick a stride process runs advances its
+// pass by its stride, STRIDE1 / tickets, and the process with the
+// lowest pass runs next, so CPU time is shared in proportion to
+// tickets.  The MLFQ takes part as a single client holding
+// MLFQTICKETS, with its own pass in rq->mlfqpass, so neither side
+// can starve the other: when the MLFQ's pass is lowest, its
+// highest-priority process runs.  A client joining a queue starts
+// no further behind than that queue's pass.
+//
+// Processes given a reservation by setdeadline() are in the EDF
+// class, which runs ahead of everything else.  Such a process may
+// run for rtruntime ticks in every rtperiod, and among those with
+// budget left the one with the earliest deadline, the end of its
+// current period, runs first.  Once its budget is gone it waits on
+// the THROTTLED level, which does not count as work in rq->n, until
+// its next period begins.  Admission control keeps each CPU's
+// reservations within RTMAX and pins the process to its CPU.
+static uint boostgen;
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -21,42 +141,557 @@ extern void forkret(void);
 
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
+    int i;
+
     initlock(&ptable.lock, "ptable");
+    initlock(&rtlock, "rtlock");
+    for (i = 0; i < NCPU; i++)
+        initlock(&runqs[i].lock, "runq");
+    for (i = 0; i < NWAITQ; i++)
+        initlock(&waitqs[i].lock, "waitq");
+}
+
+// The run queue of the current CPU.
+// Interrupts must be off so that the CPU cannot change.
+static struct runq *
+thisrunq(void)
+{
+    return &runqs[cpu - cpus];
+}
+
+// Lock the current CPU's run queue.
+static struct runq *
+lockthisrunq(void)
+{
+    struct runq *rq;
+
+    pushcli();
+    rq = thisrunq();
+    acquire(&rq->lock);
+    popcli();
+    return rq;
+}
+
+// The wait queue for chan.
+static struct waitq *
+waitq(void *chan)
+{
+    return &waitqs[((uint) chan * 2654435761U) >> 26];
+}
+
+// Lock the run queue that p belongs to.
+static struct runq *
+lockrunq(struct proc *p)
+{
+    struct runq *rq;
+
+    for (; ;)
+    {
+        rq = &runqs[p->cpu];
+        acquire(&rq->lock);
+        if (rq == &runqs[p->cpu])
+            return rq;
+        release(&rq->lock);
+    }
+}
+
+// Return p to its nice level if a priority boost
+// happened since it last checked.
+// The lock of p's run queue must be held.
+static void
+checkboost(struct proc *p)
+{
+    if (p->boostgen != boostgen)
+    {
+        p->boostgen = boostgen;
+        if (p->tickets == 0 && p->rtperiod == 0)
+        {
+            p->level = p->nice;
+            p->slice = 0;
+        }
+    }
+}
+
+// The sort key of p on the stride and EDF levels.
+static uint
+rqkey(struct proc *p)
+{
+    return p->level == STRIDE ? p->pass : p->rtdeadline;
+}
+
+// Append p to the FIFO for its level, or insert it in
+// pass or deadline order on the sorted levels.
+// The rq lock must be held.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+    struct proc *q, *prev;
+    int l;
+
+    l = p->level;
+    if (l >= STRIDE)
+    {
+        if (l == STRIDE && (int) (p->pass - rq->pass) < 0)
+            p->pass = rq->pass;
+        for (prev = 0, q = rq->head[l]; q != 0 && (int) (rqkey(q) - rqkey(p)) <= 0; prev = q, q = q->rqnext)
+            ;
+        p->rqnext = q;
+        if (prev)
+            prev->rqnext = p;
+        else
+            rq->head[l] = p;
+        if (q == 0)
+            rq->tail[l] = p;
+        if (l != THROTTLED)
+            rq->n++;
+        return;
+    }
+    p->rqnext = 0;
+    if (rq->tail[l])
+        rq->tail[l]->rqnext = p;
+    else
+        rq->head[l] = p;
+    rq->tail[l] = p;
+    rq->n++;
+}
+
+// Is an MLFQ process waiting on rq?
+// The rq lock must be held.
+static int
+mlfqwaiting(struct runq *rq)
+{
+    int l;
+
+    for (l = 0; l < STRIDE; l++)
+        if (rq->head[l])
+            return 1;
+    return 0;
+}
+
+// Remove and return the next process to run from rq, or 0.
+// EDF comes first.  Then the stride class and the MLFQ take
+// turns by pass, the MLFQ running its highest non-empty level.
+// The rq lock must be held.
+static struct proc *
+rqpop(struct runq *rq)
+{
+    struct proc *p;
+    int l;
+
+    l = EDF;
+    if (rq->head[EDF] == 0)
+    {
+        for (l = 0; l < STRIDE && rq->head[l] == 0; l++)
+            ;
+        if (l < STRIDE && (int) (rq->mlfqpass - rq->pass) < 0)
+            rq->mlfqpass = rq->pass;
+        if (l < STRIDE && rq->head[STRIDE] &&
+            (int) (rq->head[STRIDE]->pass - rq->mlfqpass) < 0)
+            l = STRIDE;
+    }
+    if ((p = rq->head[l]) == 0)
+        return 0;
+    rq->head[l] = p->rqnext;
+    if (rq->head[l] == 0)
+        rq->tail[l] = 0;
+    rq->n--;
+    if (l == STRIDE)
+        rq->pass = p->pass;
+    else if (l < STRIDE)
+        rq->pass = rq->mlfqpass;
+    return p;
+}
+
+// Unlink p, which follows prev, from rq.
+// The rq lock must be held.
+static void
+rqremove(struct runq *rq, struct proc *p, struct proc *prev)
+{
+    int l;
+
+    l = p->level;
+    if (prev)
+        prev->rqnext = p->rqnext;
+    else
+        rq->head[l] = p->rqnext;
+    if (rq->tail[l] == p)
+        rq->tail[l] = prev;
+    if (l != THROTTLED)
+        rq->n--;
+}
+
+// Unlink p from rq if it is queued there; a runnable p
+// that evict() has taken off rq is not.  Return 1 if it was.
+// The rq lock must be held.
+static int
+rqunlink(struct runq *rq, struct proc *p)
+{
+    struct proc *q, *prev;
+
+    if (p->state != RUNNABLE)
+        return 0;
+    for (prev = 0, q = rq->head[p->level]; q != 0 && q != p; prev = q, q = q->rqnext)
+        ;
+    if (q == 0)
+        return 0;
+    rqremove(rq, p, prev);
+    return 1;
+}
+
+// Choose a process to migrate off rq to CPU thief and unlink
+// it.  Only processes allowed on thief are considered, and
+// never EDF ones, which stay on the CPU that admitted them.  Prefer
+// the first one whose cache has gone cold, starting from the
+// lowest level; take a cache-hot one, the last on the lowest
+// level that has one, only if rq would still have work left.
+// The rq lock must be held.
+static struct proc *
+rqsteal(struct runq *rq, int thief)
+{
+    struct proc *p, *prev, *hot, *hotprev;
+    int l;
+
+    hot = hotprev = 0;
+    for (l = STRIDE; l >= 0; l--)
+        for (prev = 0, p = rq->head[l]; p != 0; prev = p, p = p->rqnext)
+        {
+            if (!ALLOWED(p, thief))
+                continue;
+            if (ticks - p->lastrun >= CACHEHOT)
+                goto found;
+            if (hot == 0 || hot->level == l)
+            {
+                hot = p;
+                hotprev = prev;
+            }
+        }
+    if (hot == 0 || rq->n < 2)
+        return 0;
+    p = hot;
+    prev = hotprev;
+
+    found:
+    rqremove(rq, p, prev);
+    return p;
+}
+
+// If p's EDF deadline has passed, start its next period with a
+// full budget.  If p still wanted the CPU and had budget left,
+// it missed the deadline.
+// The lock of p's run queue rq must be held.
+static void
+edfrefresh(struct runq *rq, struct proc *p, int wanted)
+{
+    if ((int) (ticks - p->rtdeadline) < 0)
+        return;
+    if (wanted && p->rtleft > 0)
+    {
+        p->rtmisses++;
+        rq->rtmisses++;
+    }
+    p->rtperiods++;
+    p->rtdeadline = ticks + p->rtperiod;
+    p->rtleft = p->rtruntime;
+}
+
+// Apply a pending priority boost to every process on rq.
+// The rq lock must be held.
+static void
+rqboost(struct runq *rq)
+{
+    struct proc *p, *next, *head, *tail;
+    uint pass, mlfqpass;
+
+    head = tail = 0;
+    pass = rq->pass;
+    mlfqpass = rq->mlfqpass;
+    while ((p = rqpop(rq)) != 0)
+    {
+        p->rqnext = 0;
+        if (tail)
+            tail->rqnext = p;
+        else
+            head = p;
+        tail = p;
+    }
+    rq->pass = pass;
+    rq->mlfqpass = mlfqpass;
+    for (p = head; p != 0; p = next)
+    {
+        next = p->rqnext;
+        checkboost(p);
+        rqpush(rq, p);
+    }
+    rq->boostgen = boostgen;
+}
+
+// Pull one process onto rq from the longest other run queue,
+// provided that queue holds more than min processes.
+static void
+steal(struct runq *rq, int min)
+{
+    struct runq *victim, *first, *second;
+    struct proc *p;
+    int i;
+
+    victim = 0;
+    for (i = 0; i < ncpu; i++)
+        if (&runqs[i] != rq && runqs[i].n > min &&
+            (victim == 0 || runqs[i].n > victim->n))
+            victim = &runqs[i];
+    if (victim == 0)
+        return;
+
+    first = rq < victim ? rq : victim;
+    second = rq < victim ? victim : rq;
+    acquire(&first->lock);
+    acquire(&second->lock);
+    if ((p = rqsteal(victim, rq - runqs)) != 0)
+    {
+        p->cpu = rq - runqs;
+        rqpush(rq, p);
+    }
+    release(&second->lock);
+    release(&first->lock);
+}
+
+// Called from every CPU's timer interrupt once per tick.
+// CPU 0 starts a priority boost every BOOST ticks and each CPU
+// applies it to its own queue.  Every BALANCE ticks, even out
+// this CPU's run queue against the longest one.
+void
+schedclock(void)
+{
+    struct runq *rq;
+    struct proc *p;
+
+    rq = thisrunq();
+    if (proc == 0)
+        rq->idleticks++;
+    rq->timerticks++;
+    if ((p = rq->head[THROTTLED]) != 0 && (int) (ticks - p->rtdeadline) >= 0)
+    {
+        // Throttled EDF processes whose next period has begun.
+        acquire(&rq->lock);
+        while ((p = rq->head[THROTTLED]) != 0 && (int) (ticks - p->rtdeadline) >= 0)
+        {
+            rqremove(rq, p, 0);
+            edfrefresh(rq, p, 0);
+            p->level = EDF;
+            p->readyat = nanotime();
+            rqpush(rq, p);
+        }
+        release(&rq->lock);
+    }
+    if (rq == &runqs[0] && rq->timerticks % BOOST == 0)
+        boostgen++;
+    if (rq->boostgen != boostgen)
+    {
+        acquire(&rq->lock);
+        rqboost(rq);
+        release(&rq->lock);
+    }
+    if (rq->timerticks % BALANCE == 0)
+        steal(rq, rq->n + 1);
+}
+
+// Mark p RUNNABLE and queue it, rousing rq's CPU if it is
+// halted.  An EDF process goes on the EDF level if it has
+// budget left, else on THROTTLED.
+// The lock of p's run queue rq must be held.
+static void
+makerunnable(struct runq *rq, struct proc *p)
+{
+    struct cpu *c;
+
+    if (p->rtperiod)
+    {
+        edfrefresh(rq, p, p->state == RUNNING);
+        p->level = p->rtleft > 0 ? EDF : THROTTLED;
+    }
+    p->state = RUNNABLE;
+    p->readyat = nanotime();
+    checkboost(p);
+    rqpush(rq, p);
+    c = &cpus[rq - runqs];
+    __sync_synchronize();
+    if (c->idle && c != cpu)
+        lapicipi(c->id, T_IRQ0 + IRQ_RESCHED);
+}
+
+// The CPU that p is allowed on with the shortest run queue.
+static int
+pickcpu(struct proc *p)
+{
+    int i, best;
+
+    best = -1;
+    for (i = 0; i < ncpu; i++)
+        if (ALLOWED(p, i) && (best < 0 || runqs[i].n < runqs[best].n))
+            best = i;
+    return best;
+}
+
+// Make a new process runnable on the allowed CPU with
+// the shortest run queue.
+static void
+startproc(struct proc *p)
+{
+    struct runq *rq;
+
+    p->cpu = pickcpu(p);
+    rq = lockrunq(p);
+    makerunnable(rq, p);
+    release(&rq->lock);
+}
+
+// p is not running and its affinity no longer allows the CPU
+// of rq, its run queue.  Point p at an allowed CPU: a sleeping
+// p will be woken there, while a runnable one is unlinked from
+// rq and returned, and the caller must requeue() it after
+// releasing rq's lock.  Until then p is on no run queue.
+// The rq lock must be held.
+static struct proc *
+evict(struct runq *rq, struct proc *p)
+{
+    if (p->state == ZOMBIE)
+        return 0;
+    p->cpu = pickcpu(p);
+    if (!rqunlink(rq, p))
+        return 0;
+    return p;
+}
+
+// Queue p, which evict() took off its old run queue.
+static void
+requeue(struct proc *p)
+{
+    struct runq *rq;
+
+    rq = lockrunq(p);
+    rqpush(rq, p);
+    release(&rq->lock);
+}
+
+// Look up a live process by pid; pids come from user
+// space, so any value may arrive.
+// The ptable lock must be held.
+static struct proc *
+findproc(int pid)
+{
+    struct proc *p;
+
+    if (pid <= 0)
+        return 0;
+    for (p = ptable.pidhash[pid % NPIDHASH]; p != 0; p = p->hashnext)
+        if (p->pid == pid)
+            return p;
+    return 0;
+}
+
+// Look up a live process by pid and return it with its
+// lock held, or 0 if there is none.
+static struct proc *
+lockproc(int pid)
+{
+    struct proc *p;
+
+    acquire(&ptable.lock);
+    if ((p = findproc(pid)) != 0)
+        acquire(&p->lock);
+    release(&ptable.lock);
+    return p;
+}
+
+// Unlink p from the process table and pid hash, then
+// keep it on the free list or give it back to kmalloc.
+// The ptable lock must be held.
+static void
+freeproc(struct proc *p)
+{
+    struct proc **pp;
+
+    if (p->prev)
+        p->prev->next = p->next;
+    else
+        ptable.list = p->next;
+    if (p->next)
+        p->next->prev = p->prev;
+    for (pp = &ptable.pidhash[p->pid % NPIDHASH]; *pp != p; pp = &(*pp)->hashnext)
+        ;
+    *pp = p->hashnext;
+
+    // Wait out any lockproc() that found p before it was unhashed.
+    acquire(&p->lock);
+    release(&p->lock);
+
+    if (p->rtperiod)
+    {
+        acquire(&rtlock);
+        runqs[p->rtcpu].rtutil -= RTUTIL(p);
+        release(&rtlock);
+    }
+    p->state = UNUSED;
+    if (p->kstack && ptable.nfree < NPROCFREE)
+    {
+        p->next = ptable.free;
+        ptable.free = p;
+        ptable.nfree++;
+        return;
+    }
+    if (p->kstack)
+        kfree(p->kstack);
+    kmfree(p);
 }
 
 //PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
+// Allocate a new proc, reusing a reaped one if possible,
+// and add it to the process table.
+// If successful, change state to EMBRYO and initialize
 // state required to run in the kernel.
 // Otherwise return 0.
 static struct proc *
 allocproc(void)
 {
     struct proc *p;
-    char *sp;
+    char *kstack, *sp;
 
     cprintf("allocproc here!!!\n");
     acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if (p->state == UNUSED)
-            goto found;
-    release(&ptable.lock);
-    return 0;
-
-    found:
+    kstack = 0;
+    if ((p = ptable.free) != 0)
+    {
+        ptable.free = p->next;
+        ptable.nfree--;
+        kstack = p->kstack;
+    } else if ((p = kmalloc(sizeof(*p))) == 0)
+    {
+        release(&ptable.lock);
+        return 0;
+    }
+    memset(p, 0, sizeof(*p));
+    initlock(&p->lock, "proc");
+    p->kstack = kstack;
     p->state = EMBRYO;
     p->pid = nextpid++;
+    p->affinity = ~0;
+    p->next = ptable.list;
+    if (p->next)
+        p->next->prev = p;
+    ptable.list = p;
+    p->hashnext = ptable.pidhash[p->pid % NPIDHASH];
+    ptable.pidhash[p->pid % NPIDHASH] = p;
     release(&ptable.lock);
 
     // Allocate kernel stack.
-    if ((p->kstack = kalloc()) == 0)
+    if (p->kstack == 0 && (p->kstack = kalloc()) == 0)
     {
-        p->state = UNUSED;
+        acquire(&ptable.lock);
+        freeproc(p);
+        release(&ptable.lock);
         return 0;
     }
     sp = p->kstack + KSTACKSIZE;
@@ -88,7 +723,7 @@ userinit(void)
 
     p = allocproc();
     initproc = p;
-    if ((p->pgdir = setupkvm()) == 0)
+    if ((p->pgdir = setupkvm()) == 0 || (p->files = fdtablealloc()) == 0)
         panic("userinit: out of memory?");
     inituvm(p->pgdir, _binary_initcode_start, (int) _binary_initcode_size);
     p->sz = PGSIZE;
@@ -104,72 +739,145 @@ userinit(void)
     safestrcpy(p->name, "initcode", sizeof(p->name));
     p->cwd = namei("/");
 
-    p->state = RUNNABLE;
+    startproc(p);
 }
 
 // Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Return the old size, or -1 on failure.
+// An address space shared with other threads cannot shrink:
+// they may be running on other CPUs, whose TLBs would still
+// map the freed frames.
 int
 growproc(int n)
 {
-    uint sz;
+    struct vmspace *vm;
+    struct proc *p;
+    uint sz, oldsz;
 
-    sz = proc->sz;
-    if (n > 0)
+    if ((vm = proc->vm) != 0)
     {
-        if ((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
+        acquire(&vm->lock);
+        if (n < 0 && vm->ref > 1)
+        {
+            release(&vm->lock);
             return -1;
-    } else if (n < 0)
+        }
+    }
+    sz = oldsz = proc->sz;
+    if (n > 0)
+        sz = allocuvm(proc->pgdir, sz, sz + n);
+    else if (n < 0)
+        sz = deallocuvm(proc->pgdir, sz, sz + n);
+    if (sz == 0)
     {
-        if ((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
-            return -1;
+        if (vm)
+            release(&vm->lock);
+        return -1;
+    }
+    if (vm)
+    {
+        // Threads sharing the address space see the new size too.
+        acquire(&ptable.lock);
+        for (p = ptable.list; p != 0; p = p->next)
+            if (p->vm == vm)
+                p->sz = sz;
+        release(&ptable.lock);
+        release(&vm->lock);
     }
     proc->sz = sz;
     switchuvm(proc);
-    return 0;
+    return oldsz;
 }
 
-void myExit(struct proc* t_proc)
+// Drop a reference to address space pgdir, shared through vm
+// if that is non-zero, and free it with the last reference.
+void
+putvm(pde_t *pgdir, struct vmspace *vm)
 {
-    struct proc *p;
-    int fd;
+    if (vm)
+    {
+        if (__sync_sub_and_fetch(&vm->ref, 1) > 0)
+            return;
+        kmfree(vm);
+    }
+    freevm(pgdir);
+}
+
+// Make p a child of parent.
+static void
+adopt(struct proc *parent, struct proc *p)
+{
+    acquire(&p->lock);
+    acquire(&parent->lock);
+    p->parent = parent;
+    p->sibling = parent->children;
+    parent->children = p;
+    release(&parent->lock);
+    release(&p->lock);
+}
+
+// Hand the children of exiting process p to init.  Each child
+// must be locked ahead of p, so the list is read unlocked; only
+// p itself adds or removes its children, and it is exiting.
+static void
+reparent(struct proc *p)
+{
+    struct proc *c;
+
+    while ((c = p->children) != 0)
+    {
+        acquire(&c->lock);
+        acquire(&p->lock);
+        acquire(&initproc->lock);
+        p->children = c->sibling;
+        c->parent = initproc;
+        c->sibling = initproc->children;
+        initproc->children = c;
+        if (c->state == ZOMBIE)
+            wakeup(initproc);
+        release(&initproc->lock);
+        release(&p->lock);
+        release(&c->lock);
+    }
+}
 
+// Wake p's parent, which might be sleeping in wait(), and
+// make p a zombie.  Returns with p's run queue lock held,
+// ready for sched().
+static void
+zombify(struct proc *p)
+{
+    struct proc *parent;
+
+    acquire(&p->lock);
+    parent = p->parent;
+    acquire(&parent->lock);
+    wakeup(parent);
+    acquire(&thisrunq()->lock);
+    p->state = ZOMBIE;
+    release(&parent->lock);
+    release(&p->lock);
+}
+
+void myExit(struct proc* t_proc)
+{
     if (t_proc == initproc)
         panic("init exiting");
 
     // Close all open files.
-    for (fd = 0; fd < NOFILE; fd++)
-    {
-        if (t_proc->ofile[fd])
-        {
-            fileclose(t_proc->ofile[fd]);
-            t_proc->ofile[fd] = 0;
-        }
-    }
+    fdtableput(t_proc->files);
+    t_proc->files = 0;
 
     begin_op();
     iput(t_proc->cwd);
     end_op();
     t_proc->cwd = 0;
 
-    acquire(&ptable.lock);
-
-    // Parent might be sleeping in wait().
-    wakeup1(t_proc->parent);
-
     // Pass abandoned children to init.
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    {
-        if (p->parent == t_proc)
-        {
-            p->parent = initproc;
-            if (p->state == ZOMBIE)
-                wakeup1(initproc);
-        }
-    }
+    reparent(t_proc);
 
     // Jump into the scheduler, never to return.
-    t_proc->state = ZOMBIE;
+    zombify(t_proc);
     sched();
     panic("zombie exit");
 }
@@ -190,9 +898,9 @@ myFork(struct file *page_file, struct file *flag_file, struct proc *savedProc)
     if ((np->pgdir = my_copyuvm(page_file, flag_file, savedProc->sz)) == 0)
     {
         cprintf("khar!\n");
-        kfree(np->kstack);
-        np->kstack = 0;
-        np->state = UNUSED;
+        acquire(&ptable.lock);
+        freeproc(np);
+        release(&ptable.lock);
         return -1;
     }
 
@@ -200,14 +908,17 @@ myFork(struct file *page_file, struct file *flag_file, struct proc *savedProc)
     np->context->eip = (uint) forkret;
     *np->tf = *savedProc->tf;
     np->sz = savedProc->sz;
-    np->parent = proc;
     // Clear %eax so that fork returns 0 in the child.
     np->tf->eax = 0;
 
-    int i = 0;
-    for (i = 0; i < NOFILE; i++)
-        if (savedProc->ofile[i])
-            np->ofile[i] = 0;
+    if ((np->files = fdtablealloc()) == 0)
+    {
+        freevm(np->pgdir);
+        acquire(&ptable.lock);
+        freeproc(np);
+        release(&ptable.lock);
+        return -1;
+    }
     if ((np->cwd = namei("counter")) == 0)
         return -1;
 
@@ -215,21 +926,40 @@ myFork(struct file *page_file, struct file *flag_file, struct proc *savedProc)
 
     pid = np->pid;
 
-    // lock to force the compiler to emit the np->state write last.
-    acquire(&ptable.lock);
-    np->state = RUNNABLE;
-    release(&ptable.lock);
+    adopt(proc, np);
+
+    startproc(np);
 
     return pid;
 }
 
+// Give new process np the current process's scheduling
+// settings, directory and name, and make it a child of the
+// current process.
+static void
+inherit(struct proc *np)
+{
+    np->nice = np->level = proc->nice;
+    np->tickets = proc->tickets;
+    np->stride = proc->stride;
+    np->pass = proc->pass;
+    if (np->tickets)
+        np->level = STRIDE;
+    np->affinity = proc->affinity;
+    np->cwd = idup(proc->cwd);
+
+    safestrcpy(np->name, proc->name, sizeof(proc->name));
+
+    adopt(proc, np);
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
 int
 fork(void)
 {
-    int i, pid;
+    int pid;
     struct proc *np;
 
     cprintf("fork here!!!\n");
@@ -237,36 +967,83 @@ fork(void)
     if ((np = allocproc()) == 0)
         return -1;
 
-    // Copy process state from p.
-    if ((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0)
+    // Copy process state from p.  Another thread sharing our
+    // address space must not resize it meanwhile.
+    if (proc->vm)
+        acquire(&proc->vm->lock);
+    np->sz = proc->sz;
+    np->pgdir = copyuvm(proc->pgdir, np->sz);
+    if (proc->vm)
+        release(&proc->vm->lock);
+    if (np->pgdir == 0)
     {
-        kfree(np->kstack);
-        np->kstack = 0;
-        np->state = UNUSED;
+        acquire(&ptable.lock);
+        freeproc(np);
+        release(&ptable.lock);
+        return -1;
+    }
+    if ((np->files = fdtablecopy(proc->files)) == 0)
+    {
+        freevm(np->pgdir);
+        acquire(&ptable.lock);
+        freeproc(np);
+        release(&ptable.lock);
         return -1;
     }
-    np->sz = proc->sz;
-    np->parent = proc;
     *np->tf = *proc->tf;
 
     // Clear %eax so that fork returns 0 in the child.
     np->tf->eax = 0;
 
-    for (i = 0; i < NOFILE; i++)
-        if (proc->ofile[i])
-            np->ofile[i] = filedup(proc->ofile[i]);
-    np->cwd = idup(proc->cwd);
+    inherit(np);
+    pid = np->pid;
+    startproc(np);
 
-    safestrcpy(np->name, proc->name, sizeof(proc->name));
+    return pid;
+}
 
-    pid = np->pid;
+// Create a thread that runs fn(arg) in the caller's address
+// space and with its file descriptor table, on the page of user
+// stack at stack.  Like a forked child, it is reaped with wait().
+// Return its pid, or -1.
+int
+clone(uint fn, uint arg, uint stack)
+{
+    struct vmspace *vm;
+    struct proc *np;
+    uint sp, ustack[2];
 
-    // lock to force the compiler to emit the np->state write last.
-    acquire(&ptable.lock);
-    np->state = RUNNABLE;
-    release(&ptable.lock);
+    // Fake return PC, then the argument.
+    ustack[0] = 0xffffffff;
+    ustack[1] = arg;
+    sp = stack + PGSIZE - sizeof(ustack);
+    if (copyout(proc->pgdir, sp, ustack, sizeof(ustack)) < 0)
+        return -1;
 
-    return pid;
+    if ((vm = proc->vm) == 0)
+    {
+        if ((vm = kmalloc(sizeof(*vm))) == 0)
+            return -1;
+        initlock(&vm->lock, "vmspace");
+        vm->ref = 1;
+        proc->vm = vm;
+    }
+    if ((np = allocproc()) == 0)
+        return -1;
+    __sync_fetch_and_add(&vm->ref, 1);
+    np->pgdir = proc->pgdir;
+    acquire(&vm->lock);
+    np->vm = vm;
+    np->sz = proc->sz;
+    release(&vm->lock);
+    *np->tf = *proc->tf;
+    np->tf->eip = fn;
+    np->tf->esp = sp;
+    np->files = fdtabledup(proc->files);
+
+    inherit(np);
+    startproc(np);
+    return np->pid;
 }
 
 // Exit the current process.  Does not return.
@@ -275,45 +1052,25 @@ fork(void)
 void
 exit(void)
 {
-    struct proc *p;
-    int fd;
-
     if (proc == initproc)
         panic("init exiting");
 
-    // Close all open files.
-    for (fd = 0; fd < NOFILE; fd++)
-    {
-        if (proc->ofile[fd])
-        {
-            fileclose(proc->ofile[fd]);
-            proc->ofile[fd] = 0;
-        }
-    }
+    // Close all open files, unless other threads share them.
+    fdtableput(proc->files);
+    proc->files = 0;
 
     begin_op();
     iput(proc->cwd);
     end_op();
     proc->cwd = 0;
 
-    acquire(&ptable.lock);
-
-    // Parent might be sleeping in wait().
-    wakeup1(proc->parent);
-
     // Pass abandoned children to init.
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    {
-        if (p->parent == proc)
-        {
-            p->parent = initproc;
-            if (p->state == ZOMBIE)
-                wakeup1(initproc);
-        }
-    }
+    reparent(proc);
 
     // Jump into the scheduler, never to return.
-    proc->state = ZOMBIE;
+    // Our run queue lock stays held until the scheduler is
+    // off this kernel stack; wait() relies on that.
+    zombify(proc);
     sched();
     panic("zombie exit");
 }
@@ -323,31 +1080,42 @@ exit(void)
 int
 wait(void)
 {
-    struct proc *p;
-    int havekids, pid;
+    return waitpid(-1, 0);
+}
 
-    acquire(&ptable.lock);
+// Wait for child pid to exit, or any child if pid is -1,
+// and return its pid.  With WNOHANG, return 0 at once if
+// no such child has exited yet.  Return -1 if there is no
+// such child.
+int
+waitpid(int pid, int options)
+{
+    struct runq *rq;
+    struct proc *p, **pp;
+    int havekids;
+
+    acquire(&proc->lock);
     for (; ;)
     {
-        // Scan through table looking for zombie children.
+        // Look through our children for a zombie.
         havekids = 0;
-        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+        for (pp = &proc->children; (p = *pp) != 0; pp = &p->sibling)
         {
-            if (p->parent != proc)
+            if (pid != -1 && p->pid != pid)
                 continue;
             havekids = 1;
             if (p->state == ZOMBIE)
             {
-                // Found one.
+                // Found one.  Make sure it has left the CPU
+                // before freeing its kernel stack.
+                rq = lockrunq(p);
+                release(&rq->lock);
+                *pp = p->sibling;
+                release(&proc->lock);
                 pid = p->pid;
-                kfree(p->kstack);
-                p->kstack = 0;
-                freevm(p->pgdir);
-                p->state = UNUSED;
-                p->pid = 0;
-                p->parent = 0;
-                p->name[0] = 0;
-                p->killed = 0;
+                putvm(p->pgdir, p->vm);
+                acquire(&ptable.lock);
+                freeproc(p);
                 release(&ptable.lock);
                 return pid;
             }
@@ -356,12 +1124,80 @@ wait(void)
         // No point waiting if we don't have any children.
         if (!havekids || proc->killed)
         {
-            release(&ptable.lock);
+            release(&proc->lock);
             return -1;
         }
+        if (options & WNOHANG)
+        {
+            release(&proc->lock);
+            return 0;
+        }
+
+        // Wait for children to exit.  (See wakeup call in zombify.)
+        sleep(proc, &proc->lock);  //DOC: wait-sleep
+    }
+}
+
+// Halt this CPU until an interrupt arrives, unless rq has
+// gained work.  A CPU that queues work here sees cpu->idle
+// and sends an IPI; the store to idle and the check of rq->n
+// are ordered so that either we see the work or it sees us.
+static void
+idle(struct runq *rq)
+{
+    cli();
+    cpu->idle = 1;
+    __sync_synchronize();
+    if (rq->n == 0)
+        stihlt();
+    cpu->idle = 0;
+    sti();
+}
+
+// Add a sample of ns nanoseconds to log2 histogram hist
+// and to the microsecond total *us.
+static void
+histadd(uint *hist, uint *us, uint64 ns)
+{
+    uint t;
+    int b;
+
+    t = (ns >> 32) ? 0xFFFFFFFF / 1000 : (uint) ns / 1000;
+    *us += t;
+    for (b = 0; t != 0 && b < NSCHEDHIST - 1; b++)
+        t >>= 1;
+    hist[b]++;
+}
+
+// Record how long p waited on rq before being dispatched.
+// Caller holds rq->lock.
+static void
+dispatched(struct runq *rq, struct proc *p)
+{
+    p->runat = nanotime();
+    histadd(rq->stat.delay, &rq->stat.delayus, p->runat - p->readyat);
+    histadd(p->delayhist, &p->delayus, p->runat - p->readyat);
+}
+
+// Record how long p ran, and why it stopped.
+// Caller holds rq->lock.
+static void
+descheduled(struct runq *rq, struct proc *p)
+{
+    uint64 ns;
 
-        // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-        sleep(proc, &ptable.lock);  //DOC: wait-sleep
+    ns = nanotime() - p->runat;
+    histadd(rq->stat.slice, &rq->stat.runus, ns);
+    histadd(p->slicehist, &p->runus, ns);
+    if (p->state == RUNNABLE)
+    {
+        rq->stat.nivcsw++;
+        p->nivcsw++;
+    }
+    else
+    {
+        rq->stat.nvcsw++;
+        p->nvcsw++;
     }
 }
 
@@ -376,47 +1212,66 @@ wait(void)
 void
 scheduler(void)
 {
-    struct proc *p;
+    struct runq *rq;
+    struct proc *p, *moved;
 
+    rq = thisrunq();
     for (; ;)
     {
         // Enable interrupts on this processor.
         sti();
 
-        // Loop over process table looking for process to run.
-        acquire(&ptable.lock);
-        for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+        // Take the next process off this CPU's run queue,
+        // stealing one from a busier CPU if ours is empty.
+        if (rq->n == 0)
+            steal(rq, 0);
+        moved = 0;
+        acquire(&rq->lock);
+        if ((p = rqpop(rq)) != 0)
         {
-            if (p->state != RUNNABLE)
-                continue;
-
             // Switch to chosen process.  It is the process's job
-            // to release ptable.lock and then reacquire it
+            // to release the run queue lock and then reacquire it
             // before jumping back to us.
+            if (p->rtperiod)
+                edfrefresh(rq, p, 1);
+            dispatched(rq, p);
             proc = p;
             switchuvm(p);
             p->state = RUNNING;
+            p->lastrun = ticks;
             swtch(&cpu->scheduler, proc->context);
             switchkvm();
 
             // Process is done running for now.
             // It should have changed its p->state before coming back.
             proc = 0;
-        }
-        release(&ptable.lock);
+            descheduled(rq, p);
 
+            // Move it off this CPU if setaffinity() took the CPU
+            // out of its mask while it ran.
+            if (!ALLOWED(p, rq - runqs))
+                moved = evict(rq, p);
+        }
+        release(&rq->lock);
+        if (moved)
+            requeue(moved);
+
+        // Nothing to run: spend the time zeroing pages
+        // for kalloc_zeroed(), or halt if there are none.
+        if (p == 0 && kzerofill() == 0)
+            idle(rq);
     }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
-// and have changed proc->state.
+// Enter scheduler.  Must hold only the current CPU's run
+// queue lock and have changed proc->state.
 void
 sched(void)
 {
     int intena;
 
-    if (!holding(&ptable.lock))
-        panic("sched ptable.lock");
+    if (!holding(&thisrunq()->lock))
+        panic("sched runq lock");
     if (cpu->ncli != 1)
         panic("sched locks");
     if (proc->state == RUNNING)
@@ -428,14 +1283,73 @@ sched(void)
     cpu->intena = intena;
 }
 
+// Charge a timer tick to the running process.  Return 1 if it
+// should yield: either it used up its quantum, which also moves
+// it one level down, or a higher-priority process is waiting.
+// A stride process yields once another client, the MLFQ included,
+// has a lower pass, and an EDF process when its budget runs out.
+// Ticks run by MLFQ processes advance the MLFQ's pass.
+int
+timeslice(void)
+{
+    struct runq *rq;
+    int l, expired;
+
+    rq = lockthisrunq();
+    checkboost(proc);
+    expired = 0;
+    if (proc->rtperiod)
+    {
+        // EDF: charge the budget.  Yield once it is gone or
+        // another EDF process has an earlier deadline.
+        if (proc->rtleft > 0)
+            proc->rtleft--;
+        edfrefresh(rq, proc, 1);
+        if (proc->rtleft == 0 ||
+            (rq->head[EDF] && (int) (rq->head[EDF]->rtdeadline - proc->rtdeadline) < 0))
+            expired = 1;
+        release(&rq->lock);
+        return expired;
+    }
+    if (proc->tickets)
+    {
+        proc->pass += proc->stride;
+        if (rq->head[STRIDE] && (int) (rq->head[STRIDE]->pass - proc->pass) < 0)
+            expired = 1;
+        if (mlfqwaiting(rq) && (int) (rq->mlfqpass - proc->pass) <= 0)
+            expired = 1;
+    } else
+    {
+        rq->mlfqpass += STRIDE1 / MLFQTICKETS;
+        if (++proc->slice >= QUANTUM(proc->level))
+        {
+            expired = 1;
+            proc->slice = 0;
+            if (proc->level < NMLFQ - 1)
+                proc->level++;
+        }
+        for (l = 0; l < proc->level; l++)
+            if (rq->head[l])
+                expired = 1;
+        if (rq->head[STRIDE] && (int) (rq->head[STRIDE]->pass - rq->mlfqpass) < 0)
+            expired = 1;
+    }
+    if (rq->head[EDF])
+        expired = 1;
+    release(&rq->lock);
+    return expired;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-    acquire(&ptable.lock);  //DOC: yieldlock
-    proc->state = RUNNABLE;
+    struct runq *rq;
+
+    rq = lockthisrunq();  //DOC: yieldlock
+    makerunnable(rq, proc);
     sched();
-    release(&ptable.lock);
+    release(&thisrunq()->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -444,8 +1358,8 @@ void
 forkret(void)
 {
     static int first = 1;
-    // Still holding ptable.lock from scheduler.
-    release(&ptable.lock);
+    // Still holding the run queue lock from scheduler.
+    release(&thisrunq()->lock);
 
     if (first)
     {
@@ -465,60 +1379,86 @@ forkret(void)
 void
 sleep(void *chan, struct spinlock *lk)
 {
+    struct waitq *wq;
+    struct proc **pp;
+
     if (proc == 0)
         panic("sleep");
 
     if (lk == 0)
         panic("sleep without lk");
 
-    // Must acquire ptable.lock in order to
-    // change p->state and then call sched.
-    // Once we hold ptable.lock, we can be
-    // guaranteed that we won't miss any wakeup
-    // (wakeup runs with ptable.lock locked),
-    // so it's okay to release lk.
-    if (lk != &ptable.lock)
-    {  //DOC: sleeplock0
-        acquire(&ptable.lock);  //DOC: sleeplock1
-        release(lk);
-    }
-
-    // Go to sleep.
+    wq = waitq(chan);
+    acquire(&wq->lock);
+    proc->waitnext = wq->head;
+    wq->head = proc;
+
+    // Must hold our run queue lock in order to change
+    // p->state and then call sched.  The state changes
+    // before lk is released, so a wakeup issued under lk
+    // finds us SLEEPING, and it cannot make us RUNNABLE
+    // until sched() is done with our run queue lock.
+    // So no wakeup is missed.
+    lockthisrunq();  //DOC: sleeplock1
     proc->chan = chan;
     proc->state = SLEEPING;
+    release(&wq->lock);
+    release(lk);
     sched();
 
     // Tidy up.
     proc->chan = 0;
 
-    // Reacquire original lock.
-    if (lk != &ptable.lock)
-    {  //DOC: sleeplock2
-        release(&ptable.lock);
-        acquire(lk);
-    }
+    // Reacquire original lock.  We may have been
+    // resumed on another CPU.
+    release(&thisrunq()->lock);  //DOC: sleeplock2
+    acquire(&wq->lock);
+    for (pp = &wq->head; *pp != proc; pp = &(*pp)->waitnext)
+        ;
+    *pp = proc->waitnext;
+    release(&wq->lock);
+    acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Callers hold the lock that sleepers on chan passed to
+// sleep(), which is what makes the empty check safe.
+void
+wakeup(void *chan)
 {
-    struct proc *p;
-
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-        if (p->state == SLEEPING && p->chan == chan)
-            p->state = RUNNABLE;
+    wakeupn(chan, -1);
 }
 
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
+// Wake up at most n processes sleeping on chan, or all of
+// them if n is negative.  Return how many were woken.
+int
+wakeupn(void *chan, int n)
 {
-    acquire(&ptable.lock);
-    wakeup1(chan);
-    release(&ptable.lock);
+    struct waitq *wq;
+    struct runq *rq;
+    struct proc *p;
+    int woken;
+
+    wq = waitq(chan);
+    if (wq->head == 0)
+        return 0;
+    woken = 0;
+    acquire(&wq->lock);
+    for (p = wq->head; p != 0 && woken != n; p = p->waitnext)
+    {
+        if (p->chan != chan)
+            continue;
+        rq = lockrunq(p);
+        if (p->state == SLEEPING && p->chan == chan)
+        {
+            makerunnable(rq, p);
+            woken++;
+        }
+        release(&rq->lock);
+    }
+    release(&wq->lock);
+    return woken;
 }
 
 // Kill the process with the given pid.
@@ -527,23 +1467,282 @@ wakeup(void *chan)
 int
 kill(int pid)
 {
+    struct runq *rq;
     struct proc *p;
 
-    acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    p->killed = 1;
+    // Wake process from sleep if necessary.
+    rq = lockrunq(p);
+    if (p->state == SLEEPING)
+        makerunnable(rq, p);
+    release(&rq->lock);
+    release(&p->lock);
+    return 0;
+}
+
+// Set the nice value of process pid: the highest MLFQ
+// level it may occupy, 0 being the highest priority.
+// Return the old nice value, or -1 on error.
+int
+setpriority(int pid, int nice)
+{
+    struct runq *rq;
+    struct proc *p;
+    int old, queued;
+
+    if (nice < 0 || nice >= NMLFQ)
+        return -1;
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    rq = lockrunq(p);
+    old = p->nice;
+    queued = rqunlink(rq, p);
+    p->nice = nice;
+    if (p->tickets == 0 && p->rtperiod == 0)
     {
-        if (p->pid == pid)
+        p->level = nice;
+        p->slice = 0;
+    }
+    if (queued)
+        rqpush(rq, p);
+    release(&rq->lock);
+    release(&p->lock);
+    return old;
+}
+
+// Give process pid the number of tickets in the stride class,
+// or with 0 return it to the MLFQ at its nice level.
+// Return the old number of tickets, or -1 on error.
+int
+settickets(int pid, int tickets)
+{
+    struct runq *rq;
+    struct proc *p;
+    int old, queued;
+
+    if (tickets < 0 || tickets > MAXTICKETS)
+        return -1;
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    rq = lockrunq(p);
+    old = p->tickets;
+    queued = rqunlink(rq, p);
+    p->tickets = tickets;
+    if (tickets)
+    {
+        p->stride = STRIDE1 / tickets;
+        if (old == 0)
+            p->pass = rq->pass;
+    }
+    if (p->rtperiod == 0)
+    {
+        p->level = tickets ? STRIDE : p->nice;
+        p->slice = 0;
+    }
+    if (queued)
+        rqpush(rq, p);
+    release(&rq->lock);
+    release(&p->lock);
+    return old;
+}
+
+// Set p's affinity to mask.  A p sitting on a CPU outside the
+// mask moves at once, except that a running one moves when it
+// next stops running.  Return 1 if p is the caller, which
+// should then yield to be moved right away.
+// p's lock must be held.
+static int
+rebind(struct proc *p, uint mask)
+{
+    struct runq *rq;
+    struct proc *moved;
+    int self;
+
+    rq = lockrunq(p);
+    p->affinity = mask;
+    moved = 0;
+    self = 0;
+    if (!ALLOWED(p, p->cpu))
+    {
+        if (p->state != RUNNING)
+            moved = evict(rq, p);
+        else if (p == proc)
+            self = 1;
+    }
+    release(&rq->lock);
+    if (moved)
+        requeue(moved);
+    return self;
+}
+
+// Restrict process pid to the CPUs in mask, one bit per CPU.
+// Not allowed for EDF processes, which are pinned.
+// Return 0, or -1 on error.
+int
+setaffinity(int pid, uint mask)
+{
+    struct proc *p;
+    int self;
+
+    if (ncpu < 32)
+        mask &= (1 << ncpu) - 1;
+    if (mask == 0)
+        return -1;
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    if (p->rtperiod)
+    {
+        release(&p->lock);
+        return -1;
+    }
+    self = rebind(p, mask);
+    release(&p->lock);
+    if (self)
+        yield();
+    return 0;
+}
+
+// Give process pid an EDF reservation of runtime ticks in every
+// period ticks, or with runtime 0 return it to its old class.
+// The process is pinned to the allowed CPU with the most room
+// for the reservation.  Return 0, or -1 if no CPU can admit it
+// or on error.
+int
+setdeadline(int pid, int runtime, int period)
+{
+    struct runq *rq;
+    struct proc *p;
+    int c, best, room, bestroom, u, queued, self;
+
+    if (runtime < 0 || (runtime > 0 && (runtime > period || period > RTMAXPERIOD)))
+        return -1;
+    u = runtime > 0 ? runtime * 1000 / period : 0;
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+
+    // Admission control.
+    acquire(&rtlock);
+    best = -1;
+    bestroom = 0;
+    for (c = 0; runtime > 0 && c < ncpu; c++)
+    {
+        room = RTMAX - runqs[c].rtutil;
+        if (p->rtperiod && c == p->rtcpu)
+            room += RTUTIL(p);
+        if (ALLOWED(p, c) && u <= room && (best < 0 || room > bestroom))
         {
-            p->killed = 1;
-            // Wake process from sleep if necessary.
-            if (p->state == SLEEPING)
-                p->state = RUNNABLE;
-            release(&ptable.lock);
-            return 0;
+            best = c;
+            bestroom = room;
         }
     }
-    release(&ptable.lock);
-    return -1;
+    if (runtime > 0 && best < 0)
+    {
+        release(&rtlock);
+        release(&p->lock);
+        return -1;
+    }
+
+    if (p->rtperiod)
+        runqs[p->rtcpu].rtutil -= RTUTIL(p);
+    rq = lockrunq(p);
+    queued = rqunlink(rq, p);
+    p->rtruntime = runtime;
+    p->rtperiod = runtime > 0 ? period : 0;
+    if (runtime > 0)
+    {
+        runqs[best].rtutil += u;
+        p->rtcpu = best;
+        p->rtleft = runtime;
+        p->rtdeadline = ticks + period;
+        p->level = EDF;
+    } else
+    {
+        p->level = p->tickets ? STRIDE : p->nice;
+        p->slice = 0;
+    }
+    if (queued)
+        rqpush(rq, p);
+    release(&rq->lock);
+    release(&rtlock);
+    self = runtime > 0 ? rebind(p, 1 << best) : 0;
+    release(&p->lock);
+    if (self)
+        yield();
+    return 0;
+}
+
+// Copy process pid's EDF parameters and statistics to *st.
+// Return -1 if there is no such process.
+int
+getrtstat(int pid, struct rtstat *st)
+{
+    struct proc *p;
+
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    st->runtime = p->rtruntime;
+    st->period = p->rtperiod;
+    st->periods = p->rtperiods;
+    st->misses = p->rtmisses;
+    release(&p->lock);
+    return 0;
+}
+
+// Fill in *st with the dispatch latency record of process pid.
+int
+getschedstat(int pid, struct schedstat *st)
+{
+    struct proc *p;
+    struct runq *rq;
+
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    rq = lockrunq(p);
+    st->nvcsw = p->nvcsw;
+    st->nivcsw = p->nivcsw;
+    st->delayus = p->delayus;
+    st->runus = p->runus;
+    memmove(st->delay, p->delayhist, sizeof(st->delay));
+    memmove(st->slice, p->slicehist, sizeof(st->slice));
+    release(&rq->lock);
+    release(&p->lock);
+    return 0;
+}
+
+// Return the mask of CPUs that process pid may run on,
+// or -1 on error.
+int
+getaffinity(int pid)
+{
+    struct proc *p;
+    int mask;
+
+    if ((p = lockproc(pid)) == 0)
+        return -1;
+    mask = p->affinity;
+    release(&p->lock);
+    if (ncpu < 32)
+        mask &= (1 << ncpu) - 1;
+    return mask;
+}
+
+// Copy the statistics of CPU c to *st.
+// Return -1 if there is no such CPU.
+int
+getcpustat(int c, struct cpustat *st)
+{
+    if (c < 0 || c >= ncpu)
+        return -1;
+    st->ticks = runqs[c].timerticks;
+    st->idle = runqs[c].idleticks;
+    st->rtutil = runqs[c].rtutil;
+    st->rtmisses = runqs[c].rtmisses;
+    acquire(&runqs[c].lock);
+    memmove(&st->sched, &runqs[c].stat, sizeof(st->sched));
+    release(&runqs[c].lock);
+    return 0;
 }
 
 void
@@ -566,15 +1765,10 @@ getProc(int pid, struct proc **result)
 
     cprintf("proc searching for: %d\n", pid);
     acquire(&ptable.lock);
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if ((p = findproc(pid)) != 0)
     {
-        cprintf("proc searching: %s\n", p->name);
-        if (p->pid == pid)
-        {
-            cprintf("proc found: %s\n", p->name);
-            *result = p;
-            break;
-        }
+        cprintf("proc found: %s\n", p->name);
+        *result = p;
     }
     release(&ptable.lock);
 }
@@ -599,7 +1793,7 @@ procdump(void)
     char *state;
     uint pc[10];
 
-    for (p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    for (p = ptable.list; p != 0; p = p->next)
     {
         if (p->state == UNUSED)
             continue;
@@ -10,6 +10,9 @@ struct cpu {
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
+  volatile int idle;           // Halted in scheduler(), waiting for work
+  uint64 tscoff;               // TSC minus the boot CPU's TSC
+  volatile uint rcuctr;        // Odd inside an RCU read section
   
   // Cpu-local storage variables; see below
   struct cpu *cpu;
@@ -55,17 +58,53 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 struct proc {
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
+  struct vmspace *vm;          // Sharing of pgdir by threads; 0 if unshared
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
-  struct proc *parent;         // Parent process
+  struct spinlock lock;        // See the lock order in proc.c
+  struct proc *parent;         // Parent process; parent's lock
+  struct proc *children;       // First child; lock
+  struct proc *sibling;        // Next child of the same parent; parent's lock
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *waitnext;       // Next process in chan's wait queue
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  struct fdtable *files;       // Open files; shared by threads
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct proc *next;           // Next process in ptable.list
+  struct proc *prev;           // Previous process in ptable.list
+  struct proc *hashnext;       // Next process in pid hash bucket
+  int cpu;                     // CPU whose run queue p belongs to
+  struct proc *rqnext;         // Next process on that run queue
+  uint lastrun;                // ticks when last dispatched
+  int nice;                    // Highest MLFQ level p may occupy
+  int level;                   // Current MLFQ level, or NMLFQ for stride
+  int slice;                   // Ticks used at the current level
+  uint boostgen;               // Last priority boost applied to p
+  int tickets;                 // Stride class share; 0 if in the MLFQ
+  uint stride;                 // STRIDE1 / tickets
+  uint pass;                   // Stride class virtual time
+  int rtruntime;               // EDF budget per period, in ticks
+  int rtperiod;                // EDF period in ticks; 0 if not EDF
+  int rtcpu;                   // CPU holding the EDF reservation
+  int rtleft;                  // Budget left in this period
+  uint rtdeadline;             // End of this period
+  uint rtperiods;              // EDF periods completed
+  uint rtmisses;               // EDF deadlines missed
+  uint64 readyat;              // nanotime() when last made RUNNABLE
+  uint64 runat;                // nanotime() when last dispatched
+  uint nvcsw;                  // Voluntary switches (see struct schedstat)
+  uint nivcsw;                 // Involuntary switches
+  uint delayus;                // Total run queue delay, microseconds
+  uint runus;                  // Total running time, microseconds
+  uint delayhist[NSCHEDHIST];  // log2 histogram of run queue delay
+  uint slicehist[NSCHEDHIST];  // log2 histogram of time run per dispatch
+  uint affinity;               // CPUs p may run on, one bit per CPU
+  uint deadline;               // End of timedsleep(), in timer interrupts
+  struct proc *timernext;      // Next process in deadline's wheel slot
 };
 
 // Process memory is laid out contiguously, low addresses first:
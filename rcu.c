@@ -0,0 +1,59 @@
+// Read-copy-update.
+//
+// Readers of an RCU-protected structure take no locks.  They
+// bracket their reads with rcureadlock() and rcureadunlock()
+// and must not sleep in between.  Writers serialize among
+// themselves, publish a new item only after filling it in, and
+// before freeing an item they have unlinked call
+// synchronizercu(), which waits until every reader that might
+// still hold a pointer to it is done.
+//
+// A read section runs with interrupts off, so a CPU is in at
+// most one at a time; cpu->rcuctr is odd while it is.  A grace
+// period has passed once every CPU seen in a read section has
+// moved its counter on.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+
+void
+rcureadlock(void)
+{
+  pushcli();
+  if(cpu->rcuctr & 1)
+    panic("rcureadlock");
+  cpu->rcuctr++;
+  // Order the counter before the reads it protects, against
+  // a writer's unlink before its look at the counters.
+  __sync_synchronize();
+}
+
+void
+rcureadunlock(void)
+{
+  __sync_synchronize();
+  cpu->rcuctr++;
+  popcli();
+}
+
+// Wait for the read sections in progress to finish.
+// Must not be called from within one.
+void
+synchronizercu(void)
+{
+  struct cpu *c;
+  uint ctr;
+
+  __sync_synchronize();
+  for(c = cpus; c < cpus+ncpu; c++){
+    ctr = c->rcuctr;
+    if(ctr & 1)
+      while(c->rcuctr == ctr)
+        pause();
+  }
+}
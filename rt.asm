@@ -0,0 +1,1120 @@
+
+_rt:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "param.h"
+#include "cpustat.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	89 cb                	mov    %ecx,%ebx
+  struct rtstat st;
+  int pid;
+
+  if(argc == 3 && strcmp(argv[1], "-p") == 0){
+  16:	83 3b 03             	cmpl   $0x3,(%ebx)
+  19:	0f 85 b0 00 00 00    	jne    cf <main+0xcf>
+  1f:	8b 43 04             	mov    0x4(%ebx),%eax
+  22:	83 c0 04             	add    $0x4,%eax
+  25:	8b 00                	mov    (%eax),%eax
+  27:	83 ec 08             	sub    $0x8,%esp
+  2a:	68 c0 07 00 00       	push   $0x7c0
+  2f:	50                   	push   %eax
+  30:	e8 c2 01 00 00       	call   1f7 <strcmp>
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	85 c0                	test   %eax,%eax
+  3a:	0f 85 8f 00 00 00    	jne    cf <main+0xcf>
+    pid = atoi(argv[2]);
+  40:	8b 43 04             	mov    0x4(%ebx),%eax
+  43:	83 c0 08             	add    $0x8,%eax
+  46:	8b 00                	mov    (%eax),%eax
+  48:	83 ec 0c             	sub    $0xc,%esp
+  4b:	50                   	push   %eax
+  4c:	e8 15 03 00 00       	call   366 <atoi>
+  51:	83 c4 10             	add    $0x10,%esp
+  54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(rtstat(pid, &st) < 0){
+  57:	83 ec 08             	sub    $0x8,%esp
+  5a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  5d:	50                   	push   %eax
+  5e:	ff 75 e4             	push   -0x1c(%ebp)
+  61:	e8 b3 04 00 00       	call   519 <rtstat>
+  66:	83 c4 10             	add    $0x10,%esp
+  69:	85 c0                	test   %eax,%eax
+  6b:	79 1a                	jns    87 <main+0x87>
+      printf(2, "rt: no process %d\n", pid);
+  6d:	83 ec 04             	sub    $0x4,%esp
+  70:	ff 75 e4             	push   -0x1c(%ebp)
+  73:	68 c3 07 00 00       	push   $0x7c3
+  78:	6a 02                	push   $0x2
+  7a:	e8 ae 05 00 00       	call   62d <printf>
+  7f:	83 c4 10             	add    $0x10,%esp
+      exit();
+  82:	e8 a2 03 00 00       	call   429 <exit>
+    }
+    if(st.period == 0)
+  87:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8a:	85 c0                	test   %eax,%eax
+  8c:	75 17                	jne    a5 <main+0xa5>
+      printf(1, "pid %d: not real-time\n", pid);
+  8e:	83 ec 04             	sub    $0x4,%esp
+  91:	ff 75 e4             	push   -0x1c(%ebp)
+  94:	68 d6 07 00 00       	push   $0x7d6
+  99:	6a 01                	push   $0x1
+  9b:	e8 8d 05 00 00       	call   62d <printf>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	eb 25                	jmp    ca <main+0xca>
+    else
+      printf(1, "pid %d: %d/%d ticks, %d periods, %d missed\n",
+  a5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  a8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  ae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  b1:	83 ec 04             	sub    $0x4,%esp
+  b4:	53                   	push   %ebx
+  b5:	51                   	push   %ecx
+  b6:	52                   	push   %edx
+  b7:	50                   	push   %eax
+  b8:	ff 75 e4             	push   -0x1c(%ebp)
+  bb:	68 f0 07 00 00       	push   $0x7f0
+  c0:	6a 01                	push   $0x1
+  c2:	e8 66 05 00 00       	call   62d <printf>
+  c7:	83 c4 20             	add    $0x20,%esp
+             pid, st.runtime, st.period, st.periods, st.misses);
+    exit();
+  ca:	e8 5a 03 00 00       	call   429 <exit>
+  }
+
+  if(argc < 4){
+  cf:	83 3b 03             	cmpl   $0x3,(%ebx)
+  d2:	7f 29                	jg     fd <main+0xfd>
+    printf(2, "usage: rt runtime period command [arg...]\n");
+  d4:	83 ec 08             	sub    $0x8,%esp
+  d7:	68 1c 08 00 00       	push   $0x81c
+  dc:	6a 02                	push   $0x2
+  de:	e8 4a 05 00 00       	call   62d <printf>
+  e3:	83 c4 10             	add    $0x10,%esp
+    printf(2, "       rt -p pid\n");
+  e6:	83 ec 08             	sub    $0x8,%esp
+  e9:	68 47 08 00 00       	push   $0x847
+  ee:	6a 02                	push   $0x2
+  f0:	e8 38 05 00 00       	call   62d <printf>
+  f5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  f8:	e8 2c 03 00 00       	call   429 <exit>
+  }
+  if(setdeadline(getpid(), atoi(argv[1]), atoi(argv[2])) < 0){
+  fd:	8b 43 04             	mov    0x4(%ebx),%eax
+ 100:	83 c0 08             	add    $0x8,%eax
+ 103:	8b 00                	mov    (%eax),%eax
+ 105:	83 ec 0c             	sub    $0xc,%esp
+ 108:	50                   	push   %eax
+ 109:	e8 58 02 00 00       	call   366 <atoi>
+ 10e:	83 c4 10             	add    $0x10,%esp
+ 111:	89 c7                	mov    %eax,%edi
+ 113:	8b 43 04             	mov    0x4(%ebx),%eax
+ 116:	83 c0 04             	add    $0x4,%eax
+ 119:	8b 00                	mov    (%eax),%eax
+ 11b:	83 ec 0c             	sub    $0xc,%esp
+ 11e:	50                   	push   %eax
+ 11f:	e8 42 02 00 00       	call   366 <atoi>
+ 124:	83 c4 10             	add    $0x10,%esp
+ 127:	89 c6                	mov    %eax,%esi
+ 129:	e8 7b 03 00 00       	call   4a9 <getpid>
+ 12e:	83 ec 04             	sub    $0x4,%esp
+ 131:	57                   	push   %edi
+ 132:	56                   	push   %esi
+ 133:	50                   	push   %eax
+ 134:	e8 d8 03 00 00       	call   511 <setdeadline>
+ 139:	83 c4 10             	add    $0x10,%esp
+ 13c:	85 c0                	test   %eax,%eax
+ 13e:	79 26                	jns    166 <main+0x166>
+    printf(2, "rt: %s/%s not admitted\n", argv[1], argv[2]);
+ 140:	8b 43 04             	mov    0x4(%ebx),%eax
+ 143:	83 c0 08             	add    $0x8,%eax
+ 146:	8b 10                	mov    (%eax),%edx
+ 148:	8b 43 04             	mov    0x4(%ebx),%eax
+ 14b:	83 c0 04             	add    $0x4,%eax
+ 14e:	8b 00                	mov    (%eax),%eax
+ 150:	52                   	push   %edx
+ 151:	50                   	push   %eax
+ 152:	68 59 08 00 00       	push   $0x859
+ 157:	6a 02                	push   $0x2
+ 159:	e8 cf 04 00 00       	call   62d <printf>
+ 15e:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 161:	e8 c3 02 00 00       	call   429 <exit>
+  }
+  exec(argv[3], argv + 3);
+ 166:	8b 43 04             	mov    0x4(%ebx),%eax
+ 169:	8d 50 0c             	lea    0xc(%eax),%edx
+ 16c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 16f:	83 c0 0c             	add    $0xc,%eax
+ 172:	8b 00                	mov    (%eax),%eax
+ 174:	83 ec 08             	sub    $0x8,%esp
+ 177:	52                   	push   %edx
+ 178:	50                   	push   %eax
+ 179:	e8 e3 02 00 00       	call   461 <exec>
+ 17e:	83 c4 10             	add    $0x10,%esp
+  printf(2, "rt: exec %s failed\n", argv[3]);
+ 181:	8b 43 04             	mov    0x4(%ebx),%eax
+ 184:	83 c0 0c             	add    $0xc,%eax
+ 187:	8b 00                	mov    (%eax),%eax
+ 189:	83 ec 04             	sub    $0x4,%esp
+ 18c:	50                   	push   %eax
+ 18d:	68 71 08 00 00       	push   $0x871
+ 192:	6a 02                	push   $0x2
+ 194:	e8 94 04 00 00       	call   62d <printf>
+ 199:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 19c:	e8 88 02 00 00       	call   429 <exit>
+
+000001a1 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 1a1:	55                   	push   %ebp
+ 1a2:	89 e5                	mov    %esp,%ebp
+ 1a4:	57                   	push   %edi
+ 1a5:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 1a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a9:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1af:	89 cb                	mov    %ecx,%ebx
+ 1b1:	89 df                	mov    %ebx,%edi
+ 1b3:	89 d1                	mov    %edx,%ecx
+ 1b5:	fc                   	cld
+ 1b6:	f3 aa                	rep stos %al,%es:(%edi)
+ 1b8:	89 ca                	mov    %ecx,%edx
+ 1ba:	89 fb                	mov    %edi,%ebx
+ 1bc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1bf:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 1c2:	90                   	nop
+ 1c3:	5b                   	pop    %ebx
+ 1c4:	5f                   	pop    %edi
+ 1c5:	5d                   	pop    %ebp
+ 1c6:	c3                   	ret
+
+000001c7 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1c7:	55                   	push   %ebp
+ 1c8:	89 e5                	mov    %esp,%ebp
+ 1ca:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 1cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1d3:	90                   	nop
+ 1d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1d7:	8d 42 01             	lea    0x1(%edx),%eax
+ 1da:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1e3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1e6:	0f b6 12             	movzbl (%edx),%edx
+ 1e9:	88 10                	mov    %dl,(%eax)
+ 1eb:	0f b6 00             	movzbl (%eax),%eax
+ 1ee:	84 c0                	test   %al,%al
+ 1f0:	75 e2                	jne    1d4 <strcpy+0xd>
+    ;
+  return os;
+ 1f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1f5:	c9                   	leave
+ 1f6:	c3                   	ret
+
+000001f7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f7:	55                   	push   %ebp
+ 1f8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1fa:	eb 08                	jmp    204 <strcmp+0xd>
+    p++, q++;
+ 1fc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 200:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 204:	8b 45 08             	mov    0x8(%ebp),%eax
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	74 10                	je     21e <strcmp+0x27>
+ 20e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 211:	0f b6 10             	movzbl (%eax),%edx
+ 214:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 217:	0f b6 00             	movzbl (%eax),%eax
+ 21a:	38 c2                	cmp    %al,%dl
+ 21c:	74 de                	je     1fc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 21e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 221:	0f b6 00             	movzbl (%eax),%eax
+ 224:	0f b6 d0             	movzbl %al,%edx
+ 227:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22a:	0f b6 00             	movzbl (%eax),%eax
+ 22d:	0f b6 c0             	movzbl %al,%eax
+ 230:	29 c2                	sub    %eax,%edx
+ 232:	89 d0                	mov    %edx,%eax
+}
+ 234:	5d                   	pop    %ebp
+ 235:	c3                   	ret
+
+00000236 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 236:	55                   	push   %ebp
+ 237:	89 e5                	mov    %esp,%ebp
+ 239:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 23c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 243:	eb 04                	jmp    249 <strlen+0x13>
+ 245:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 249:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24f:	01 d0                	add    %edx,%eax
+ 251:	0f b6 00             	movzbl (%eax),%eax
+ 254:	84 c0                	test   %al,%al
+ 256:	75 ed                	jne    245 <strlen+0xf>
+    ;
+  return n;
+ 258:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+
+0000025d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 25d:	55                   	push   %ebp
+ 25e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 260:	8b 45 10             	mov    0x10(%ebp),%eax
+ 263:	50                   	push   %eax
+ 264:	ff 75 0c             	push   0xc(%ebp)
+ 267:	ff 75 08             	push   0x8(%ebp)
+ 26a:	e8 32 ff ff ff       	call   1a1 <stosb>
+ 26f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 275:	c9                   	leave
+ 276:	c3                   	ret
+
+00000277 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 277:	55                   	push   %ebp
+ 278:	89 e5                	mov    %esp,%ebp
+ 27a:	83 ec 04             	sub    $0x4,%esp
+ 27d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 280:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 283:	eb 14                	jmp    299 <strchr+0x22>
+    if(*s == c)
+ 285:	8b 45 08             	mov    0x8(%ebp),%eax
+ 288:	0f b6 00             	movzbl (%eax),%eax
+ 28b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 28e:	75 05                	jne    295 <strchr+0x1e>
+      return (char*)s;
+ 290:	8b 45 08             	mov    0x8(%ebp),%eax
+ 293:	eb 13                	jmp    2a8 <strchr+0x31>
+  for(; *s; s++)
+ 295:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 299:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29c:	0f b6 00             	movzbl (%eax),%eax
+ 29f:	84 c0                	test   %al,%al
+ 2a1:	75 e2                	jne    285 <strchr+0xe>
+  return 0;
+ 2a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2a8:	c9                   	leave
+ 2a9:	c3                   	ret
+
+000002aa <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2aa:	55                   	push   %ebp
+ 2ab:	89 e5                	mov    %esp,%ebp
+ 2ad:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2b7:	eb 42                	jmp    2fb <gets+0x51>
+    cc = read(0, &c, 1);
+ 2b9:	83 ec 04             	sub    $0x4,%esp
+ 2bc:	6a 01                	push   $0x1
+ 2be:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2c1:	50                   	push   %eax
+ 2c2:	6a 00                	push   $0x0
+ 2c4:	e8 78 01 00 00       	call   441 <read>
+ 2c9:	83 c4 10             	add    $0x10,%esp
+ 2cc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2cf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2d3:	7e 33                	jle    308 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2d5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2d8:	8d 50 01             	lea    0x1(%eax),%edx
+ 2db:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2de:	89 c2                	mov    %eax,%edx
+ 2e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e3:	01 c2                	add    %eax,%edx
+ 2e5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2e9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2eb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ef:	3c 0a                	cmp    $0xa,%al
+ 2f1:	74 16                	je     309 <gets+0x5f>
+ 2f3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2f7:	3c 0d                	cmp    $0xd,%al
+ 2f9:	74 0e                	je     309 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2fe:	83 c0 01             	add    $0x1,%eax
+ 301:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 304:	7f b3                	jg     2b9 <gets+0xf>
+ 306:	eb 01                	jmp    309 <gets+0x5f>
+      break;
+ 308:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 309:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 30c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30f:	01 d0                	add    %edx,%eax
+ 311:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 314:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 317:	c9                   	leave
+ 318:	c3                   	ret
+
+00000319 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 319:	55                   	push   %ebp
+ 31a:	89 e5                	mov    %esp,%ebp
+ 31c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 31f:	83 ec 08             	sub    $0x8,%esp
+ 322:	6a 00                	push   $0x0
+ 324:	ff 75 08             	push   0x8(%ebp)
+ 327:	e8 3d 01 00 00       	call   469 <open>
+ 32c:	83 c4 10             	add    $0x10,%esp
+ 32f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 332:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 336:	79 07                	jns    33f <stat+0x26>
+    return -1;
+ 338:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 33d:	eb 25                	jmp    364 <stat+0x4b>
+  r = fstat(fd, st);
+ 33f:	83 ec 08             	sub    $0x8,%esp
+ 342:	ff 75 0c             	push   0xc(%ebp)
+ 345:	ff 75 f4             	push   -0xc(%ebp)
+ 348:	e8 34 01 00 00       	call   481 <fstat>
+ 34d:	83 c4 10             	add    $0x10,%esp
+ 350:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 353:	83 ec 0c             	sub    $0xc,%esp
+ 356:	ff 75 f4             	push   -0xc(%ebp)
+ 359:	e8 f3 00 00 00       	call   451 <close>
+ 35e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 361:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 364:	c9                   	leave
+ 365:	c3                   	ret
+
+00000366 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 366:	55                   	push   %ebp
+ 367:	89 e5                	mov    %esp,%ebp
+ 369:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 36c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 373:	eb 25                	jmp    39a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 375:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 378:	89 d0                	mov    %edx,%eax
+ 37a:	c1 e0 02             	shl    $0x2,%eax
+ 37d:	01 d0                	add    %edx,%eax
+ 37f:	01 c0                	add    %eax,%eax
+ 381:	89 c1                	mov    %eax,%ecx
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	8d 50 01             	lea    0x1(%eax),%edx
+ 389:	89 55 08             	mov    %edx,0x8(%ebp)
+ 38c:	0f b6 00             	movzbl (%eax),%eax
+ 38f:	0f be c0             	movsbl %al,%eax
+ 392:	01 c8                	add    %ecx,%eax
+ 394:	83 e8 30             	sub    $0x30,%eax
+ 397:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 39a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39d:	0f b6 00             	movzbl (%eax),%eax
+ 3a0:	3c 2f                	cmp    $0x2f,%al
+ 3a2:	7e 0a                	jle    3ae <atoi+0x48>
+ 3a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a7:	0f b6 00             	movzbl (%eax),%eax
+ 3aa:	3c 39                	cmp    $0x39,%al
+ 3ac:	7e c7                	jle    375 <atoi+0xf>
+  return n;
+ 3ae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3b1:	c9                   	leave
+ 3b2:	c3                   	ret
+
+000003b3 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3b3:	55                   	push   %ebp
+ 3b4:	89 e5                	mov    %esp,%ebp
+ 3b6:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3c5:	eb 17                	jmp    3de <memmove+0x2b>
+    *dst++ = *src++;
+ 3c7:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3ca:	8d 42 01             	lea    0x1(%edx),%eax
+ 3cd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3d3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3d6:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3d9:	0f b6 12             	movzbl (%edx),%edx
+ 3dc:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3de:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3e4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3e7:	85 c0                	test   %eax,%eax
+ 3e9:	7f dc                	jg     3c7 <memmove+0x14>
+  return vdst;
+ 3eb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ee:	c9                   	leave
+ 3ef:	c3                   	ret
+
+000003f0 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 3f6:	83 ec 0c             	sub    $0xc,%esp
+ 3f9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3fc:	50                   	push   %eax
+ 3fd:	e8 ff 00 00 00       	call   501 <nanouptime>
+ 402:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 405:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 408:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 40e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 411:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 416:	f7 e2                	mul    %edx
+ 418:	89 d0                	mov    %edx,%eax
+ 41a:	c1 e8 06             	shr    $0x6,%eax
+ 41d:	01 c8                	add    %ecx,%eax
+}
+ 41f:	c9                   	leave
+ 420:	c3                   	ret
+
+00000421 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 421:	b8 01 00 00 00       	mov    $0x1,%eax
+ 426:	cd 40                	int    $0x40
+ 428:	c3                   	ret
+
+00000429 <exit>:
+SYSCALL(exit)
+ 429:	b8 02 00 00 00       	mov    $0x2,%eax
+ 42e:	cd 40                	int    $0x40
+ 430:	c3                   	ret
+
+00000431 <wait>:
+SYSCALL(wait)
+ 431:	b8 03 00 00 00       	mov    $0x3,%eax
+ 436:	cd 40                	int    $0x40
+ 438:	c3                   	ret
+
+00000439 <pipe>:
+SYSCALL(pipe)
+ 439:	b8 04 00 00 00       	mov    $0x4,%eax
+ 43e:	cd 40                	int    $0x40
+ 440:	c3                   	ret
+
+00000441 <read>:
+SYSCALL(read)
+ 441:	b8 05 00 00 00       	mov    $0x5,%eax
+ 446:	cd 40                	int    $0x40
+ 448:	c3                   	ret
+
+00000449 <write>:
+SYSCALL(write)
+ 449:	b8 10 00 00 00       	mov    $0x10,%eax
+ 44e:	cd 40                	int    $0x40
+ 450:	c3                   	ret
+
+00000451 <close>:
+SYSCALL(close)
+ 451:	b8 15 00 00 00       	mov    $0x15,%eax
+ 456:	cd 40                	int    $0x40
+ 458:	c3                   	ret
+
+00000459 <kill>:
+SYSCALL(kill)
+ 459:	b8 06 00 00 00       	mov    $0x6,%eax
+ 45e:	cd 40                	int    $0x40
+ 460:	c3                   	ret
+
+00000461 <exec>:
+SYSCALL(exec)
+ 461:	b8 07 00 00 00       	mov    $0x7,%eax
+ 466:	cd 40                	int    $0x40
+ 468:	c3                   	ret
+
+00000469 <open>:
+SYSCALL(open)
+ 469:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 46e:	cd 40                	int    $0x40
+ 470:	c3                   	ret
+
+00000471 <mknod>:
+SYSCALL(mknod)
+ 471:	b8 11 00 00 00       	mov    $0x11,%eax
+ 476:	cd 40                	int    $0x40
+ 478:	c3                   	ret
+
+00000479 <unlink>:
+SYSCALL(unlink)
+ 479:	b8 12 00 00 00       	mov    $0x12,%eax
+ 47e:	cd 40                	int    $0x40
+ 480:	c3                   	ret
+
+00000481 <fstat>:
+SYSCALL(fstat)
+ 481:	b8 08 00 00 00       	mov    $0x8,%eax
+ 486:	cd 40                	int    $0x40
+ 488:	c3                   	ret
+
+00000489 <link>:
+SYSCALL(link)
+ 489:	b8 13 00 00 00       	mov    $0x13,%eax
+ 48e:	cd 40                	int    $0x40
+ 490:	c3                   	ret
+
+00000491 <mkdir>:
+SYSCALL(mkdir)
+ 491:	b8 14 00 00 00       	mov    $0x14,%eax
+ 496:	cd 40                	int    $0x40
+ 498:	c3                   	ret
+
+00000499 <chdir>:
+SYSCALL(chdir)
+ 499:	b8 09 00 00 00       	mov    $0x9,%eax
+ 49e:	cd 40                	int    $0x40
+ 4a0:	c3                   	ret
+
+000004a1 <dup>:
+SYSCALL(dup)
+ 4a1:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a6:	cd 40                	int    $0x40
+ 4a8:	c3                   	ret
+
+000004a9 <getpid>:
+SYSCALL(getpid)
+ 4a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ae:	cd 40                	int    $0x40
+ 4b0:	c3                   	ret
+
+000004b1 <sbrk>:
+SYSCALL(sbrk)
+ 4b1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b6:	cd 40                	int    $0x40
+ 4b8:	c3                   	ret
+
+000004b9 <sleep>:
+SYSCALL(sleep)
+ 4b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4be:	cd 40                	int    $0x40
+ 4c0:	c3                   	ret
+
+000004c1 <uptime>:
+SYSCALL(uptime)
+ 4c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c6:	cd 40                	int    $0x40
+ 4c8:	c3                   	ret
+
+000004c9 <saveProc>:
+SYSCALL(saveProc)
+ 4c9:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4ce:	cd 40                	int    $0x40
+ 4d0:	c3                   	ret
+
+000004d1 <loadProc>:
+SYSCALL(loadProc)
+ 4d1:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4d6:	cd 40                	int    $0x40
+ 4d8:	c3                   	ret
+
+000004d9 <setpriority>:
+SYSCALL(setpriority)
+ 4d9:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4de:	cd 40                	int    $0x40
+ 4e0:	c3                   	ret
+
+000004e1 <setaffinity>:
+SYSCALL(setaffinity)
+ 4e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4e6:	cd 40                	int    $0x40
+ 4e8:	c3                   	ret
+
+000004e9 <getaffinity>:
+SYSCALL(getaffinity)
+ 4e9:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4ee:	cd 40                	int    $0x40
+ 4f0:	c3                   	ret
+
+000004f1 <nanosleep>:
+SYSCALL(nanosleep)
+ 4f1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f6:	cd 40                	int    $0x40
+ 4f8:	c3                   	ret
+
+000004f9 <cpustat>:
+SYSCALL(cpustat)
+ 4f9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4fe:	cd 40                	int    $0x40
+ 500:	c3                   	ret
+
+00000501 <nanouptime>:
+SYSCALL(nanouptime)
+ 501:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 506:	cd 40                	int    $0x40
+ 508:	c3                   	ret
+
+00000509 <settickets>:
+SYSCALL(settickets)
+ 509:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 50e:	cd 40                	int    $0x40
+ 510:	c3                   	ret
+
+00000511 <setdeadline>:
+SYSCALL(setdeadline)
+ 511:	b8 20 00 00 00       	mov    $0x20,%eax
+ 516:	cd 40                	int    $0x40
+ 518:	c3                   	ret
+
+00000519 <rtstat>:
+SYSCALL(rtstat)
+ 519:	b8 21 00 00 00       	mov    $0x21,%eax
+ 51e:	cd 40                	int    $0x40
+ 520:	c3                   	ret
+
+00000521 <schedstat>:
+SYSCALL(schedstat)
+ 521:	b8 22 00 00 00       	mov    $0x22,%eax
+ 526:	cd 40                	int    $0x40
+ 528:	c3                   	ret
+
+00000529 <waitpid>:
+SYSCALL(waitpid)
+ 529:	b8 23 00 00 00       	mov    $0x23,%eax
+ 52e:	cd 40                	int    $0x40
+ 530:	c3                   	ret
+
+00000531 <clone>:
+SYSCALL(clone)
+ 531:	b8 24 00 00 00       	mov    $0x24,%eax
+ 536:	cd 40                	int    $0x40
+ 538:	c3                   	ret
+
+00000539 <futexwait>:
+SYSCALL(futexwait)
+ 539:	b8 25 00 00 00       	mov    $0x25,%eax
+ 53e:	cd 40                	int    $0x40
+ 540:	c3                   	ret
+
+00000541 <futexwake>:
+SYSCALL(futexwake)
+ 541:	b8 26 00 00 00       	mov    $0x26,%eax
+ 546:	cd 40                	int    $0x40
+ 548:	c3                   	ret
+
+00000549 <lockstat>:
+SYSCALL(lockstat)
+ 549:	b8 27 00 00 00       	mov    $0x27,%eax
+ 54e:	cd 40                	int    $0x40
+ 550:	c3                   	ret
+
+00000551 <dcachestat>:
+SYSCALL(dcachestat)
+ 551:	b8 28 00 00 00       	mov    $0x28,%eax
+ 556:	cd 40                	int    $0x40
+ 558:	c3                   	ret
+
+00000559 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 559:	55                   	push   %ebp
+ 55a:	89 e5                	mov    %esp,%ebp
+ 55c:	83 ec 18             	sub    $0x18,%esp
+ 55f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 562:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 565:	83 ec 04             	sub    $0x4,%esp
+ 568:	6a 01                	push   $0x1
+ 56a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 56d:	50                   	push   %eax
+ 56e:	ff 75 08             	push   0x8(%ebp)
+ 571:	e8 d3 fe ff ff       	call   449 <write>
+ 576:	83 c4 10             	add    $0x10,%esp
+}
+ 579:	90                   	nop
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+
+0000057c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 582:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 589:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 58d:	74 17                	je     5a6 <printint+0x2a>
+ 58f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 593:	79 11                	jns    5a6 <printint+0x2a>
+    neg = 1;
+ 595:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 59c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59f:	f7 d8                	neg    %eax
+ 5a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5a4:	eb 06                	jmp    5ac <printint+0x30>
+  } else {
+    x = xx;
+ 5a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5a9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5b6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5be:	f7 f1                	div    %ecx
+ 5c0:	89 d1                	mov    %edx,%ecx
+ 5c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c5:	8d 50 01             	lea    0x1(%eax),%edx
+ 5c8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5cb:	0f b6 91 9c 0a 00 00 	movzbl 0xa9c(%ecx),%edx
+ 5d2:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5d6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5dc:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5e1:	f7 f1                	div    %ecx
+ 5e3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5ea:	75 c7                	jne    5b3 <printint+0x37>
+  if(neg)
+ 5ec:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5f0:	74 2d                	je     61f <printint+0xa3>
+    buf[i++] = '-';
+ 5f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5f5:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5fb:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 600:	eb 1d                	jmp    61f <printint+0xa3>
+    putc(fd, buf[i]);
+ 602:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 605:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 608:	01 d0                	add    %edx,%eax
+ 60a:	0f b6 00             	movzbl (%eax),%eax
+ 60d:	0f be c0             	movsbl %al,%eax
+ 610:	83 ec 08             	sub    $0x8,%esp
+ 613:	50                   	push   %eax
+ 614:	ff 75 08             	push   0x8(%ebp)
+ 617:	e8 3d ff ff ff       	call   559 <putc>
+ 61c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 61f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 623:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 627:	79 d9                	jns    602 <printint+0x86>
+}
+ 629:	90                   	nop
+ 62a:	90                   	nop
+ 62b:	c9                   	leave
+ 62c:	c3                   	ret
+
+0000062d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 62d:	55                   	push   %ebp
+ 62e:	89 e5                	mov    %esp,%ebp
+ 630:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 633:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 63a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 63d:	83 c0 04             	add    $0x4,%eax
+ 640:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 643:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 64a:	e9 59 01 00 00       	jmp    7a8 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 64f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 652:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 655:	01 d0                	add    %edx,%eax
+ 657:	0f b6 00             	movzbl (%eax),%eax
+ 65a:	0f be c0             	movsbl %al,%eax
+ 65d:	25 ff 00 00 00       	and    $0xff,%eax
+ 662:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 665:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 669:	75 2c                	jne    697 <printf+0x6a>
+      if(c == '%'){
+ 66b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 66f:	75 0c                	jne    67d <printf+0x50>
+        state = '%';
+ 671:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 678:	e9 27 01 00 00       	jmp    7a4 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 67d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 680:	0f be c0             	movsbl %al,%eax
+ 683:	83 ec 08             	sub    $0x8,%esp
+ 686:	50                   	push   %eax
+ 687:	ff 75 08             	push   0x8(%ebp)
+ 68a:	e8 ca fe ff ff       	call   559 <putc>
+ 68f:	83 c4 10             	add    $0x10,%esp
+ 692:	e9 0d 01 00 00       	jmp    7a4 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 697:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 69b:	0f 85 03 01 00 00    	jne    7a4 <printf+0x177>
+      if(c == 'd'){
+ 6a1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6a5:	75 1e                	jne    6c5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6a7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6aa:	8b 00                	mov    (%eax),%eax
+ 6ac:	6a 01                	push   $0x1
+ 6ae:	6a 0a                	push   $0xa
+ 6b0:	50                   	push   %eax
+ 6b1:	ff 75 08             	push   0x8(%ebp)
+ 6b4:	e8 c3 fe ff ff       	call   57c <printint>
+ 6b9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6bc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6c0:	e9 d8 00 00 00       	jmp    79d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6c5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6c9:	74 06                	je     6d1 <printf+0xa4>
+ 6cb:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6cf:	75 1e                	jne    6ef <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6d1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6d4:	8b 00                	mov    (%eax),%eax
+ 6d6:	6a 00                	push   $0x0
+ 6d8:	6a 10                	push   $0x10
+ 6da:	50                   	push   %eax
+ 6db:	ff 75 08             	push   0x8(%ebp)
+ 6de:	e8 99 fe ff ff       	call   57c <printint>
+ 6e3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6e6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6ea:	e9 ae 00 00 00       	jmp    79d <printf+0x170>
+      } else if(c == 's'){
+ 6ef:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6f3:	75 43                	jne    738 <printf+0x10b>
+        s = (char*)*ap;
+ 6f5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6fd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 701:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 705:	75 25                	jne    72c <printf+0xff>
+          s = "(null)";
+ 707:	c7 45 f4 85 08 00 00 	movl   $0x885,-0xc(%ebp)
+        while(*s != 0){
+ 70e:	eb 1c                	jmp    72c <printf+0xff>
+          putc(fd, *s);
+ 710:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 713:	0f b6 00             	movzbl (%eax),%eax
+ 716:	0f be c0             	movsbl %al,%eax
+ 719:	83 ec 08             	sub    $0x8,%esp
+ 71c:	50                   	push   %eax
+ 71d:	ff 75 08             	push   0x8(%ebp)
+ 720:	e8 34 fe ff ff       	call   559 <putc>
+ 725:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 728:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 72c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72f:	0f b6 00             	movzbl (%eax),%eax
+ 732:	84 c0                	test   %al,%al
+ 734:	75 da                	jne    710 <printf+0xe3>
+ 736:	eb 65                	jmp    79d <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 738:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 73c:	75 1d                	jne    75b <printf+0x12e>
+        putc(fd, *ap);
+ 73e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 741:	8b 00                	mov    (%eax),%eax
+ 743:	0f be c0             	movsbl %al,%eax
+ 746:	83 ec 08             	sub    $0x8,%esp
+ 749:	50                   	push   %eax
+ 74a:	ff 75 08             	push   0x8(%ebp)
+ 74d:	e8 07 fe ff ff       	call   559 <putc>
+ 752:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 755:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 759:	eb 42                	jmp    79d <printf+0x170>
+      } else if(c == '%'){
+ 75b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 75f:	75 17                	jne    778 <printf+0x14b>
+        putc(fd, c);
+ 761:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 764:	0f be c0             	movsbl %al,%eax
+ 767:	83 ec 08             	sub    $0x8,%esp
+ 76a:	50                   	push   %eax
+ 76b:	ff 75 08             	push   0x8(%ebp)
+ 76e:	e8 e6 fd ff ff       	call   559 <putc>
+ 773:	83 c4 10             	add    $0x10,%esp
+ 776:	eb 25                	jmp    79d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 778:	83 ec 08             	sub    $0x8,%esp
+ 77b:	6a 25                	push   $0x25
+ 77d:	ff 75 08             	push   0x8(%ebp)
+ 780:	e8 d4 fd ff ff       	call   559 <putc>
+ 785:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 788:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 78b:	0f be c0             	movsbl %al,%eax
+ 78e:	83 ec 08             	sub    $0x8,%esp
+ 791:	50                   	push   %eax
+ 792:	ff 75 08             	push   0x8(%ebp)
+ 795:	e8 bf fd ff ff       	call   559 <putc>
+ 79a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 79d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7a4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ae:	01 d0                	add    %edx,%eax
+ 7b0:	0f b6 00             	movzbl (%eax),%eax
+ 7b3:	84 c0                	test   %al,%al
+ 7b5:	0f 85 94 fe ff ff    	jne    64f <printf+0x22>
+    }
+  }
+}
+ 7bb:	90                   	nop
+ 7bc:	90                   	nop
+ 7bd:	c9                   	leave
+ 7be:	c3                   	ret
@@ -0,0 +1,42 @@
+// Run a command with an EDF reservation of runtime ticks in
+// every period, or show a process's reservation and misses.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+int
+main(int argc, char **argv)
+{
+  struct rtstat st;
+  int pid;
+
+  if(argc == 3 && strcmp(argv[1], "-p") == 0){
+    pid = atoi(argv[2]);
+    if(rtstat(pid, &st) < 0){
+      printf(2, "rt: no process %d\n", pid);
+      exit();
+    }
+    if(st.period == 0)
+      printf(1, "pid %d: not real-time\n", pid);
+    else
+      printf(1, "pid %d: %d/%d ticks, %d periods, %d missed\n",
+             pid, st.runtime, st.period, st.periods, st.misses);
+    exit();
+  }
+
+  if(argc < 4){
+    printf(2, "usage: rt runtime period command [arg...]\n");
+    printf(2, "       rt -p pid\n");
+    exit();
+  }
+  if(setdeadline(getpid(), atoi(argv[1]), atoi(argv[2])) < 0){
+    printf(2, "rt: %s/%s not admitted\n", argv[1], argv[2]);
+    exit();
+  }
+  exec(argv[3], argv + 3);
+  printf(2, "rt: exec %s failed\n", argv[3]);
+  exit();
+}
@@ -0,0 +1,1380 @@
+
+_schedlat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <report>:
+
+#define MAXCPU 8
+
+static void
+report(char *what, struct schedstat *st)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  uint n;
+  int b;
+
+  n = st->nvcsw + st->nivcsw;
+   7:	8b 45 0c             	mov    0xc(%ebp),%eax
+   a:	8b 10                	mov    (%eax),%edx
+   c:	8b 45 0c             	mov    0xc(%ebp),%eax
+   f:	8b 40 04             	mov    0x4(%eax),%eax
+  12:	01 d0                	add    %edx,%eax
+  14:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  printf(1, "%s: %d switches, %d voluntary, %d preempted\n",
+  17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  1a:	8b 50 04             	mov    0x4(%eax),%edx
+  1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  20:	8b 00                	mov    (%eax),%eax
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	52                   	push   %edx
+  26:	50                   	push   %eax
+  27:	ff 75 f0             	push   -0x10(%ebp)
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	68 34 0a 00 00       	push   $0xa34
+  32:	6a 01                	push   $0x1
+  34:	e8 67 08 00 00       	call   8a0 <printf>
+  39:	83 c4 20             	add    $0x20,%esp
+         what, n, st->nvcsw, st->nivcsw);
+  if(n == 0)
+  3c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  40:	0f 84 14 01 00 00    	je     15a <report+0x15a>
+    return;
+  printf(1, "  delay avg %dus, run avg %dus\n",
+         st->delayus / n, st->runus / n);
+  46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  49:	8b 40 0c             	mov    0xc(%eax),%eax
+  printf(1, "  delay avg %dus, run avg %dus\n",
+  4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  51:	f7 75 f0             	divl   -0x10(%ebp)
+  54:	89 c1                	mov    %eax,%ecx
+         st->delayus / n, st->runus / n);
+  56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  59:	8b 40 08             	mov    0x8(%eax),%eax
+  printf(1, "  delay avg %dus, run avg %dus\n",
+  5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  61:	f7 75 f0             	divl   -0x10(%ebp)
+  64:	51                   	push   %ecx
+  65:	50                   	push   %eax
+  66:	68 64 0a 00 00       	push   $0xa64
+  6b:	6a 01                	push   $0x1
+  6d:	e8 2e 08 00 00       	call   8a0 <printf>
+  72:	83 c4 10             	add    $0x10,%esp
+  for(b = 0; b < NSCHEDHIST; b++){
+  75:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  7c:	e9 cd 00 00 00       	jmp    14e <report+0x14e>
+    if(st->delay[b] == 0 && st->slice[b] == 0)
+  81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  84:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  87:	83 c2 04             	add    $0x4,%edx
+  8a:	8b 04 90             	mov    (%eax,%edx,4),%eax
+  8d:	85 c0                	test   %eax,%eax
+  8f:	75 14                	jne    a5 <report+0xa5>
+  91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  94:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  97:	83 c2 18             	add    $0x18,%edx
+  9a:	8b 04 90             	mov    (%eax,%edx,4),%eax
+  9d:	85 c0                	test   %eax,%eax
+  9f:	0f 84 a4 00 00 00    	je     149 <report+0x149>
+      continue;
+    if(b == 0)
+  a5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a9:	75 14                	jne    bf <report+0xbf>
+      printf(1, "  <1us");
+  ab:	83 ec 08             	sub    $0x8,%esp
+  ae:	68 84 0a 00 00       	push   $0xa84
+  b3:	6a 01                	push   $0x1
+  b5:	e8 e6 07 00 00       	call   8a0 <printf>
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	eb 5f                	jmp    11e <report+0x11e>
+    else if(b == NSCHEDHIST - 1)
+  bf:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  c3:	75 26                	jne    eb <report+0xeb>
+      printf(1, "  >=%dus", 1 << (b - 1));
+  c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c8:	83 e8 01             	sub    $0x1,%eax
+  cb:	ba 01 00 00 00       	mov    $0x1,%edx
+  d0:	89 c1                	mov    %eax,%ecx
+  d2:	d3 e2                	shl    %cl,%edx
+  d4:	89 d0                	mov    %edx,%eax
+  d6:	83 ec 04             	sub    $0x4,%esp
+  d9:	50                   	push   %eax
+  da:	68 8b 0a 00 00       	push   $0xa8b
+  df:	6a 01                	push   $0x1
+  e1:	e8 ba 07 00 00       	call   8a0 <printf>
+  e6:	83 c4 10             	add    $0x10,%esp
+  e9:	eb 33                	jmp    11e <report+0x11e>
+    else
+      printf(1, "  %d-%dus", 1 << (b - 1), (1 << b) - 1);
+  eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  f3:	89 c1                	mov    %eax,%ecx
+  f5:	d3 e2                	shl    %cl,%edx
+  f7:	89 d0                	mov    %edx,%eax
+  f9:	8d 50 ff             	lea    -0x1(%eax),%edx
+  fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  ff:	83 e8 01             	sub    $0x1,%eax
+ 102:	bb 01 00 00 00       	mov    $0x1,%ebx
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	d3 e3                	shl    %cl,%ebx
+ 10b:	89 d8                	mov    %ebx,%eax
+ 10d:	52                   	push   %edx
+ 10e:	50                   	push   %eax
+ 10f:	68 94 0a 00 00       	push   $0xa94
+ 114:	6a 01                	push   $0x1
+ 116:	e8 85 07 00 00       	call   8a0 <printf>
+ 11b:	83 c4 10             	add    $0x10,%esp
+    printf(1, ": %d waited, %d ran\n", st->delay[b], st->slice[b]);
+ 11e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 121:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 124:	83 c2 18             	add    $0x18,%edx
+ 127:	8b 14 90             	mov    (%eax,%edx,4),%edx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+ 130:	83 c1 04             	add    $0x4,%ecx
+ 133:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+ 136:	52                   	push   %edx
+ 137:	50                   	push   %eax
+ 138:	68 9e 0a 00 00       	push   $0xa9e
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 5c 07 00 00       	call   8a0 <printf>
+ 144:	83 c4 10             	add    $0x10,%esp
+ 147:	eb 01                	jmp    14a <report+0x14a>
+      continue;
+ 149:	90                   	nop
+  for(b = 0; b < NSCHEDHIST; b++){
+ 14a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 14e:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 152:	0f 8e 29 ff ff ff    	jle    81 <report+0x81>
+ 158:	eb 01                	jmp    15b <report+0x15b>
+    return;
+ 15a:	90                   	nop
+  }
+}
+ 15b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15e:	c9                   	leave
+ 15f:	c3                   	ret
+
+00000160 <delta>:
+
+// a = b - a, field by field.
+static void
+delta(struct schedstat *a, struct schedstat *b)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  a->nvcsw = b->nvcsw - a->nvcsw;
+ 166:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 169:	8b 10                	mov    (%eax),%edx
+ 16b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 16e:	8b 00                	mov    (%eax),%eax
+ 170:	29 c2                	sub    %eax,%edx
+ 172:	8b 45 08             	mov    0x8(%ebp),%eax
+ 175:	89 10                	mov    %edx,(%eax)
+  a->nivcsw = b->nivcsw - a->nivcsw;
+ 177:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 17a:	8b 50 04             	mov    0x4(%eax),%edx
+ 17d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 180:	8b 40 04             	mov    0x4(%eax),%eax
+ 183:	29 c2                	sub    %eax,%edx
+ 185:	8b 45 08             	mov    0x8(%ebp),%eax
+ 188:	89 50 04             	mov    %edx,0x4(%eax)
+  a->delayus = b->delayus - a->delayus;
+ 18b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 18e:	8b 50 08             	mov    0x8(%eax),%edx
+ 191:	8b 45 08             	mov    0x8(%ebp),%eax
+ 194:	8b 40 08             	mov    0x8(%eax),%eax
+ 197:	29 c2                	sub    %eax,%edx
+ 199:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19c:	89 50 08             	mov    %edx,0x8(%eax)
+  a->runus = b->runus - a->runus;
+ 19f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a2:	8b 50 0c             	mov    0xc(%eax),%edx
+ 1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a8:	8b 40 0c             	mov    0xc(%eax),%eax
+ 1ab:	29 c2                	sub    %eax,%edx
+ 1ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b0:	89 50 0c             	mov    %edx,0xc(%eax)
+  for(i = 0; i < NSCHEDHIST; i++){
+ 1b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1ba:	eb 54                	jmp    210 <delta+0xb0>
+    a->delay[i] = b->delay[i] - a->delay[i];
+ 1bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bf:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1c2:	83 c2 04             	add    $0x4,%edx
+ 1c5:	8b 14 90             	mov    (%eax,%edx,4),%edx
+ 1c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cb:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+ 1ce:	83 c1 04             	add    $0x4,%ecx
+ 1d1:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+ 1d4:	89 d1                	mov    %edx,%ecx
+ 1d6:	29 c1                	sub    %eax,%ecx
+ 1d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1de:	83 c2 04             	add    $0x4,%edx
+ 1e1:	89 0c 90             	mov    %ecx,(%eax,%edx,4)
+    a->slice[i] = b->slice[i] - a->slice[i];
+ 1e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1ea:	83 c2 18             	add    $0x18,%edx
+ 1ed:	8b 14 90             	mov    (%eax,%edx,4),%edx
+ 1f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f3:	8b 4d fc             	mov    -0x4(%ebp),%ecx
+ 1f6:	83 c1 18             	add    $0x18,%ecx
+ 1f9:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+ 1fc:	89 d1                	mov    %edx,%ecx
+ 1fe:	29 c1                	sub    %eax,%ecx
+ 200:	8b 45 08             	mov    0x8(%ebp),%eax
+ 203:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 206:	83 c2 18             	add    $0x18,%edx
+ 209:	89 0c 90             	mov    %ecx,(%eax,%edx,4)
+  for(i = 0; i < NSCHEDHIST; i++){
+ 20c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 210:	83 7d fc 13          	cmpl   $0x13,-0x4(%ebp)
+ 214:	7e a6                	jle    1bc <delta+0x5c>
+  }
+}
+ 216:	90                   	nop
+ 217:	90                   	nop
+ 218:	c9                   	leave
+ 219:	c3                   	ret
+
+0000021a <main>:
+
+int
+main(int argc, char **argv)
+{
+ 21a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 21e:	83 e4 f0             	and    $0xfffffff0,%esp
+ 221:	ff 71 fc             	push   -0x4(%ecx)
+ 224:	55                   	push   %ebp
+ 225:	89 e5                	mov    %esp,%ebp
+ 227:	53                   	push   %ebx
+ 228:	51                   	push   %ecx
+ 229:	81 ec d0 00 00 00    	sub    $0xd0,%esp
+ 22f:	89 cb                	mov    %ecx,%ebx
+  static struct cpustat a[MAXCPU], b;
+  struct schedstat st;
+  char name[8];
+  int c, n, interval;
+
+  if(argc == 3 && strcmp(argv[1], "-p") == 0){
+ 231:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 234:	0f 85 88 00 00 00    	jne    2c2 <main+0xa8>
+ 23a:	8b 43 04             	mov    0x4(%ebx),%eax
+ 23d:	83 c0 04             	add    $0x4,%eax
+ 240:	8b 00                	mov    (%eax),%eax
+ 242:	83 ec 08             	sub    $0x8,%esp
+ 245:	68 b3 0a 00 00       	push   $0xab3
+ 24a:	50                   	push   %eax
+ 24b:	e8 1a 02 00 00       	call   46a <strcmp>
+ 250:	83 c4 10             	add    $0x10,%esp
+ 253:	85 c0                	test   %eax,%eax
+ 255:	75 6b                	jne    2c2 <main+0xa8>
+    if(schedstat(atoi(argv[2]), &st) < 0){
+ 257:	8b 43 04             	mov    0x4(%ebx),%eax
+ 25a:	83 c0 08             	add    $0x8,%eax
+ 25d:	8b 00                	mov    (%eax),%eax
+ 25f:	83 ec 0c             	sub    $0xc,%esp
+ 262:	50                   	push   %eax
+ 263:	e8 71 03 00 00       	call   5d9 <atoi>
+ 268:	83 c4 10             	add    $0x10,%esp
+ 26b:	83 ec 08             	sub    $0x8,%esp
+ 26e:	8d 95 3c ff ff ff    	lea    -0xc4(%ebp),%edx
+ 274:	52                   	push   %edx
+ 275:	50                   	push   %eax
+ 276:	e8 19 05 00 00       	call   794 <schedstat>
+ 27b:	83 c4 10             	add    $0x10,%esp
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	79 20                	jns    2a2 <main+0x88>
+      printf(2, "schedlat: no process %s\n", argv[2]);
+ 282:	8b 43 04             	mov    0x4(%ebx),%eax
+ 285:	83 c0 08             	add    $0x8,%eax
+ 288:	8b 00                	mov    (%eax),%eax
+ 28a:	83 ec 04             	sub    $0x4,%esp
+ 28d:	50                   	push   %eax
+ 28e:	68 b6 0a 00 00       	push   $0xab6
+ 293:	6a 02                	push   $0x2
+ 295:	e8 06 06 00 00       	call   8a0 <printf>
+ 29a:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 29d:	e8 fa 03 00 00       	call   69c <exit>
+    }
+    report(argv[2], &st);
+ 2a2:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2a5:	83 c0 08             	add    $0x8,%eax
+ 2a8:	8b 00                	mov    (%eax),%eax
+ 2aa:	83 ec 08             	sub    $0x8,%esp
+ 2ad:	8d 95 3c ff ff ff    	lea    -0xc4(%ebp),%edx
+ 2b3:	52                   	push   %edx
+ 2b4:	50                   	push   %eax
+ 2b5:	e8 46 fd ff ff       	call   0 <report>
+ 2ba:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2bd:	e8 da 03 00 00       	call   69c <exit>
+  }
+
+  interval = 100;
+ 2c2:	c7 45 ec 64 00 00 00 	movl   $0x64,-0x14(%ebp)
+  if(argc > 2 || (argc > 1 && (interval = atoi(argv[1])) <= 0)){
+ 2c9:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 2cc:	7f 22                	jg     2f0 <main+0xd6>
+ 2ce:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2d1:	7e 46                	jle    319 <main+0xff>
+ 2d3:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2d6:	83 c0 04             	add    $0x4,%eax
+ 2d9:	8b 00                	mov    (%eax),%eax
+ 2db:	83 ec 0c             	sub    $0xc,%esp
+ 2de:	50                   	push   %eax
+ 2df:	e8 f5 02 00 00       	call   5d9 <atoi>
+ 2e4:	83 c4 10             	add    $0x10,%esp
+ 2e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 2ea:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 2ee:	7f 29                	jg     319 <main+0xff>
+    printf(2, "usage: schedlat [ticks]\n");
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	68 cf 0a 00 00       	push   $0xacf
+ 2f8:	6a 02                	push   $0x2
+ 2fa:	e8 a1 05 00 00       	call   8a0 <printf>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+    printf(2, "       schedlat -p pid\n");
+ 302:	83 ec 08             	sub    $0x8,%esp
+ 305:	68 e8 0a 00 00       	push   $0xae8
+ 30a:	6a 02                	push   $0x2
+ 30c:	e8 8f 05 00 00       	call   8a0 <printf>
+ 311:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 314:	e8 83 03 00 00       	call   69c <exit>
+  }
+
+  for(n = 0; n < MAXCPU && cpustat(n, &a[n]) == 0; n++)
+ 319:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 320:	eb 04                	jmp    326 <main+0x10c>
+ 322:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 326:	83 7d f0 07          	cmpl   $0x7,-0x10(%ebp)
+ 32a:	7f 24                	jg     350 <main+0x136>
+ 32c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ 32f:	89 d0                	mov    %edx,%eax
+ 331:	01 c0                	add    %eax,%eax
+ 333:	01 d0                	add    %edx,%eax
+ 335:	c1 e0 06             	shl    $0x6,%eax
+ 338:	05 80 0d 00 00       	add    $0xd80,%eax
+ 33d:	83 ec 08             	sub    $0x8,%esp
+ 340:	50                   	push   %eax
+ 341:	ff 75 f0             	push   -0x10(%ebp)
+ 344:	e8 23 04 00 00       	call   76c <cpustat>
+ 349:	83 c4 10             	add    $0x10,%esp
+ 34c:	85 c0                	test   %eax,%eax
+ 34e:	74 d2                	je     322 <main+0x108>
+    ;
+  sleep(interval);
+ 350:	83 ec 0c             	sub    $0xc,%esp
+ 353:	ff 75 ec             	push   -0x14(%ebp)
+ 356:	e8 d1 03 00 00       	call   72c <sleep>
+ 35b:	83 c4 10             	add    $0x10,%esp
+  for(c = 0; c < n; c++){
+ 35e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 365:	e9 96 00 00 00       	jmp    400 <main+0x1e6>
+    if(cpustat(c, &b) < 0)
+ 36a:	83 ec 08             	sub    $0x8,%esp
+ 36d:	68 80 13 00 00       	push   $0x1380
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 f2 03 00 00       	call   76c <cpustat>
+ 37a:	83 c4 10             	add    $0x10,%esp
+ 37d:	85 c0                	test   %eax,%eax
+ 37f:	0f 88 89 00 00 00    	js     40e <main+0x1f4>
+      break;
+    delta(&a[c].sched, &b.sched);
+ 385:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 388:	89 d0                	mov    %edx,%eax
+ 38a:	01 c0                	add    %eax,%eax
+ 38c:	01 d0                	add    %edx,%eax
+ 38e:	c1 e0 06             	shl    $0x6,%eax
+ 391:	83 c0 10             	add    $0x10,%eax
+ 394:	05 80 0d 00 00       	add    $0xd80,%eax
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	68 90 13 00 00       	push   $0x1390
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 b9 fd ff ff       	call   160 <delta>
+ 3a7:	83 c4 10             	add    $0x10,%esp
+    strcpy(name, "cpu0");
+ 3aa:	83 ec 08             	sub    $0x8,%esp
+ 3ad:	68 00 0b 00 00       	push   $0xb00
+ 3b2:	8d 85 34 ff ff ff    	lea    -0xcc(%ebp),%eax
+ 3b8:	50                   	push   %eax
+ 3b9:	e8 7c 00 00 00       	call   43a <strcpy>
+ 3be:	83 c4 10             	add    $0x10,%esp
+    name[3] += c;
+ 3c1:	0f b6 85 37 ff ff ff 	movzbl -0xc9(%ebp),%eax
+ 3c8:	89 c2                	mov    %eax,%edx
+ 3ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3cd:	01 d0                	add    %edx,%eax
+ 3cf:	88 85 37 ff ff ff    	mov    %al,-0xc9(%ebp)
+    report(name, &a[c].sched);
+ 3d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3d8:	89 d0                	mov    %edx,%eax
+ 3da:	01 c0                	add    %eax,%eax
+ 3dc:	01 d0                	add    %edx,%eax
+ 3de:	c1 e0 06             	shl    $0x6,%eax
+ 3e1:	83 c0 10             	add    $0x10,%eax
+ 3e4:	05 80 0d 00 00       	add    $0xd80,%eax
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	50                   	push   %eax
+ 3ed:	8d 85 34 ff ff ff    	lea    -0xcc(%ebp),%eax
+ 3f3:	50                   	push   %eax
+ 3f4:	e8 07 fc ff ff       	call   0 <report>
+ 3f9:	83 c4 10             	add    $0x10,%esp
+  for(c = 0; c < n; c++){
+ 3fc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 400:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 403:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+ 406:	0f 8c 5e ff ff ff    	jl     36a <main+0x150>
+ 40c:	eb 01                	jmp    40f <main+0x1f5>
+      break;
+ 40e:	90                   	nop
+  }
+  exit();
+ 40f:	e8 88 02 00 00       	call   69c <exit>
+
+00000414 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 414:	55                   	push   %ebp
+ 415:	89 e5                	mov    %esp,%ebp
+ 417:	57                   	push   %edi
+ 418:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 419:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 41c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 41f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 422:	89 cb                	mov    %ecx,%ebx
+ 424:	89 df                	mov    %ebx,%edi
+ 426:	89 d1                	mov    %edx,%ecx
+ 428:	fc                   	cld
+ 429:	f3 aa                	rep stos %al,%es:(%edi)
+ 42b:	89 ca                	mov    %ecx,%edx
+ 42d:	89 fb                	mov    %edi,%ebx
+ 42f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 432:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 435:	90                   	nop
+ 436:	5b                   	pop    %ebx
+ 437:	5f                   	pop    %edi
+ 438:	5d                   	pop    %ebp
+ 439:	c3                   	ret
+
+0000043a <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 43a:	55                   	push   %ebp
+ 43b:	89 e5                	mov    %esp,%ebp
+ 43d:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 446:	90                   	nop
+ 447:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 44a:	8d 42 01             	lea    0x1(%edx),%eax
+ 44d:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 450:	8b 45 08             	mov    0x8(%ebp),%eax
+ 453:	8d 48 01             	lea    0x1(%eax),%ecx
+ 456:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 459:	0f b6 12             	movzbl (%edx),%edx
+ 45c:	88 10                	mov    %dl,(%eax)
+ 45e:	0f b6 00             	movzbl (%eax),%eax
+ 461:	84 c0                	test   %al,%al
+ 463:	75 e2                	jne    447 <strcpy+0xd>
+    ;
+  return os;
+ 465:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 468:	c9                   	leave
+ 469:	c3                   	ret
+
+0000046a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 46a:	55                   	push   %ebp
+ 46b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 46d:	eb 08                	jmp    477 <strcmp+0xd>
+    p++, q++;
+ 46f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 473:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 477:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47a:	0f b6 00             	movzbl (%eax),%eax
+ 47d:	84 c0                	test   %al,%al
+ 47f:	74 10                	je     491 <strcmp+0x27>
+ 481:	8b 45 08             	mov    0x8(%ebp),%eax
+ 484:	0f b6 10             	movzbl (%eax),%edx
+ 487:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48a:	0f b6 00             	movzbl (%eax),%eax
+ 48d:	38 c2                	cmp    %al,%dl
+ 48f:	74 de                	je     46f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 491:	8b 45 08             	mov    0x8(%ebp),%eax
+ 494:	0f b6 00             	movzbl (%eax),%eax
+ 497:	0f b6 d0             	movzbl %al,%edx
+ 49a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 49d:	0f b6 00             	movzbl (%eax),%eax
+ 4a0:	0f b6 c0             	movzbl %al,%eax
+ 4a3:	29 c2                	sub    %eax,%edx
+ 4a5:	89 d0                	mov    %edx,%eax
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+
+000004a9 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 4a9:	55                   	push   %ebp
+ 4aa:	89 e5                	mov    %esp,%ebp
+ 4ac:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 4af:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 4b6:	eb 04                	jmp    4bc <strlen+0x13>
+ 4b8:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 4bc:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c2:	01 d0                	add    %edx,%eax
+ 4c4:	0f b6 00             	movzbl (%eax),%eax
+ 4c7:	84 c0                	test   %al,%al
+ 4c9:	75 ed                	jne    4b8 <strlen+0xf>
+    ;
+  return n;
+ 4cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4ce:	c9                   	leave
+ 4cf:	c3                   	ret
+
+000004d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 4d3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d6:	50                   	push   %eax
+ 4d7:	ff 75 0c             	push   0xc(%ebp)
+ 4da:	ff 75 08             	push   0x8(%ebp)
+ 4dd:	e8 32 ff ff ff       	call   414 <stosb>
+ 4e2:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 4e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4e8:	c9                   	leave
+ 4e9:	c3                   	ret
+
+000004ea <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4ea:	55                   	push   %ebp
+ 4eb:	89 e5                	mov    %esp,%ebp
+ 4ed:	83 ec 04             	sub    $0x4,%esp
+ 4f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4f3:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 4f6:	eb 14                	jmp    50c <strchr+0x22>
+    if(*s == c)
+ 4f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fb:	0f b6 00             	movzbl (%eax),%eax
+ 4fe:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 501:	75 05                	jne    508 <strchr+0x1e>
+      return (char*)s;
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	eb 13                	jmp    51b <strchr+0x31>
+  for(; *s; s++)
+ 508:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 50c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 50f:	0f b6 00             	movzbl (%eax),%eax
+ 512:	84 c0                	test   %al,%al
+ 514:	75 e2                	jne    4f8 <strchr+0xe>
+  return 0;
+ 516:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 51b:	c9                   	leave
+ 51c:	c3                   	ret
+
+0000051d <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 51d:	55                   	push   %ebp
+ 51e:	89 e5                	mov    %esp,%ebp
+ 520:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 523:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 52a:	eb 42                	jmp    56e <gets+0x51>
+    cc = read(0, &c, 1);
+ 52c:	83 ec 04             	sub    $0x4,%esp
+ 52f:	6a 01                	push   $0x1
+ 531:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 534:	50                   	push   %eax
+ 535:	6a 00                	push   $0x0
+ 537:	e8 78 01 00 00       	call   6b4 <read>
+ 53c:	83 c4 10             	add    $0x10,%esp
+ 53f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 542:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 546:	7e 33                	jle    57b <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 548:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54b:	8d 50 01             	lea    0x1(%eax),%edx
+ 54e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 551:	89 c2                	mov    %eax,%edx
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	01 c2                	add    %eax,%edx
+ 558:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 55c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 55e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 562:	3c 0a                	cmp    $0xa,%al
+ 564:	74 16                	je     57c <gets+0x5f>
+ 566:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 56a:	3c 0d                	cmp    $0xd,%al
+ 56c:	74 0e                	je     57c <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 56e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 571:	83 c0 01             	add    $0x1,%eax
+ 574:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 577:	7f b3                	jg     52c <gets+0xf>
+ 579:	eb 01                	jmp    57c <gets+0x5f>
+      break;
+ 57b:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 57c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 57f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 582:	01 d0                	add    %edx,%eax
+ 584:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 587:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 58a:	c9                   	leave
+ 58b:	c3                   	ret
+
+0000058c <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 58c:	55                   	push   %ebp
+ 58d:	89 e5                	mov    %esp,%ebp
+ 58f:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 592:	83 ec 08             	sub    $0x8,%esp
+ 595:	6a 00                	push   $0x0
+ 597:	ff 75 08             	push   0x8(%ebp)
+ 59a:	e8 3d 01 00 00       	call   6dc <open>
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 5a5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5a9:	79 07                	jns    5b2 <stat+0x26>
+    return -1;
+ 5ab:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5b0:	eb 25                	jmp    5d7 <stat+0x4b>
+  r = fstat(fd, st);
+ 5b2:	83 ec 08             	sub    $0x8,%esp
+ 5b5:	ff 75 0c             	push   0xc(%ebp)
+ 5b8:	ff 75 f4             	push   -0xc(%ebp)
+ 5bb:	e8 34 01 00 00       	call   6f4 <fstat>
+ 5c0:	83 c4 10             	add    $0x10,%esp
+ 5c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 5c6:	83 ec 0c             	sub    $0xc,%esp
+ 5c9:	ff 75 f4             	push   -0xc(%ebp)
+ 5cc:	e8 f3 00 00 00       	call   6c4 <close>
+ 5d1:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 5d4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 5d7:	c9                   	leave
+ 5d8:	c3                   	ret
+
+000005d9 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5d9:	55                   	push   %ebp
+ 5da:	89 e5                	mov    %esp,%ebp
+ 5dc:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 5df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 5e6:	eb 25                	jmp    60d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 5e8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 5eb:	89 d0                	mov    %edx,%eax
+ 5ed:	c1 e0 02             	shl    $0x2,%eax
+ 5f0:	01 d0                	add    %edx,%eax
+ 5f2:	01 c0                	add    %eax,%eax
+ 5f4:	89 c1                	mov    %eax,%ecx
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f9:	8d 50 01             	lea    0x1(%eax),%edx
+ 5fc:	89 55 08             	mov    %edx,0x8(%ebp)
+ 5ff:	0f b6 00             	movzbl (%eax),%eax
+ 602:	0f be c0             	movsbl %al,%eax
+ 605:	01 c8                	add    %ecx,%eax
+ 607:	83 e8 30             	sub    $0x30,%eax
+ 60a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 60d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 610:	0f b6 00             	movzbl (%eax),%eax
+ 613:	3c 2f                	cmp    $0x2f,%al
+ 615:	7e 0a                	jle    621 <atoi+0x48>
+ 617:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61a:	0f b6 00             	movzbl (%eax),%eax
+ 61d:	3c 39                	cmp    $0x39,%al
+ 61f:	7e c7                	jle    5e8 <atoi+0xf>
+  return n;
+ 621:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 624:	c9                   	leave
+ 625:	c3                   	ret
+
+00000626 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 626:	55                   	push   %ebp
+ 627:	89 e5                	mov    %esp,%ebp
+ 629:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 62c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 632:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 635:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 638:	eb 17                	jmp    651 <memmove+0x2b>
+    *dst++ = *src++;
+ 63a:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 63d:	8d 42 01             	lea    0x1(%edx),%eax
+ 640:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 643:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 646:	8d 48 01             	lea    0x1(%eax),%ecx
+ 649:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 64c:	0f b6 12             	movzbl (%edx),%edx
+ 64f:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 651:	8b 45 10             	mov    0x10(%ebp),%eax
+ 654:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 657:	89 55 10             	mov    %edx,0x10(%ebp)
+ 65a:	85 c0                	test   %eax,%eax
+ 65c:	7f dc                	jg     63a <memmove+0x14>
+  return vdst;
+ 65e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 661:	c9                   	leave
+ 662:	c3                   	ret
+
+00000663 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 663:	55                   	push   %ebp
+ 664:	89 e5                	mov    %esp,%ebp
+ 666:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 669:	83 ec 0c             	sub    $0xc,%esp
+ 66c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 66f:	50                   	push   %eax
+ 670:	e8 ff 00 00 00       	call   774 <nanouptime>
+ 675:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 678:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 67b:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 681:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 684:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 689:	f7 e2                	mul    %edx
+ 68b:	89 d0                	mov    %edx,%eax
+ 68d:	c1 e8 06             	shr    $0x6,%eax
+ 690:	01 c8                	add    %ecx,%eax
+}
+ 692:	c9                   	leave
+ 693:	c3                   	ret
+
+00000694 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 694:	b8 01 00 00 00       	mov    $0x1,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <exit>:
+SYSCALL(exit)
+ 69c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <wait>:
+SYSCALL(wait)
+ 6a4:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <pipe>:
+SYSCALL(pipe)
+ 6ac:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <read>:
+SYSCALL(read)
+ 6b4:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <write>:
+SYSCALL(write)
+ 6bc:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <close>:
+SYSCALL(close)
+ 6c4:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <kill>:
+SYSCALL(kill)
+ 6cc:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <exec>:
+SYSCALL(exec)
+ 6d4:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <open>:
+SYSCALL(open)
+ 6dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <mknod>:
+SYSCALL(mknod)
+ 6e4:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <unlink>:
+SYSCALL(unlink)
+ 6ec:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <fstat>:
+SYSCALL(fstat)
+ 6f4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <link>:
+SYSCALL(link)
+ 6fc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <mkdir>:
+SYSCALL(mkdir)
+ 704:	b8 14 00 00 00       	mov    $0x14,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <chdir>:
+SYSCALL(chdir)
+ 70c:	b8 09 00 00 00       	mov    $0x9,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <dup>:
+SYSCALL(dup)
+ 714:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <getpid>:
+SYSCALL(getpid)
+ 71c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <sbrk>:
+SYSCALL(sbrk)
+ 724:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <sleep>:
+SYSCALL(sleep)
+ 72c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <uptime>:
+SYSCALL(uptime)
+ 734:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <saveProc>:
+SYSCALL(saveProc)
+ 73c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <loadProc>:
+SYSCALL(loadProc)
+ 744:	b8 17 00 00 00       	mov    $0x17,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <setpriority>:
+SYSCALL(setpriority)
+ 74c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <setaffinity>:
+SYSCALL(setaffinity)
+ 754:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <getaffinity>:
+SYSCALL(getaffinity)
+ 75c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <nanosleep>:
+SYSCALL(nanosleep)
+ 764:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <cpustat>:
+SYSCALL(cpustat)
+ 76c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <nanouptime>:
+SYSCALL(nanouptime)
+ 774:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <settickets>:
+SYSCALL(settickets)
+ 77c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <setdeadline>:
+SYSCALL(setdeadline)
+ 784:	b8 20 00 00 00       	mov    $0x20,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <rtstat>:
+SYSCALL(rtstat)
+ 78c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <schedstat>:
+SYSCALL(schedstat)
+ 794:	b8 22 00 00 00       	mov    $0x22,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <waitpid>:
+SYSCALL(waitpid)
+ 79c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <clone>:
+SYSCALL(clone)
+ 7a4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <futexwait>:
+SYSCALL(futexwait)
+ 7ac:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <futexwake>:
+SYSCALL(futexwake)
+ 7b4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <lockstat>:
+SYSCALL(lockstat)
+ 7bc:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <dcachestat>:
+SYSCALL(dcachestat)
+ 7c4:	b8 28 00 00 00       	mov    $0x28,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7cc:	55                   	push   %ebp
+ 7cd:	89 e5                	mov    %esp,%ebp
+ 7cf:	83 ec 18             	sub    $0x18,%esp
+ 7d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d5:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7d8:	83 ec 04             	sub    $0x4,%esp
+ 7db:	6a 01                	push   $0x1
+ 7dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7e0:	50                   	push   %eax
+ 7e1:	ff 75 08             	push   0x8(%ebp)
+ 7e4:	e8 d3 fe ff ff       	call   6bc <write>
+ 7e9:	83 c4 10             	add    $0x10,%esp
+}
+ 7ec:	90                   	nop
+ 7ed:	c9                   	leave
+ 7ee:	c3                   	ret
+
+000007ef <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7ef:	55                   	push   %ebp
+ 7f0:	89 e5                	mov    %esp,%ebp
+ 7f2:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7f5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7fc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 800:	74 17                	je     819 <printint+0x2a>
+ 802:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 806:	79 11                	jns    819 <printint+0x2a>
+    neg = 1;
+ 808:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 80f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 812:	f7 d8                	neg    %eax
+ 814:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 817:	eb 06                	jmp    81f <printint+0x30>
+  } else {
+    x = xx;
+ 819:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 81c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 81f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 826:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 829:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 82c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 831:	f7 f1                	div    %ecx
+ 833:	89 d1                	mov    %edx,%ecx
+ 835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 838:	8d 50 01             	lea    0x1(%eax),%edx
+ 83b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 83e:	0f b6 91 58 0d 00 00 	movzbl 0xd58(%ecx),%edx
+ 845:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 849:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 84c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 84f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 854:	f7 f1                	div    %ecx
+ 856:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 859:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 85d:	75 c7                	jne    826 <printint+0x37>
+  if(neg)
+ 85f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 863:	74 2d                	je     892 <printint+0xa3>
+    buf[i++] = '-';
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	8d 50 01             	lea    0x1(%eax),%edx
+ 86b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 86e:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 873:	eb 1d                	jmp    892 <printint+0xa3>
+    putc(fd, buf[i]);
+ 875:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 878:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 87b:	01 d0                	add    %edx,%eax
+ 87d:	0f b6 00             	movzbl (%eax),%eax
+ 880:	0f be c0             	movsbl %al,%eax
+ 883:	83 ec 08             	sub    $0x8,%esp
+ 886:	50                   	push   %eax
+ 887:	ff 75 08             	push   0x8(%ebp)
+ 88a:	e8 3d ff ff ff       	call   7cc <putc>
+ 88f:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 892:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 896:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 89a:	79 d9                	jns    875 <printint+0x86>
+}
+ 89c:	90                   	nop
+ 89d:	90                   	nop
+ 89e:	c9                   	leave
+ 89f:	c3                   	ret
+
+000008a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8a6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8ad:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8b0:	83 c0 04             	add    $0x4,%eax
+ 8b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8b6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8bd:	e9 59 01 00 00       	jmp    a1b <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8c5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c8:	01 d0                	add    %edx,%eax
+ 8ca:	0f b6 00             	movzbl (%eax),%eax
+ 8cd:	0f be c0             	movsbl %al,%eax
+ 8d0:	25 ff 00 00 00       	and    $0xff,%eax
+ 8d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8d8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8dc:	75 2c                	jne    90a <printf+0x6a>
+      if(c == '%'){
+ 8de:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8e2:	75 0c                	jne    8f0 <printf+0x50>
+        state = '%';
+ 8e4:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8eb:	e9 27 01 00 00       	jmp    a17 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8f3:	0f be c0             	movsbl %al,%eax
+ 8f6:	83 ec 08             	sub    $0x8,%esp
+ 8f9:	50                   	push   %eax
+ 8fa:	ff 75 08             	push   0x8(%ebp)
+ 8fd:	e8 ca fe ff ff       	call   7cc <putc>
+ 902:	83 c4 10             	add    $0x10,%esp
+ 905:	e9 0d 01 00 00       	jmp    a17 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 90a:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 90e:	0f 85 03 01 00 00    	jne    a17 <printf+0x177>
+      if(c == 'd'){
+ 914:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 918:	75 1e                	jne    938 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 91a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 91d:	8b 00                	mov    (%eax),%eax
+ 91f:	6a 01                	push   $0x1
+ 921:	6a 0a                	push   $0xa
+ 923:	50                   	push   %eax
+ 924:	ff 75 08             	push   0x8(%ebp)
+ 927:	e8 c3 fe ff ff       	call   7ef <printint>
+ 92c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 92f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 933:	e9 d8 00 00 00       	jmp    a10 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 938:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 93c:	74 06                	je     944 <printf+0xa4>
+ 93e:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 942:	75 1e                	jne    962 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 944:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 947:	8b 00                	mov    (%eax),%eax
+ 949:	6a 00                	push   $0x0
+ 94b:	6a 10                	push   $0x10
+ 94d:	50                   	push   %eax
+ 94e:	ff 75 08             	push   0x8(%ebp)
+ 951:	e8 99 fe ff ff       	call   7ef <printint>
+ 956:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 959:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 95d:	e9 ae 00 00 00       	jmp    a10 <printf+0x170>
+      } else if(c == 's'){
+ 962:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 966:	75 43                	jne    9ab <printf+0x10b>
+        s = (char*)*ap;
+ 968:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 96b:	8b 00                	mov    (%eax),%eax
+ 96d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 970:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 974:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 978:	75 25                	jne    99f <printf+0xff>
+          s = "(null)";
+ 97a:	c7 45 f4 05 0b 00 00 	movl   $0xb05,-0xc(%ebp)
+        while(*s != 0){
+ 981:	eb 1c                	jmp    99f <printf+0xff>
+          putc(fd, *s);
+ 983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 986:	0f b6 00             	movzbl (%eax),%eax
+ 989:	0f be c0             	movsbl %al,%eax
+ 98c:	83 ec 08             	sub    $0x8,%esp
+ 98f:	50                   	push   %eax
+ 990:	ff 75 08             	push   0x8(%ebp)
+ 993:	e8 34 fe ff ff       	call   7cc <putc>
+ 998:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 99b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 99f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a2:	0f b6 00             	movzbl (%eax),%eax
+ 9a5:	84 c0                	test   %al,%al
+ 9a7:	75 da                	jne    983 <printf+0xe3>
+ 9a9:	eb 65                	jmp    a10 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9ab:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9af:	75 1d                	jne    9ce <printf+0x12e>
+        putc(fd, *ap);
+ 9b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b4:	8b 00                	mov    (%eax),%eax
+ 9b6:	0f be c0             	movsbl %al,%eax
+ 9b9:	83 ec 08             	sub    $0x8,%esp
+ 9bc:	50                   	push   %eax
+ 9bd:	ff 75 08             	push   0x8(%ebp)
+ 9c0:	e8 07 fe ff ff       	call   7cc <putc>
+ 9c5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9c8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9cc:	eb 42                	jmp    a10 <printf+0x170>
+      } else if(c == '%'){
+ 9ce:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9d2:	75 17                	jne    9eb <printf+0x14b>
+        putc(fd, c);
+ 9d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9d7:	0f be c0             	movsbl %al,%eax
+ 9da:	83 ec 08             	sub    $0x8,%esp
+ 9dd:	50                   	push   %eax
+ 9de:	ff 75 08             	push   0x8(%ebp)
+ 9e1:	e8 e6 fd ff ff       	call   7cc <putc>
+ 9e6:	83 c4 10             	add    $0x10,%esp
+ 9e9:	eb 25                	jmp    a10 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9eb:	83 ec 08             	sub    $0x8,%esp
+ 9ee:	6a 25                	push   $0x25
+ 9f0:	ff 75 08             	push   0x8(%ebp)
+ 9f3:	e8 d4 fd ff ff       	call   7cc <putc>
+ 9f8:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9fe:	0f be c0             	movsbl %al,%eax
+ a01:	83 ec 08             	sub    $0x8,%esp
+ a04:	50                   	push   %eax
+ a05:	ff 75 08             	push   0x8(%ebp)
+ a08:	e8 bf fd ff ff       	call   7cc <putc>
+ a0d:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a10:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a17:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a21:	01 d0                	add    %edx,%eax
+ a23:	0f b6 00             	movzbl (%eax),%eax
+ a26:	84 c0                	test   %al,%al
+ a28:	0f 85 94 fe ff ff    	jne    8c2 <printf+0x22>
+    }
+  }
+}
+ a2e:	90                   	nop
+ a2f:	90                   	nop
+ a30:	c9                   	leave
+ a31:	c3                   	ret
@@ -0,0 +1,93 @@
+// Print scheduler latency: how long processes waited on the
+// run queue before being dispatched and how long they ran once
+// there, as log2 histograms.  schedlat [ticks] reports each CPU
+// over an interval, one second by default; schedlat -p pid
+// reports a process over its lifetime.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "cpustat.h"
+
+#define MAXCPU 8
+
+static void
+report(char *what, struct schedstat *st)
+{
+  uint n;
+  int b;
+
+  n = st->nvcsw + st->nivcsw;
+  printf(1, "%s: %d switches, %d voluntary, %d preempted\n",
+         what, n, st->nvcsw, st->nivcsw);
+  if(n == 0)
+    return;
+  printf(1, "  delay avg %dus, run avg %dus\n",
+         st->delayus / n, st->runus / n);
+  for(b = 0; b < NSCHEDHIST; b++){
+    if(st->delay[b] == 0 && st->slice[b] == 0)
+      continue;
+    if(b == 0)
+      printf(1, "  <1us");
+    else if(b == NSCHEDHIST - 1)
+      printf(1, "  >=%dus", 1 << (b - 1));
+    else
+      printf(1, "  %d-%dus", 1 << (b - 1), (1 << b) - 1);
+    printf(1, ": %d waited, %d ran\n", st->delay[b], st->slice[b]);
+  }
+}
+
+// a = b - a, field by field.
+static void
+delta(struct schedstat *a, struct schedstat *b)
+{
+  int i;
+
+  a->nvcsw = b->nvcsw - a->nvcsw;
+  a->nivcsw = b->nivcsw - a->nivcsw;
+  a->delayus = b->delayus - a->delayus;
+  a->runus = b->runus - a->runus;
+  for(i = 0; i < NSCHEDHIST; i++){
+    a->delay[i] = b->delay[i] - a->delay[i];
+    a->slice[i] = b->slice[i] - a->slice[i];
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  static struct cpustat a[MAXCPU], b;
+  struct schedstat st;
+  char name[8];
+  int c, n, interval;
+
+  if(argc == 3 && strcmp(argv[1], "-p") == 0){
+    if(schedstat(atoi(argv[2]), &st) < 0){
+      printf(2, "schedlat: no process %s\n", argv[2]);
+      exit();
+    }
+    report(argv[2], &st);
+    exit();
+  }
+
+  interval = 100;
+  if(argc > 2 || (argc > 1 && (interval = atoi(argv[1])) <= 0)){
+    printf(2, "usage: schedlat [ticks]\n");
+    printf(2, "       schedlat -p pid\n");
+    exit();
+  }
+
+  for(n = 0; n < MAXCPU && cpustat(n, &a[n]) == 0; n++)
+    ;
+  sleep(interval);
+  for(c = 0; c < n; c++){
+    if(cpustat(c, &b) < 0)
+      break;
+    delta(&a[c].sched, &b.sched);
+    strcpy(name, "cpu0");
+    name[3] += c;
+    report(name, &a[c].sched);
+  }
+  exit();
+}
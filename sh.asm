@@ -0,0 +1,2958 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <runcmd>:
+struct cmd *parsecmd(char*);
+
+// Execute cmd.  Never returns.
+void
+runcmd(struct cmd *cmd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+       6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+       a:	75 05                	jne    11 <runcmd+0x11>
+    exit();
+       c:	e8 55 0f 00 00       	call   f66 <exit>
+  
+  switch(cmd->type){
+      11:	8b 45 08             	mov    0x8(%ebp),%eax
+      14:	8b 00                	mov    (%eax),%eax
+      16:	83 f8 05             	cmp    $0x5,%eax
+      19:	77 09                	ja     24 <runcmd+0x24>
+      1b:	8b 04 85 0c 17 00 00 	mov    0x170c(,%eax,4),%eax
+      22:	ff e0                	jmp    *%eax
+  default:
+    panic("runcmd");
+      24:	83 ec 0c             	sub    $0xc,%esp
+      27:	68 9c 16 00 00       	push   $0x169c
+      2c:	e8 c8 03 00 00       	call   3f9 <panic>
+      31:	83 c4 10             	add    $0x10,%esp
+
+  case EXEC:
+      printf(1, "runcmd exec\n");
+      34:	83 ec 08             	sub    $0x8,%esp
+      37:	68 a3 16 00 00       	push   $0x16a3
+      3c:	6a 01                	push   $0x1
+      3e:	e8 27 11 00 00       	call   116a <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    ecmd = (struct execcmd*)cmd;
+      46:	8b 45 08             	mov    0x8(%ebp),%eax
+      49:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(ecmd->argv[0] == 0)
+      4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      4f:	8b 40 04             	mov    0x4(%eax),%eax
+      52:	85 c0                	test   %eax,%eax
+      54:	75 05                	jne    5b <runcmd+0x5b>
+      exit();
+      56:	e8 0b 0f 00 00       	call   f66 <exit>
+    exec(ecmd->argv[0], ecmd->argv);
+      5b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      5e:	8d 50 04             	lea    0x4(%eax),%edx
+      61:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      64:	8b 40 04             	mov    0x4(%eax),%eax
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	52                   	push   %edx
+      6b:	50                   	push   %eax
+      6c:	e8 2d 0f 00 00       	call   f9e <exec>
+      71:	83 c4 10             	add    $0x10,%esp
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      74:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      77:	8b 40 04             	mov    0x4(%eax),%eax
+      7a:	83 ec 04             	sub    $0x4,%esp
+      7d:	50                   	push   %eax
+      7e:	68 b0 16 00 00       	push   $0x16b0
+      83:	6a 02                	push   $0x2
+      85:	e8 e0 10 00 00       	call   116a <printf>
+      8a:	83 c4 10             	add    $0x10,%esp
+    break;
+      8d:	e9 0e 02 00 00       	jmp    2a0 <runcmd+0x2a0>
+
+  case REDIR:
+      printf(1, "runcmd redir\n");
+      92:	83 ec 08             	sub    $0x8,%esp
+      95:	68 c0 16 00 00       	push   $0x16c0
+      9a:	6a 01                	push   $0x1
+      9c:	e8 c9 10 00 00       	call   116a <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+          rcmd = (struct redircmd*)cmd;
+      a4:	8b 45 08             	mov    0x8(%ebp),%eax
+      a7:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    close(rcmd->fd);
+      aa:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      ad:	8b 40 14             	mov    0x14(%eax),%eax
+      b0:	83 ec 0c             	sub    $0xc,%esp
+      b3:	50                   	push   %eax
+      b4:	e8 d5 0e 00 00       	call   f8e <close>
+      b9:	83 c4 10             	add    $0x10,%esp
+    if(open(rcmd->file, rcmd->mode) < 0){
+      bc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      bf:	8b 50 10             	mov    0x10(%eax),%edx
+      c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      c5:	8b 40 08             	mov    0x8(%eax),%eax
+      c8:	83 ec 08             	sub    $0x8,%esp
+      cb:	52                   	push   %edx
+      cc:	50                   	push   %eax
+      cd:	e8 d4 0e 00 00       	call   fa6 <open>
+      d2:	83 c4 10             	add    $0x10,%esp
+      d5:	85 c0                	test   %eax,%eax
+      d7:	79 1e                	jns    f7 <runcmd+0xf7>
+      printf(2, "open %s failed\n", rcmd->file);
+      d9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      dc:	8b 40 08             	mov    0x8(%eax),%eax
+      df:	83 ec 04             	sub    $0x4,%esp
+      e2:	50                   	push   %eax
+      e3:	68 ce 16 00 00       	push   $0x16ce
+      e8:	6a 02                	push   $0x2
+      ea:	e8 7b 10 00 00       	call   116a <printf>
+      ef:	83 c4 10             	add    $0x10,%esp
+      exit();
+      f2:	e8 6f 0e 00 00       	call   f66 <exit>
+    }
+    runcmd(rcmd->cmd);
+      f7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      fa:	8b 40 04             	mov    0x4(%eax),%eax
+      fd:	83 ec 0c             	sub    $0xc,%esp
+     100:	50                   	push   %eax
+     101:	e8 fa fe ff ff       	call   0 <runcmd>
+     106:	83 c4 10             	add    $0x10,%esp
+    break;
+     109:	e9 92 01 00 00       	jmp    2a0 <runcmd+0x2a0>
+
+  case LIST:
+      printf(1, "runcmd list\n");
+     10e:	83 ec 08             	sub    $0x8,%esp
+     111:	68 de 16 00 00       	push   $0x16de
+     116:	6a 01                	push   $0x1
+     118:	e8 4d 10 00 00       	call   116a <printf>
+     11d:	83 c4 10             	add    $0x10,%esp
+          lcmd = (struct listcmd*)cmd;
+     120:	8b 45 08             	mov    0x8(%ebp),%eax
+     123:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fork1() == 0)
+     126:	e8 ee 02 00 00       	call   419 <fork1>
+     12b:	85 c0                	test   %eax,%eax
+     12d:	75 12                	jne    141 <runcmd+0x141>
+      runcmd(lcmd->left);
+     12f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     132:	8b 40 04             	mov    0x4(%eax),%eax
+     135:	83 ec 0c             	sub    $0xc,%esp
+     138:	50                   	push   %eax
+     139:	e8 c2 fe ff ff       	call   0 <runcmd>
+     13e:	83 c4 10             	add    $0x10,%esp
+    wait();
+     141:	e8 28 0e 00 00       	call   f6e <wait>
+    runcmd(lcmd->right);
+     146:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     149:	8b 40 08             	mov    0x8(%eax),%eax
+     14c:	83 ec 0c             	sub    $0xc,%esp
+     14f:	50                   	push   %eax
+     150:	e8 ab fe ff ff       	call   0 <runcmd>
+     155:	83 c4 10             	add    $0x10,%esp
+    break;
+     158:	e9 43 01 00 00       	jmp    2a0 <runcmd+0x2a0>
+
+  case PIPE:
+      printf(1, "runcmd pipe\n");
+     15d:	83 ec 08             	sub    $0x8,%esp
+     160:	68 eb 16 00 00       	push   $0x16eb
+     165:	6a 01                	push   $0x1
+     167:	e8 fe 0f 00 00       	call   116a <printf>
+     16c:	83 c4 10             	add    $0x10,%esp
+          pcmd = (struct pipecmd*)cmd;
+     16f:	8b 45 08             	mov    0x8(%ebp),%eax
+     172:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(pipe(p) < 0)
+     175:	83 ec 0c             	sub    $0xc,%esp
+     178:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     17b:	50                   	push   %eax
+     17c:	e8 f5 0d 00 00       	call   f76 <pipe>
+     181:	83 c4 10             	add    $0x10,%esp
+     184:	85 c0                	test   %eax,%eax
+     186:	79 10                	jns    198 <runcmd+0x198>
+      panic("pipe");
+     188:	83 ec 0c             	sub    $0xc,%esp
+     18b:	68 f8 16 00 00       	push   $0x16f8
+     190:	e8 64 02 00 00       	call   3f9 <panic>
+     195:	83 c4 10             	add    $0x10,%esp
+    if(fork1() == 0){
+     198:	e8 7c 02 00 00       	call   419 <fork1>
+     19d:	85 c0                	test   %eax,%eax
+     19f:	75 4c                	jne    1ed <runcmd+0x1ed>
+      close(1);
+     1a1:	83 ec 0c             	sub    $0xc,%esp
+     1a4:	6a 01                	push   $0x1
+     1a6:	e8 e3 0d 00 00       	call   f8e <close>
+     1ab:	83 c4 10             	add    $0x10,%esp
+      dup(p[1]);
+     1ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1b1:	83 ec 0c             	sub    $0xc,%esp
+     1b4:	50                   	push   %eax
+     1b5:	e8 24 0e 00 00       	call   fde <dup>
+     1ba:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     1bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     1c0:	83 ec 0c             	sub    $0xc,%esp
+     1c3:	50                   	push   %eax
+     1c4:	e8 c5 0d 00 00       	call   f8e <close>
+     1c9:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     1cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     1cf:	83 ec 0c             	sub    $0xc,%esp
+     1d2:	50                   	push   %eax
+     1d3:	e8 b6 0d 00 00       	call   f8e <close>
+     1d8:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->left);
+     1db:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     1de:	8b 40 04             	mov    0x4(%eax),%eax
+     1e1:	83 ec 0c             	sub    $0xc,%esp
+     1e4:	50                   	push   %eax
+     1e5:	e8 16 fe ff ff       	call   0 <runcmd>
+     1ea:	83 c4 10             	add    $0x10,%esp
+    }
+    if(fork1() == 0){
+     1ed:	e8 27 02 00 00       	call   419 <fork1>
+     1f2:	85 c0                	test   %eax,%eax
+     1f4:	75 4c                	jne    242 <runcmd+0x242>
+      close(0);
+     1f6:	83 ec 0c             	sub    $0xc,%esp
+     1f9:	6a 00                	push   $0x0
+     1fb:	e8 8e 0d 00 00       	call   f8e <close>
+     200:	83 c4 10             	add    $0x10,%esp
+      dup(p[0]);
+     203:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     206:	83 ec 0c             	sub    $0xc,%esp
+     209:	50                   	push   %eax
+     20a:	e8 cf 0d 00 00       	call   fde <dup>
+     20f:	83 c4 10             	add    $0x10,%esp
+      close(p[0]);
+     212:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     215:	83 ec 0c             	sub    $0xc,%esp
+     218:	50                   	push   %eax
+     219:	e8 70 0d 00 00       	call   f8e <close>
+     21e:	83 c4 10             	add    $0x10,%esp
+      close(p[1]);
+     221:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     224:	83 ec 0c             	sub    $0xc,%esp
+     227:	50                   	push   %eax
+     228:	e8 61 0d 00 00       	call   f8e <close>
+     22d:	83 c4 10             	add    $0x10,%esp
+      runcmd(pcmd->right);
+     230:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     233:	8b 40 08             	mov    0x8(%eax),%eax
+     236:	83 ec 0c             	sub    $0xc,%esp
+     239:	50                   	push   %eax
+     23a:	e8 c1 fd ff ff       	call   0 <runcmd>
+     23f:	83 c4 10             	add    $0x10,%esp
+    }
+    close(p[0]);
+     242:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     245:	83 ec 0c             	sub    $0xc,%esp
+     248:	50                   	push   %eax
+     249:	e8 40 0d 00 00       	call   f8e <close>
+     24e:	83 c4 10             	add    $0x10,%esp
+    close(p[1]);
+     251:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     254:	83 ec 0c             	sub    $0xc,%esp
+     257:	50                   	push   %eax
+     258:	e8 31 0d 00 00       	call   f8e <close>
+     25d:	83 c4 10             	add    $0x10,%esp
+    wait();
+     260:	e8 09 0d 00 00       	call   f6e <wait>
+    wait();
+     265:	e8 04 0d 00 00       	call   f6e <wait>
+    break;
+     26a:	eb 34                	jmp    2a0 <runcmd+0x2a0>
+    
+  case BACK:
+      printf(1, "runcmd back\n");
+     26c:	83 ec 08             	sub    $0x8,%esp
+     26f:	68 fd 16 00 00       	push   $0x16fd
+     274:	6a 01                	push   $0x1
+     276:	e8 ef 0e 00 00       	call   116a <printf>
+     27b:	83 c4 10             	add    $0x10,%esp
+
+          bcmd = (struct backcmd*)cmd;
+     27e:	8b 45 08             	mov    0x8(%ebp),%eax
+     281:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(fork1() == 0)
+     284:	e8 90 01 00 00       	call   419 <fork1>
+     289:	85 c0                	test   %eax,%eax
+     28b:	75 12                	jne    29f <runcmd+0x29f>
+      runcmd(bcmd->cmd);
+     28d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     290:	8b 40 04             	mov    0x4(%eax),%eax
+     293:	83 ec 0c             	sub    $0xc,%esp
+     296:	50                   	push   %eax
+     297:	e8 64 fd ff ff       	call   0 <runcmd>
+     29c:	83 c4 10             	add    $0x10,%esp
+    break;
+     29f:	90                   	nop
+  }
+  exit();
+     2a0:	e8 c1 0c 00 00       	call   f66 <exit>
+
+000002a5 <getcmd>:
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+     2a5:	55                   	push   %ebp
+     2a6:	89 e5                	mov    %esp,%ebp
+     2a8:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "$ ");
+     2ab:	83 ec 08             	sub    $0x8,%esp
+     2ae:	68 24 17 00 00       	push   $0x1724
+     2b3:	6a 02                	push   $0x2
+     2b5:	e8 b0 0e 00 00       	call   116a <printf>
+     2ba:	83 c4 10             	add    $0x10,%esp
+  memset(buf, 0, nbuf);
+     2bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	50                   	push   %eax
+     2c4:	6a 00                	push   $0x0
+     2c6:	ff 75 08             	push   0x8(%ebp)
+     2c9:	e8 cc 0a 00 00       	call   d9a <memset>
+     2ce:	83 c4 10             	add    $0x10,%esp
+  gets(buf, nbuf);
+     2d1:	83 ec 08             	sub    $0x8,%esp
+     2d4:	ff 75 0c             	push   0xc(%ebp)
+     2d7:	ff 75 08             	push   0x8(%ebp)
+     2da:	e8 08 0b 00 00       	call   de7 <gets>
+     2df:	83 c4 10             	add    $0x10,%esp
+  if(buf[0] == 0) // EOF
+     2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e5:	0f b6 00             	movzbl (%eax),%eax
+     2e8:	84 c0                	test   %al,%al
+     2ea:	75 07                	jne    2f3 <getcmd+0x4e>
+    return -1;
+     2ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     2f1:	eb 05                	jmp    2f8 <getcmd+0x53>
+  return 0;
+     2f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2f8:	c9                   	leave
+     2f9:	c3                   	ret
+
+000002fa <main>:
+
+int
+main(void)
+{
+     2fa:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2fe:	83 e4 f0             	and    $0xfffffff0,%esp
+     301:	ff 71 fc             	push   -0x4(%ecx)
+     304:	55                   	push   %ebp
+     305:	89 e5                	mov    %esp,%ebp
+     307:	51                   	push   %ecx
+     308:	83 ec 14             	sub    $0x14,%esp
+  static char buf[100];
+  int fd;
+  
+  // Assumes three file descriptors open.
+  while((fd = open("console", O_RDWR)) >= 0){
+     30b:	eb 16                	jmp    323 <main+0x29>
+    if(fd >= 3){
+     30d:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     311:	7e 10                	jle    323 <main+0x29>
+      close(fd);
+     313:	83 ec 0c             	sub    $0xc,%esp
+     316:	ff 75 f4             	push   -0xc(%ebp)
+     319:	e8 70 0c 00 00       	call   f8e <close>
+     31e:	83 c4 10             	add    $0x10,%esp
+      break;
+     321:	eb 1b                	jmp    33e <main+0x44>
+  while((fd = open("console", O_RDWR)) >= 0){
+     323:	83 ec 08             	sub    $0x8,%esp
+     326:	6a 02                	push   $0x2
+     328:	68 27 17 00 00       	push   $0x1727
+     32d:	e8 74 0c 00 00       	call   fa6 <open>
+     332:	83 c4 10             	add    $0x10,%esp
+     335:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     338:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     33c:	79 cf                	jns    30d <main+0x13>
+    }
+  }
+  
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     33e:	e9 97 00 00 00       	jmp    3da <main+0xe0>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     343:	0f b6 05 e0 1c 00 00 	movzbl 0x1ce0,%eax
+     34a:	3c 63                	cmp    $0x63,%al
+     34c:	75 5f                	jne    3ad <main+0xb3>
+     34e:	0f b6 05 e1 1c 00 00 	movzbl 0x1ce1,%eax
+     355:	3c 64                	cmp    $0x64,%al
+     357:	75 54                	jne    3ad <main+0xb3>
+     359:	0f b6 05 e2 1c 00 00 	movzbl 0x1ce2,%eax
+     360:	3c 20                	cmp    $0x20,%al
+     362:	75 49                	jne    3ad <main+0xb3>
+      // Clumsy but will have to do for now.
+      // Chdir has no effect on the parent if run in the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+     364:	83 ec 0c             	sub    $0xc,%esp
+     367:	68 e0 1c 00 00       	push   $0x1ce0
+     36c:	e8 02 0a 00 00       	call   d73 <strlen>
+     371:	83 c4 10             	add    $0x10,%esp
+     374:	83 e8 01             	sub    $0x1,%eax
+     377:	c6 80 e0 1c 00 00 00 	movb   $0x0,0x1ce0(%eax)
+      if(chdir(buf+3) < 0)
+     37e:	b8 e3 1c 00 00       	mov    $0x1ce3,%eax
+     383:	83 ec 0c             	sub    $0xc,%esp
+     386:	50                   	push   %eax
+     387:	e8 4a 0c 00 00       	call   fd6 <chdir>
+     38c:	83 c4 10             	add    $0x10,%esp
+     38f:	85 c0                	test   %eax,%eax
+     391:	79 46                	jns    3d9 <main+0xdf>
+        printf(2, "cannot cd %s\n", buf+3);
+     393:	b8 e3 1c 00 00       	mov    $0x1ce3,%eax
+     398:	83 ec 04             	sub    $0x4,%esp
+     39b:	50                   	push   %eax
+     39c:	68 2f 17 00 00       	push   $0x172f
+     3a1:	6a 02                	push   $0x2
+     3a3:	e8 c2 0d 00 00       	call   116a <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+      continue;
+     3ab:	eb 2c                	jmp    3d9 <main+0xdf>
+    }
+    if(fork1() == 0)
+     3ad:	e8 67 00 00 00       	call   419 <fork1>
+     3b2:	85 c0                	test   %eax,%eax
+     3b4:	75 1c                	jne    3d2 <main+0xd8>
+      runcmd(parsecmd(buf));
+     3b6:	83 ec 0c             	sub    $0xc,%esp
+     3b9:	68 e0 1c 00 00       	push   $0x1ce0
+     3be:	e8 ad 03 00 00       	call   770 <parsecmd>
+     3c3:	83 c4 10             	add    $0x10,%esp
+     3c6:	83 ec 0c             	sub    $0xc,%esp
+     3c9:	50                   	push   %eax
+     3ca:	e8 31 fc ff ff       	call   0 <runcmd>
+     3cf:	83 c4 10             	add    $0x10,%esp
+    wait();
+     3d2:	e8 97 0b 00 00       	call   f6e <wait>
+     3d7:	eb 01                	jmp    3da <main+0xe0>
+      continue;
+     3d9:	90                   	nop
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     3da:	83 ec 08             	sub    $0x8,%esp
+     3dd:	6a 64                	push   $0x64
+     3df:	68 e0 1c 00 00       	push   $0x1ce0
+     3e4:	e8 bc fe ff ff       	call   2a5 <getcmd>
+     3e9:	83 c4 10             	add    $0x10,%esp
+     3ec:	85 c0                	test   %eax,%eax
+     3ee:	0f 89 4f ff ff ff    	jns    343 <main+0x49>
+  }
+  exit();
+     3f4:	e8 6d 0b 00 00       	call   f66 <exit>
+
+000003f9 <panic>:
+}
+
+void
+panic(char *s)
+{
+     3f9:	55                   	push   %ebp
+     3fa:	89 e5                	mov    %esp,%ebp
+     3fc:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "%s\n", s);
+     3ff:	83 ec 04             	sub    $0x4,%esp
+     402:	ff 75 08             	push   0x8(%ebp)
+     405:	68 3d 17 00 00       	push   $0x173d
+     40a:	6a 02                	push   $0x2
+     40c:	e8 59 0d 00 00       	call   116a <printf>
+     411:	83 c4 10             	add    $0x10,%esp
+  exit();
+     414:	e8 4d 0b 00 00       	call   f66 <exit>
+
+00000419 <fork1>:
+}
+
+int
+fork1(void)
+{
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+  
+  pid = fork();
+     41f:	e8 3a 0b 00 00       	call   f5e <fork>
+     424:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid == -1)
+     427:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     42b:	75 10                	jne    43d <fork1+0x24>
+    panic("fork");
+     42d:	83 ec 0c             	sub    $0xc,%esp
+     430:	68 41 17 00 00       	push   $0x1741
+     435:	e8 bf ff ff ff       	call   3f9 <panic>
+     43a:	83 c4 10             	add    $0x10,%esp
+  return pid;
+     43d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     440:	c9                   	leave
+     441:	c3                   	ret
+
+00000442 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     442:	55                   	push   %ebp
+     443:	89 e5                	mov    %esp,%ebp
+     445:	83 ec 18             	sub    $0x18,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     448:	83 ec 0c             	sub    $0xc,%esp
+     44b:	6a 54                	push   $0x54
+     44d:	e8 6d 11 00 00       	call   15bf <malloc>
+     452:	83 c4 10             	add    $0x10,%esp
+     455:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     458:	83 ec 04             	sub    $0x4,%esp
+     45b:	6a 54                	push   $0x54
+     45d:	6a 00                	push   $0x0
+     45f:	ff 75 f4             	push   -0xc(%ebp)
+     462:	e8 33 09 00 00       	call   d9a <memset>
+     467:	83 c4 10             	add    $0x10,%esp
+  cmd->type = EXEC;
+     46a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     46d:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  return (struct cmd*)cmd;
+     473:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     476:	c9                   	leave
+     477:	c3                   	ret
+
+00000478 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     478:	55                   	push   %ebp
+     479:	89 e5                	mov    %esp,%ebp
+     47b:	83 ec 18             	sub    $0x18,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     47e:	83 ec 0c             	sub    $0xc,%esp
+     481:	6a 18                	push   $0x18
+     483:	e8 37 11 00 00       	call   15bf <malloc>
+     488:	83 c4 10             	add    $0x10,%esp
+     48b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     48e:	83 ec 04             	sub    $0x4,%esp
+     491:	6a 18                	push   $0x18
+     493:	6a 00                	push   $0x0
+     495:	ff 75 f4             	push   -0xc(%ebp)
+     498:	e8 fd 08 00 00       	call   d9a <memset>
+     49d:	83 c4 10             	add    $0x10,%esp
+  cmd->type = REDIR;
+     4a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4a3:	c7 00 02 00 00 00    	movl   $0x2,(%eax)
+  cmd->cmd = subcmd;
+     4a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4ac:	8b 55 08             	mov    0x8(%ebp),%edx
+     4af:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->file = file;
+     4b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4b5:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4b8:	89 50 08             	mov    %edx,0x8(%eax)
+  cmd->efile = efile;
+     4bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4be:	8b 55 10             	mov    0x10(%ebp),%edx
+     4c1:	89 50 0c             	mov    %edx,0xc(%eax)
+  cmd->mode = mode;
+     4c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4c7:	8b 55 14             	mov    0x14(%ebp),%edx
+     4ca:	89 50 10             	mov    %edx,0x10(%eax)
+  cmd->fd = fd;
+     4cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4d0:	8b 55 18             	mov    0x18(%ebp),%edx
+     4d3:	89 50 14             	mov    %edx,0x14(%eax)
+  return (struct cmd*)cmd;
+     4d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     4d9:	c9                   	leave
+     4da:	c3                   	ret
+
+000004db <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4db:	55                   	push   %ebp
+     4dc:	89 e5                	mov    %esp,%ebp
+     4de:	83 ec 18             	sub    $0x18,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4e1:	83 ec 0c             	sub    $0xc,%esp
+     4e4:	6a 0c                	push   $0xc
+     4e6:	e8 d4 10 00 00       	call   15bf <malloc>
+     4eb:	83 c4 10             	add    $0x10,%esp
+     4ee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     4f1:	83 ec 04             	sub    $0x4,%esp
+     4f4:	6a 0c                	push   $0xc
+     4f6:	6a 00                	push   $0x0
+     4f8:	ff 75 f4             	push   -0xc(%ebp)
+     4fb:	e8 9a 08 00 00       	call   d9a <memset>
+     500:	83 c4 10             	add    $0x10,%esp
+  cmd->type = PIPE;
+     503:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     506:	c7 00 03 00 00 00    	movl   $0x3,(%eax)
+  cmd->left = left;
+     50c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     50f:	8b 55 08             	mov    0x8(%ebp),%edx
+     512:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     518:	8b 55 0c             	mov    0xc(%ebp),%edx
+     51b:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     51e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     521:	c9                   	leave
+     522:	c3                   	ret
+
+00000523 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     523:	55                   	push   %ebp
+     524:	89 e5                	mov    %esp,%ebp
+     526:	83 ec 18             	sub    $0x18,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     529:	83 ec 0c             	sub    $0xc,%esp
+     52c:	6a 0c                	push   $0xc
+     52e:	e8 8c 10 00 00       	call   15bf <malloc>
+     533:	83 c4 10             	add    $0x10,%esp
+     536:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     539:	83 ec 04             	sub    $0x4,%esp
+     53c:	6a 0c                	push   $0xc
+     53e:	6a 00                	push   $0x0
+     540:	ff 75 f4             	push   -0xc(%ebp)
+     543:	e8 52 08 00 00       	call   d9a <memset>
+     548:	83 c4 10             	add    $0x10,%esp
+  cmd->type = LIST;
+     54b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     54e:	c7 00 04 00 00 00    	movl   $0x4,(%eax)
+  cmd->left = left;
+     554:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     557:	8b 55 08             	mov    0x8(%ebp),%edx
+     55a:	89 50 04             	mov    %edx,0x4(%eax)
+  cmd->right = right;
+     55d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     560:	8b 55 0c             	mov    0xc(%ebp),%edx
+     563:	89 50 08             	mov    %edx,0x8(%eax)
+  return (struct cmd*)cmd;
+     566:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     569:	c9                   	leave
+     56a:	c3                   	ret
+
+0000056b <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     56b:	55                   	push   %ebp
+     56c:	89 e5                	mov    %esp,%ebp
+     56e:	83 ec 18             	sub    $0x18,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     571:	83 ec 0c             	sub    $0xc,%esp
+     574:	6a 08                	push   $0x8
+     576:	e8 44 10 00 00       	call   15bf <malloc>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  memset(cmd, 0, sizeof(*cmd));
+     581:	83 ec 04             	sub    $0x4,%esp
+     584:	6a 08                	push   $0x8
+     586:	6a 00                	push   $0x0
+     588:	ff 75 f4             	push   -0xc(%ebp)
+     58b:	e8 0a 08 00 00       	call   d9a <memset>
+     590:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     596:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+  cmd->cmd = subcmd;
+     59c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     59f:	8b 55 08             	mov    0x8(%ebp),%edx
+     5a2:	89 50 04             	mov    %edx,0x4(%eax)
+  return (struct cmd*)cmd;
+     5a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     5a8:	c9                   	leave
+     5a9:	c3                   	ret
+
+000005aa <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     5aa:	55                   	push   %ebp
+     5ab:	89 e5                	mov    %esp,%ebp
+     5ad:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  int ret;
+  
+  s = *ps;
+     5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b3:	8b 00                	mov    (%eax),%eax
+     5b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     5b8:	eb 04                	jmp    5be <gettoken+0x14>
+    s++;
+     5ba:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     5be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5c1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     5c4:	73 1e                	jae    5e4 <gettoken+0x3a>
+     5c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5c9:	0f b6 00             	movzbl (%eax),%eax
+     5cc:	0f be c0             	movsbl %al,%eax
+     5cf:	83 ec 08             	sub    $0x8,%esp
+     5d2:	50                   	push   %eax
+     5d3:	68 b8 1c 00 00       	push   $0x1cb8
+     5d8:	e8 d7 07 00 00       	call   db4 <strchr>
+     5dd:	83 c4 10             	add    $0x10,%esp
+     5e0:	85 c0                	test   %eax,%eax
+     5e2:	75 d6                	jne    5ba <gettoken+0x10>
+  if(q)
+     5e4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+     5e8:	74 08                	je     5f2 <gettoken+0x48>
+    *q = s;
+     5ea:	8b 45 10             	mov    0x10(%ebp),%eax
+     5ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5f0:	89 10                	mov    %edx,(%eax)
+  ret = *s;
+     5f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5f5:	0f b6 00             	movzbl (%eax),%eax
+     5f8:	0f be c0             	movsbl %al,%eax
+     5fb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  switch(*s){
+     5fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     601:	0f b6 00             	movzbl (%eax),%eax
+     604:	0f be c0             	movsbl %al,%eax
+     607:	83 f8 7c             	cmp    $0x7c,%eax
+     60a:	74 2c                	je     638 <gettoken+0x8e>
+     60c:	83 f8 7c             	cmp    $0x7c,%eax
+     60f:	7f 48                	jg     659 <gettoken+0xaf>
+     611:	83 f8 3e             	cmp    $0x3e,%eax
+     614:	74 28                	je     63e <gettoken+0x94>
+     616:	83 f8 3e             	cmp    $0x3e,%eax
+     619:	7f 3e                	jg     659 <gettoken+0xaf>
+     61b:	83 f8 3c             	cmp    $0x3c,%eax
+     61e:	7f 39                	jg     659 <gettoken+0xaf>
+     620:	83 f8 3b             	cmp    $0x3b,%eax
+     623:	7d 13                	jge    638 <gettoken+0x8e>
+     625:	83 f8 29             	cmp    $0x29,%eax
+     628:	7f 2f                	jg     659 <gettoken+0xaf>
+     62a:	83 f8 28             	cmp    $0x28,%eax
+     62d:	7d 09                	jge    638 <gettoken+0x8e>
+     62f:	85 c0                	test   %eax,%eax
+     631:	74 79                	je     6ac <gettoken+0x102>
+     633:	83 f8 26             	cmp    $0x26,%eax
+     636:	75 21                	jne    659 <gettoken+0xaf>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     638:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    break;
+     63c:	eb 75                	jmp    6b3 <gettoken+0x109>
+  case '>':
+    s++;
+     63e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(*s == '>'){
+     642:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     645:	0f b6 00             	movzbl (%eax),%eax
+     648:	3c 3e                	cmp    $0x3e,%al
+     64a:	75 63                	jne    6af <gettoken+0x105>
+      ret = '+';
+     64c:	c7 45 f0 2b 00 00 00 	movl   $0x2b,-0x10(%ebp)
+      s++;
+     653:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    }
+    break;
+     657:	eb 56                	jmp    6af <gettoken+0x105>
+  default:
+    ret = 'a';
+     659:	c7 45 f0 61 00 00 00 	movl   $0x61,-0x10(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     660:	eb 04                	jmp    666 <gettoken+0xbc>
+      s++;
+     662:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     666:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     669:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     66c:	73 44                	jae    6b2 <gettoken+0x108>
+     66e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     671:	0f b6 00             	movzbl (%eax),%eax
+     674:	0f be c0             	movsbl %al,%eax
+     677:	83 ec 08             	sub    $0x8,%esp
+     67a:	50                   	push   %eax
+     67b:	68 b8 1c 00 00       	push   $0x1cb8
+     680:	e8 2f 07 00 00       	call   db4 <strchr>
+     685:	83 c4 10             	add    $0x10,%esp
+     688:	85 c0                	test   %eax,%eax
+     68a:	75 26                	jne    6b2 <gettoken+0x108>
+     68c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     68f:	0f b6 00             	movzbl (%eax),%eax
+     692:	0f be c0             	movsbl %al,%eax
+     695:	83 ec 08             	sub    $0x8,%esp
+     698:	50                   	push   %eax
+     699:	68 c0 1c 00 00       	push   $0x1cc0
+     69e:	e8 11 07 00 00       	call   db4 <strchr>
+     6a3:	83 c4 10             	add    $0x10,%esp
+     6a6:	85 c0                	test   %eax,%eax
+     6a8:	74 b8                	je     662 <gettoken+0xb8>
+    break;
+     6aa:	eb 06                	jmp    6b2 <gettoken+0x108>
+    break;
+     6ac:	90                   	nop
+     6ad:	eb 04                	jmp    6b3 <gettoken+0x109>
+    break;
+     6af:	90                   	nop
+     6b0:	eb 01                	jmp    6b3 <gettoken+0x109>
+    break;
+     6b2:	90                   	nop
+  }
+  if(eq)
+     6b3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     6b7:	74 0e                	je     6c7 <gettoken+0x11d>
+    *eq = s;
+     6b9:	8b 45 14             	mov    0x14(%ebp),%eax
+     6bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6bf:	89 10                	mov    %edx,(%eax)
+  
+  while(s < es && strchr(whitespace, *s))
+     6c1:	eb 04                	jmp    6c7 <gettoken+0x11d>
+    s++;
+     6c3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     6c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6ca:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     6cd:	73 1e                	jae    6ed <gettoken+0x143>
+     6cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     6d2:	0f b6 00             	movzbl (%eax),%eax
+     6d5:	0f be c0             	movsbl %al,%eax
+     6d8:	83 ec 08             	sub    $0x8,%esp
+     6db:	50                   	push   %eax
+     6dc:	68 b8 1c 00 00       	push   $0x1cb8
+     6e1:	e8 ce 06 00 00       	call   db4 <strchr>
+     6e6:	83 c4 10             	add    $0x10,%esp
+     6e9:	85 c0                	test   %eax,%eax
+     6eb:	75 d6                	jne    6c3 <gettoken+0x119>
+  *ps = s;
+     6ed:	8b 45 08             	mov    0x8(%ebp),%eax
+     6f0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     6f3:	89 10                	mov    %edx,(%eax)
+  return ret;
+     6f5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     6f8:	c9                   	leave
+     6f9:	c3                   	ret
+
+000006fa <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     6fa:	55                   	push   %ebp
+     6fb:	89 e5                	mov    %esp,%ebp
+     6fd:	83 ec 18             	sub    $0x18,%esp
+  char *s;
+  
+  s = *ps;
+     700:	8b 45 08             	mov    0x8(%ebp),%eax
+     703:	8b 00                	mov    (%eax),%eax
+     705:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     708:	eb 04                	jmp    70e <peek+0x14>
+    s++;
+     70a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  while(s < es && strchr(whitespace, *s))
+     70e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     711:	3b 45 0c             	cmp    0xc(%ebp),%eax
+     714:	73 1e                	jae    734 <peek+0x3a>
+     716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     719:	0f b6 00             	movzbl (%eax),%eax
+     71c:	0f be c0             	movsbl %al,%eax
+     71f:	83 ec 08             	sub    $0x8,%esp
+     722:	50                   	push   %eax
+     723:	68 b8 1c 00 00       	push   $0x1cb8
+     728:	e8 87 06 00 00       	call   db4 <strchr>
+     72d:	83 c4 10             	add    $0x10,%esp
+     730:	85 c0                	test   %eax,%eax
+     732:	75 d6                	jne    70a <peek+0x10>
+  *ps = s;
+     734:	8b 45 08             	mov    0x8(%ebp),%eax
+     737:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     73a:	89 10                	mov    %edx,(%eax)
+  return *s && strchr(toks, *s);
+     73c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     73f:	0f b6 00             	movzbl (%eax),%eax
+     742:	84 c0                	test   %al,%al
+     744:	74 23                	je     769 <peek+0x6f>
+     746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     749:	0f b6 00             	movzbl (%eax),%eax
+     74c:	0f be c0             	movsbl %al,%eax
+     74f:	83 ec 08             	sub    $0x8,%esp
+     752:	50                   	push   %eax
+     753:	ff 75 10             	push   0x10(%ebp)
+     756:	e8 59 06 00 00       	call   db4 <strchr>
+     75b:	83 c4 10             	add    $0x10,%esp
+     75e:	85 c0                	test   %eax,%eax
+     760:	74 07                	je     769 <peek+0x6f>
+     762:	b8 01 00 00 00       	mov    $0x1,%eax
+     767:	eb 05                	jmp    76e <peek+0x74>
+     769:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     76e:	c9                   	leave
+     76f:	c3                   	ret
+
+00000770 <parsecmd>:
+struct cmd *parseexec(char**, char*);
+struct cmd *nulterminate(struct cmd*);
+
+struct cmd*
+parsecmd(char *s)
+{
+     770:	55                   	push   %ebp
+     771:	89 e5                	mov    %esp,%ebp
+     773:	53                   	push   %ebx
+     774:	83 ec 14             	sub    $0x14,%esp
+  char *es;
+  struct cmd *cmd;
+
+  es = s + strlen(s);
+     777:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     77a:	8b 45 08             	mov    0x8(%ebp),%eax
+     77d:	83 ec 0c             	sub    $0xc,%esp
+     780:	50                   	push   %eax
+     781:	e8 ed 05 00 00       	call   d73 <strlen>
+     786:	83 c4 10             	add    $0x10,%esp
+     789:	01 d8                	add    %ebx,%eax
+     78b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  cmd = parseline(&s, es);
+     78e:	83 ec 08             	sub    $0x8,%esp
+     791:	ff 75 f4             	push   -0xc(%ebp)
+     794:	8d 45 08             	lea    0x8(%ebp),%eax
+     797:	50                   	push   %eax
+     798:	e8 61 00 00 00       	call   7fe <parseline>
+     79d:	83 c4 10             	add    $0x10,%esp
+     7a0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  peek(&s, es, "");
+     7a3:	83 ec 04             	sub    $0x4,%esp
+     7a6:	68 46 17 00 00       	push   $0x1746
+     7ab:	ff 75 f4             	push   -0xc(%ebp)
+     7ae:	8d 45 08             	lea    0x8(%ebp),%eax
+     7b1:	50                   	push   %eax
+     7b2:	e8 43 ff ff ff       	call   6fa <peek>
+     7b7:	83 c4 10             	add    $0x10,%esp
+  if(s != es){
+     7ba:	8b 45 08             	mov    0x8(%ebp),%eax
+     7bd:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     7c0:	74 26                	je     7e8 <parsecmd+0x78>
+    printf(2, "leftovers: %s\n", s);
+     7c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c5:	83 ec 04             	sub    $0x4,%esp
+     7c8:	50                   	push   %eax
+     7c9:	68 47 17 00 00       	push   $0x1747
+     7ce:	6a 02                	push   $0x2
+     7d0:	e8 95 09 00 00       	call   116a <printf>
+     7d5:	83 c4 10             	add    $0x10,%esp
+    panic("syntax");
+     7d8:	83 ec 0c             	sub    $0xc,%esp
+     7db:	68 56 17 00 00       	push   $0x1756
+     7e0:	e8 14 fc ff ff       	call   3f9 <panic>
+     7e5:	83 c4 10             	add    $0x10,%esp
+  }
+  nulterminate(cmd);
+     7e8:	83 ec 0c             	sub    $0xc,%esp
+     7eb:	ff 75 f0             	push   -0x10(%ebp)
+     7ee:	e8 ef 03 00 00       	call   be2 <nulterminate>
+     7f3:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     7f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     7f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7fc:	c9                   	leave
+     7fd:	c3                   	ret
+
+000007fe <parseline>:
+
+struct cmd*
+parseline(char **ps, char *es)
+{
+     7fe:	55                   	push   %ebp
+     7ff:	89 e5                	mov    %esp,%ebp
+     801:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parsepipe(ps, es);
+     804:	83 ec 08             	sub    $0x8,%esp
+     807:	ff 75 0c             	push   0xc(%ebp)
+     80a:	ff 75 08             	push   0x8(%ebp)
+     80d:	e8 99 00 00 00       	call   8ab <parsepipe>
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     818:	eb 23                	jmp    83d <parseline+0x3f>
+    gettoken(ps, es, 0, 0);
+     81a:	6a 00                	push   $0x0
+     81c:	6a 00                	push   $0x0
+     81e:	ff 75 0c             	push   0xc(%ebp)
+     821:	ff 75 08             	push   0x8(%ebp)
+     824:	e8 81 fd ff ff       	call   5aa <gettoken>
+     829:	83 c4 10             	add    $0x10,%esp
+    cmd = backcmd(cmd);
+     82c:	83 ec 0c             	sub    $0xc,%esp
+     82f:	ff 75 f4             	push   -0xc(%ebp)
+     832:	e8 34 fd ff ff       	call   56b <backcmd>
+     837:	83 c4 10             	add    $0x10,%esp
+     83a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(peek(ps, es, "&")){
+     83d:	83 ec 04             	sub    $0x4,%esp
+     840:	68 5d 17 00 00       	push   $0x175d
+     845:	ff 75 0c             	push   0xc(%ebp)
+     848:	ff 75 08             	push   0x8(%ebp)
+     84b:	e8 aa fe ff ff       	call   6fa <peek>
+     850:	83 c4 10             	add    $0x10,%esp
+     853:	85 c0                	test   %eax,%eax
+     855:	75 c3                	jne    81a <parseline+0x1c>
+  }
+  if(peek(ps, es, ";")){
+     857:	83 ec 04             	sub    $0x4,%esp
+     85a:	68 5f 17 00 00       	push   $0x175f
+     85f:	ff 75 0c             	push   0xc(%ebp)
+     862:	ff 75 08             	push   0x8(%ebp)
+     865:	e8 90 fe ff ff       	call   6fa <peek>
+     86a:	83 c4 10             	add    $0x10,%esp
+     86d:	85 c0                	test   %eax,%eax
+     86f:	74 35                	je     8a6 <parseline+0xa8>
+    gettoken(ps, es, 0, 0);
+     871:	6a 00                	push   $0x0
+     873:	6a 00                	push   $0x0
+     875:	ff 75 0c             	push   0xc(%ebp)
+     878:	ff 75 08             	push   0x8(%ebp)
+     87b:	e8 2a fd ff ff       	call   5aa <gettoken>
+     880:	83 c4 10             	add    $0x10,%esp
+    cmd = listcmd(cmd, parseline(ps, es));
+     883:	83 ec 08             	sub    $0x8,%esp
+     886:	ff 75 0c             	push   0xc(%ebp)
+     889:	ff 75 08             	push   0x8(%ebp)
+     88c:	e8 6d ff ff ff       	call   7fe <parseline>
+     891:	83 c4 10             	add    $0x10,%esp
+     894:	83 ec 08             	sub    $0x8,%esp
+     897:	50                   	push   %eax
+     898:	ff 75 f4             	push   -0xc(%ebp)
+     89b:	e8 83 fc ff ff       	call   523 <listcmd>
+     8a0:	83 c4 10             	add    $0x10,%esp
+     8a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     8a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     8a9:	c9                   	leave
+     8aa:	c3                   	ret
+
+000008ab <parsepipe>:
+
+struct cmd*
+parsepipe(char **ps, char *es)
+{
+     8ab:	55                   	push   %ebp
+     8ac:	89 e5                	mov    %esp,%ebp
+     8ae:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  cmd = parseexec(ps, es);
+     8b1:	83 ec 08             	sub    $0x8,%esp
+     8b4:	ff 75 0c             	push   0xc(%ebp)
+     8b7:	ff 75 08             	push   0x8(%ebp)
+     8ba:	e8 f0 01 00 00       	call   aaf <parseexec>
+     8bf:	83 c4 10             	add    $0x10,%esp
+     8c2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(peek(ps, es, "|")){
+     8c5:	83 ec 04             	sub    $0x4,%esp
+     8c8:	68 61 17 00 00       	push   $0x1761
+     8cd:	ff 75 0c             	push   0xc(%ebp)
+     8d0:	ff 75 08             	push   0x8(%ebp)
+     8d3:	e8 22 fe ff ff       	call   6fa <peek>
+     8d8:	83 c4 10             	add    $0x10,%esp
+     8db:	85 c0                	test   %eax,%eax
+     8dd:	74 35                	je     914 <parsepipe+0x69>
+    gettoken(ps, es, 0, 0);
+     8df:	6a 00                	push   $0x0
+     8e1:	6a 00                	push   $0x0
+     8e3:	ff 75 0c             	push   0xc(%ebp)
+     8e6:	ff 75 08             	push   0x8(%ebp)
+     8e9:	e8 bc fc ff ff       	call   5aa <gettoken>
+     8ee:	83 c4 10             	add    $0x10,%esp
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     8f1:	83 ec 08             	sub    $0x8,%esp
+     8f4:	ff 75 0c             	push   0xc(%ebp)
+     8f7:	ff 75 08             	push   0x8(%ebp)
+     8fa:	e8 ac ff ff ff       	call   8ab <parsepipe>
+     8ff:	83 c4 10             	add    $0x10,%esp
+     902:	83 ec 08             	sub    $0x8,%esp
+     905:	50                   	push   %eax
+     906:	ff 75 f4             	push   -0xc(%ebp)
+     909:	e8 cd fb ff ff       	call   4db <pipecmd>
+     90e:	83 c4 10             	add    $0x10,%esp
+     911:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  }
+  return cmd;
+     914:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     917:	c9                   	leave
+     918:	c3                   	ret
+
+00000919 <parseredirs>:
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     919:	55                   	push   %ebp
+     91a:	89 e5                	mov    %esp,%ebp
+     91c:	83 ec 18             	sub    $0x18,%esp
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     91f:	e9 ba 00 00 00       	jmp    9de <parseredirs+0xc5>
+    tok = gettoken(ps, es, 0, 0);
+     924:	6a 00                	push   $0x0
+     926:	6a 00                	push   $0x0
+     928:	ff 75 10             	push   0x10(%ebp)
+     92b:	ff 75 0c             	push   0xc(%ebp)
+     92e:	e8 77 fc ff ff       	call   5aa <gettoken>
+     933:	83 c4 10             	add    $0x10,%esp
+     936:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     939:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     93c:	50                   	push   %eax
+     93d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     940:	50                   	push   %eax
+     941:	ff 75 10             	push   0x10(%ebp)
+     944:	ff 75 0c             	push   0xc(%ebp)
+     947:	e8 5e fc ff ff       	call   5aa <gettoken>
+     94c:	83 c4 10             	add    $0x10,%esp
+     94f:	83 f8 61             	cmp    $0x61,%eax
+     952:	74 10                	je     964 <parseredirs+0x4b>
+      panic("missing file for redirection");
+     954:	83 ec 0c             	sub    $0xc,%esp
+     957:	68 63 17 00 00       	push   $0x1763
+     95c:	e8 98 fa ff ff       	call   3f9 <panic>
+     961:	83 c4 10             	add    $0x10,%esp
+    switch(tok){
+     964:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     968:	74 31                	je     99b <parseredirs+0x82>
+     96a:	83 7d f4 3e          	cmpl   $0x3e,-0xc(%ebp)
+     96e:	7f 6e                	jg     9de <parseredirs+0xc5>
+     970:	83 7d f4 2b          	cmpl   $0x2b,-0xc(%ebp)
+     974:	74 47                	je     9bd <parseredirs+0xa4>
+     976:	83 7d f4 3c          	cmpl   $0x3c,-0xc(%ebp)
+     97a:	75 62                	jne    9de <parseredirs+0xc5>
+    case '<':
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     97c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     97f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     982:	83 ec 0c             	sub    $0xc,%esp
+     985:	6a 00                	push   $0x0
+     987:	6a 00                	push   $0x0
+     989:	52                   	push   %edx
+     98a:	50                   	push   %eax
+     98b:	ff 75 08             	push   0x8(%ebp)
+     98e:	e8 e5 fa ff ff       	call   478 <redircmd>
+     993:	83 c4 20             	add    $0x20,%esp
+     996:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     999:	eb 43                	jmp    9de <parseredirs+0xc5>
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     99b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     99e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9a1:	83 ec 0c             	sub    $0xc,%esp
+     9a4:	6a 01                	push   $0x1
+     9a6:	68 01 02 00 00       	push   $0x201
+     9ab:	52                   	push   %edx
+     9ac:	50                   	push   %eax
+     9ad:	ff 75 08             	push   0x8(%ebp)
+     9b0:	e8 c3 fa ff ff       	call   478 <redircmd>
+     9b5:	83 c4 20             	add    $0x20,%esp
+     9b8:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     9bb:	eb 21                	jmp    9de <parseredirs+0xc5>
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     9bd:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     9c0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     9c3:	83 ec 0c             	sub    $0xc,%esp
+     9c6:	6a 01                	push   $0x1
+     9c8:	68 01 02 00 00       	push   $0x201
+     9cd:	52                   	push   %edx
+     9ce:	50                   	push   %eax
+     9cf:	ff 75 08             	push   0x8(%ebp)
+     9d2:	e8 a1 fa ff ff       	call   478 <redircmd>
+     9d7:	83 c4 20             	add    $0x20,%esp
+     9da:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     9dd:	90                   	nop
+  while(peek(ps, es, "<>")){
+     9de:	83 ec 04             	sub    $0x4,%esp
+     9e1:	68 80 17 00 00       	push   $0x1780
+     9e6:	ff 75 10             	push   0x10(%ebp)
+     9e9:	ff 75 0c             	push   0xc(%ebp)
+     9ec:	e8 09 fd ff ff       	call   6fa <peek>
+     9f1:	83 c4 10             	add    $0x10,%esp
+     9f4:	85 c0                	test   %eax,%eax
+     9f6:	0f 85 28 ff ff ff    	jne    924 <parseredirs+0xb>
+    }
+  }
+  return cmd;
+     9fc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     9ff:	c9                   	leave
+     a00:	c3                   	ret
+
+00000a01 <parseblock>:
+
+struct cmd*
+parseblock(char **ps, char *es)
+{
+     a01:	55                   	push   %ebp
+     a02:	89 e5                	mov    %esp,%ebp
+     a04:	83 ec 18             	sub    $0x18,%esp
+  struct cmd *cmd;
+
+  if(!peek(ps, es, "("))
+     a07:	83 ec 04             	sub    $0x4,%esp
+     a0a:	68 83 17 00 00       	push   $0x1783
+     a0f:	ff 75 0c             	push   0xc(%ebp)
+     a12:	ff 75 08             	push   0x8(%ebp)
+     a15:	e8 e0 fc ff ff       	call   6fa <peek>
+     a1a:	83 c4 10             	add    $0x10,%esp
+     a1d:	85 c0                	test   %eax,%eax
+     a1f:	75 10                	jne    a31 <parseblock+0x30>
+    panic("parseblock");
+     a21:	83 ec 0c             	sub    $0xc,%esp
+     a24:	68 85 17 00 00       	push   $0x1785
+     a29:	e8 cb f9 ff ff       	call   3f9 <panic>
+     a2e:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     a31:	6a 00                	push   $0x0
+     a33:	6a 00                	push   $0x0
+     a35:	ff 75 0c             	push   0xc(%ebp)
+     a38:	ff 75 08             	push   0x8(%ebp)
+     a3b:	e8 6a fb ff ff       	call   5aa <gettoken>
+     a40:	83 c4 10             	add    $0x10,%esp
+  cmd = parseline(ps, es);
+     a43:	83 ec 08             	sub    $0x8,%esp
+     a46:	ff 75 0c             	push   0xc(%ebp)
+     a49:	ff 75 08             	push   0x8(%ebp)
+     a4c:	e8 ad fd ff ff       	call   7fe <parseline>
+     a51:	83 c4 10             	add    $0x10,%esp
+     a54:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(!peek(ps, es, ")"))
+     a57:	83 ec 04             	sub    $0x4,%esp
+     a5a:	68 90 17 00 00       	push   $0x1790
+     a5f:	ff 75 0c             	push   0xc(%ebp)
+     a62:	ff 75 08             	push   0x8(%ebp)
+     a65:	e8 90 fc ff ff       	call   6fa <peek>
+     a6a:	83 c4 10             	add    $0x10,%esp
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	75 10                	jne    a81 <parseblock+0x80>
+    panic("syntax - missing )");
+     a71:	83 ec 0c             	sub    $0xc,%esp
+     a74:	68 92 17 00 00       	push   $0x1792
+     a79:	e8 7b f9 ff ff       	call   3f9 <panic>
+     a7e:	83 c4 10             	add    $0x10,%esp
+  gettoken(ps, es, 0, 0);
+     a81:	6a 00                	push   $0x0
+     a83:	6a 00                	push   $0x0
+     a85:	ff 75 0c             	push   0xc(%ebp)
+     a88:	ff 75 08             	push   0x8(%ebp)
+     a8b:	e8 1a fb ff ff       	call   5aa <gettoken>
+     a90:	83 c4 10             	add    $0x10,%esp
+  cmd = parseredirs(cmd, ps, es);
+     a93:	83 ec 04             	sub    $0x4,%esp
+     a96:	ff 75 0c             	push   0xc(%ebp)
+     a99:	ff 75 08             	push   0x8(%ebp)
+     a9c:	ff 75 f4             	push   -0xc(%ebp)
+     a9f:	e8 75 fe ff ff       	call   919 <parseredirs>
+     aa4:	83 c4 10             	add    $0x10,%esp
+     aa7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  return cmd;
+     aaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+     aad:	c9                   	leave
+     aae:	c3                   	ret
+
+00000aaf <parseexec>:
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     aaf:	55                   	push   %ebp
+     ab0:	89 e5                	mov    %esp,%ebp
+     ab2:	83 ec 28             	sub    $0x28,%esp
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+  
+  if(peek(ps, es, "("))
+     ab5:	83 ec 04             	sub    $0x4,%esp
+     ab8:	68 83 17 00 00       	push   $0x1783
+     abd:	ff 75 0c             	push   0xc(%ebp)
+     ac0:	ff 75 08             	push   0x8(%ebp)
+     ac3:	e8 32 fc ff ff       	call   6fa <peek>
+     ac8:	83 c4 10             	add    $0x10,%esp
+     acb:	85 c0                	test   %eax,%eax
+     acd:	74 16                	je     ae5 <parseexec+0x36>
+    return parseblock(ps, es);
+     acf:	83 ec 08             	sub    $0x8,%esp
+     ad2:	ff 75 0c             	push   0xc(%ebp)
+     ad5:	ff 75 08             	push   0x8(%ebp)
+     ad8:	e8 24 ff ff ff       	call   a01 <parseblock>
+     add:	83 c4 10             	add    $0x10,%esp
+     ae0:	e9 fb 00 00 00       	jmp    be0 <parseexec+0x131>
+
+  ret = execcmd();
+     ae5:	e8 58 f9 ff ff       	call   442 <execcmd>
+     aea:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  cmd = (struct execcmd*)ret;
+     aed:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     af0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  argc = 0;
+     af3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  ret = parseredirs(ret, ps, es);
+     afa:	83 ec 04             	sub    $0x4,%esp
+     afd:	ff 75 0c             	push   0xc(%ebp)
+     b00:	ff 75 08             	push   0x8(%ebp)
+     b03:	ff 75 f0             	push   -0x10(%ebp)
+     b06:	e8 0e fe ff ff       	call   919 <parseredirs>
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b11:	e9 87 00 00 00       	jmp    b9d <parseexec+0xee>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     b16:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     b19:	50                   	push   %eax
+     b1a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     b1d:	50                   	push   %eax
+     b1e:	ff 75 0c             	push   0xc(%ebp)
+     b21:	ff 75 08             	push   0x8(%ebp)
+     b24:	e8 81 fa ff ff       	call   5aa <gettoken>
+     b29:	83 c4 10             	add    $0x10,%esp
+     b2c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     b2f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+     b33:	0f 84 84 00 00 00    	je     bbd <parseexec+0x10e>
+      break;
+    if(tok != 'a')
+     b39:	83 7d e8 61          	cmpl   $0x61,-0x18(%ebp)
+     b3d:	74 10                	je     b4f <parseexec+0xa0>
+      panic("syntax");
+     b3f:	83 ec 0c             	sub    $0xc,%esp
+     b42:	68 56 17 00 00       	push   $0x1756
+     b47:	e8 ad f8 ff ff       	call   3f9 <panic>
+     b4c:	83 c4 10             	add    $0x10,%esp
+    cmd->argv[argc] = q;
+     b4f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     b52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     b58:	89 4c 90 04          	mov    %ecx,0x4(%eax,%edx,4)
+    cmd->eargv[argc] = eq;
+     b5c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     b5f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b62:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+     b65:	83 c1 08             	add    $0x8,%ecx
+     b68:	89 54 88 0c          	mov    %edx,0xc(%eax,%ecx,4)
+    argc++;
+     b6c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    if(argc >= MAXARGS)
+     b70:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     b74:	7e 10                	jle    b86 <parseexec+0xd7>
+      panic("too many args");
+     b76:	83 ec 0c             	sub    $0xc,%esp
+     b79:	68 a5 17 00 00       	push   $0x17a5
+     b7e:	e8 76 f8 ff ff       	call   3f9 <panic>
+     b83:	83 c4 10             	add    $0x10,%esp
+    ret = parseredirs(ret, ps, es);
+     b86:	83 ec 04             	sub    $0x4,%esp
+     b89:	ff 75 0c             	push   0xc(%ebp)
+     b8c:	ff 75 08             	push   0x8(%ebp)
+     b8f:	ff 75 f0             	push   -0x10(%ebp)
+     b92:	e8 82 fd ff ff       	call   919 <parseredirs>
+     b97:	83 c4 10             	add    $0x10,%esp
+     b9a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     b9d:	83 ec 04             	sub    $0x4,%esp
+     ba0:	68 b3 17 00 00       	push   $0x17b3
+     ba5:	ff 75 0c             	push   0xc(%ebp)
+     ba8:	ff 75 08             	push   0x8(%ebp)
+     bab:	e8 4a fb ff ff       	call   6fa <peek>
+     bb0:	83 c4 10             	add    $0x10,%esp
+     bb3:	85 c0                	test   %eax,%eax
+     bb5:	0f 84 5b ff ff ff    	je     b16 <parseexec+0x67>
+     bbb:	eb 01                	jmp    bbe <parseexec+0x10f>
+      break;
+     bbd:	90                   	nop
+  }
+  cmd->argv[argc] = 0;
+     bbe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bc1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bc4:	c7 44 90 04 00 00 00 	movl   $0x0,0x4(%eax,%edx,4)
+     bcb:	00 
+  cmd->eargv[argc] = 0;
+     bcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bcf:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     bd2:	83 c2 08             	add    $0x8,%edx
+     bd5:	c7 44 90 0c 00 00 00 	movl   $0x0,0xc(%eax,%edx,4)
+     bdc:	00 
+  return ret;
+     bdd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     be0:	c9                   	leave
+     be1:	c3                   	ret
+
+00000be2 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     be2:	55                   	push   %ebp
+     be3:	89 e5                	mov    %esp,%ebp
+     be5:	83 ec 28             	sub    $0x28,%esp
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     be8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     bec:	75 0a                	jne    bf8 <nulterminate+0x16>
+    return 0;
+     bee:	b8 00 00 00 00       	mov    $0x0,%eax
+     bf3:	e9 e4 00 00 00       	jmp    cdc <nulterminate+0xfa>
+  
+  switch(cmd->type){
+     bf8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bfb:	8b 00                	mov    (%eax),%eax
+     bfd:	83 f8 05             	cmp    $0x5,%eax
+     c00:	0f 87 d3 00 00 00    	ja     cd9 <nulterminate+0xf7>
+     c06:	8b 04 85 b8 17 00 00 	mov    0x17b8(,%eax,4),%eax
+     c0d:	ff e0                	jmp    *%eax
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+     c0f:	8b 45 08             	mov    0x8(%ebp),%eax
+     c12:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    for(i=0; ecmd->argv[i]; i++)
+     c15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c1c:	eb 14                	jmp    c32 <nulterminate+0x50>
+      *ecmd->eargv[i] = 0;
+     c1e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c21:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     c24:	83 c2 08             	add    $0x8,%edx
+     c27:	8b 44 90 0c          	mov    0xc(%eax,%edx,4),%eax
+     c2b:	c6 00 00             	movb   $0x0,(%eax)
+    for(i=0; ecmd->argv[i]; i++)
+     c2e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     c32:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     c35:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     c38:	8b 44 90 04          	mov    0x4(%eax,%edx,4),%eax
+     c3c:	85 c0                	test   %eax,%eax
+     c3e:	75 de                	jne    c1e <nulterminate+0x3c>
+    break;
+     c40:	e9 94 00 00 00       	jmp    cd9 <nulterminate+0xf7>
+
+  case REDIR:
+    rcmd = (struct redircmd*)cmd;
+     c45:	8b 45 08             	mov    0x8(%ebp),%eax
+     c48:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    nulterminate(rcmd->cmd);
+     c4b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c4e:	8b 40 04             	mov    0x4(%eax),%eax
+     c51:	83 ec 0c             	sub    $0xc,%esp
+     c54:	50                   	push   %eax
+     c55:	e8 88 ff ff ff       	call   be2 <nulterminate>
+     c5a:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     c5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c60:	8b 40 0c             	mov    0xc(%eax),%eax
+     c63:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     c66:	eb 71                	jmp    cd9 <nulterminate+0xf7>
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+     c68:	8b 45 08             	mov    0x8(%ebp),%eax
+     c6b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    nulterminate(pcmd->left);
+     c6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c71:	8b 40 04             	mov    0x4(%eax),%eax
+     c74:	83 ec 0c             	sub    $0xc,%esp
+     c77:	50                   	push   %eax
+     c78:	e8 65 ff ff ff       	call   be2 <nulterminate>
+     c7d:	83 c4 10             	add    $0x10,%esp
+    nulterminate(pcmd->right);
+     c80:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c83:	8b 40 08             	mov    0x8(%eax),%eax
+     c86:	83 ec 0c             	sub    $0xc,%esp
+     c89:	50                   	push   %eax
+     c8a:	e8 53 ff ff ff       	call   be2 <nulterminate>
+     c8f:	83 c4 10             	add    $0x10,%esp
+    break;
+     c92:	eb 45                	jmp    cd9 <nulterminate+0xf7>
+    
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+     c94:	8b 45 08             	mov    0x8(%ebp),%eax
+     c97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    nulterminate(lcmd->left);
+     c9a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c9d:	8b 40 04             	mov    0x4(%eax),%eax
+     ca0:	83 ec 0c             	sub    $0xc,%esp
+     ca3:	50                   	push   %eax
+     ca4:	e8 39 ff ff ff       	call   be2 <nulterminate>
+     ca9:	83 c4 10             	add    $0x10,%esp
+    nulterminate(lcmd->right);
+     cac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     caf:	8b 40 08             	mov    0x8(%eax),%eax
+     cb2:	83 ec 0c             	sub    $0xc,%esp
+     cb5:	50                   	push   %eax
+     cb6:	e8 27 ff ff ff       	call   be2 <nulterminate>
+     cbb:	83 c4 10             	add    $0x10,%esp
+    break;
+     cbe:	eb 19                	jmp    cd9 <nulterminate+0xf7>
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+     cc0:	8b 45 08             	mov    0x8(%ebp),%eax
+     cc3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    nulterminate(bcmd->cmd);
+     cc6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     cc9:	8b 40 04             	mov    0x4(%eax),%eax
+     ccc:	83 ec 0c             	sub    $0xc,%esp
+     ccf:	50                   	push   %eax
+     cd0:	e8 0d ff ff ff       	call   be2 <nulterminate>
+     cd5:	83 c4 10             	add    $0x10,%esp
+    break;
+     cd8:	90                   	nop
+  }
+  return cmd;
+     cd9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     cdc:	c9                   	leave
+     cdd:	c3                   	ret
+
+00000cde <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+     cde:	55                   	push   %ebp
+     cdf:	89 e5                	mov    %esp,%ebp
+     ce1:	57                   	push   %edi
+     ce2:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+     ce3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     ce6:	8b 55 10             	mov    0x10(%ebp),%edx
+     ce9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cec:	89 cb                	mov    %ecx,%ebx
+     cee:	89 df                	mov    %ebx,%edi
+     cf0:	89 d1                	mov    %edx,%ecx
+     cf2:	fc                   	cld
+     cf3:	f3 aa                	rep stos %al,%es:(%edi)
+     cf5:	89 ca                	mov    %ecx,%edx
+     cf7:	89 fb                	mov    %edi,%ebx
+     cf9:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     cfc:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+     cff:	90                   	nop
+     d00:	5b                   	pop    %ebx
+     d01:	5f                   	pop    %edi
+     d02:	5d                   	pop    %ebp
+     d03:	c3                   	ret
+
+00000d04 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+     d04:	55                   	push   %ebp
+     d05:	89 e5                	mov    %esp,%ebp
+     d07:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+     d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d0d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     d10:	90                   	nop
+     d11:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d14:	8d 42 01             	lea    0x1(%edx),%eax
+     d17:	89 45 0c             	mov    %eax,0xc(%ebp)
+     d1a:	8b 45 08             	mov    0x8(%ebp),%eax
+     d1d:	8d 48 01             	lea    0x1(%eax),%ecx
+     d20:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     d23:	0f b6 12             	movzbl (%edx),%edx
+     d26:	88 10                	mov    %dl,(%eax)
+     d28:	0f b6 00             	movzbl (%eax),%eax
+     d2b:	84 c0                	test   %al,%al
+     d2d:	75 e2                	jne    d11 <strcpy+0xd>
+    ;
+  return os;
+     d2f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d32:	c9                   	leave
+     d33:	c3                   	ret
+
+00000d34 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     d34:	55                   	push   %ebp
+     d35:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     d37:	eb 08                	jmp    d41 <strcmp+0xd>
+    p++, q++;
+     d39:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     d3d:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     d41:	8b 45 08             	mov    0x8(%ebp),%eax
+     d44:	0f b6 00             	movzbl (%eax),%eax
+     d47:	84 c0                	test   %al,%al
+     d49:	74 10                	je     d5b <strcmp+0x27>
+     d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d4e:	0f b6 10             	movzbl (%eax),%edx
+     d51:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d54:	0f b6 00             	movzbl (%eax),%eax
+     d57:	38 c2                	cmp    %al,%dl
+     d59:	74 de                	je     d39 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+     d5e:	0f b6 00             	movzbl (%eax),%eax
+     d61:	0f b6 d0             	movzbl %al,%edx
+     d64:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d67:	0f b6 00             	movzbl (%eax),%eax
+     d6a:	0f b6 c0             	movzbl %al,%eax
+     d6d:	29 c2                	sub    %eax,%edx
+     d6f:	89 d0                	mov    %edx,%eax
+}
+     d71:	5d                   	pop    %ebp
+     d72:	c3                   	ret
+
+00000d73 <strlen>:
+
+uint
+strlen(char *s)
+{
+     d73:	55                   	push   %ebp
+     d74:	89 e5                	mov    %esp,%ebp
+     d76:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+     d79:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     d80:	eb 04                	jmp    d86 <strlen+0x13>
+     d82:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     d86:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     d89:	8b 45 08             	mov    0x8(%ebp),%eax
+     d8c:	01 d0                	add    %edx,%eax
+     d8e:	0f b6 00             	movzbl (%eax),%eax
+     d91:	84 c0                	test   %al,%al
+     d93:	75 ed                	jne    d82 <strlen+0xf>
+    ;
+  return n;
+     d95:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     d98:	c9                   	leave
+     d99:	c3                   	ret
+
+00000d9a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     d9a:	55                   	push   %ebp
+     d9b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     d9d:	8b 45 10             	mov    0x10(%ebp),%eax
+     da0:	50                   	push   %eax
+     da1:	ff 75 0c             	push   0xc(%ebp)
+     da4:	ff 75 08             	push   0x8(%ebp)
+     da7:	e8 32 ff ff ff       	call   cde <stosb>
+     dac:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     daf:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     db2:	c9                   	leave
+     db3:	c3                   	ret
+
+00000db4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     db4:	55                   	push   %ebp
+     db5:	89 e5                	mov    %esp,%ebp
+     db7:	83 ec 04             	sub    $0x4,%esp
+     dba:	8b 45 0c             	mov    0xc(%ebp),%eax
+     dbd:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     dc0:	eb 14                	jmp    dd6 <strchr+0x22>
+    if(*s == c)
+     dc2:	8b 45 08             	mov    0x8(%ebp),%eax
+     dc5:	0f b6 00             	movzbl (%eax),%eax
+     dc8:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     dcb:	75 05                	jne    dd2 <strchr+0x1e>
+      return (char*)s;
+     dcd:	8b 45 08             	mov    0x8(%ebp),%eax
+     dd0:	eb 13                	jmp    de5 <strchr+0x31>
+  for(; *s; s++)
+     dd2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     dd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     dd9:	0f b6 00             	movzbl (%eax),%eax
+     ddc:	84 c0                	test   %al,%al
+     dde:	75 e2                	jne    dc2 <strchr+0xe>
+  return 0;
+     de0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     de5:	c9                   	leave
+     de6:	c3                   	ret
+
+00000de7 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     de7:	55                   	push   %ebp
+     de8:	89 e5                	mov    %esp,%ebp
+     dea:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     ded:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     df4:	eb 42                	jmp    e38 <gets+0x51>
+    cc = read(0, &c, 1);
+     df6:	83 ec 04             	sub    $0x4,%esp
+     df9:	6a 01                	push   $0x1
+     dfb:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     dfe:	50                   	push   %eax
+     dff:	6a 00                	push   $0x0
+     e01:	e8 78 01 00 00       	call   f7e <read>
+     e06:	83 c4 10             	add    $0x10,%esp
+     e09:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     e0c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     e10:	7e 33                	jle    e45 <gets+0x5e>
+      break;
+    buf[i++] = c;
+     e12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e15:	8d 50 01             	lea    0x1(%eax),%edx
+     e18:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     e1b:	89 c2                	mov    %eax,%edx
+     e1d:	8b 45 08             	mov    0x8(%ebp),%eax
+     e20:	01 c2                	add    %eax,%edx
+     e22:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     e26:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     e28:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     e2c:	3c 0a                	cmp    $0xa,%al
+     e2e:	74 16                	je     e46 <gets+0x5f>
+     e30:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     e34:	3c 0d                	cmp    $0xd,%al
+     e36:	74 0e                	je     e46 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     e38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e3b:	83 c0 01             	add    $0x1,%eax
+     e3e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     e41:	7f b3                	jg     df6 <gets+0xf>
+     e43:	eb 01                	jmp    e46 <gets+0x5f>
+      break;
+     e45:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+     e46:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e49:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4c:	01 d0                	add    %edx,%eax
+     e4e:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     e51:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     e54:	c9                   	leave
+     e55:	c3                   	ret
+
+00000e56 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+     e56:	55                   	push   %ebp
+     e57:	89 e5                	mov    %esp,%ebp
+     e59:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     e5c:	83 ec 08             	sub    $0x8,%esp
+     e5f:	6a 00                	push   $0x0
+     e61:	ff 75 08             	push   0x8(%ebp)
+     e64:	e8 3d 01 00 00       	call   fa6 <open>
+     e69:	83 c4 10             	add    $0x10,%esp
+     e6c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     e6f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     e73:	79 07                	jns    e7c <stat+0x26>
+    return -1;
+     e75:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     e7a:	eb 25                	jmp    ea1 <stat+0x4b>
+  r = fstat(fd, st);
+     e7c:	83 ec 08             	sub    $0x8,%esp
+     e7f:	ff 75 0c             	push   0xc(%ebp)
+     e82:	ff 75 f4             	push   -0xc(%ebp)
+     e85:	e8 34 01 00 00       	call   fbe <fstat>
+     e8a:	83 c4 10             	add    $0x10,%esp
+     e8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     e90:	83 ec 0c             	sub    $0xc,%esp
+     e93:	ff 75 f4             	push   -0xc(%ebp)
+     e96:	e8 f3 00 00 00       	call   f8e <close>
+     e9b:	83 c4 10             	add    $0x10,%esp
+  return r;
+     e9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     ea1:	c9                   	leave
+     ea2:	c3                   	ret
+
+00000ea3 <atoi>:
+
+int
+atoi(const char *s)
+{
+     ea3:	55                   	push   %ebp
+     ea4:	89 e5                	mov    %esp,%ebp
+     ea6:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+     ea9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     eb0:	eb 25                	jmp    ed7 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     eb2:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     eb5:	89 d0                	mov    %edx,%eax
+     eb7:	c1 e0 02             	shl    $0x2,%eax
+     eba:	01 d0                	add    %edx,%eax
+     ebc:	01 c0                	add    %eax,%eax
+     ebe:	89 c1                	mov    %eax,%ecx
+     ec0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ec3:	8d 50 01             	lea    0x1(%eax),%edx
+     ec6:	89 55 08             	mov    %edx,0x8(%ebp)
+     ec9:	0f b6 00             	movzbl (%eax),%eax
+     ecc:	0f be c0             	movsbl %al,%eax
+     ecf:	01 c8                	add    %ecx,%eax
+     ed1:	83 e8 30             	sub    $0x30,%eax
+     ed4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     ed7:	8b 45 08             	mov    0x8(%ebp),%eax
+     eda:	0f b6 00             	movzbl (%eax),%eax
+     edd:	3c 2f                	cmp    $0x2f,%al
+     edf:	7e 0a                	jle    eeb <atoi+0x48>
+     ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+     ee4:	0f b6 00             	movzbl (%eax),%eax
+     ee7:	3c 39                	cmp    $0x39,%al
+     ee9:	7e c7                	jle    eb2 <atoi+0xf>
+  return n;
+     eeb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     eee:	c9                   	leave
+     eef:	c3                   	ret
+
+00000ef0 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+     ef0:	55                   	push   %ebp
+     ef1:	89 e5                	mov    %esp,%ebp
+     ef3:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+     ef6:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     efc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     eff:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     f02:	eb 17                	jmp    f1b <memmove+0x2b>
+    *dst++ = *src++;
+     f04:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     f07:	8d 42 01             	lea    0x1(%edx),%eax
+     f0a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     f0d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f10:	8d 48 01             	lea    0x1(%eax),%ecx
+     f13:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     f16:	0f b6 12             	movzbl (%edx),%edx
+     f19:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     f1b:	8b 45 10             	mov    0x10(%ebp),%eax
+     f1e:	8d 50 ff             	lea    -0x1(%eax),%edx
+     f21:	89 55 10             	mov    %edx,0x10(%ebp)
+     f24:	85 c0                	test   %eax,%eax
+     f26:	7f dc                	jg     f04 <memmove+0x14>
+  return vdst;
+     f28:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     f2b:	c9                   	leave
+     f2c:	c3                   	ret
+
+00000f2d <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+     f2d:	55                   	push   %ebp
+     f2e:	89 e5                	mov    %esp,%ebp
+     f30:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+     f33:	83 ec 0c             	sub    $0xc,%esp
+     f36:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     f39:	50                   	push   %eax
+     f3a:	e8 ff 00 00 00       	call   103e <nanouptime>
+     f3f:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+     f42:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f45:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+     f4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f4e:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+     f53:	f7 e2                	mul    %edx
+     f55:	89 d0                	mov    %edx,%eax
+     f57:	c1 e8 06             	shr    $0x6,%eax
+     f5a:	01 c8                	add    %ecx,%eax
+}
+     f5c:	c9                   	leave
+     f5d:	c3                   	ret
+
+00000f5e <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     f5e:	b8 01 00 00 00       	mov    $0x1,%eax
+     f63:	cd 40                	int    $0x40
+     f65:	c3                   	ret
+
+00000f66 <exit>:
+SYSCALL(exit)
+     f66:	b8 02 00 00 00       	mov    $0x2,%eax
+     f6b:	cd 40                	int    $0x40
+     f6d:	c3                   	ret
+
+00000f6e <wait>:
+SYSCALL(wait)
+     f6e:	b8 03 00 00 00       	mov    $0x3,%eax
+     f73:	cd 40                	int    $0x40
+     f75:	c3                   	ret
+
+00000f76 <pipe>:
+SYSCALL(pipe)
+     f76:	b8 04 00 00 00       	mov    $0x4,%eax
+     f7b:	cd 40                	int    $0x40
+     f7d:	c3                   	ret
+
+00000f7e <read>:
+SYSCALL(read)
+     f7e:	b8 05 00 00 00       	mov    $0x5,%eax
+     f83:	cd 40                	int    $0x40
+     f85:	c3                   	ret
+
+00000f86 <write>:
+SYSCALL(write)
+     f86:	b8 10 00 00 00       	mov    $0x10,%eax
+     f8b:	cd 40                	int    $0x40
+     f8d:	c3                   	ret
+
+00000f8e <close>:
+SYSCALL(close)
+     f8e:	b8 15 00 00 00       	mov    $0x15,%eax
+     f93:	cd 40                	int    $0x40
+     f95:	c3                   	ret
+
+00000f96 <kill>:
+SYSCALL(kill)
+     f96:	b8 06 00 00 00       	mov    $0x6,%eax
+     f9b:	cd 40                	int    $0x40
+     f9d:	c3                   	ret
+
+00000f9e <exec>:
+SYSCALL(exec)
+     f9e:	b8 07 00 00 00       	mov    $0x7,%eax
+     fa3:	cd 40                	int    $0x40
+     fa5:	c3                   	ret
+
+00000fa6 <open>:
+SYSCALL(open)
+     fa6:	b8 0f 00 00 00       	mov    $0xf,%eax
+     fab:	cd 40                	int    $0x40
+     fad:	c3                   	ret
+
+00000fae <mknod>:
+SYSCALL(mknod)
+     fae:	b8 11 00 00 00       	mov    $0x11,%eax
+     fb3:	cd 40                	int    $0x40
+     fb5:	c3                   	ret
+
+00000fb6 <unlink>:
+SYSCALL(unlink)
+     fb6:	b8 12 00 00 00       	mov    $0x12,%eax
+     fbb:	cd 40                	int    $0x40
+     fbd:	c3                   	ret
+
+00000fbe <fstat>:
+SYSCALL(fstat)
+     fbe:	b8 08 00 00 00       	mov    $0x8,%eax
+     fc3:	cd 40                	int    $0x40
+     fc5:	c3                   	ret
+
+00000fc6 <link>:
+SYSCALL(link)
+     fc6:	b8 13 00 00 00       	mov    $0x13,%eax
+     fcb:	cd 40                	int    $0x40
+     fcd:	c3                   	ret
+
+00000fce <mkdir>:
+SYSCALL(mkdir)
+     fce:	b8 14 00 00 00       	mov    $0x14,%eax
+     fd3:	cd 40                	int    $0x40
+     fd5:	c3                   	ret
+
+00000fd6 <chdir>:
+SYSCALL(chdir)
+     fd6:	b8 09 00 00 00       	mov    $0x9,%eax
+     fdb:	cd 40                	int    $0x40
+     fdd:	c3                   	ret
+
+00000fde <dup>:
+SYSCALL(dup)
+     fde:	b8 0a 00 00 00       	mov    $0xa,%eax
+     fe3:	cd 40                	int    $0x40
+     fe5:	c3                   	ret
+
+00000fe6 <getpid>:
+SYSCALL(getpid)
+     fe6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     feb:	cd 40                	int    $0x40
+     fed:	c3                   	ret
+
+00000fee <sbrk>:
+SYSCALL(sbrk)
+     fee:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ff3:	cd 40                	int    $0x40
+     ff5:	c3                   	ret
+
+00000ff6 <sleep>:
+SYSCALL(sleep)
+     ff6:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ffb:	cd 40                	int    $0x40
+     ffd:	c3                   	ret
+
+00000ffe <uptime>:
+SYSCALL(uptime)
+     ffe:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1003:	cd 40                	int    $0x40
+    1005:	c3                   	ret
+
+00001006 <saveProc>:
+SYSCALL(saveProc)
+    1006:	b8 16 00 00 00       	mov    $0x16,%eax
+    100b:	cd 40                	int    $0x40
+    100d:	c3                   	ret
+
+0000100e <loadProc>:
+SYSCALL(loadProc)
+    100e:	b8 17 00 00 00       	mov    $0x17,%eax
+    1013:	cd 40                	int    $0x40
+    1015:	c3                   	ret
+
+00001016 <setpriority>:
+SYSCALL(setpriority)
+    1016:	b8 19 00 00 00       	mov    $0x19,%eax
+    101b:	cd 40                	int    $0x40
+    101d:	c3                   	ret
+
+0000101e <setaffinity>:
+SYSCALL(setaffinity)
+    101e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1023:	cd 40                	int    $0x40
+    1025:	c3                   	ret
+
+00001026 <getaffinity>:
+SYSCALL(getaffinity)
+    1026:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    102b:	cd 40                	int    $0x40
+    102d:	c3                   	ret
+
+0000102e <nanosleep>:
+SYSCALL(nanosleep)
+    102e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1033:	cd 40                	int    $0x40
+    1035:	c3                   	ret
+
+00001036 <cpustat>:
+SYSCALL(cpustat)
+    1036:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    103b:	cd 40                	int    $0x40
+    103d:	c3                   	ret
+
+0000103e <nanouptime>:
+SYSCALL(nanouptime)
+    103e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1043:	cd 40                	int    $0x40
+    1045:	c3                   	ret
+
+00001046 <settickets>:
+SYSCALL(settickets)
+    1046:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    104b:	cd 40                	int    $0x40
+    104d:	c3                   	ret
+
+0000104e <setdeadline>:
+SYSCALL(setdeadline)
+    104e:	b8 20 00 00 00       	mov    $0x20,%eax
+    1053:	cd 40                	int    $0x40
+    1055:	c3                   	ret
+
+00001056 <rtstat>:
+SYSCALL(rtstat)
+    1056:	b8 21 00 00 00       	mov    $0x21,%eax
+    105b:	cd 40                	int    $0x40
+    105d:	c3                   	ret
+
+0000105e <schedstat>:
+SYSCALL(schedstat)
+    105e:	b8 22 00 00 00       	mov    $0x22,%eax
+    1063:	cd 40                	int    $0x40
+    1065:	c3                   	ret
+
+00001066 <waitpid>:
+SYSCALL(waitpid)
+    1066:	b8 23 00 00 00       	mov    $0x23,%eax
+    106b:	cd 40                	int    $0x40
+    106d:	c3                   	ret
+
+0000106e <clone>:
+SYSCALL(clone)
+    106e:	b8 24 00 00 00       	mov    $0x24,%eax
+    1073:	cd 40                	int    $0x40
+    1075:	c3                   	ret
+
+00001076 <futexwait>:
+SYSCALL(futexwait)
+    1076:	b8 25 00 00 00       	mov    $0x25,%eax
+    107b:	cd 40                	int    $0x40
+    107d:	c3                   	ret
+
+0000107e <futexwake>:
+SYSCALL(futexwake)
+    107e:	b8 26 00 00 00       	mov    $0x26,%eax
+    1083:	cd 40                	int    $0x40
+    1085:	c3                   	ret
+
+00001086 <lockstat>:
+SYSCALL(lockstat)
+    1086:	b8 27 00 00 00       	mov    $0x27,%eax
+    108b:	cd 40                	int    $0x40
+    108d:	c3                   	ret
+
+0000108e <dcachestat>:
+SYSCALL(dcachestat)
+    108e:	b8 28 00 00 00       	mov    $0x28,%eax
+    1093:	cd 40                	int    $0x40
+    1095:	c3                   	ret
+
+00001096 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    1096:	55                   	push   %ebp
+    1097:	89 e5                	mov    %esp,%ebp
+    1099:	83 ec 18             	sub    $0x18,%esp
+    109c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    109f:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    10a2:	83 ec 04             	sub    $0x4,%esp
+    10a5:	6a 01                	push   $0x1
+    10a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10aa:	50                   	push   %eax
+    10ab:	ff 75 08             	push   0x8(%ebp)
+    10ae:	e8 d3 fe ff ff       	call   f86 <write>
+    10b3:	83 c4 10             	add    $0x10,%esp
+}
+    10b6:	90                   	nop
+    10b7:	c9                   	leave
+    10b8:	c3                   	ret
+
+000010b9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    10b9:	55                   	push   %ebp
+    10ba:	89 e5                	mov    %esp,%ebp
+    10bc:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    10bf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    10c6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    10ca:	74 17                	je     10e3 <printint+0x2a>
+    10cc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    10d0:	79 11                	jns    10e3 <printint+0x2a>
+    neg = 1;
+    10d2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    10d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10dc:	f7 d8                	neg    %eax
+    10de:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    10e1:	eb 06                	jmp    10e9 <printint+0x30>
+  } else {
+    x = xx;
+    10e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    10e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    10f0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    10f3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    10f6:	ba 00 00 00 00       	mov    $0x0,%edx
+    10fb:	f7 f1                	div    %ecx
+    10fd:	89 d1                	mov    %edx,%ecx
+    10ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1102:	8d 50 01             	lea    0x1(%eax),%edx
+    1105:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1108:	0f b6 91 c8 1c 00 00 	movzbl 0x1cc8(%ecx),%edx
+    110f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    1113:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    1116:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1119:	ba 00 00 00 00       	mov    $0x0,%edx
+    111e:	f7 f1                	div    %ecx
+    1120:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    1123:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1127:	75 c7                	jne    10f0 <printint+0x37>
+  if(neg)
+    1129:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    112d:	74 2d                	je     115c <printint+0xa3>
+    buf[i++] = '-';
+    112f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1132:	8d 50 01             	lea    0x1(%eax),%edx
+    1135:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    1138:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    113d:	eb 1d                	jmp    115c <printint+0xa3>
+    putc(fd, buf[i]);
+    113f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    1142:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1145:	01 d0                	add    %edx,%eax
+    1147:	0f b6 00             	movzbl (%eax),%eax
+    114a:	0f be c0             	movsbl %al,%eax
+    114d:	83 ec 08             	sub    $0x8,%esp
+    1150:	50                   	push   %eax
+    1151:	ff 75 08             	push   0x8(%ebp)
+    1154:	e8 3d ff ff ff       	call   1096 <putc>
+    1159:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    115c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    1160:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1164:	79 d9                	jns    113f <printint+0x86>
+}
+    1166:	90                   	nop
+    1167:	90                   	nop
+    1168:	c9                   	leave
+    1169:	c3                   	ret
+
+0000116a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    116a:	55                   	push   %ebp
+    116b:	89 e5                	mov    %esp,%ebp
+    116d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    1170:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    1177:	8d 45 0c             	lea    0xc(%ebp),%eax
+    117a:	83 c0 04             	add    $0x4,%eax
+    117d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    1180:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1187:	e9 59 01 00 00       	jmp    12e5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    118c:	8b 55 0c             	mov    0xc(%ebp),%edx
+    118f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1192:	01 d0                	add    %edx,%eax
+    1194:	0f b6 00             	movzbl (%eax),%eax
+    1197:	0f be c0             	movsbl %al,%eax
+    119a:	25 ff 00 00 00       	and    $0xff,%eax
+    119f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    11a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    11a6:	75 2c                	jne    11d4 <printf+0x6a>
+      if(c == '%'){
+    11a8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    11ac:	75 0c                	jne    11ba <printf+0x50>
+        state = '%';
+    11ae:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    11b5:	e9 27 01 00 00       	jmp    12e1 <printf+0x177>
+      } else {
+        putc(fd, c);
+    11ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    11bd:	0f be c0             	movsbl %al,%eax
+    11c0:	83 ec 08             	sub    $0x8,%esp
+    11c3:	50                   	push   %eax
+    11c4:	ff 75 08             	push   0x8(%ebp)
+    11c7:	e8 ca fe ff ff       	call   1096 <putc>
+    11cc:	83 c4 10             	add    $0x10,%esp
+    11cf:	e9 0d 01 00 00       	jmp    12e1 <printf+0x177>
+      }
+    } else if(state == '%'){
+    11d4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    11d8:	0f 85 03 01 00 00    	jne    12e1 <printf+0x177>
+      if(c == 'd'){
+    11de:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    11e2:	75 1e                	jne    1202 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    11e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    11e7:	8b 00                	mov    (%eax),%eax
+    11e9:	6a 01                	push   $0x1
+    11eb:	6a 0a                	push   $0xa
+    11ed:	50                   	push   %eax
+    11ee:	ff 75 08             	push   0x8(%ebp)
+    11f1:	e8 c3 fe ff ff       	call   10b9 <printint>
+    11f6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    11f9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    11fd:	e9 d8 00 00 00       	jmp    12da <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    1202:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    1206:	74 06                	je     120e <printf+0xa4>
+    1208:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    120c:	75 1e                	jne    122c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    120e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1211:	8b 00                	mov    (%eax),%eax
+    1213:	6a 00                	push   $0x0
+    1215:	6a 10                	push   $0x10
+    1217:	50                   	push   %eax
+    1218:	ff 75 08             	push   0x8(%ebp)
+    121b:	e8 99 fe ff ff       	call   10b9 <printint>
+    1220:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1223:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1227:	e9 ae 00 00 00       	jmp    12da <printf+0x170>
+      } else if(c == 's'){
+    122c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    1230:	75 43                	jne    1275 <printf+0x10b>
+        s = (char*)*ap;
+    1232:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1235:	8b 00                	mov    (%eax),%eax
+    1237:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    123a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    123e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1242:	75 25                	jne    1269 <printf+0xff>
+          s = "(null)";
+    1244:	c7 45 f4 d0 17 00 00 	movl   $0x17d0,-0xc(%ebp)
+        while(*s != 0){
+    124b:	eb 1c                	jmp    1269 <printf+0xff>
+          putc(fd, *s);
+    124d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1250:	0f b6 00             	movzbl (%eax),%eax
+    1253:	0f be c0             	movsbl %al,%eax
+    1256:	83 ec 08             	sub    $0x8,%esp
+    1259:	50                   	push   %eax
+    125a:	ff 75 08             	push   0x8(%ebp)
+    125d:	e8 34 fe ff ff       	call   1096 <putc>
+    1262:	83 c4 10             	add    $0x10,%esp
+          s++;
+    1265:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    1269:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    126c:	0f b6 00             	movzbl (%eax),%eax
+    126f:	84 c0                	test   %al,%al
+    1271:	75 da                	jne    124d <printf+0xe3>
+    1273:	eb 65                	jmp    12da <printf+0x170>
+        }
+      } else if(c == 'c'){
+    1275:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    1279:	75 1d                	jne    1298 <printf+0x12e>
+        putc(fd, *ap);
+    127b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    127e:	8b 00                	mov    (%eax),%eax
+    1280:	0f be c0             	movsbl %al,%eax
+    1283:	83 ec 08             	sub    $0x8,%esp
+    1286:	50                   	push   %eax
+    1287:	ff 75 08             	push   0x8(%ebp)
+    128a:	e8 07 fe ff ff       	call   1096 <putc>
+    128f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    1292:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    1296:	eb 42                	jmp    12da <printf+0x170>
+      } else if(c == '%'){
+    1298:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    129c:	75 17                	jne    12b5 <printf+0x14b>
+        putc(fd, c);
+    129e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12a1:	0f be c0             	movsbl %al,%eax
+    12a4:	83 ec 08             	sub    $0x8,%esp
+    12a7:	50                   	push   %eax
+    12a8:	ff 75 08             	push   0x8(%ebp)
+    12ab:	e8 e6 fd ff ff       	call   1096 <putc>
+    12b0:	83 c4 10             	add    $0x10,%esp
+    12b3:	eb 25                	jmp    12da <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    12b5:	83 ec 08             	sub    $0x8,%esp
+    12b8:	6a 25                	push   $0x25
+    12ba:	ff 75 08             	push   0x8(%ebp)
+    12bd:	e8 d4 fd ff ff       	call   1096 <putc>
+    12c2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    12c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    12c8:	0f be c0             	movsbl %al,%eax
+    12cb:	83 ec 08             	sub    $0x8,%esp
+    12ce:	50                   	push   %eax
+    12cf:	ff 75 08             	push   0x8(%ebp)
+    12d2:	e8 bf fd ff ff       	call   1096 <putc>
+    12d7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    12da:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    12e1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    12e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+    12e8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    12eb:	01 d0                	add    %edx,%eax
+    12ed:	0f b6 00             	movzbl (%eax),%eax
+    12f0:	84 c0                	test   %al,%al
+    12f2:	0f 85 94 fe ff ff    	jne    118c <printf+0x22>
+    }
+  }
+}
+    12f8:	90                   	nop
+    12f9:	90                   	nop
+    12fa:	c9                   	leave
+    12fb:	c3                   	ret
+
+000012fc <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+    12fc:	55                   	push   %ebp
+    12fd:	89 e5                	mov    %esp,%ebp
+    12ff:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+    1302:	8b 15 88 1d 00 00    	mov    0x1d88,%edx
+    1308:	a1 84 1d 00 00       	mov    0x1d84,%eax
+    130d:	29 c2                	sub    %eax,%edx
+    130f:	89 d0                	mov    %edx,%eax
+    1311:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1314:	0f 83 ed 00 00 00    	jae    1407 <carve+0x10b>
+    n = size > growsz ? size : growsz;
+    131a:	a1 dc 1c 00 00       	mov    0x1cdc,%eax
+    131f:	8b 55 08             	mov    0x8(%ebp),%edx
+    1322:	39 c2                	cmp    %eax,%edx
+    1324:	0f 43 c2             	cmovae %edx,%eax
+    1327:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+    132a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    132d:	05 ff 0f 00 00       	add    $0xfff,%eax
+    1332:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    1337:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+    133a:	a1 dc 1c 00 00       	mov    0x1cdc,%eax
+    133f:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+    1344:	77 0c                	ja     1352 <carve+0x56>
+      growsz *= 2;
+    1346:	a1 dc 1c 00 00       	mov    0x1cdc,%eax
+    134b:	01 c0                	add    %eax,%eax
+    134d:	a3 dc 1c 00 00       	mov    %eax,0x1cdc
+    p = sbrk(n);
+    1352:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1355:	83 ec 0c             	sub    $0xc,%esp
+    1358:	50                   	push   %eax
+    1359:	e8 90 fc ff ff       	call   fee <sbrk>
+    135e:	83 c4 10             	add    $0x10,%esp
+    1361:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+    1364:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1368:	75 2a                	jne    1394 <carve+0x98>
+    136a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    136d:	39 45 08             	cmp    %eax,0x8(%ebp)
+    1370:	73 22                	jae    1394 <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+    1372:	8b 45 08             	mov    0x8(%ebp),%eax
+    1375:	05 ff 0f 00 00       	add    $0xfff,%eax
+    137a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    137f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+    1382:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1385:	83 ec 0c             	sub    $0xc,%esp
+    1388:	50                   	push   %eax
+    1389:	e8 60 fc ff ff       	call   fee <sbrk>
+    138e:	83 c4 10             	add    $0x10,%esp
+    1391:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+    1394:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    1398:	75 0a                	jne    13a4 <carve+0xa8>
+      return 0;
+    139a:	b8 00 00 00 00       	mov    $0x0,%eax
+    139f:	e9 86 00 00 00       	jmp    142a <carve+0x12e>
+    if(p != limit){
+    13a4:	a1 88 1d 00 00       	mov    0x1d88,%eax
+    13a9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    13ac:	74 4c                	je     13fa <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+    13ae:	8b 15 88 1d 00 00    	mov    0x1d88,%edx
+    13b4:	a1 84 1d 00 00       	mov    0x1d84,%eax
+    13b9:	29 c2                	sub    %eax,%edx
+    13bb:	83 fa 0f             	cmp    $0xf,%edx
+    13be:	7e 32                	jle    13f2 <carve+0xf6>
+        b = (Block*)top;
+    13c0:	a1 84 1d 00 00       	mov    0x1d84,%eax
+    13c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+    13c8:	8b 15 88 1d 00 00    	mov    0x1d88,%edx
+    13ce:	a1 84 1d 00 00       	mov    0x1d84,%eax
+    13d3:	29 c2                	sub    %eax,%edx
+    13d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13d8:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+    13da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    13dd:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+    13e4:	83 ec 0c             	sub    $0xc,%esp
+    13e7:	ff 75 ec             	push   -0x14(%ebp)
+    13ea:	e8 3d 00 00 00       	call   142c <lfree>
+    13ef:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+    13f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13f5:	a3 84 1d 00 00       	mov    %eax,0x1d84
+    }
+    limit = p + n;
+    13fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    13fd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1400:	01 d0                	add    %edx,%eax
+    1402:	a3 88 1d 00 00       	mov    %eax,0x1d88
+  }
+  b = (Block*)top;
+    1407:	a1 84 1d 00 00       	mov    0x1d84,%eax
+    140c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+    140f:	8b 15 84 1d 00 00    	mov    0x1d84,%edx
+    1415:	8b 45 08             	mov    0x8(%ebp),%eax
+    1418:	01 d0                	add    %edx,%eax
+    141a:	a3 84 1d 00 00       	mov    %eax,0x1d84
+  b->h.size = size;
+    141f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1422:	8b 55 08             	mov    0x8(%ebp),%edx
+    1425:	89 10                	mov    %edx,(%eax)
+  return b;
+    1427:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+    142a:	c9                   	leave
+    142b:	c3                   	ret
+
+0000142c <lfree>:
+
+static void
+lfree(Block *b)
+{
+    142c:	55                   	push   %ebp
+    142d:	89 e5                	mov    %esp,%ebp
+    142f:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+    1432:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+    1439:	a1 80 1d 00 00       	mov    0x1d80,%eax
+    143e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1441:	eb 0f                	jmp    1452 <lfree+0x26>
+    prev = p;
+    1443:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1446:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+    1449:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    144c:	8b 40 08             	mov    0x8(%eax),%eax
+    144f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    1452:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    1456:	74 08                	je     1460 <lfree+0x34>
+    1458:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    145b:	3b 45 08             	cmp    0x8(%ebp),%eax
+    145e:	72 e3                	jb     1443 <lfree+0x17>
+  b->next = p;
+    1460:	8b 45 08             	mov    0x8(%ebp),%eax
+    1463:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    1466:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+    1469:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    146d:	74 2c                	je     149b <lfree+0x6f>
+    146f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1472:	8b 10                	mov    (%eax),%edx
+    1474:	8b 45 08             	mov    0x8(%ebp),%eax
+    1477:	01 d0                	add    %edx,%eax
+    1479:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    147c:	75 1d                	jne    149b <lfree+0x6f>
+    b->h.size += p->h.size;
+    147e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1481:	8b 10                	mov    (%eax),%edx
+    1483:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1486:	8b 00                	mov    (%eax),%eax
+    1488:	01 c2                	add    %eax,%edx
+    148a:	8b 45 08             	mov    0x8(%ebp),%eax
+    148d:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+    148f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1492:	8b 50 08             	mov    0x8(%eax),%edx
+    1495:	8b 45 08             	mov    0x8(%ebp),%eax
+    1498:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    149b:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+    149f:	74 2e                	je     14cf <lfree+0xa3>
+    14a1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14a4:	8b 10                	mov    (%eax),%edx
+    14a6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14a9:	01 d0                	add    %edx,%eax
+    14ab:	39 45 08             	cmp    %eax,0x8(%ebp)
+    14ae:	75 1f                	jne    14cf <lfree+0xa3>
+    prev->h.size += b->h.size;
+    14b0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14b3:	8b 10                	mov    (%eax),%edx
+    14b5:	8b 45 08             	mov    0x8(%ebp),%eax
+    14b8:	8b 00                	mov    (%eax),%eax
+    14ba:	01 c2                	add    %eax,%edx
+    14bc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14bf:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+    14c1:	8b 45 08             	mov    0x8(%ebp),%eax
+    14c4:	8b 50 08             	mov    0x8(%eax),%edx
+    14c7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14ca:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+    14cd:	eb 19                	jmp    14e8 <lfree+0xbc>
+  } else if(prev)
+    14cf:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+    14d3:	74 0b                	je     14e0 <lfree+0xb4>
+    prev->next = b;
+    14d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    14d8:	8b 55 08             	mov    0x8(%ebp),%edx
+    14db:	89 50 08             	mov    %edx,0x8(%eax)
+}
+    14de:	eb 08                	jmp    14e8 <lfree+0xbc>
+    large = b;
+    14e0:	8b 45 08             	mov    0x8(%ebp),%eax
+    14e3:	a3 80 1d 00 00       	mov    %eax,0x1d80
+}
+    14e8:	90                   	nop
+    14e9:	c9                   	leave
+    14ea:	c3                   	ret
+
+000014eb <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+    14eb:	55                   	push   %ebp
+    14ec:	89 e5                	mov    %esp,%ebp
+    14ee:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+    14f1:	c7 45 f0 80 1d 00 00 	movl   $0x1d80,-0x10(%ebp)
+    14f8:	eb 52                	jmp    154c <lalloc+0x61>
+    if(p->h.size < size)
+    14fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14fd:	8b 00                	mov    (%eax),%eax
+    14ff:	3b 45 08             	cmp    0x8(%ebp),%eax
+    1502:	72 3e                	jb     1542 <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+    1504:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1507:	8b 00                	mov    (%eax),%eax
+    1509:	2b 45 08             	sub    0x8(%ebp),%eax
+    150c:	83 f8 0f             	cmp    $0xf,%eax
+    150f:	76 21                	jbe    1532 <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+    1511:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1514:	8b 00                	mov    (%eax),%eax
+    1516:	2b 45 08             	sub    0x8(%ebp),%eax
+    1519:	89 c2                	mov    %eax,%edx
+    151b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    151e:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+    1520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1523:	8b 00                	mov    (%eax),%eax
+    1525:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+    1528:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    152b:	8b 55 08             	mov    0x8(%ebp),%edx
+    152e:	89 10                	mov    %edx,(%eax)
+    1530:	eb 0b                	jmp    153d <lalloc+0x52>
+    } else
+      *pp = p->next;
+    1532:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1535:	8b 50 08             	mov    0x8(%eax),%edx
+    1538:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    153b:	89 10                	mov    %edx,(%eax)
+    return p;
+    153d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1540:	eb 26                	jmp    1568 <lalloc+0x7d>
+      continue;
+    1542:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+    1543:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1546:	83 c0 08             	add    $0x8,%eax
+    1549:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    154c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    154f:	8b 00                	mov    (%eax),%eax
+    1551:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1554:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1558:	75 a0                	jne    14fa <lalloc+0xf>
+  }
+  return carve(size);
+    155a:	83 ec 0c             	sub    $0xc,%esp
+    155d:	ff 75 08             	push   0x8(%ebp)
+    1560:	e8 97 fd ff ff       	call   12fc <carve>
+    1565:	83 c4 10             	add    $0x10,%esp
+}
+    1568:	c9                   	leave
+    1569:	c3                   	ret
+
+0000156a <free>:
+
+void
+free(void *ap)
+{
+    156a:	55                   	push   %ebp
+    156b:	89 e5                	mov    %esp,%ebp
+    156d:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+    1570:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1574:	74 46                	je     15bc <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+    1576:	8b 45 08             	mov    0x8(%ebp),%eax
+    1579:	83 e8 08             	sub    $0x8,%eax
+    157c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+    157f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1582:	8b 40 04             	mov    0x4(%eax),%eax
+    1585:	83 f8 07             	cmp    $0x7,%eax
+    1588:	77 25                	ja     15af <free+0x45>
+    b->next = bins[b->h.bin];
+    158a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    158d:	8b 40 04             	mov    0x4(%eax),%eax
+    1590:	8b 14 85 60 1d 00 00 	mov    0x1d60(,%eax,4),%edx
+    1597:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    159a:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+    159d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    15a0:	8b 40 04             	mov    0x4(%eax),%eax
+    15a3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    15a6:	89 14 85 60 1d 00 00 	mov    %edx,0x1d60(,%eax,4)
+    15ad:	eb 0e                	jmp    15bd <free+0x53>
+  } else
+    lfree(b);
+    15af:	ff 75 fc             	push   -0x4(%ebp)
+    15b2:	e8 75 fe ff ff       	call   142c <lfree>
+    15b7:	83 c4 04             	add    $0x4,%esp
+    15ba:	eb 01                	jmp    15bd <free+0x53>
+    return;
+    15bc:	90                   	nop
+}
+    15bd:	c9                   	leave
+    15be:	c3                   	ret
+
+000015bf <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    15bf:	55                   	push   %ebp
+    15c0:	89 e5                	mov    %esp,%ebp
+    15c2:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+    15c5:	8b 45 08             	mov    0x8(%ebp),%eax
+    15c8:	83 c0 08             	add    $0x8,%eax
+    15cb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+    15ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    15d1:	3b 45 08             	cmp    0x8(%ebp),%eax
+    15d4:	73 0a                	jae    15e0 <malloc+0x21>
+    return 0;
+    15d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    15db:	e9 b8 00 00 00       	jmp    1698 <malloc+0xd9>
+  if(size <= MAXSMALL){
+    15e0:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+    15e7:	77 6f                	ja     1658 <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+    15e9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    15f0:	eb 04                	jmp    15f6 <malloc+0x37>
+    15f2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    15f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15f9:	ba 10 00 00 00       	mov    $0x10,%edx
+    15fe:	89 c1                	mov    %eax,%ecx
+    1600:	d3 e2                	shl    %cl,%edx
+    1602:	89 d0                	mov    %edx,%eax
+    1604:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1607:	72 e9                	jb     15f2 <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+    1609:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    160c:	8b 04 85 60 1d 00 00 	mov    0x1d60(,%eax,4),%eax
+    1613:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1616:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    161a:	74 12                	je     162e <malloc+0x6f>
+      bins[bin] = b->next;
+    161c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    161f:	8b 50 08             	mov    0x8(%eax),%edx
+    1622:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1625:	89 14 85 60 1d 00 00 	mov    %edx,0x1d60(,%eax,4)
+    162c:	eb 5b                	jmp    1689 <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+    162e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1631:	ba 10 00 00 00       	mov    $0x10,%edx
+    1636:	89 c1                	mov    %eax,%ecx
+    1638:	d3 e2                	shl    %cl,%edx
+    163a:	89 d0                	mov    %edx,%eax
+    163c:	83 ec 0c             	sub    $0xc,%esp
+    163f:	50                   	push   %eax
+    1640:	e8 b7 fc ff ff       	call   12fc <carve>
+    1645:	83 c4 10             	add    $0x10,%esp
+    1648:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    164b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    164f:	75 38                	jne    1689 <malloc+0xca>
+      return 0;
+    1651:	b8 00 00 00 00       	mov    $0x0,%eax
+    1656:	eb 40                	jmp    1698 <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+    1658:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    165b:	83 c0 07             	add    $0x7,%eax
+    165e:	83 e0 f8             	and    $0xfffffff8,%eax
+    1661:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+    1664:	83 ec 0c             	sub    $0xc,%esp
+    1667:	ff 75 ec             	push   -0x14(%ebp)
+    166a:	e8 7c fe ff ff       	call   14eb <lalloc>
+    166f:	83 c4 10             	add    $0x10,%esp
+    1672:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1675:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1679:	75 07                	jne    1682 <malloc+0xc3>
+      return 0;
+    167b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1680:	eb 16                	jmp    1698 <malloc+0xd9>
+    bin = LARGE;
+    1682:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+    1689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    168c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    168f:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+    1692:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1695:	83 c0 08             	add    $0x8,%eax
+}
+    1698:	c9                   	leave
+    1699:	c3                   	ret
@@ -0,0 +1,972 @@
+
+_sharetest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <spinner>:
+
+static volatile uint spin;
+
+static void
+spinner(int child, int tickets, int go, int out)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  struct result r;
+  uint end;
+  char c;
+  int i;
+
+  if(setaffinity(getpid(), 1) < 0 || settickets(getpid(), tickets) < 0){
+   6:	e8 94 04 00 00       	call   49f <getpid>
+   b:	83 ec 08             	sub    $0x8,%esp
+   e:	6a 01                	push   $0x1
+  10:	50                   	push   %eax
+  11:	e8 c1 04 00 00       	call   4d7 <setaffinity>
+  16:	83 c4 10             	add    $0x10,%esp
+  19:	85 c0                	test   %eax,%eax
+  1b:	78 18                	js     35 <spinner+0x35>
+  1d:	e8 7d 04 00 00       	call   49f <getpid>
+  22:	83 ec 08             	sub    $0x8,%esp
+  25:	ff 75 0c             	push   0xc(%ebp)
+  28:	50                   	push   %eax
+  29:	e8 d1 04 00 00       	call   4ff <settickets>
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	85 c0                	test   %eax,%eax
+  33:	79 17                	jns    4c <spinner+0x4c>
+    printf(1, "sharetest: cannot set up child\n");
+  35:	83 ec 08             	sub    $0x8,%esp
+  38:	68 b8 07 00 00       	push   $0x7b8
+  3d:	6a 01                	push   $0x1
+  3f:	e8 df 05 00 00       	call   623 <printf>
+  44:	83 c4 10             	add    $0x10,%esp
+    exit();
+  47:	e8 d3 03 00 00       	call   41f <exit>
+  }
+  read(go, &c, 1);
+  4c:	83 ec 04             	sub    $0x4,%esp
+  4f:	6a 01                	push   $0x1
+  51:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  54:	50                   	push   %eax
+  55:	ff 75 10             	push   0x10(%ebp)
+  58:	e8 da 03 00 00       	call   437 <read>
+  5d:	83 c4 10             	add    $0x10,%esp
+  r.child = child;
+  60:	8b 45 08             	mov    0x8(%ebp),%eax
+  63:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  r.count = 0;
+  66:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  end = uptime() + DURATION;
+  6d:	e8 45 04 00 00       	call   4b7 <uptime>
+  72:	05 2c 01 00 00       	add    $0x12c,%eax
+  77:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while(uptime() < end){
+  7a:	eb 2c                	jmp    a8 <spinner+0xa8>
+    for(i = 0; i < 1000; i++)
+  7c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  83:	eb 11                	jmp    96 <spinner+0x96>
+      spin++;
+  85:	a1 90 09 00 00       	mov    0x990,%eax
+  8a:	83 c0 01             	add    $0x1,%eax
+  8d:	a3 90 09 00 00       	mov    %eax,0x990
+    for(i = 0; i < 1000; i++)
+  92:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  96:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  9d:	7e e6                	jle    85 <spinner+0x85>
+    r.count++;
+  9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  a2:	83 c0 01             	add    $0x1,%eax
+  a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  while(uptime() < end){
+  a8:	e8 0a 04 00 00       	call   4b7 <uptime>
+  ad:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+  b0:	72 ca                	jb     7c <spinner+0x7c>
+  }
+  write(out, &r, sizeof(r));
+  b2:	83 ec 04             	sub    $0x4,%esp
+  b5:	6a 08                	push   $0x8
+  b7:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  ba:	50                   	push   %eax
+  bb:	ff 75 14             	push   0x14(%ebp)
+  be:	e8 7c 03 00 00       	call   43f <write>
+  c3:	83 c4 10             	add    $0x10,%esp
+  exit();
+  c6:	e8 54 03 00 00       	call   41f <exit>
+
+000000cb <run>:
+// Run one child per entry of tickets[] and compare shares;
+// an entry of 0 runs a child in the MLFQ instead.
+// Return 0 if every share is within TOLERANCE.
+static int
+run(int *tickets, int n)
+{
+  cb:	55                   	push   %ebp
+  cc:	89 e5                	mov    %esp,%ebp
+  ce:	53                   	push   %ebx
+  cf:	83 ec 44             	sub    $0x44,%esp
+  int go[2], out[2];
+  struct result r;
+  uint count[NCHILD], total;
+  int i, want, got, bad, sum;
+
+  if(pipe(go) < 0 || pipe(out) < 0){
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  d8:	50                   	push   %eax
+  d9:	e8 51 03 00 00       	call   42f <pipe>
+  de:	83 c4 10             	add    $0x10,%esp
+  e1:	85 c0                	test   %eax,%eax
+  e3:	78 13                	js     f8 <run+0x2d>
+  e5:	83 ec 0c             	sub    $0xc,%esp
+  e8:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  eb:	50                   	push   %eax
+  ec:	e8 3e 03 00 00       	call   42f <pipe>
+  f1:	83 c4 10             	add    $0x10,%esp
+  f4:	85 c0                	test   %eax,%eax
+  f6:	79 17                	jns    10f <run+0x44>
+    printf(1, "sharetest: pipe failed\n");
+  f8:	83 ec 08             	sub    $0x8,%esp
+  fb:	68 d8 07 00 00       	push   $0x7d8
+ 100:	6a 01                	push   $0x1
+ 102:	e8 1c 05 00 00       	call   623 <printf>
+ 107:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 10a:	e8 10 03 00 00       	call   41f <exit>
+  }
+  sum = 0;
+ 10f:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+  for(i = 0; i < n; i++){
+ 116:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 11d:	e9 80 00 00 00       	jmp    1a2 <run+0xd7>
+    sum += tickets[i] ? tickets[i] : MLFQTICKETS;
+ 122:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 125:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 12c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12f:	01 d0                	add    %edx,%eax
+ 131:	8b 00                	mov    (%eax),%eax
+ 133:	85 c0                	test   %eax,%eax
+ 135:	74 13                	je     14a <run+0x7f>
+ 137:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 13a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 141:	8b 45 08             	mov    0x8(%ebp),%eax
+ 144:	01 d0                	add    %edx,%eax
+ 146:	8b 00                	mov    (%eax),%eax
+ 148:	eb 05                	jmp    14f <run+0x84>
+ 14a:	b8 64 00 00 00       	mov    $0x64,%eax
+ 14f:	01 45 e8             	add    %eax,-0x18(%ebp)
+    if(fork() == 0){
+ 152:	e8 c0 02 00 00       	call   417 <fork>
+ 157:	85 c0                	test   %eax,%eax
+ 159:	75 43                	jne    19e <run+0xd3>
+      close(go[1]);
+ 15b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 15e:	83 ec 0c             	sub    $0xc,%esp
+ 161:	50                   	push   %eax
+ 162:	e8 e0 02 00 00       	call   447 <close>
+ 167:	83 c4 10             	add    $0x10,%esp
+      close(out[0]);
+ 16a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 16d:	83 ec 0c             	sub    $0xc,%esp
+ 170:	50                   	push   %eax
+ 171:	e8 d1 02 00 00       	call   447 <close>
+ 176:	83 c4 10             	add    $0x10,%esp
+      spinner(i, tickets[i], go[0], out[1]);
+ 179:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+ 17c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+ 17f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 182:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+ 189:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18c:	01 d8                	add    %ebx,%eax
+ 18e:	8b 00                	mov    (%eax),%eax
+ 190:	51                   	push   %ecx
+ 191:	52                   	push   %edx
+ 192:	50                   	push   %eax
+ 193:	ff 75 f0             	push   -0x10(%ebp)
+ 196:	e8 65 fe ff ff       	call   0 <spinner>
+ 19b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 19e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 1a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1a5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 1a8:	0f 8c 74 ff ff ff    	jl     122 <run+0x57>
+    }
+  }
+  close(go[0]);
+ 1ae:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 1b1:	83 ec 0c             	sub    $0xc,%esp
+ 1b4:	50                   	push   %eax
+ 1b5:	e8 8d 02 00 00       	call   447 <close>
+ 1ba:	83 c4 10             	add    $0x10,%esp
+  close(out[1]);
+ 1bd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 1c0:	83 ec 0c             	sub    $0xc,%esp
+ 1c3:	50                   	push   %eax
+ 1c4:	e8 7e 02 00 00       	call   447 <close>
+ 1c9:	83 c4 10             	add    $0x10,%esp
+
+  // Give every child time to join the stride class, then start them.
+  sleep(10);
+ 1cc:	83 ec 0c             	sub    $0xc,%esp
+ 1cf:	6a 0a                	push   $0xa
+ 1d1:	e8 d9 02 00 00       	call   4af <sleep>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 1d9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 1e0:	eb 1a                	jmp    1fc <run+0x131>
+    write(go[1], "g", 1);
+ 1e2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1e5:	83 ec 04             	sub    $0x4,%esp
+ 1e8:	6a 01                	push   $0x1
+ 1ea:	68 f0 07 00 00       	push   $0x7f0
+ 1ef:	50                   	push   %eax
+ 1f0:	e8 4a 02 00 00       	call   43f <write>
+ 1f5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+ 1f8:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 1fc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 1ff:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 202:	7c de                	jl     1e2 <run+0x117>
+
+  total = 0;
+ 204:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  for(i = 0; i < n; i++){
+ 20b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 212:	eb 45                	jmp    259 <run+0x18e>
+    if(read(out[0], &r, sizeof(r)) != sizeof(r)){
+ 214:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 217:	83 ec 04             	sub    $0x4,%esp
+ 21a:	6a 08                	push   $0x8
+ 21c:	8d 55 c8             	lea    -0x38(%ebp),%edx
+ 21f:	52                   	push   %edx
+ 220:	50                   	push   %eax
+ 221:	e8 11 02 00 00       	call   437 <read>
+ 226:	83 c4 10             	add    $0x10,%esp
+ 229:	83 f8 08             	cmp    $0x8,%eax
+ 22c:	74 17                	je     245 <run+0x17a>
+      printf(1, "sharetest: lost a child\n");
+ 22e:	83 ec 08             	sub    $0x8,%esp
+ 231:	68 f2 07 00 00       	push   $0x7f2
+ 236:	6a 01                	push   $0x1
+ 238:	e8 e6 03 00 00       	call   623 <printf>
+ 23d:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 240:	e8 da 01 00 00       	call   41f <exit>
+    }
+    count[r.child] = r.count;
+ 245:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 248:	8b 55 cc             	mov    -0x34(%ebp),%edx
+ 24b:	89 54 85 bc          	mov    %edx,-0x44(%ebp,%eax,4)
+    total += r.count;
+ 24f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 252:	01 45 f4             	add    %eax,-0xc(%ebp)
+  for(i = 0; i < n; i++){
+ 255:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 259:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 25c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 25f:	7c b3                	jl     214 <run+0x149>
+  }
+  for(i = 0; i < n; i++)
+ 261:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 268:	eb 09                	jmp    273 <run+0x1a8>
+    wait();
+ 26a:	e8 b8 01 00 00       	call   427 <wait>
+  for(i = 0; i < n; i++)
+ 26f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 273:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 276:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 279:	7c ef                	jl     26a <run+0x19f>
+  close(go[1]);
+ 27b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	50                   	push   %eax
+ 282:	e8 c0 01 00 00       	call   447 <close>
+ 287:	83 c4 10             	add    $0x10,%esp
+  close(out[0]);
+ 28a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 28d:	83 ec 0c             	sub    $0xc,%esp
+ 290:	50                   	push   %eax
+ 291:	e8 b1 01 00 00       	call   447 <close>
+ 296:	83 c4 10             	add    $0x10,%esp
+
+  bad = 0;
+ 299:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+ 2a0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 2a7:	e9 d0 00 00 00       	jmp    37c <run+0x2b1>
+    want = (tickets[i] ? tickets[i] : MLFQTICKETS) * 100 / sum;
+ 2ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2af:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 2b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b9:	01 d0                	add    %edx,%eax
+ 2bb:	8b 00                	mov    (%eax),%eax
+ 2bd:	85 c0                	test   %eax,%eax
+ 2bf:	74 16                	je     2d7 <run+0x20c>
+ 2c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2c4:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 2cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ce:	01 d0                	add    %edx,%eax
+ 2d0:	8b 00                	mov    (%eax),%eax
+ 2d2:	6b c0 64             	imul   $0x64,%eax,%eax
+ 2d5:	eb 05                	jmp    2dc <run+0x211>
+ 2d7:	b8 10 27 00 00       	mov    $0x2710,%eax
+ 2dc:	99                   	cltd
+ 2dd:	f7 7d e8             	idivl  -0x18(%ebp)
+ 2e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    got = total ? count[i] * 100 / total : 0;
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	74 14                	je     2fd <run+0x232>
+ 2e9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 2ec:	8b 44 85 bc          	mov    -0x44(%ebp,%eax,4),%eax
+ 2f0:	6b c0 64             	imul   $0x64,%eax,%eax
+ 2f3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 2f8:	f7 75 f4             	divl   -0xc(%ebp)
+ 2fb:	eb 05                	jmp    302 <run+0x237>
+ 2fd:	b8 00 00 00 00       	mov    $0x0,%eax
+ 302:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if(tickets[i])
+ 305:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 308:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 30f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 312:	01 d0                	add    %edx,%eax
+ 314:	8b 00                	mov    (%eax),%eax
+ 316:	85 c0                	test   %eax,%eax
+ 318:	74 2c                	je     346 <run+0x27b>
+      printf(1, "  %d tickets: want %d%%, got %d%%\n", tickets[i], want, got);
+ 31a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 31d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 324:	8b 45 08             	mov    0x8(%ebp),%eax
+ 327:	01 d0                	add    %edx,%eax
+ 329:	8b 00                	mov    (%eax),%eax
+ 32b:	83 ec 0c             	sub    $0xc,%esp
+ 32e:	ff 75 e0             	push   -0x20(%ebp)
+ 331:	ff 75 e4             	push   -0x1c(%ebp)
+ 334:	50                   	push   %eax
+ 335:	68 0c 08 00 00       	push   $0x80c
+ 33a:	6a 01                	push   $0x1
+ 33c:	e8 e2 02 00 00       	call   623 <printf>
+ 341:	83 c4 20             	add    $0x20,%esp
+ 344:	eb 15                	jmp    35b <run+0x290>
+    else
+      printf(1, "  mlfq: want %d%%, got %d%%\n", want, got);
+ 346:	ff 75 e0             	push   -0x20(%ebp)
+ 349:	ff 75 e4             	push   -0x1c(%ebp)
+ 34c:	68 2f 08 00 00       	push   $0x82f
+ 351:	6a 01                	push   $0x1
+ 353:	e8 cb 02 00 00       	call   623 <printf>
+ 358:	83 c4 10             	add    $0x10,%esp
+    if(got < want - TOLERANCE || got > want + TOLERANCE)
+ 35b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 35e:	83 e8 05             	sub    $0x5,%eax
+ 361:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+ 364:	7c 0b                	jl     371 <run+0x2a6>
+ 366:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 369:	83 c0 05             	add    $0x5,%eax
+ 36c:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+ 36f:	7e 07                	jle    378 <run+0x2ad>
+      bad = 1;
+ 371:	c7 45 ec 01 00 00 00 	movl   $0x1,-0x14(%ebp)
+  for(i = 0; i < n; i++){
+ 378:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 37c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 37f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 382:	0f 8c 24 ff ff ff    	jl     2ac <run+0x1e1>
+  }
+  return bad;
+ 388:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ 38b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 38e:	c9                   	leave
+ 38f:	c3                   	ret
+
+00000390 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 390:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 394:	83 e4 f0             	and    $0xfffffff0,%esp
+ 397:	ff 71 fc             	push   -0x4(%ecx)
+ 39a:	55                   	push   %ebp
+ 39b:	89 e5                	mov    %esp,%ebp
+ 39d:	51                   	push   %ecx
+ 39e:	83 ec 14             	sub    $0x14,%esp
+  static int two[] = { 70, 30 };
+  static int three[] = { 50, 30, 20 };
+  static int mixed[] = { 70, 30, 0 };
+  int bad;
+
+  printf(1, "sharetest\n");
+ 3a1:	83 ec 08             	sub    $0x8,%esp
+ 3a4:	68 4c 08 00 00       	push   $0x84c
+ 3a9:	6a 01                	push   $0x1
+ 3ab:	e8 73 02 00 00       	call   623 <printf>
+ 3b0:	83 c4 10             	add    $0x10,%esp
+  bad = run(two, 2);
+ 3b3:	83 ec 08             	sub    $0x8,%esp
+ 3b6:	6a 02                	push   $0x2
+ 3b8:	68 5c 09 00 00       	push   $0x95c
+ 3bd:	e8 09 fd ff ff       	call   cb <run>
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  bad |= run(three, 3);
+ 3c8:	83 ec 08             	sub    $0x8,%esp
+ 3cb:	6a 03                	push   $0x3
+ 3cd:	68 64 09 00 00       	push   $0x964
+ 3d2:	e8 f4 fc ff ff       	call   cb <run>
+ 3d7:	83 c4 10             	add    $0x10,%esp
+ 3da:	09 45 f4             	or     %eax,-0xc(%ebp)
+  // A CPU-bound MLFQ process must not starve the stride class.
+  bad |= run(mixed, 3);
+ 3dd:	83 ec 08             	sub    $0x8,%esp
+ 3e0:	6a 03                	push   $0x3
+ 3e2:	68 70 09 00 00       	push   $0x970
+ 3e7:	e8 df fc ff ff       	call   cb <run>
+ 3ec:	83 c4 10             	add    $0x10,%esp
+ 3ef:	09 45 f4             	or     %eax,-0xc(%ebp)
+  printf(1, bad ? "sharetest failed\n" : "sharetest ok\n");
+ 3f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3f6:	74 07                	je     3ff <main+0x6f>
+ 3f8:	b8 57 08 00 00       	mov    $0x857,%eax
+ 3fd:	eb 05                	jmp    404 <main+0x74>
+ 3ff:	b8 69 08 00 00       	mov    $0x869,%eax
+ 404:	83 ec 08             	sub    $0x8,%esp
+ 407:	50                   	push   %eax
+ 408:	6a 01                	push   $0x1
+ 40a:	e8 14 02 00 00       	call   623 <printf>
+ 40f:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 412:	e8 08 00 00 00       	call   41f <exit>
+
+00000417 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 417:	b8 01 00 00 00       	mov    $0x1,%eax
+ 41c:	cd 40                	int    $0x40
+ 41e:	c3                   	ret
+
+0000041f <exit>:
+SYSCALL(exit)
+ 41f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 424:	cd 40                	int    $0x40
+ 426:	c3                   	ret
+
+00000427 <wait>:
+SYSCALL(wait)
+ 427:	b8 03 00 00 00       	mov    $0x3,%eax
+ 42c:	cd 40                	int    $0x40
+ 42e:	c3                   	ret
+
+0000042f <pipe>:
+SYSCALL(pipe)
+ 42f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 434:	cd 40                	int    $0x40
+ 436:	c3                   	ret
+
+00000437 <read>:
+SYSCALL(read)
+ 437:	b8 05 00 00 00       	mov    $0x5,%eax
+ 43c:	cd 40                	int    $0x40
+ 43e:	c3                   	ret
+
+0000043f <write>:
+SYSCALL(write)
+ 43f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 444:	cd 40                	int    $0x40
+ 446:	c3                   	ret
+
+00000447 <close>:
+SYSCALL(close)
+ 447:	b8 15 00 00 00       	mov    $0x15,%eax
+ 44c:	cd 40                	int    $0x40
+ 44e:	c3                   	ret
+
+0000044f <kill>:
+SYSCALL(kill)
+ 44f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 454:	cd 40                	int    $0x40
+ 456:	c3                   	ret
+
+00000457 <exec>:
+SYSCALL(exec)
+ 457:	b8 07 00 00 00       	mov    $0x7,%eax
+ 45c:	cd 40                	int    $0x40
+ 45e:	c3                   	ret
+
+0000045f <open>:
+SYSCALL(open)
+ 45f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 464:	cd 40                	int    $0x40
+ 466:	c3                   	ret
+
+00000467 <mknod>:
+SYSCALL(mknod)
+ 467:	b8 11 00 00 00       	mov    $0x11,%eax
+ 46c:	cd 40                	int    $0x40
+ 46e:	c3                   	ret
+
+0000046f <unlink>:
+SYSCALL(unlink)
+ 46f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 474:	cd 40                	int    $0x40
+ 476:	c3                   	ret
+
+00000477 <fstat>:
+SYSCALL(fstat)
+ 477:	b8 08 00 00 00       	mov    $0x8,%eax
+ 47c:	cd 40                	int    $0x40
+ 47e:	c3                   	ret
+
+0000047f <link>:
+SYSCALL(link)
+ 47f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 484:	cd 40                	int    $0x40
+ 486:	c3                   	ret
+
+00000487 <mkdir>:
+SYSCALL(mkdir)
+ 487:	b8 14 00 00 00       	mov    $0x14,%eax
+ 48c:	cd 40                	int    $0x40
+ 48e:	c3                   	ret
+
+0000048f <chdir>:
+SYSCALL(chdir)
+ 48f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 494:	cd 40                	int    $0x40
+ 496:	c3                   	ret
+
+00000497 <dup>:
+SYSCALL(dup)
+ 497:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 49c:	cd 40                	int    $0x40
+ 49e:	c3                   	ret
+
+0000049f <getpid>:
+SYSCALL(getpid)
+ 49f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a4:	cd 40                	int    $0x40
+ 4a6:	c3                   	ret
+
+000004a7 <sbrk>:
+SYSCALL(sbrk)
+ 4a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4ac:	cd 40                	int    $0x40
+ 4ae:	c3                   	ret
+
+000004af <sleep>:
+SYSCALL(sleep)
+ 4af:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b4:	cd 40                	int    $0x40
+ 4b6:	c3                   	ret
+
+000004b7 <uptime>:
+SYSCALL(uptime)
+ 4b7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4bc:	cd 40                	int    $0x40
+ 4be:	c3                   	ret
+
+000004bf <saveProc>:
+SYSCALL(saveProc)
+ 4bf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4c4:	cd 40                	int    $0x40
+ 4c6:	c3                   	ret
+
+000004c7 <loadProc>:
+SYSCALL(loadProc)
+ 4c7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4cc:	cd 40                	int    $0x40
+ 4ce:	c3                   	ret
+
+000004cf <setpriority>:
+SYSCALL(setpriority)
+ 4cf:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d4:	cd 40                	int    $0x40
+ 4d6:	c3                   	ret
+
+000004d7 <setaffinity>:
+SYSCALL(setaffinity)
+ 4d7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4dc:	cd 40                	int    $0x40
+ 4de:	c3                   	ret
+
+000004df <getaffinity>:
+SYSCALL(getaffinity)
+ 4df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e4:	cd 40                	int    $0x40
+ 4e6:	c3                   	ret
+
+000004e7 <nanosleep>:
+SYSCALL(nanosleep)
+ 4e7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4ec:	cd 40                	int    $0x40
+ 4ee:	c3                   	ret
+
+000004ef <cpustat>:
+SYSCALL(cpustat)
+ 4ef:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4f4:	cd 40                	int    $0x40
+ 4f6:	c3                   	ret
+
+000004f7 <nanouptime>:
+SYSCALL(nanouptime)
+ 4f7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4fc:	cd 40                	int    $0x40
+ 4fe:	c3                   	ret
+
+000004ff <settickets>:
+SYSCALL(settickets)
+ 4ff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 504:	cd 40                	int    $0x40
+ 506:	c3                   	ret
+
+00000507 <setdeadline>:
+SYSCALL(setdeadline)
+ 507:	b8 20 00 00 00       	mov    $0x20,%eax
+ 50c:	cd 40                	int    $0x40
+ 50e:	c3                   	ret
+
+0000050f <rtstat>:
+SYSCALL(rtstat)
+ 50f:	b8 21 00 00 00       	mov    $0x21,%eax
+ 514:	cd 40                	int    $0x40
+ 516:	c3                   	ret
+
+00000517 <schedstat>:
+SYSCALL(schedstat)
+ 517:	b8 22 00 00 00       	mov    $0x22,%eax
+ 51c:	cd 40                	int    $0x40
+ 51e:	c3                   	ret
+
+0000051f <waitpid>:
+SYSCALL(waitpid)
+ 51f:	b8 23 00 00 00       	mov    $0x23,%eax
+ 524:	cd 40                	int    $0x40
+ 526:	c3                   	ret
+
+00000527 <clone>:
+SYSCALL(clone)
+ 527:	b8 24 00 00 00       	mov    $0x24,%eax
+ 52c:	cd 40                	int    $0x40
+ 52e:	c3                   	ret
+
+0000052f <futexwait>:
+SYSCALL(futexwait)
+ 52f:	b8 25 00 00 00       	mov    $0x25,%eax
+ 534:	cd 40                	int    $0x40
+ 536:	c3                   	ret
+
+00000537 <futexwake>:
+SYSCALL(futexwake)
+ 537:	b8 26 00 00 00       	mov    $0x26,%eax
+ 53c:	cd 40                	int    $0x40
+ 53e:	c3                   	ret
+
+0000053f <lockstat>:
+SYSCALL(lockstat)
+ 53f:	b8 27 00 00 00       	mov    $0x27,%eax
+ 544:	cd 40                	int    $0x40
+ 546:	c3                   	ret
+
+00000547 <dcachestat>:
+SYSCALL(dcachestat)
+ 547:	b8 28 00 00 00       	mov    $0x28,%eax
+ 54c:	cd 40                	int    $0x40
+ 54e:	c3                   	ret
+
+0000054f <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 54f:	55                   	push   %ebp
+ 550:	89 e5                	mov    %esp,%ebp
+ 552:	83 ec 18             	sub    $0x18,%esp
+ 555:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 558:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 55b:	83 ec 04             	sub    $0x4,%esp
+ 55e:	6a 01                	push   $0x1
+ 560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 563:	50                   	push   %eax
+ 564:	ff 75 08             	push   0x8(%ebp)
+ 567:	e8 d3 fe ff ff       	call   43f <write>
+ 56c:	83 c4 10             	add    $0x10,%esp
+}
+ 56f:	90                   	nop
+ 570:	c9                   	leave
+ 571:	c3                   	ret
+
+00000572 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 572:	55                   	push   %ebp
+ 573:	89 e5                	mov    %esp,%ebp
+ 575:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 578:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 57f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 583:	74 17                	je     59c <printint+0x2a>
+ 585:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 589:	79 11                	jns    59c <printint+0x2a>
+    neg = 1;
+ 58b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 592:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 595:	f7 d8                	neg    %eax
+ 597:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 59a:	eb 06                	jmp    5a2 <printint+0x30>
+  } else {
+    x = xx;
+ 59c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 59f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5a2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5a9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5af:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5b4:	f7 f1                	div    %ecx
+ 5b6:	89 d1                	mov    %edx,%ecx
+ 5b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5bb:	8d 50 01             	lea    0x1(%eax),%edx
+ 5be:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5c1:	0f b6 91 7c 09 00 00 	movzbl 0x97c(%ecx),%edx
+ 5c8:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5cc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5cf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d2:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5d7:	f7 f1                	div    %ecx
+ 5d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5dc:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 5e0:	75 c7                	jne    5a9 <printint+0x37>
+  if(neg)
+ 5e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5e6:	74 2d                	je     615 <printint+0xa3>
+    buf[i++] = '-';
+ 5e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5eb:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ee:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5f1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5f6:	eb 1d                	jmp    615 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5f8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5fe:	01 d0                	add    %edx,%eax
+ 600:	0f b6 00             	movzbl (%eax),%eax
+ 603:	0f be c0             	movsbl %al,%eax
+ 606:	83 ec 08             	sub    $0x8,%esp
+ 609:	50                   	push   %eax
+ 60a:	ff 75 08             	push   0x8(%ebp)
+ 60d:	e8 3d ff ff ff       	call   54f <putc>
+ 612:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 615:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 619:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 61d:	79 d9                	jns    5f8 <printint+0x86>
+}
+ 61f:	90                   	nop
+ 620:	90                   	nop
+ 621:	c9                   	leave
+ 622:	c3                   	ret
+
+00000623 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 623:	55                   	push   %ebp
+ 624:	89 e5                	mov    %esp,%ebp
+ 626:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 629:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 630:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 633:	83 c0 04             	add    $0x4,%eax
+ 636:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 639:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 640:	e9 59 01 00 00       	jmp    79e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 645:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 648:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 64b:	01 d0                	add    %edx,%eax
+ 64d:	0f b6 00             	movzbl (%eax),%eax
+ 650:	0f be c0             	movsbl %al,%eax
+ 653:	25 ff 00 00 00       	and    $0xff,%eax
+ 658:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 65b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 65f:	75 2c                	jne    68d <printf+0x6a>
+      if(c == '%'){
+ 661:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 665:	75 0c                	jne    673 <printf+0x50>
+        state = '%';
+ 667:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 66e:	e9 27 01 00 00       	jmp    79a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 673:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 676:	0f be c0             	movsbl %al,%eax
+ 679:	83 ec 08             	sub    $0x8,%esp
+ 67c:	50                   	push   %eax
+ 67d:	ff 75 08             	push   0x8(%ebp)
+ 680:	e8 ca fe ff ff       	call   54f <putc>
+ 685:	83 c4 10             	add    $0x10,%esp
+ 688:	e9 0d 01 00 00       	jmp    79a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 68d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 691:	0f 85 03 01 00 00    	jne    79a <printf+0x177>
+      if(c == 'd'){
+ 697:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 69b:	75 1e                	jne    6bb <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 69d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a0:	8b 00                	mov    (%eax),%eax
+ 6a2:	6a 01                	push   $0x1
+ 6a4:	6a 0a                	push   $0xa
+ 6a6:	50                   	push   %eax
+ 6a7:	ff 75 08             	push   0x8(%ebp)
+ 6aa:	e8 c3 fe ff ff       	call   572 <printint>
+ 6af:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6b2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6b6:	e9 d8 00 00 00       	jmp    793 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6bb:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6bf:	74 06                	je     6c7 <printf+0xa4>
+ 6c1:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6c5:	75 1e                	jne    6e5 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6c7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ca:	8b 00                	mov    (%eax),%eax
+ 6cc:	6a 00                	push   $0x0
+ 6ce:	6a 10                	push   $0x10
+ 6d0:	50                   	push   %eax
+ 6d1:	ff 75 08             	push   0x8(%ebp)
+ 6d4:	e8 99 fe ff ff       	call   572 <printint>
+ 6d9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6dc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6e0:	e9 ae 00 00 00       	jmp    793 <printf+0x170>
+      } else if(c == 's'){
+ 6e5:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6e9:	75 43                	jne    72e <printf+0x10b>
+        s = (char*)*ap;
+ 6eb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6ee:	8b 00                	mov    (%eax),%eax
+ 6f0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6f3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6f7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6fb:	75 25                	jne    722 <printf+0xff>
+          s = "(null)";
+ 6fd:	c7 45 f4 77 08 00 00 	movl   $0x877,-0xc(%ebp)
+        while(*s != 0){
+ 704:	eb 1c                	jmp    722 <printf+0xff>
+          putc(fd, *s);
+ 706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 709:	0f b6 00             	movzbl (%eax),%eax
+ 70c:	0f be c0             	movsbl %al,%eax
+ 70f:	83 ec 08             	sub    $0x8,%esp
+ 712:	50                   	push   %eax
+ 713:	ff 75 08             	push   0x8(%ebp)
+ 716:	e8 34 fe ff ff       	call   54f <putc>
+ 71b:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 71e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 722:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 725:	0f b6 00             	movzbl (%eax),%eax
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 da                	jne    706 <printf+0xe3>
+ 72c:	eb 65                	jmp    793 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 72e:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 732:	75 1d                	jne    751 <printf+0x12e>
+        putc(fd, *ap);
+ 734:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 737:	8b 00                	mov    (%eax),%eax
+ 739:	0f be c0             	movsbl %al,%eax
+ 73c:	83 ec 08             	sub    $0x8,%esp
+ 73f:	50                   	push   %eax
+ 740:	ff 75 08             	push   0x8(%ebp)
+ 743:	e8 07 fe ff ff       	call   54f <putc>
+ 748:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 74b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 74f:	eb 42                	jmp    793 <printf+0x170>
+      } else if(c == '%'){
+ 751:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 755:	75 17                	jne    76e <printf+0x14b>
+        putc(fd, c);
+ 757:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 75a:	0f be c0             	movsbl %al,%eax
+ 75d:	83 ec 08             	sub    $0x8,%esp
+ 760:	50                   	push   %eax
+ 761:	ff 75 08             	push   0x8(%ebp)
+ 764:	e8 e6 fd ff ff       	call   54f <putc>
+ 769:	83 c4 10             	add    $0x10,%esp
+ 76c:	eb 25                	jmp    793 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 76e:	83 ec 08             	sub    $0x8,%esp
+ 771:	6a 25                	push   $0x25
+ 773:	ff 75 08             	push   0x8(%ebp)
+ 776:	e8 d4 fd ff ff       	call   54f <putc>
+ 77b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 77e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 781:	0f be c0             	movsbl %al,%eax
+ 784:	83 ec 08             	sub    $0x8,%esp
+ 787:	50                   	push   %eax
+ 788:	ff 75 08             	push   0x8(%ebp)
+ 78b:	e8 bf fd ff ff       	call   54f <putc>
+ 790:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 793:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 79a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 79e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7a4:	01 d0                	add    %edx,%eax
+ 7a6:	0f b6 00             	movzbl (%eax),%eax
+ 7a9:	84 c0                	test   %al,%al
+ 7ab:	0f 85 94 fe ff ff    	jne    645 <printf+0x22>
+    }
+  }
+}
+ 7b1:	90                   	nop
+ 7b2:	90                   	nop
+ 7b3:	c9                   	leave
+ 7b4:	c3                   	ret
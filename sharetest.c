@@ -0,0 +1,124 @@
+// Check that the stride scheduling class divides a CPU in
+// proportion to tickets.  Children pinned to CPU 0 spin for the
+// same stretch of uptime() and count loop iterations; each one's
+// share of the iterations should match its share of the tickets.
+// A child with no tickets stays in the MLFQ, which competes with
+// the stride class as one client holding MLFQTICKETS.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+
+#define NCHILD    3
+#define DURATION  300  // ticks each run lasts
+#define TOLERANCE 5    // allowed error, in percentage points
+
+struct result {
+  int child;
+  uint count;
+};
+
+static volatile uint spin;
+
+static void
+spinner(int child, int tickets, int go, int out)
+{
+  struct result r;
+  uint end;
+  char c;
+  int i;
+
+  if(setaffinity(getpid(), 1) < 0 || settickets(getpid(), tickets) < 0){
+    printf(1, "sharetest: cannot set up child\n");
+    exit();
+  }
+  read(go, &c, 1);
+  r.child = child;
+  r.count = 0;
+  end = uptime() + DURATION;
+  while(uptime() < end){
+    for(i = 0; i < 1000; i++)
+      spin++;
+    r.count++;
+  }
+  write(out, &r, sizeof(r));
+  exit();
+}
+
+// Run one child per entry of tickets[] and compare shares;
+// an entry of 0 runs a child in the MLFQ instead.
+// Return 0 if every share is within TOLERANCE.
+static int
+run(int *tickets, int n)
+{
+  int go[2], out[2];
+  struct result r;
+  uint count[NCHILD], total;
+  int i, want, got, bad, sum;
+
+  if(pipe(go) < 0 || pipe(out) < 0){
+    printf(1, "sharetest: pipe failed\n");
+    exit();
+  }
+  sum = 0;
+  for(i = 0; i < n; i++){
+    sum += tickets[i] ? tickets[i] : MLFQTICKETS;
+    if(fork() == 0){
+      close(go[1]);
+      close(out[0]);
+      spinner(i, tickets[i], go[0], out[1]);
+    }
+  }
+  close(go[0]);
+  close(out[1]);
+
+  // Give every child time to join the stride class, then start them.
+  sleep(10);
+  for(i = 0; i < n; i++)
+    write(go[1], "g", 1);
+
+  total = 0;
+  for(i = 0; i < n; i++){
+    if(read(out[0], &r, sizeof(r)) != sizeof(r)){
+      printf(1, "sharetest: lost a child\n");
+      exit();
+    }
+    count[r.child] = r.count;
+    total += r.count;
+  }
+  for(i = 0; i < n; i++)
+    wait();
+  close(go[1]);
+  close(out[0]);
+
+  bad = 0;
+  for(i = 0; i < n; i++){
+    want = (tickets[i] ? tickets[i] : MLFQTICKETS) * 100 / sum;
+    got = total ? count[i] * 100 / total : 0;
+    if(tickets[i])
+      printf(1, "  %d tickets: want %d%%, got %d%%\n", tickets[i], want, got);
+    else
+      printf(1, "  mlfq: want %d%%, got %d%%\n", want, got);
+    if(got < want - TOLERANCE || got > want + TOLERANCE)
+      bad = 1;
+  }
+  return bad;
+}
+
+int
+main(int argc, char *argv[])
+{
+  static int two[] = { 70, 30 };
+  static int three[] = { 50, 30, 20 };
+  static int mixed[] = { 70, 30, 0 };
+  int bad;
+
+  printf(1, "sharetest\n");
+  bad = run(two, 2);
+  bad |= run(three, 3);
+  // A CPU-bound MLFQ process must not starve the stride class.
+  bad |= run(mixed, 3);
+  printf(1, bad ? "sharetest failed\n" : "sharetest ok\n");
+  exit();
+}
@@ -0,0 +1,209 @@
+// Slab allocator for small kernel objects.
+//
+// kmalloc() rounds a request up to one of the power-of-two
+// size classes and carves objects out of one-page slabs taken
+// from the buddy allocator.  Each slab's header sits at the
+// start of its page, so kmfree() finds it by rounding the
+// object's address down.  Every CPU keeps a magazine of free
+// objects per class, so most kmalloc/kmfree calls never touch
+// the class lock.  Requests larger than KMALLOCMAX are handed
+// whole buddy blocks, which are page aligned and therefore
+// never confused with slab objects.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define KMMINSIZE  16                             // smallest size class
+#define NKMCLASS   7                              // 16, 32, ..., 1024
+#define KMALLOCMAX (KMMINSIZE << (NKMCLASS-1))    // largest slab object
+#define MAGSIZE    16                             // per-CPU objects per class
+
+struct kmcache;
+
+struct slab {
+  struct kmcache *cache;  // class this slab belongs to
+  struct slab *next;      // on cache's partial list
+  struct slab *prev;
+  void *freelist;         // free objects in this slab
+  int inuse;              // objects handed out
+};
+
+// Objects start after the header, 16-byte aligned.
+#define SLABHDR ((sizeof(struct slab) + 15) & ~15)
+
+struct kmcache {
+  struct spinlock lock;
+  uint size;              // object size
+  struct slab *partial;   // slabs with at least one free object
+};
+
+struct magazine {
+  int n;
+  void *obj[MAGSIZE];
+};
+
+static struct kmcache kmcache[NKMCLASS];
+static struct magazine magazine[NCPU][NKMCLASS];
+
+void
+kminit(void)
+{
+  int i;
+
+  for(i = 0; i < NKMCLASS; i++){
+    initlock(&kmcache[i].lock, "kmcache");
+    kmcache[i].size = KMMINSIZE << i;
+  }
+}
+
+static int
+kmclass(uint n)
+{
+  int i;
+
+  for(i = 0; (KMMINSIZE << i) < n; i++)
+    ;
+  return i;
+}
+
+static void
+slabunlink(struct kmcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+static void
+slabpush(struct kmcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+// Take one object from the class's slabs, growing the
+// class by a fresh page if every slab is full.
+// Caller must hold c->lock.
+static void*
+cachealloc(struct kmcache *c)
+{
+  struct slab *s;
+  char *o;
+
+  if((s = c->partial) == 0){
+    if((s = (struct slab*)kalloc()) == 0)
+      return 0;
+    s->cache = c;
+    s->inuse = 0;
+    s->freelist = 0;
+    for(o = (char*)s + PGSIZE - c->size; o >= (char*)s + SLABHDR; o -= c->size){
+      *(void**)o = s->freelist;
+      s->freelist = o;
+    }
+    slabpush(c, s);
+  }
+  o = s->freelist;
+  s->freelist = *(void**)o;
+  s->inuse++;
+  if(s->freelist == 0)
+    slabunlink(c, s);
+  return o;
+}
+
+// Return an object to its slab.  An empty slab goes back
+// to the page allocator unless it is the class's last
+// partial slab.  Caller must hold c->lock.
+static void
+cachefree(struct kmcache *c, void *v)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  if(s->freelist == 0)
+    slabpush(c, s);
+  *(void**)v = s->freelist;
+  s->freelist = v;
+  if(--s->inuse == 0 && (c->partial != s || s->next)){
+    slabunlink(c, s);
+    kfree((char*)s);
+  }
+}
+
+// Allocate n bytes of kernel memory.
+// Returns 0 if the memory cannot be allocated.
+void*
+kmalloc(uint n)
+{
+  struct kmcache *c;
+  struct magazine *m;
+  void *v;
+  int i, order;
+
+  if(n == 0)
+    return 0;
+  if(n > KMALLOCMAX){
+    for(order = 0; (PGSIZE << order) < n; order++)
+      ;
+    return kallocpages(order);
+  }
+
+  i = kmclass(n);
+  c = &kmcache[i];
+  pushcli();
+  m = &magazine[cpu - cpus][i];
+  if(m->n == 0){
+    // Refill half the magazine so the next few calls stay local.
+    acquire(&c->lock);
+    while(m->n < MAGSIZE/2 && (v = cachealloc(c)) != 0)
+      m->obj[m->n++] = v;
+    release(&c->lock);
+  }
+  v = 0;
+  if(m->n > 0)
+    v = m->obj[--m->n];
+  popcli();
+  return v;
+}
+
+// Free memory returned by kmalloc().
+void
+kmfree(void *v)
+{
+  struct kmcache *c;
+  struct magazine *m;
+
+  if((uint)v % PGSIZE == 0){
+    kfreepages(v, kpageorder(v));
+    return;
+  }
+
+  c = ((struct slab*)PGROUNDDOWN((uint)v))->cache;
+  if(c < kmcache || c >= &kmcache[NKMCLASS])
+    panic("kmfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, c->size);
+
+  pushcli();
+  m = &magazine[cpu - cpus][c - kmcache];
+  if(m->n == MAGSIZE){
+    // Spill half the magazine back to the slabs.
+    acquire(&c->lock);
+    while(m->n > MAGSIZE/2)
+      cachefree(c, m->obj[--m->n]);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = v;
+  popcli();
+}
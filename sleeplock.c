@@ -0,0 +1,90 @@
+// Sleeping locks with a shared mode for readers.
+//
+// A process waiting for exclusive mode keeps new readers out,
+// so a stream of readers cannot starve it.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+  initlock(&lk->lk, "sleep lock");
+  lk->name = name;
+  lk->locked = 0;
+  lk->readers = 0;
+  lk->writers = 0;
+  lk->pid = 0;
+}
+
+// Take lk exclusively.
+void
+acquiresleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->writers++;
+  while(lk->locked || lk->readers)
+    sleep(lk, &lk->lk);
+  lk->writers--;
+  lk->locked = 1;
+  lk->pid = proc ? proc->pid : 0;
+  release(&lk->lk);
+}
+
+void
+releasesleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->locked = 0;
+  lk->pid = 0;
+  wakeup(lk);
+  release(&lk->lk);
+}
+
+// Take lk in shared mode.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  while(lk->locked || lk->writers)
+    sleep(lk, &lk->lk);
+  lk->readers++;
+  release(&lk->lk);
+}
+
+void
+releasesleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->readers < 1)
+    panic("releasesleepshared");
+  if(--lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
+// Does this process hold lk exclusively?
+int
+holdingsleep(struct sleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  r = lk->locked && lk->pid == (proc ? proc->pid : 0);
+  release(&lk->lk);
+  return r;
+}
+
+// Is lk held, in either mode?
+int
+sleeplocked(struct sleeplock *lk)
+{
+  return lk->locked || lk->readers > 0;
+}
@@ -0,0 +1,12 @@
+// Long-term lock for processes, which sleep while they wait.
+// Held either exclusively by one process or shared by readers.
+struct sleeplock {
+  uint locked;        // Is the lock held exclusively?
+  int readers;        // Number of shared holders
+  int writers;        // Processes waiting for exclusive mode
+  struct spinlock lk; // Protects this sleep lock
+
+  // For debugging:
+  char *name;         // Name of lock.
+  int pid;            // Process holding the lock exclusively
+};
@@ -1,11 +1,17 @@
-// Mutual exclusion lock.
+// Mutual exclusion lock.  A ticket lock: CPUs take the lock
+// in the order they asked for it.
 struct spinlock {
-  uint locked;       // Is the lock held?
-  
+  volatile uint next;   // Ticket the next acquire() will take
+  volatile uint owner;  // Ticket of the holder; held iff != next
+
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+
+  // For lockstat():
+  int class;         // Statistics slot, shared by locks of this name
+  uint64 acquired;   // TSC when acquired
 };
 
@@ -0,0 +1,1078 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 70 07 00 00       	push   $0x770
+  30:	6a 01                	push   $0x1
+  32:	e8 a7 05 00 00       	call   5de <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 be 01 00 00       	call   20e <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 71 03 00 00       	call   3d2 <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 83 07 00 00       	push   $0x783
+  7d:	6a 01                	push   $0x1
+  7f:	e8 5a 05 00 00       	call   5de <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 74 03 00 00       	call   41a <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 2e 03 00 00       	call   3fa <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 1e 03 00 00       	call   402 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 8d 07 00 00       	push   $0x78d
+  ef:	6a 01                	push   $0x1
+  f1:	e8 e8 04 00 00       	call   5de <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 13 03 00 00       	call   41a <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 c5 02 00 00       	call   3f2 <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 bd 02 00 00       	call   402 <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 95 02 00 00       	call   3e2 <wait>
+  
+  exit();
+ 14d:	e8 88 02 00 00       	call   3da <exit>
+
+00000152 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 17e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 181:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 184:	90                   	nop
+ 185:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 188:	8d 42 01             	lea    0x1(%edx),%eax
+ 18b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 191:	8d 48 01             	lea    0x1(%eax),%ecx
+ 194:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 197:	0f b6 12             	movzbl (%edx),%edx
+ 19a:	88 10                	mov    %dl,(%eax)
+ 19c:	0f b6 00             	movzbl (%eax),%eax
+ 19f:	84 c0                	test   %al,%al
+ 1a1:	75 e2                	jne    185 <strcpy+0xd>
+    ;
+  return os;
+ 1a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a6:	c9                   	leave
+ 1a7:	c3                   	ret
+
+000001a8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1a8:	55                   	push   %ebp
+ 1a9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ab:	eb 08                	jmp    1b5 <strcmp+0xd>
+    p++, q++;
+ 1ad:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	0f b6 00             	movzbl (%eax),%eax
+ 1bb:	84 c0                	test   %al,%al
+ 1bd:	74 10                	je     1cf <strcmp+0x27>
+ 1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c2:	0f b6 10             	movzbl (%eax),%edx
+ 1c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c8:	0f b6 00             	movzbl (%eax),%eax
+ 1cb:	38 c2                	cmp    %al,%dl
+ 1cd:	74 de                	je     1ad <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d2:	0f b6 00             	movzbl (%eax),%eax
+ 1d5:	0f b6 d0             	movzbl %al,%edx
+ 1d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1db:	0f b6 00             	movzbl (%eax),%eax
+ 1de:	0f b6 c0             	movzbl %al,%eax
+ 1e1:	29 c2                	sub    %eax,%edx
+ 1e3:	89 d0                	mov    %edx,%eax
+}
+ 1e5:	5d                   	pop    %ebp
+ 1e6:	c3                   	ret
+
+000001e7 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 1e7:	55                   	push   %ebp
+ 1e8:	89 e5                	mov    %esp,%ebp
+ 1ea:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1ed:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f4:	eb 04                	jmp    1fa <strlen+0x13>
+ 1f6:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fa:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 200:	01 d0                	add    %edx,%eax
+ 202:	0f b6 00             	movzbl (%eax),%eax
+ 205:	84 c0                	test   %al,%al
+ 207:	75 ed                	jne    1f6 <strlen+0xf>
+    ;
+  return n;
+ 209:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 20e:	55                   	push   %ebp
+ 20f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+ 214:	50                   	push   %eax
+ 215:	ff 75 0c             	push   0xc(%ebp)
+ 218:	ff 75 08             	push   0x8(%ebp)
+ 21b:	e8 32 ff ff ff       	call   152 <stosb>
+ 220:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 226:	c9                   	leave
+ 227:	c3                   	ret
+
+00000228 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 228:	55                   	push   %ebp
+ 229:	89 e5                	mov    %esp,%ebp
+ 22b:	83 ec 04             	sub    $0x4,%esp
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 234:	eb 14                	jmp    24a <strchr+0x22>
+    if(*s == c)
+ 236:	8b 45 08             	mov    0x8(%ebp),%eax
+ 239:	0f b6 00             	movzbl (%eax),%eax
+ 23c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 23f:	75 05                	jne    246 <strchr+0x1e>
+      return (char*)s;
+ 241:	8b 45 08             	mov    0x8(%ebp),%eax
+ 244:	eb 13                	jmp    259 <strchr+0x31>
+  for(; *s; s++)
+ 246:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24d:	0f b6 00             	movzbl (%eax),%eax
+ 250:	84 c0                	test   %al,%al
+ 252:	75 e2                	jne    236 <strchr+0xe>
+  return 0;
+ 254:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 259:	c9                   	leave
+ 25a:	c3                   	ret
+
+0000025b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 25b:	55                   	push   %ebp
+ 25c:	89 e5                	mov    %esp,%ebp
+ 25e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 261:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 268:	eb 42                	jmp    2ac <gets+0x51>
+    cc = read(0, &c, 1);
+ 26a:	83 ec 04             	sub    $0x4,%esp
+ 26d:	6a 01                	push   $0x1
+ 26f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 272:	50                   	push   %eax
+ 273:	6a 00                	push   $0x0
+ 275:	e8 78 01 00 00       	call   3f2 <read>
+ 27a:	83 c4 10             	add    $0x10,%esp
+ 27d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 280:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 284:	7e 33                	jle    2b9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 286:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 289:	8d 50 01             	lea    0x1(%eax),%edx
+ 28c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 28f:	89 c2                	mov    %eax,%edx
+ 291:	8b 45 08             	mov    0x8(%ebp),%eax
+ 294:	01 c2                	add    %eax,%edx
+ 296:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a0:	3c 0a                	cmp    $0xa,%al
+ 2a2:	74 16                	je     2ba <gets+0x5f>
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0d                	cmp    $0xd,%al
+ 2aa:	74 0e                	je     2ba <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	83 c0 01             	add    $0x1,%eax
+ 2b2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b5:	7f b3                	jg     26a <gets+0xf>
+ 2b7:	eb 01                	jmp    2ba <gets+0x5f>
+      break;
+ 2b9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 2ba:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	01 d0                	add    %edx,%eax
+ 2c2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c8:	c9                   	leave
+ 2c9:	c3                   	ret
+
+000002ca <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 2ca:	55                   	push   %ebp
+ 2cb:	89 e5                	mov    %esp,%ebp
+ 2cd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d0:	83 ec 08             	sub    $0x8,%esp
+ 2d3:	6a 00                	push   $0x0
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 3d 01 00 00       	call   41a <open>
+ 2dd:	83 c4 10             	add    $0x10,%esp
+ 2e0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e7:	79 07                	jns    2f0 <stat+0x26>
+    return -1;
+ 2e9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ee:	eb 25                	jmp    315 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f0:	83 ec 08             	sub    $0x8,%esp
+ 2f3:	ff 75 0c             	push   0xc(%ebp)
+ 2f6:	ff 75 f4             	push   -0xc(%ebp)
+ 2f9:	e8 34 01 00 00       	call   432 <fstat>
+ 2fe:	83 c4 10             	add    $0x10,%esp
+ 301:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 304:	83 ec 0c             	sub    $0xc,%esp
+ 307:	ff 75 f4             	push   -0xc(%ebp)
+ 30a:	e8 f3 00 00 00       	call   402 <close>
+ 30f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 312:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 315:	c9                   	leave
+ 316:	c3                   	ret
+
+00000317 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 317:	55                   	push   %ebp
+ 318:	89 e5                	mov    %esp,%ebp
+ 31a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 31d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 324:	eb 25                	jmp    34b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 326:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 329:	89 d0                	mov    %edx,%eax
+ 32b:	c1 e0 02             	shl    $0x2,%eax
+ 32e:	01 d0                	add    %edx,%eax
+ 330:	01 c0                	add    %eax,%eax
+ 332:	89 c1                	mov    %eax,%ecx
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	8d 50 01             	lea    0x1(%eax),%edx
+ 33a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33d:	0f b6 00             	movzbl (%eax),%eax
+ 340:	0f be c0             	movsbl %al,%eax
+ 343:	01 c8                	add    %ecx,%eax
+ 345:	83 e8 30             	sub    $0x30,%eax
+ 348:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34e:	0f b6 00             	movzbl (%eax),%eax
+ 351:	3c 2f                	cmp    $0x2f,%al
+ 353:	7e 0a                	jle    35f <atoi+0x48>
+ 355:	8b 45 08             	mov    0x8(%ebp),%eax
+ 358:	0f b6 00             	movzbl (%eax),%eax
+ 35b:	3c 39                	cmp    $0x39,%al
+ 35d:	7e c7                	jle    326 <atoi+0xf>
+  return n;
+ 35f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 362:	c9                   	leave
+ 363:	c3                   	ret
+
+00000364 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 364:	55                   	push   %ebp
+ 365:	89 e5                	mov    %esp,%ebp
+ 367:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 36a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 370:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 373:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 376:	eb 17                	jmp    38f <memmove+0x2b>
+    *dst++ = *src++;
+ 378:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37b:	8d 42 01             	lea    0x1(%edx),%eax
+ 37e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 381:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 384:	8d 48 01             	lea    0x1(%eax),%ecx
+ 387:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38a:	0f b6 12             	movzbl (%edx),%edx
+ 38d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 38f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 392:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 395:	89 55 10             	mov    %edx,0x10(%ebp)
+ 398:	85 c0                	test   %eax,%eax
+ 39a:	7f dc                	jg     378 <memmove+0x14>
+  return vdst;
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+ 3a4:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 3a7:	83 ec 0c             	sub    $0xc,%esp
+ 3aa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 3ad:	50                   	push   %eax
+ 3ae:	e8 ff 00 00 00       	call   4b2 <nanouptime>
+ 3b3:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 3b6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 3b9:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 3bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c2:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 3c7:	f7 e2                	mul    %edx
+ 3c9:	89 d0                	mov    %edx,%eax
+ 3cb:	c1 e8 06             	shr    $0x6,%eax
+ 3ce:	01 c8                	add    %ecx,%eax
+}
+ 3d0:	c9                   	leave
+ 3d1:	c3                   	ret
+
+000003d2 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3d2:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d7:	cd 40                	int    $0x40
+ 3d9:	c3                   	ret
+
+000003da <exit>:
+SYSCALL(exit)
+ 3da:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3df:	cd 40                	int    $0x40
+ 3e1:	c3                   	ret
+
+000003e2 <wait>:
+SYSCALL(wait)
+ 3e2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e7:	cd 40                	int    $0x40
+ 3e9:	c3                   	ret
+
+000003ea <pipe>:
+SYSCALL(pipe)
+ 3ea:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3ef:	cd 40                	int    $0x40
+ 3f1:	c3                   	ret
+
+000003f2 <read>:
+SYSCALL(read)
+ 3f2:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f7:	cd 40                	int    $0x40
+ 3f9:	c3                   	ret
+
+000003fa <write>:
+SYSCALL(write)
+ 3fa:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3ff:	cd 40                	int    $0x40
+ 401:	c3                   	ret
+
+00000402 <close>:
+SYSCALL(close)
+ 402:	b8 15 00 00 00       	mov    $0x15,%eax
+ 407:	cd 40                	int    $0x40
+ 409:	c3                   	ret
+
+0000040a <kill>:
+SYSCALL(kill)
+ 40a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 40f:	cd 40                	int    $0x40
+ 411:	c3                   	ret
+
+00000412 <exec>:
+SYSCALL(exec)
+ 412:	b8 07 00 00 00       	mov    $0x7,%eax
+ 417:	cd 40                	int    $0x40
+ 419:	c3                   	ret
+
+0000041a <open>:
+SYSCALL(open)
+ 41a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 41f:	cd 40                	int    $0x40
+ 421:	c3                   	ret
+
+00000422 <mknod>:
+SYSCALL(mknod)
+ 422:	b8 11 00 00 00       	mov    $0x11,%eax
+ 427:	cd 40                	int    $0x40
+ 429:	c3                   	ret
+
+0000042a <unlink>:
+SYSCALL(unlink)
+ 42a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 42f:	cd 40                	int    $0x40
+ 431:	c3                   	ret
+
+00000432 <fstat>:
+SYSCALL(fstat)
+ 432:	b8 08 00 00 00       	mov    $0x8,%eax
+ 437:	cd 40                	int    $0x40
+ 439:	c3                   	ret
+
+0000043a <link>:
+SYSCALL(link)
+ 43a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 43f:	cd 40                	int    $0x40
+ 441:	c3                   	ret
+
+00000442 <mkdir>:
+SYSCALL(mkdir)
+ 442:	b8 14 00 00 00       	mov    $0x14,%eax
+ 447:	cd 40                	int    $0x40
+ 449:	c3                   	ret
+
+0000044a <chdir>:
+SYSCALL(chdir)
+ 44a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 44f:	cd 40                	int    $0x40
+ 451:	c3                   	ret
+
+00000452 <dup>:
+SYSCALL(dup)
+ 452:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 457:	cd 40                	int    $0x40
+ 459:	c3                   	ret
+
+0000045a <getpid>:
+SYSCALL(getpid)
+ 45a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 45f:	cd 40                	int    $0x40
+ 461:	c3                   	ret
+
+00000462 <sbrk>:
+SYSCALL(sbrk)
+ 462:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 467:	cd 40                	int    $0x40
+ 469:	c3                   	ret
+
+0000046a <sleep>:
+SYSCALL(sleep)
+ 46a:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 46f:	cd 40                	int    $0x40
+ 471:	c3                   	ret
+
+00000472 <uptime>:
+SYSCALL(uptime)
+ 472:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 477:	cd 40                	int    $0x40
+ 479:	c3                   	ret
+
+0000047a <saveProc>:
+SYSCALL(saveProc)
+ 47a:	b8 16 00 00 00       	mov    $0x16,%eax
+ 47f:	cd 40                	int    $0x40
+ 481:	c3                   	ret
+
+00000482 <loadProc>:
+SYSCALL(loadProc)
+ 482:	b8 17 00 00 00       	mov    $0x17,%eax
+ 487:	cd 40                	int    $0x40
+ 489:	c3                   	ret
+
+0000048a <setpriority>:
+SYSCALL(setpriority)
+ 48a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 48f:	cd 40                	int    $0x40
+ 491:	c3                   	ret
+
+00000492 <setaffinity>:
+SYSCALL(setaffinity)
+ 492:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 497:	cd 40                	int    $0x40
+ 499:	c3                   	ret
+
+0000049a <getaffinity>:
+SYSCALL(getaffinity)
+ 49a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 49f:	cd 40                	int    $0x40
+ 4a1:	c3                   	ret
+
+000004a2 <nanosleep>:
+SYSCALL(nanosleep)
+ 4a2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a7:	cd 40                	int    $0x40
+ 4a9:	c3                   	ret
+
+000004aa <cpustat>:
+SYSCALL(cpustat)
+ 4aa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 4af:	cd 40                	int    $0x40
+ 4b1:	c3                   	ret
+
+000004b2 <nanouptime>:
+SYSCALL(nanouptime)
+ 4b2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 4b7:	cd 40                	int    $0x40
+ 4b9:	c3                   	ret
+
+000004ba <settickets>:
+SYSCALL(settickets)
+ 4ba:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 4bf:	cd 40                	int    $0x40
+ 4c1:	c3                   	ret
+
+000004c2 <setdeadline>:
+SYSCALL(setdeadline)
+ 4c2:	b8 20 00 00 00       	mov    $0x20,%eax
+ 4c7:	cd 40                	int    $0x40
+ 4c9:	c3                   	ret
+
+000004ca <rtstat>:
+SYSCALL(rtstat)
+ 4ca:	b8 21 00 00 00       	mov    $0x21,%eax
+ 4cf:	cd 40                	int    $0x40
+ 4d1:	c3                   	ret
+
+000004d2 <schedstat>:
+SYSCALL(schedstat)
+ 4d2:	b8 22 00 00 00       	mov    $0x22,%eax
+ 4d7:	cd 40                	int    $0x40
+ 4d9:	c3                   	ret
+
+000004da <waitpid>:
+SYSCALL(waitpid)
+ 4da:	b8 23 00 00 00       	mov    $0x23,%eax
+ 4df:	cd 40                	int    $0x40
+ 4e1:	c3                   	ret
+
+000004e2 <clone>:
+SYSCALL(clone)
+ 4e2:	b8 24 00 00 00       	mov    $0x24,%eax
+ 4e7:	cd 40                	int    $0x40
+ 4e9:	c3                   	ret
+
+000004ea <futexwait>:
+SYSCALL(futexwait)
+ 4ea:	b8 25 00 00 00       	mov    $0x25,%eax
+ 4ef:	cd 40                	int    $0x40
+ 4f1:	c3                   	ret
+
+000004f2 <futexwake>:
+SYSCALL(futexwake)
+ 4f2:	b8 26 00 00 00       	mov    $0x26,%eax
+ 4f7:	cd 40                	int    $0x40
+ 4f9:	c3                   	ret
+
+000004fa <lockstat>:
+SYSCALL(lockstat)
+ 4fa:	b8 27 00 00 00       	mov    $0x27,%eax
+ 4ff:	cd 40                	int    $0x40
+ 501:	c3                   	ret
+
+00000502 <dcachestat>:
+SYSCALL(dcachestat)
+ 502:	b8 28 00 00 00       	mov    $0x28,%eax
+ 507:	cd 40                	int    $0x40
+ 509:	c3                   	ret
+
+0000050a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 50a:	55                   	push   %ebp
+ 50b:	89 e5                	mov    %esp,%ebp
+ 50d:	83 ec 18             	sub    $0x18,%esp
+ 510:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 513:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 516:	83 ec 04             	sub    $0x4,%esp
+ 519:	6a 01                	push   $0x1
+ 51b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 51e:	50                   	push   %eax
+ 51f:	ff 75 08             	push   0x8(%ebp)
+ 522:	e8 d3 fe ff ff       	call   3fa <write>
+ 527:	83 c4 10             	add    $0x10,%esp
+}
+ 52a:	90                   	nop
+ 52b:	c9                   	leave
+ 52c:	c3                   	ret
+
+0000052d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 52d:	55                   	push   %ebp
+ 52e:	89 e5                	mov    %esp,%ebp
+ 530:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 533:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 53a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 53e:	74 17                	je     557 <printint+0x2a>
+ 540:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 544:	79 11                	jns    557 <printint+0x2a>
+    neg = 1;
+ 546:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 54d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 550:	f7 d8                	neg    %eax
+ 552:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 555:	eb 06                	jmp    55d <printint+0x30>
+  } else {
+    x = xx;
+ 557:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 55a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 55d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 564:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 567:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 56a:	ba 00 00 00 00       	mov    $0x0,%edx
+ 56f:	f7 f1                	div    %ecx
+ 571:	89 d1                	mov    %edx,%ecx
+ 573:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 576:	8d 50 01             	lea    0x1(%eax),%edx
+ 579:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 57c:	0f b6 91 a0 09 00 00 	movzbl 0x9a0(%ecx),%edx
+ 583:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 587:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 58a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 58d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 592:	f7 f1                	div    %ecx
+ 594:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 597:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 59b:	75 c7                	jne    564 <printint+0x37>
+  if(neg)
+ 59d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 5a1:	74 2d                	je     5d0 <printint+0xa3>
+    buf[i++] = '-';
+ 5a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5a6:	8d 50 01             	lea    0x1(%eax),%edx
+ 5a9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5ac:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 5b1:	eb 1d                	jmp    5d0 <printint+0xa3>
+    putc(fd, buf[i]);
+ 5b3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 5b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b9:	01 d0                	add    %edx,%eax
+ 5bb:	0f b6 00             	movzbl (%eax),%eax
+ 5be:	0f be c0             	movsbl %al,%eax
+ 5c1:	83 ec 08             	sub    $0x8,%esp
+ 5c4:	50                   	push   %eax
+ 5c5:	ff 75 08             	push   0x8(%ebp)
+ 5c8:	e8 3d ff ff ff       	call   50a <putc>
+ 5cd:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 5d0:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 5d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5d8:	79 d9                	jns    5b3 <printint+0x86>
+}
+ 5da:	90                   	nop
+ 5db:	90                   	nop
+ 5dc:	c9                   	leave
+ 5dd:	c3                   	ret
+
+000005de <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 5de:	55                   	push   %ebp
+ 5df:	89 e5                	mov    %esp,%ebp
+ 5e1:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 5e4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 5eb:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 5ee:	83 c0 04             	add    $0x4,%eax
+ 5f1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 5f4:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 5fb:	e9 59 01 00 00       	jmp    759 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 600:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 603:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 606:	01 d0                	add    %edx,%eax
+ 608:	0f b6 00             	movzbl (%eax),%eax
+ 60b:	0f be c0             	movsbl %al,%eax
+ 60e:	25 ff 00 00 00       	and    $0xff,%eax
+ 613:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 616:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 61a:	75 2c                	jne    648 <printf+0x6a>
+      if(c == '%'){
+ 61c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 620:	75 0c                	jne    62e <printf+0x50>
+        state = '%';
+ 622:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 629:	e9 27 01 00 00       	jmp    755 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 62e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 631:	0f be c0             	movsbl %al,%eax
+ 634:	83 ec 08             	sub    $0x8,%esp
+ 637:	50                   	push   %eax
+ 638:	ff 75 08             	push   0x8(%ebp)
+ 63b:	e8 ca fe ff ff       	call   50a <putc>
+ 640:	83 c4 10             	add    $0x10,%esp
+ 643:	e9 0d 01 00 00       	jmp    755 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 648:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 64c:	0f 85 03 01 00 00    	jne    755 <printf+0x177>
+      if(c == 'd'){
+ 652:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 656:	75 1e                	jne    676 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 658:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 65b:	8b 00                	mov    (%eax),%eax
+ 65d:	6a 01                	push   $0x1
+ 65f:	6a 0a                	push   $0xa
+ 661:	50                   	push   %eax
+ 662:	ff 75 08             	push   0x8(%ebp)
+ 665:	e8 c3 fe ff ff       	call   52d <printint>
+ 66a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 66d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 671:	e9 d8 00 00 00       	jmp    74e <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 676:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 67a:	74 06                	je     682 <printf+0xa4>
+ 67c:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 680:	75 1e                	jne    6a0 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 682:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 685:	8b 00                	mov    (%eax),%eax
+ 687:	6a 00                	push   $0x0
+ 689:	6a 10                	push   $0x10
+ 68b:	50                   	push   %eax
+ 68c:	ff 75 08             	push   0x8(%ebp)
+ 68f:	e8 99 fe ff ff       	call   52d <printint>
+ 694:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 697:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 69b:	e9 ae 00 00 00       	jmp    74e <printf+0x170>
+      } else if(c == 's'){
+ 6a0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 6a4:	75 43                	jne    6e9 <printf+0x10b>
+        s = (char*)*ap;
+ 6a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6a9:	8b 00                	mov    (%eax),%eax
+ 6ab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 6ae:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 6b2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6b6:	75 25                	jne    6dd <printf+0xff>
+          s = "(null)";
+ 6b8:	c7 45 f4 93 07 00 00 	movl   $0x793,-0xc(%ebp)
+        while(*s != 0){
+ 6bf:	eb 1c                	jmp    6dd <printf+0xff>
+          putc(fd, *s);
+ 6c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6c4:	0f b6 00             	movzbl (%eax),%eax
+ 6c7:	0f be c0             	movsbl %al,%eax
+ 6ca:	83 ec 08             	sub    $0x8,%esp
+ 6cd:	50                   	push   %eax
+ 6ce:	ff 75 08             	push   0x8(%ebp)
+ 6d1:	e8 34 fe ff ff       	call   50a <putc>
+ 6d6:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 6d9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 6dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e0:	0f b6 00             	movzbl (%eax),%eax
+ 6e3:	84 c0                	test   %al,%al
+ 6e5:	75 da                	jne    6c1 <printf+0xe3>
+ 6e7:	eb 65                	jmp    74e <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 6e9:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 6ed:	75 1d                	jne    70c <printf+0x12e>
+        putc(fd, *ap);
+ 6ef:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f2:	8b 00                	mov    (%eax),%eax
+ 6f4:	0f be c0             	movsbl %al,%eax
+ 6f7:	83 ec 08             	sub    $0x8,%esp
+ 6fa:	50                   	push   %eax
+ 6fb:	ff 75 08             	push   0x8(%ebp)
+ 6fe:	e8 07 fe ff ff       	call   50a <putc>
+ 703:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 706:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 70a:	eb 42                	jmp    74e <printf+0x170>
+      } else if(c == '%'){
+ 70c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 710:	75 17                	jne    729 <printf+0x14b>
+        putc(fd, c);
+ 712:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 715:	0f be c0             	movsbl %al,%eax
+ 718:	83 ec 08             	sub    $0x8,%esp
+ 71b:	50                   	push   %eax
+ 71c:	ff 75 08             	push   0x8(%ebp)
+ 71f:	e8 e6 fd ff ff       	call   50a <putc>
+ 724:	83 c4 10             	add    $0x10,%esp
+ 727:	eb 25                	jmp    74e <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 729:	83 ec 08             	sub    $0x8,%esp
+ 72c:	6a 25                	push   $0x25
+ 72e:	ff 75 08             	push   0x8(%ebp)
+ 731:	e8 d4 fd ff ff       	call   50a <putc>
+ 736:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 739:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 73c:	0f be c0             	movsbl %al,%eax
+ 73f:	83 ec 08             	sub    $0x8,%esp
+ 742:	50                   	push   %eax
+ 743:	ff 75 08             	push   0x8(%ebp)
+ 746:	e8 bf fd ff ff       	call   50a <putc>
+ 74b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 74e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 755:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 759:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 75c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 75f:	01 d0                	add    %edx,%eax
+ 761:	0f b6 00             	movzbl (%eax),%eax
+ 764:	84 c0                	test   %al,%al
+ 766:	0f 85 94 fe ff ff    	jne    600 <printf+0x22>
+    }
+  }
+}
+ 76c:	90                   	nop
+ 76d:	90                   	nop
+ 76e:	c9                   	leave
+ 76f:	c3                   	ret
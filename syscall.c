@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
@@ -101,6 +102,22 @@ extern int sys_uptime(void);
 extern int sys_saveProc(void);
 extern int sys_loadProc(void);
 extern int sys_myFork(void);
+extern int sys_setpriority(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_nanosleep(void);
+extern int sys_cpustat(void);
+extern int sys_nanouptime(void);
+extern int sys_settickets(void);
+extern int sys_setdeadline(void);
+extern int sys_rtstat(void);
+extern int sys_schedstat(void);
+extern int sys_waitpid(void);
+extern int sys_clone(void);
+extern int sys_futexwait(void);
+extern int sys_futexwake(void);
+extern int sys_lockstat(void);
+extern int sys_dcachestat(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -127,6 +144,22 @@ static int (*syscalls[])(void) = {
 [SYS_saveProc] sys_saveProc,
 [SYS_loadProc] sys_loadProc,
 [SYS_myFork] sys_myFork,
+[SYS_setpriority] sys_setpriority,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_nanosleep] sys_nanosleep,
+[SYS_cpustat] sys_cpustat,
+[SYS_nanouptime] sys_nanouptime,
+[SYS_settickets] sys_settickets,
+[SYS_setdeadline] sys_setdeadline,
+[SYS_rtstat] sys_rtstat,
+[SYS_schedstat] sys_schedstat,
+[SYS_waitpid] sys_waitpid,
+[SYS_clone] sys_clone,
+[SYS_futexwait] sys_futexwait,
+[SYS_futexwake] sys_futexwake,
+[SYS_lockstat] sys_lockstat,
+[SYS_dcachestat] sys_dcachestat,
 };
 
 void
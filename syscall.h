@@ -22,4 +22,20 @@
 #define SYS_close  21
 #define SYS_saveProc 22
 #define SYS_loadProc 23
-#define SYS_myFork 24
\ No newline at end of file
+#define SYS_myFork 24
+#define SYS_setpriority 25
+#define SYS_setaffinity 26
+#define SYS_getaffinity 27
+#define SYS_nanosleep 28
+#define SYS_cpustat 29
+#define SYS_nanouptime 30
+#define SYS_settickets 31
+#define SYS_setdeadline 32
+#define SYS_rtstat 33
+#define SYS_schedstat 34
+#define SYS_waitpid 35
+#define SYS_clone 36
+#define SYS_futexwait 37
+#define SYS_futexwake 38
+#define SYS_lockstat 39
+#define SYS_dcachestat 40
@@ -10,30 +10,34 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
+#include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "dcachestat.h"
 #include "memlayout.h"
 #include "x86.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return the corresponding struct file with a new reference,
+// which the caller must drop with fileclose().  Another thread
+// sharing the file table may close the descriptor meanwhile.
 static int
-argfd(int n, int *pfd, struct file **pf)
+argfd(int n, struct file **pf)
 {
+    struct fdtable *t;
     int fd;
-    struct file *f;
 
-    if (argint(n, &fd) < 0)
-        return -1;
-    if (fd < 0 || fd >= NOFILE || (f = proc->ofile[fd]) == 0)
+    if (argint(n, &fd) < 0 || fd < 0 || fd >= NOFILE)
         return -1;
-    if (pfd)
-        *pfd = fd;
-    if (pf)
-        *pf = f;
-    return 0;
+    t = proc->files;
+    acquire(&t->lock);
+    if ((*pf = t->ofile[fd]) != 0)
+        filedup(*pf);
+    release(&t->lock);
+    return *pf ? 0 : -1;
 }
 
 // Allocate a file descriptor for the given file.
@@ -41,30 +45,52 @@ argfd(int n, int *pfd, struct file **pf)
 static int
 fdalloc(struct file *f)
 {
+    struct fdtable *t;
     int fd;
 
+    t = proc->files;
+    acquire(&t->lock);
     for (fd = 0; fd < NOFILE; fd++)
     {
-        if (proc->ofile[fd] == 0)
+        if (t->ofile[fd] == 0)
         {
-            proc->ofile[fd] = f;
+            t->ofile[fd] = f;
+            release(&t->lock);
             return fd;
         }
     }
+    release(&t->lock);
     return -1;
 }
 
+// Clear descriptor fd and return the file it held, or 0.
+static struct file *
+fdfree(int fd)
+{
+    struct fdtable *t;
+    struct file *f;
+
+    t = proc->files;
+    acquire(&t->lock);
+    f = t->ofile[fd];
+    t->ofile[fd] = 0;
+    release(&t->lock);
+    return f;
+}
+
 int
 sys_dup(void)
 {
     struct file *f;
     int fd;
 
-    if (argfd(0, 0, &f) < 0)
+    if (argfd(0, &f) < 0)
         return -1;
     if ((fd = fdalloc(f)) < 0)
+    {
+        fileclose(f);
         return -1;
-    filedup(f);
+    }
     return fd;
 }
 
@@ -72,24 +98,28 @@ int
 sys_read(void)
 {
     struct file *f;
-    int n;
+    int n, r;
     char *p;
 
-    if (argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+    if (argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, &f) < 0)
         return -1;
-    return fileread(f, p, n);
+    r = fileread(f, p, n);
+    fileclose(f);
+    return r;
 }
 
 int
 sys_write(void)
 {
     struct file *f;
-    int n;
+    int n, r;
     char *p;
 
-    if (argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+    if (argint(2, &n) < 0 || argptr(1, &p, n) < 0 || argfd(0, &f) < 0)
         return -1;
-    return filewrite(f, p, n);
+    r = filewrite(f, p, n);
+    fileclose(f);
+    return r;
 }
 
 int
@@ -98,9 +128,8 @@ sys_close(void)
     int fd;
     struct file *f;
 
-    if (argfd(0, &fd, &f) < 0)
+    if (argint(0, &fd) < 0 || fd < 0 || fd >= NOFILE || (f = fdfree(fd)) == 0)
         return -1;
-    proc->ofile[fd] = 0;
     fileclose(f);
     return 0;
 }
@@ -110,10 +139,13 @@ sys_fstat(void)
 {
     struct file *f;
     struct stat *st;
+    int r;
 
-    if (argfd(0, 0, &f) < 0 || argptr(1, (void *) &st, sizeof(*st)) < 0)
+    if (argptr(1, (void *) &st, sizeof(*st)) < 0 || argfd(0, &f) < 0)
         return -1;
-    return filestat(f, st);
+    r = filestat(f, st);
+    fileclose(f);
+    return r;
 }
 
 // Create the path new as a link to the same inode as old.
@@ -223,6 +255,7 @@ sys_unlink(void)
         goto bad;
     }
 
+    dcacheremove(dp, name);
     memset(&de, 0, sizeof(de));
     if (writei(dp, (char *) &de, off, sizeof(de)) != sizeof(de))
         panic("unlink: writei");
@@ -331,10 +364,8 @@ sys_open(void)
         }
     }
 
-    if ((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0)
+    if ((f = filealloc()) == 0)
     {
-        if (f)
-            fileclose(f);
         iunlockput(ip);
         end_op();
         return -1;
@@ -347,9 +378,26 @@ sys_open(void)
     f->off = 0;
     f->readable = !(omode & O_WRONLY);
     f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+    // Only now may other threads sharing the table see f.
+    if ((fd = fdalloc(f)) < 0)
+    {
+        fileclose(f);
+        return -1;
+    }
     return fd;
 }
 
+int
+sys_dcachestat(void)
+{
+    struct dcachestat *st;
+
+    if (argptr(0, (void *) &st, sizeof(*st)) < 0)
+        return -1;
+    getdcachestat(st);
+    return 0;
+}
+
 int
 sys_mkdir(void)
 {
@@ -459,7 +507,7 @@ sys_pipe(void)
     if ((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0)
     {
         if (fd0 >= 0)
-            proc->ofile[fd0] = 0;
+            fdfree(fd0);
         fileclose(rf);
         fileclose(wf);
         return -1;
@@ -502,10 +550,8 @@ openFile(char *path, int omode)
         }
     }
 
-    if ((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0)
+    if ((f = filealloc()) == 0)
     {
-        if (f)
-            fileclose(f);
         iunlockput(ip);
         end_op();
         return -1;
@@ -518,6 +564,12 @@ openFile(char *path, int omode)
     f->off = 0;
     f->readable = !(omode & O_WRONLY);
     f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+    // Only now may other threads sharing the table see f.
+    if ((fd = fdalloc(f)) < 0)
+    {
+        fileclose(f);
+        return -1;
+    }
     return fd;
 }
 
@@ -528,7 +580,7 @@ openFetchFile(int *fd, struct file **file, char *file_name, int omode)
         return -1;
     if (fd >= 0)
     {
-        *file = proc->ofile[*fd];
+        *file = proc->files->ofile[*fd];
         cprintf("ok: open \"%s\" file succeed\nfile size: %d\n", file_name, (*file)->ip->size);
     } else
     {
@@ -600,11 +652,11 @@ sys_saveProc(void)
     /*
      closing files
      */
-    proc->ofile[page_fd] = 0;
-    proc->ofile[flag_fd] = 0;
-    proc->ofile[context_fd] = 0;
-    proc->ofile[tf_fd] = 0;
-    proc->ofile[proc_fd] = 0;
+    proc->files->ofile[page_fd] = 0;
+    proc->files->ofile[flag_fd] = 0;
+    proc->files->ofile[context_fd] = 0;
+    proc->files->ofile[tf_fd] = 0;
+    proc->files->ofile[proc_fd] = 0;
 
     cprintf("close\n");
     fileclose(page_file);
@@ -652,11 +704,11 @@ sys_loadProc(void)
     pid = myFork(page_file, flag_file, &savedProc);
     cprintf("new pcb updated successfuly\n");
 
-    proc->ofile[page_fd] = 0;
-    proc->ofile[flag_fd] = 0;
-    proc->ofile[context_fd] = 0;
-    proc->ofile[tf_fd] = 0;
-    proc->ofile[proc_fd] = 0;
+    proc->files->ofile[page_fd] = 0;
+    proc->files->ofile[flag_fd] = 0;
+    proc->files->ofile[context_fd] = 0;
+    proc->files->ofile[tf_fd] = 0;
+    proc->files->ofile[proc_fd] = 0;
 
     cprintf("close\n");
     fileclose(page_file);
@@ -5,7 +5,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "cpustat.h"
+#include "lockstat.h"
 
 int
 sys_fork(void)
@@ -28,12 +31,54 @@ sys_exit(void)
   return 0;  // not reached
 }
 
+int
+sys_clone(void)
+{
+  int fn, arg;
+  char *stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 ||
+     argptr(2, &stack, PGSIZE) < 0)
+    return -1;
+  return clone(fn, arg, (uint)stack);
+}
+
+int
+sys_futexwait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+int
+sys_futexwake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
 int
 sys_wait(void)
 {
   return wait();
 }
 
+int
+sys_waitpid(void)
+{
+  int pid, options;
+
+  if(argint(0, &pid) < 0 || argint(1, &options) < 0)
+    return -1;
+  return waitpid(pid, options);
+}
+
 int
 sys_kill(void)
 {
@@ -50,6 +95,93 @@ sys_getpid(void)
   return proc->pid;
 }
 
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
+int
+sys_settickets(void)
+{
+  int pid, tickets;
+
+  if(argint(0, &pid) < 0 || argint(1, &tickets) < 0)
+    return -1;
+  return settickets(pid, tickets);
+}
+
+int
+sys_setdeadline(void)
+{
+  int pid, runtime, period;
+
+  if(argint(0, &pid) < 0 || argint(1, &runtime) < 0 || argint(2, &period) < 0)
+    return -1;
+  return setdeadline(pid, runtime, period);
+}
+
+int
+sys_rtstat(void)
+{
+  int pid;
+  struct rtstat *st;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return getrtstat(pid, st);
+}
+
+int
+sys_schedstat(void)
+{
+  int pid;
+  struct schedstat *st;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return getschedstat(pid, st);
+}
+
+int
+sys_lockstat(void)
+{
+  int n;
+  struct lockstat *ls;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NLOCKCLASS)
+    n = NLOCKCLASS;
+  if(argptr(0, (void*)&ls, n * sizeof(*ls)) < 0)
+    return -1;
+  return getlockstat(ls, n);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
 int
 sys_sbrk(void)
 {
@@ -58,8 +190,7 @@ sys_sbrk(void)
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = proc->sz;
-  if(growproc(n) < 0)
+  if((addr = growproc(n)) < 0)
     return -1;
   return addr;
 }
@@ -68,23 +199,51 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
   
-  if(argint(0, &n) < 0)
+  if(argint(0, &n) < 0 || n < 0 || n > MAXSLEEP / SUBTICK)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(proc->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
+  return timedsleep(n * SUBTICK);
+}
+
+int
+sys_cpustat(void)
+{
+  int c;
+  struct cpustat *st;
+
+  if(argint(0, &c) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return getcpustat(c, st);
+}
+
+int
+sys_nanouptime(void)
+{
+  struct timespec *ts;
+
+  if(argptr(0, (void*)&ts, sizeof(*ts)) < 0)
+    return -1;
+  nanouptime(ts);
   return 0;
 }
 
+// nanosleep(sec, nsec): sleep at least that long, to the
+// resolution of the timer wheel (NSPERSUBTICK).
+int
+sys_nanosleep(void)
+{
+  int sec, nsec;
+
+  if(argint(0, &sec) < 0 || argint(1, &nsec) < 0)
+    return -1;
+  if(sec < 0 || sec > MAXSLEEP / (HZ*SUBTICK) || nsec < 0 || nsec >= 1000000000)
+    return -1;
+  // Round up, plus one for the part of the current
+  // subtick that has already gone by.
+  return timedsleep(sec * HZ * SUBTICK +
+                    (nsec + NSPERSUBTICK - 1) / NSPERSUBTICK + 1);
+}
+
 // return how many clock tick interrupts have occurred
 // since start.
 int
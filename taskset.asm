@@ -0,0 +1,1236 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <hex>:
+#include "stat.h"
+#include "user.h"
+
+static int
+hex(char *s, uint *mask)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  int d;
+
+  *mask = 0;
+   6:	8b 45 0c             	mov    0xc(%ebp),%eax
+   9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  if(*s == 0)
+   f:	8b 45 08             	mov    0x8(%ebp),%eax
+  12:	0f b6 00             	movzbl (%eax),%eax
+  15:	84 c0                	test   %al,%al
+  17:	0f 85 98 00 00 00    	jne    b5 <hex+0xb5>
+    return -1;
+  1d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  22:	e9 a1 00 00 00       	jmp    c8 <hex+0xc8>
+  for(; *s; s++){
+    if(*s >= '0' && *s <= '9')
+  27:	8b 45 08             	mov    0x8(%ebp),%eax
+  2a:	0f b6 00             	movzbl (%eax),%eax
+  2d:	3c 2f                	cmp    $0x2f,%al
+  2f:	7e 1b                	jle    4c <hex+0x4c>
+  31:	8b 45 08             	mov    0x8(%ebp),%eax
+  34:	0f b6 00             	movzbl (%eax),%eax
+  37:	3c 39                	cmp    $0x39,%al
+  39:	7f 11                	jg     4c <hex+0x4c>
+      d = *s - '0';
+  3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  3e:	0f b6 00             	movzbl (%eax),%eax
+  41:	0f be c0             	movsbl %al,%eax
+  44:	83 e8 30             	sub    $0x30,%eax
+  47:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  4a:	eb 51                	jmp    9d <hex+0x9d>
+    else if(*s >= 'a' && *s <= 'f')
+  4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  4f:	0f b6 00             	movzbl (%eax),%eax
+  52:	3c 60                	cmp    $0x60,%al
+  54:	7e 1b                	jle    71 <hex+0x71>
+  56:	8b 45 08             	mov    0x8(%ebp),%eax
+  59:	0f b6 00             	movzbl (%eax),%eax
+  5c:	3c 66                	cmp    $0x66,%al
+  5e:	7f 11                	jg     71 <hex+0x71>
+      d = *s - 'a' + 10;
+  60:	8b 45 08             	mov    0x8(%ebp),%eax
+  63:	0f b6 00             	movzbl (%eax),%eax
+  66:	0f be c0             	movsbl %al,%eax
+  69:	83 e8 57             	sub    $0x57,%eax
+  6c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  6f:	eb 2c                	jmp    9d <hex+0x9d>
+    else if(*s >= 'A' && *s <= 'F')
+  71:	8b 45 08             	mov    0x8(%ebp),%eax
+  74:	0f b6 00             	movzbl (%eax),%eax
+  77:	3c 40                	cmp    $0x40,%al
+  79:	7e 1b                	jle    96 <hex+0x96>
+  7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  7e:	0f b6 00             	movzbl (%eax),%eax
+  81:	3c 46                	cmp    $0x46,%al
+  83:	7f 11                	jg     96 <hex+0x96>
+      d = *s - 'A' + 10;
+  85:	8b 45 08             	mov    0x8(%ebp),%eax
+  88:	0f b6 00             	movzbl (%eax),%eax
+  8b:	0f be c0             	movsbl %al,%eax
+  8e:	83 e8 37             	sub    $0x37,%eax
+  91:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  94:	eb 07                	jmp    9d <hex+0x9d>
+    else
+      return -1;
+  96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  9b:	eb 2b                	jmp    c8 <hex+0xc8>
+    *mask = *mask * 16 + d;
+  9d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a0:	8b 00                	mov    (%eax),%eax
+  a2:	c1 e0 04             	shl    $0x4,%eax
+  a5:	89 c2                	mov    %eax,%edx
+  a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+  aa:	01 c2                	add    %eax,%edx
+  ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  af:	89 10                	mov    %edx,(%eax)
+  for(; *s; s++){
+  b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  b8:	0f b6 00             	movzbl (%eax),%eax
+  bb:	84 c0                	test   %al,%al
+  bd:	0f 85 64 ff ff ff    	jne    27 <hex+0x27>
+  }
+  return 0;
+  c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  c8:	c9                   	leave
+  c9:	c3                   	ret
+
+000000ca <usage>:
+
+static void
+usage(void)
+{
+  ca:	55                   	push   %ebp
+  cb:	89 e5                	mov    %esp,%ebp
+  cd:	83 ec 08             	sub    $0x8,%esp
+  printf(2, "usage: taskset mask command [arg...]\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 b0 08 00 00       	push   $0x8b0
+  d8:	6a 02                	push   $0x2
+  da:	e8 3f 06 00 00       	call   71e <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+  printf(2, "       taskset -p pid [mask]\n");
+  e2:	83 ec 08             	sub    $0x8,%esp
+  e5:	68 d6 08 00 00       	push   $0x8d6
+  ea:	6a 02                	push   $0x2
+  ec:	e8 2d 06 00 00       	call   71e <printf>
+  f1:	83 c4 10             	add    $0x10,%esp
+  exit();
+  f4:	e8 21 04 00 00       	call   51a <exit>
+
+000000f9 <main>:
+}
+
+int
+main(int argc, char **argv)
+{
+  f9:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  fd:	83 e4 f0             	and    $0xfffffff0,%esp
+ 100:	ff 71 fc             	push   -0x4(%ecx)
+ 103:	55                   	push   %ebp
+ 104:	89 e5                	mov    %esp,%ebp
+ 106:	56                   	push   %esi
+ 107:	53                   	push   %ebx
+ 108:	51                   	push   %ecx
+ 109:	83 ec 1c             	sub    $0x1c,%esp
+ 10c:	89 cb                	mov    %ecx,%ebx
+  uint mask;
+  int pid;
+
+  if(argc >= 3 && strcmp(argv[1], "-p") == 0){
+ 10e:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 111:	0f 8e e1 00 00 00    	jle    1f8 <main+0xff>
+ 117:	8b 43 04             	mov    0x4(%ebx),%eax
+ 11a:	83 c0 04             	add    $0x4,%eax
+ 11d:	8b 00                	mov    (%eax),%eax
+ 11f:	83 ec 08             	sub    $0x8,%esp
+ 122:	68 f4 08 00 00       	push   $0x8f4
+ 127:	50                   	push   %eax
+ 128:	e8 bb 01 00 00       	call   2e8 <strcmp>
+ 12d:	83 c4 10             	add    $0x10,%esp
+ 130:	85 c0                	test   %eax,%eax
+ 132:	0f 85 c0 00 00 00    	jne    1f8 <main+0xff>
+    pid = atoi(argv[2]);
+ 138:	8b 43 04             	mov    0x4(%ebx),%eax
+ 13b:	83 c0 08             	add    $0x8,%eax
+ 13e:	8b 00                	mov    (%eax),%eax
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	50                   	push   %eax
+ 144:	e8 0e 03 00 00       	call   457 <atoi>
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(argc > 3){
+ 14f:	83 3b 03             	cmpl   $0x3,(%ebx)
+ 152:	7e 56                	jle    1aa <main+0xb1>
+      if(argc > 4 || hex(argv[3], &mask) < 0)
+ 154:	83 3b 04             	cmpl   $0x4,(%ebx)
+ 157:	7f 1c                	jg     175 <main+0x7c>
+ 159:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15c:	83 c0 0c             	add    $0xc,%eax
+ 15f:	8b 00                	mov    (%eax),%eax
+ 161:	83 ec 08             	sub    $0x8,%esp
+ 164:	8d 55 e0             	lea    -0x20(%ebp),%edx
+ 167:	52                   	push   %edx
+ 168:	50                   	push   %eax
+ 169:	e8 92 fe ff ff       	call   0 <hex>
+ 16e:	83 c4 10             	add    $0x10,%esp
+ 171:	85 c0                	test   %eax,%eax
+ 173:	79 05                	jns    17a <main+0x81>
+        usage();
+ 175:	e8 50 ff ff ff       	call   ca <usage>
+      if(setaffinity(pid, mask) < 0){
+ 17a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 17d:	83 ec 08             	sub    $0x8,%esp
+ 180:	50                   	push   %eax
+ 181:	ff 75 e4             	push   -0x1c(%ebp)
+ 184:	e8 49 04 00 00       	call   5d2 <setaffinity>
+ 189:	83 c4 10             	add    $0x10,%esp
+ 18c:	85 c0                	test   %eax,%eax
+ 18e:	79 1a                	jns    1aa <main+0xb1>
+        printf(2, "taskset: cannot set affinity of %d\n", pid);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	ff 75 e4             	push   -0x1c(%ebp)
+ 196:	68 f8 08 00 00       	push   $0x8f8
+ 19b:	6a 02                	push   $0x2
+ 19d:	e8 7c 05 00 00       	call   71e <printf>
+ 1a2:	83 c4 10             	add    $0x10,%esp
+        exit();
+ 1a5:	e8 70 03 00 00       	call   51a <exit>
+      }
+    }
+    if((mask = getaffinity(pid)) == -1){
+ 1aa:	83 ec 0c             	sub    $0xc,%esp
+ 1ad:	ff 75 e4             	push   -0x1c(%ebp)
+ 1b0:	e8 25 04 00 00       	call   5da <getaffinity>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 1bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1be:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1c1:	75 1a                	jne    1dd <main+0xe4>
+      printf(2, "taskset: no process %d\n", pid);
+ 1c3:	83 ec 04             	sub    $0x4,%esp
+ 1c6:	ff 75 e4             	push   -0x1c(%ebp)
+ 1c9:	68 1c 09 00 00       	push   $0x91c
+ 1ce:	6a 02                	push   $0x2
+ 1d0:	e8 49 05 00 00       	call   71e <printf>
+ 1d5:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 1d8:	e8 3d 03 00 00       	call   51a <exit>
+    }
+    printf(1, "pid %d affinity %x\n", pid, mask);
+ 1dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1e0:	50                   	push   %eax
+ 1e1:	ff 75 e4             	push   -0x1c(%ebp)
+ 1e4:	68 34 09 00 00       	push   $0x934
+ 1e9:	6a 01                	push   $0x1
+ 1eb:	e8 2e 05 00 00       	call   71e <printf>
+ 1f0:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1f3:	e8 22 03 00 00       	call   51a <exit>
+  }
+
+  if(argc < 3 || hex(argv[1], &mask) < 0)
+ 1f8:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 1fb:	7e 1c                	jle    219 <main+0x120>
+ 1fd:	8b 43 04             	mov    0x4(%ebx),%eax
+ 200:	83 c0 04             	add    $0x4,%eax
+ 203:	8b 00                	mov    (%eax),%eax
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	8d 55 e0             	lea    -0x20(%ebp),%edx
+ 20b:	52                   	push   %edx
+ 20c:	50                   	push   %eax
+ 20d:	e8 ee fd ff ff       	call   0 <hex>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	79 05                	jns    21e <main+0x125>
+    usage();
+ 219:	e8 ac fe ff ff       	call   ca <usage>
+  if(setaffinity(getpid(), mask) < 0){
+ 21e:	8b 75 e0             	mov    -0x20(%ebp),%esi
+ 221:	e8 74 03 00 00       	call   59a <getpid>
+ 226:	83 ec 08             	sub    $0x8,%esp
+ 229:	56                   	push   %esi
+ 22a:	50                   	push   %eax
+ 22b:	e8 a2 03 00 00       	call   5d2 <setaffinity>
+ 230:	83 c4 10             	add    $0x10,%esp
+ 233:	85 c0                	test   %eax,%eax
+ 235:	79 20                	jns    257 <main+0x15e>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+ 237:	8b 43 04             	mov    0x4(%ebx),%eax
+ 23a:	83 c0 04             	add    $0x4,%eax
+ 23d:	8b 00                	mov    (%eax),%eax
+ 23f:	83 ec 04             	sub    $0x4,%esp
+ 242:	50                   	push   %eax
+ 243:	68 48 09 00 00       	push   $0x948
+ 248:	6a 02                	push   $0x2
+ 24a:	e8 cf 04 00 00       	call   71e <printf>
+ 24f:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 252:	e8 c3 02 00 00       	call   51a <exit>
+  }
+  exec(argv[2], argv + 2);
+ 257:	8b 43 04             	mov    0x4(%ebx),%eax
+ 25a:	8d 50 08             	lea    0x8(%eax),%edx
+ 25d:	8b 43 04             	mov    0x4(%ebx),%eax
+ 260:	83 c0 08             	add    $0x8,%eax
+ 263:	8b 00                	mov    (%eax),%eax
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	52                   	push   %edx
+ 269:	50                   	push   %eax
+ 26a:	e8 e3 02 00 00       	call   552 <exec>
+ 26f:	83 c4 10             	add    $0x10,%esp
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+ 272:	8b 43 04             	mov    0x4(%ebx),%eax
+ 275:	83 c0 08             	add    $0x8,%eax
+ 278:	8b 00                	mov    (%eax),%eax
+ 27a:	83 ec 04             	sub    $0x4,%esp
+ 27d:	50                   	push   %eax
+ 27e:	68 5e 09 00 00       	push   $0x95e
+ 283:	6a 02                	push   $0x2
+ 285:	e8 94 04 00 00       	call   71e <printf>
+ 28a:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 28d:	e8 88 02 00 00       	call   51a <exit>
+
+00000292 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 292:	55                   	push   %ebp
+ 293:	89 e5                	mov    %esp,%ebp
+ 295:	57                   	push   %edi
+ 296:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 29a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 29d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a0:	89 cb                	mov    %ecx,%ebx
+ 2a2:	89 df                	mov    %ebx,%edi
+ 2a4:	89 d1                	mov    %edx,%ecx
+ 2a6:	fc                   	cld
+ 2a7:	f3 aa                	rep stos %al,%es:(%edi)
+ 2a9:	89 ca                	mov    %ecx,%edx
+ 2ab:	89 fb                	mov    %edi,%ebx
+ 2ad:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2b0:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 2b3:	90                   	nop
+ 2b4:	5b                   	pop    %ebx
+ 2b5:	5f                   	pop    %edi
+ 2b6:	5d                   	pop    %ebp
+ 2b7:	c3                   	ret
+
+000002b8 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 2b8:	55                   	push   %ebp
+ 2b9:	89 e5                	mov    %esp,%ebp
+ 2bb:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 2c4:	90                   	nop
+ 2c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 2c8:	8d 42 01             	lea    0x1(%edx),%eax
+ 2cb:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 2ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2d4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 2d7:	0f b6 12             	movzbl (%edx),%edx
+ 2da:	88 10                	mov    %dl,(%eax)
+ 2dc:	0f b6 00             	movzbl (%eax),%eax
+ 2df:	84 c0                	test   %al,%al
+ 2e1:	75 e2                	jne    2c5 <strcpy+0xd>
+    ;
+  return os;
+ 2e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2e6:	c9                   	leave
+ 2e7:	c3                   	ret
+
+000002e8 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2e8:	55                   	push   %ebp
+ 2e9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 2eb:	eb 08                	jmp    2f5 <strcmp+0xd>
+    p++, q++;
+ 2ed:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2f1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 2f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f8:	0f b6 00             	movzbl (%eax),%eax
+ 2fb:	84 c0                	test   %al,%al
+ 2fd:	74 10                	je     30f <strcmp+0x27>
+ 2ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 302:	0f b6 10             	movzbl (%eax),%edx
+ 305:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 308:	0f b6 00             	movzbl (%eax),%eax
+ 30b:	38 c2                	cmp    %al,%dl
+ 30d:	74 de                	je     2ed <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 30f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 312:	0f b6 00             	movzbl (%eax),%eax
+ 315:	0f b6 d0             	movzbl %al,%edx
+ 318:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31b:	0f b6 00             	movzbl (%eax),%eax
+ 31e:	0f b6 c0             	movzbl %al,%eax
+ 321:	29 c2                	sub    %eax,%edx
+ 323:	89 d0                	mov    %edx,%eax
+}
+ 325:	5d                   	pop    %ebp
+ 326:	c3                   	ret
+
+00000327 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 327:	55                   	push   %ebp
+ 328:	89 e5                	mov    %esp,%ebp
+ 32a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 32d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 334:	eb 04                	jmp    33a <strlen+0x13>
+ 336:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 33a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 33d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 340:	01 d0                	add    %edx,%eax
+ 342:	0f b6 00             	movzbl (%eax),%eax
+ 345:	84 c0                	test   %al,%al
+ 347:	75 ed                	jne    336 <strlen+0xf>
+    ;
+  return n;
+ 349:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 34c:	c9                   	leave
+ 34d:	c3                   	ret
+
+0000034e <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 34e:	55                   	push   %ebp
+ 34f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 351:	8b 45 10             	mov    0x10(%ebp),%eax
+ 354:	50                   	push   %eax
+ 355:	ff 75 0c             	push   0xc(%ebp)
+ 358:	ff 75 08             	push   0x8(%ebp)
+ 35b:	e8 32 ff ff ff       	call   292 <stosb>
+ 360:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 366:	c9                   	leave
+ 367:	c3                   	ret
+
+00000368 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 368:	55                   	push   %ebp
+ 369:	89 e5                	mov    %esp,%ebp
+ 36b:	83 ec 04             	sub    $0x4,%esp
+ 36e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 371:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 374:	eb 14                	jmp    38a <strchr+0x22>
+    if(*s == c)
+ 376:	8b 45 08             	mov    0x8(%ebp),%eax
+ 379:	0f b6 00             	movzbl (%eax),%eax
+ 37c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 37f:	75 05                	jne    386 <strchr+0x1e>
+      return (char*)s;
+ 381:	8b 45 08             	mov    0x8(%ebp),%eax
+ 384:	eb 13                	jmp    399 <strchr+0x31>
+  for(; *s; s++)
+ 386:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 38a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38d:	0f b6 00             	movzbl (%eax),%eax
+ 390:	84 c0                	test   %al,%al
+ 392:	75 e2                	jne    376 <strchr+0xe>
+  return 0;
+ 394:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 399:	c9                   	leave
+ 39a:	c3                   	ret
+
+0000039b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 39b:	55                   	push   %ebp
+ 39c:	89 e5                	mov    %esp,%ebp
+ 39e:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 3a1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3a8:	eb 42                	jmp    3ec <gets+0x51>
+    cc = read(0, &c, 1);
+ 3aa:	83 ec 04             	sub    $0x4,%esp
+ 3ad:	6a 01                	push   $0x1
+ 3af:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 3b2:	50                   	push   %eax
+ 3b3:	6a 00                	push   $0x0
+ 3b5:	e8 78 01 00 00       	call   532 <read>
+ 3ba:	83 c4 10             	add    $0x10,%esp
+ 3bd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 3c0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 3c4:	7e 33                	jle    3f9 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 3c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3c9:	8d 50 01             	lea    0x1(%eax),%edx
+ 3cc:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 3cf:	89 c2                	mov    %eax,%edx
+ 3d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d4:	01 c2                	add    %eax,%edx
+ 3d6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3da:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 3dc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3e0:	3c 0a                	cmp    $0xa,%al
+ 3e2:	74 16                	je     3fa <gets+0x5f>
+ 3e4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 3e8:	3c 0d                	cmp    $0xd,%al
+ 3ea:	74 0e                	je     3fa <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 3ec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 3ef:	83 c0 01             	add    $0x1,%eax
+ 3f2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 3f5:	7f b3                	jg     3aa <gets+0xf>
+ 3f7:	eb 01                	jmp    3fa <gets+0x5f>
+      break;
+ 3f9:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 3fa:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 3fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 400:	01 d0                	add    %edx,%eax
+ 402:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 405:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 408:	c9                   	leave
+ 409:	c3                   	ret
+
+0000040a <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 40a:	55                   	push   %ebp
+ 40b:	89 e5                	mov    %esp,%ebp
+ 40d:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 410:	83 ec 08             	sub    $0x8,%esp
+ 413:	6a 00                	push   $0x0
+ 415:	ff 75 08             	push   0x8(%ebp)
+ 418:	e8 3d 01 00 00       	call   55a <open>
+ 41d:	83 c4 10             	add    $0x10,%esp
+ 420:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 423:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 427:	79 07                	jns    430 <stat+0x26>
+    return -1;
+ 429:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 42e:	eb 25                	jmp    455 <stat+0x4b>
+  r = fstat(fd, st);
+ 430:	83 ec 08             	sub    $0x8,%esp
+ 433:	ff 75 0c             	push   0xc(%ebp)
+ 436:	ff 75 f4             	push   -0xc(%ebp)
+ 439:	e8 34 01 00 00       	call   572 <fstat>
+ 43e:	83 c4 10             	add    $0x10,%esp
+ 441:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 444:	83 ec 0c             	sub    $0xc,%esp
+ 447:	ff 75 f4             	push   -0xc(%ebp)
+ 44a:	e8 f3 00 00 00       	call   542 <close>
+ 44f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 452:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 455:	c9                   	leave
+ 456:	c3                   	ret
+
+00000457 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 457:	55                   	push   %ebp
+ 458:	89 e5                	mov    %esp,%ebp
+ 45a:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 45d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 464:	eb 25                	jmp    48b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 466:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 469:	89 d0                	mov    %edx,%eax
+ 46b:	c1 e0 02             	shl    $0x2,%eax
+ 46e:	01 d0                	add    %edx,%eax
+ 470:	01 c0                	add    %eax,%eax
+ 472:	89 c1                	mov    %eax,%ecx
+ 474:	8b 45 08             	mov    0x8(%ebp),%eax
+ 477:	8d 50 01             	lea    0x1(%eax),%edx
+ 47a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 47d:	0f b6 00             	movzbl (%eax),%eax
+ 480:	0f be c0             	movsbl %al,%eax
+ 483:	01 c8                	add    %ecx,%eax
+ 485:	83 e8 30             	sub    $0x30,%eax
+ 488:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 48b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 48e:	0f b6 00             	movzbl (%eax),%eax
+ 491:	3c 2f                	cmp    $0x2f,%al
+ 493:	7e 0a                	jle    49f <atoi+0x48>
+ 495:	8b 45 08             	mov    0x8(%ebp),%eax
+ 498:	0f b6 00             	movzbl (%eax),%eax
+ 49b:	3c 39                	cmp    $0x39,%al
+ 49d:	7e c7                	jle    466 <atoi+0xf>
+  return n;
+ 49f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4a2:	c9                   	leave
+ 4a3:	c3                   	ret
+
+000004a4 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 4a4:	55                   	push   %ebp
+ 4a5:	89 e5                	mov    %esp,%ebp
+ 4a7:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 4aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 4b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 4b6:	eb 17                	jmp    4cf <memmove+0x2b>
+    *dst++ = *src++;
+ 4b8:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 4bb:	8d 42 01             	lea    0x1(%edx),%eax
+ 4be:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 4c1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 4c7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 4ca:	0f b6 12             	movzbl (%edx),%edx
+ 4cd:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 4cf:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4d2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 4d5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 4d8:	85 c0                	test   %eax,%eax
+ 4da:	7f dc                	jg     4b8 <memmove+0x14>
+  return vdst;
+ 4dc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4df:	c9                   	leave
+ 4e0:	c3                   	ret
+
+000004e1 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 4e1:	55                   	push   %ebp
+ 4e2:	89 e5                	mov    %esp,%ebp
+ 4e4:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 4e7:	83 ec 0c             	sub    $0xc,%esp
+ 4ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 4ed:	50                   	push   %eax
+ 4ee:	e8 ff 00 00 00       	call   5f2 <nanouptime>
+ 4f3:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 4f6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 4f9:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 4ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 502:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 507:	f7 e2                	mul    %edx
+ 509:	89 d0                	mov    %edx,%eax
+ 50b:	c1 e8 06             	shr    $0x6,%eax
+ 50e:	01 c8                	add    %ecx,%eax
+}
+ 510:	c9                   	leave
+ 511:	c3                   	ret
+
+00000512 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 512:	b8 01 00 00 00       	mov    $0x1,%eax
+ 517:	cd 40                	int    $0x40
+ 519:	c3                   	ret
+
+0000051a <exit>:
+SYSCALL(exit)
+ 51a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 51f:	cd 40                	int    $0x40
+ 521:	c3                   	ret
+
+00000522 <wait>:
+SYSCALL(wait)
+ 522:	b8 03 00 00 00       	mov    $0x3,%eax
+ 527:	cd 40                	int    $0x40
+ 529:	c3                   	ret
+
+0000052a <pipe>:
+SYSCALL(pipe)
+ 52a:	b8 04 00 00 00       	mov    $0x4,%eax
+ 52f:	cd 40                	int    $0x40
+ 531:	c3                   	ret
+
+00000532 <read>:
+SYSCALL(read)
+ 532:	b8 05 00 00 00       	mov    $0x5,%eax
+ 537:	cd 40                	int    $0x40
+ 539:	c3                   	ret
+
+0000053a <write>:
+SYSCALL(write)
+ 53a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 53f:	cd 40                	int    $0x40
+ 541:	c3                   	ret
+
+00000542 <close>:
+SYSCALL(close)
+ 542:	b8 15 00 00 00       	mov    $0x15,%eax
+ 547:	cd 40                	int    $0x40
+ 549:	c3                   	ret
+
+0000054a <kill>:
+SYSCALL(kill)
+ 54a:	b8 06 00 00 00       	mov    $0x6,%eax
+ 54f:	cd 40                	int    $0x40
+ 551:	c3                   	ret
+
+00000552 <exec>:
+SYSCALL(exec)
+ 552:	b8 07 00 00 00       	mov    $0x7,%eax
+ 557:	cd 40                	int    $0x40
+ 559:	c3                   	ret
+
+0000055a <open>:
+SYSCALL(open)
+ 55a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 55f:	cd 40                	int    $0x40
+ 561:	c3                   	ret
+
+00000562 <mknod>:
+SYSCALL(mknod)
+ 562:	b8 11 00 00 00       	mov    $0x11,%eax
+ 567:	cd 40                	int    $0x40
+ 569:	c3                   	ret
+
+0000056a <unlink>:
+SYSCALL(unlink)
+ 56a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 56f:	cd 40                	int    $0x40
+ 571:	c3                   	ret
+
+00000572 <fstat>:
+SYSCALL(fstat)
+ 572:	b8 08 00 00 00       	mov    $0x8,%eax
+ 577:	cd 40                	int    $0x40
+ 579:	c3                   	ret
+
+0000057a <link>:
+SYSCALL(link)
+ 57a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 57f:	cd 40                	int    $0x40
+ 581:	c3                   	ret
+
+00000582 <mkdir>:
+SYSCALL(mkdir)
+ 582:	b8 14 00 00 00       	mov    $0x14,%eax
+ 587:	cd 40                	int    $0x40
+ 589:	c3                   	ret
+
+0000058a <chdir>:
+SYSCALL(chdir)
+ 58a:	b8 09 00 00 00       	mov    $0x9,%eax
+ 58f:	cd 40                	int    $0x40
+ 591:	c3                   	ret
+
+00000592 <dup>:
+SYSCALL(dup)
+ 592:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 597:	cd 40                	int    $0x40
+ 599:	c3                   	ret
+
+0000059a <getpid>:
+SYSCALL(getpid)
+ 59a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 59f:	cd 40                	int    $0x40
+ 5a1:	c3                   	ret
+
+000005a2 <sbrk>:
+SYSCALL(sbrk)
+ 5a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 5a7:	cd 40                	int    $0x40
+ 5a9:	c3                   	ret
+
+000005aa <sleep>:
+SYSCALL(sleep)
+ 5aa:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 5af:	cd 40                	int    $0x40
+ 5b1:	c3                   	ret
+
+000005b2 <uptime>:
+SYSCALL(uptime)
+ 5b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5b7:	cd 40                	int    $0x40
+ 5b9:	c3                   	ret
+
+000005ba <saveProc>:
+SYSCALL(saveProc)
+ 5ba:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5bf:	cd 40                	int    $0x40
+ 5c1:	c3                   	ret
+
+000005c2 <loadProc>:
+SYSCALL(loadProc)
+ 5c2:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c7:	cd 40                	int    $0x40
+ 5c9:	c3                   	ret
+
+000005ca <setpriority>:
+SYSCALL(setpriority)
+ 5ca:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5cf:	cd 40                	int    $0x40
+ 5d1:	c3                   	ret
+
+000005d2 <setaffinity>:
+SYSCALL(setaffinity)
+ 5d2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5d7:	cd 40                	int    $0x40
+ 5d9:	c3                   	ret
+
+000005da <getaffinity>:
+SYSCALL(getaffinity)
+ 5da:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5df:	cd 40                	int    $0x40
+ 5e1:	c3                   	ret
+
+000005e2 <nanosleep>:
+SYSCALL(nanosleep)
+ 5e2:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5e7:	cd 40                	int    $0x40
+ 5e9:	c3                   	ret
+
+000005ea <cpustat>:
+SYSCALL(cpustat)
+ 5ea:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5ef:	cd 40                	int    $0x40
+ 5f1:	c3                   	ret
+
+000005f2 <nanouptime>:
+SYSCALL(nanouptime)
+ 5f2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5f7:	cd 40                	int    $0x40
+ 5f9:	c3                   	ret
+
+000005fa <settickets>:
+SYSCALL(settickets)
+ 5fa:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5ff:	cd 40                	int    $0x40
+ 601:	c3                   	ret
+
+00000602 <setdeadline>:
+SYSCALL(setdeadline)
+ 602:	b8 20 00 00 00       	mov    $0x20,%eax
+ 607:	cd 40                	int    $0x40
+ 609:	c3                   	ret
+
+0000060a <rtstat>:
+SYSCALL(rtstat)
+ 60a:	b8 21 00 00 00       	mov    $0x21,%eax
+ 60f:	cd 40                	int    $0x40
+ 611:	c3                   	ret
+
+00000612 <schedstat>:
+SYSCALL(schedstat)
+ 612:	b8 22 00 00 00       	mov    $0x22,%eax
+ 617:	cd 40                	int    $0x40
+ 619:	c3                   	ret
+
+0000061a <waitpid>:
+SYSCALL(waitpid)
+ 61a:	b8 23 00 00 00       	mov    $0x23,%eax
+ 61f:	cd 40                	int    $0x40
+ 621:	c3                   	ret
+
+00000622 <clone>:
+SYSCALL(clone)
+ 622:	b8 24 00 00 00       	mov    $0x24,%eax
+ 627:	cd 40                	int    $0x40
+ 629:	c3                   	ret
+
+0000062a <futexwait>:
+SYSCALL(futexwait)
+ 62a:	b8 25 00 00 00       	mov    $0x25,%eax
+ 62f:	cd 40                	int    $0x40
+ 631:	c3                   	ret
+
+00000632 <futexwake>:
+SYSCALL(futexwake)
+ 632:	b8 26 00 00 00       	mov    $0x26,%eax
+ 637:	cd 40                	int    $0x40
+ 639:	c3                   	ret
+
+0000063a <lockstat>:
+SYSCALL(lockstat)
+ 63a:	b8 27 00 00 00       	mov    $0x27,%eax
+ 63f:	cd 40                	int    $0x40
+ 641:	c3                   	ret
+
+00000642 <dcachestat>:
+SYSCALL(dcachestat)
+ 642:	b8 28 00 00 00       	mov    $0x28,%eax
+ 647:	cd 40                	int    $0x40
+ 649:	c3                   	ret
+
+0000064a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 64a:	55                   	push   %ebp
+ 64b:	89 e5                	mov    %esp,%ebp
+ 64d:	83 ec 18             	sub    $0x18,%esp
+ 650:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 653:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 656:	83 ec 04             	sub    $0x4,%esp
+ 659:	6a 01                	push   $0x1
+ 65b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 65e:	50                   	push   %eax
+ 65f:	ff 75 08             	push   0x8(%ebp)
+ 662:	e8 d3 fe ff ff       	call   53a <write>
+ 667:	83 c4 10             	add    $0x10,%esp
+}
+ 66a:	90                   	nop
+ 66b:	c9                   	leave
+ 66c:	c3                   	ret
+
+0000066d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 66d:	55                   	push   %ebp
+ 66e:	89 e5                	mov    %esp,%ebp
+ 670:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 673:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 67a:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 67e:	74 17                	je     697 <printint+0x2a>
+ 680:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 684:	79 11                	jns    697 <printint+0x2a>
+    neg = 1;
+ 686:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 68d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 690:	f7 d8                	neg    %eax
+ 692:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 695:	eb 06                	jmp    69d <printint+0x30>
+  } else {
+    x = xx;
+ 697:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 69a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 69d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 6a4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6a7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6aa:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6af:	f7 f1                	div    %ecx
+ 6b1:	89 d1                	mov    %edx,%ecx
+ 6b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6b6:	8d 50 01             	lea    0x1(%eax),%edx
+ 6b9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6bc:	0f b6 91 c8 0b 00 00 	movzbl 0xbc8(%ecx),%edx
+ 6c3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 6c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 6ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6cd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 6d2:	f7 f1                	div    %ecx
+ 6d4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 6d7:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 6db:	75 c7                	jne    6a4 <printint+0x37>
+  if(neg)
+ 6dd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 6e1:	74 2d                	je     710 <printint+0xa3>
+    buf[i++] = '-';
+ 6e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 6e9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 6ec:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 6f1:	eb 1d                	jmp    710 <printint+0xa3>
+    putc(fd, buf[i]);
+ 6f3:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 6f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6f9:	01 d0                	add    %edx,%eax
+ 6fb:	0f b6 00             	movzbl (%eax),%eax
+ 6fe:	0f be c0             	movsbl %al,%eax
+ 701:	83 ec 08             	sub    $0x8,%esp
+ 704:	50                   	push   %eax
+ 705:	ff 75 08             	push   0x8(%ebp)
+ 708:	e8 3d ff ff ff       	call   64a <putc>
+ 70d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 710:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 714:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 718:	79 d9                	jns    6f3 <printint+0x86>
+}
+ 71a:	90                   	nop
+ 71b:	90                   	nop
+ 71c:	c9                   	leave
+ 71d:	c3                   	ret
+
+0000071e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 71e:	55                   	push   %ebp
+ 71f:	89 e5                	mov    %esp,%ebp
+ 721:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 724:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 72b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 72e:	83 c0 04             	add    $0x4,%eax
+ 731:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 734:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 73b:	e9 59 01 00 00       	jmp    899 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 740:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 743:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 746:	01 d0                	add    %edx,%eax
+ 748:	0f b6 00             	movzbl (%eax),%eax
+ 74b:	0f be c0             	movsbl %al,%eax
+ 74e:	25 ff 00 00 00       	and    $0xff,%eax
+ 753:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 756:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 75a:	75 2c                	jne    788 <printf+0x6a>
+      if(c == '%'){
+ 75c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 760:	75 0c                	jne    76e <printf+0x50>
+        state = '%';
+ 762:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 769:	e9 27 01 00 00       	jmp    895 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 76e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 771:	0f be c0             	movsbl %al,%eax
+ 774:	83 ec 08             	sub    $0x8,%esp
+ 777:	50                   	push   %eax
+ 778:	ff 75 08             	push   0x8(%ebp)
+ 77b:	e8 ca fe ff ff       	call   64a <putc>
+ 780:	83 c4 10             	add    $0x10,%esp
+ 783:	e9 0d 01 00 00       	jmp    895 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 788:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 78c:	0f 85 03 01 00 00    	jne    895 <printf+0x177>
+      if(c == 'd'){
+ 792:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 796:	75 1e                	jne    7b6 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 798:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 79b:	8b 00                	mov    (%eax),%eax
+ 79d:	6a 01                	push   $0x1
+ 79f:	6a 0a                	push   $0xa
+ 7a1:	50                   	push   %eax
+ 7a2:	ff 75 08             	push   0x8(%ebp)
+ 7a5:	e8 c3 fe ff ff       	call   66d <printint>
+ 7aa:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7ad:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7b1:	e9 d8 00 00 00       	jmp    88e <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 7b6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 7ba:	74 06                	je     7c2 <printf+0xa4>
+ 7bc:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 7c0:	75 1e                	jne    7e0 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 7c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7c5:	8b 00                	mov    (%eax),%eax
+ 7c7:	6a 00                	push   $0x0
+ 7c9:	6a 10                	push   $0x10
+ 7cb:	50                   	push   %eax
+ 7cc:	ff 75 08             	push   0x8(%ebp)
+ 7cf:	e8 99 fe ff ff       	call   66d <printint>
+ 7d4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 7d7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 7db:	e9 ae 00 00 00       	jmp    88e <printf+0x170>
+      } else if(c == 's'){
+ 7e0:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 7e4:	75 43                	jne    829 <printf+0x10b>
+        s = (char*)*ap;
+ 7e6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 7e9:	8b 00                	mov    (%eax),%eax
+ 7eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 7ee:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 7f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7f6:	75 25                	jne    81d <printf+0xff>
+          s = "(null)";
+ 7f8:	c7 45 f4 77 09 00 00 	movl   $0x977,-0xc(%ebp)
+        while(*s != 0){
+ 7ff:	eb 1c                	jmp    81d <printf+0xff>
+          putc(fd, *s);
+ 801:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 804:	0f b6 00             	movzbl (%eax),%eax
+ 807:	0f be c0             	movsbl %al,%eax
+ 80a:	83 ec 08             	sub    $0x8,%esp
+ 80d:	50                   	push   %eax
+ 80e:	ff 75 08             	push   0x8(%ebp)
+ 811:	e8 34 fe ff ff       	call   64a <putc>
+ 816:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 819:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 81d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 820:	0f b6 00             	movzbl (%eax),%eax
+ 823:	84 c0                	test   %al,%al
+ 825:	75 da                	jne    801 <printf+0xe3>
+ 827:	eb 65                	jmp    88e <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 829:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 82d:	75 1d                	jne    84c <printf+0x12e>
+        putc(fd, *ap);
+ 82f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 832:	8b 00                	mov    (%eax),%eax
+ 834:	0f be c0             	movsbl %al,%eax
+ 837:	83 ec 08             	sub    $0x8,%esp
+ 83a:	50                   	push   %eax
+ 83b:	ff 75 08             	push   0x8(%ebp)
+ 83e:	e8 07 fe ff ff       	call   64a <putc>
+ 843:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 846:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 84a:	eb 42                	jmp    88e <printf+0x170>
+      } else if(c == '%'){
+ 84c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 850:	75 17                	jne    869 <printf+0x14b>
+        putc(fd, c);
+ 852:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 855:	0f be c0             	movsbl %al,%eax
+ 858:	83 ec 08             	sub    $0x8,%esp
+ 85b:	50                   	push   %eax
+ 85c:	ff 75 08             	push   0x8(%ebp)
+ 85f:	e8 e6 fd ff ff       	call   64a <putc>
+ 864:	83 c4 10             	add    $0x10,%esp
+ 867:	eb 25                	jmp    88e <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 869:	83 ec 08             	sub    $0x8,%esp
+ 86c:	6a 25                	push   $0x25
+ 86e:	ff 75 08             	push   0x8(%ebp)
+ 871:	e8 d4 fd ff ff       	call   64a <putc>
+ 876:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 879:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 87c:	0f be c0             	movsbl %al,%eax
+ 87f:	83 ec 08             	sub    $0x8,%esp
+ 882:	50                   	push   %eax
+ 883:	ff 75 08             	push   0x8(%ebp)
+ 886:	e8 bf fd ff ff       	call   64a <putc>
+ 88b:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 88e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 895:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 899:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 89c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 89f:	01 d0                	add    %edx,%eax
+ 8a1:	0f b6 00             	movzbl (%eax),%eax
+ 8a4:	84 c0                	test   %al,%al
+ 8a6:	0f 85 94 fe ff ff    	jne    740 <printf+0x22>
+    }
+  }
+}
+ 8ac:	90                   	nop
+ 8ad:	90                   	nop
+ 8ae:	c9                   	leave
+ 8af:	c3                   	ret
@@ -0,0 +1,72 @@
+// Run a command on a set of CPUs, or show or change the
+// CPUs of a running process.  Masks are in hex, one bit
+// per CPU: taskset 3 ls runs ls on CPUs 0 and 1.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static int
+hex(char *s, uint *mask)
+{
+  int d;
+
+  *mask = 0;
+  if(*s == 0)
+    return -1;
+  for(; *s; s++){
+    if(*s >= '0' && *s <= '9')
+      d = *s - '0';
+    else if(*s >= 'a' && *s <= 'f')
+      d = *s - 'a' + 10;
+    else if(*s >= 'A' && *s <= 'F')
+      d = *s - 'A' + 10;
+    else
+      return -1;
+    *mask = *mask * 16 + d;
+  }
+  return 0;
+}
+
+static void
+usage(void)
+{
+  printf(2, "usage: taskset mask command [arg...]\n");
+  printf(2, "       taskset -p pid [mask]\n");
+  exit();
+}
+
+int
+main(int argc, char **argv)
+{
+  uint mask;
+  int pid;
+
+  if(argc >= 3 && strcmp(argv[1], "-p") == 0){
+    pid = atoi(argv[2]);
+    if(argc > 3){
+      if(argc > 4 || hex(argv[3], &mask) < 0)
+        usage();
+      if(setaffinity(pid, mask) < 0){
+        printf(2, "taskset: cannot set affinity of %d\n", pid);
+        exit();
+      }
+    }
+    if((mask = getaffinity(pid)) == -1){
+      printf(2, "taskset: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d affinity %x\n", pid, mask);
+    exit();
+  }
+
+  if(argc < 3 || hex(argv[1], &mask) < 0)
+    usage();
+  if(setaffinity(getpid(), mask) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,2132 @@
+
+_threadtest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <worker>:
+static char *grown[NTHREAD];
+static int pfd[2];
+
+static void
+worker(void *arg)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int id, i;
+
+  id = (int)arg;
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < COUNT; i++)
+   c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  13:	eb 1b                	jmp    30 <worker+0x30>
+    counts[id]++;
+  15:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  18:	8b 04 85 60 15 00 00 	mov    0x1560(,%eax,4),%eax
+  1f:	8d 50 01             	lea    0x1(%eax),%edx
+  22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  25:	89 14 85 60 15 00 00 	mov    %edx,0x1560(,%eax,4)
+  for(i = 0; i < COUNT; i++)
+  2c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  30:	81 7d f4 9f 86 01 00 	cmpl   $0x1869f,-0xc(%ebp)
+  37:	7e dc                	jle    15 <worker+0x15>
+  if((grown[id] = sbrk(4096)) == (char*)-1)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	68 00 10 00 00       	push   $0x1000
+  41:	e8 11 06 00 00       	call   657 <sbrk>
+  46:	83 c4 10             	add    $0x10,%esp
+  49:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  4c:	89 04 95 70 15 00 00 	mov    %eax,0x1570(,%edx,4)
+  53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  56:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+  5d:	83 f8 ff             	cmp    $0xffffffff,%eax
+  60:	75 05                	jne    67 <worker+0x67>
+    exit();
+  62:	e8 68 05 00 00       	call   5cf <exit>
+  memset(grown[id], 'a' + id, 4096);
+  67:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  6a:	8d 50 61             	lea    0x61(%eax),%edx
+  6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  70:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+  77:	83 ec 04             	sub    $0x4,%esp
+  7a:	68 00 10 00 00       	push   $0x1000
+  7f:	52                   	push   %edx
+  80:	50                   	push   %eax
+  81:	e8 7d 03 00 00       	call   403 <memset>
+  86:	83 c4 10             	add    $0x10,%esp
+}
+  89:	90                   	nop
+  8a:	c9                   	leave
+  8b:	c3                   	ret
+
+0000008c <opener>:
+
+static void
+opener(void *arg)
+{
+  8c:	55                   	push   %ebp
+  8d:	89 e5                	mov    %esp,%ebp
+  8f:	83 ec 08             	sub    $0x8,%esp
+  if(pipe(pfd) < 0)
+  92:	83 ec 0c             	sub    $0xc,%esp
+  95:	68 80 15 00 00       	push   $0x1580
+  9a:	e8 40 05 00 00       	call   5df <pipe>
+  9f:	83 c4 10             	add    $0x10,%esp
+  a2:	85 c0                	test   %eax,%eax
+  a4:	79 14                	jns    ba <opener+0x2e>
+    pfd[0] = pfd[1] = -1;
+  a6:	c7 05 84 15 00 00 ff 	movl   $0xffffffff,0x1584
+  ad:	ff ff ff 
+  b0:	a1 84 15 00 00       	mov    0x1584,%eax
+  b5:	a3 80 15 00 00       	mov    %eax,0x1580
+}
+  ba:	90                   	nop
+  bb:	c9                   	leave
+  bc:	c3                   	ret
+
+000000bd <main>:
+
+int
+main(int argc, char *argv[])
+{
+  bd:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  c1:	83 e4 f0             	and    $0xfffffff0,%esp
+  c4:	ff 71 fc             	push   -0x4(%ecx)
+  c7:	55                   	push   %ebp
+  c8:	89 e5                	mov    %esp,%ebp
+  ca:	51                   	push   %ecx
+  cb:	83 ec 24             	sub    $0x24,%esp
+  int tid[NTHREAD], i;
+  char c;
+
+  printf(1, "threadtest\n");
+  ce:	83 ec 08             	sub    $0x8,%esp
+  d1:	68 d0 0f 00 00       	push   $0xfd0
+  d6:	6a 01                	push   $0x1
+  d8:	e8 f6 06 00 00       	call   7d3 <printf>
+  dd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NTHREAD; i++){
+  e0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  e7:	eb 41                	jmp    12a <main+0x6d>
+    if((tid[i] = thread_create(worker, (void*)i)) < 0){
+  e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  ec:	83 ec 08             	sub    $0x8,%esp
+  ef:	50                   	push   %eax
+  f0:	68 00 00 00 00       	push   $0x0
+  f5:	e8 aa 08 00 00       	call   9a4 <thread_create>
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 100:	89 44 95 e4          	mov    %eax,-0x1c(%ebp,%edx,4)
+ 104:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 107:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+ 10b:	85 c0                	test   %eax,%eax
+ 10d:	79 17                	jns    126 <main+0x69>
+      printf(1, "threadtest: thread_create failed\n");
+ 10f:	83 ec 08             	sub    $0x8,%esp
+ 112:	68 dc 0f 00 00       	push   $0xfdc
+ 117:	6a 01                	push   $0x1
+ 119:	e8 b5 06 00 00       	call   7d3 <printf>
+ 11e:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 121:	e8 a9 04 00 00       	call   5cf <exit>
+  for(i = 0; i < NTHREAD; i++){
+ 126:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 12a:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 12e:	7e b9                	jle    e9 <main+0x2c>
+    }
+  }
+  for(i = 0; i < NTHREAD; i++){
+ 130:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 137:	eb 3b                	jmp    174 <main+0xb7>
+    if(thread_join(tid[i]) != tid[i]){
+ 139:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 13c:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+ 140:	83 ec 0c             	sub    $0xc,%esp
+ 143:	50                   	push   %eax
+ 144:	e8 0c 09 00 00       	call   a55 <thread_join>
+ 149:	83 c4 10             	add    $0x10,%esp
+ 14c:	89 c2                	mov    %eax,%edx
+ 14e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 151:	8b 44 85 e4          	mov    -0x1c(%ebp,%eax,4),%eax
+ 155:	39 c2                	cmp    %eax,%edx
+ 157:	74 17                	je     170 <main+0xb3>
+      printf(1, "threadtest: thread_join failed\n");
+ 159:	83 ec 08             	sub    $0x8,%esp
+ 15c:	68 00 10 00 00       	push   $0x1000
+ 161:	6a 01                	push   $0x1
+ 163:	e8 6b 06 00 00       	call   7d3 <printf>
+ 168:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 16b:	e8 5f 04 00 00       	call   5cf <exit>
+  for(i = 0; i < NTHREAD; i++){
+ 170:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 174:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 178:	7e bf                	jle    139 <main+0x7c>
+    }
+  }
+  if(thread_join(tid[0]) != -1){
+ 17a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 17d:	83 ec 0c             	sub    $0xc,%esp
+ 180:	50                   	push   %eax
+ 181:	e8 cf 08 00 00       	call   a55 <thread_join>
+ 186:	83 c4 10             	add    $0x10,%esp
+ 189:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 18c:	74 17                	je     1a5 <main+0xe8>
+    printf(1, "threadtest: joined a thread twice\n");
+ 18e:	83 ec 08             	sub    $0x8,%esp
+ 191:	68 20 10 00 00       	push   $0x1020
+ 196:	6a 01                	push   $0x1
+ 198:	e8 36 06 00 00       	call   7d3 <printf>
+ 19d:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1a0:	e8 2a 04 00 00       	call   5cf <exit>
+  }
+  for(i = 0; i < NTHREAD; i++){
+ 1a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1ac:	e9 a7 00 00 00       	jmp    258 <main+0x19b>
+    if(counts[i] != COUNT){
+ 1b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b4:	8b 04 85 60 15 00 00 	mov    0x1560(,%eax,4),%eax
+ 1bb:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+ 1c0:	74 22                	je     1e4 <main+0x127>
+      printf(1, "threadtest: thread %d counted %d\n", i, counts[i]);
+ 1c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1c5:	8b 04 85 60 15 00 00 	mov    0x1560(,%eax,4),%eax
+ 1cc:	50                   	push   %eax
+ 1cd:	ff 75 f4             	push   -0xc(%ebp)
+ 1d0:	68 44 10 00 00       	push   $0x1044
+ 1d5:	6a 01                	push   $0x1
+ 1d7:	e8 f7 05 00 00       	call   7d3 <printf>
+ 1dc:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 1df:	e8 eb 03 00 00       	call   5cf <exit>
+    }
+    if(grown[i] == 0 || grown[i] == (char*)-1 ||
+ 1e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1e7:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+ 1ee:	85 c0                	test   %eax,%eax
+ 1f0:	74 48                	je     23a <main+0x17d>
+ 1f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1f5:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+ 1fc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 1ff:	74 39                	je     23a <main+0x17d>
+       grown[i][0] != 'a' + i || grown[i][4095] != 'a' + i){
+ 201:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 204:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+ 20b:	0f b6 00             	movzbl (%eax),%eax
+ 20e:	0f be d0             	movsbl %al,%edx
+ 211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 214:	83 c0 61             	add    $0x61,%eax
+    if(grown[i] == 0 || grown[i] == (char*)-1 ||
+ 217:	39 c2                	cmp    %eax,%edx
+ 219:	75 1f                	jne    23a <main+0x17d>
+       grown[i][0] != 'a' + i || grown[i][4095] != 'a' + i){
+ 21b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 21e:	8b 04 85 70 15 00 00 	mov    0x1570(,%eax,4),%eax
+ 225:	05 ff 0f 00 00       	add    $0xfff,%eax
+ 22a:	0f b6 00             	movzbl (%eax),%eax
+ 22d:	0f be d0             	movsbl %al,%edx
+ 230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 233:	83 c0 61             	add    $0x61,%eax
+ 236:	39 c2                	cmp    %eax,%edx
+ 238:	74 1a                	je     254 <main+0x197>
+      printf(1, "threadtest: thread %d's sbrk memory not shared\n", i);
+ 23a:	83 ec 04             	sub    $0x4,%esp
+ 23d:	ff 75 f4             	push   -0xc(%ebp)
+ 240:	68 68 10 00 00       	push   $0x1068
+ 245:	6a 01                	push   $0x1
+ 247:	e8 87 05 00 00       	call   7d3 <printf>
+ 24c:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 24f:	e8 7b 03 00 00       	call   5cf <exit>
+  for(i = 0; i < NTHREAD; i++){
+ 254:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 258:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+ 25c:	0f 8e 4f ff ff ff    	jle    1b1 <main+0xf4>
+    }
+  }
+
+  if((tid[0] = thread_create(opener, 0)) < 0 || thread_join(tid[0]) != tid[0]){
+ 262:	83 ec 08             	sub    $0x8,%esp
+ 265:	6a 00                	push   $0x0
+ 267:	68 8c 00 00 00       	push   $0x8c
+ 26c:	e8 33 07 00 00       	call   9a4 <thread_create>
+ 271:	83 c4 10             	add    $0x10,%esp
+ 274:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 277:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 27a:	85 c0                	test   %eax,%eax
+ 27c:	78 18                	js     296 <main+0x1d9>
+ 27e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 281:	83 ec 0c             	sub    $0xc,%esp
+ 284:	50                   	push   %eax
+ 285:	e8 cb 07 00 00       	call   a55 <thread_join>
+ 28a:	83 c4 10             	add    $0x10,%esp
+ 28d:	89 c2                	mov    %eax,%edx
+ 28f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 292:	39 c2                	cmp    %eax,%edx
+ 294:	74 17                	je     2ad <main+0x1f0>
+    printf(1, "threadtest: opener thread failed\n");
+ 296:	83 ec 08             	sub    $0x8,%esp
+ 299:	68 98 10 00 00       	push   $0x1098
+ 29e:	6a 01                	push   $0x1
+ 2a0:	e8 2e 05 00 00       	call   7d3 <printf>
+ 2a5:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 2a8:	e8 22 03 00 00       	call   5cf <exit>
+  }
+  if(pfd[0] < 0 || write(pfd[1], "x", 1) != 1 ||
+ 2ad:	a1 80 15 00 00       	mov    0x1580,%eax
+ 2b2:	85 c0                	test   %eax,%eax
+ 2b4:	78 41                	js     2f7 <main+0x23a>
+ 2b6:	a1 84 15 00 00       	mov    0x1584,%eax
+ 2bb:	83 ec 04             	sub    $0x4,%esp
+ 2be:	6a 01                	push   $0x1
+ 2c0:	68 ba 10 00 00       	push   $0x10ba
+ 2c5:	50                   	push   %eax
+ 2c6:	e8 24 03 00 00       	call   5ef <write>
+ 2cb:	83 c4 10             	add    $0x10,%esp
+ 2ce:	83 f8 01             	cmp    $0x1,%eax
+ 2d1:	75 24                	jne    2f7 <main+0x23a>
+     read(pfd[0], &c, 1) != 1 || c != 'x'){
+ 2d3:	a1 80 15 00 00       	mov    0x1580,%eax
+ 2d8:	83 ec 04             	sub    $0x4,%esp
+ 2db:	6a 01                	push   $0x1
+ 2dd:	8d 55 e3             	lea    -0x1d(%ebp),%edx
+ 2e0:	52                   	push   %edx
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 00 03 00 00       	call   5e7 <read>
+ 2e7:	83 c4 10             	add    $0x10,%esp
+  if(pfd[0] < 0 || write(pfd[1], "x", 1) != 1 ||
+ 2ea:	83 f8 01             	cmp    $0x1,%eax
+ 2ed:	75 08                	jne    2f7 <main+0x23a>
+     read(pfd[0], &c, 1) != 1 || c != 'x'){
+ 2ef:	0f b6 45 e3          	movzbl -0x1d(%ebp),%eax
+ 2f3:	3c 78                	cmp    $0x78,%al
+ 2f5:	74 17                	je     30e <main+0x251>
+    printf(1, "threadtest: thread's descriptors not shared\n");
+ 2f7:	83 ec 08             	sub    $0x8,%esp
+ 2fa:	68 bc 10 00 00       	push   $0x10bc
+ 2ff:	6a 01                	push   $0x1
+ 301:	e8 cd 04 00 00       	call   7d3 <printf>
+ 306:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 309:	e8 c1 02 00 00       	call   5cf <exit>
+  }
+  close(pfd[0]);
+ 30e:	a1 80 15 00 00       	mov    0x1580,%eax
+ 313:	83 ec 0c             	sub    $0xc,%esp
+ 316:	50                   	push   %eax
+ 317:	e8 db 02 00 00       	call   5f7 <close>
+ 31c:	83 c4 10             	add    $0x10,%esp
+  close(pfd[1]);
+ 31f:	a1 84 15 00 00       	mov    0x1584,%eax
+ 324:	83 ec 0c             	sub    $0xc,%esp
+ 327:	50                   	push   %eax
+ 328:	e8 ca 02 00 00       	call   5f7 <close>
+ 32d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "threadtest ok\n");
+ 330:	83 ec 08             	sub    $0x8,%esp
+ 333:	68 e9 10 00 00       	push   $0x10e9
+ 338:	6a 01                	push   $0x1
+ 33a:	e8 94 04 00 00       	call   7d3 <printf>
+ 33f:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 342:	e8 88 02 00 00       	call   5cf <exit>
+
+00000347 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 347:	55                   	push   %ebp
+ 348:	89 e5                	mov    %esp,%ebp
+ 34a:	57                   	push   %edi
+ 34b:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 34c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34f:	8b 55 10             	mov    0x10(%ebp),%edx
+ 352:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 355:	89 cb                	mov    %ecx,%ebx
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	89 d1                	mov    %edx,%ecx
+ 35b:	fc                   	cld
+ 35c:	f3 aa                	rep stos %al,%es:(%edi)
+ 35e:	89 ca                	mov    %ecx,%edx
+ 360:	89 fb                	mov    %edi,%ebx
+ 362:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 365:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 368:	90                   	nop
+ 369:	5b                   	pop    %ebx
+ 36a:	5f                   	pop    %edi
+ 36b:	5d                   	pop    %ebp
+ 36c:	c3                   	ret
+
+0000036d <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 36d:	55                   	push   %ebp
+ 36e:	89 e5                	mov    %esp,%ebp
+ 370:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 379:	90                   	nop
+ 37a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 37d:	8d 42 01             	lea    0x1(%edx),%eax
+ 380:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	8d 48 01             	lea    0x1(%eax),%ecx
+ 389:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 38c:	0f b6 12             	movzbl (%edx),%edx
+ 38f:	88 10                	mov    %dl,(%eax)
+ 391:	0f b6 00             	movzbl (%eax),%eax
+ 394:	84 c0                	test   %al,%al
+ 396:	75 e2                	jne    37a <strcpy+0xd>
+    ;
+  return os;
+ 398:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 39b:	c9                   	leave
+ 39c:	c3                   	ret
+
+0000039d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 39d:	55                   	push   %ebp
+ 39e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3a0:	eb 08                	jmp    3aa <strcmp+0xd>
+    p++, q++;
+ 3a2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3a6:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ad:	0f b6 00             	movzbl (%eax),%eax
+ 3b0:	84 c0                	test   %al,%al
+ 3b2:	74 10                	je     3c4 <strcmp+0x27>
+ 3b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b7:	0f b6 10             	movzbl (%eax),%edx
+ 3ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3bd:	0f b6 00             	movzbl (%eax),%eax
+ 3c0:	38 c2                	cmp    %al,%dl
+ 3c2:	74 de                	je     3a2 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c7:	0f b6 00             	movzbl (%eax),%eax
+ 3ca:	0f b6 d0             	movzbl %al,%edx
+ 3cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d0:	0f b6 00             	movzbl (%eax),%eax
+ 3d3:	0f b6 c0             	movzbl %al,%eax
+ 3d6:	29 c2                	sub    %eax,%edx
+ 3d8:	89 d0                	mov    %edx,%eax
+}
+ 3da:	5d                   	pop    %ebp
+ 3db:	c3                   	ret
+
+000003dc <strlen>:
+
+uint
+strlen(char *s)
+{
+ 3dc:	55                   	push   %ebp
+ 3dd:	89 e5                	mov    %esp,%ebp
+ 3df:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3e2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 3e9:	eb 04                	jmp    3ef <strlen+0x13>
+ 3eb:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 3ef:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f5:	01 d0                	add    %edx,%eax
+ 3f7:	0f b6 00             	movzbl (%eax),%eax
+ 3fa:	84 c0                	test   %al,%al
+ 3fc:	75 ed                	jne    3eb <strlen+0xf>
+    ;
+  return n;
+ 3fe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 401:	c9                   	leave
+ 402:	c3                   	ret
+
+00000403 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 403:	55                   	push   %ebp
+ 404:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 406:	8b 45 10             	mov    0x10(%ebp),%eax
+ 409:	50                   	push   %eax
+ 40a:	ff 75 0c             	push   0xc(%ebp)
+ 40d:	ff 75 08             	push   0x8(%ebp)
+ 410:	e8 32 ff ff ff       	call   347 <stosb>
+ 415:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 418:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+
+0000041d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 41d:	55                   	push   %ebp
+ 41e:	89 e5                	mov    %esp,%ebp
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 426:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 429:	eb 14                	jmp    43f <strchr+0x22>
+    if(*s == c)
+ 42b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42e:	0f b6 00             	movzbl (%eax),%eax
+ 431:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 434:	75 05                	jne    43b <strchr+0x1e>
+      return (char*)s;
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+ 439:	eb 13                	jmp    44e <strchr+0x31>
+  for(; *s; s++)
+ 43b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 43f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 442:	0f b6 00             	movzbl (%eax),%eax
+ 445:	84 c0                	test   %al,%al
+ 447:	75 e2                	jne    42b <strchr+0xe>
+  return 0;
+ 449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 44e:	c9                   	leave
+ 44f:	c3                   	ret
+
+00000450 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 456:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 45d:	eb 42                	jmp    4a1 <gets+0x51>
+    cc = read(0, &c, 1);
+ 45f:	83 ec 04             	sub    $0x4,%esp
+ 462:	6a 01                	push   $0x1
+ 464:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 467:	50                   	push   %eax
+ 468:	6a 00                	push   $0x0
+ 46a:	e8 78 01 00 00       	call   5e7 <read>
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 475:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 479:	7e 33                	jle    4ae <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 47b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 47e:	8d 50 01             	lea    0x1(%eax),%edx
+ 481:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 484:	89 c2                	mov    %eax,%edx
+ 486:	8b 45 08             	mov    0x8(%ebp),%eax
+ 489:	01 c2                	add    %eax,%edx
+ 48b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 48f:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 491:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 495:	3c 0a                	cmp    $0xa,%al
+ 497:	74 16                	je     4af <gets+0x5f>
+ 499:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 49d:	3c 0d                	cmp    $0xd,%al
+ 49f:	74 0e                	je     4af <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a4:	83 c0 01             	add    $0x1,%eax
+ 4a7:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4aa:	7f b3                	jg     45f <gets+0xf>
+ 4ac:	eb 01                	jmp    4af <gets+0x5f>
+      break;
+ 4ae:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 4af:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b5:	01 d0                	add    %edx,%eax
+ 4b7:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4ba:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4bd:	c9                   	leave
+ 4be:	c3                   	ret
+
+000004bf <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 4bf:	55                   	push   %ebp
+ 4c0:	89 e5                	mov    %esp,%ebp
+ 4c2:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 3d 01 00 00       	call   60f <open>
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 4d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4dc:	79 07                	jns    4e5 <stat+0x26>
+    return -1;
+ 4de:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4e3:	eb 25                	jmp    50a <stat+0x4b>
+  r = fstat(fd, st);
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	ff 75 0c             	push   0xc(%ebp)
+ 4eb:	ff 75 f4             	push   -0xc(%ebp)
+ 4ee:	e8 34 01 00 00       	call   627 <fstat>
+ 4f3:	83 c4 10             	add    $0x10,%esp
+ 4f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 4f9:	83 ec 0c             	sub    $0xc,%esp
+ 4fc:	ff 75 f4             	push   -0xc(%ebp)
+ 4ff:	e8 f3 00 00 00       	call   5f7 <close>
+ 504:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 507:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 50a:	c9                   	leave
+ 50b:	c3                   	ret
+
+0000050c <atoi>:
+
+int
+atoi(const char *s)
+{
+ 50c:	55                   	push   %ebp
+ 50d:	89 e5                	mov    %esp,%ebp
+ 50f:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 512:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 519:	eb 25                	jmp    540 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 51b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 51e:	89 d0                	mov    %edx,%eax
+ 520:	c1 e0 02             	shl    $0x2,%eax
+ 523:	01 d0                	add    %edx,%eax
+ 525:	01 c0                	add    %eax,%eax
+ 527:	89 c1                	mov    %eax,%ecx
+ 529:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52c:	8d 50 01             	lea    0x1(%eax),%edx
+ 52f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 532:	0f b6 00             	movzbl (%eax),%eax
+ 535:	0f be c0             	movsbl %al,%eax
+ 538:	01 c8                	add    %ecx,%eax
+ 53a:	83 e8 30             	sub    $0x30,%eax
+ 53d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 540:	8b 45 08             	mov    0x8(%ebp),%eax
+ 543:	0f b6 00             	movzbl (%eax),%eax
+ 546:	3c 2f                	cmp    $0x2f,%al
+ 548:	7e 0a                	jle    554 <atoi+0x48>
+ 54a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54d:	0f b6 00             	movzbl (%eax),%eax
+ 550:	3c 39                	cmp    $0x39,%al
+ 552:	7e c7                	jle    51b <atoi+0xf>
+  return n;
+ 554:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 557:	c9                   	leave
+ 558:	c3                   	ret
+
+00000559 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 559:	55                   	push   %ebp
+ 55a:	89 e5                	mov    %esp,%ebp
+ 55c:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 55f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 562:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 565:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 568:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 56b:	eb 17                	jmp    584 <memmove+0x2b>
+    *dst++ = *src++;
+ 56d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 570:	8d 42 01             	lea    0x1(%edx),%eax
+ 573:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 576:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 579:	8d 48 01             	lea    0x1(%eax),%ecx
+ 57c:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 57f:	0f b6 12             	movzbl (%edx),%edx
+ 582:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 584:	8b 45 10             	mov    0x10(%ebp),%eax
+ 587:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 58a:	89 55 10             	mov    %edx,0x10(%ebp)
+ 58d:	85 c0                	test   %eax,%eax
+ 58f:	7f dc                	jg     56d <memmove+0x14>
+  return vdst;
+ 591:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 594:	c9                   	leave
+ 595:	c3                   	ret
+
+00000596 <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 596:	55                   	push   %ebp
+ 597:	89 e5                	mov    %esp,%ebp
+ 599:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 59c:	83 ec 0c             	sub    $0xc,%esp
+ 59f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 5a2:	50                   	push   %eax
+ 5a3:	e8 ff 00 00 00       	call   6a7 <nanouptime>
+ 5a8:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 5ab:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 5ae:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 5b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5b7:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 5bc:	f7 e2                	mul    %edx
+ 5be:	89 d0                	mov    %edx,%eax
+ 5c0:	c1 e8 06             	shr    $0x6,%eax
+ 5c3:	01 c8                	add    %ecx,%eax
+}
+ 5c5:	c9                   	leave
+ 5c6:	c3                   	ret
+
+000005c7 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5cc:	cd 40                	int    $0x40
+ 5ce:	c3                   	ret
+
+000005cf <exit>:
+SYSCALL(exit)
+ 5cf:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d4:	cd 40                	int    $0x40
+ 5d6:	c3                   	ret
+
+000005d7 <wait>:
+SYSCALL(wait)
+ 5d7:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5dc:	cd 40                	int    $0x40
+ 5de:	c3                   	ret
+
+000005df <pipe>:
+SYSCALL(pipe)
+ 5df:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <read>:
+SYSCALL(read)
+ 5e7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5ec:	cd 40                	int    $0x40
+ 5ee:	c3                   	ret
+
+000005ef <write>:
+SYSCALL(write)
+ 5ef:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5f4:	cd 40                	int    $0x40
+ 5f6:	c3                   	ret
+
+000005f7 <close>:
+SYSCALL(close)
+ 5f7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5fc:	cd 40                	int    $0x40
+ 5fe:	c3                   	ret
+
+000005ff <kill>:
+SYSCALL(kill)
+ 5ff:	b8 06 00 00 00       	mov    $0x6,%eax
+ 604:	cd 40                	int    $0x40
+ 606:	c3                   	ret
+
+00000607 <exec>:
+SYSCALL(exec)
+ 607:	b8 07 00 00 00       	mov    $0x7,%eax
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <open>:
+SYSCALL(open)
+ 60f:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 614:	cd 40                	int    $0x40
+ 616:	c3                   	ret
+
+00000617 <mknod>:
+SYSCALL(mknod)
+ 617:	b8 11 00 00 00       	mov    $0x11,%eax
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <unlink>:
+SYSCALL(unlink)
+ 61f:	b8 12 00 00 00       	mov    $0x12,%eax
+ 624:	cd 40                	int    $0x40
+ 626:	c3                   	ret
+
+00000627 <fstat>:
+SYSCALL(fstat)
+ 627:	b8 08 00 00 00       	mov    $0x8,%eax
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <link>:
+SYSCALL(link)
+ 62f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <mkdir>:
+SYSCALL(mkdir)
+ 637:	b8 14 00 00 00       	mov    $0x14,%eax
+ 63c:	cd 40                	int    $0x40
+ 63e:	c3                   	ret
+
+0000063f <chdir>:
+SYSCALL(chdir)
+ 63f:	b8 09 00 00 00       	mov    $0x9,%eax
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <dup>:
+SYSCALL(dup)
+ 647:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <getpid>:
+SYSCALL(getpid)
+ 64f:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <sbrk>:
+SYSCALL(sbrk)
+ 657:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 65c:	cd 40                	int    $0x40
+ 65e:	c3                   	ret
+
+0000065f <sleep>:
+SYSCALL(sleep)
+ 65f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <uptime>:
+SYSCALL(uptime)
+ 667:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 66c:	cd 40                	int    $0x40
+ 66e:	c3                   	ret
+
+0000066f <saveProc>:
+SYSCALL(saveProc)
+ 66f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <loadProc>:
+SYSCALL(loadProc)
+ 677:	b8 17 00 00 00       	mov    $0x17,%eax
+ 67c:	cd 40                	int    $0x40
+ 67e:	c3                   	ret
+
+0000067f <setpriority>:
+SYSCALL(setpriority)
+ 67f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <setaffinity>:
+SYSCALL(setaffinity)
+ 687:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 68c:	cd 40                	int    $0x40
+ 68e:	c3                   	ret
+
+0000068f <getaffinity>:
+SYSCALL(getaffinity)
+ 68f:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <nanosleep>:
+SYSCALL(nanosleep)
+ 697:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <cpustat>:
+SYSCALL(cpustat)
+ 69f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <nanouptime>:
+SYSCALL(nanouptime)
+ 6a7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <settickets>:
+SYSCALL(settickets)
+ 6af:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <setdeadline>:
+SYSCALL(setdeadline)
+ 6b7:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <rtstat>:
+SYSCALL(rtstat)
+ 6bf:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <schedstat>:
+SYSCALL(schedstat)
+ 6c7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <waitpid>:
+SYSCALL(waitpid)
+ 6cf:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6d4:	cd 40                	int    $0x40
+ 6d6:	c3                   	ret
+
+000006d7 <clone>:
+SYSCALL(clone)
+ 6d7:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <futexwait>:
+SYSCALL(futexwait)
+ 6df:	b8 25 00 00 00       	mov    $0x25,%eax
+ 6e4:	cd 40                	int    $0x40
+ 6e6:	c3                   	ret
+
+000006e7 <futexwake>:
+SYSCALL(futexwake)
+ 6e7:	b8 26 00 00 00       	mov    $0x26,%eax
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <lockstat>:
+SYSCALL(lockstat)
+ 6ef:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6f4:	cd 40                	int    $0x40
+ 6f6:	c3                   	ret
+
+000006f7 <dcachestat>:
+SYSCALL(dcachestat)
+ 6f7:	b8 28 00 00 00       	mov    $0x28,%eax
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 6ff:	55                   	push   %ebp
+ 700:	89 e5                	mov    %esp,%ebp
+ 702:	83 ec 18             	sub    $0x18,%esp
+ 705:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 708:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 70b:	83 ec 04             	sub    $0x4,%esp
+ 70e:	6a 01                	push   $0x1
+ 710:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 713:	50                   	push   %eax
+ 714:	ff 75 08             	push   0x8(%ebp)
+ 717:	e8 d3 fe ff ff       	call   5ef <write>
+ 71c:	83 c4 10             	add    $0x10,%esp
+}
+ 71f:	90                   	nop
+ 720:	c9                   	leave
+ 721:	c3                   	ret
+
+00000722 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 722:	55                   	push   %ebp
+ 723:	89 e5                	mov    %esp,%ebp
+ 725:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 728:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 72f:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 733:	74 17                	je     74c <printint+0x2a>
+ 735:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 739:	79 11                	jns    74c <printint+0x2a>
+    neg = 1;
+ 73b:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 742:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 745:	f7 d8                	neg    %eax
+ 747:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 74a:	eb 06                	jmp    752 <printint+0x30>
+  } else {
+    x = xx;
+ 74c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 74f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 752:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 759:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 75c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 75f:	ba 00 00 00 00       	mov    $0x0,%edx
+ 764:	f7 f1                	div    %ecx
+ 766:	89 d1                	mov    %edx,%ecx
+ 768:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76b:	8d 50 01             	lea    0x1(%eax),%edx
+ 76e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 771:	0f b6 91 40 15 00 00 	movzbl 0x1540(%ecx),%edx
+ 778:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 77c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 77f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 782:	ba 00 00 00 00       	mov    $0x0,%edx
+ 787:	f7 f1                	div    %ecx
+ 789:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 78c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 790:	75 c7                	jne    759 <printint+0x37>
+  if(neg)
+ 792:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 796:	74 2d                	je     7c5 <printint+0xa3>
+    buf[i++] = '-';
+ 798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 79b:	8d 50 01             	lea    0x1(%eax),%edx
+ 79e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7a1:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 7a6:	eb 1d                	jmp    7c5 <printint+0xa3>
+    putc(fd, buf[i]);
+ 7a8:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 7ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ae:	01 d0                	add    %edx,%eax
+ 7b0:	0f b6 00             	movzbl (%eax),%eax
+ 7b3:	0f be c0             	movsbl %al,%eax
+ 7b6:	83 ec 08             	sub    $0x8,%esp
+ 7b9:	50                   	push   %eax
+ 7ba:	ff 75 08             	push   0x8(%ebp)
+ 7bd:	e8 3d ff ff ff       	call   6ff <putc>
+ 7c2:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 7c5:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 7c9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7cd:	79 d9                	jns    7a8 <printint+0x86>
+}
+ 7cf:	90                   	nop
+ 7d0:	90                   	nop
+ 7d1:	c9                   	leave
+ 7d2:	c3                   	ret
+
+000007d3 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 7d3:	55                   	push   %ebp
+ 7d4:	89 e5                	mov    %esp,%ebp
+ 7d6:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 7d9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 7e0:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 7e3:	83 c0 04             	add    $0x4,%eax
+ 7e6:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7e9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 7f0:	e9 59 01 00 00       	jmp    94e <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 7f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7f8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7fb:	01 d0                	add    %edx,%eax
+ 7fd:	0f b6 00             	movzbl (%eax),%eax
+ 800:	0f be c0             	movsbl %al,%eax
+ 803:	25 ff 00 00 00       	and    $0xff,%eax
+ 808:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 80b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 80f:	75 2c                	jne    83d <printf+0x6a>
+      if(c == '%'){
+ 811:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 815:	75 0c                	jne    823 <printf+0x50>
+        state = '%';
+ 817:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 81e:	e9 27 01 00 00       	jmp    94a <printf+0x177>
+      } else {
+        putc(fd, c);
+ 823:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 826:	0f be c0             	movsbl %al,%eax
+ 829:	83 ec 08             	sub    $0x8,%esp
+ 82c:	50                   	push   %eax
+ 82d:	ff 75 08             	push   0x8(%ebp)
+ 830:	e8 ca fe ff ff       	call   6ff <putc>
+ 835:	83 c4 10             	add    $0x10,%esp
+ 838:	e9 0d 01 00 00       	jmp    94a <printf+0x177>
+      }
+    } else if(state == '%'){
+ 83d:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 841:	0f 85 03 01 00 00    	jne    94a <printf+0x177>
+      if(c == 'd'){
+ 847:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 84b:	75 1e                	jne    86b <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 84d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 850:	8b 00                	mov    (%eax),%eax
+ 852:	6a 01                	push   $0x1
+ 854:	6a 0a                	push   $0xa
+ 856:	50                   	push   %eax
+ 857:	ff 75 08             	push   0x8(%ebp)
+ 85a:	e8 c3 fe ff ff       	call   722 <printint>
+ 85f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 862:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 866:	e9 d8 00 00 00       	jmp    943 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 86b:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 86f:	74 06                	je     877 <printf+0xa4>
+ 871:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 875:	75 1e                	jne    895 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 877:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 87a:	8b 00                	mov    (%eax),%eax
+ 87c:	6a 00                	push   $0x0
+ 87e:	6a 10                	push   $0x10
+ 880:	50                   	push   %eax
+ 881:	ff 75 08             	push   0x8(%ebp)
+ 884:	e8 99 fe ff ff       	call   722 <printint>
+ 889:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 88c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 890:	e9 ae 00 00 00       	jmp    943 <printf+0x170>
+      } else if(c == 's'){
+ 895:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 899:	75 43                	jne    8de <printf+0x10b>
+        s = (char*)*ap;
+ 89b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 89e:	8b 00                	mov    (%eax),%eax
+ 8a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 8a3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 8a7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8ab:	75 25                	jne    8d2 <printf+0xff>
+          s = "(null)";
+ 8ad:	c7 45 f4 f8 10 00 00 	movl   $0x10f8,-0xc(%ebp)
+        while(*s != 0){
+ 8b4:	eb 1c                	jmp    8d2 <printf+0xff>
+          putc(fd, *s);
+ 8b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8b9:	0f b6 00             	movzbl (%eax),%eax
+ 8bc:	0f be c0             	movsbl %al,%eax
+ 8bf:	83 ec 08             	sub    $0x8,%esp
+ 8c2:	50                   	push   %eax
+ 8c3:	ff 75 08             	push   0x8(%ebp)
+ 8c6:	e8 34 fe ff ff       	call   6ff <putc>
+ 8cb:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 8ce:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 8d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8d5:	0f b6 00             	movzbl (%eax),%eax
+ 8d8:	84 c0                	test   %al,%al
+ 8da:	75 da                	jne    8b6 <printf+0xe3>
+ 8dc:	eb 65                	jmp    943 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 8de:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 8e2:	75 1d                	jne    901 <printf+0x12e>
+        putc(fd, *ap);
+ 8e4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8e7:	8b 00                	mov    (%eax),%eax
+ 8e9:	0f be c0             	movsbl %al,%eax
+ 8ec:	83 ec 08             	sub    $0x8,%esp
+ 8ef:	50                   	push   %eax
+ 8f0:	ff 75 08             	push   0x8(%ebp)
+ 8f3:	e8 07 fe ff ff       	call   6ff <putc>
+ 8f8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8fb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8ff:	eb 42                	jmp    943 <printf+0x170>
+      } else if(c == '%'){
+ 901:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 905:	75 17                	jne    91e <printf+0x14b>
+        putc(fd, c);
+ 907:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 90a:	0f be c0             	movsbl %al,%eax
+ 90d:	83 ec 08             	sub    $0x8,%esp
+ 910:	50                   	push   %eax
+ 911:	ff 75 08             	push   0x8(%ebp)
+ 914:	e8 e6 fd ff ff       	call   6ff <putc>
+ 919:	83 c4 10             	add    $0x10,%esp
+ 91c:	eb 25                	jmp    943 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 91e:	83 ec 08             	sub    $0x8,%esp
+ 921:	6a 25                	push   $0x25
+ 923:	ff 75 08             	push   0x8(%ebp)
+ 926:	e8 d4 fd ff ff       	call   6ff <putc>
+ 92b:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 92e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 931:	0f be c0             	movsbl %al,%eax
+ 934:	83 ec 08             	sub    $0x8,%esp
+ 937:	50                   	push   %eax
+ 938:	ff 75 08             	push   0x8(%ebp)
+ 93b:	e8 bf fd ff ff       	call   6ff <putc>
+ 940:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 943:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 94a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 94e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 951:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 954:	01 d0                	add    %edx,%eax
+ 956:	0f b6 00             	movzbl (%eax),%eax
+ 959:	84 c0                	test   %al,%al
+ 95b:	0f 85 94 fe ff ff    	jne    7f5 <printf+0x22>
+    }
+  }
+}
+ 961:	90                   	nop
+ 962:	90                   	nop
+ 963:	c9                   	leave
+ 964:	c3                   	ret
+
+00000965 <xchg>:
+  return t;
+}
+
+static inline uint
+xchg(volatile uint *addr, uint newval)
+{
+ 965:	55                   	push   %ebp
+ 966:	89 e5                	mov    %esp,%ebp
+ 968:	83 ec 10             	sub    $0x10,%esp
+  uint result;
+  
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 96b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 96e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 971:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 974:	f0 87 02             	lock xchg %eax,(%edx)
+ 977:	89 45 fc             	mov    %eax,-0x4(%ebp)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+ 97a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 97d:	c9                   	leave
+ 97e:	c3                   	ret
+
+0000097f <threadstart>:
+  void *stack;
+} threads[NTHREAD];
+
+static void
+threadstart(void *a)
+{
+ 97f:	55                   	push   %ebp
+ 980:	89 e5                	mov    %esp,%ebp
+ 982:	83 ec 18             	sub    $0x18,%esp
+  struct tstart *t;
+
+  t = a;
+ 985:	8b 45 08             	mov    0x8(%ebp),%eax
+ 988:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t->fn(t->arg);
+ 98b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98e:	8b 00                	mov    (%eax),%eax
+ 990:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 993:	8b 52 04             	mov    0x4(%edx),%edx
+ 996:	83 ec 0c             	sub    $0xc,%esp
+ 999:	52                   	push   %edx
+ 99a:	ff d0                	call   *%eax
+ 99c:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 99f:	e8 2b fc ff ff       	call   5cf <exit>
+
+000009a4 <thread_create>:
+}
+
+// Start fn(arg) in a new thread and return its id, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9a4:	55                   	push   %ebp
+ 9a5:	89 e5                	mov    %esp,%ebp
+ 9a7:	83 ec 18             	sub    $0x18,%esp
+  struct tstart *t;
+  int i, tid;
+
+  for(i = 0; i < NTHREAD && threads[i].stack; i++)
+ 9aa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 9b1:	eb 04                	jmp    9b7 <thread_create+0x13>
+ 9b3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 9b7:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ 9bb:	7f 0e                	jg     9cb <thread_create+0x27>
+ 9bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c0:	8b 04 c5 a4 15 00 00 	mov    0x15a4(,%eax,8),%eax
+ 9c7:	85 c0                	test   %eax,%eax
+ 9c9:	75 e8                	jne    9b3 <thread_create+0xf>
+    ;
+  if(i == NTHREAD || (t = malloc(TSTACK)) == 0)
+ 9cb:	83 7d f4 40          	cmpl   $0x40,-0xc(%ebp)
+ 9cf:	74 19                	je     9ea <thread_create+0x46>
+ 9d1:	83 ec 0c             	sub    $0xc,%esp
+ 9d4:	68 00 10 00 00       	push   $0x1000
+ 9d9:	e8 15 05 00 00       	call   ef3 <malloc>
+ 9de:	83 c4 10             	add    $0x10,%esp
+ 9e1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 9e4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9e8:	75 07                	jne    9f1 <thread_create+0x4d>
+    return -1;
+ 9ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 9ef:	eb 62                	jmp    a53 <thread_create+0xaf>
+  t->fn = fn;
+ 9f1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 9f7:	89 10                	mov    %edx,(%eax)
+  t->arg = arg;
+ 9f9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9ff:	89 50 04             	mov    %edx,0x4(%eax)
+  if((tid = clone(threadstart, t, t)) < 0){
+ a02:	83 ec 04             	sub    $0x4,%esp
+ a05:	ff 75 f0             	push   -0x10(%ebp)
+ a08:	ff 75 f0             	push   -0x10(%ebp)
+ a0b:	68 7f 09 00 00       	push   $0x97f
+ a10:	e8 c2 fc ff ff       	call   6d7 <clone>
+ a15:	83 c4 10             	add    $0x10,%esp
+ a18:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a1b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a1f:	79 15                	jns    a36 <thread_create+0x92>
+    free(t);
+ a21:	83 ec 0c             	sub    $0xc,%esp
+ a24:	ff 75 f0             	push   -0x10(%ebp)
+ a27:	e8 72 04 00 00       	call   e9e <free>
+ a2c:	83 c4 10             	add    $0x10,%esp
+    return -1;
+ a2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a34:	eb 1d                	jmp    a53 <thread_create+0xaf>
+  }
+  threads[i].tid = tid;
+ a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a39:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ a3c:	89 14 c5 a0 15 00 00 	mov    %edx,0x15a0(,%eax,8)
+  threads[i].stack = t;
+ a43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a46:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ a49:	89 14 c5 a4 15 00 00 	mov    %edx,0x15a4(,%eax,8)
+  return tid;
+ a50:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ a53:	c9                   	leave
+ a54:	c3                   	ret
+
+00000a55 <thread_join>:
+
+// Wait for thread tid to finish and free its stack.
+// Return tid, or -1 if it is not a thread we created.
+int
+thread_join(int tid)
+{
+ a55:	55                   	push   %ebp
+ a56:	89 e5                	mov    %esp,%ebp
+ a58:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < NTHREAD; i++){
+ a5b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ a62:	eb 66                	jmp    aca <thread_join+0x75>
+    if(threads[i].stack && threads[i].tid == tid){
+ a64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a67:	8b 04 c5 a4 15 00 00 	mov    0x15a4(,%eax,8),%eax
+ a6e:	85 c0                	test   %eax,%eax
+ a70:	74 54                	je     ac6 <thread_join+0x71>
+ a72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a75:	8b 04 c5 a0 15 00 00 	mov    0x15a0(,%eax,8),%eax
+ a7c:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a7f:	75 45                	jne    ac6 <thread_join+0x71>
+      if(waitpid(tid, 0) != tid)
+ a81:	83 ec 08             	sub    $0x8,%esp
+ a84:	6a 00                	push   $0x0
+ a86:	ff 75 08             	push   0x8(%ebp)
+ a89:	e8 41 fc ff ff       	call   6cf <waitpid>
+ a8e:	83 c4 10             	add    $0x10,%esp
+ a91:	39 45 08             	cmp    %eax,0x8(%ebp)
+ a94:	74 07                	je     a9d <thread_join+0x48>
+        return -1;
+ a96:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a9b:	eb 38                	jmp    ad5 <thread_join+0x80>
+      free(threads[i].stack);
+ a9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa0:	8b 04 c5 a4 15 00 00 	mov    0x15a4(,%eax,8),%eax
+ aa7:	83 ec 0c             	sub    $0xc,%esp
+ aaa:	50                   	push   %eax
+ aab:	e8 ee 03 00 00       	call   e9e <free>
+ ab0:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ ab3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ab6:	c7 04 c5 a4 15 00 00 	movl   $0x0,0x15a4(,%eax,8)
+ abd:	00 00 00 00 
+      return tid;
+ ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac4:	eb 0f                	jmp    ad5 <thread_join+0x80>
+  for(i = 0; i < NTHREAD; i++){
+ ac6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ aca:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%ebp)
+ ace:	7e 94                	jle    a64 <thread_join+0xf>
+    }
+  }
+  return -1;
+ ad0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ ad5:	c9                   	leave
+ ad6:	c3                   	ret
+
+00000ad7 <mutex_init>:
+// Mutexes and condition variables on futexes.  Neither
+// enters the kernel unless a thread has to wait.
+
+void
+mutex_init(struct mutex *m)
+{
+ ad7:	55                   	push   %ebp
+ ad8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ ada:	8b 45 08             	mov    0x8(%ebp),%eax
+ add:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ ae3:	90                   	nop
+ ae4:	5d                   	pop    %ebp
+ ae5:	c3                   	ret
+
+00000ae6 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ ae6:	55                   	push   %ebp
+ ae7:	89 e5                	mov    %esp,%ebp
+ ae9:	83 ec 18             	sub    $0x18,%esp
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+ aec:	8b 55 08             	mov    0x8(%ebp),%edx
+ aef:	b8 00 00 00 00       	mov    $0x0,%eax
+ af4:	b9 01 00 00 00       	mov    $0x1,%ecx
+ af9:	f0 0f b1 0a          	lock cmpxchg %ecx,(%edx)
+ afd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ b00:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b04:	74 46                	je     b4c <mutex_lock+0x66>
+    return;
+  // Mark the mutex contended, so the holder's unlock wakes us.
+  if(c != 2)
+ b06:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ b0a:	74 38                	je     b44 <mutex_lock+0x5e>
+    c = xchg(&m->state, 2);
+ b0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b0f:	6a 02                	push   $0x2
+ b11:	50                   	push   %eax
+ b12:	e8 4e fe ff ff       	call   965 <xchg>
+ b17:	83 c4 08             	add    $0x8,%esp
+ b1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b1d:	eb 25                	jmp    b44 <mutex_lock+0x5e>
+    futexwait(&m->state, 2);
+ b1f:	8b 45 08             	mov    0x8(%ebp),%eax
+ b22:	83 ec 08             	sub    $0x8,%esp
+ b25:	6a 02                	push   $0x2
+ b27:	50                   	push   %eax
+ b28:	e8 b2 fb ff ff       	call   6df <futexwait>
+ b2d:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ b30:	8b 45 08             	mov    0x8(%ebp),%eax
+ b33:	83 ec 08             	sub    $0x8,%esp
+ b36:	6a 02                	push   $0x2
+ b38:	50                   	push   %eax
+ b39:	e8 27 fe ff ff       	call   965 <xchg>
+ b3e:	83 c4 10             	add    $0x10,%esp
+ b41:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ b44:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b48:	75 d5                	jne    b1f <mutex_lock+0x39>
+ b4a:	eb 01                	jmp    b4d <mutex_lock+0x67>
+    return;
+ b4c:	90                   	nop
+  }
+}
+ b4d:	c9                   	leave
+ b4e:	c3                   	ret
+
+00000b4f <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ b4f:	55                   	push   %ebp
+ b50:	89 e5                	mov    %esp,%ebp
+ b52:	83 ec 08             	sub    $0x8,%esp
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+ b55:	8b 45 08             	mov    0x8(%ebp),%eax
+ b58:	ba 01 00 00 00       	mov    $0x1,%edx
+ b5d:	f7 da                	neg    %edx
+ b5f:	f0 0f c1 10          	lock xadd %edx,(%eax)
+ b63:	83 fa 01             	cmp    $0x1,%edx
+ b66:	74 1a                	je     b82 <mutex_unlock+0x33>
+    m->state = 0;
+ b68:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futexwake(&m->state, 1);
+ b71:	8b 45 08             	mov    0x8(%ebp),%eax
+ b74:	83 ec 08             	sub    $0x8,%esp
+ b77:	6a 01                	push   $0x1
+ b79:	50                   	push   %eax
+ b7a:	e8 68 fb ff ff       	call   6e7 <futexwake>
+ b7f:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ b82:	90                   	nop
+ b83:	c9                   	leave
+ b84:	c3                   	ret
+
+00000b85 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ b85:	55                   	push   %ebp
+ b86:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ b88:	8b 45 08             	mov    0x8(%ebp),%eax
+ b8b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ b91:	90                   	nop
+ b92:	5d                   	pop    %ebp
+ b93:	c3                   	ret
+
+00000b94 <cond_wait>:
+
+// Release m and wait for a signal, then take m again.
+// Like any condition variable, it may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ b94:	55                   	push   %ebp
+ b95:	89 e5                	mov    %esp,%ebp
+ b97:	83 ec 18             	sub    $0x18,%esp
+  uint seq;
+
+  seq = c->seq;
+ b9a:	8b 45 08             	mov    0x8(%ebp),%eax
+ b9d:	8b 00                	mov    (%eax),%eax
+ b9f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ ba2:	83 ec 0c             	sub    $0xc,%esp
+ ba5:	ff 75 0c             	push   0xc(%ebp)
+ ba8:	e8 a2 ff ff ff       	call   b4f <mutex_unlock>
+ bad:	83 c4 10             	add    $0x10,%esp
+  futexwait(&c->seq, seq);
+ bb0:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb3:	83 ec 08             	sub    $0x8,%esp
+ bb6:	ff 75 f4             	push   -0xc(%ebp)
+ bb9:	50                   	push   %eax
+ bba:	e8 20 fb ff ff       	call   6df <futexwait>
+ bbf:	83 c4 10             	add    $0x10,%esp
+  // Others may be waiting on m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+ bc2:	eb 11                	jmp    bd5 <cond_wait+0x41>
+    futexwait(&m->state, 2);
+ bc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ bc7:	83 ec 08             	sub    $0x8,%esp
+ bca:	6a 02                	push   $0x2
+ bcc:	50                   	push   %eax
+ bcd:	e8 0d fb ff ff       	call   6df <futexwait>
+ bd2:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ bd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ bd8:	83 ec 08             	sub    $0x8,%esp
+ bdb:	6a 02                	push   $0x2
+ bdd:	50                   	push   %eax
+ bde:	e8 82 fd ff ff       	call   965 <xchg>
+ be3:	83 c4 10             	add    $0x10,%esp
+ be6:	85 c0                	test   %eax,%eax
+ be8:	75 da                	jne    bc4 <cond_wait+0x30>
+}
+ bea:	90                   	nop
+ beb:	90                   	nop
+ bec:	c9                   	leave
+ bed:	c3                   	ret
+
+00000bee <cond_signal>:
+
+void
+cond_signal(struct cond *c)
+{
+ bee:	55                   	push   %ebp
+ bef:	89 e5                	mov    %esp,%ebp
+ bf1:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+ bf7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futexwake(&c->seq, 1);
+ bfb:	8b 45 08             	mov    0x8(%ebp),%eax
+ bfe:	83 ec 08             	sub    $0x8,%esp
+ c01:	6a 01                	push   $0x1
+ c03:	50                   	push   %eax
+ c04:	e8 de fa ff ff       	call   6e7 <futexwake>
+ c09:	83 c4 10             	add    $0x10,%esp
+}
+ c0c:	90                   	nop
+ c0d:	c9                   	leave
+ c0e:	c3                   	ret
+
+00000c0f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ c0f:	55                   	push   %ebp
+ c10:	89 e5                	mov    %esp,%ebp
+ c12:	83 ec 08             	sub    $0x8,%esp
+  __sync_fetch_and_add(&c->seq, 1);
+ c15:	8b 45 08             	mov    0x8(%ebp),%eax
+ c18:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futexwake(&c->seq, -1);
+ c1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c1f:	83 ec 08             	sub    $0x8,%esp
+ c22:	6a ff                	push   $0xffffffff
+ c24:	50                   	push   %eax
+ c25:	e8 bd fa ff ff       	call   6e7 <futexwake>
+ c2a:	83 c4 10             	add    $0x10,%esp
+}
+ c2d:	90                   	nop
+ c2e:	c9                   	leave
+ c2f:	c3                   	ret
+
+00000c30 <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+ c36:	8b 15 c8 17 00 00    	mov    0x17c8,%edx
+ c3c:	a1 c4 17 00 00       	mov    0x17c4,%eax
+ c41:	29 c2                	sub    %eax,%edx
+ c43:	89 d0                	mov    %edx,%eax
+ c45:	3b 45 08             	cmp    0x8(%ebp),%eax
+ c48:	0f 83 ed 00 00 00    	jae    d3b <carve+0x10b>
+    n = size > growsz ? size : growsz;
+ c4e:	a1 54 15 00 00       	mov    0x1554,%eax
+ c53:	8b 55 08             	mov    0x8(%ebp),%edx
+ c56:	39 c2                	cmp    %eax,%edx
+ c58:	0f 43 c2             	cmovae %edx,%eax
+ c5b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+ c5e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c61:	05 ff 0f 00 00       	add    $0xfff,%eax
+ c66:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ c6b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+ c6e:	a1 54 15 00 00       	mov    0x1554,%eax
+ c73:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+ c78:	77 0c                	ja     c86 <carve+0x56>
+      growsz *= 2;
+ c7a:	a1 54 15 00 00       	mov    0x1554,%eax
+ c7f:	01 c0                	add    %eax,%eax
+ c81:	a3 54 15 00 00       	mov    %eax,0x1554
+    p = sbrk(n);
+ c86:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c89:	83 ec 0c             	sub    $0xc,%esp
+ c8c:	50                   	push   %eax
+ c8d:	e8 c5 f9 ff ff       	call   657 <sbrk>
+ c92:	83 c4 10             	add    $0x10,%esp
+ c95:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+ c98:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c9c:	75 2a                	jne    cc8 <carve+0x98>
+ c9e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca1:	39 45 08             	cmp    %eax,0x8(%ebp)
+ ca4:	73 22                	jae    cc8 <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+ ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ca9:	05 ff 0f 00 00       	add    $0xfff,%eax
+ cae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ cb3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+ cb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cb9:	83 ec 0c             	sub    $0xc,%esp
+ cbc:	50                   	push   %eax
+ cbd:	e8 95 f9 ff ff       	call   657 <sbrk>
+ cc2:	83 c4 10             	add    $0x10,%esp
+ cc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+ cc8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ ccc:	75 0a                	jne    cd8 <carve+0xa8>
+      return 0;
+ cce:	b8 00 00 00 00       	mov    $0x0,%eax
+ cd3:	e9 86 00 00 00       	jmp    d5e <carve+0x12e>
+    if(p != limit){
+ cd8:	a1 c8 17 00 00       	mov    0x17c8,%eax
+ cdd:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ce0:	74 4c                	je     d2e <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+ ce2:	8b 15 c8 17 00 00    	mov    0x17c8,%edx
+ ce8:	a1 c4 17 00 00       	mov    0x17c4,%eax
+ ced:	29 c2                	sub    %eax,%edx
+ cef:	83 fa 0f             	cmp    $0xf,%edx
+ cf2:	7e 32                	jle    d26 <carve+0xf6>
+        b = (Block*)top;
+ cf4:	a1 c4 17 00 00       	mov    0x17c4,%eax
+ cf9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+ cfc:	8b 15 c8 17 00 00    	mov    0x17c8,%edx
+ d02:	a1 c4 17 00 00       	mov    0x17c4,%eax
+ d07:	29 c2                	sub    %eax,%edx
+ d09:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d0c:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+ d0e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d11:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+ d18:	83 ec 0c             	sub    $0xc,%esp
+ d1b:	ff 75 ec             	push   -0x14(%ebp)
+ d1e:	e8 3d 00 00 00       	call   d60 <lfree>
+ d23:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+ d26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d29:	a3 c4 17 00 00       	mov    %eax,0x17c4
+    }
+    limit = p + n;
+ d2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d34:	01 d0                	add    %edx,%eax
+ d36:	a3 c8 17 00 00       	mov    %eax,0x17c8
+  }
+  b = (Block*)top;
+ d3b:	a1 c4 17 00 00       	mov    0x17c4,%eax
+ d40:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+ d43:	8b 15 c4 17 00 00    	mov    0x17c4,%edx
+ d49:	8b 45 08             	mov    0x8(%ebp),%eax
+ d4c:	01 d0                	add    %edx,%eax
+ d4e:	a3 c4 17 00 00       	mov    %eax,0x17c4
+  b->h.size = size;
+ d53:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ d56:	8b 55 08             	mov    0x8(%ebp),%edx
+ d59:	89 10                	mov    %edx,(%eax)
+  return b;
+ d5b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+ d5e:	c9                   	leave
+ d5f:	c3                   	ret
+
+00000d60 <lfree>:
+
+static void
+lfree(Block *b)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+ d66:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ d6d:	a1 c0 17 00 00       	mov    0x17c0,%eax
+ d72:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d75:	eb 0f                	jmp    d86 <lfree+0x26>
+    prev = p;
+ d77:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d7a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+ d7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d80:	8b 40 08             	mov    0x8(%eax),%eax
+ d83:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d86:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ d8a:	74 08                	je     d94 <lfree+0x34>
+ d8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d8f:	3b 45 08             	cmp    0x8(%ebp),%eax
+ d92:	72 e3                	jb     d77 <lfree+0x17>
+  b->next = p;
+ d94:	8b 45 08             	mov    0x8(%ebp),%eax
+ d97:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ d9a:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+ d9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+ da1:	74 2c                	je     dcf <lfree+0x6f>
+ da3:	8b 45 08             	mov    0x8(%ebp),%eax
+ da6:	8b 10                	mov    (%eax),%edx
+ da8:	8b 45 08             	mov    0x8(%ebp),%eax
+ dab:	01 d0                	add    %edx,%eax
+ dad:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ db0:	75 1d                	jne    dcf <lfree+0x6f>
+    b->h.size += p->h.size;
+ db2:	8b 45 08             	mov    0x8(%ebp),%eax
+ db5:	8b 10                	mov    (%eax),%edx
+ db7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dba:	8b 00                	mov    (%eax),%eax
+ dbc:	01 c2                	add    %eax,%edx
+ dbe:	8b 45 08             	mov    0x8(%ebp),%eax
+ dc1:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+ dc3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dc6:	8b 50 08             	mov    0x8(%eax),%edx
+ dc9:	8b 45 08             	mov    0x8(%ebp),%eax
+ dcc:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+ dcf:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ dd3:	74 2e                	je     e03 <lfree+0xa3>
+ dd5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dd8:	8b 10                	mov    (%eax),%edx
+ dda:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ddd:	01 d0                	add    %edx,%eax
+ ddf:	39 45 08             	cmp    %eax,0x8(%ebp)
+ de2:	75 1f                	jne    e03 <lfree+0xa3>
+    prev->h.size += b->h.size;
+ de4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ de7:	8b 10                	mov    (%eax),%edx
+ de9:	8b 45 08             	mov    0x8(%ebp),%eax
+ dec:	8b 00                	mov    (%eax),%eax
+ dee:	01 c2                	add    %eax,%edx
+ df0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ df3:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+ df5:	8b 45 08             	mov    0x8(%ebp),%eax
+ df8:	8b 50 08             	mov    0x8(%eax),%edx
+ dfb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dfe:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+ e01:	eb 19                	jmp    e1c <lfree+0xbc>
+  } else if(prev)
+ e03:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+ e07:	74 0b                	je     e14 <lfree+0xb4>
+    prev->next = b;
+ e09:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e0c:	8b 55 08             	mov    0x8(%ebp),%edx
+ e0f:	89 50 08             	mov    %edx,0x8(%eax)
+}
+ e12:	eb 08                	jmp    e1c <lfree+0xbc>
+    large = b;
+ e14:	8b 45 08             	mov    0x8(%ebp),%eax
+ e17:	a3 c0 17 00 00       	mov    %eax,0x17c0
+}
+ e1c:	90                   	nop
+ e1d:	c9                   	leave
+ e1e:	c3                   	ret
+
+00000e1f <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+ e1f:	55                   	push   %ebp
+ e20:	89 e5                	mov    %esp,%ebp
+ e22:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ e25:	c7 45 f0 c0 17 00 00 	movl   $0x17c0,-0x10(%ebp)
+ e2c:	eb 52                	jmp    e80 <lalloc+0x61>
+    if(p->h.size < size)
+ e2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e31:	8b 00                	mov    (%eax),%eax
+ e33:	3b 45 08             	cmp    0x8(%ebp),%eax
+ e36:	72 3e                	jb     e76 <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+ e38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e3b:	8b 00                	mov    (%eax),%eax
+ e3d:	2b 45 08             	sub    0x8(%ebp),%eax
+ e40:	83 f8 0f             	cmp    $0xf,%eax
+ e43:	76 21                	jbe    e66 <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+ e45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e48:	8b 00                	mov    (%eax),%eax
+ e4a:	2b 45 08             	sub    0x8(%ebp),%eax
+ e4d:	89 c2                	mov    %eax,%edx
+ e4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e52:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+ e54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e57:	8b 00                	mov    (%eax),%eax
+ e59:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+ e5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e5f:	8b 55 08             	mov    0x8(%ebp),%edx
+ e62:	89 10                	mov    %edx,(%eax)
+ e64:	eb 0b                	jmp    e71 <lalloc+0x52>
+    } else
+      *pp = p->next;
+ e66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e69:	8b 50 08             	mov    0x8(%eax),%edx
+ e6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e6f:	89 10                	mov    %edx,(%eax)
+    return p;
+ e71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e74:	eb 26                	jmp    e9c <lalloc+0x7d>
+      continue;
+ e76:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+ e77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e7a:	83 c0 08             	add    $0x8,%eax
+ e7d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e80:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e83:	8b 00                	mov    (%eax),%eax
+ e85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e88:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e8c:	75 a0                	jne    e2e <lalloc+0xf>
+  }
+  return carve(size);
+ e8e:	83 ec 0c             	sub    $0xc,%esp
+ e91:	ff 75 08             	push   0x8(%ebp)
+ e94:	e8 97 fd ff ff       	call   c30 <carve>
+ e99:	83 c4 10             	add    $0x10,%esp
+}
+ e9c:	c9                   	leave
+ e9d:	c3                   	ret
+
+00000e9e <free>:
+
+void
+free(void *ap)
+{
+ e9e:	55                   	push   %ebp
+ e9f:	89 e5                	mov    %esp,%ebp
+ ea1:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+ ea4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ ea8:	74 46                	je     ef0 <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+ eaa:	8b 45 08             	mov    0x8(%ebp),%eax
+ ead:	83 e8 08             	sub    $0x8,%eax
+ eb0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+ eb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ eb6:	8b 40 04             	mov    0x4(%eax),%eax
+ eb9:	83 f8 07             	cmp    $0x7,%eax
+ ebc:	77 25                	ja     ee3 <free+0x45>
+    b->next = bins[b->h.bin];
+ ebe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ec1:	8b 40 04             	mov    0x4(%eax),%eax
+ ec4:	8b 14 85 a0 17 00 00 	mov    0x17a0(,%eax,4),%edx
+ ecb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ece:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+ ed1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ed4:	8b 40 04             	mov    0x4(%eax),%eax
+ ed7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ eda:	89 14 85 a0 17 00 00 	mov    %edx,0x17a0(,%eax,4)
+ ee1:	eb 0e                	jmp    ef1 <free+0x53>
+  } else
+    lfree(b);
+ ee3:	ff 75 fc             	push   -0x4(%ebp)
+ ee6:	e8 75 fe ff ff       	call   d60 <lfree>
+ eeb:	83 c4 04             	add    $0x4,%esp
+ eee:	eb 01                	jmp    ef1 <free+0x53>
+    return;
+ ef0:	90                   	nop
+}
+ ef1:	c9                   	leave
+ ef2:	c3                   	ret
+
+00000ef3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ ef3:	55                   	push   %ebp
+ ef4:	89 e5                	mov    %esp,%ebp
+ ef6:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+ ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+ efc:	83 c0 08             	add    $0x8,%eax
+ eff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+ f02:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f05:	3b 45 08             	cmp    0x8(%ebp),%eax
+ f08:	73 0a                	jae    f14 <malloc+0x21>
+    return 0;
+ f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+ f0f:	e9 b8 00 00 00       	jmp    fcc <malloc+0xd9>
+  if(size <= MAXSMALL){
+ f14:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+ f1b:	77 6f                	ja     f8c <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+ f1d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ f24:	eb 04                	jmp    f2a <malloc+0x37>
+ f26:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ f2a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f2d:	ba 10 00 00 00       	mov    $0x10,%edx
+ f32:	89 c1                	mov    %eax,%ecx
+ f34:	d3 e2                	shl    %cl,%edx
+ f36:	89 d0                	mov    %edx,%eax
+ f38:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ f3b:	72 e9                	jb     f26 <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+ f3d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f40:	8b 04 85 a0 17 00 00 	mov    0x17a0(,%eax,4),%eax
+ f47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f4a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f4e:	74 12                	je     f62 <malloc+0x6f>
+      bins[bin] = b->next;
+ f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f53:	8b 50 08             	mov    0x8(%eax),%edx
+ f56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f59:	89 14 85 a0 17 00 00 	mov    %edx,0x17a0(,%eax,4)
+ f60:	eb 5b                	jmp    fbd <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+ f62:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f65:	ba 10 00 00 00       	mov    $0x10,%edx
+ f6a:	89 c1                	mov    %eax,%ecx
+ f6c:	d3 e2                	shl    %cl,%edx
+ f6e:	89 d0                	mov    %edx,%eax
+ f70:	83 ec 0c             	sub    $0xc,%esp
+ f73:	50                   	push   %eax
+ f74:	e8 b7 fc ff ff       	call   c30 <carve>
+ f79:	83 c4 10             	add    $0x10,%esp
+ f7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f7f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f83:	75 38                	jne    fbd <malloc+0xca>
+      return 0;
+ f85:	b8 00 00 00 00       	mov    $0x0,%eax
+ f8a:	eb 40                	jmp    fcc <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+ f8c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ f8f:	83 c0 07             	add    $0x7,%eax
+ f92:	83 e0 f8             	and    $0xfffffff8,%eax
+ f95:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+ f98:	83 ec 0c             	sub    $0xc,%esp
+ f9b:	ff 75 ec             	push   -0x14(%ebp)
+ f9e:	e8 7c fe ff ff       	call   e1f <lalloc>
+ fa3:	83 c4 10             	add    $0x10,%esp
+ fa6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ fa9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ fad:	75 07                	jne    fb6 <malloc+0xc3>
+      return 0;
+ faf:	b8 00 00 00 00       	mov    $0x0,%eax
+ fb4:	eb 16                	jmp    fcc <malloc+0xd9>
+    bin = LARGE;
+ fb6:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+ fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ fc0:	8b 55 f0             	mov    -0x10(%ebp),%edx
+ fc3:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+ fc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ fc9:	83 c0 08             	add    $0x8,%eax
+}
+ fcc:	c9                   	leave
+ fcd:	c3                   	ret
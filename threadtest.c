@@ -0,0 +1,85 @@
+// Check that clone()d threads share the address space and the
+// file descriptor table: each thread's writes to globals and to
+// memory it sbrk()s, and the descriptors it opens, must be
+// visible to the creating thread once the thread is joined.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NTHREAD 4
+#define COUNT   100000
+
+static volatile uint counts[NTHREAD];
+static char *grown[NTHREAD];
+static int pfd[2];
+
+static void
+worker(void *arg)
+{
+  int id, i;
+
+  id = (int)arg;
+  for(i = 0; i < COUNT; i++)
+    counts[id]++;
+  if((grown[id] = sbrk(4096)) == (char*)-1)
+    exit();
+  memset(grown[id], 'a' + id, 4096);
+}
+
+static void
+opener(void *arg)
+{
+  if(pipe(pfd) < 0)
+    pfd[0] = pfd[1] = -1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int tid[NTHREAD], i;
+  char c;
+
+  printf(1, "threadtest\n");
+  for(i = 0; i < NTHREAD; i++){
+    if((tid[i] = thread_create(worker, (void*)i)) < 0){
+      printf(1, "threadtest: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < NTHREAD; i++){
+    if(thread_join(tid[i]) != tid[i]){
+      printf(1, "threadtest: thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join(tid[0]) != -1){
+    printf(1, "threadtest: joined a thread twice\n");
+    exit();
+  }
+  for(i = 0; i < NTHREAD; i++){
+    if(counts[i] != COUNT){
+      printf(1, "threadtest: thread %d counted %d\n", i, counts[i]);
+      exit();
+    }
+    if(grown[i] == 0 || grown[i] == (char*)-1 ||
+       grown[i][0] != 'a' + i || grown[i][4095] != 'a' + i){
+      printf(1, "threadtest: thread %d's sbrk memory not shared\n", i);
+      exit();
+    }
+  }
+
+  if((tid[0] = thread_create(opener, 0)) < 0 || thread_join(tid[0]) != tid[0]){
+    printf(1, "threadtest: opener thread failed\n");
+    exit();
+  }
+  if(pfd[0] < 0 || write(pfd[1], "x", 1) != 1 ||
+     read(pfd[0], &c, 1) != 1 || c != 'x'){
+    printf(1, "threadtest: thread's descriptors not shared\n");
+    exit();
+  }
+  close(pfd[0]);
+  close(pfd[1]);
+  printf(1, "threadtest ok\n");
+  exit();
+}
@@ -4,6 +4,7 @@
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
 #include "traps.h"
 #include "x86.h"
 
@@ -24,9 +25,9 @@
 void
 timerinit(void)
 {
-  // Interrupt 100 times/sec.
+  // Interrupt once per tick.
   outb(TIMER_MODE, TIMER_SEL0 | TIMER_RATEGEN | TIMER_16BIT);
-  outb(IO_TIMER1, TIMER_DIV(100) % 256);
-  outb(IO_TIMER1, TIMER_DIV(100) / 256);
+  outb(IO_TIMER1, TIMER_DIV(HZ) % 256);
+  outb(IO_TIMER1, TIMER_DIV(HZ) / 256);
   picenable(IRQ_TIMER);
 }
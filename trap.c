@@ -3,10 +3,10 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -36,6 +36,8 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  int tick;
+
   if(tf->trapno == T_SYSCALL){
     if(proc->killed)
       exit();
@@ -46,14 +48,17 @@ trap(struct trapframe *tf)
     return;
   }
 
+  tick = 0;
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpu->id == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    // CPU 0's timer also fires between ticks for timed sleeps.
+    tick = cpu->id == 0 ? clockintr() : 1;
+    if(tick)
+      schedclock();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Woken from hlt; scheduler() will find the new work.
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -100,9 +105,9 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU once its time slice is used up.
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tick && timeslice())
     yield();
 
   // Check if the process has been killed since we yielded
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "stat.h"
 #include "fcntl.h"
+#include "date.h"
 #include "user.h"
 #include "x86.h"
 
@@ -103,3 +104,14 @@ memmove(void *vdst, void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+  struct timespec ts;
+
+  nanouptime(&ts);
+  return ts.sec * 1000000 + ts.nsec / 1000;
+}
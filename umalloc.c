@@ -3,88 +3,164 @@
 #include "user.h"
 #include "param.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator with segregated size classes.
+//
+// Requests of up to MAXSMALL bytes, header included, are rounded
+// up to a power-of-two class.  Each class has its own free list,
+// so malloc and free of small blocks are constant time.  New
+// blocks are carved off the unused top of the heap, which grows
+// geometrically through sbrk.  Larger requests go to an
+// address-ordered first-fit list that coalesces on free.
 
-typedef long Align;
+#define NBIN     8                      // 16, 32, ..., 2048 bytes
+#define MINBLOCK 16
+#define MAXSMALL (MINBLOCK << (NBIN-1))
+#define LARGE    NBIN                   // bin of a large block
+#define MINGROW  4096                   // first sbrk increment
+#define MAXGROW  (1024*1024)            // growth stops doubling here
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
+typedef struct header Header;
+typedef struct block Block;
+
+// Every block starts with a header; the caller's data follows.
+struct header {
+  uint size;       // bytes in block, header included
+  uint bin;        // size class, or LARGE
 };
 
-typedef union header Header;
+// A free block reuses the first data word as its link.
+struct block {
+  Header h;
+  Block *next;
+};
 
-static Header base;
-static Header *freep;
+static Block *bins[NBIN];
+static Block *large;         // free large blocks, by address
+static char *top, *limit;    // unused tail of the heap
+static uint growsz = MINGROW;
 
-void
-free(void *ap)
+static void lfree(Block*);
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+    n = size > growsz ? size : growsz;
+    n = (n + 4095) & ~4095;
+    if(growsz < MAXGROW)
+      growsz *= 2;
+    p = sbrk(n);
+    if(p == (char*)-1 && n > size){
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+      p = sbrk(n);
+    }
+    if(p == (char*)-1)
+      return 0;
+    if(p != limit){
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+        b = (Block*)top;
+        b->h.size = limit - top;
+        b->h.bin = LARGE;
+        lfree(b);
+      }
+      top = p;
+    }
+    limit = p + n;
+  }
+  b = (Block*)top;
+  top += size;
+  b->h.size = size;
+  return b;
 }
 
-static Header*
-morecore(uint nu)
+static void
+lfree(Block *b)
 {
-  char *p;
-  Header *hp;
+  Block *p, *prev;
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
-    return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+  prev = 0;
+  for(p = large; p && p < b; p = p->next)
+    prev = p;
+  b->next = p;
+  if(p && (char*)b + b->h.size == (char*)p){
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+
+static Block*
+lalloc(uint size)
+{
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+    if(p->h.size < size)
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+      p = (Block*)((char*)p + p->h.size);
+      p->h.size = size;
+    } else
+      *pp = p->next;
+    return p;
+  }
+  return carve(size);
+}
+
+void
+free(void *ap)
+{
+  Block *b;
+
+  if(ap == 0)
+    return;
+  b = (Block*)((Header*)ap - 1);
+  if(b->h.bin < NBIN){
+    b->next = bins[b->h.bin];
+    bins[b->h.bin] = b;
+  } else
+    lfree(b);
 }
 
 void*
 malloc(uint nbytes)
 {
-  Header *p, *prevp;
-  uint nunits;
+  Block *b;
+  uint size, bin;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
-  }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
-    }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
+  size = nbytes + sizeof(Header);
+  if(size < nbytes)
+    return 0;
+  if(size <= MAXSMALL){
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+      ;
+    if((b = bins[bin]) != 0)
+      bins[bin] = b->next;
+    else if((b = carve(MINBLOCK << bin)) == 0)
+      return 0;
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+    if((b = lalloc(size)) == 0)
+      return 0;
+    bin = LARGE;
   }
+  b->h.bin = bin;
+  return (void*)(&b->h + 1);
 }
@@ -2,6 +2,12 @@
 
 struct stat;
 struct rtcdate;
+struct cpustat;
+struct timespec;
+struct rtstat;
+struct schedstat;
+struct lockstat;
+struct dcachestat;
 
 // system calls
 int fork(void);
@@ -27,6 +33,22 @@ int sleep(int);
 int uptime(void);
 void saveProc();
 int loadProc();
+int setpriority(int, int);
+int setaffinity(int, uint);
+int getaffinity(int);
+int nanosleep(int, int);
+int cpustat(int, struct cpustat*);
+int nanouptime(struct timespec*);
+int settickets(int, int);
+int setdeadline(int, int, int);
+int rtstat(int, struct rtstat*);
+int schedstat(int, struct schedstat*);
+int waitpid(int, int);
+int clone(void (*)(void*), void*, void*);
+int futexwait(volatile uint*, uint);
+int futexwake(volatile uint*, int);
+int lockstat(struct lockstat*, int);
+int dcachestat(struct dcachestat*);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -40,4 +62,29 @@ uint strlen(char*);
 void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
-int atoi(const char*);
\ No newline at end of file
+int atoi(const char*);
+uint uptimeus(void);
+
+// uthread.c
+struct mutex {
+  volatile uint state;  // 0 free, 1 held, 2 held and contended
+};
+
+struct cond {
+  volatile uint seq;    // bumped by every signal
+};
+
+int thread_create(void (*)(void*), void*);
+int thread_join(int);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
+
+// coro.c
+int coro_create(void (*)(void*), void*);
+void coro_yield(void);
+void coro_run(void);
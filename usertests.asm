@@ -0,0 +1,8249 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <iputtest>:
+int stdout = 1;
+
+// does chdir() call iput(p->cwd) in a transaction?
+void
+iputtest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "iput test\n");
+       6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 22 4b 00 00       	push   $0x4b22
+      13:	50                   	push   %eax
+      14:	e8 c3 45 00 00       	call   45dc <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("iputdir") < 0){
+      1c:	83 ec 0c             	sub    $0xc,%esp
+      1f:	68 2d 4b 00 00       	push   $0x4b2d
+      24:	e8 17 44 00 00       	call   4440 <mkdir>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	85 c0                	test   %eax,%eax
+      2e:	79 1b                	jns    4b <iputtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+      30:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      35:	83 ec 08             	sub    $0x8,%esp
+      38:	68 35 4b 00 00       	push   $0x4b35
+      3d:	50                   	push   %eax
+      3e:	e8 99 45 00 00       	call   45dc <printf>
+      43:	83 c4 10             	add    $0x10,%esp
+    exit();
+      46:	e8 8d 43 00 00       	call   43d8 <exit>
+  }
+  if(chdir("iputdir") < 0){
+      4b:	83 ec 0c             	sub    $0xc,%esp
+      4e:	68 2d 4b 00 00       	push   $0x4b2d
+      53:	e8 f0 43 00 00       	call   4448 <chdir>
+      58:	83 c4 10             	add    $0x10,%esp
+      5b:	85 c0                	test   %eax,%eax
+      5d:	79 1b                	jns    7a <iputtest+0x7a>
+    printf(stdout, "chdir iputdir failed\n");
+      5f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 43 4b 00 00       	push   $0x4b43
+      6c:	50                   	push   %eax
+      6d:	e8 6a 45 00 00       	call   45dc <printf>
+      72:	83 c4 10             	add    $0x10,%esp
+    exit();
+      75:	e8 5e 43 00 00       	call   43d8 <exit>
+  }
+  if(unlink("../iputdir") < 0){
+      7a:	83 ec 0c             	sub    $0xc,%esp
+      7d:	68 59 4b 00 00       	push   $0x4b59
+      82:	e8 a1 43 00 00       	call   4428 <unlink>
+      87:	83 c4 10             	add    $0x10,%esp
+      8a:	85 c0                	test   %eax,%eax
+      8c:	79 1b                	jns    a9 <iputtest+0xa9>
+    printf(stdout, "unlink ../iputdir failed\n");
+      8e:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      93:	83 ec 08             	sub    $0x8,%esp
+      96:	68 64 4b 00 00       	push   $0x4b64
+      9b:	50                   	push   %eax
+      9c:	e8 3b 45 00 00       	call   45dc <printf>
+      a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+      a4:	e8 2f 43 00 00       	call   43d8 <exit>
+  }
+  if(chdir("/") < 0){
+      a9:	83 ec 0c             	sub    $0xc,%esp
+      ac:	68 7e 4b 00 00       	push   $0x4b7e
+      b1:	e8 92 43 00 00       	call   4448 <chdir>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	85 c0                	test   %eax,%eax
+      bb:	79 1b                	jns    d8 <iputtest+0xd8>
+    printf(stdout, "chdir / failed\n");
+      bd:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      c2:	83 ec 08             	sub    $0x8,%esp
+      c5:	68 80 4b 00 00       	push   $0x4b80
+      ca:	50                   	push   %eax
+      cb:	e8 0c 45 00 00       	call   45dc <printf>
+      d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+      d3:	e8 00 43 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "iput test ok\n");
+      d8:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      dd:	83 ec 08             	sub    $0x8,%esp
+      e0:	68 90 4b 00 00       	push   $0x4b90
+      e5:	50                   	push   %eax
+      e6:	e8 f1 44 00 00       	call   45dc <printf>
+      eb:	83 c4 10             	add    $0x10,%esp
+}
+      ee:	90                   	nop
+      ef:	c9                   	leave
+      f0:	c3                   	ret
+
+000000f1 <exitiputtest>:
+
+// does exit() call iput(p->cwd) in a transaction?
+void
+exitiputtest(void)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "exitiput test\n");
+      f7:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+      fc:	83 ec 08             	sub    $0x8,%esp
+      ff:	68 9e 4b 00 00       	push   $0x4b9e
+     104:	50                   	push   %eax
+     105:	e8 d2 44 00 00       	call   45dc <printf>
+     10a:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     10d:	e8 be 42 00 00       	call   43d0 <fork>
+     112:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     115:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     119:	79 1b                	jns    136 <exitiputtest+0x45>
+    printf(stdout, "fork failed\n");
+     11b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     120:	83 ec 08             	sub    $0x8,%esp
+     123:	68 ad 4b 00 00       	push   $0x4bad
+     128:	50                   	push   %eax
+     129:	e8 ae 44 00 00       	call   45dc <printf>
+     12e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     131:	e8 a2 42 00 00       	call   43d8 <exit>
+  }
+  if(pid == 0){
+     136:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     13a:	0f 85 92 00 00 00    	jne    1d2 <exitiputtest+0xe1>
+    if(mkdir("iputdir") < 0){
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	68 2d 4b 00 00       	push   $0x4b2d
+     148:	e8 f3 42 00 00       	call   4440 <mkdir>
+     14d:	83 c4 10             	add    $0x10,%esp
+     150:	85 c0                	test   %eax,%eax
+     152:	79 1b                	jns    16f <exitiputtest+0x7e>
+      printf(stdout, "mkdir failed\n");
+     154:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     159:	83 ec 08             	sub    $0x8,%esp
+     15c:	68 35 4b 00 00       	push   $0x4b35
+     161:	50                   	push   %eax
+     162:	e8 75 44 00 00       	call   45dc <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+      exit();
+     16a:	e8 69 42 00 00       	call   43d8 <exit>
+    }
+    if(chdir("iputdir") < 0){
+     16f:	83 ec 0c             	sub    $0xc,%esp
+     172:	68 2d 4b 00 00       	push   $0x4b2d
+     177:	e8 cc 42 00 00       	call   4448 <chdir>
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	85 c0                	test   %eax,%eax
+     181:	79 1b                	jns    19e <exitiputtest+0xad>
+      printf(stdout, "child chdir failed\n");
+     183:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     188:	83 ec 08             	sub    $0x8,%esp
+     18b:	68 ba 4b 00 00       	push   $0x4bba
+     190:	50                   	push   %eax
+     191:	e8 46 44 00 00       	call   45dc <printf>
+     196:	83 c4 10             	add    $0x10,%esp
+      exit();
+     199:	e8 3a 42 00 00       	call   43d8 <exit>
+    }
+    if(unlink("../iputdir") < 0){
+     19e:	83 ec 0c             	sub    $0xc,%esp
+     1a1:	68 59 4b 00 00       	push   $0x4b59
+     1a6:	e8 7d 42 00 00       	call   4428 <unlink>
+     1ab:	83 c4 10             	add    $0x10,%esp
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	79 1b                	jns    1cd <exitiputtest+0xdc>
+      printf(stdout, "unlink ../iputdir failed\n");
+     1b2:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     1b7:	83 ec 08             	sub    $0x8,%esp
+     1ba:	68 64 4b 00 00       	push   $0x4b64
+     1bf:	50                   	push   %eax
+     1c0:	e8 17 44 00 00       	call   45dc <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+      exit();
+     1c8:	e8 0b 42 00 00       	call   43d8 <exit>
+    }
+    exit();
+     1cd:	e8 06 42 00 00       	call   43d8 <exit>
+  }
+  wait();
+     1d2:	e8 09 42 00 00       	call   43e0 <wait>
+  printf(stdout, "exitiput test ok\n");
+     1d7:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     1dc:	83 ec 08             	sub    $0x8,%esp
+     1df:	68 ce 4b 00 00       	push   $0x4bce
+     1e4:	50                   	push   %eax
+     1e5:	e8 f2 43 00 00       	call   45dc <printf>
+     1ea:	83 c4 10             	add    $0x10,%esp
+}
+     1ed:	90                   	nop
+     1ee:	c9                   	leave
+     1ef:	c3                   	ret
+
+000001f0 <openiputtest>:
+//      for(i = 0; i < 10000; i++)
+//        yield();
+//    }
+void
+openiputtest(void)
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(stdout, "openiput test\n");
+     1f6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     1fb:	83 ec 08             	sub    $0x8,%esp
+     1fe:	68 e0 4b 00 00       	push   $0x4be0
+     203:	50                   	push   %eax
+     204:	e8 d3 43 00 00       	call   45dc <printf>
+     209:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("oidir") < 0){
+     20c:	83 ec 0c             	sub    $0xc,%esp
+     20f:	68 ef 4b 00 00       	push   $0x4bef
+     214:	e8 27 42 00 00       	call   4440 <mkdir>
+     219:	83 c4 10             	add    $0x10,%esp
+     21c:	85 c0                	test   %eax,%eax
+     21e:	79 1b                	jns    23b <openiputtest+0x4b>
+    printf(stdout, "mkdir oidir failed\n");
+     220:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     225:	83 ec 08             	sub    $0x8,%esp
+     228:	68 f5 4b 00 00       	push   $0x4bf5
+     22d:	50                   	push   %eax
+     22e:	e8 a9 43 00 00       	call   45dc <printf>
+     233:	83 c4 10             	add    $0x10,%esp
+    exit();
+     236:	e8 9d 41 00 00       	call   43d8 <exit>
+  }
+  pid = fork();
+     23b:	e8 90 41 00 00       	call   43d0 <fork>
+     240:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid < 0){
+     243:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     247:	79 1b                	jns    264 <openiputtest+0x74>
+    printf(stdout, "fork failed\n");
+     249:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     24e:	83 ec 08             	sub    $0x8,%esp
+     251:	68 ad 4b 00 00       	push   $0x4bad
+     256:	50                   	push   %eax
+     257:	e8 80 43 00 00       	call   45dc <printf>
+     25c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     25f:	e8 74 41 00 00       	call   43d8 <exit>
+  }
+  if(pid == 0){
+     264:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     268:	75 3b                	jne    2a5 <openiputtest+0xb5>
+    int fd = open("oidir", O_RDWR);
+     26a:	83 ec 08             	sub    $0x8,%esp
+     26d:	6a 02                	push   $0x2
+     26f:	68 ef 4b 00 00       	push   $0x4bef
+     274:	e8 9f 41 00 00       	call   4418 <open>
+     279:	83 c4 10             	add    $0x10,%esp
+     27c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0){
+     27f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     283:	78 1b                	js     2a0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     285:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     28a:	83 ec 08             	sub    $0x8,%esp
+     28d:	68 0c 4c 00 00       	push   $0x4c0c
+     292:	50                   	push   %eax
+     293:	e8 44 43 00 00       	call   45dc <printf>
+     298:	83 c4 10             	add    $0x10,%esp
+      exit();
+     29b:	e8 38 41 00 00       	call   43d8 <exit>
+    }
+    exit();
+     2a0:	e8 33 41 00 00       	call   43d8 <exit>
+  }
+  sleep(1);
+     2a5:	83 ec 0c             	sub    $0xc,%esp
+     2a8:	6a 01                	push   $0x1
+     2aa:	e8 b9 41 00 00       	call   4468 <sleep>
+     2af:	83 c4 10             	add    $0x10,%esp
+  if(unlink("oidir") != 0){
+     2b2:	83 ec 0c             	sub    $0xc,%esp
+     2b5:	68 ef 4b 00 00       	push   $0x4bef
+     2ba:	e8 69 41 00 00       	call   4428 <unlink>
+     2bf:	83 c4 10             	add    $0x10,%esp
+     2c2:	85 c0                	test   %eax,%eax
+     2c4:	74 1b                	je     2e1 <openiputtest+0xf1>
+    printf(stdout, "unlink failed\n");
+     2c6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     2cb:	83 ec 08             	sub    $0x8,%esp
+     2ce:	68 30 4c 00 00       	push   $0x4c30
+     2d3:	50                   	push   %eax
+     2d4:	e8 03 43 00 00       	call   45dc <printf>
+     2d9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2dc:	e8 f7 40 00 00       	call   43d8 <exit>
+  }
+  wait();
+     2e1:	e8 fa 40 00 00       	call   43e0 <wait>
+  printf(stdout, "openiput test ok\n");
+     2e6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 3f 4c 00 00       	push   $0x4c3f
+     2f3:	50                   	push   %eax
+     2f4:	e8 e3 42 00 00       	call   45dc <printf>
+     2f9:	83 c4 10             	add    $0x10,%esp
+}
+     2fc:	90                   	nop
+     2fd:	c9                   	leave
+     2fe:	c3                   	ret
+
+000002ff <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+     305:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     30a:	83 ec 08             	sub    $0x8,%esp
+     30d:	68 51 4c 00 00       	push   $0x4c51
+     312:	50                   	push   %eax
+     313:	e8 c4 42 00 00       	call   45dc <printf>
+     318:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+     31b:	83 ec 08             	sub    $0x8,%esp
+     31e:	6a 00                	push   $0x0
+     320:	68 0c 4b 00 00       	push   $0x4b0c
+     325:	e8 ee 40 00 00       	call   4418 <open>
+     32a:	83 c4 10             	add    $0x10,%esp
+     32d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+     330:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     334:	79 1b                	jns    351 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+     336:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     33b:	83 ec 08             	sub    $0x8,%esp
+     33e:	68 5c 4c 00 00       	push   $0x4c5c
+     343:	50                   	push   %eax
+     344:	e8 93 42 00 00       	call   45dc <printf>
+     349:	83 c4 10             	add    $0x10,%esp
+    exit();
+     34c:	e8 87 40 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+     351:	83 ec 0c             	sub    $0xc,%esp
+     354:	ff 75 f4             	push   -0xc(%ebp)
+     357:	e8 a4 40 00 00       	call   4400 <close>
+     35c:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+     35f:	83 ec 08             	sub    $0x8,%esp
+     362:	6a 00                	push   $0x0
+     364:	68 6f 4c 00 00       	push   $0x4c6f
+     369:	e8 aa 40 00 00       	call   4418 <open>
+     36e:	83 c4 10             	add    $0x10,%esp
+     371:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+     374:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     378:	78 1b                	js     395 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     37a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     37f:	83 ec 08             	sub    $0x8,%esp
+     382:	68 7c 4c 00 00       	push   $0x4c7c
+     387:	50                   	push   %eax
+     388:	e8 4f 42 00 00       	call   45dc <printf>
+     38d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     390:	e8 43 40 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "open test ok\n");
+     395:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     39a:	83 ec 08             	sub    $0x8,%esp
+     39d:	68 9a 4c 00 00       	push   $0x4c9a
+     3a2:	50                   	push   %eax
+     3a3:	e8 34 42 00 00       	call   45dc <printf>
+     3a8:	83 c4 10             	add    $0x10,%esp
+}
+     3ab:	90                   	nop
+     3ac:	c9                   	leave
+     3ad:	c3                   	ret
+
+000003ae <writetest>:
+
+void
+writetest(void)
+{
+     3ae:	55                   	push   %ebp
+     3af:	89 e5                	mov    %esp,%ebp
+     3b1:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+     3b4:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     3b9:	83 ec 08             	sub    $0x8,%esp
+     3bc:	68 a8 4c 00 00       	push   $0x4ca8
+     3c1:	50                   	push   %eax
+     3c2:	e8 15 42 00 00       	call   45dc <printf>
+     3c7:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+     3ca:	83 ec 08             	sub    $0x8,%esp
+     3cd:	68 02 02 00 00       	push   $0x202
+     3d2:	68 b9 4c 00 00       	push   $0x4cb9
+     3d7:	e8 3c 40 00 00       	call   4418 <open>
+     3dc:	83 c4 10             	add    $0x10,%esp
+     3df:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     3e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     3e6:	78 22                	js     40a <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+     3e8:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     3ed:	83 ec 08             	sub    $0x8,%esp
+     3f0:	68 bf 4c 00 00       	push   $0x4cbf
+     3f5:	50                   	push   %eax
+     3f6:	e8 e1 41 00 00       	call   45dc <printf>
+     3fb:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+     3fe:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     405:	e9 8f 00 00 00       	jmp    499 <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     40a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     40f:	83 ec 08             	sub    $0x8,%esp
+     412:	68 da 4c 00 00       	push   $0x4cda
+     417:	50                   	push   %eax
+     418:	e8 bf 41 00 00       	call   45dc <printf>
+     41d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     420:	e8 b3 3f 00 00       	call   43d8 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     425:	83 ec 04             	sub    $0x4,%esp
+     428:	6a 0a                	push   $0xa
+     42a:	68 f6 4c 00 00       	push   $0x4cf6
+     42f:	ff 75 f0             	push   -0x10(%ebp)
+     432:	e8 c1 3f 00 00       	call   43f8 <write>
+     437:	83 c4 10             	add    $0x10,%esp
+     43a:	83 f8 0a             	cmp    $0xa,%eax
+     43d:	74 1e                	je     45d <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     43f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     444:	83 ec 04             	sub    $0x4,%esp
+     447:	ff 75 f4             	push   -0xc(%ebp)
+     44a:	68 04 4d 00 00       	push   $0x4d04
+     44f:	50                   	push   %eax
+     450:	e8 87 41 00 00       	call   45dc <printf>
+     455:	83 c4 10             	add    $0x10,%esp
+      exit();
+     458:	e8 7b 3f 00 00       	call   43d8 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     45d:	83 ec 04             	sub    $0x4,%esp
+     460:	6a 0a                	push   $0xa
+     462:	68 28 4d 00 00       	push   $0x4d28
+     467:	ff 75 f0             	push   -0x10(%ebp)
+     46a:	e8 89 3f 00 00       	call   43f8 <write>
+     46f:	83 c4 10             	add    $0x10,%esp
+     472:	83 f8 0a             	cmp    $0xa,%eax
+     475:	74 1e                	je     495 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     477:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     47c:	83 ec 04             	sub    $0x4,%esp
+     47f:	ff 75 f4             	push   -0xc(%ebp)
+     482:	68 34 4d 00 00       	push   $0x4d34
+     487:	50                   	push   %eax
+     488:	e8 4f 41 00 00       	call   45dc <printf>
+     48d:	83 c4 10             	add    $0x10,%esp
+      exit();
+     490:	e8 43 3f 00 00       	call   43d8 <exit>
+  for(i = 0; i < 100; i++){
+     495:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     499:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     49d:	7e 86                	jle    425 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     49f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     4a4:	83 ec 08             	sub    $0x8,%esp
+     4a7:	68 58 4d 00 00       	push   $0x4d58
+     4ac:	50                   	push   %eax
+     4ad:	e8 2a 41 00 00       	call   45dc <printf>
+     4b2:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     4b5:	83 ec 0c             	sub    $0xc,%esp
+     4b8:	ff 75 f0             	push   -0x10(%ebp)
+     4bb:	e8 40 3f 00 00       	call   4400 <close>
+     4c0:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     4c3:	83 ec 08             	sub    $0x8,%esp
+     4c6:	6a 00                	push   $0x0
+     4c8:	68 b9 4c 00 00       	push   $0x4cb9
+     4cd:	e8 46 3f 00 00       	call   4418 <open>
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     4d8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     4dc:	78 3c                	js     51a <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     4de:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     4e3:	83 ec 08             	sub    $0x8,%esp
+     4e6:	68 63 4d 00 00       	push   $0x4d63
+     4eb:	50                   	push   %eax
+     4ec:	e8 eb 40 00 00       	call   45dc <printf>
+     4f1:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     4f4:	83 ec 04             	sub    $0x4,%esp
+     4f7:	68 d0 07 00 00       	push   $0x7d0
+     4fc:	68 20 6c 00 00       	push   $0x6c20
+     501:	ff 75 f0             	push   -0x10(%ebp)
+     504:	e8 e7 3e 00 00       	call   43f0 <read>
+     509:	83 c4 10             	add    $0x10,%esp
+     50c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     50f:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     516:	75 57                	jne    56f <writetest+0x1c1>
+     518:	eb 1b                	jmp    535 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     51a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     51f:	83 ec 08             	sub    $0x8,%esp
+     522:	68 7c 4d 00 00       	push   $0x4d7c
+     527:	50                   	push   %eax
+     528:	e8 af 40 00 00       	call   45dc <printf>
+     52d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     530:	e8 a3 3e 00 00       	call   43d8 <exit>
+    printf(stdout, "read succeeded ok\n");
+     535:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     53a:	83 ec 08             	sub    $0x8,%esp
+     53d:	68 97 4d 00 00       	push   $0x4d97
+     542:	50                   	push   %eax
+     543:	e8 94 40 00 00       	call   45dc <printf>
+     548:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	ff 75 f0             	push   -0x10(%ebp)
+     551:	e8 aa 3e 00 00       	call   4400 <close>
+     556:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     559:	83 ec 0c             	sub    $0xc,%esp
+     55c:	68 b9 4c 00 00       	push   $0x4cb9
+     561:	e8 c2 3e 00 00       	call   4428 <unlink>
+     566:	83 c4 10             	add    $0x10,%esp
+     569:	85 c0                	test   %eax,%eax
+     56b:	79 38                	jns    5a5 <writetest+0x1f7>
+     56d:	eb 1b                	jmp    58a <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     56f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     574:	83 ec 08             	sub    $0x8,%esp
+     577:	68 aa 4d 00 00       	push   $0x4daa
+     57c:	50                   	push   %eax
+     57d:	e8 5a 40 00 00       	call   45dc <printf>
+     582:	83 c4 10             	add    $0x10,%esp
+    exit();
+     585:	e8 4e 3e 00 00       	call   43d8 <exit>
+    printf(stdout, "unlink small failed\n");
+     58a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     58f:	83 ec 08             	sub    $0x8,%esp
+     592:	68 b7 4d 00 00       	push   $0x4db7
+     597:	50                   	push   %eax
+     598:	e8 3f 40 00 00       	call   45dc <printf>
+     59d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5a0:	e8 33 3e 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     5a5:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 cc 4d 00 00       	push   $0x4dcc
+     5b2:	50                   	push   %eax
+     5b3:	e8 24 40 00 00       	call   45dc <printf>
+     5b8:	83 c4 10             	add    $0x10,%esp
+}
+     5bb:	90                   	nop
+     5bc:	c9                   	leave
+     5bd:	c3                   	ret
+
+000005be <writetest1>:
+
+void
+writetest1(void)
+{
+     5be:	55                   	push   %ebp
+     5bf:	89 e5                	mov    %esp,%ebp
+     5c1:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     5c4:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     5c9:	83 ec 08             	sub    $0x8,%esp
+     5cc:	68 e0 4d 00 00       	push   $0x4de0
+     5d1:	50                   	push   %eax
+     5d2:	e8 05 40 00 00       	call   45dc <printf>
+     5d7:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     5da:	83 ec 08             	sub    $0x8,%esp
+     5dd:	68 02 02 00 00       	push   $0x202
+     5e2:	68 f0 4d 00 00       	push   $0x4df0
+     5e7:	e8 2c 3e 00 00       	call   4418 <open>
+     5ec:	83 c4 10             	add    $0x10,%esp
+     5ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     5f2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     5f6:	79 1b                	jns    613 <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     5f8:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     5fd:	83 ec 08             	sub    $0x8,%esp
+     600:	68 f4 4d 00 00       	push   $0x4df4
+     605:	50                   	push   %eax
+     606:	e8 d1 3f 00 00       	call   45dc <printf>
+     60b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     60e:	e8 c5 3d 00 00       	call   43d8 <exit>
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     613:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     61a:	eb 4b                	jmp    667 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     61c:	ba 20 6c 00 00       	mov    $0x6c20,%edx
+     621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     624:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     626:	83 ec 04             	sub    $0x4,%esp
+     629:	68 00 02 00 00       	push   $0x200
+     62e:	68 20 6c 00 00       	push   $0x6c20
+     633:	ff 75 ec             	push   -0x14(%ebp)
+     636:	e8 bd 3d 00 00       	call   43f8 <write>
+     63b:	83 c4 10             	add    $0x10,%esp
+     63e:	3d 00 02 00 00       	cmp    $0x200,%eax
+     643:	74 1e                	je     663 <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     645:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     64a:	83 ec 04             	sub    $0x4,%esp
+     64d:	ff 75 f4             	push   -0xc(%ebp)
+     650:	68 0e 4e 00 00       	push   $0x4e0e
+     655:	50                   	push   %eax
+     656:	e8 81 3f 00 00       	call   45dc <printf>
+     65b:	83 c4 10             	add    $0x10,%esp
+      exit();
+     65e:	e8 75 3d 00 00       	call   43d8 <exit>
+  for(i = 0; i < MAXFILE; i++){
+     663:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     66a:	3d 8b 00 00 00       	cmp    $0x8b,%eax
+     66f:	76 ab                	jbe    61c <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     671:	83 ec 0c             	sub    $0xc,%esp
+     674:	ff 75 ec             	push   -0x14(%ebp)
+     677:	e8 84 3d 00 00       	call   4400 <close>
+     67c:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     67f:	83 ec 08             	sub    $0x8,%esp
+     682:	6a 00                	push   $0x0
+     684:	68 f0 4d 00 00       	push   $0x4df0
+     689:	e8 8a 3d 00 00       	call   4418 <open>
+     68e:	83 c4 10             	add    $0x10,%esp
+     691:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     694:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     698:	79 1b                	jns    6b5 <writetest1+0xf7>
+    printf(stdout, "error: open big failed!\n");
+     69a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     69f:	83 ec 08             	sub    $0x8,%esp
+     6a2:	68 2c 4e 00 00       	push   $0x4e2c
+     6a7:	50                   	push   %eax
+     6a8:	e8 2f 3f 00 00       	call   45dc <printf>
+     6ad:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6b0:	e8 23 3d 00 00       	call   43d8 <exit>
+  }
+
+  n = 0;
+     6b5:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	68 00 02 00 00       	push   $0x200
+     6c4:	68 20 6c 00 00       	push   $0x6c20
+     6c9:	ff 75 ec             	push   -0x14(%ebp)
+     6cc:	e8 1f 3d 00 00       	call   43f0 <read>
+     6d1:	83 c4 10             	add    $0x10,%esp
+     6d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     6d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6db:	75 27                	jne    704 <writetest1+0x146>
+      if(n == MAXFILE - 1){
+     6dd:	81 7d f0 8b 00 00 00 	cmpl   $0x8b,-0x10(%ebp)
+     6e4:	75 7d                	jne    763 <writetest1+0x1a5>
+        printf(stdout, "read only %d blocks from big", n);
+     6e6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     6eb:	83 ec 04             	sub    $0x4,%esp
+     6ee:	ff 75 f0             	push   -0x10(%ebp)
+     6f1:	68 45 4e 00 00       	push   $0x4e45
+     6f6:	50                   	push   %eax
+     6f7:	e8 e0 3e 00 00       	call   45dc <printf>
+     6fc:	83 c4 10             	add    $0x10,%esp
+        exit();
+     6ff:	e8 d4 3c 00 00       	call   43d8 <exit>
+      }
+      break;
+    } else if(i != 512){
+     704:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     70b:	74 1e                	je     72b <writetest1+0x16d>
+      printf(stdout, "read failed %d\n", i);
+     70d:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     712:	83 ec 04             	sub    $0x4,%esp
+     715:	ff 75 f4             	push   -0xc(%ebp)
+     718:	68 62 4e 00 00       	push   $0x4e62
+     71d:	50                   	push   %eax
+     71e:	e8 b9 3e 00 00       	call   45dc <printf>
+     723:	83 c4 10             	add    $0x10,%esp
+      exit();
+     726:	e8 ad 3c 00 00       	call   43d8 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     72b:	b8 20 6c 00 00       	mov    $0x6c20,%eax
+     730:	8b 00                	mov    (%eax),%eax
+     732:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     735:	74 23                	je     75a <writetest1+0x19c>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     737:	b8 20 6c 00 00       	mov    $0x6c20,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     73c:	8b 10                	mov    (%eax),%edx
+     73e:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     743:	52                   	push   %edx
+     744:	ff 75 f0             	push   -0x10(%ebp)
+     747:	68 74 4e 00 00       	push   $0x4e74
+     74c:	50                   	push   %eax
+     74d:	e8 8a 3e 00 00       	call   45dc <printf>
+     752:	83 c4 10             	add    $0x10,%esp
+      exit();
+     755:	e8 7e 3c 00 00       	call   43d8 <exit>
+    }
+    n++;
+     75a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     75e:	e9 59 ff ff ff       	jmp    6bc <writetest1+0xfe>
+      break;
+     763:	90                   	nop
+  }
+  close(fd);
+     764:	83 ec 0c             	sub    $0xc,%esp
+     767:	ff 75 ec             	push   -0x14(%ebp)
+     76a:	e8 91 3c 00 00       	call   4400 <close>
+     76f:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     772:	83 ec 0c             	sub    $0xc,%esp
+     775:	68 f0 4d 00 00       	push   $0x4df0
+     77a:	e8 a9 3c 00 00       	call   4428 <unlink>
+     77f:	83 c4 10             	add    $0x10,%esp
+     782:	85 c0                	test   %eax,%eax
+     784:	79 1b                	jns    7a1 <writetest1+0x1e3>
+    printf(stdout, "unlink big failed\n");
+     786:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     78b:	83 ec 08             	sub    $0x8,%esp
+     78e:	68 94 4e 00 00       	push   $0x4e94
+     793:	50                   	push   %eax
+     794:	e8 43 3e 00 00       	call   45dc <printf>
+     799:	83 c4 10             	add    $0x10,%esp
+    exit();
+     79c:	e8 37 3c 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     7a1:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     7a6:	83 ec 08             	sub    $0x8,%esp
+     7a9:	68 a7 4e 00 00       	push   $0x4ea7
+     7ae:	50                   	push   %eax
+     7af:	e8 28 3e 00 00       	call   45dc <printf>
+     7b4:	83 c4 10             	add    $0x10,%esp
+}
+     7b7:	90                   	nop
+     7b8:	c9                   	leave
+     7b9:	c3                   	ret
+
+000007ba <createtest>:
+
+void
+createtest(void)
+{
+     7ba:	55                   	push   %ebp
+     7bb:	89 e5                	mov    %esp,%ebp
+     7bd:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     7c0:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     7c5:	83 ec 08             	sub    $0x8,%esp
+     7c8:	68 b8 4e 00 00       	push   $0x4eb8
+     7cd:	50                   	push   %eax
+     7ce:	e8 09 3e 00 00       	call   45dc <printf>
+     7d3:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     7d6:	c6 05 20 8c 00 00 61 	movb   $0x61,0x8c20
+  name[2] = '\0';
+     7dd:	c6 05 22 8c 00 00 00 	movb   $0x0,0x8c22
+  for(i = 0; i < 52; i++){
+     7e4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     7eb:	eb 35                	jmp    822 <createtest+0x68>
+    name[1] = '0' + i;
+     7ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7f0:	83 c0 30             	add    $0x30,%eax
+     7f3:	a2 21 8c 00 00       	mov    %al,0x8c21
+    fd = open(name, O_CREATE|O_RDWR);
+     7f8:	83 ec 08             	sub    $0x8,%esp
+     7fb:	68 02 02 00 00       	push   $0x202
+     800:	68 20 8c 00 00       	push   $0x8c20
+     805:	e8 0e 3c 00 00       	call   4418 <open>
+     80a:	83 c4 10             	add    $0x10,%esp
+     80d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     810:	83 ec 0c             	sub    $0xc,%esp
+     813:	ff 75 f0             	push   -0x10(%ebp)
+     816:	e8 e5 3b 00 00       	call   4400 <close>
+     81b:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     81e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     822:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     826:	7e c5                	jle    7ed <createtest+0x33>
+  }
+  name[0] = 'a';
+     828:	c6 05 20 8c 00 00 61 	movb   $0x61,0x8c20
+  name[2] = '\0';
+     82f:	c6 05 22 8c 00 00 00 	movb   $0x0,0x8c22
+  for(i = 0; i < 52; i++){
+     836:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     83d:	eb 1f                	jmp    85e <createtest+0xa4>
+    name[1] = '0' + i;
+     83f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     842:	83 c0 30             	add    $0x30,%eax
+     845:	a2 21 8c 00 00       	mov    %al,0x8c21
+    unlink(name);
+     84a:	83 ec 0c             	sub    $0xc,%esp
+     84d:	68 20 8c 00 00       	push   $0x8c20
+     852:	e8 d1 3b 00 00       	call   4428 <unlink>
+     857:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     85a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     85e:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     862:	7e db                	jle    83f <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     864:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     869:	83 ec 08             	sub    $0x8,%esp
+     86c:	68 e0 4e 00 00       	push   $0x4ee0
+     871:	50                   	push   %eax
+     872:	e8 65 3d 00 00       	call   45dc <printf>
+     877:	83 c4 10             	add    $0x10,%esp
+}
+     87a:	90                   	nop
+     87b:	c9                   	leave
+     87c:	c3                   	ret
+
+0000087d <dirtest>:
+
+void dirtest(void)
+{
+     87d:	55                   	push   %ebp
+     87e:	89 e5                	mov    %esp,%ebp
+     880:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     883:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     888:	83 ec 08             	sub    $0x8,%esp
+     88b:	68 06 4f 00 00       	push   $0x4f06
+     890:	50                   	push   %eax
+     891:	e8 46 3d 00 00       	call   45dc <printf>
+     896:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     899:	83 ec 0c             	sub    $0xc,%esp
+     89c:	68 12 4f 00 00       	push   $0x4f12
+     8a1:	e8 9a 3b 00 00       	call   4440 <mkdir>
+     8a6:	83 c4 10             	add    $0x10,%esp
+     8a9:	85 c0                	test   %eax,%eax
+     8ab:	79 1b                	jns    8c8 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     8ad:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     8b2:	83 ec 08             	sub    $0x8,%esp
+     8b5:	68 35 4b 00 00       	push   $0x4b35
+     8ba:	50                   	push   %eax
+     8bb:	e8 1c 3d 00 00       	call   45dc <printf>
+     8c0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8c3:	e8 10 3b 00 00       	call   43d8 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     8c8:	83 ec 0c             	sub    $0xc,%esp
+     8cb:	68 12 4f 00 00       	push   $0x4f12
+     8d0:	e8 73 3b 00 00       	call   4448 <chdir>
+     8d5:	83 c4 10             	add    $0x10,%esp
+     8d8:	85 c0                	test   %eax,%eax
+     8da:	79 1b                	jns    8f7 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     8dc:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     8e1:	83 ec 08             	sub    $0x8,%esp
+     8e4:	68 17 4f 00 00       	push   $0x4f17
+     8e9:	50                   	push   %eax
+     8ea:	e8 ed 3c 00 00       	call   45dc <printf>
+     8ef:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8f2:	e8 e1 3a 00 00       	call   43d8 <exit>
+  }
+
+  if(chdir("..") < 0){
+     8f7:	83 ec 0c             	sub    $0xc,%esp
+     8fa:	68 2a 4f 00 00       	push   $0x4f2a
+     8ff:	e8 44 3b 00 00       	call   4448 <chdir>
+     904:	83 c4 10             	add    $0x10,%esp
+     907:	85 c0                	test   %eax,%eax
+     909:	79 1b                	jns    926 <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     90b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     910:	83 ec 08             	sub    $0x8,%esp
+     913:	68 2d 4f 00 00       	push   $0x4f2d
+     918:	50                   	push   %eax
+     919:	e8 be 3c 00 00       	call   45dc <printf>
+     91e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     921:	e8 b2 3a 00 00       	call   43d8 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     926:	83 ec 0c             	sub    $0xc,%esp
+     929:	68 12 4f 00 00       	push   $0x4f12
+     92e:	e8 f5 3a 00 00       	call   4428 <unlink>
+     933:	83 c4 10             	add    $0x10,%esp
+     936:	85 c0                	test   %eax,%eax
+     938:	79 1b                	jns    955 <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     93a:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     93f:	83 ec 08             	sub    $0x8,%esp
+     942:	68 3e 4f 00 00       	push   $0x4f3e
+     947:	50                   	push   %eax
+     948:	e8 8f 3c 00 00       	call   45dc <printf>
+     94d:	83 c4 10             	add    $0x10,%esp
+    exit();
+     950:	e8 83 3a 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "mkdir test ok\n");
+     955:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     95a:	83 ec 08             	sub    $0x8,%esp
+     95d:	68 52 4f 00 00       	push   $0x4f52
+     962:	50                   	push   %eax
+     963:	e8 74 3c 00 00       	call   45dc <printf>
+     968:	83 c4 10             	add    $0x10,%esp
+}
+     96b:	90                   	nop
+     96c:	c9                   	leave
+     96d:	c3                   	ret
+
+0000096e <exectest>:
+
+void
+exectest(void)
+{
+     96e:	55                   	push   %ebp
+     96f:	89 e5                	mov    %esp,%ebp
+     971:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     974:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     979:	83 ec 08             	sub    $0x8,%esp
+     97c:	68 61 4f 00 00       	push   $0x4f61
+     981:	50                   	push   %eax
+     982:	e8 55 3c 00 00       	call   45dc <printf>
+     987:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     98a:	83 ec 08             	sub    $0x8,%esp
+     98d:	68 d4 6b 00 00       	push   $0x6bd4
+     992:	68 0c 4b 00 00       	push   $0x4b0c
+     997:	e8 74 3a 00 00       	call   4410 <exec>
+     99c:	83 c4 10             	add    $0x10,%esp
+     99f:	85 c0                	test   %eax,%eax
+     9a1:	79 1b                	jns    9be <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     9a3:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     9a8:	83 ec 08             	sub    $0x8,%esp
+     9ab:	68 6c 4f 00 00       	push   $0x4f6c
+     9b0:	50                   	push   %eax
+     9b1:	e8 26 3c 00 00       	call   45dc <printf>
+     9b6:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9b9:	e8 1a 3a 00 00       	call   43d8 <exit>
+  }
+}
+     9be:	90                   	nop
+     9bf:	c9                   	leave
+     9c0:	c3                   	ret
+
+000009c1 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     9c1:	55                   	push   %ebp
+     9c2:	89 e5                	mov    %esp,%ebp
+     9c4:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     9c7:	83 ec 0c             	sub    $0xc,%esp
+     9ca:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     9cd:	50                   	push   %eax
+     9ce:	e8 15 3a 00 00       	call   43e8 <pipe>
+     9d3:	83 c4 10             	add    $0x10,%esp
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	74 17                	je     9f1 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     9da:	83 ec 08             	sub    $0x8,%esp
+     9dd:	68 7e 4f 00 00       	push   $0x4f7e
+     9e2:	6a 01                	push   $0x1
+     9e4:	e8 f3 3b 00 00       	call   45dc <printf>
+     9e9:	83 c4 10             	add    $0x10,%esp
+    exit();
+     9ec:	e8 e7 39 00 00       	call   43d8 <exit>
+  }
+  pid = fork();
+     9f1:	e8 da 39 00 00       	call   43d0 <fork>
+     9f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     9f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     a00:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a04:	0f 85 89 00 00 00    	jne    a93 <pipe1+0xd2>
+    close(fds[0]);
+     a0a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     a0d:	83 ec 0c             	sub    $0xc,%esp
+     a10:	50                   	push   %eax
+     a11:	e8 ea 39 00 00       	call   4400 <close>
+     a16:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     a19:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     a20:	eb 66                	jmp    a88 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     a22:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     a29:	eb 19                	jmp    a44 <pipe1+0x83>
+        buf[i] = seq++;
+     a2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a2e:	8d 50 01             	lea    0x1(%eax),%edx
+     a31:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     a34:	89 c2                	mov    %eax,%edx
+     a36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     a39:	05 20 6c 00 00       	add    $0x6c20,%eax
+     a3e:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     a40:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     a44:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     a4b:	7e de                	jle    a2b <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     a4d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	68 09 04 00 00       	push   $0x409
+     a58:	68 20 6c 00 00       	push   $0x6c20
+     a5d:	50                   	push   %eax
+     a5e:	e8 95 39 00 00       	call   43f8 <write>
+     a63:	83 c4 10             	add    $0x10,%esp
+     a66:	3d 09 04 00 00       	cmp    $0x409,%eax
+     a6b:	74 17                	je     a84 <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     a6d:	83 ec 08             	sub    $0x8,%esp
+     a70:	68 8d 4f 00 00       	push   $0x4f8d
+     a75:	6a 01                	push   $0x1
+     a77:	e8 60 3b 00 00       	call   45dc <printf>
+     a7c:	83 c4 10             	add    $0x10,%esp
+        exit();
+     a7f:	e8 54 39 00 00       	call   43d8 <exit>
+    for(n = 0; n < 5; n++){
+     a84:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     a88:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     a8c:	7e 94                	jle    a22 <pipe1+0x61>
+      }
+    }
+    exit();
+     a8e:	e8 45 39 00 00       	call   43d8 <exit>
+  } else if(pid > 0){
+     a93:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     a97:	0f 8e f4 00 00 00    	jle    b91 <pipe1+0x1d0>
+    close(fds[1]);
+     a9d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     aa0:	83 ec 0c             	sub    $0xc,%esp
+     aa3:	50                   	push   %eax
+     aa4:	e8 57 39 00 00       	call   4400 <close>
+     aa9:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     aac:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     ab3:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     aba:	eb 66                	jmp    b22 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     abc:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     ac3:	eb 3b                	jmp    b00 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     ac5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ac8:	05 20 6c 00 00       	add    $0x6c20,%eax
+     acd:	0f b6 00             	movzbl (%eax),%eax
+     ad0:	0f be c8             	movsbl %al,%ecx
+     ad3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ad6:	8d 50 01             	lea    0x1(%eax),%edx
+     ad9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     adc:	31 c8                	xor    %ecx,%eax
+     ade:	0f b6 c0             	movzbl %al,%eax
+     ae1:	85 c0                	test   %eax,%eax
+     ae3:	74 17                	je     afc <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     ae5:	83 ec 08             	sub    $0x8,%esp
+     ae8:	68 9b 4f 00 00       	push   $0x4f9b
+     aed:	6a 01                	push   $0x1
+     aef:	e8 e8 3a 00 00       	call   45dc <printf>
+     af4:	83 c4 10             	add    $0x10,%esp
+     af7:	e9 ac 00 00 00       	jmp    ba8 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     afc:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     b00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     b03:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     b06:	7c bd                	jl     ac5 <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     b08:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     b0b:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     b0e:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     b11:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     b14:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     b19:	76 07                	jbe    b22 <pipe1+0x161>
+        cc = sizeof(buf);
+     b1b:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     b22:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b25:	83 ec 04             	sub    $0x4,%esp
+     b28:	ff 75 e8             	push   -0x18(%ebp)
+     b2b:	68 20 6c 00 00       	push   $0x6c20
+     b30:	50                   	push   %eax
+     b31:	e8 ba 38 00 00       	call   43f0 <read>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     b40:	0f 8f 76 ff ff ff    	jg     abc <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     b46:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     b4d:	74 1a                	je     b69 <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b4f:	83 ec 04             	sub    $0x4,%esp
+     b52:	ff 75 e4             	push   -0x1c(%ebp)
+     b55:	68 a9 4f 00 00       	push   $0x4fa9
+     b5a:	6a 01                	push   $0x1
+     b5c:	e8 7b 3a 00 00       	call   45dc <printf>
+     b61:	83 c4 10             	add    $0x10,%esp
+      exit();
+     b64:	e8 6f 38 00 00       	call   43d8 <exit>
+    }
+    close(fds[0]);
+     b69:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     b6c:	83 ec 0c             	sub    $0xc,%esp
+     b6f:	50                   	push   %eax
+     b70:	e8 8b 38 00 00       	call   4400 <close>
+     b75:	83 c4 10             	add    $0x10,%esp
+    wait();
+     b78:	e8 63 38 00 00       	call   43e0 <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     b7d:	83 ec 08             	sub    $0x8,%esp
+     b80:	68 cf 4f 00 00       	push   $0x4fcf
+     b85:	6a 01                	push   $0x1
+     b87:	e8 50 3a 00 00       	call   45dc <printf>
+     b8c:	83 c4 10             	add    $0x10,%esp
+     b8f:	eb 17                	jmp    ba8 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     b91:	83 ec 08             	sub    $0x8,%esp
+     b94:	68 c0 4f 00 00       	push   $0x4fc0
+     b99:	6a 01                	push   $0x1
+     b9b:	e8 3c 3a 00 00       	call   45dc <printf>
+     ba0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ba3:	e8 30 38 00 00       	call   43d8 <exit>
+}
+     ba8:	c9                   	leave
+     ba9:	c3                   	ret
+
+00000baa <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+     baa:	55                   	push   %ebp
+     bab:	89 e5                	mov    %esp,%ebp
+     bad:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+     bb0:	83 ec 08             	sub    $0x8,%esp
+     bb3:	68 d9 4f 00 00       	push   $0x4fd9
+     bb8:	6a 01                	push   $0x1
+     bba:	e8 1d 3a 00 00       	call   45dc <printf>
+     bbf:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+     bc2:	e8 09 38 00 00       	call   43d0 <fork>
+     bc7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+     bca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     bce:	75 03                	jne    bd3 <preempt+0x29>
+    for(;;)
+     bd0:	90                   	nop
+     bd1:	eb fd                	jmp    bd0 <preempt+0x26>
+      ;
+
+  pid2 = fork();
+     bd3:	e8 f8 37 00 00       	call   43d0 <fork>
+     bd8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+     bdb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     bdf:	75 03                	jne    be4 <preempt+0x3a>
+    for(;;)
+     be1:	90                   	nop
+     be2:	eb fd                	jmp    be1 <preempt+0x37>
+      ;
+
+  pipe(pfds);
+     be4:	83 ec 0c             	sub    $0xc,%esp
+     be7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     bea:	50                   	push   %eax
+     beb:	e8 f8 37 00 00       	call   43e8 <pipe>
+     bf0:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+     bf3:	e8 d8 37 00 00       	call   43d0 <fork>
+     bf8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+     bfb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bff:	75 4e                	jne    c4f <preempt+0xa5>
+    close(pfds[0]);
+     c01:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c04:	83 ec 0c             	sub    $0xc,%esp
+     c07:	50                   	push   %eax
+     c08:	e8 f3 37 00 00       	call   4400 <close>
+     c0d:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+     c10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c13:	83 ec 04             	sub    $0x4,%esp
+     c16:	6a 01                	push   $0x1
+     c18:	68 e3 4f 00 00       	push   $0x4fe3
+     c1d:	50                   	push   %eax
+     c1e:	e8 d5 37 00 00       	call   43f8 <write>
+     c23:	83 c4 10             	add    $0x10,%esp
+     c26:	83 f8 01             	cmp    $0x1,%eax
+     c29:	74 12                	je     c3d <preempt+0x93>
+      printf(1, "preempt write error");
+     c2b:	83 ec 08             	sub    $0x8,%esp
+     c2e:	68 e5 4f 00 00       	push   $0x4fe5
+     c33:	6a 01                	push   $0x1
+     c35:	e8 a2 39 00 00       	call   45dc <printf>
+     c3a:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+     c3d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c40:	83 ec 0c             	sub    $0xc,%esp
+     c43:	50                   	push   %eax
+     c44:	e8 b7 37 00 00       	call   4400 <close>
+     c49:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+     c4c:	90                   	nop
+     c4d:	eb fd                	jmp    c4c <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+     c4f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c52:	83 ec 0c             	sub    $0xc,%esp
+     c55:	50                   	push   %eax
+     c56:	e8 a5 37 00 00       	call   4400 <close>
+     c5b:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+     c5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c61:	83 ec 04             	sub    $0x4,%esp
+     c64:	68 00 20 00 00       	push   $0x2000
+     c69:	68 20 6c 00 00       	push   $0x6c20
+     c6e:	50                   	push   %eax
+     c6f:	e8 7c 37 00 00       	call   43f0 <read>
+     c74:	83 c4 10             	add    $0x10,%esp
+     c77:	83 f8 01             	cmp    $0x1,%eax
+     c7a:	74 14                	je     c90 <preempt+0xe6>
+    printf(1, "preempt read error");
+     c7c:	83 ec 08             	sub    $0x8,%esp
+     c7f:	68 f9 4f 00 00       	push   $0x4ff9
+     c84:	6a 01                	push   $0x1
+     c86:	e8 51 39 00 00       	call   45dc <printf>
+     c8b:	83 c4 10             	add    $0x10,%esp
+     c8e:	eb 7e                	jmp    d0e <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+     c90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c93:	83 ec 0c             	sub    $0xc,%esp
+     c96:	50                   	push   %eax
+     c97:	e8 64 37 00 00       	call   4400 <close>
+     c9c:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+     c9f:	83 ec 08             	sub    $0x8,%esp
+     ca2:	68 0c 50 00 00       	push   $0x500c
+     ca7:	6a 01                	push   $0x1
+     ca9:	e8 2e 39 00 00       	call   45dc <printf>
+     cae:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+     cb1:	83 ec 0c             	sub    $0xc,%esp
+     cb4:	ff 75 f4             	push   -0xc(%ebp)
+     cb7:	e8 4c 37 00 00       	call   4408 <kill>
+     cbc:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+     cbf:	83 ec 0c             	sub    $0xc,%esp
+     cc2:	ff 75 f0             	push   -0x10(%ebp)
+     cc5:	e8 3e 37 00 00       	call   4408 <kill>
+     cca:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+     ccd:	83 ec 0c             	sub    $0xc,%esp
+     cd0:	ff 75 ec             	push   -0x14(%ebp)
+     cd3:	e8 30 37 00 00       	call   4408 <kill>
+     cd8:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+     cdb:	83 ec 08             	sub    $0x8,%esp
+     cde:	68 15 50 00 00       	push   $0x5015
+     ce3:	6a 01                	push   $0x1
+     ce5:	e8 f2 38 00 00       	call   45dc <printf>
+     cea:	83 c4 10             	add    $0x10,%esp
+  wait();
+     ced:	e8 ee 36 00 00       	call   43e0 <wait>
+  wait();
+     cf2:	e8 e9 36 00 00       	call   43e0 <wait>
+  wait();
+     cf7:	e8 e4 36 00 00       	call   43e0 <wait>
+  printf(1, "preempt ok\n");
+     cfc:	83 ec 08             	sub    $0x8,%esp
+     cff:	68 1e 50 00 00       	push   $0x501e
+     d04:	6a 01                	push   $0x1
+     d06:	e8 d1 38 00 00       	call   45dc <printf>
+     d0b:	83 c4 10             	add    $0x10,%esp
+}
+     d0e:	c9                   	leave
+     d0f:	c3                   	ret
+
+00000d10 <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+     d16:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d1d:	eb 4f                	jmp    d6e <exitwait+0x5e>
+    pid = fork();
+     d1f:	e8 ac 36 00 00       	call   43d0 <fork>
+     d24:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+     d27:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d2b:	79 14                	jns    d41 <exitwait+0x31>
+      printf(1, "fork failed\n");
+     d2d:	83 ec 08             	sub    $0x8,%esp
+     d30:	68 ad 4b 00 00       	push   $0x4bad
+     d35:	6a 01                	push   $0x1
+     d37:	e8 a0 38 00 00       	call   45dc <printf>
+     d3c:	83 c4 10             	add    $0x10,%esp
+      return;
+     d3f:	eb 45                	jmp    d86 <exitwait+0x76>
+    }
+    if(pid){
+     d41:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d45:	74 1e                	je     d65 <exitwait+0x55>
+      if(wait() != pid){
+     d47:	e8 94 36 00 00       	call   43e0 <wait>
+     d4c:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d4f:	74 19                	je     d6a <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+     d51:	83 ec 08             	sub    $0x8,%esp
+     d54:	68 2a 50 00 00       	push   $0x502a
+     d59:	6a 01                	push   $0x1
+     d5b:	e8 7c 38 00 00       	call   45dc <printf>
+     d60:	83 c4 10             	add    $0x10,%esp
+        return;
+     d63:	eb 21                	jmp    d86 <exitwait+0x76>
+      }
+    } else {
+      exit();
+     d65:	e8 6e 36 00 00       	call   43d8 <exit>
+  for(i = 0; i < 100; i++){
+     d6a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     d6e:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     d72:	7e ab                	jle    d1f <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+     d74:	83 ec 08             	sub    $0x8,%esp
+     d77:	68 3a 50 00 00       	push   $0x503a
+     d7c:	6a 01                	push   $0x1
+     d7e:	e8 59 38 00 00       	call   45dc <printf>
+     d83:	83 c4 10             	add    $0x10,%esp
+}
+     d86:	c9                   	leave
+     d87:	c3                   	ret
+
+00000d88 <badpid>:
+
+// Calls that name a process must reject pids no process has.
+void
+badpid(void)
+{
+     d88:	55                   	push   %ebp
+     d89:	89 e5                	mov    %esp,%ebp
+     d8b:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "bad pid test\n");
+     d8e:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     d93:	83 ec 08             	sub    $0x8,%esp
+     d96:	68 47 50 00 00       	push   $0x5047
+     d9b:	50                   	push   %eax
+     d9c:	e8 3b 38 00 00       	call   45dc <printf>
+     da1:	83 c4 10             	add    $0x10,%esp
+  if(kill(-1) != -1 || kill(0) != -1 || setpriority(-5, 1) != -1 ||
+     da4:	83 ec 0c             	sub    $0xc,%esp
+     da7:	6a ff                	push   $0xffffffff
+     da9:	e8 5a 36 00 00       	call   4408 <kill>
+     dae:	83 c4 10             	add    $0x10,%esp
+     db1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     db4:	75 3b                	jne    df1 <badpid+0x69>
+     db6:	83 ec 0c             	sub    $0xc,%esp
+     db9:	6a 00                	push   $0x0
+     dbb:	e8 48 36 00 00       	call   4408 <kill>
+     dc0:	83 c4 10             	add    $0x10,%esp
+     dc3:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dc6:	75 29                	jne    df1 <badpid+0x69>
+     dc8:	83 ec 08             	sub    $0x8,%esp
+     dcb:	6a 01                	push   $0x1
+     dcd:	6a fb                	push   $0xfffffffb
+     dcf:	e8 b4 36 00 00       	call   4488 <setpriority>
+     dd4:	83 c4 10             	add    $0x10,%esp
+     dd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dda:	75 15                	jne    df1 <badpid+0x69>
+     getaffinity(-1000) != -1){
+     ddc:	83 ec 0c             	sub    $0xc,%esp
+     ddf:	68 18 fc ff ff       	push   $0xfffffc18
+     de4:	e8 af 36 00 00       	call   4498 <getaffinity>
+     de9:	83 c4 10             	add    $0x10,%esp
+  if(kill(-1) != -1 || kill(0) != -1 || setpriority(-5, 1) != -1 ||
+     dec:	83 f8 ff             	cmp    $0xffffffff,%eax
+     def:	74 1b                	je     e0c <badpid+0x84>
+    printf(stdout, "bad pid accepted\n");
+     df1:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     df6:	83 ec 08             	sub    $0x8,%esp
+     df9:	68 55 50 00 00       	push   $0x5055
+     dfe:	50                   	push   %eax
+     dff:	e8 d8 37 00 00       	call   45dc <printf>
+     e04:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e07:	e8 cc 35 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "bad pid ok\n");
+     e0c:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     e11:	83 ec 08             	sub    $0x8,%esp
+     e14:	68 67 50 00 00       	push   $0x5067
+     e19:	50                   	push   %eax
+     e1a:	e8 bd 37 00 00       	call   45dc <printf>
+     e1f:	83 c4 10             	add    $0x10,%esp
+}
+     e22:	90                   	nop
+     e23:	c9                   	leave
+     e24:	c3                   	ret
+
+00000e25 <waitpidtest>:
+
+// waitpid() reaps the child asked for and leaves the others;
+// WNOHANG does not wait for a child that is still running.
+void
+waitpidtest(void)
+{
+     e25:	55                   	push   %ebp
+     e26:	89 e5                	mov    %esp,%ebp
+     e28:	83 ec 38             	sub    $0x38,%esp
+  int pids[5], fd[2], i;
+  char c;
+
+  printf(stdout, "waitpid test\n");
+     e2b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     e30:	83 ec 08             	sub    $0x8,%esp
+     e33:	68 73 50 00 00       	push   $0x5073
+     e38:	50                   	push   %eax
+     e39:	e8 9e 37 00 00       	call   45dc <printf>
+     e3e:	83 c4 10             	add    $0x10,%esp
+  if(pipe(fd) < 0){
+     e41:	83 ec 0c             	sub    $0xc,%esp
+     e44:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     e47:	50                   	push   %eax
+     e48:	e8 9b 35 00 00       	call   43e8 <pipe>
+     e4d:	83 c4 10             	add    $0x10,%esp
+     e50:	85 c0                	test   %eax,%eax
+     e52:	79 1b                	jns    e6f <waitpidtest+0x4a>
+    printf(stdout, "pipe failed\n");
+     e54:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     e59:	83 ec 08             	sub    $0x8,%esp
+     e5c:	68 81 50 00 00       	push   $0x5081
+     e61:	50                   	push   %eax
+     e62:	e8 75 37 00 00       	call   45dc <printf>
+     e67:	83 c4 10             	add    $0x10,%esp
+    exit();
+     e6a:	e8 69 35 00 00       	call   43d8 <exit>
+  }
+  for(i = 0; i < 5; i++){
+     e6f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     e76:	eb 6a                	jmp    ee2 <waitpidtest+0xbd>
+    if((pids[i] = fork()) < 0){
+     e78:	e8 53 35 00 00       	call   43d0 <fork>
+     e7d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     e80:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+     e84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     e87:	8b 44 85 e0          	mov    -0x20(%ebp,%eax,4),%eax
+     e8b:	85 c0                	test   %eax,%eax
+     e8d:	79 1b                	jns    eaa <waitpidtest+0x85>
+      printf(stdout, "fork failed\n");
+     e8f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     e94:	83 ec 08             	sub    $0x8,%esp
+     e97:	68 ad 4b 00 00       	push   $0x4bad
+     e9c:	50                   	push   %eax
+     e9d:	e8 3a 37 00 00       	call   45dc <printf>
+     ea2:	83 c4 10             	add    $0x10,%esp
+      exit();
+     ea5:	e8 2e 35 00 00       	call   43d8 <exit>
+    }
+    if(pids[i] == 0){
+     eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ead:	8b 44 85 e0          	mov    -0x20(%ebp,%eax,4),%eax
+     eb1:	85 c0                	test   %eax,%eax
+     eb3:	75 29                	jne    ede <waitpidtest+0xb9>
+      close(fd[1]);
+     eb5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+     ebb:	50                   	push   %eax
+     ebc:	e8 3f 35 00 00       	call   4400 <close>
+     ec1:	83 c4 10             	add    $0x10,%esp
+      read(fd[0], &c, 1);
+     ec4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     ec7:	83 ec 04             	sub    $0x4,%esp
+     eca:	6a 01                	push   $0x1
+     ecc:	8d 55 d7             	lea    -0x29(%ebp),%edx
+     ecf:	52                   	push   %edx
+     ed0:	50                   	push   %eax
+     ed1:	e8 1a 35 00 00       	call   43f0 <read>
+     ed6:	83 c4 10             	add    $0x10,%esp
+      exit();
+     ed9:	e8 fa 34 00 00       	call   43d8 <exit>
+  for(i = 0; i < 5; i++){
+     ede:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     ee2:	83 7d f4 04          	cmpl   $0x4,-0xc(%ebp)
+     ee6:	7e 90                	jle    e78 <waitpidtest+0x53>
+    }
+  }
+  close(fd[0]);
+     ee8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     eeb:	83 ec 0c             	sub    $0xc,%esp
+     eee:	50                   	push   %eax
+     eef:	e8 0c 35 00 00       	call   4400 <close>
+     ef4:	83 c4 10             	add    $0x10,%esp
+
+  if(waitpid(pids[2], WNOHANG) != 0){
+     ef7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     efa:	83 ec 08             	sub    $0x8,%esp
+     efd:	6a 01                	push   $0x1
+     eff:	50                   	push   %eax
+     f00:	e8 d3 35 00 00       	call   44d8 <waitpid>
+     f05:	83 c4 10             	add    $0x10,%esp
+     f08:	85 c0                	test   %eax,%eax
+     f0a:	74 1b                	je     f27 <waitpidtest+0x102>
+    printf(stdout, "waitpid WNOHANG reaped a running child\n");
+     f0c:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     f11:	83 ec 08             	sub    $0x8,%esp
+     f14:	68 90 50 00 00       	push   $0x5090
+     f19:	50                   	push   %eax
+     f1a:	e8 bd 36 00 00       	call   45dc <printf>
+     f1f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f22:	e8 b1 34 00 00       	call   43d8 <exit>
+  }
+  if(waitpid(getpid(), 0) != -1){
+     f27:	e8 2c 35 00 00       	call   4458 <getpid>
+     f2c:	83 ec 08             	sub    $0x8,%esp
+     f2f:	6a 00                	push   $0x0
+     f31:	50                   	push   %eax
+     f32:	e8 a1 35 00 00       	call   44d8 <waitpid>
+     f37:	83 c4 10             	add    $0x10,%esp
+     f3a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f3d:	74 1b                	je     f5a <waitpidtest+0x135>
+    printf(stdout, "waitpid reaped a non-child\n");
+     f3f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     f44:	83 ec 08             	sub    $0x8,%esp
+     f47:	68 b8 50 00 00       	push   $0x50b8
+     f4c:	50                   	push   %eax
+     f4d:	e8 8a 36 00 00       	call   45dc <printf>
+     f52:	83 c4 10             	add    $0x10,%esp
+    exit();
+     f55:	e8 7e 34 00 00       	call   43d8 <exit>
+  }
+  for(i = 0; i < 5; i++)
+     f5a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f61:	eb 1a                	jmp    f7d <waitpidtest+0x158>
+    write(fd[1], "x", 1);
+     f63:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     f66:	83 ec 04             	sub    $0x4,%esp
+     f69:	6a 01                	push   $0x1
+     f6b:	68 e3 4f 00 00       	push   $0x4fe3
+     f70:	50                   	push   %eax
+     f71:	e8 82 34 00 00       	call   43f8 <write>
+     f76:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 5; i++)
+     f79:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     f7d:	83 7d f4 04          	cmpl   $0x4,-0xc(%ebp)
+     f81:	7e e0                	jle    f63 <waitpidtest+0x13e>
+  close(fd[1]);
+     f83:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     f86:	83 ec 0c             	sub    $0xc,%esp
+     f89:	50                   	push   %eax
+     f8a:	e8 71 34 00 00       	call   4400 <close>
+     f8f:	83 c4 10             	add    $0x10,%esp
+  for(i = 4; i >= 0; i--){
+     f92:	c7 45 f4 04 00 00 00 	movl   $0x4,-0xc(%ebp)
+     f99:	eb 41                	jmp    fdc <waitpidtest+0x1b7>
+    if(waitpid(pids[i], 0) != pids[i]){
+     f9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f9e:	8b 44 85 e0          	mov    -0x20(%ebp,%eax,4),%eax
+     fa2:	83 ec 08             	sub    $0x8,%esp
+     fa5:	6a 00                	push   $0x0
+     fa7:	50                   	push   %eax
+     fa8:	e8 2b 35 00 00       	call   44d8 <waitpid>
+     fad:	83 c4 10             	add    $0x10,%esp
+     fb0:	89 c2                	mov    %eax,%edx
+     fb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fb5:	8b 44 85 e0          	mov    -0x20(%ebp,%eax,4),%eax
+     fb9:	39 c2                	cmp    %eax,%edx
+     fbb:	74 1b                	je     fd8 <waitpidtest+0x1b3>
+      printf(stdout, "waitpid wrong pid\n");
+     fbd:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+     fc2:	83 ec 08             	sub    $0x8,%esp
+     fc5:	68 d4 50 00 00       	push   $0x50d4
+     fca:	50                   	push   %eax
+     fcb:	e8 0c 36 00 00       	call   45dc <printf>
+     fd0:	83 c4 10             	add    $0x10,%esp
+      exit();
+     fd3:	e8 00 34 00 00       	call   43d8 <exit>
+  for(i = 4; i >= 0; i--){
+     fd8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     fdc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     fe0:	79 b9                	jns    f9b <waitpidtest+0x176>
+    }
+  }
+  if(wait() != -1 || waitpid(-1, WNOHANG) != -1){
+     fe2:	e8 f9 33 00 00       	call   43e0 <wait>
+     fe7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fea:	75 14                	jne    1000 <waitpidtest+0x1db>
+     fec:	83 ec 08             	sub    $0x8,%esp
+     fef:	6a 01                	push   $0x1
+     ff1:	6a ff                	push   $0xffffffff
+     ff3:	e8 e0 34 00 00       	call   44d8 <waitpid>
+     ff8:	83 c4 10             	add    $0x10,%esp
+     ffb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ffe:	74 1b                	je     101b <waitpidtest+0x1f6>
+    printf(stdout, "waitpid found a reaped child\n");
+    1000:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    1005:	83 ec 08             	sub    $0x8,%esp
+    1008:	68 e7 50 00 00       	push   $0x50e7
+    100d:	50                   	push   %eax
+    100e:	e8 c9 35 00 00       	call   45dc <printf>
+    1013:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1016:	e8 bd 33 00 00       	call   43d8 <exit>
+  }
+  printf(stdout, "waitpid ok\n");
+    101b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    1020:	83 ec 08             	sub    $0x8,%esp
+    1023:	68 05 51 00 00       	push   $0x5105
+    1028:	50                   	push   %eax
+    1029:	e8 ae 35 00 00       	call   45dc <printf>
+    102e:	83 c4 10             	add    $0x10,%esp
+}
+    1031:	90                   	nop
+    1032:	c9                   	leave
+    1033:	c3                   	ret
+
+00001034 <mem>:
+
+void
+mem(void)
+{
+    1034:	55                   	push   %ebp
+    1035:	89 e5                	mov    %esp,%ebp
+    1037:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    103a:	83 ec 08             	sub    $0x8,%esp
+    103d:	68 11 51 00 00       	push   $0x5111
+    1042:	6a 01                	push   $0x1
+    1044:	e8 93 35 00 00       	call   45dc <printf>
+    1049:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    104c:	e8 07 34 00 00       	call   4458 <getpid>
+    1051:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    1054:	e8 77 33 00 00       	call   43d0 <fork>
+    1059:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    105c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1060:	0f 85 b7 00 00 00    	jne    111d <mem+0xe9>
+    m1 = 0;
+    1066:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    106d:	eb 0e                	jmp    107d <mem+0x49>
+      *(char**)m2 = m1;
+    106f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1072:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    1075:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    1077:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    107a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    107d:	83 ec 0c             	sub    $0xc,%esp
+    1080:	68 11 27 00 00       	push   $0x2711
+    1085:	e8 a7 39 00 00       	call   4a31 <malloc>
+    108a:	83 c4 10             	add    $0x10,%esp
+    108d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1090:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1094:	75 d9                	jne    106f <mem+0x3b>
+    }
+    while(m1){
+    1096:	eb 1c                	jmp    10b4 <mem+0x80>
+      m2 = *(char**)m1;
+    1098:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    109b:	8b 00                	mov    (%eax),%eax
+    109d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    10a0:	83 ec 0c             	sub    $0xc,%esp
+    10a3:	ff 75 f4             	push   -0xc(%ebp)
+    10a6:	e8 31 39 00 00       	call   49dc <free>
+    10ab:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    10ae:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    10b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    10b4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10b8:	75 de                	jne    1098 <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    10ba:	83 ec 0c             	sub    $0xc,%esp
+    10bd:	68 00 50 00 00       	push   $0x5000
+    10c2:	e8 6a 39 00 00       	call   4a31 <malloc>
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    10cd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10d1:	75 25                	jne    10f8 <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    10d3:	83 ec 08             	sub    $0x8,%esp
+    10d6:	68 1b 51 00 00       	push   $0x511b
+    10db:	6a 01                	push   $0x1
+    10dd:	e8 fa 34 00 00       	call   45dc <printf>
+    10e2:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    10e5:	83 ec 0c             	sub    $0xc,%esp
+    10e8:	ff 75 f0             	push   -0x10(%ebp)
+    10eb:	e8 18 33 00 00       	call   4408 <kill>
+    10f0:	83 c4 10             	add    $0x10,%esp
+      exit();
+    10f3:	e8 e0 32 00 00       	call   43d8 <exit>
+    }
+    free(m1);
+    10f8:	83 ec 0c             	sub    $0xc,%esp
+    10fb:	ff 75 f4             	push   -0xc(%ebp)
+    10fe:	e8 d9 38 00 00       	call   49dc <free>
+    1103:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    1106:	83 ec 08             	sub    $0x8,%esp
+    1109:	68 35 51 00 00       	push   $0x5135
+    110e:	6a 01                	push   $0x1
+    1110:	e8 c7 34 00 00       	call   45dc <printf>
+    1115:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1118:	e8 bb 32 00 00       	call   43d8 <exit>
+  } else {
+    wait();
+    111d:	e8 be 32 00 00       	call   43e0 <wait>
+  }
+}
+    1122:	90                   	nop
+    1123:	c9                   	leave
+    1124:	c3                   	ret
+
+00001125 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    1125:	55                   	push   %ebp
+    1126:	89 e5                	mov    %esp,%ebp
+    1128:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    112b:	83 ec 08             	sub    $0x8,%esp
+    112e:	68 3d 51 00 00       	push   $0x513d
+    1133:	6a 01                	push   $0x1
+    1135:	e8 a2 34 00 00       	call   45dc <printf>
+    113a:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    113d:	83 ec 0c             	sub    $0xc,%esp
+    1140:	68 4c 51 00 00       	push   $0x514c
+    1145:	e8 de 32 00 00       	call   4428 <unlink>
+    114a:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    114d:	83 ec 08             	sub    $0x8,%esp
+    1150:	68 02 02 00 00       	push   $0x202
+    1155:	68 4c 51 00 00       	push   $0x514c
+    115a:	e8 b9 32 00 00       	call   4418 <open>
+    115f:	83 c4 10             	add    $0x10,%esp
+    1162:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1165:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1169:	79 17                	jns    1182 <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    116b:	83 ec 08             	sub    $0x8,%esp
+    116e:	68 58 51 00 00       	push   $0x5158
+    1173:	6a 01                	push   $0x1
+    1175:	e8 62 34 00 00       	call   45dc <printf>
+    117a:	83 c4 10             	add    $0x10,%esp
+    return;
+    117d:	e9 84 01 00 00       	jmp    1306 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    1182:	e8 49 32 00 00       	call   43d0 <fork>
+    1187:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    118a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    118e:	75 07                	jne    1197 <sharedfd+0x72>
+    1190:	b8 63 00 00 00       	mov    $0x63,%eax
+    1195:	eb 05                	jmp    119c <sharedfd+0x77>
+    1197:	b8 70 00 00 00       	mov    $0x70,%eax
+    119c:	83 ec 04             	sub    $0x4,%esp
+    119f:	6a 0a                	push   $0xa
+    11a1:	50                   	push   %eax
+    11a2:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    11a5:	50                   	push   %eax
+    11a6:	e8 61 30 00 00       	call   420c <memset>
+    11ab:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    11ae:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11b5:	eb 31                	jmp    11e8 <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    11b7:	83 ec 04             	sub    $0x4,%esp
+    11ba:	6a 0a                	push   $0xa
+    11bc:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    11bf:	50                   	push   %eax
+    11c0:	ff 75 e8             	push   -0x18(%ebp)
+    11c3:	e8 30 32 00 00       	call   43f8 <write>
+    11c8:	83 c4 10             	add    $0x10,%esp
+    11cb:	83 f8 0a             	cmp    $0xa,%eax
+    11ce:	74 14                	je     11e4 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    11d0:	83 ec 08             	sub    $0x8,%esp
+    11d3:	68 84 51 00 00       	push   $0x5184
+    11d8:	6a 01                	push   $0x1
+    11da:	e8 fd 33 00 00       	call   45dc <printf>
+    11df:	83 c4 10             	add    $0x10,%esp
+      break;
+    11e2:	eb 0d                	jmp    11f1 <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    11e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    11e8:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    11ef:	7e c6                	jle    11b7 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    11f1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    11f5:	75 05                	jne    11fc <sharedfd+0xd7>
+    exit();
+    11f7:	e8 dc 31 00 00       	call   43d8 <exit>
+  else
+    wait();
+    11fc:	e8 df 31 00 00       	call   43e0 <wait>
+  close(fd);
+    1201:	83 ec 0c             	sub    $0xc,%esp
+    1204:	ff 75 e8             	push   -0x18(%ebp)
+    1207:	e8 f4 31 00 00       	call   4400 <close>
+    120c:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    120f:	83 ec 08             	sub    $0x8,%esp
+    1212:	6a 00                	push   $0x0
+    1214:	68 4c 51 00 00       	push   $0x514c
+    1219:	e8 fa 31 00 00       	call   4418 <open>
+    121e:	83 c4 10             	add    $0x10,%esp
+    1221:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1224:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1228:	79 17                	jns    1241 <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    122a:	83 ec 08             	sub    $0x8,%esp
+    122d:	68 a4 51 00 00       	push   $0x51a4
+    1232:	6a 01                	push   $0x1
+    1234:	e8 a3 33 00 00       	call   45dc <printf>
+    1239:	83 c4 10             	add    $0x10,%esp
+    return;
+    123c:	e9 c5 00 00 00       	jmp    1306 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    1241:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1248:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    124b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    124e:	eb 3b                	jmp    128b <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    1250:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1257:	eb 2a                	jmp    1283 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    1259:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    125c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    125f:	01 d0                	add    %edx,%eax
+    1261:	0f b6 00             	movzbl (%eax),%eax
+    1264:	3c 63                	cmp    $0x63,%al
+    1266:	75 04                	jne    126c <sharedfd+0x147>
+        nc++;
+    1268:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    126c:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    126f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1272:	01 d0                	add    %edx,%eax
+    1274:	0f b6 00             	movzbl (%eax),%eax
+    1277:	3c 70                	cmp    $0x70,%al
+    1279:	75 04                	jne    127f <sharedfd+0x15a>
+        np++;
+    127b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    127f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1286:	83 f8 09             	cmp    $0x9,%eax
+    1289:	76 ce                	jbe    1259 <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    128b:	83 ec 04             	sub    $0x4,%esp
+    128e:	6a 0a                	push   $0xa
+    1290:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1293:	50                   	push   %eax
+    1294:	ff 75 e8             	push   -0x18(%ebp)
+    1297:	e8 54 31 00 00       	call   43f0 <read>
+    129c:	83 c4 10             	add    $0x10,%esp
+    129f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    12a2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    12a6:	7f a8                	jg     1250 <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    12a8:	83 ec 0c             	sub    $0xc,%esp
+    12ab:	ff 75 e8             	push   -0x18(%ebp)
+    12ae:	e8 4d 31 00 00       	call   4400 <close>
+    12b3:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    12b6:	83 ec 0c             	sub    $0xc,%esp
+    12b9:	68 4c 51 00 00       	push   $0x514c
+    12be:	e8 65 31 00 00       	call   4428 <unlink>
+    12c3:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    12c6:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    12cd:	75 1d                	jne    12ec <sharedfd+0x1c7>
+    12cf:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    12d6:	75 14                	jne    12ec <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    12d8:	83 ec 08             	sub    $0x8,%esp
+    12db:	68 cf 51 00 00       	push   $0x51cf
+    12e0:	6a 01                	push   $0x1
+    12e2:	e8 f5 32 00 00       	call   45dc <printf>
+    12e7:	83 c4 10             	add    $0x10,%esp
+    12ea:	eb 1a                	jmp    1306 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    12ec:	ff 75 ec             	push   -0x14(%ebp)
+    12ef:	ff 75 f0             	push   -0x10(%ebp)
+    12f2:	68 dc 51 00 00       	push   $0x51dc
+    12f7:	6a 01                	push   $0x1
+    12f9:	e8 de 32 00 00       	call   45dc <printf>
+    12fe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1301:	e8 d2 30 00 00       	call   43d8 <exit>
+  }
+}
+    1306:	c9                   	leave
+    1307:	c3                   	ret
+
+00001308 <fourfiles>:
+
+// four processes write different files at the same
+// time, to test block allocation.
+void
+fourfiles(void)
+{
+    1308:	55                   	push   %ebp
+    1309:	89 e5                	mov    %esp,%ebp
+    130b:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, j, n, total, pi;
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    130e:	c7 45 c8 f1 51 00 00 	movl   $0x51f1,-0x38(%ebp)
+    1315:	c7 45 cc f4 51 00 00 	movl   $0x51f4,-0x34(%ebp)
+    131c:	c7 45 d0 f7 51 00 00 	movl   $0x51f7,-0x30(%ebp)
+    1323:	c7 45 d4 fa 51 00 00 	movl   $0x51fa,-0x2c(%ebp)
+  char *fname;
+
+  printf(1, "fourfiles test\n");
+    132a:	83 ec 08             	sub    $0x8,%esp
+    132d:	68 fd 51 00 00       	push   $0x51fd
+    1332:	6a 01                	push   $0x1
+    1334:	e8 a3 32 00 00       	call   45dc <printf>
+    1339:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    133c:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1343:	e9 f0 00 00 00       	jmp    1438 <fourfiles+0x130>
+    fname = names[pi];
+    1348:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    134b:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    134f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    unlink(fname);
+    1352:	83 ec 0c             	sub    $0xc,%esp
+    1355:	ff 75 e4             	push   -0x1c(%ebp)
+    1358:	e8 cb 30 00 00       	call   4428 <unlink>
+    135d:	83 c4 10             	add    $0x10,%esp
+
+    pid = fork();
+    1360:	e8 6b 30 00 00       	call   43d0 <fork>
+    1365:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    if(pid < 0){
+    1368:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    136c:	79 17                	jns    1385 <fourfiles+0x7d>
+      printf(1, "fork failed\n");
+    136e:	83 ec 08             	sub    $0x8,%esp
+    1371:	68 ad 4b 00 00       	push   $0x4bad
+    1376:	6a 01                	push   $0x1
+    1378:	e8 5f 32 00 00       	call   45dc <printf>
+    137d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1380:	e8 53 30 00 00       	call   43d8 <exit>
+    }
+
+    if(pid == 0){
+    1385:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+    1389:	0f 85 a5 00 00 00    	jne    1434 <fourfiles+0x12c>
+      fd = open(fname, O_CREATE | O_RDWR);
+    138f:	83 ec 08             	sub    $0x8,%esp
+    1392:	68 02 02 00 00       	push   $0x202
+    1397:	ff 75 e4             	push   -0x1c(%ebp)
+    139a:	e8 79 30 00 00       	call   4418 <open>
+    139f:	83 c4 10             	add    $0x10,%esp
+    13a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      if(fd < 0){
+    13a5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    13a9:	79 17                	jns    13c2 <fourfiles+0xba>
+        printf(1, "create failed\n");
+    13ab:	83 ec 08             	sub    $0x8,%esp
+    13ae:	68 0d 52 00 00       	push   $0x520d
+    13b3:	6a 01                	push   $0x1
+    13b5:	e8 22 32 00 00       	call   45dc <printf>
+    13ba:	83 c4 10             	add    $0x10,%esp
+        exit();
+    13bd:	e8 16 30 00 00       	call   43d8 <exit>
+      }
+      
+      memset(buf, '0'+pi, 512);
+    13c2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    13c5:	83 c0 30             	add    $0x30,%eax
+    13c8:	83 ec 04             	sub    $0x4,%esp
+    13cb:	68 00 02 00 00       	push   $0x200
+    13d0:	50                   	push   %eax
+    13d1:	68 20 6c 00 00       	push   $0x6c20
+    13d6:	e8 31 2e 00 00       	call   420c <memset>
+    13db:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < 12; i++){
+    13de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    13e5:	eb 42                	jmp    1429 <fourfiles+0x121>
+        if((n = write(fd, buf, 500)) != 500){
+    13e7:	83 ec 04             	sub    $0x4,%esp
+    13ea:	68 f4 01 00 00       	push   $0x1f4
+    13ef:	68 20 6c 00 00       	push   $0x6c20
+    13f4:	ff 75 e0             	push   -0x20(%ebp)
+    13f7:	e8 fc 2f 00 00       	call   43f8 <write>
+    13fc:	83 c4 10             	add    $0x10,%esp
+    13ff:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1402:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    1409:	74 1a                	je     1425 <fourfiles+0x11d>
+          printf(1, "write failed %d\n", n);
+    140b:	83 ec 04             	sub    $0x4,%esp
+    140e:	ff 75 dc             	push   -0x24(%ebp)
+    1411:	68 1c 52 00 00       	push   $0x521c
+    1416:	6a 01                	push   $0x1
+    1418:	e8 bf 31 00 00       	call   45dc <printf>
+    141d:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1420:	e8 b3 2f 00 00       	call   43d8 <exit>
+      for(i = 0; i < 12; i++){
+    1425:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1429:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    142d:	7e b8                	jle    13e7 <fourfiles+0xdf>
+        }
+      }
+      exit();
+    142f:	e8 a4 2f 00 00       	call   43d8 <exit>
+  for(pi = 0; pi < 4; pi++){
+    1434:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1438:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    143c:	0f 8e 06 ff ff ff    	jle    1348 <fourfiles+0x40>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    1442:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+    1449:	eb 09                	jmp    1454 <fourfiles+0x14c>
+    wait();
+    144b:	e8 90 2f 00 00       	call   43e0 <wait>
+  for(pi = 0; pi < 4; pi++){
+    1450:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+    1454:	83 7d e8 03          	cmpl   $0x3,-0x18(%ebp)
+    1458:	7e f1                	jle    144b <fourfiles+0x143>
+  }
+
+  for(i = 0; i < 2; i++){
+    145a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1461:	e9 d4 00 00 00       	jmp    153a <fourfiles+0x232>
+    fname = names[i];
+    1466:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1469:	8b 44 85 c8          	mov    -0x38(%ebp,%eax,4),%eax
+    146d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    fd = open(fname, 0);
+    1470:	83 ec 08             	sub    $0x8,%esp
+    1473:	6a 00                	push   $0x0
+    1475:	ff 75 e4             	push   -0x1c(%ebp)
+    1478:	e8 9b 2f 00 00       	call   4418 <open>
+    147d:	83 c4 10             	add    $0x10,%esp
+    1480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    1483:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    148a:	eb 4a                	jmp    14d6 <fourfiles+0x1ce>
+      for(j = 0; j < n; j++){
+    148c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1493:	eb 33                	jmp    14c8 <fourfiles+0x1c0>
+        if(buf[j] != '0'+i){
+    1495:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1498:	05 20 6c 00 00       	add    $0x6c20,%eax
+    149d:	0f b6 00             	movzbl (%eax),%eax
+    14a0:	0f be d0             	movsbl %al,%edx
+    14a3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14a6:	83 c0 30             	add    $0x30,%eax
+    14a9:	39 c2                	cmp    %eax,%edx
+    14ab:	74 17                	je     14c4 <fourfiles+0x1bc>
+          printf(1, "wrong char\n");
+    14ad:	83 ec 08             	sub    $0x8,%esp
+    14b0:	68 2d 52 00 00       	push   $0x522d
+    14b5:	6a 01                	push   $0x1
+    14b7:	e8 20 31 00 00       	call   45dc <printf>
+    14bc:	83 c4 10             	add    $0x10,%esp
+          exit();
+    14bf:	e8 14 2f 00 00       	call   43d8 <exit>
+      for(j = 0; j < n; j++){
+    14c4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    14c8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    14cb:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    14ce:	7c c5                	jl     1495 <fourfiles+0x18d>
+        }
+      }
+      total += n;
+    14d0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    14d3:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    14d6:	83 ec 04             	sub    $0x4,%esp
+    14d9:	68 00 20 00 00       	push   $0x2000
+    14de:	68 20 6c 00 00       	push   $0x6c20
+    14e3:	ff 75 e0             	push   -0x20(%ebp)
+    14e6:	e8 05 2f 00 00       	call   43f0 <read>
+    14eb:	83 c4 10             	add    $0x10,%esp
+    14ee:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    14f1:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    14f5:	7f 95                	jg     148c <fourfiles+0x184>
+    }
+    close(fd);
+    14f7:	83 ec 0c             	sub    $0xc,%esp
+    14fa:	ff 75 e0             	push   -0x20(%ebp)
+    14fd:	e8 fe 2e 00 00       	call   4400 <close>
+    1502:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    1505:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    150c:	74 1a                	je     1528 <fourfiles+0x220>
+      printf(1, "wrong length %d\n", total);
+    150e:	83 ec 04             	sub    $0x4,%esp
+    1511:	ff 75 ec             	push   -0x14(%ebp)
+    1514:	68 39 52 00 00       	push   $0x5239
+    1519:	6a 01                	push   $0x1
+    151b:	e8 bc 30 00 00       	call   45dc <printf>
+    1520:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1523:	e8 b0 2e 00 00       	call   43d8 <exit>
+    }
+    unlink(fname);
+    1528:	83 ec 0c             	sub    $0xc,%esp
+    152b:	ff 75 e4             	push   -0x1c(%ebp)
+    152e:	e8 f5 2e 00 00       	call   4428 <unlink>
+    1533:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 2; i++){
+    1536:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    153a:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    153e:	0f 8e 22 ff ff ff    	jle    1466 <fourfiles+0x15e>
+  }
+
+  printf(1, "fourfiles ok\n");
+    1544:	83 ec 08             	sub    $0x8,%esp
+    1547:	68 4a 52 00 00       	push   $0x524a
+    154c:	6a 01                	push   $0x1
+    154e:	e8 89 30 00 00       	call   45dc <printf>
+    1553:	83 c4 10             	add    $0x10,%esp
+}
+    1556:	90                   	nop
+    1557:	c9                   	leave
+    1558:	c3                   	ret
+
+00001559 <createdelete>:
+
+// four processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1559:	55                   	push   %ebp
+    155a:	89 e5                	mov    %esp,%ebp
+    155c:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd, pi;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    155f:	83 ec 08             	sub    $0x8,%esp
+    1562:	68 58 52 00 00       	push   $0x5258
+    1567:	6a 01                	push   $0x1
+    1569:	e8 6e 30 00 00       	call   45dc <printf>
+    156e:	83 c4 10             	add    $0x10,%esp
+
+  for(pi = 0; pi < 4; pi++){
+    1571:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1578:	e9 f6 00 00 00       	jmp    1673 <createdelete+0x11a>
+    pid = fork();
+    157d:	e8 4e 2e 00 00       	call   43d0 <fork>
+    1582:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1585:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1589:	79 17                	jns    15a2 <createdelete+0x49>
+      printf(1, "fork failed\n");
+    158b:	83 ec 08             	sub    $0x8,%esp
+    158e:	68 ad 4b 00 00       	push   $0x4bad
+    1593:	6a 01                	push   $0x1
+    1595:	e8 42 30 00 00       	call   45dc <printf>
+    159a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    159d:	e8 36 2e 00 00       	call   43d8 <exit>
+    }
+
+    if(pid == 0){
+    15a2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    15a6:	0f 85 c3 00 00 00    	jne    166f <createdelete+0x116>
+      name[0] = 'p' + pi;
+    15ac:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    15af:	83 c0 70             	add    $0x70,%eax
+    15b2:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[2] = '\0';
+    15b5:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+      for(i = 0; i < N; i++){
+    15b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    15c0:	e9 9b 00 00 00       	jmp    1660 <createdelete+0x107>
+        name[1] = '0' + i;
+    15c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    15c8:	83 c0 30             	add    $0x30,%eax
+    15cb:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    15ce:	83 ec 08             	sub    $0x8,%esp
+    15d1:	68 02 02 00 00       	push   $0x202
+    15d6:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    15d9:	50                   	push   %eax
+    15da:	e8 39 2e 00 00       	call   4418 <open>
+    15df:	83 c4 10             	add    $0x10,%esp
+    15e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        if(fd < 0){
+    15e5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    15e9:	79 17                	jns    1602 <createdelete+0xa9>
+          printf(1, "create failed\n");
+    15eb:	83 ec 08             	sub    $0x8,%esp
+    15ee:	68 0d 52 00 00       	push   $0x520d
+    15f3:	6a 01                	push   $0x1
+    15f5:	e8 e2 2f 00 00       	call   45dc <printf>
+    15fa:	83 c4 10             	add    $0x10,%esp
+          exit();
+    15fd:	e8 d6 2d 00 00       	call   43d8 <exit>
+        }
+        close(fd);
+    1602:	83 ec 0c             	sub    $0xc,%esp
+    1605:	ff 75 ec             	push   -0x14(%ebp)
+    1608:	e8 f3 2d 00 00       	call   4400 <close>
+    160d:	83 c4 10             	add    $0x10,%esp
+        if(i > 0 && (i % 2 ) == 0){
+    1610:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1614:	7e 46                	jle    165c <createdelete+0x103>
+    1616:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1619:	83 e0 01             	and    $0x1,%eax
+    161c:	85 c0                	test   %eax,%eax
+    161e:	75 3c                	jne    165c <createdelete+0x103>
+          name[1] = '0' + (i / 2);
+    1620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1623:	89 c2                	mov    %eax,%edx
+    1625:	c1 ea 1f             	shr    $0x1f,%edx
+    1628:	01 d0                	add    %edx,%eax
+    162a:	d1 f8                	sar    %eax
+    162c:	83 c0 30             	add    $0x30,%eax
+    162f:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    1632:	83 ec 0c             	sub    $0xc,%esp
+    1635:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1638:	50                   	push   %eax
+    1639:	e8 ea 2d 00 00       	call   4428 <unlink>
+    163e:	83 c4 10             	add    $0x10,%esp
+    1641:	85 c0                	test   %eax,%eax
+    1643:	79 17                	jns    165c <createdelete+0x103>
+            printf(1, "unlink failed\n");
+    1645:	83 ec 08             	sub    $0x8,%esp
+    1648:	68 30 4c 00 00       	push   $0x4c30
+    164d:	6a 01                	push   $0x1
+    164f:	e8 88 2f 00 00       	call   45dc <printf>
+    1654:	83 c4 10             	add    $0x10,%esp
+            exit();
+    1657:	e8 7c 2d 00 00       	call   43d8 <exit>
+      for(i = 0; i < N; i++){
+    165c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1660:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1664:	0f 8e 5b ff ff ff    	jle    15c5 <createdelete+0x6c>
+          }
+        }
+      }
+      exit();
+    166a:	e8 69 2d 00 00       	call   43d8 <exit>
+  for(pi = 0; pi < 4; pi++){
+    166f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1673:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1677:	0f 8e 00 ff ff ff    	jle    157d <createdelete+0x24>
+    }
+  }
+
+  for(pi = 0; pi < 4; pi++){
+    167d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1684:	eb 09                	jmp    168f <createdelete+0x136>
+    wait();
+    1686:	e8 55 2d 00 00       	call   43e0 <wait>
+  for(pi = 0; pi < 4; pi++){
+    168b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    168f:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    1693:	7e f1                	jle    1686 <createdelete+0x12d>
+  }
+
+  name[0] = name[1] = name[2] = 0;
+    1695:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1699:	0f b6 45 ca          	movzbl -0x36(%ebp),%eax
+    169d:	88 45 c9             	mov    %al,-0x37(%ebp)
+    16a0:	0f b6 45 c9          	movzbl -0x37(%ebp),%eax
+    16a4:	88 45 c8             	mov    %al,-0x38(%ebp)
+  for(i = 0; i < N; i++){
+    16a7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    16ae:	e9 b2 00 00 00       	jmp    1765 <createdelete+0x20c>
+    for(pi = 0; pi < 4; pi++){
+    16b3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    16ba:	e9 98 00 00 00       	jmp    1757 <createdelete+0x1fe>
+      name[0] = 'p' + pi;
+    16bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    16c2:	83 c0 70             	add    $0x70,%eax
+    16c5:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    16c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    16cb:	83 c0 30             	add    $0x30,%eax
+    16ce:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    16d1:	83 ec 08             	sub    $0x8,%esp
+    16d4:	6a 00                	push   $0x0
+    16d6:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    16d9:	50                   	push   %eax
+    16da:	e8 39 2d 00 00       	call   4418 <open>
+    16df:	83 c4 10             	add    $0x10,%esp
+    16e2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    16e5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    16e9:	74 06                	je     16f1 <createdelete+0x198>
+    16eb:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    16ef:	7e 21                	jle    1712 <createdelete+0x1b9>
+    16f1:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    16f5:	79 1b                	jns    1712 <createdelete+0x1b9>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    16f7:	83 ec 04             	sub    $0x4,%esp
+    16fa:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    16fd:	50                   	push   %eax
+    16fe:	68 6c 52 00 00       	push   $0x526c
+    1703:	6a 01                	push   $0x1
+    1705:	e8 d2 2e 00 00       	call   45dc <printf>
+    170a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    170d:	e8 c6 2c 00 00       	call   43d8 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1712:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1716:	7e 27                	jle    173f <createdelete+0x1e6>
+    1718:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    171c:	7f 21                	jg     173f <createdelete+0x1e6>
+    171e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1722:	78 1b                	js     173f <createdelete+0x1e6>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1724:	83 ec 04             	sub    $0x4,%esp
+    1727:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    172a:	50                   	push   %eax
+    172b:	68 90 52 00 00       	push   $0x5290
+    1730:	6a 01                	push   $0x1
+    1732:	e8 a5 2e 00 00       	call   45dc <printf>
+    1737:	83 c4 10             	add    $0x10,%esp
+        exit();
+    173a:	e8 99 2c 00 00       	call   43d8 <exit>
+      }
+      if(fd >= 0)
+    173f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1743:	78 0e                	js     1753 <createdelete+0x1fa>
+        close(fd);
+    1745:	83 ec 0c             	sub    $0xc,%esp
+    1748:	ff 75 ec             	push   -0x14(%ebp)
+    174b:	e8 b0 2c 00 00       	call   4400 <close>
+    1750:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    1753:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1757:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    175b:	0f 8e 5e ff ff ff    	jle    16bf <createdelete+0x166>
+  for(i = 0; i < N; i++){
+    1761:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1765:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1769:	0f 8e 44 ff ff ff    	jle    16b3 <createdelete+0x15a>
+    }
+  }
+
+  for(i = 0; i < N; i++){
+    176f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1776:	eb 38                	jmp    17b0 <createdelete+0x257>
+    for(pi = 0; pi < 4; pi++){
+    1778:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    177f:	eb 25                	jmp    17a6 <createdelete+0x24d>
+      name[0] = 'p' + i;
+    1781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1784:	83 c0 70             	add    $0x70,%eax
+    1787:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    178a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    178d:	83 c0 30             	add    $0x30,%eax
+    1790:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    1793:	83 ec 0c             	sub    $0xc,%esp
+    1796:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    1799:	50                   	push   %eax
+    179a:	e8 89 2c 00 00       	call   4428 <unlink>
+    179f:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    17a2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    17a6:	83 7d f0 03          	cmpl   $0x3,-0x10(%ebp)
+    17aa:	7e d5                	jle    1781 <createdelete+0x228>
+  for(i = 0; i < N; i++){
+    17ac:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    17b0:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    17b4:	7e c2                	jle    1778 <createdelete+0x21f>
+    }
+  }
+
+  printf(1, "createdelete ok\n");
+    17b6:	83 ec 08             	sub    $0x8,%esp
+    17b9:	68 b0 52 00 00       	push   $0x52b0
+    17be:	6a 01                	push   $0x1
+    17c0:	e8 17 2e 00 00       	call   45dc <printf>
+    17c5:	83 c4 10             	add    $0x10,%esp
+}
+    17c8:	90                   	nop
+    17c9:	c9                   	leave
+    17ca:	c3                   	ret
+
+000017cb <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    17cb:	55                   	push   %ebp
+    17cc:	89 e5                	mov    %esp,%ebp
+    17ce:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    17d1:	83 ec 08             	sub    $0x8,%esp
+    17d4:	68 c1 52 00 00       	push   $0x52c1
+    17d9:	6a 01                	push   $0x1
+    17db:	e8 fc 2d 00 00       	call   45dc <printf>
+    17e0:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    17e3:	83 ec 08             	sub    $0x8,%esp
+    17e6:	68 02 02 00 00       	push   $0x202
+    17eb:	68 d2 52 00 00       	push   $0x52d2
+    17f0:	e8 23 2c 00 00       	call   4418 <open>
+    17f5:	83 c4 10             	add    $0x10,%esp
+    17f8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    17fb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    17ff:	79 17                	jns    1818 <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    1801:	83 ec 08             	sub    $0x8,%esp
+    1804:	68 dd 52 00 00       	push   $0x52dd
+    1809:	6a 01                	push   $0x1
+    180b:	e8 cc 2d 00 00       	call   45dc <printf>
+    1810:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1813:	e8 c0 2b 00 00       	call   43d8 <exit>
+  }
+  write(fd, "hello", 5);
+    1818:	83 ec 04             	sub    $0x4,%esp
+    181b:	6a 05                	push   $0x5
+    181d:	68 f7 52 00 00       	push   $0x52f7
+    1822:	ff 75 f4             	push   -0xc(%ebp)
+    1825:	e8 ce 2b 00 00       	call   43f8 <write>
+    182a:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    182d:	83 ec 0c             	sub    $0xc,%esp
+    1830:	ff 75 f4             	push   -0xc(%ebp)
+    1833:	e8 c8 2b 00 00       	call   4400 <close>
+    1838:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    183b:	83 ec 08             	sub    $0x8,%esp
+    183e:	6a 02                	push   $0x2
+    1840:	68 d2 52 00 00       	push   $0x52d2
+    1845:	e8 ce 2b 00 00       	call   4418 <open>
+    184a:	83 c4 10             	add    $0x10,%esp
+    184d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1850:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1854:	79 17                	jns    186d <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    1856:	83 ec 08             	sub    $0x8,%esp
+    1859:	68 fd 52 00 00       	push   $0x52fd
+    185e:	6a 01                	push   $0x1
+    1860:	e8 77 2d 00 00       	call   45dc <printf>
+    1865:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1868:	e8 6b 2b 00 00       	call   43d8 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    186d:	83 ec 0c             	sub    $0xc,%esp
+    1870:	68 d2 52 00 00       	push   $0x52d2
+    1875:	e8 ae 2b 00 00       	call   4428 <unlink>
+    187a:	83 c4 10             	add    $0x10,%esp
+    187d:	85 c0                	test   %eax,%eax
+    187f:	74 17                	je     1898 <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    1881:	83 ec 08             	sub    $0x8,%esp
+    1884:	68 15 53 00 00       	push   $0x5315
+    1889:	6a 01                	push   $0x1
+    188b:	e8 4c 2d 00 00       	call   45dc <printf>
+    1890:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1893:	e8 40 2b 00 00       	call   43d8 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    1898:	83 ec 08             	sub    $0x8,%esp
+    189b:	68 02 02 00 00       	push   $0x202
+    18a0:	68 d2 52 00 00       	push   $0x52d2
+    18a5:	e8 6e 2b 00 00       	call   4418 <open>
+    18aa:	83 c4 10             	add    $0x10,%esp
+    18ad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    18b0:	83 ec 04             	sub    $0x4,%esp
+    18b3:	6a 03                	push   $0x3
+    18b5:	68 2f 53 00 00       	push   $0x532f
+    18ba:	ff 75 f0             	push   -0x10(%ebp)
+    18bd:	e8 36 2b 00 00       	call   43f8 <write>
+    18c2:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    18c5:	83 ec 0c             	sub    $0xc,%esp
+    18c8:	ff 75 f0             	push   -0x10(%ebp)
+    18cb:	e8 30 2b 00 00       	call   4400 <close>
+    18d0:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    18d3:	83 ec 04             	sub    $0x4,%esp
+    18d6:	68 00 20 00 00       	push   $0x2000
+    18db:	68 20 6c 00 00       	push   $0x6c20
+    18e0:	ff 75 f4             	push   -0xc(%ebp)
+    18e3:	e8 08 2b 00 00       	call   43f0 <read>
+    18e8:	83 c4 10             	add    $0x10,%esp
+    18eb:	83 f8 05             	cmp    $0x5,%eax
+    18ee:	74 17                	je     1907 <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    18f0:	83 ec 08             	sub    $0x8,%esp
+    18f3:	68 33 53 00 00       	push   $0x5333
+    18f8:	6a 01                	push   $0x1
+    18fa:	e8 dd 2c 00 00       	call   45dc <printf>
+    18ff:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1902:	e8 d1 2a 00 00       	call   43d8 <exit>
+  }
+  if(buf[0] != 'h'){
+    1907:	0f b6 05 20 6c 00 00 	movzbl 0x6c20,%eax
+    190e:	3c 68                	cmp    $0x68,%al
+    1910:	74 17                	je     1929 <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    1912:	83 ec 08             	sub    $0x8,%esp
+    1915:	68 4a 53 00 00       	push   $0x534a
+    191a:	6a 01                	push   $0x1
+    191c:	e8 bb 2c 00 00       	call   45dc <printf>
+    1921:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1924:	e8 af 2a 00 00       	call   43d8 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    1929:	83 ec 04             	sub    $0x4,%esp
+    192c:	6a 0a                	push   $0xa
+    192e:	68 20 6c 00 00       	push   $0x6c20
+    1933:	ff 75 f4             	push   -0xc(%ebp)
+    1936:	e8 bd 2a 00 00       	call   43f8 <write>
+    193b:	83 c4 10             	add    $0x10,%esp
+    193e:	83 f8 0a             	cmp    $0xa,%eax
+    1941:	74 17                	je     195a <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    1943:	83 ec 08             	sub    $0x8,%esp
+    1946:	68 61 53 00 00       	push   $0x5361
+    194b:	6a 01                	push   $0x1
+    194d:	e8 8a 2c 00 00       	call   45dc <printf>
+    1952:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1955:	e8 7e 2a 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    195a:	83 ec 0c             	sub    $0xc,%esp
+    195d:	ff 75 f4             	push   -0xc(%ebp)
+    1960:	e8 9b 2a 00 00       	call   4400 <close>
+    1965:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    1968:	83 ec 0c             	sub    $0xc,%esp
+    196b:	68 d2 52 00 00       	push   $0x52d2
+    1970:	e8 b3 2a 00 00       	call   4428 <unlink>
+    1975:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    1978:	83 ec 08             	sub    $0x8,%esp
+    197b:	68 7a 53 00 00       	push   $0x537a
+    1980:	6a 01                	push   $0x1
+    1982:	e8 55 2c 00 00       	call   45dc <printf>
+    1987:	83 c4 10             	add    $0x10,%esp
+}
+    198a:	90                   	nop
+    198b:	c9                   	leave
+    198c:	c3                   	ret
+
+0000198d <linktest>:
+
+void
+linktest(void)
+{
+    198d:	55                   	push   %ebp
+    198e:	89 e5                	mov    %esp,%ebp
+    1990:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    1993:	83 ec 08             	sub    $0x8,%esp
+    1996:	68 89 53 00 00       	push   $0x5389
+    199b:	6a 01                	push   $0x1
+    199d:	e8 3a 2c 00 00       	call   45dc <printf>
+    19a2:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    19a5:	83 ec 0c             	sub    $0xc,%esp
+    19a8:	68 93 53 00 00       	push   $0x5393
+    19ad:	e8 76 2a 00 00       	call   4428 <unlink>
+    19b2:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    19b5:	83 ec 0c             	sub    $0xc,%esp
+    19b8:	68 97 53 00 00       	push   $0x5397
+    19bd:	e8 66 2a 00 00       	call   4428 <unlink>
+    19c2:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    19c5:	83 ec 08             	sub    $0x8,%esp
+    19c8:	68 02 02 00 00       	push   $0x202
+    19cd:	68 93 53 00 00       	push   $0x5393
+    19d2:	e8 41 2a 00 00       	call   4418 <open>
+    19d7:	83 c4 10             	add    $0x10,%esp
+    19da:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    19dd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    19e1:	79 17                	jns    19fa <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    19e3:	83 ec 08             	sub    $0x8,%esp
+    19e6:	68 9b 53 00 00       	push   $0x539b
+    19eb:	6a 01                	push   $0x1
+    19ed:	e8 ea 2b 00 00       	call   45dc <printf>
+    19f2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    19f5:	e8 de 29 00 00       	call   43d8 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    19fa:	83 ec 04             	sub    $0x4,%esp
+    19fd:	6a 05                	push   $0x5
+    19ff:	68 f7 52 00 00       	push   $0x52f7
+    1a04:	ff 75 f4             	push   -0xc(%ebp)
+    1a07:	e8 ec 29 00 00       	call   43f8 <write>
+    1a0c:	83 c4 10             	add    $0x10,%esp
+    1a0f:	83 f8 05             	cmp    $0x5,%eax
+    1a12:	74 17                	je     1a2b <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    1a14:	83 ec 08             	sub    $0x8,%esp
+    1a17:	68 ae 53 00 00       	push   $0x53ae
+    1a1c:	6a 01                	push   $0x1
+    1a1e:	e8 b9 2b 00 00       	call   45dc <printf>
+    1a23:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a26:	e8 ad 29 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    1a2b:	83 ec 0c             	sub    $0xc,%esp
+    1a2e:	ff 75 f4             	push   -0xc(%ebp)
+    1a31:	e8 ca 29 00 00       	call   4400 <close>
+    1a36:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    1a39:	83 ec 08             	sub    $0x8,%esp
+    1a3c:	68 97 53 00 00       	push   $0x5397
+    1a41:	68 93 53 00 00       	push   $0x5393
+    1a46:	e8 ed 29 00 00       	call   4438 <link>
+    1a4b:	83 c4 10             	add    $0x10,%esp
+    1a4e:	85 c0                	test   %eax,%eax
+    1a50:	79 17                	jns    1a69 <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    1a52:	83 ec 08             	sub    $0x8,%esp
+    1a55:	68 c0 53 00 00       	push   $0x53c0
+    1a5a:	6a 01                	push   $0x1
+    1a5c:	e8 7b 2b 00 00       	call   45dc <printf>
+    1a61:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a64:	e8 6f 29 00 00       	call   43d8 <exit>
+  }
+  unlink("lf1");
+    1a69:	83 ec 0c             	sub    $0xc,%esp
+    1a6c:	68 93 53 00 00       	push   $0x5393
+    1a71:	e8 b2 29 00 00       	call   4428 <unlink>
+    1a76:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    1a79:	83 ec 08             	sub    $0x8,%esp
+    1a7c:	6a 00                	push   $0x0
+    1a7e:	68 93 53 00 00       	push   $0x5393
+    1a83:	e8 90 29 00 00       	call   4418 <open>
+    1a88:	83 c4 10             	add    $0x10,%esp
+    1a8b:	85 c0                	test   %eax,%eax
+    1a8d:	78 17                	js     1aa6 <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1a8f:	83 ec 08             	sub    $0x8,%esp
+    1a92:	68 d8 53 00 00       	push   $0x53d8
+    1a97:	6a 01                	push   $0x1
+    1a99:	e8 3e 2b 00 00       	call   45dc <printf>
+    1a9e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1aa1:	e8 32 29 00 00       	call   43d8 <exit>
+  }
+
+  fd = open("lf2", 0);
+    1aa6:	83 ec 08             	sub    $0x8,%esp
+    1aa9:	6a 00                	push   $0x0
+    1aab:	68 97 53 00 00       	push   $0x5397
+    1ab0:	e8 63 29 00 00       	call   4418 <open>
+    1ab5:	83 c4 10             	add    $0x10,%esp
+    1ab8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    1abb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1abf:	79 17                	jns    1ad8 <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    1ac1:	83 ec 08             	sub    $0x8,%esp
+    1ac4:	68 fd 53 00 00       	push   $0x53fd
+    1ac9:	6a 01                	push   $0x1
+    1acb:	e8 0c 2b 00 00       	call   45dc <printf>
+    1ad0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ad3:	e8 00 29 00 00       	call   43d8 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1ad8:	83 ec 04             	sub    $0x4,%esp
+    1adb:	68 00 20 00 00       	push   $0x2000
+    1ae0:	68 20 6c 00 00       	push   $0x6c20
+    1ae5:	ff 75 f4             	push   -0xc(%ebp)
+    1ae8:	e8 03 29 00 00       	call   43f0 <read>
+    1aed:	83 c4 10             	add    $0x10,%esp
+    1af0:	83 f8 05             	cmp    $0x5,%eax
+    1af3:	74 17                	je     1b0c <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    1af5:	83 ec 08             	sub    $0x8,%esp
+    1af8:	68 0e 54 00 00       	push   $0x540e
+    1afd:	6a 01                	push   $0x1
+    1aff:	e8 d8 2a 00 00       	call   45dc <printf>
+    1b04:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b07:	e8 cc 28 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    1b0c:	83 ec 0c             	sub    $0xc,%esp
+    1b0f:	ff 75 f4             	push   -0xc(%ebp)
+    1b12:	e8 e9 28 00 00       	call   4400 <close>
+    1b17:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    1b1a:	83 ec 08             	sub    $0x8,%esp
+    1b1d:	68 97 53 00 00       	push   $0x5397
+    1b22:	68 97 53 00 00       	push   $0x5397
+    1b27:	e8 0c 29 00 00       	call   4438 <link>
+    1b2c:	83 c4 10             	add    $0x10,%esp
+    1b2f:	85 c0                	test   %eax,%eax
+    1b31:	78 17                	js     1b4a <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1b33:	83 ec 08             	sub    $0x8,%esp
+    1b36:	68 1f 54 00 00       	push   $0x541f
+    1b3b:	6a 01                	push   $0x1
+    1b3d:	e8 9a 2a 00 00       	call   45dc <printf>
+    1b42:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b45:	e8 8e 28 00 00       	call   43d8 <exit>
+  }
+
+  unlink("lf2");
+    1b4a:	83 ec 0c             	sub    $0xc,%esp
+    1b4d:	68 97 53 00 00       	push   $0x5397
+    1b52:	e8 d1 28 00 00       	call   4428 <unlink>
+    1b57:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    1b5a:	83 ec 08             	sub    $0x8,%esp
+    1b5d:	68 93 53 00 00       	push   $0x5393
+    1b62:	68 97 53 00 00       	push   $0x5397
+    1b67:	e8 cc 28 00 00       	call   4438 <link>
+    1b6c:	83 c4 10             	add    $0x10,%esp
+    1b6f:	85 c0                	test   %eax,%eax
+    1b71:	78 17                	js     1b8a <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    1b73:	83 ec 08             	sub    $0x8,%esp
+    1b76:	68 40 54 00 00       	push   $0x5440
+    1b7b:	6a 01                	push   $0x1
+    1b7d:	e8 5a 2a 00 00       	call   45dc <printf>
+    1b82:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1b85:	e8 4e 28 00 00       	call   43d8 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    1b8a:	83 ec 08             	sub    $0x8,%esp
+    1b8d:	68 93 53 00 00       	push   $0x5393
+    1b92:	68 63 54 00 00       	push   $0x5463
+    1b97:	e8 9c 28 00 00       	call   4438 <link>
+    1b9c:	83 c4 10             	add    $0x10,%esp
+    1b9f:	85 c0                	test   %eax,%eax
+    1ba1:	78 17                	js     1bba <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1ba3:	83 ec 08             	sub    $0x8,%esp
+    1ba6:	68 65 54 00 00       	push   $0x5465
+    1bab:	6a 01                	push   $0x1
+    1bad:	e8 2a 2a 00 00       	call   45dc <printf>
+    1bb2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1bb5:	e8 1e 28 00 00       	call   43d8 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    1bba:	83 ec 08             	sub    $0x8,%esp
+    1bbd:	68 81 54 00 00       	push   $0x5481
+    1bc2:	6a 01                	push   $0x1
+    1bc4:	e8 13 2a 00 00       	call   45dc <printf>
+    1bc9:	83 c4 10             	add    $0x10,%esp
+}
+    1bcc:	90                   	nop
+    1bcd:	c9                   	leave
+    1bce:	c3                   	ret
+
+00001bcf <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    1bcf:	55                   	push   %ebp
+    1bd0:	89 e5                	mov    %esp,%ebp
+    1bd2:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    1bd5:	83 ec 08             	sub    $0x8,%esp
+    1bd8:	68 8e 54 00 00       	push   $0x548e
+    1bdd:	6a 01                	push   $0x1
+    1bdf:	e8 f8 29 00 00       	call   45dc <printf>
+    1be4:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    1be7:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    1beb:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    1bef:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1bf6:	e9 fc 00 00 00       	jmp    1cf7 <concreate+0x128>
+    file[1] = '0' + i;
+    1bfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bfe:	83 c0 30             	add    $0x30,%eax
+    1c01:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    1c04:	83 ec 0c             	sub    $0xc,%esp
+    1c07:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c0a:	50                   	push   %eax
+    1c0b:	e8 18 28 00 00       	call   4428 <unlink>
+    1c10:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    1c13:	e8 b8 27 00 00       	call   43d0 <fork>
+    1c18:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    1c1b:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c1f:	74 3b                	je     1c5c <concreate+0x8d>
+    1c21:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1c24:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1c29:	89 c8                	mov    %ecx,%eax
+    1c2b:	f7 ea                	imul   %edx
+    1c2d:	89 c8                	mov    %ecx,%eax
+    1c2f:	c1 f8 1f             	sar    $0x1f,%eax
+    1c32:	29 c2                	sub    %eax,%edx
+    1c34:	89 d0                	mov    %edx,%eax
+    1c36:	01 c0                	add    %eax,%eax
+    1c38:	01 d0                	add    %edx,%eax
+    1c3a:	29 c1                	sub    %eax,%ecx
+    1c3c:	89 ca                	mov    %ecx,%edx
+    1c3e:	83 fa 01             	cmp    $0x1,%edx
+    1c41:	75 19                	jne    1c5c <concreate+0x8d>
+      link("C0", file);
+    1c43:	83 ec 08             	sub    $0x8,%esp
+    1c46:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c49:	50                   	push   %eax
+    1c4a:	68 9e 54 00 00       	push   $0x549e
+    1c4f:	e8 e4 27 00 00       	call   4438 <link>
+    1c54:	83 c4 10             	add    $0x10,%esp
+    1c57:	e9 87 00 00 00       	jmp    1ce3 <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    1c5c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c60:	75 3b                	jne    1c9d <concreate+0xce>
+    1c62:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1c65:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1c6a:	89 c8                	mov    %ecx,%eax
+    1c6c:	f7 ea                	imul   %edx
+    1c6e:	d1 fa                	sar    %edx
+    1c70:	89 c8                	mov    %ecx,%eax
+    1c72:	c1 f8 1f             	sar    $0x1f,%eax
+    1c75:	29 c2                	sub    %eax,%edx
+    1c77:	89 d0                	mov    %edx,%eax
+    1c79:	c1 e0 02             	shl    $0x2,%eax
+    1c7c:	01 d0                	add    %edx,%eax
+    1c7e:	29 c1                	sub    %eax,%ecx
+    1c80:	89 ca                	mov    %ecx,%edx
+    1c82:	83 fa 01             	cmp    $0x1,%edx
+    1c85:	75 16                	jne    1c9d <concreate+0xce>
+      link("C0", file);
+    1c87:	83 ec 08             	sub    $0x8,%esp
+    1c8a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1c8d:	50                   	push   %eax
+    1c8e:	68 9e 54 00 00       	push   $0x549e
+    1c93:	e8 a0 27 00 00       	call   4438 <link>
+    1c98:	83 c4 10             	add    $0x10,%esp
+    1c9b:	eb 46                	jmp    1ce3 <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    1c9d:	83 ec 08             	sub    $0x8,%esp
+    1ca0:	68 02 02 00 00       	push   $0x202
+    1ca5:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ca8:	50                   	push   %eax
+    1ca9:	e8 6a 27 00 00       	call   4418 <open>
+    1cae:	83 c4 10             	add    $0x10,%esp
+    1cb1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    1cb4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1cb8:	79 1b                	jns    1cd5 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    1cba:	83 ec 04             	sub    $0x4,%esp
+    1cbd:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1cc0:	50                   	push   %eax
+    1cc1:	68 a1 54 00 00       	push   $0x54a1
+    1cc6:	6a 01                	push   $0x1
+    1cc8:	e8 0f 29 00 00       	call   45dc <printf>
+    1ccd:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1cd0:	e8 03 27 00 00       	call   43d8 <exit>
+      }
+      close(fd);
+    1cd5:	83 ec 0c             	sub    $0xc,%esp
+    1cd8:	ff 75 ec             	push   -0x14(%ebp)
+    1cdb:	e8 20 27 00 00       	call   4400 <close>
+    1ce0:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1ce3:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1ce7:	75 05                	jne    1cee <concreate+0x11f>
+      exit();
+    1ce9:	e8 ea 26 00 00       	call   43d8 <exit>
+    else
+      wait();
+    1cee:	e8 ed 26 00 00       	call   43e0 <wait>
+  for(i = 0; i < 40; i++){
+    1cf3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1cf7:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1cfb:	0f 8e fa fe ff ff    	jle    1bfb <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    1d01:	83 ec 04             	sub    $0x4,%esp
+    1d04:	6a 28                	push   $0x28
+    1d06:	6a 00                	push   $0x0
+    1d08:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    1d0b:	50                   	push   %eax
+    1d0c:	e8 fb 24 00 00       	call   420c <memset>
+    1d11:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1d14:	83 ec 08             	sub    $0x8,%esp
+    1d17:	6a 00                	push   $0x0
+    1d19:	68 63 54 00 00       	push   $0x5463
+    1d1e:	e8 f5 26 00 00       	call   4418 <open>
+    1d23:	83 c4 10             	add    $0x10,%esp
+    1d26:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    1d29:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1d30:	e9 99 00 00 00       	jmp    1dce <concreate+0x1ff>
+    if(de.inum == 0)
+    1d35:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    1d39:	66 85 c0             	test   %ax,%ax
+    1d3c:	0f 84 8b 00 00 00    	je     1dcd <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1d42:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    1d46:	3c 43                	cmp    $0x43,%al
+    1d48:	0f 85 80 00 00 00    	jne    1dce <concreate+0x1ff>
+    1d4e:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    1d52:	84 c0                	test   %al,%al
+    1d54:	75 78                	jne    1dce <concreate+0x1ff>
+      i = de.name[1] - '0';
+    1d56:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    1d5a:	0f be c0             	movsbl %al,%eax
+    1d5d:	83 e8 30             	sub    $0x30,%eax
+    1d60:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    1d63:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1d67:	78 08                	js     1d71 <concreate+0x1a2>
+    1d69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d6c:	83 f8 27             	cmp    $0x27,%eax
+    1d6f:	76 1e                	jbe    1d8f <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    1d71:	83 ec 04             	sub    $0x4,%esp
+    1d74:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1d77:	83 c0 02             	add    $0x2,%eax
+    1d7a:	50                   	push   %eax
+    1d7b:	68 bd 54 00 00       	push   $0x54bd
+    1d80:	6a 01                	push   $0x1
+    1d82:	e8 55 28 00 00       	call   45dc <printf>
+    1d87:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1d8a:	e8 49 26 00 00       	call   43d8 <exit>
+      }
+      if(fa[i]){
+    1d8f:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1d92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d95:	01 d0                	add    %edx,%eax
+    1d97:	0f b6 00             	movzbl (%eax),%eax
+    1d9a:	84 c0                	test   %al,%al
+    1d9c:	74 1e                	je     1dbc <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1d9e:	83 ec 04             	sub    $0x4,%esp
+    1da1:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1da4:	83 c0 02             	add    $0x2,%eax
+    1da7:	50                   	push   %eax
+    1da8:	68 d6 54 00 00       	push   $0x54d6
+    1dad:	6a 01                	push   $0x1
+    1daf:	e8 28 28 00 00       	call   45dc <printf>
+    1db4:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1db7:	e8 1c 26 00 00       	call   43d8 <exit>
+      }
+      fa[i] = 1;
+    1dbc:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    1dbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1dc2:	01 d0                	add    %edx,%eax
+    1dc4:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    1dc7:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1dcb:	eb 01                	jmp    1dce <concreate+0x1ff>
+      continue;
+    1dcd:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    1dce:	83 ec 04             	sub    $0x4,%esp
+    1dd1:	6a 10                	push   $0x10
+    1dd3:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    1dd6:	50                   	push   %eax
+    1dd7:	ff 75 ec             	push   -0x14(%ebp)
+    1dda:	e8 11 26 00 00       	call   43f0 <read>
+    1ddf:	83 c4 10             	add    $0x10,%esp
+    1de2:	85 c0                	test   %eax,%eax
+    1de4:	0f 8f 4b ff ff ff    	jg     1d35 <concreate+0x166>
+    }
+  }
+  close(fd);
+    1dea:	83 ec 0c             	sub    $0xc,%esp
+    1ded:	ff 75 ec             	push   -0x14(%ebp)
+    1df0:	e8 0b 26 00 00       	call   4400 <close>
+    1df5:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    1df8:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    1dfc:	74 17                	je     1e15 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    1dfe:	83 ec 08             	sub    $0x8,%esp
+    1e01:	68 f4 54 00 00       	push   $0x54f4
+    1e06:	6a 01                	push   $0x1
+    1e08:	e8 cf 27 00 00       	call   45dc <printf>
+    1e0d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1e10:	e8 c3 25 00 00       	call   43d8 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    1e15:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1e1c:	e9 43 01 00 00       	jmp    1f64 <concreate+0x395>
+    file[1] = '0' + i;
+    1e21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1e24:	83 c0 30             	add    $0x30,%eax
+    1e27:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    1e2a:	e8 a1 25 00 00       	call   43d0 <fork>
+    1e2f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    1e32:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e36:	79 17                	jns    1e4f <concreate+0x280>
+      printf(1, "fork failed\n");
+    1e38:	83 ec 08             	sub    $0x8,%esp
+    1e3b:	68 ad 4b 00 00       	push   $0x4bad
+    1e40:	6a 01                	push   $0x1
+    1e42:	e8 95 27 00 00       	call   45dc <printf>
+    1e47:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1e4a:	e8 89 25 00 00       	call   43d8 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    1e4f:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1e52:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1e57:	89 c8                	mov    %ecx,%eax
+    1e59:	f7 ea                	imul   %edx
+    1e5b:	89 c8                	mov    %ecx,%eax
+    1e5d:	c1 f8 1f             	sar    $0x1f,%eax
+    1e60:	29 c2                	sub    %eax,%edx
+    1e62:	89 d0                	mov    %edx,%eax
+    1e64:	01 c0                	add    %eax,%eax
+    1e66:	01 d0                	add    %edx,%eax
+    1e68:	29 c1                	sub    %eax,%ecx
+    1e6a:	89 ca                	mov    %ecx,%edx
+    1e6c:	85 d2                	test   %edx,%edx
+    1e6e:	75 06                	jne    1e76 <concreate+0x2a7>
+    1e70:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e74:	74 28                	je     1e9e <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    1e76:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    1e79:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    1e7e:	89 c8                	mov    %ecx,%eax
+    1e80:	f7 ea                	imul   %edx
+    1e82:	89 c8                	mov    %ecx,%eax
+    1e84:	c1 f8 1f             	sar    $0x1f,%eax
+    1e87:	29 c2                	sub    %eax,%edx
+    1e89:	89 d0                	mov    %edx,%eax
+    1e8b:	01 c0                	add    %eax,%eax
+    1e8d:	01 d0                	add    %edx,%eax
+    1e8f:	29 c1                	sub    %eax,%ecx
+    1e91:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    1e93:	83 fa 01             	cmp    $0x1,%edx
+    1e96:	75 7c                	jne    1f14 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    1e98:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1e9c:	74 76                	je     1f14 <concreate+0x345>
+      close(open(file, 0));
+    1e9e:	83 ec 08             	sub    $0x8,%esp
+    1ea1:	6a 00                	push   $0x0
+    1ea3:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ea6:	50                   	push   %eax
+    1ea7:	e8 6c 25 00 00       	call   4418 <open>
+    1eac:	83 c4 10             	add    $0x10,%esp
+    1eaf:	83 ec 0c             	sub    $0xc,%esp
+    1eb2:	50                   	push   %eax
+    1eb3:	e8 48 25 00 00       	call   4400 <close>
+    1eb8:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1ebb:	83 ec 08             	sub    $0x8,%esp
+    1ebe:	6a 00                	push   $0x0
+    1ec0:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ec3:	50                   	push   %eax
+    1ec4:	e8 4f 25 00 00       	call   4418 <open>
+    1ec9:	83 c4 10             	add    $0x10,%esp
+    1ecc:	83 ec 0c             	sub    $0xc,%esp
+    1ecf:	50                   	push   %eax
+    1ed0:	e8 2b 25 00 00       	call   4400 <close>
+    1ed5:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1ed8:	83 ec 08             	sub    $0x8,%esp
+    1edb:	6a 00                	push   $0x0
+    1edd:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1ee0:	50                   	push   %eax
+    1ee1:	e8 32 25 00 00       	call   4418 <open>
+    1ee6:	83 c4 10             	add    $0x10,%esp
+    1ee9:	83 ec 0c             	sub    $0xc,%esp
+    1eec:	50                   	push   %eax
+    1eed:	e8 0e 25 00 00       	call   4400 <close>
+    1ef2:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    1ef5:	83 ec 08             	sub    $0x8,%esp
+    1ef8:	6a 00                	push   $0x0
+    1efa:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1efd:	50                   	push   %eax
+    1efe:	e8 15 25 00 00       	call   4418 <open>
+    1f03:	83 c4 10             	add    $0x10,%esp
+    1f06:	83 ec 0c             	sub    $0xc,%esp
+    1f09:	50                   	push   %eax
+    1f0a:	e8 f1 24 00 00       	call   4400 <close>
+    1f0f:	83 c4 10             	add    $0x10,%esp
+    1f12:	eb 3c                	jmp    1f50 <concreate+0x381>
+    } else {
+      unlink(file);
+    1f14:	83 ec 0c             	sub    $0xc,%esp
+    1f17:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f1a:	50                   	push   %eax
+    1f1b:	e8 08 25 00 00       	call   4428 <unlink>
+    1f20:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f23:	83 ec 0c             	sub    $0xc,%esp
+    1f26:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f29:	50                   	push   %eax
+    1f2a:	e8 f9 24 00 00       	call   4428 <unlink>
+    1f2f:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f32:	83 ec 0c             	sub    $0xc,%esp
+    1f35:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f38:	50                   	push   %eax
+    1f39:	e8 ea 24 00 00       	call   4428 <unlink>
+    1f3e:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    1f41:	83 ec 0c             	sub    $0xc,%esp
+    1f44:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    1f47:	50                   	push   %eax
+    1f48:	e8 db 24 00 00       	call   4428 <unlink>
+    1f4d:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    1f50:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1f54:	75 05                	jne    1f5b <concreate+0x38c>
+      exit();
+    1f56:	e8 7d 24 00 00       	call   43d8 <exit>
+    else
+      wait();
+    1f5b:	e8 80 24 00 00       	call   43e0 <wait>
+  for(i = 0; i < 40; i++){
+    1f60:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1f64:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    1f68:	0f 8e b3 fe ff ff    	jle    1e21 <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    1f6e:	83 ec 08             	sub    $0x8,%esp
+    1f71:	68 25 55 00 00       	push   $0x5525
+    1f76:	6a 01                	push   $0x1
+    1f78:	e8 5f 26 00 00       	call   45dc <printf>
+    1f7d:	83 c4 10             	add    $0x10,%esp
+}
+    1f80:	90                   	nop
+    1f81:	c9                   	leave
+    1f82:	c3                   	ret
+
+00001f83 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    1f83:	55                   	push   %ebp
+    1f84:	89 e5                	mov    %esp,%ebp
+    1f86:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    1f89:	83 ec 08             	sub    $0x8,%esp
+    1f8c:	68 33 55 00 00       	push   $0x5533
+    1f91:	6a 01                	push   $0x1
+    1f93:	e8 44 26 00 00       	call   45dc <printf>
+    1f98:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    1f9b:	83 ec 0c             	sub    $0xc,%esp
+    1f9e:	68 e3 4f 00 00       	push   $0x4fe3
+    1fa3:	e8 80 24 00 00       	call   4428 <unlink>
+    1fa8:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1fab:	e8 20 24 00 00       	call   43d0 <fork>
+    1fb0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    1fb3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1fb7:	79 17                	jns    1fd0 <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    1fb9:	83 ec 08             	sub    $0x8,%esp
+    1fbc:	68 ad 4b 00 00       	push   $0x4bad
+    1fc1:	6a 01                	push   $0x1
+    1fc3:	e8 14 26 00 00       	call   45dc <printf>
+    1fc8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1fcb:	e8 08 24 00 00       	call   43d8 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    1fd0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1fd4:	74 07                	je     1fdd <linkunlink+0x5a>
+    1fd6:	b8 01 00 00 00       	mov    $0x1,%eax
+    1fdb:	eb 05                	jmp    1fe2 <linkunlink+0x5f>
+    1fdd:	b8 61 00 00 00       	mov    $0x61,%eax
+    1fe2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    1fe5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1fec:	e9 98 00 00 00       	jmp    2089 <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    1ff1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1ff4:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    1ffa:	05 39 30 00 00       	add    $0x3039,%eax
+    1fff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    2002:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2005:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    200a:	89 c8                	mov    %ecx,%eax
+    200c:	f7 e2                	mul    %edx
+    200e:	d1 ea                	shr    %edx
+    2010:	89 d0                	mov    %edx,%eax
+    2012:	01 c0                	add    %eax,%eax
+    2014:	01 d0                	add    %edx,%eax
+    2016:	29 c1                	sub    %eax,%ecx
+    2018:	89 ca                	mov    %ecx,%edx
+    201a:	85 d2                	test   %edx,%edx
+    201c:	75 23                	jne    2041 <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    201e:	83 ec 08             	sub    $0x8,%esp
+    2021:	68 02 02 00 00       	push   $0x202
+    2026:	68 e3 4f 00 00       	push   $0x4fe3
+    202b:	e8 e8 23 00 00       	call   4418 <open>
+    2030:	83 c4 10             	add    $0x10,%esp
+    2033:	83 ec 0c             	sub    $0xc,%esp
+    2036:	50                   	push   %eax
+    2037:	e8 c4 23 00 00       	call   4400 <close>
+    203c:	83 c4 10             	add    $0x10,%esp
+    203f:	eb 44                	jmp    2085 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    2041:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2044:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    2049:	89 c8                	mov    %ecx,%eax
+    204b:	f7 e2                	mul    %edx
+    204d:	d1 ea                	shr    %edx
+    204f:	89 d0                	mov    %edx,%eax
+    2051:	01 c0                	add    %eax,%eax
+    2053:	01 d0                	add    %edx,%eax
+    2055:	29 c1                	sub    %eax,%ecx
+    2057:	89 ca                	mov    %ecx,%edx
+    2059:	83 fa 01             	cmp    $0x1,%edx
+    205c:	75 17                	jne    2075 <linkunlink+0xf2>
+      link("cat", "x");
+    205e:	83 ec 08             	sub    $0x8,%esp
+    2061:	68 e3 4f 00 00       	push   $0x4fe3
+    2066:	68 44 55 00 00       	push   $0x5544
+    206b:	e8 c8 23 00 00       	call   4438 <link>
+    2070:	83 c4 10             	add    $0x10,%esp
+    2073:	eb 10                	jmp    2085 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    2075:	83 ec 0c             	sub    $0xc,%esp
+    2078:	68 e3 4f 00 00       	push   $0x4fe3
+    207d:	e8 a6 23 00 00       	call   4428 <unlink>
+    2082:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2085:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2089:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    208d:	0f 8e 5e ff ff ff    	jle    1ff1 <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    2093:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2097:	74 07                	je     20a0 <linkunlink+0x11d>
+    wait();
+    2099:	e8 42 23 00 00       	call   43e0 <wait>
+    209e:	eb 05                	jmp    20a5 <linkunlink+0x122>
+  else 
+    exit();
+    20a0:	e8 33 23 00 00       	call   43d8 <exit>
+
+  printf(1, "linkunlink ok\n");
+    20a5:	83 ec 08             	sub    $0x8,%esp
+    20a8:	68 48 55 00 00       	push   $0x5548
+    20ad:	6a 01                	push   $0x1
+    20af:	e8 28 25 00 00       	call   45dc <printf>
+    20b4:	83 c4 10             	add    $0x10,%esp
+}
+    20b7:	90                   	nop
+    20b8:	c9                   	leave
+    20b9:	c3                   	ret
+
+000020ba <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    20ba:	55                   	push   %ebp
+    20bb:	89 e5                	mov    %esp,%ebp
+    20bd:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    20c0:	83 ec 08             	sub    $0x8,%esp
+    20c3:	68 57 55 00 00       	push   $0x5557
+    20c8:	6a 01                	push   $0x1
+    20ca:	e8 0d 25 00 00       	call   45dc <printf>
+    20cf:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    20d2:	83 ec 0c             	sub    $0xc,%esp
+    20d5:	68 64 55 00 00       	push   $0x5564
+    20da:	e8 49 23 00 00       	call   4428 <unlink>
+    20df:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    20e2:	83 ec 08             	sub    $0x8,%esp
+    20e5:	68 00 02 00 00       	push   $0x200
+    20ea:	68 64 55 00 00       	push   $0x5564
+    20ef:	e8 24 23 00 00       	call   4418 <open>
+    20f4:	83 c4 10             	add    $0x10,%esp
+    20f7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    20fa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    20fe:	79 17                	jns    2117 <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    2100:	83 ec 08             	sub    $0x8,%esp
+    2103:	68 67 55 00 00       	push   $0x5567
+    2108:	6a 01                	push   $0x1
+    210a:	e8 cd 24 00 00       	call   45dc <printf>
+    210f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2112:	e8 c1 22 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    2117:	83 ec 0c             	sub    $0xc,%esp
+    211a:	ff 75 f0             	push   -0x10(%ebp)
+    211d:	e8 de 22 00 00       	call   4400 <close>
+    2122:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    2125:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    212c:	eb 69                	jmp    2197 <bigdir+0xdd>
+    name[0] = 'x';
+    212e:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    2132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2135:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2138:	85 c0                	test   %eax,%eax
+    213a:	0f 48 c2             	cmovs  %edx,%eax
+    213d:	c1 f8 06             	sar    $0x6,%eax
+    2140:	83 c0 30             	add    $0x30,%eax
+    2143:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    2146:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2149:	89 d0                	mov    %edx,%eax
+    214b:	c1 f8 1f             	sar    $0x1f,%eax
+    214e:	c1 e8 1a             	shr    $0x1a,%eax
+    2151:	01 c2                	add    %eax,%edx
+    2153:	83 e2 3f             	and    $0x3f,%edx
+    2156:	29 c2                	sub    %eax,%edx
+    2158:	89 d0                	mov    %edx,%eax
+    215a:	83 c0 30             	add    $0x30,%eax
+    215d:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    2160:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    2164:	83 ec 08             	sub    $0x8,%esp
+    2167:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    216a:	50                   	push   %eax
+    216b:	68 64 55 00 00       	push   $0x5564
+    2170:	e8 c3 22 00 00       	call   4438 <link>
+    2175:	83 c4 10             	add    $0x10,%esp
+    2178:	85 c0                	test   %eax,%eax
+    217a:	74 17                	je     2193 <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    217c:	83 ec 08             	sub    $0x8,%esp
+    217f:	68 7d 55 00 00       	push   $0x557d
+    2184:	6a 01                	push   $0x1
+    2186:	e8 51 24 00 00       	call   45dc <printf>
+    218b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    218e:	e8 45 22 00 00       	call   43d8 <exit>
+  for(i = 0; i < 500; i++){
+    2193:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2197:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    219e:	7e 8e                	jle    212e <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    21a0:	83 ec 0c             	sub    $0xc,%esp
+    21a3:	68 64 55 00 00       	push   $0x5564
+    21a8:	e8 7b 22 00 00       	call   4428 <unlink>
+    21ad:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    21b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    21b7:	eb 64                	jmp    221d <bigdir+0x163>
+    name[0] = 'x';
+    21b9:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    21bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    21c0:	8d 50 3f             	lea    0x3f(%eax),%edx
+    21c3:	85 c0                	test   %eax,%eax
+    21c5:	0f 48 c2             	cmovs  %edx,%eax
+    21c8:	c1 f8 06             	sar    $0x6,%eax
+    21cb:	83 c0 30             	add    $0x30,%eax
+    21ce:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    21d1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    21d4:	89 d0                	mov    %edx,%eax
+    21d6:	c1 f8 1f             	sar    $0x1f,%eax
+    21d9:	c1 e8 1a             	shr    $0x1a,%eax
+    21dc:	01 c2                	add    %eax,%edx
+    21de:	83 e2 3f             	and    $0x3f,%edx
+    21e1:	29 c2                	sub    %eax,%edx
+    21e3:	89 d0                	mov    %edx,%eax
+    21e5:	83 c0 30             	add    $0x30,%eax
+    21e8:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    21eb:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    21ef:	83 ec 0c             	sub    $0xc,%esp
+    21f2:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    21f5:	50                   	push   %eax
+    21f6:	e8 2d 22 00 00       	call   4428 <unlink>
+    21fb:	83 c4 10             	add    $0x10,%esp
+    21fe:	85 c0                	test   %eax,%eax
+    2200:	74 17                	je     2219 <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    2202:	83 ec 08             	sub    $0x8,%esp
+    2205:	68 91 55 00 00       	push   $0x5591
+    220a:	6a 01                	push   $0x1
+    220c:	e8 cb 23 00 00       	call   45dc <printf>
+    2211:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2214:	e8 bf 21 00 00       	call   43d8 <exit>
+  for(i = 0; i < 500; i++){
+    2219:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    221d:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2224:	7e 93                	jle    21b9 <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    2226:	83 ec 08             	sub    $0x8,%esp
+    2229:	68 a6 55 00 00       	push   $0x55a6
+    222e:	6a 01                	push   $0x1
+    2230:	e8 a7 23 00 00       	call   45dc <printf>
+    2235:	83 c4 10             	add    $0x10,%esp
+}
+    2238:	90                   	nop
+    2239:	c9                   	leave
+    223a:	c3                   	ret
+
+0000223b <subdir>:
+
+void
+subdir(void)
+{
+    223b:	55                   	push   %ebp
+    223c:	89 e5                	mov    %esp,%ebp
+    223e:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    2241:	83 ec 08             	sub    $0x8,%esp
+    2244:	68 b1 55 00 00       	push   $0x55b1
+    2249:	6a 01                	push   $0x1
+    224b:	e8 8c 23 00 00       	call   45dc <printf>
+    2250:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    2253:	83 ec 0c             	sub    $0xc,%esp
+    2256:	68 be 55 00 00       	push   $0x55be
+    225b:	e8 c8 21 00 00       	call   4428 <unlink>
+    2260:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    2263:	83 ec 0c             	sub    $0xc,%esp
+    2266:	68 c1 55 00 00       	push   $0x55c1
+    226b:	e8 d0 21 00 00       	call   4440 <mkdir>
+    2270:	83 c4 10             	add    $0x10,%esp
+    2273:	85 c0                	test   %eax,%eax
+    2275:	74 17                	je     228e <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    2277:	83 ec 08             	sub    $0x8,%esp
+    227a:	68 c4 55 00 00       	push   $0x55c4
+    227f:	6a 01                	push   $0x1
+    2281:	e8 56 23 00 00       	call   45dc <printf>
+    2286:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2289:	e8 4a 21 00 00       	call   43d8 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    228e:	83 ec 08             	sub    $0x8,%esp
+    2291:	68 02 02 00 00       	push   $0x202
+    2296:	68 dc 55 00 00       	push   $0x55dc
+    229b:	e8 78 21 00 00       	call   4418 <open>
+    22a0:	83 c4 10             	add    $0x10,%esp
+    22a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    22a6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    22aa:	79 17                	jns    22c3 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    22ac:	83 ec 08             	sub    $0x8,%esp
+    22af:	68 e2 55 00 00       	push   $0x55e2
+    22b4:	6a 01                	push   $0x1
+    22b6:	e8 21 23 00 00       	call   45dc <printf>
+    22bb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22be:	e8 15 21 00 00       	call   43d8 <exit>
+  }
+  write(fd, "ff", 2);
+    22c3:	83 ec 04             	sub    $0x4,%esp
+    22c6:	6a 02                	push   $0x2
+    22c8:	68 be 55 00 00       	push   $0x55be
+    22cd:	ff 75 f4             	push   -0xc(%ebp)
+    22d0:	e8 23 21 00 00       	call   43f8 <write>
+    22d5:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    22d8:	83 ec 0c             	sub    $0xc,%esp
+    22db:	ff 75 f4             	push   -0xc(%ebp)
+    22de:	e8 1d 21 00 00       	call   4400 <close>
+    22e3:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    22e6:	83 ec 0c             	sub    $0xc,%esp
+    22e9:	68 c1 55 00 00       	push   $0x55c1
+    22ee:	e8 35 21 00 00       	call   4428 <unlink>
+    22f3:	83 c4 10             	add    $0x10,%esp
+    22f6:	85 c0                	test   %eax,%eax
+    22f8:	78 17                	js     2311 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    22fa:	83 ec 08             	sub    $0x8,%esp
+    22fd:	68 f8 55 00 00       	push   $0x55f8
+    2302:	6a 01                	push   $0x1
+    2304:	e8 d3 22 00 00       	call   45dc <printf>
+    2309:	83 c4 10             	add    $0x10,%esp
+    exit();
+    230c:	e8 c7 20 00 00       	call   43d8 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    2311:	83 ec 0c             	sub    $0xc,%esp
+    2314:	68 1e 56 00 00       	push   $0x561e
+    2319:	e8 22 21 00 00       	call   4440 <mkdir>
+    231e:	83 c4 10             	add    $0x10,%esp
+    2321:	85 c0                	test   %eax,%eax
+    2323:	74 17                	je     233c <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2325:	83 ec 08             	sub    $0x8,%esp
+    2328:	68 25 56 00 00       	push   $0x5625
+    232d:	6a 01                	push   $0x1
+    232f:	e8 a8 22 00 00       	call   45dc <printf>
+    2334:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2337:	e8 9c 20 00 00       	call   43d8 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    233c:	83 ec 08             	sub    $0x8,%esp
+    233f:	68 02 02 00 00       	push   $0x202
+    2344:	68 40 56 00 00       	push   $0x5640
+    2349:	e8 ca 20 00 00       	call   4418 <open>
+    234e:	83 c4 10             	add    $0x10,%esp
+    2351:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2354:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2358:	79 17                	jns    2371 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    235a:	83 ec 08             	sub    $0x8,%esp
+    235d:	68 49 56 00 00       	push   $0x5649
+    2362:	6a 01                	push   $0x1
+    2364:	e8 73 22 00 00       	call   45dc <printf>
+    2369:	83 c4 10             	add    $0x10,%esp
+    exit();
+    236c:	e8 67 20 00 00       	call   43d8 <exit>
+  }
+  write(fd, "FF", 2);
+    2371:	83 ec 04             	sub    $0x4,%esp
+    2374:	6a 02                	push   $0x2
+    2376:	68 61 56 00 00       	push   $0x5661
+    237b:	ff 75 f4             	push   -0xc(%ebp)
+    237e:	e8 75 20 00 00       	call   43f8 <write>
+    2383:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2386:	83 ec 0c             	sub    $0xc,%esp
+    2389:	ff 75 f4             	push   -0xc(%ebp)
+    238c:	e8 6f 20 00 00       	call   4400 <close>
+    2391:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    2394:	83 ec 08             	sub    $0x8,%esp
+    2397:	6a 00                	push   $0x0
+    2399:	68 64 56 00 00       	push   $0x5664
+    239e:	e8 75 20 00 00       	call   4418 <open>
+    23a3:	83 c4 10             	add    $0x10,%esp
+    23a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    23a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    23ad:	79 17                	jns    23c6 <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    23af:	83 ec 08             	sub    $0x8,%esp
+    23b2:	68 70 56 00 00       	push   $0x5670
+    23b7:	6a 01                	push   $0x1
+    23b9:	e8 1e 22 00 00       	call   45dc <printf>
+    23be:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23c1:	e8 12 20 00 00       	call   43d8 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    23c6:	83 ec 04             	sub    $0x4,%esp
+    23c9:	68 00 20 00 00       	push   $0x2000
+    23ce:	68 20 6c 00 00       	push   $0x6c20
+    23d3:	ff 75 f4             	push   -0xc(%ebp)
+    23d6:	e8 15 20 00 00       	call   43f0 <read>
+    23db:	83 c4 10             	add    $0x10,%esp
+    23de:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    23e1:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    23e5:	75 0b                	jne    23f2 <subdir+0x1b7>
+    23e7:	0f b6 05 20 6c 00 00 	movzbl 0x6c20,%eax
+    23ee:	3c 66                	cmp    $0x66,%al
+    23f0:	74 17                	je     2409 <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    23f2:	83 ec 08             	sub    $0x8,%esp
+    23f5:	68 89 56 00 00       	push   $0x5689
+    23fa:	6a 01                	push   $0x1
+    23fc:	e8 db 21 00 00       	call   45dc <printf>
+    2401:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2404:	e8 cf 1f 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    2409:	83 ec 0c             	sub    $0xc,%esp
+    240c:	ff 75 f4             	push   -0xc(%ebp)
+    240f:	e8 ec 1f 00 00       	call   4400 <close>
+    2414:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2417:	83 ec 08             	sub    $0x8,%esp
+    241a:	68 a4 56 00 00       	push   $0x56a4
+    241f:	68 40 56 00 00       	push   $0x5640
+    2424:	e8 0f 20 00 00       	call   4438 <link>
+    2429:	83 c4 10             	add    $0x10,%esp
+    242c:	85 c0                	test   %eax,%eax
+    242e:	74 17                	je     2447 <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2430:	83 ec 08             	sub    $0x8,%esp
+    2433:	68 b0 56 00 00       	push   $0x56b0
+    2438:	6a 01                	push   $0x1
+    243a:	e8 9d 21 00 00       	call   45dc <printf>
+    243f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2442:	e8 91 1f 00 00       	call   43d8 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    2447:	83 ec 0c             	sub    $0xc,%esp
+    244a:	68 40 56 00 00       	push   $0x5640
+    244f:	e8 d4 1f 00 00       	call   4428 <unlink>
+    2454:	83 c4 10             	add    $0x10,%esp
+    2457:	85 c0                	test   %eax,%eax
+    2459:	74 17                	je     2472 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    245b:	83 ec 08             	sub    $0x8,%esp
+    245e:	68 d1 56 00 00       	push   $0x56d1
+    2463:	6a 01                	push   $0x1
+    2465:	e8 72 21 00 00       	call   45dc <printf>
+    246a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    246d:	e8 66 1f 00 00       	call   43d8 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2472:	83 ec 08             	sub    $0x8,%esp
+    2475:	6a 00                	push   $0x0
+    2477:	68 40 56 00 00       	push   $0x5640
+    247c:	e8 97 1f 00 00       	call   4418 <open>
+    2481:	83 c4 10             	add    $0x10,%esp
+    2484:	85 c0                	test   %eax,%eax
+    2486:	78 17                	js     249f <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2488:	83 ec 08             	sub    $0x8,%esp
+    248b:	68 ec 56 00 00       	push   $0x56ec
+    2490:	6a 01                	push   $0x1
+    2492:	e8 45 21 00 00       	call   45dc <printf>
+    2497:	83 c4 10             	add    $0x10,%esp
+    exit();
+    249a:	e8 39 1f 00 00       	call   43d8 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    249f:	83 ec 0c             	sub    $0xc,%esp
+    24a2:	68 c1 55 00 00       	push   $0x55c1
+    24a7:	e8 9c 1f 00 00       	call   4448 <chdir>
+    24ac:	83 c4 10             	add    $0x10,%esp
+    24af:	85 c0                	test   %eax,%eax
+    24b1:	74 17                	je     24ca <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    24b3:	83 ec 08             	sub    $0x8,%esp
+    24b6:	68 10 57 00 00       	push   $0x5710
+    24bb:	6a 01                	push   $0x1
+    24bd:	e8 1a 21 00 00       	call   45dc <printf>
+    24c2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24c5:	e8 0e 1f 00 00       	call   43d8 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    24ca:	83 ec 0c             	sub    $0xc,%esp
+    24cd:	68 21 57 00 00       	push   $0x5721
+    24d2:	e8 71 1f 00 00       	call   4448 <chdir>
+    24d7:	83 c4 10             	add    $0x10,%esp
+    24da:	85 c0                	test   %eax,%eax
+    24dc:	74 17                	je     24f5 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    24de:	83 ec 08             	sub    $0x8,%esp
+    24e1:	68 2d 57 00 00       	push   $0x572d
+    24e6:	6a 01                	push   $0x1
+    24e8:	e8 ef 20 00 00       	call   45dc <printf>
+    24ed:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24f0:	e8 e3 1e 00 00       	call   43d8 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    24f5:	83 ec 0c             	sub    $0xc,%esp
+    24f8:	68 47 57 00 00       	push   $0x5747
+    24fd:	e8 46 1f 00 00       	call   4448 <chdir>
+    2502:	83 c4 10             	add    $0x10,%esp
+    2505:	85 c0                	test   %eax,%eax
+    2507:	74 17                	je     2520 <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    2509:	83 ec 08             	sub    $0x8,%esp
+    250c:	68 2d 57 00 00       	push   $0x572d
+    2511:	6a 01                	push   $0x1
+    2513:	e8 c4 20 00 00       	call   45dc <printf>
+    2518:	83 c4 10             	add    $0x10,%esp
+    exit();
+    251b:	e8 b8 1e 00 00       	call   43d8 <exit>
+  }
+  if(chdir("./..") != 0){
+    2520:	83 ec 0c             	sub    $0xc,%esp
+    2523:	68 56 57 00 00       	push   $0x5756
+    2528:	e8 1b 1f 00 00       	call   4448 <chdir>
+    252d:	83 c4 10             	add    $0x10,%esp
+    2530:	85 c0                	test   %eax,%eax
+    2532:	74 17                	je     254b <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    2534:	83 ec 08             	sub    $0x8,%esp
+    2537:	68 5b 57 00 00       	push   $0x575b
+    253c:	6a 01                	push   $0x1
+    253e:	e8 99 20 00 00       	call   45dc <printf>
+    2543:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2546:	e8 8d 1e 00 00       	call   43d8 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    254b:	83 ec 08             	sub    $0x8,%esp
+    254e:	6a 00                	push   $0x0
+    2550:	68 a4 56 00 00       	push   $0x56a4
+    2555:	e8 be 1e 00 00       	call   4418 <open>
+    255a:	83 c4 10             	add    $0x10,%esp
+    255d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2560:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2564:	79 17                	jns    257d <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    2566:	83 ec 08             	sub    $0x8,%esp
+    2569:	68 6e 57 00 00       	push   $0x576e
+    256e:	6a 01                	push   $0x1
+    2570:	e8 67 20 00 00       	call   45dc <printf>
+    2575:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2578:	e8 5b 1e 00 00       	call   43d8 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    257d:	83 ec 04             	sub    $0x4,%esp
+    2580:	68 00 20 00 00       	push   $0x2000
+    2585:	68 20 6c 00 00       	push   $0x6c20
+    258a:	ff 75 f4             	push   -0xc(%ebp)
+    258d:	e8 5e 1e 00 00       	call   43f0 <read>
+    2592:	83 c4 10             	add    $0x10,%esp
+    2595:	83 f8 02             	cmp    $0x2,%eax
+    2598:	74 17                	je     25b1 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    259a:	83 ec 08             	sub    $0x8,%esp
+    259d:	68 86 57 00 00       	push   $0x5786
+    25a2:	6a 01                	push   $0x1
+    25a4:	e8 33 20 00 00       	call   45dc <printf>
+    25a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25ac:	e8 27 1e 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    25b1:	83 ec 0c             	sub    $0xc,%esp
+    25b4:	ff 75 f4             	push   -0xc(%ebp)
+    25b7:	e8 44 1e 00 00       	call   4400 <close>
+    25bc:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    25bf:	83 ec 08             	sub    $0x8,%esp
+    25c2:	6a 00                	push   $0x0
+    25c4:	68 40 56 00 00       	push   $0x5640
+    25c9:	e8 4a 1e 00 00       	call   4418 <open>
+    25ce:	83 c4 10             	add    $0x10,%esp
+    25d1:	85 c0                	test   %eax,%eax
+    25d3:	78 17                	js     25ec <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    25d5:	83 ec 08             	sub    $0x8,%esp
+    25d8:	68 a4 57 00 00       	push   $0x57a4
+    25dd:	6a 01                	push   $0x1
+    25df:	e8 f8 1f 00 00       	call   45dc <printf>
+    25e4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    25e7:	e8 ec 1d 00 00       	call   43d8 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    25ec:	83 ec 08             	sub    $0x8,%esp
+    25ef:	68 02 02 00 00       	push   $0x202
+    25f4:	68 c9 57 00 00       	push   $0x57c9
+    25f9:	e8 1a 1e 00 00       	call   4418 <open>
+    25fe:	83 c4 10             	add    $0x10,%esp
+    2601:	85 c0                	test   %eax,%eax
+    2603:	78 17                	js     261c <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2605:	83 ec 08             	sub    $0x8,%esp
+    2608:	68 d2 57 00 00       	push   $0x57d2
+    260d:	6a 01                	push   $0x1
+    260f:	e8 c8 1f 00 00       	call   45dc <printf>
+    2614:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2617:	e8 bc 1d 00 00       	call   43d8 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    261c:	83 ec 08             	sub    $0x8,%esp
+    261f:	68 02 02 00 00       	push   $0x202
+    2624:	68 ee 57 00 00       	push   $0x57ee
+    2629:	e8 ea 1d 00 00       	call   4418 <open>
+    262e:	83 c4 10             	add    $0x10,%esp
+    2631:	85 c0                	test   %eax,%eax
+    2633:	78 17                	js     264c <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2635:	83 ec 08             	sub    $0x8,%esp
+    2638:	68 f7 57 00 00       	push   $0x57f7
+    263d:	6a 01                	push   $0x1
+    263f:	e8 98 1f 00 00       	call   45dc <printf>
+    2644:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2647:	e8 8c 1d 00 00       	call   43d8 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    264c:	83 ec 08             	sub    $0x8,%esp
+    264f:	68 00 02 00 00       	push   $0x200
+    2654:	68 c1 55 00 00       	push   $0x55c1
+    2659:	e8 ba 1d 00 00       	call   4418 <open>
+    265e:	83 c4 10             	add    $0x10,%esp
+    2661:	85 c0                	test   %eax,%eax
+    2663:	78 17                	js     267c <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    2665:	83 ec 08             	sub    $0x8,%esp
+    2668:	68 13 58 00 00       	push   $0x5813
+    266d:	6a 01                	push   $0x1
+    266f:	e8 68 1f 00 00       	call   45dc <printf>
+    2674:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2677:	e8 5c 1d 00 00       	call   43d8 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    267c:	83 ec 08             	sub    $0x8,%esp
+    267f:	6a 02                	push   $0x2
+    2681:	68 c1 55 00 00       	push   $0x55c1
+    2686:	e8 8d 1d 00 00       	call   4418 <open>
+    268b:	83 c4 10             	add    $0x10,%esp
+    268e:	85 c0                	test   %eax,%eax
+    2690:	78 17                	js     26a9 <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    2692:	83 ec 08             	sub    $0x8,%esp
+    2695:	68 29 58 00 00       	push   $0x5829
+    269a:	6a 01                	push   $0x1
+    269c:	e8 3b 1f 00 00       	call   45dc <printf>
+    26a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26a4:	e8 2f 1d 00 00       	call   43d8 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    26a9:	83 ec 08             	sub    $0x8,%esp
+    26ac:	6a 01                	push   $0x1
+    26ae:	68 c1 55 00 00       	push   $0x55c1
+    26b3:	e8 60 1d 00 00       	call   4418 <open>
+    26b8:	83 c4 10             	add    $0x10,%esp
+    26bb:	85 c0                	test   %eax,%eax
+    26bd:	78 17                	js     26d6 <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    26bf:	83 ec 08             	sub    $0x8,%esp
+    26c2:	68 42 58 00 00       	push   $0x5842
+    26c7:	6a 01                	push   $0x1
+    26c9:	e8 0e 1f 00 00       	call   45dc <printf>
+    26ce:	83 c4 10             	add    $0x10,%esp
+    exit();
+    26d1:	e8 02 1d 00 00       	call   43d8 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    26d6:	83 ec 08             	sub    $0x8,%esp
+    26d9:	68 5d 58 00 00       	push   $0x585d
+    26de:	68 c9 57 00 00       	push   $0x57c9
+    26e3:	e8 50 1d 00 00       	call   4438 <link>
+    26e8:	83 c4 10             	add    $0x10,%esp
+    26eb:	85 c0                	test   %eax,%eax
+    26ed:	75 17                	jne    2706 <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    26ef:	83 ec 08             	sub    $0x8,%esp
+    26f2:	68 68 58 00 00       	push   $0x5868
+    26f7:	6a 01                	push   $0x1
+    26f9:	e8 de 1e 00 00       	call   45dc <printf>
+    26fe:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2701:	e8 d2 1c 00 00       	call   43d8 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    2706:	83 ec 08             	sub    $0x8,%esp
+    2709:	68 5d 58 00 00       	push   $0x585d
+    270e:	68 ee 57 00 00       	push   $0x57ee
+    2713:	e8 20 1d 00 00       	call   4438 <link>
+    2718:	83 c4 10             	add    $0x10,%esp
+    271b:	85 c0                	test   %eax,%eax
+    271d:	75 17                	jne    2736 <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    271f:	83 ec 08             	sub    $0x8,%esp
+    2722:	68 8c 58 00 00       	push   $0x588c
+    2727:	6a 01                	push   $0x1
+    2729:	e8 ae 1e 00 00       	call   45dc <printf>
+    272e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2731:	e8 a2 1c 00 00       	call   43d8 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2736:	83 ec 08             	sub    $0x8,%esp
+    2739:	68 a4 56 00 00       	push   $0x56a4
+    273e:	68 dc 55 00 00       	push   $0x55dc
+    2743:	e8 f0 1c 00 00       	call   4438 <link>
+    2748:	83 c4 10             	add    $0x10,%esp
+    274b:	85 c0                	test   %eax,%eax
+    274d:	75 17                	jne    2766 <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    274f:	83 ec 08             	sub    $0x8,%esp
+    2752:	68 b0 58 00 00       	push   $0x58b0
+    2757:	6a 01                	push   $0x1
+    2759:	e8 7e 1e 00 00       	call   45dc <printf>
+    275e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2761:	e8 72 1c 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    2766:	83 ec 0c             	sub    $0xc,%esp
+    2769:	68 c9 57 00 00       	push   $0x57c9
+    276e:	e8 cd 1c 00 00       	call   4440 <mkdir>
+    2773:	83 c4 10             	add    $0x10,%esp
+    2776:	85 c0                	test   %eax,%eax
+    2778:	75 17                	jne    2791 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    277a:	83 ec 08             	sub    $0x8,%esp
+    277d:	68 d2 58 00 00       	push   $0x58d2
+    2782:	6a 01                	push   $0x1
+    2784:	e8 53 1e 00 00       	call   45dc <printf>
+    2789:	83 c4 10             	add    $0x10,%esp
+    exit();
+    278c:	e8 47 1c 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    2791:	83 ec 0c             	sub    $0xc,%esp
+    2794:	68 ee 57 00 00       	push   $0x57ee
+    2799:	e8 a2 1c 00 00       	call   4440 <mkdir>
+    279e:	83 c4 10             	add    $0x10,%esp
+    27a1:	85 c0                	test   %eax,%eax
+    27a3:	75 17                	jne    27bc <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    27a5:	83 ec 08             	sub    $0x8,%esp
+    27a8:	68 ed 58 00 00       	push   $0x58ed
+    27ad:	6a 01                	push   $0x1
+    27af:	e8 28 1e 00 00       	call   45dc <printf>
+    27b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27b7:	e8 1c 1c 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    27bc:	83 ec 0c             	sub    $0xc,%esp
+    27bf:	68 a4 56 00 00       	push   $0x56a4
+    27c4:	e8 77 1c 00 00       	call   4440 <mkdir>
+    27c9:	83 c4 10             	add    $0x10,%esp
+    27cc:	85 c0                	test   %eax,%eax
+    27ce:	75 17                	jne    27e7 <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    27d0:	83 ec 08             	sub    $0x8,%esp
+    27d3:	68 08 59 00 00       	push   $0x5908
+    27d8:	6a 01                	push   $0x1
+    27da:	e8 fd 1d 00 00       	call   45dc <printf>
+    27df:	83 c4 10             	add    $0x10,%esp
+    exit();
+    27e2:	e8 f1 1b 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    27e7:	83 ec 0c             	sub    $0xc,%esp
+    27ea:	68 ee 57 00 00       	push   $0x57ee
+    27ef:	e8 34 1c 00 00       	call   4428 <unlink>
+    27f4:	83 c4 10             	add    $0x10,%esp
+    27f7:	85 c0                	test   %eax,%eax
+    27f9:	75 17                	jne    2812 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    27fb:	83 ec 08             	sub    $0x8,%esp
+    27fe:	68 25 59 00 00       	push   $0x5925
+    2803:	6a 01                	push   $0x1
+    2805:	e8 d2 1d 00 00       	call   45dc <printf>
+    280a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    280d:	e8 c6 1b 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    2812:	83 ec 0c             	sub    $0xc,%esp
+    2815:	68 c9 57 00 00       	push   $0x57c9
+    281a:	e8 09 1c 00 00       	call   4428 <unlink>
+    281f:	83 c4 10             	add    $0x10,%esp
+    2822:	85 c0                	test   %eax,%eax
+    2824:	75 17                	jne    283d <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    2826:	83 ec 08             	sub    $0x8,%esp
+    2829:	68 41 59 00 00       	push   $0x5941
+    282e:	6a 01                	push   $0x1
+    2830:	e8 a7 1d 00 00       	call   45dc <printf>
+    2835:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2838:	e8 9b 1b 00 00       	call   43d8 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    283d:	83 ec 0c             	sub    $0xc,%esp
+    2840:	68 dc 55 00 00       	push   $0x55dc
+    2845:	e8 fe 1b 00 00       	call   4448 <chdir>
+    284a:	83 c4 10             	add    $0x10,%esp
+    284d:	85 c0                	test   %eax,%eax
+    284f:	75 17                	jne    2868 <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    2851:	83 ec 08             	sub    $0x8,%esp
+    2854:	68 5d 59 00 00       	push   $0x595d
+    2859:	6a 01                	push   $0x1
+    285b:	e8 7c 1d 00 00       	call   45dc <printf>
+    2860:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2863:	e8 70 1b 00 00       	call   43d8 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    2868:	83 ec 0c             	sub    $0xc,%esp
+    286b:	68 75 59 00 00       	push   $0x5975
+    2870:	e8 d3 1b 00 00       	call   4448 <chdir>
+    2875:	83 c4 10             	add    $0x10,%esp
+    2878:	85 c0                	test   %eax,%eax
+    287a:	75 17                	jne    2893 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    287c:	83 ec 08             	sub    $0x8,%esp
+    287f:	68 7b 59 00 00       	push   $0x597b
+    2884:	6a 01                	push   $0x1
+    2886:	e8 51 1d 00 00       	call   45dc <printf>
+    288b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    288e:	e8 45 1b 00 00       	call   43d8 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    2893:	83 ec 0c             	sub    $0xc,%esp
+    2896:	68 a4 56 00 00       	push   $0x56a4
+    289b:	e8 88 1b 00 00       	call   4428 <unlink>
+    28a0:	83 c4 10             	add    $0x10,%esp
+    28a3:	85 c0                	test   %eax,%eax
+    28a5:	74 17                	je     28be <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    28a7:	83 ec 08             	sub    $0x8,%esp
+    28aa:	68 d1 56 00 00       	push   $0x56d1
+    28af:	6a 01                	push   $0x1
+    28b1:	e8 26 1d 00 00       	call   45dc <printf>
+    28b6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28b9:	e8 1a 1b 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    28be:	83 ec 0c             	sub    $0xc,%esp
+    28c1:	68 dc 55 00 00       	push   $0x55dc
+    28c6:	e8 5d 1b 00 00       	call   4428 <unlink>
+    28cb:	83 c4 10             	add    $0x10,%esp
+    28ce:	85 c0                	test   %eax,%eax
+    28d0:	74 17                	je     28e9 <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    28d2:	83 ec 08             	sub    $0x8,%esp
+    28d5:	68 93 59 00 00       	push   $0x5993
+    28da:	6a 01                	push   $0x1
+    28dc:	e8 fb 1c 00 00       	call   45dc <printf>
+    28e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    28e4:	e8 ef 1a 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd") == 0){
+    28e9:	83 ec 0c             	sub    $0xc,%esp
+    28ec:	68 c1 55 00 00       	push   $0x55c1
+    28f1:	e8 32 1b 00 00       	call   4428 <unlink>
+    28f6:	83 c4 10             	add    $0x10,%esp
+    28f9:	85 c0                	test   %eax,%eax
+    28fb:	75 17                	jne    2914 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    28fd:	83 ec 08             	sub    $0x8,%esp
+    2900:	68 a8 59 00 00       	push   $0x59a8
+    2905:	6a 01                	push   $0x1
+    2907:	e8 d0 1c 00 00       	call   45dc <printf>
+    290c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    290f:	e8 c4 1a 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    2914:	83 ec 0c             	sub    $0xc,%esp
+    2917:	68 c8 59 00 00       	push   $0x59c8
+    291c:	e8 07 1b 00 00       	call   4428 <unlink>
+    2921:	83 c4 10             	add    $0x10,%esp
+    2924:	85 c0                	test   %eax,%eax
+    2926:	79 17                	jns    293f <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    2928:	83 ec 08             	sub    $0x8,%esp
+    292b:	68 ce 59 00 00       	push   $0x59ce
+    2930:	6a 01                	push   $0x1
+    2932:	e8 a5 1c 00 00       	call   45dc <printf>
+    2937:	83 c4 10             	add    $0x10,%esp
+    exit();
+    293a:	e8 99 1a 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dd") < 0){
+    293f:	83 ec 0c             	sub    $0xc,%esp
+    2942:	68 c1 55 00 00       	push   $0x55c1
+    2947:	e8 dc 1a 00 00       	call   4428 <unlink>
+    294c:	83 c4 10             	add    $0x10,%esp
+    294f:	85 c0                	test   %eax,%eax
+    2951:	79 17                	jns    296a <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    2953:	83 ec 08             	sub    $0x8,%esp
+    2956:	68 e3 59 00 00       	push   $0x59e3
+    295b:	6a 01                	push   $0x1
+    295d:	e8 7a 1c 00 00       	call   45dc <printf>
+    2962:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2965:	e8 6e 1a 00 00       	call   43d8 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    296a:	83 ec 08             	sub    $0x8,%esp
+    296d:	68 f5 59 00 00       	push   $0x59f5
+    2972:	6a 01                	push   $0x1
+    2974:	e8 63 1c 00 00       	call   45dc <printf>
+    2979:	83 c4 10             	add    $0x10,%esp
+}
+    297c:	90                   	nop
+    297d:	c9                   	leave
+    297e:	c3                   	ret
+
+0000297f <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    297f:	55                   	push   %ebp
+    2980:	89 e5                	mov    %esp,%ebp
+    2982:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    2985:	83 ec 08             	sub    $0x8,%esp
+    2988:	68 00 5a 00 00       	push   $0x5a00
+    298d:	6a 01                	push   $0x1
+    298f:	e8 48 1c 00 00       	call   45dc <printf>
+    2994:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    2997:	83 ec 0c             	sub    $0xc,%esp
+    299a:	68 0f 5a 00 00       	push   $0x5a0f
+    299f:	e8 84 1a 00 00       	call   4428 <unlink>
+    29a4:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    29a7:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    29ae:	e9 a8 00 00 00       	jmp    2a5b <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    29b3:	83 ec 08             	sub    $0x8,%esp
+    29b6:	68 02 02 00 00       	push   $0x202
+    29bb:	68 0f 5a 00 00       	push   $0x5a0f
+    29c0:	e8 53 1a 00 00       	call   4418 <open>
+    29c5:	83 c4 10             	add    $0x10,%esp
+    29c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    29cb:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    29cf:	79 17                	jns    29e8 <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    29d1:	83 ec 08             	sub    $0x8,%esp
+    29d4:	68 18 5a 00 00       	push   $0x5a18
+    29d9:	6a 01                	push   $0x1
+    29db:	e8 fc 1b 00 00       	call   45dc <printf>
+    29e0:	83 c4 10             	add    $0x10,%esp
+      exit();
+    29e3:	e8 f0 19 00 00       	call   43d8 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    29e8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    29ef:	eb 3f                	jmp    2a30 <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    29f1:	83 ec 04             	sub    $0x4,%esp
+    29f4:	ff 75 f4             	push   -0xc(%ebp)
+    29f7:	68 20 6c 00 00       	push   $0x6c20
+    29fc:	ff 75 ec             	push   -0x14(%ebp)
+    29ff:	e8 f4 19 00 00       	call   43f8 <write>
+    2a04:	83 c4 10             	add    $0x10,%esp
+    2a07:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    2a0a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2a0d:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    2a10:	74 1a                	je     2a2c <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    2a12:	ff 75 e8             	push   -0x18(%ebp)
+    2a15:	ff 75 f4             	push   -0xc(%ebp)
+    2a18:	68 30 5a 00 00       	push   $0x5a30
+    2a1d:	6a 01                	push   $0x1
+    2a1f:	e8 b8 1b 00 00       	call   45dc <printf>
+    2a24:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2a27:	e8 ac 19 00 00       	call   43d8 <exit>
+    for(i = 0; i < 2; i++){
+    2a2c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    2a30:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    2a34:	7e bb                	jle    29f1 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    2a36:	83 ec 0c             	sub    $0xc,%esp
+    2a39:	ff 75 ec             	push   -0x14(%ebp)
+    2a3c:	e8 bf 19 00 00       	call   4400 <close>
+    2a41:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    2a44:	83 ec 0c             	sub    $0xc,%esp
+    2a47:	68 0f 5a 00 00       	push   $0x5a0f
+    2a4c:	e8 d7 19 00 00       	call   4428 <unlink>
+    2a51:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    2a54:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    2a5b:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    2a62:	0f 8e 4b ff ff ff    	jle    29b3 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    2a68:	83 ec 08             	sub    $0x8,%esp
+    2a6b:	68 42 5a 00 00       	push   $0x5a42
+    2a70:	6a 01                	push   $0x1
+    2a72:	e8 65 1b 00 00       	call   45dc <printf>
+    2a77:	83 c4 10             	add    $0x10,%esp
+}
+    2a7a:	90                   	nop
+    2a7b:	c9                   	leave
+    2a7c:	c3                   	ret
+
+00002a7d <bigfile>:
+
+void
+bigfile(void)
+{
+    2a7d:	55                   	push   %ebp
+    2a7e:	89 e5                	mov    %esp,%ebp
+    2a80:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    2a83:	83 ec 08             	sub    $0x8,%esp
+    2a86:	68 4f 5a 00 00       	push   $0x5a4f
+    2a8b:	6a 01                	push   $0x1
+    2a8d:	e8 4a 1b 00 00       	call   45dc <printf>
+    2a92:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    2a95:	83 ec 0c             	sub    $0xc,%esp
+    2a98:	68 5d 5a 00 00       	push   $0x5a5d
+    2a9d:	e8 86 19 00 00       	call   4428 <unlink>
+    2aa2:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2aa5:	83 ec 08             	sub    $0x8,%esp
+    2aa8:	68 02 02 00 00       	push   $0x202
+    2aad:	68 5d 5a 00 00       	push   $0x5a5d
+    2ab2:	e8 61 19 00 00       	call   4418 <open>
+    2ab7:	83 c4 10             	add    $0x10,%esp
+    2aba:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2abd:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2ac1:	79 17                	jns    2ada <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    2ac3:	83 ec 08             	sub    $0x8,%esp
+    2ac6:	68 65 5a 00 00       	push   $0x5a65
+    2acb:	6a 01                	push   $0x1
+    2acd:	e8 0a 1b 00 00       	call   45dc <printf>
+    2ad2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ad5:	e8 fe 18 00 00       	call   43d8 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    2ada:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2ae1:	eb 52                	jmp    2b35 <bigfile+0xb8>
+    memset(buf, i, 600);
+    2ae3:	83 ec 04             	sub    $0x4,%esp
+    2ae6:	68 58 02 00 00       	push   $0x258
+    2aeb:	ff 75 f4             	push   -0xc(%ebp)
+    2aee:	68 20 6c 00 00       	push   $0x6c20
+    2af3:	e8 14 17 00 00       	call   420c <memset>
+    2af8:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    2afb:	83 ec 04             	sub    $0x4,%esp
+    2afe:	68 58 02 00 00       	push   $0x258
+    2b03:	68 20 6c 00 00       	push   $0x6c20
+    2b08:	ff 75 ec             	push   -0x14(%ebp)
+    2b0b:	e8 e8 18 00 00       	call   43f8 <write>
+    2b10:	83 c4 10             	add    $0x10,%esp
+    2b13:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2b18:	74 17                	je     2b31 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    2b1a:	83 ec 08             	sub    $0x8,%esp
+    2b1d:	68 7b 5a 00 00       	push   $0x5a7b
+    2b22:	6a 01                	push   $0x1
+    2b24:	e8 b3 1a 00 00       	call   45dc <printf>
+    2b29:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2b2c:	e8 a7 18 00 00       	call   43d8 <exit>
+  for(i = 0; i < 20; i++){
+    2b31:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2b35:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    2b39:	7e a8                	jle    2ae3 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    2b3b:	83 ec 0c             	sub    $0xc,%esp
+    2b3e:	ff 75 ec             	push   -0x14(%ebp)
+    2b41:	e8 ba 18 00 00       	call   4400 <close>
+    2b46:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    2b49:	83 ec 08             	sub    $0x8,%esp
+    2b4c:	6a 00                	push   $0x0
+    2b4e:	68 5d 5a 00 00       	push   $0x5a5d
+    2b53:	e8 c0 18 00 00       	call   4418 <open>
+    2b58:	83 c4 10             	add    $0x10,%esp
+    2b5b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    2b5e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2b62:	79 17                	jns    2b7b <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    2b64:	83 ec 08             	sub    $0x8,%esp
+    2b67:	68 91 5a 00 00       	push   $0x5a91
+    2b6c:	6a 01                	push   $0x1
+    2b6e:	e8 69 1a 00 00       	call   45dc <printf>
+    2b73:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2b76:	e8 5d 18 00 00       	call   43d8 <exit>
+  }
+  total = 0;
+    2b7b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    2b82:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    2b89:	83 ec 04             	sub    $0x4,%esp
+    2b8c:	68 2c 01 00 00       	push   $0x12c
+    2b91:	68 20 6c 00 00       	push   $0x6c20
+    2b96:	ff 75 ec             	push   -0x14(%ebp)
+    2b99:	e8 52 18 00 00       	call   43f0 <read>
+    2b9e:	83 c4 10             	add    $0x10,%esp
+    2ba1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    2ba4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2ba8:	79 17                	jns    2bc1 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    2baa:	83 ec 08             	sub    $0x8,%esp
+    2bad:	68 a6 5a 00 00       	push   $0x5aa6
+    2bb2:	6a 01                	push   $0x1
+    2bb4:	e8 23 1a 00 00       	call   45dc <printf>
+    2bb9:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2bbc:	e8 17 18 00 00       	call   43d8 <exit>
+    }
+    if(cc == 0)
+    2bc1:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2bc5:	74 7a                	je     2c41 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    2bc7:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    2bce:	74 17                	je     2be7 <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    2bd0:	83 ec 08             	sub    $0x8,%esp
+    2bd3:	68 bb 5a 00 00       	push   $0x5abb
+    2bd8:	6a 01                	push   $0x1
+    2bda:	e8 fd 19 00 00       	call   45dc <printf>
+    2bdf:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2be2:	e8 f1 17 00 00       	call   43d8 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2be7:	0f b6 05 20 6c 00 00 	movzbl 0x6c20,%eax
+    2bee:	0f be d0             	movsbl %al,%edx
+    2bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2bf4:	89 c1                	mov    %eax,%ecx
+    2bf6:	c1 e9 1f             	shr    $0x1f,%ecx
+    2bf9:	01 c8                	add    %ecx,%eax
+    2bfb:	d1 f8                	sar    %eax
+    2bfd:	39 c2                	cmp    %eax,%edx
+    2bff:	75 1a                	jne    2c1b <bigfile+0x19e>
+    2c01:	0f b6 05 4b 6d 00 00 	movzbl 0x6d4b,%eax
+    2c08:	0f be d0             	movsbl %al,%edx
+    2c0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2c0e:	89 c1                	mov    %eax,%ecx
+    2c10:	c1 e9 1f             	shr    $0x1f,%ecx
+    2c13:	01 c8                	add    %ecx,%eax
+    2c15:	d1 f8                	sar    %eax
+    2c17:	39 c2                	cmp    %eax,%edx
+    2c19:	74 17                	je     2c32 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    2c1b:	83 ec 08             	sub    $0x8,%esp
+    2c1e:	68 cf 5a 00 00       	push   $0x5acf
+    2c23:	6a 01                	push   $0x1
+    2c25:	e8 b2 19 00 00       	call   45dc <printf>
+    2c2a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2c2d:	e8 a6 17 00 00       	call   43d8 <exit>
+    }
+    total += cc;
+    2c32:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    2c35:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    2c38:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    2c3c:	e9 48 ff ff ff       	jmp    2b89 <bigfile+0x10c>
+      break;
+    2c41:	90                   	nop
+  }
+  close(fd);
+    2c42:	83 ec 0c             	sub    $0xc,%esp
+    2c45:	ff 75 ec             	push   -0x14(%ebp)
+    2c48:	e8 b3 17 00 00       	call   4400 <close>
+    2c4d:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    2c50:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    2c57:	74 17                	je     2c70 <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    2c59:	83 ec 08             	sub    $0x8,%esp
+    2c5c:	68 e8 5a 00 00       	push   $0x5ae8
+    2c61:	6a 01                	push   $0x1
+    2c63:	e8 74 19 00 00       	call   45dc <printf>
+    2c68:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c6b:	e8 68 17 00 00       	call   43d8 <exit>
+  }
+  unlink("bigfile");
+    2c70:	83 ec 0c             	sub    $0xc,%esp
+    2c73:	68 5d 5a 00 00       	push   $0x5a5d
+    2c78:	e8 ab 17 00 00       	call   4428 <unlink>
+    2c7d:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    2c80:	83 ec 08             	sub    $0x8,%esp
+    2c83:	68 02 5b 00 00       	push   $0x5b02
+    2c88:	6a 01                	push   $0x1
+    2c8a:	e8 4d 19 00 00       	call   45dc <printf>
+    2c8f:	83 c4 10             	add    $0x10,%esp
+}
+    2c92:	90                   	nop
+    2c93:	c9                   	leave
+    2c94:	c3                   	ret
+
+00002c95 <fourteen>:
+
+void
+fourteen(void)
+{
+    2c95:	55                   	push   %ebp
+    2c96:	89 e5                	mov    %esp,%ebp
+    2c98:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    2c9b:	83 ec 08             	sub    $0x8,%esp
+    2c9e:	68 13 5b 00 00       	push   $0x5b13
+    2ca3:	6a 01                	push   $0x1
+    2ca5:	e8 32 19 00 00       	call   45dc <printf>
+    2caa:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    2cad:	83 ec 0c             	sub    $0xc,%esp
+    2cb0:	68 22 5b 00 00       	push   $0x5b22
+    2cb5:	e8 86 17 00 00       	call   4440 <mkdir>
+    2cba:	83 c4 10             	add    $0x10,%esp
+    2cbd:	85 c0                	test   %eax,%eax
+    2cbf:	74 17                	je     2cd8 <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    2cc1:	83 ec 08             	sub    $0x8,%esp
+    2cc4:	68 31 5b 00 00       	push   $0x5b31
+    2cc9:	6a 01                	push   $0x1
+    2ccb:	e8 0c 19 00 00       	call   45dc <printf>
+    2cd0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cd3:	e8 00 17 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2cd8:	83 ec 0c             	sub    $0xc,%esp
+    2cdb:	68 50 5b 00 00       	push   $0x5b50
+    2ce0:	e8 5b 17 00 00       	call   4440 <mkdir>
+    2ce5:	83 c4 10             	add    $0x10,%esp
+    2ce8:	85 c0                	test   %eax,%eax
+    2cea:	74 17                	je     2d03 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2cec:	83 ec 08             	sub    $0x8,%esp
+    2cef:	68 70 5b 00 00       	push   $0x5b70
+    2cf4:	6a 01                	push   $0x1
+    2cf6:	e8 e1 18 00 00       	call   45dc <printf>
+    2cfb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cfe:	e8 d5 16 00 00       	call   43d8 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2d03:	83 ec 08             	sub    $0x8,%esp
+    2d06:	68 00 02 00 00       	push   $0x200
+    2d0b:	68 a0 5b 00 00       	push   $0x5ba0
+    2d10:	e8 03 17 00 00       	call   4418 <open>
+    2d15:	83 c4 10             	add    $0x10,%esp
+    2d18:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2d1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2d1f:	79 17                	jns    2d38 <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2d21:	83 ec 08             	sub    $0x8,%esp
+    2d24:	68 d0 5b 00 00       	push   $0x5bd0
+    2d29:	6a 01                	push   $0x1
+    2d2b:	e8 ac 18 00 00       	call   45dc <printf>
+    2d30:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d33:	e8 a0 16 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    2d38:	83 ec 0c             	sub    $0xc,%esp
+    2d3b:	ff 75 f4             	push   -0xc(%ebp)
+    2d3e:	e8 bd 16 00 00       	call   4400 <close>
+    2d43:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2d46:	83 ec 08             	sub    $0x8,%esp
+    2d49:	6a 00                	push   $0x0
+    2d4b:	68 10 5c 00 00       	push   $0x5c10
+    2d50:	e8 c3 16 00 00       	call   4418 <open>
+    2d55:	83 c4 10             	add    $0x10,%esp
+    2d58:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2d5b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2d5f:	79 17                	jns    2d78 <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2d61:	83 ec 08             	sub    $0x8,%esp
+    2d64:	68 40 5c 00 00       	push   $0x5c40
+    2d69:	6a 01                	push   $0x1
+    2d6b:	e8 6c 18 00 00       	call   45dc <printf>
+    2d70:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d73:	e8 60 16 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    2d78:	83 ec 0c             	sub    $0xc,%esp
+    2d7b:	ff 75 f4             	push   -0xc(%ebp)
+    2d7e:	e8 7d 16 00 00       	call   4400 <close>
+    2d83:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2d86:	83 ec 0c             	sub    $0xc,%esp
+    2d89:	68 7a 5c 00 00       	push   $0x5c7a
+    2d8e:	e8 ad 16 00 00       	call   4440 <mkdir>
+    2d93:	83 c4 10             	add    $0x10,%esp
+    2d96:	85 c0                	test   %eax,%eax
+    2d98:	75 17                	jne    2db1 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2d9a:	83 ec 08             	sub    $0x8,%esp
+    2d9d:	68 98 5c 00 00       	push   $0x5c98
+    2da2:	6a 01                	push   $0x1
+    2da4:	e8 33 18 00 00       	call   45dc <printf>
+    2da9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dac:	e8 27 16 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2db1:	83 ec 0c             	sub    $0xc,%esp
+    2db4:	68 c8 5c 00 00       	push   $0x5cc8
+    2db9:	e8 82 16 00 00       	call   4440 <mkdir>
+    2dbe:	83 c4 10             	add    $0x10,%esp
+    2dc1:	85 c0                	test   %eax,%eax
+    2dc3:	75 17                	jne    2ddc <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2dc5:	83 ec 08             	sub    $0x8,%esp
+    2dc8:	68 e8 5c 00 00       	push   $0x5ce8
+    2dcd:	6a 01                	push   $0x1
+    2dcf:	e8 08 18 00 00       	call   45dc <printf>
+    2dd4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dd7:	e8 fc 15 00 00       	call   43d8 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    2ddc:	83 ec 08             	sub    $0x8,%esp
+    2ddf:	68 19 5d 00 00       	push   $0x5d19
+    2de4:	6a 01                	push   $0x1
+    2de6:	e8 f1 17 00 00       	call   45dc <printf>
+    2deb:	83 c4 10             	add    $0x10,%esp
+}
+    2dee:	90                   	nop
+    2def:	c9                   	leave
+    2df0:	c3                   	ret
+
+00002df1 <rmdot>:
+
+void
+rmdot(void)
+{
+    2df1:	55                   	push   %ebp
+    2df2:	89 e5                	mov    %esp,%ebp
+    2df4:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    2df7:	83 ec 08             	sub    $0x8,%esp
+    2dfa:	68 26 5d 00 00       	push   $0x5d26
+    2dff:	6a 01                	push   $0x1
+    2e01:	e8 d6 17 00 00       	call   45dc <printf>
+    2e06:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    2e09:	83 ec 0c             	sub    $0xc,%esp
+    2e0c:	68 32 5d 00 00       	push   $0x5d32
+    2e11:	e8 2a 16 00 00       	call   4440 <mkdir>
+    2e16:	83 c4 10             	add    $0x10,%esp
+    2e19:	85 c0                	test   %eax,%eax
+    2e1b:	74 17                	je     2e34 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    2e1d:	83 ec 08             	sub    $0x8,%esp
+    2e20:	68 37 5d 00 00       	push   $0x5d37
+    2e25:	6a 01                	push   $0x1
+    2e27:	e8 b0 17 00 00       	call   45dc <printf>
+    2e2c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e2f:	e8 a4 15 00 00       	call   43d8 <exit>
+  }
+  if(chdir("dots") != 0){
+    2e34:	83 ec 0c             	sub    $0xc,%esp
+    2e37:	68 32 5d 00 00       	push   $0x5d32
+    2e3c:	e8 07 16 00 00       	call   4448 <chdir>
+    2e41:	83 c4 10             	add    $0x10,%esp
+    2e44:	85 c0                	test   %eax,%eax
+    2e46:	74 17                	je     2e5f <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    2e48:	83 ec 08             	sub    $0x8,%esp
+    2e4b:	68 4a 5d 00 00       	push   $0x5d4a
+    2e50:	6a 01                	push   $0x1
+    2e52:	e8 85 17 00 00       	call   45dc <printf>
+    2e57:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e5a:	e8 79 15 00 00       	call   43d8 <exit>
+  }
+  if(unlink(".") == 0){
+    2e5f:	83 ec 0c             	sub    $0xc,%esp
+    2e62:	68 63 54 00 00       	push   $0x5463
+    2e67:	e8 bc 15 00 00       	call   4428 <unlink>
+    2e6c:	83 c4 10             	add    $0x10,%esp
+    2e6f:	85 c0                	test   %eax,%eax
+    2e71:	75 17                	jne    2e8a <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    2e73:	83 ec 08             	sub    $0x8,%esp
+    2e76:	68 5d 5d 00 00       	push   $0x5d5d
+    2e7b:	6a 01                	push   $0x1
+    2e7d:	e8 5a 17 00 00       	call   45dc <printf>
+    2e82:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e85:	e8 4e 15 00 00       	call   43d8 <exit>
+  }
+  if(unlink("..") == 0){
+    2e8a:	83 ec 0c             	sub    $0xc,%esp
+    2e8d:	68 2a 4f 00 00       	push   $0x4f2a
+    2e92:	e8 91 15 00 00       	call   4428 <unlink>
+    2e97:	83 c4 10             	add    $0x10,%esp
+    2e9a:	85 c0                	test   %eax,%eax
+    2e9c:	75 17                	jne    2eb5 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    2e9e:	83 ec 08             	sub    $0x8,%esp
+    2ea1:	68 6b 5d 00 00       	push   $0x5d6b
+    2ea6:	6a 01                	push   $0x1
+    2ea8:	e8 2f 17 00 00       	call   45dc <printf>
+    2ead:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2eb0:	e8 23 15 00 00       	call   43d8 <exit>
+  }
+  if(chdir("/") != 0){
+    2eb5:	83 ec 0c             	sub    $0xc,%esp
+    2eb8:	68 7e 4b 00 00       	push   $0x4b7e
+    2ebd:	e8 86 15 00 00       	call   4448 <chdir>
+    2ec2:	83 c4 10             	add    $0x10,%esp
+    2ec5:	85 c0                	test   %eax,%eax
+    2ec7:	74 17                	je     2ee0 <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    2ec9:	83 ec 08             	sub    $0x8,%esp
+    2ecc:	68 80 4b 00 00       	push   $0x4b80
+    2ed1:	6a 01                	push   $0x1
+    2ed3:	e8 04 17 00 00       	call   45dc <printf>
+    2ed8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2edb:	e8 f8 14 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    2ee0:	83 ec 0c             	sub    $0xc,%esp
+    2ee3:	68 7a 5d 00 00       	push   $0x5d7a
+    2ee8:	e8 3b 15 00 00       	call   4428 <unlink>
+    2eed:	83 c4 10             	add    $0x10,%esp
+    2ef0:	85 c0                	test   %eax,%eax
+    2ef2:	75 17                	jne    2f0b <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    2ef4:	83 ec 08             	sub    $0x8,%esp
+    2ef7:	68 81 5d 00 00       	push   $0x5d81
+    2efc:	6a 01                	push   $0x1
+    2efe:	e8 d9 16 00 00       	call   45dc <printf>
+    2f03:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f06:	e8 cd 14 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    2f0b:	83 ec 0c             	sub    $0xc,%esp
+    2f0e:	68 98 5d 00 00       	push   $0x5d98
+    2f13:	e8 10 15 00 00       	call   4428 <unlink>
+    2f18:	83 c4 10             	add    $0x10,%esp
+    2f1b:	85 c0                	test   %eax,%eax
+    2f1d:	75 17                	jne    2f36 <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    2f1f:	83 ec 08             	sub    $0x8,%esp
+    2f22:	68 a0 5d 00 00       	push   $0x5da0
+    2f27:	6a 01                	push   $0x1
+    2f29:	e8 ae 16 00 00       	call   45dc <printf>
+    2f2e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f31:	e8 a2 14 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dots") != 0){
+    2f36:	83 ec 0c             	sub    $0xc,%esp
+    2f39:	68 32 5d 00 00       	push   $0x5d32
+    2f3e:	e8 e5 14 00 00       	call   4428 <unlink>
+    2f43:	83 c4 10             	add    $0x10,%esp
+    2f46:	85 c0                	test   %eax,%eax
+    2f48:	74 17                	je     2f61 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    2f4a:	83 ec 08             	sub    $0x8,%esp
+    2f4d:	68 b8 5d 00 00       	push   $0x5db8
+    2f52:	6a 01                	push   $0x1
+    2f54:	e8 83 16 00 00       	call   45dc <printf>
+    2f59:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f5c:	e8 77 14 00 00       	call   43d8 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    2f61:	83 ec 08             	sub    $0x8,%esp
+    2f64:	68 cd 5d 00 00       	push   $0x5dcd
+    2f69:	6a 01                	push   $0x1
+    2f6b:	e8 6c 16 00 00       	call   45dc <printf>
+    2f70:	83 c4 10             	add    $0x10,%esp
+}
+    2f73:	90                   	nop
+    2f74:	c9                   	leave
+    2f75:	c3                   	ret
+
+00002f76 <dirfile>:
+
+void
+dirfile(void)
+{
+    2f76:	55                   	push   %ebp
+    2f77:	89 e5                	mov    %esp,%ebp
+    2f79:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    2f7c:	83 ec 08             	sub    $0x8,%esp
+    2f7f:	68 d7 5d 00 00       	push   $0x5dd7
+    2f84:	6a 01                	push   $0x1
+    2f86:	e8 51 16 00 00       	call   45dc <printf>
+    2f8b:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    2f8e:	83 ec 08             	sub    $0x8,%esp
+    2f91:	68 00 02 00 00       	push   $0x200
+    2f96:	68 e4 5d 00 00       	push   $0x5de4
+    2f9b:	e8 78 14 00 00       	call   4418 <open>
+    2fa0:	83 c4 10             	add    $0x10,%esp
+    2fa3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2fa6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2faa:	79 17                	jns    2fc3 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    2fac:	83 ec 08             	sub    $0x8,%esp
+    2faf:	68 ec 5d 00 00       	push   $0x5dec
+    2fb4:	6a 01                	push   $0x1
+    2fb6:	e8 21 16 00 00       	call   45dc <printf>
+    2fbb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2fbe:	e8 15 14 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    2fc3:	83 ec 0c             	sub    $0xc,%esp
+    2fc6:	ff 75 f4             	push   -0xc(%ebp)
+    2fc9:	e8 32 14 00 00       	call   4400 <close>
+    2fce:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    2fd1:	83 ec 0c             	sub    $0xc,%esp
+    2fd4:	68 e4 5d 00 00       	push   $0x5de4
+    2fd9:	e8 6a 14 00 00       	call   4448 <chdir>
+    2fde:	83 c4 10             	add    $0x10,%esp
+    2fe1:	85 c0                	test   %eax,%eax
+    2fe3:	75 17                	jne    2ffc <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    2fe5:	83 ec 08             	sub    $0x8,%esp
+    2fe8:	68 03 5e 00 00       	push   $0x5e03
+    2fed:	6a 01                	push   $0x1
+    2fef:	e8 e8 15 00 00       	call   45dc <printf>
+    2ff4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ff7:	e8 dc 13 00 00       	call   43d8 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    2ffc:	83 ec 08             	sub    $0x8,%esp
+    2fff:	6a 00                	push   $0x0
+    3001:	68 1d 5e 00 00       	push   $0x5e1d
+    3006:	e8 0d 14 00 00       	call   4418 <open>
+    300b:	83 c4 10             	add    $0x10,%esp
+    300e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3011:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3015:	78 17                	js     302e <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3017:	83 ec 08             	sub    $0x8,%esp
+    301a:	68 28 5e 00 00       	push   $0x5e28
+    301f:	6a 01                	push   $0x1
+    3021:	e8 b6 15 00 00       	call   45dc <printf>
+    3026:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3029:	e8 aa 13 00 00       	call   43d8 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    302e:	83 ec 08             	sub    $0x8,%esp
+    3031:	68 00 02 00 00       	push   $0x200
+    3036:	68 1d 5e 00 00       	push   $0x5e1d
+    303b:	e8 d8 13 00 00       	call   4418 <open>
+    3040:	83 c4 10             	add    $0x10,%esp
+    3043:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3046:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    304a:	78 17                	js     3063 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    304c:	83 ec 08             	sub    $0x8,%esp
+    304f:	68 28 5e 00 00       	push   $0x5e28
+    3054:	6a 01                	push   $0x1
+    3056:	e8 81 15 00 00       	call   45dc <printf>
+    305b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    305e:	e8 75 13 00 00       	call   43d8 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    3063:	83 ec 0c             	sub    $0xc,%esp
+    3066:	68 1d 5e 00 00       	push   $0x5e1d
+    306b:	e8 d0 13 00 00       	call   4440 <mkdir>
+    3070:	83 c4 10             	add    $0x10,%esp
+    3073:	85 c0                	test   %eax,%eax
+    3075:	75 17                	jne    308e <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3077:	83 ec 08             	sub    $0x8,%esp
+    307a:	68 46 5e 00 00       	push   $0x5e46
+    307f:	6a 01                	push   $0x1
+    3081:	e8 56 15 00 00       	call   45dc <printf>
+    3086:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3089:	e8 4a 13 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    308e:	83 ec 0c             	sub    $0xc,%esp
+    3091:	68 1d 5e 00 00       	push   $0x5e1d
+    3096:	e8 8d 13 00 00       	call   4428 <unlink>
+    309b:	83 c4 10             	add    $0x10,%esp
+    309e:	85 c0                	test   %eax,%eax
+    30a0:	75 17                	jne    30b9 <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    30a2:	83 ec 08             	sub    $0x8,%esp
+    30a5:	68 63 5e 00 00       	push   $0x5e63
+    30aa:	6a 01                	push   $0x1
+    30ac:	e8 2b 15 00 00       	call   45dc <printf>
+    30b1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30b4:	e8 1f 13 00 00       	call   43d8 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    30b9:	83 ec 08             	sub    $0x8,%esp
+    30bc:	68 1d 5e 00 00       	push   $0x5e1d
+    30c1:	68 81 5e 00 00       	push   $0x5e81
+    30c6:	e8 6d 13 00 00       	call   4438 <link>
+    30cb:	83 c4 10             	add    $0x10,%esp
+    30ce:	85 c0                	test   %eax,%eax
+    30d0:	75 17                	jne    30e9 <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    30d2:	83 ec 08             	sub    $0x8,%esp
+    30d5:	68 88 5e 00 00       	push   $0x5e88
+    30da:	6a 01                	push   $0x1
+    30dc:	e8 fb 14 00 00       	call   45dc <printf>
+    30e1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30e4:	e8 ef 12 00 00       	call   43d8 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    30e9:	83 ec 0c             	sub    $0xc,%esp
+    30ec:	68 e4 5d 00 00       	push   $0x5de4
+    30f1:	e8 32 13 00 00       	call   4428 <unlink>
+    30f6:	83 c4 10             	add    $0x10,%esp
+    30f9:	85 c0                	test   %eax,%eax
+    30fb:	74 17                	je     3114 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    30fd:	83 ec 08             	sub    $0x8,%esp
+    3100:	68 a7 5e 00 00       	push   $0x5ea7
+    3105:	6a 01                	push   $0x1
+    3107:	e8 d0 14 00 00       	call   45dc <printf>
+    310c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    310f:	e8 c4 12 00 00       	call   43d8 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    3114:	83 ec 08             	sub    $0x8,%esp
+    3117:	6a 02                	push   $0x2
+    3119:	68 63 54 00 00       	push   $0x5463
+    311e:	e8 f5 12 00 00       	call   4418 <open>
+    3123:	83 c4 10             	add    $0x10,%esp
+    3126:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3129:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    312d:	78 17                	js     3146 <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    312f:	83 ec 08             	sub    $0x8,%esp
+    3132:	68 c0 5e 00 00       	push   $0x5ec0
+    3137:	6a 01                	push   $0x1
+    3139:	e8 9e 14 00 00       	call   45dc <printf>
+    313e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3141:	e8 92 12 00 00       	call   43d8 <exit>
+  }
+  fd = open(".", 0);
+    3146:	83 ec 08             	sub    $0x8,%esp
+    3149:	6a 00                	push   $0x0
+    314b:	68 63 54 00 00       	push   $0x5463
+    3150:	e8 c3 12 00 00       	call   4418 <open>
+    3155:	83 c4 10             	add    $0x10,%esp
+    3158:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    315b:	83 ec 04             	sub    $0x4,%esp
+    315e:	6a 01                	push   $0x1
+    3160:	68 e3 4f 00 00       	push   $0x4fe3
+    3165:	ff 75 f4             	push   -0xc(%ebp)
+    3168:	e8 8b 12 00 00       	call   43f8 <write>
+    316d:	83 c4 10             	add    $0x10,%esp
+    3170:	85 c0                	test   %eax,%eax
+    3172:	7e 17                	jle    318b <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    3174:	83 ec 08             	sub    $0x8,%esp
+    3177:	68 df 5e 00 00       	push   $0x5edf
+    317c:	6a 01                	push   $0x1
+    317e:	e8 59 14 00 00       	call   45dc <printf>
+    3183:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3186:	e8 4d 12 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    318b:	83 ec 0c             	sub    $0xc,%esp
+    318e:	ff 75 f4             	push   -0xc(%ebp)
+    3191:	e8 6a 12 00 00       	call   4400 <close>
+    3196:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    3199:	83 ec 08             	sub    $0x8,%esp
+    319c:	68 f3 5e 00 00       	push   $0x5ef3
+    31a1:	6a 01                	push   $0x1
+    31a3:	e8 34 14 00 00       	call   45dc <printf>
+    31a8:	83 c4 10             	add    $0x10,%esp
+}
+    31ab:	90                   	nop
+    31ac:	c9                   	leave
+    31ad:	c3                   	ret
+
+000031ae <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    31ae:	55                   	push   %ebp
+    31af:	89 e5                	mov    %esp,%ebp
+    31b1:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    31b4:	83 ec 08             	sub    $0x8,%esp
+    31b7:	68 03 5f 00 00       	push   $0x5f03
+    31bc:	6a 01                	push   $0x1
+    31be:	e8 19 14 00 00       	call   45dc <printf>
+    31c3:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    31c6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    31cd:	e9 e7 00 00 00       	jmp    32b9 <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    31d2:	83 ec 0c             	sub    $0xc,%esp
+    31d5:	68 14 5f 00 00       	push   $0x5f14
+    31da:	e8 61 12 00 00       	call   4440 <mkdir>
+    31df:	83 c4 10             	add    $0x10,%esp
+    31e2:	85 c0                	test   %eax,%eax
+    31e4:	74 17                	je     31fd <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    31e6:	83 ec 08             	sub    $0x8,%esp
+    31e9:	68 1a 5f 00 00       	push   $0x5f1a
+    31ee:	6a 01                	push   $0x1
+    31f0:	e8 e7 13 00 00       	call   45dc <printf>
+    31f5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    31f8:	e8 db 11 00 00       	call   43d8 <exit>
+    }
+    if(chdir("irefd") != 0){
+    31fd:	83 ec 0c             	sub    $0xc,%esp
+    3200:	68 14 5f 00 00       	push   $0x5f14
+    3205:	e8 3e 12 00 00       	call   4448 <chdir>
+    320a:	83 c4 10             	add    $0x10,%esp
+    320d:	85 c0                	test   %eax,%eax
+    320f:	74 17                	je     3228 <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    3211:	83 ec 08             	sub    $0x8,%esp
+    3214:	68 2e 5f 00 00       	push   $0x5f2e
+    3219:	6a 01                	push   $0x1
+    321b:	e8 bc 13 00 00       	call   45dc <printf>
+    3220:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3223:	e8 b0 11 00 00       	call   43d8 <exit>
+    }
+
+    mkdir("");
+    3228:	83 ec 0c             	sub    $0xc,%esp
+    322b:	68 42 5f 00 00       	push   $0x5f42
+    3230:	e8 0b 12 00 00       	call   4440 <mkdir>
+    3235:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    3238:	83 ec 08             	sub    $0x8,%esp
+    323b:	68 42 5f 00 00       	push   $0x5f42
+    3240:	68 81 5e 00 00       	push   $0x5e81
+    3245:	e8 ee 11 00 00       	call   4438 <link>
+    324a:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    324d:	83 ec 08             	sub    $0x8,%esp
+    3250:	68 00 02 00 00       	push   $0x200
+    3255:	68 42 5f 00 00       	push   $0x5f42
+    325a:	e8 b9 11 00 00       	call   4418 <open>
+    325f:	83 c4 10             	add    $0x10,%esp
+    3262:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3265:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3269:	78 0e                	js     3279 <iref+0xcb>
+      close(fd);
+    326b:	83 ec 0c             	sub    $0xc,%esp
+    326e:	ff 75 f0             	push   -0x10(%ebp)
+    3271:	e8 8a 11 00 00       	call   4400 <close>
+    3276:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3279:	83 ec 08             	sub    $0x8,%esp
+    327c:	68 00 02 00 00       	push   $0x200
+    3281:	68 43 5f 00 00       	push   $0x5f43
+    3286:	e8 8d 11 00 00       	call   4418 <open>
+    328b:	83 c4 10             	add    $0x10,%esp
+    328e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3291:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3295:	78 0e                	js     32a5 <iref+0xf7>
+      close(fd);
+    3297:	83 ec 0c             	sub    $0xc,%esp
+    329a:	ff 75 f0             	push   -0x10(%ebp)
+    329d:	e8 5e 11 00 00       	call   4400 <close>
+    32a2:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    32a5:	83 ec 0c             	sub    $0xc,%esp
+    32a8:	68 43 5f 00 00       	push   $0x5f43
+    32ad:	e8 76 11 00 00       	call   4428 <unlink>
+    32b2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    32b5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    32b9:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    32bd:	0f 8e 0f ff ff ff    	jle    31d2 <iref+0x24>
+  }
+
+  chdir("/");
+    32c3:	83 ec 0c             	sub    $0xc,%esp
+    32c6:	68 7e 4b 00 00       	push   $0x4b7e
+    32cb:	e8 78 11 00 00       	call   4448 <chdir>
+    32d0:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    32d3:	83 ec 08             	sub    $0x8,%esp
+    32d6:	68 46 5f 00 00       	push   $0x5f46
+    32db:	6a 01                	push   $0x1
+    32dd:	e8 fa 12 00 00       	call   45dc <printf>
+    32e2:	83 c4 10             	add    $0x10,%esp
+}
+    32e5:	90                   	nop
+    32e6:	c9                   	leave
+    32e7:	c3                   	ret
+
+000032e8 <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this.  there is no limit on
+// the number of processes, so fork fails when memory runs out.
+void
+forktest(void)
+{
+    32e8:	55                   	push   %ebp
+    32e9:	89 e5                	mov    %esp,%ebp
+    32eb:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    32ee:	83 ec 08             	sub    $0x8,%esp
+    32f1:	68 5a 5f 00 00       	push   $0x5f5a
+    32f6:	6a 01                	push   $0x1
+    32f8:	e8 df 12 00 00       	call   45dc <printf>
+    32fd:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<100000; n++){
+    3300:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3307:	eb 1d                	jmp    3326 <forktest+0x3e>
+    pid = fork();
+    3309:	e8 c2 10 00 00       	call   43d0 <fork>
+    330e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    3311:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3315:	78 1a                	js     3331 <forktest+0x49>
+      break;
+    if(pid == 0)
+    3317:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    331b:	75 05                	jne    3322 <forktest+0x3a>
+      exit();
+    331d:	e8 b6 10 00 00       	call   43d8 <exit>
+  for(n=0; n<100000; n++){
+    3322:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3326:	81 7d f4 9f 86 01 00 	cmpl   $0x1869f,-0xc(%ebp)
+    332d:	7e da                	jle    3309 <forktest+0x21>
+    332f:	eb 01                	jmp    3332 <forktest+0x4a>
+      break;
+    3331:	90                   	nop
+  }
+  
+  if(n == 100000){
+    3332:	81 7d f4 a0 86 01 00 	cmpl   $0x186a0,-0xc(%ebp)
+    3339:	75 3b                	jne    3376 <forktest+0x8e>
+    printf(1, "fork claimed to work 100000 times!\n");
+    333b:	83 ec 08             	sub    $0x8,%esp
+    333e:	68 68 5f 00 00       	push   $0x5f68
+    3343:	6a 01                	push   $0x1
+    3345:	e8 92 12 00 00       	call   45dc <printf>
+    334a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    334d:	e8 86 10 00 00       	call   43d8 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    3352:	e8 89 10 00 00       	call   43e0 <wait>
+    3357:	85 c0                	test   %eax,%eax
+    3359:	79 17                	jns    3372 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    335b:	83 ec 08             	sub    $0x8,%esp
+    335e:	68 8c 5f 00 00       	push   $0x5f8c
+    3363:	6a 01                	push   $0x1
+    3365:	e8 72 12 00 00       	call   45dc <printf>
+    336a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    336d:	e8 66 10 00 00       	call   43d8 <exit>
+  for(; n > 0; n--){
+    3372:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    3376:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    337a:	7f d6                	jg     3352 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    337c:	e8 5f 10 00 00       	call   43e0 <wait>
+    3381:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3384:	74 17                	je     339d <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    3386:	83 ec 08             	sub    $0x8,%esp
+    3389:	68 a0 5f 00 00       	push   $0x5fa0
+    338e:	6a 01                	push   $0x1
+    3390:	e8 47 12 00 00       	call   45dc <printf>
+    3395:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3398:	e8 3b 10 00 00       	call   43d8 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    339d:	83 ec 08             	sub    $0x8,%esp
+    33a0:	68 b3 5f 00 00       	push   $0x5fb3
+    33a5:	6a 01                	push   $0x1
+    33a7:	e8 30 12 00 00       	call   45dc <printf>
+    33ac:	83 c4 10             	add    $0x10,%esp
+}
+    33af:	90                   	nop
+    33b0:	c9                   	leave
+    33b1:	c3                   	ret
+
+000033b2 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    33b2:	55                   	push   %ebp
+    33b3:	89 e5                	mov    %esp,%ebp
+    33b5:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    33b8:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    33bd:	83 ec 08             	sub    $0x8,%esp
+    33c0:	68 c1 5f 00 00       	push   $0x5fc1
+    33c5:	50                   	push   %eax
+    33c6:	e8 11 12 00 00       	call   45dc <printf>
+    33cb:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    33ce:	83 ec 0c             	sub    $0xc,%esp
+    33d1:	6a 00                	push   $0x0
+    33d3:	e8 88 10 00 00       	call   4460 <sbrk>
+    33d8:	83 c4 10             	add    $0x10,%esp
+    33db:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    33de:	83 ec 0c             	sub    $0xc,%esp
+    33e1:	6a 00                	push   $0x0
+    33e3:	e8 78 10 00 00       	call   4460 <sbrk>
+    33e8:	83 c4 10             	add    $0x10,%esp
+    33eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    33ee:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    33f5:	eb 4f                	jmp    3446 <sbrktest+0x94>
+    b = sbrk(1);
+    33f7:	83 ec 0c             	sub    $0xc,%esp
+    33fa:	6a 01                	push   $0x1
+    33fc:	e8 5f 10 00 00       	call   4460 <sbrk>
+    3401:	83 c4 10             	add    $0x10,%esp
+    3404:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    3407:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    340a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    340d:	74 24                	je     3433 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    340f:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3414:	83 ec 0c             	sub    $0xc,%esp
+    3417:	ff 75 d0             	push   -0x30(%ebp)
+    341a:	ff 75 f4             	push   -0xc(%ebp)
+    341d:	ff 75 f0             	push   -0x10(%ebp)
+    3420:	68 cc 5f 00 00       	push   $0x5fcc
+    3425:	50                   	push   %eax
+    3426:	e8 b1 11 00 00       	call   45dc <printf>
+    342b:	83 c4 20             	add    $0x20,%esp
+      exit();
+    342e:	e8 a5 0f 00 00       	call   43d8 <exit>
+    }
+    *b = 1;
+    3433:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3436:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    3439:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    343c:	83 c0 01             	add    $0x1,%eax
+    343f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    3442:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3446:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    344d:	7e a8                	jle    33f7 <sbrktest+0x45>
+  }
+  pid = fork();
+    344f:	e8 7c 0f 00 00       	call   43d0 <fork>
+    3454:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    3457:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    345b:	79 1b                	jns    3478 <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    345d:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3462:	83 ec 08             	sub    $0x8,%esp
+    3465:	68 e7 5f 00 00       	push   $0x5fe7
+    346a:	50                   	push   %eax
+    346b:	e8 6c 11 00 00       	call   45dc <printf>
+    3470:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3473:	e8 60 0f 00 00       	call   43d8 <exit>
+  }
+  c = sbrk(1);
+    3478:	83 ec 0c             	sub    $0xc,%esp
+    347b:	6a 01                	push   $0x1
+    347d:	e8 de 0f 00 00       	call   4460 <sbrk>
+    3482:	83 c4 10             	add    $0x10,%esp
+    3485:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    3488:	83 ec 0c             	sub    $0xc,%esp
+    348b:	6a 01                	push   $0x1
+    348d:	e8 ce 0f 00 00       	call   4460 <sbrk>
+    3492:	83 c4 10             	add    $0x10,%esp
+    3495:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    3498:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    349b:	83 c0 01             	add    $0x1,%eax
+    349e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    34a1:	74 1b                	je     34be <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    34a3:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    34a8:	83 ec 08             	sub    $0x8,%esp
+    34ab:	68 fe 5f 00 00       	push   $0x5ffe
+    34b0:	50                   	push   %eax
+    34b1:	e8 26 11 00 00       	call   45dc <printf>
+    34b6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34b9:	e8 1a 0f 00 00       	call   43d8 <exit>
+  }
+  if(pid == 0)
+    34be:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    34c2:	75 05                	jne    34c9 <sbrktest+0x117>
+    exit();
+    34c4:	e8 0f 0f 00 00       	call   43d8 <exit>
+  wait();
+    34c9:	e8 12 0f 00 00       	call   43e0 <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    34ce:	83 ec 0c             	sub    $0xc,%esp
+    34d1:	6a 00                	push   $0x0
+    34d3:	e8 88 0f 00 00       	call   4460 <sbrk>
+    34d8:	83 c4 10             	add    $0x10,%esp
+    34db:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    34de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    34e1:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    34e6:	29 c2                	sub    %eax,%edx
+    34e8:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    34eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    34ee:	83 ec 0c             	sub    $0xc,%esp
+    34f1:	50                   	push   %eax
+    34f2:	e8 69 0f 00 00       	call   4460 <sbrk>
+    34f7:	83 c4 10             	add    $0x10,%esp
+    34fa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    34fd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3500:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3503:	74 1b                	je     3520 <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3505:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    350a:	83 ec 08             	sub    $0x8,%esp
+    350d:	68 1c 60 00 00       	push   $0x601c
+    3512:	50                   	push   %eax
+    3513:	e8 c4 10 00 00       	call   45dc <printf>
+    3518:	83 c4 10             	add    $0x10,%esp
+    exit();
+    351b:	e8 b8 0e 00 00       	call   43d8 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    3520:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    3527:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    352a:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    352d:	83 ec 0c             	sub    $0xc,%esp
+    3530:	6a 00                	push   $0x0
+    3532:	e8 29 0f 00 00       	call   4460 <sbrk>
+    3537:	83 c4 10             	add    $0x10,%esp
+    353a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    353d:	83 ec 0c             	sub    $0xc,%esp
+    3540:	68 00 f0 ff ff       	push   $0xfffff000
+    3545:	e8 16 0f 00 00       	call   4460 <sbrk>
+    354a:	83 c4 10             	add    $0x10,%esp
+    354d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    3550:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3554:	75 1b                	jne    3571 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    3556:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    355b:	83 ec 08             	sub    $0x8,%esp
+    355e:	68 5a 60 00 00       	push   $0x605a
+    3563:	50                   	push   %eax
+    3564:	e8 73 10 00 00       	call   45dc <printf>
+    3569:	83 c4 10             	add    $0x10,%esp
+    exit();
+    356c:	e8 67 0e 00 00       	call   43d8 <exit>
+  }
+  c = sbrk(0);
+    3571:	83 ec 0c             	sub    $0xc,%esp
+    3574:	6a 00                	push   $0x0
+    3576:	e8 e5 0e 00 00       	call   4460 <sbrk>
+    357b:	83 c4 10             	add    $0x10,%esp
+    357e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    3581:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3584:	2d 00 10 00 00       	sub    $0x1000,%eax
+    3589:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    358c:	74 1e                	je     35ac <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    358e:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3593:	ff 75 e4             	push   -0x1c(%ebp)
+    3596:	ff 75 f4             	push   -0xc(%ebp)
+    3599:	68 78 60 00 00       	push   $0x6078
+    359e:	50                   	push   %eax
+    359f:	e8 38 10 00 00       	call   45dc <printf>
+    35a4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35a7:	e8 2c 0e 00 00       	call   43d8 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    35ac:	83 ec 0c             	sub    $0xc,%esp
+    35af:	6a 00                	push   $0x0
+    35b1:	e8 aa 0e 00 00       	call   4460 <sbrk>
+    35b6:	83 c4 10             	add    $0x10,%esp
+    35b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    35bc:	83 ec 0c             	sub    $0xc,%esp
+    35bf:	68 00 10 00 00       	push   $0x1000
+    35c4:	e8 97 0e 00 00       	call   4460 <sbrk>
+    35c9:	83 c4 10             	add    $0x10,%esp
+    35cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    35cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    35d2:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    35d5:	75 1a                	jne    35f1 <sbrktest+0x23f>
+    35d7:	83 ec 0c             	sub    $0xc,%esp
+    35da:	6a 00                	push   $0x0
+    35dc:	e8 7f 0e 00 00       	call   4460 <sbrk>
+    35e1:	83 c4 10             	add    $0x10,%esp
+    35e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    35e7:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    35ed:	39 d0                	cmp    %edx,%eax
+    35ef:	74 1e                	je     360f <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    35f1:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    35f6:	ff 75 e4             	push   -0x1c(%ebp)
+    35f9:	ff 75 f4             	push   -0xc(%ebp)
+    35fc:	68 b0 60 00 00       	push   $0x60b0
+    3601:	50                   	push   %eax
+    3602:	e8 d5 0f 00 00       	call   45dc <printf>
+    3607:	83 c4 10             	add    $0x10,%esp
+    exit();
+    360a:	e8 c9 0d 00 00       	call   43d8 <exit>
+  }
+  if(*lastaddr == 99){
+    360f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3612:	0f b6 00             	movzbl (%eax),%eax
+    3615:	3c 63                	cmp    $0x63,%al
+    3617:	75 1b                	jne    3634 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3619:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    361e:	83 ec 08             	sub    $0x8,%esp
+    3621:	68 d8 60 00 00       	push   $0x60d8
+    3626:	50                   	push   %eax
+    3627:	e8 b0 0f 00 00       	call   45dc <printf>
+    362c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    362f:	e8 a4 0d 00 00       	call   43d8 <exit>
+  }
+
+  a = sbrk(0);
+    3634:	83 ec 0c             	sub    $0xc,%esp
+    3637:	6a 00                	push   $0x0
+    3639:	e8 22 0e 00 00       	call   4460 <sbrk>
+    363e:	83 c4 10             	add    $0x10,%esp
+    3641:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3644:	83 ec 0c             	sub    $0xc,%esp
+    3647:	6a 00                	push   $0x0
+    3649:	e8 12 0e 00 00       	call   4460 <sbrk>
+    364e:	83 c4 10             	add    $0x10,%esp
+    3651:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3654:	29 c2                	sub    %eax,%edx
+    3656:	83 ec 0c             	sub    $0xc,%esp
+    3659:	52                   	push   %edx
+    365a:	e8 01 0e 00 00       	call   4460 <sbrk>
+    365f:	83 c4 10             	add    $0x10,%esp
+    3662:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    3665:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3668:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    366b:	74 1e                	je     368b <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    366d:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3672:	ff 75 e4             	push   -0x1c(%ebp)
+    3675:	ff 75 f4             	push   -0xc(%ebp)
+    3678:	68 08 61 00 00       	push   $0x6108
+    367d:	50                   	push   %eax
+    367e:	e8 59 0f 00 00       	call   45dc <printf>
+    3683:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3686:	e8 4d 0d 00 00       	call   43d8 <exit>
+  }
+  
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    368b:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    3692:	eb 76                	jmp    370a <sbrktest+0x358>
+    ppid = getpid();
+    3694:	e8 bf 0d 00 00       	call   4458 <getpid>
+    3699:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    369c:	e8 2f 0d 00 00       	call   43d0 <fork>
+    36a1:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    36a4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    36a8:	79 1b                	jns    36c5 <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    36aa:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    36af:	83 ec 08             	sub    $0x8,%esp
+    36b2:	68 ad 4b 00 00       	push   $0x4bad
+    36b7:	50                   	push   %eax
+    36b8:	e8 1f 0f 00 00       	call   45dc <printf>
+    36bd:	83 c4 10             	add    $0x10,%esp
+      exit();
+    36c0:	e8 13 0d 00 00       	call   43d8 <exit>
+    }
+    if(pid == 0){
+    36c5:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    36c9:	75 33                	jne    36fe <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    36cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    36ce:	0f b6 00             	movzbl (%eax),%eax
+    36d1:	0f be d0             	movsbl %al,%edx
+    36d4:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    36d9:	52                   	push   %edx
+    36da:	ff 75 f4             	push   -0xc(%ebp)
+    36dd:	68 29 61 00 00       	push   $0x6129
+    36e2:	50                   	push   %eax
+    36e3:	e8 f4 0e 00 00       	call   45dc <printf>
+    36e8:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    36eb:	83 ec 0c             	sub    $0xc,%esp
+    36ee:	ff 75 d4             	push   -0x2c(%ebp)
+    36f1:	e8 12 0d 00 00       	call   4408 <kill>
+    36f6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    36f9:	e8 da 0c 00 00       	call   43d8 <exit>
+    }
+    wait();
+    36fe:	e8 dd 0c 00 00       	call   43e0 <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3703:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    370a:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    3711:	76 81                	jbe    3694 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    3713:	83 ec 0c             	sub    $0xc,%esp
+    3716:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    3719:	50                   	push   %eax
+    371a:	e8 c9 0c 00 00       	call   43e8 <pipe>
+    371f:	83 c4 10             	add    $0x10,%esp
+    3722:	85 c0                	test   %eax,%eax
+    3724:	74 17                	je     373d <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    3726:	83 ec 08             	sub    $0x8,%esp
+    3729:	68 7e 4f 00 00       	push   $0x4f7e
+    372e:	6a 01                	push   $0x1
+    3730:	e8 a7 0e 00 00       	call   45dc <printf>
+    3735:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3738:	e8 9b 0c 00 00       	call   43d8 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    373d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3744:	e9 86 00 00 00       	jmp    37cf <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    3749:	e8 82 0c 00 00       	call   43d0 <fork>
+    374e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    3751:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    3755:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3758:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    375c:	85 c0                	test   %eax,%eax
+    375e:	75 4a                	jne    37aa <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    3760:	83 ec 0c             	sub    $0xc,%esp
+    3763:	6a 00                	push   $0x0
+    3765:	e8 f6 0c 00 00       	call   4460 <sbrk>
+    376a:	83 c4 10             	add    $0x10,%esp
+    376d:	89 c2                	mov    %eax,%edx
+    376f:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3774:	29 d0                	sub    %edx,%eax
+    3776:	83 ec 0c             	sub    $0xc,%esp
+    3779:	50                   	push   %eax
+    377a:	e8 e1 0c 00 00       	call   4460 <sbrk>
+    377f:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    3782:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    3785:	83 ec 04             	sub    $0x4,%esp
+    3788:	6a 01                	push   $0x1
+    378a:	68 e3 4f 00 00       	push   $0x4fe3
+    378f:	50                   	push   %eax
+    3790:	e8 63 0c 00 00       	call   43f8 <write>
+    3795:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    3798:	83 ec 0c             	sub    $0xc,%esp
+    379b:	68 e8 03 00 00       	push   $0x3e8
+    37a0:	e8 c3 0c 00 00       	call   4468 <sleep>
+    37a5:	83 c4 10             	add    $0x10,%esp
+    37a8:	eb ee                	jmp    3798 <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    37aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    37ad:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    37b1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    37b4:	74 15                	je     37cb <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    37b6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    37b9:	83 ec 04             	sub    $0x4,%esp
+    37bc:	6a 01                	push   $0x1
+    37be:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    37c1:	52                   	push   %edx
+    37c2:	50                   	push   %eax
+    37c3:	e8 28 0c 00 00       	call   43f0 <read>
+    37c8:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    37cb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    37cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    37d2:	83 f8 09             	cmp    $0x9,%eax
+    37d5:	0f 86 6e ff ff ff    	jbe    3749 <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    37db:	83 ec 0c             	sub    $0xc,%esp
+    37de:	68 00 10 00 00       	push   $0x1000
+    37e3:	e8 78 0c 00 00       	call   4460 <sbrk>
+    37e8:	83 c4 10             	add    $0x10,%esp
+    37eb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    37ee:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    37f5:	eb 2b                	jmp    3822 <sbrktest+0x470>
+    if(pids[i] == -1)
+    37f7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    37fa:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    37fe:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3801:	74 1a                	je     381d <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    3803:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3806:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    380a:	83 ec 0c             	sub    $0xc,%esp
+    380d:	50                   	push   %eax
+    380e:	e8 f5 0b 00 00       	call   4408 <kill>
+    3813:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3816:	e8 c5 0b 00 00       	call   43e0 <wait>
+    381b:	eb 01                	jmp    381e <sbrktest+0x46c>
+      continue;
+    381d:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    381e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3822:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3825:	83 f8 09             	cmp    $0x9,%eax
+    3828:	76 cd                	jbe    37f7 <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    382a:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    382e:	75 1b                	jne    384b <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3830:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3835:	83 ec 08             	sub    $0x8,%esp
+    3838:	68 42 61 00 00       	push   $0x6142
+    383d:	50                   	push   %eax
+    383e:	e8 99 0d 00 00       	call   45dc <printf>
+    3843:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3846:	e8 8d 0b 00 00       	call   43d8 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    384b:	83 ec 0c             	sub    $0xc,%esp
+    384e:	6a 00                	push   $0x0
+    3850:	e8 0b 0c 00 00       	call   4460 <sbrk>
+    3855:	83 c4 10             	add    $0x10,%esp
+    3858:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    385b:	73 1e                	jae    387b <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    385d:	83 ec 0c             	sub    $0xc,%esp
+    3860:	6a 00                	push   $0x0
+    3862:	e8 f9 0b 00 00       	call   4460 <sbrk>
+    3867:	83 c4 10             	add    $0x10,%esp
+    386a:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    386d:	29 c2                	sub    %eax,%edx
+    386f:	83 ec 0c             	sub    $0xc,%esp
+    3872:	52                   	push   %edx
+    3873:	e8 e8 0b 00 00       	call   4460 <sbrk>
+    3878:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    387b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3880:	83 ec 08             	sub    $0x8,%esp
+    3883:	68 5d 61 00 00       	push   $0x615d
+    3888:	50                   	push   %eax
+    3889:	e8 4e 0d 00 00       	call   45dc <printf>
+    388e:	83 c4 10             	add    $0x10,%esp
+}
+    3891:	90                   	nop
+    3892:	c9                   	leave
+    3893:	c3                   	ret
+
+00003894 <validateint>:
+
+void
+validateint(int *p)
+{
+    3894:	55                   	push   %ebp
+    3895:	89 e5                	mov    %esp,%ebp
+    3897:	53                   	push   %ebx
+    3898:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    389b:	b8 0d 00 00 00       	mov    $0xd,%eax
+    38a0:	8b 55 08             	mov    0x8(%ebp),%edx
+    38a3:	89 d1                	mov    %edx,%ecx
+    38a5:	89 e3                	mov    %esp,%ebx
+    38a7:	89 cc                	mov    %ecx,%esp
+    38a9:	cd 40                	int    $0x40
+    38ab:	89 dc                	mov    %ebx,%esp
+    38ad:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    38b0:	90                   	nop
+    38b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38b4:	c9                   	leave
+    38b5:	c3                   	ret
+
+000038b6 <sleeptest>:
+
+// do timed sleeps last about as long as asked, and can
+// many sleepers with different deadlines share the timer?
+void
+sleeptest(void)
+{
+    38b6:	55                   	push   %ebp
+    38b7:	89 e5                	mov    %esp,%ebp
+    38b9:	83 ec 18             	sub    $0x18,%esp
+  int i, pid, t0, t;
+
+  printf(stdout, "sleep test\n");
+    38bc:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    38c1:	83 ec 08             	sub    $0x8,%esp
+    38c4:	68 6b 61 00 00       	push   $0x616b
+    38c9:	50                   	push   %eax
+    38ca:	e8 0d 0d 00 00       	call   45dc <printf>
+    38cf:	83 c4 10             	add    $0x10,%esp
+
+  t0 = uptime();
+    38d2:	e8 99 0b 00 00       	call   4470 <uptime>
+    38d7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  sleep(5);
+    38da:	83 ec 0c             	sub    $0xc,%esp
+    38dd:	6a 05                	push   $0x5
+    38df:	e8 84 0b 00 00       	call   4468 <sleep>
+    38e4:	83 c4 10             	add    $0x10,%esp
+  if((t = uptime() - t0) < 4){
+    38e7:	e8 84 0b 00 00       	call   4470 <uptime>
+    38ec:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    38ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    38f2:	83 7d ec 03          	cmpl   $0x3,-0x14(%ebp)
+    38f6:	7f 1e                	jg     3916 <sleeptest+0x60>
+    printf(stdout, "sleep(5) took %d ticks\n", t);
+    38f8:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    38fd:	83 ec 04             	sub    $0x4,%esp
+    3900:	ff 75 ec             	push   -0x14(%ebp)
+    3903:	68 77 61 00 00       	push   $0x6177
+    3908:	50                   	push   %eax
+    3909:	e8 ce 0c 00 00       	call   45dc <printf>
+    390e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3911:	e8 c2 0a 00 00       	call   43d8 <exit>
+  }
+
+  // 30ms is 3 ticks at 100Hz.
+  t0 = uptime();
+    3916:	e8 55 0b 00 00       	call   4470 <uptime>
+    391b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(nanosleep(0, 30000000) < 0){
+    391e:	83 ec 08             	sub    $0x8,%esp
+    3921:	68 80 c3 c9 01       	push   $0x1c9c380
+    3926:	6a 00                	push   $0x0
+    3928:	e8 73 0b 00 00       	call   44a0 <nanosleep>
+    392d:	83 c4 10             	add    $0x10,%esp
+    3930:	85 c0                	test   %eax,%eax
+    3932:	79 1b                	jns    394f <sleeptest+0x99>
+    printf(stdout, "nanosleep failed\n");
+    3934:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3939:	83 ec 08             	sub    $0x8,%esp
+    393c:	68 8f 61 00 00       	push   $0x618f
+    3941:	50                   	push   %eax
+    3942:	e8 95 0c 00 00       	call   45dc <printf>
+    3947:	83 c4 10             	add    $0x10,%esp
+    exit();
+    394a:	e8 89 0a 00 00       	call   43d8 <exit>
+  }
+  if((t = uptime() - t0) < 2){
+    394f:	e8 1c 0b 00 00       	call   4470 <uptime>
+    3954:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    3957:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    395a:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    395e:	7f 1e                	jg     397e <sleeptest+0xc8>
+    printf(stdout, "nanosleep 30ms took %d ticks\n", t);
+    3960:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3965:	83 ec 04             	sub    $0x4,%esp
+    3968:	ff 75 ec             	push   -0x14(%ebp)
+    396b:	68 a1 61 00 00       	push   $0x61a1
+    3970:	50                   	push   %eax
+    3971:	e8 66 0c 00 00       	call   45dc <printf>
+    3976:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3979:	e8 5a 0a 00 00       	call   43d8 <exit>
+  }
+  if(nanosleep(0, 1000000000) != -1 || nanosleep(-1, 0) != -1){
+    397e:	83 ec 08             	sub    $0x8,%esp
+    3981:	68 00 ca 9a 3b       	push   $0x3b9aca00
+    3986:	6a 00                	push   $0x0
+    3988:	e8 13 0b 00 00       	call   44a0 <nanosleep>
+    398d:	83 c4 10             	add    $0x10,%esp
+    3990:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3993:	75 14                	jne    39a9 <sleeptest+0xf3>
+    3995:	83 ec 08             	sub    $0x8,%esp
+    3998:	6a 00                	push   $0x0
+    399a:	6a ff                	push   $0xffffffff
+    399c:	e8 ff 0a 00 00       	call   44a0 <nanosleep>
+    39a1:	83 c4 10             	add    $0x10,%esp
+    39a4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    39a7:	74 1b                	je     39c4 <sleeptest+0x10e>
+    printf(stdout, "nanosleep accepted a bad time\n");
+    39a9:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    39ae:	83 ec 08             	sub    $0x8,%esp
+    39b1:	68 c0 61 00 00       	push   $0x61c0
+    39b6:	50                   	push   %eax
+    39b7:	e8 20 0c 00 00       	call   45dc <printf>
+    39bc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39bf:	e8 14 0a 00 00       	call   43d8 <exit>
+  }
+
+  t0 = uptime();
+    39c4:	e8 a7 0a 00 00       	call   4470 <uptime>
+    39c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 10; i++){
+    39cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    39d3:	eb 52                	jmp    3a27 <sleeptest+0x171>
+    pid = fork();
+    39d5:	e8 f6 09 00 00       	call   43d0 <fork>
+    39da:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    39dd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    39e1:	79 1b                	jns    39fe <sleeptest+0x148>
+      printf(stdout, "fork failed\n");
+    39e3:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    39e8:	83 ec 08             	sub    $0x8,%esp
+    39eb:	68 ad 4b 00 00       	push   $0x4bad
+    39f0:	50                   	push   %eax
+    39f1:	e8 e6 0b 00 00       	call   45dc <printf>
+    39f6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    39f9:	e8 da 09 00 00       	call   43d8 <exit>
+    }
+    if(pid == 0){
+    39fe:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3a02:	75 1f                	jne    3a23 <sleeptest+0x16d>
+      nanosleep(0, (i+1) * 3000000);
+    3a04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3a07:	83 c0 01             	add    $0x1,%eax
+    3a0a:	69 c0 c0 c6 2d 00    	imul   $0x2dc6c0,%eax,%eax
+    3a10:	83 ec 08             	sub    $0x8,%esp
+    3a13:	50                   	push   %eax
+    3a14:	6a 00                	push   $0x0
+    3a16:	e8 85 0a 00 00       	call   44a0 <nanosleep>
+    3a1b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3a1e:	e8 b5 09 00 00       	call   43d8 <exit>
+  for(i = 0; i < 10; i++){
+    3a23:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3a27:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    3a2b:	7e a8                	jle    39d5 <sleeptest+0x11f>
+    }
+  }
+  for(i = 0; i < 10; i++)
+    3a2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3a34:	eb 09                	jmp    3a3f <sleeptest+0x189>
+    wait();
+    3a36:	e8 a5 09 00 00       	call   43e0 <wait>
+  for(i = 0; i < 10; i++)
+    3a3b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3a3f:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    3a43:	7e f1                	jle    3a36 <sleeptest+0x180>
+  if((t = uptime() - t0) > 100){
+    3a45:	e8 26 0a 00 00       	call   4470 <uptime>
+    3a4a:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    3a4d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    3a50:	83 7d ec 64          	cmpl   $0x64,-0x14(%ebp)
+    3a54:	7e 1e                	jle    3a74 <sleeptest+0x1be>
+    printf(stdout, "sleepers took %d ticks\n", t);
+    3a56:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3a5b:	83 ec 04             	sub    $0x4,%esp
+    3a5e:	ff 75 ec             	push   -0x14(%ebp)
+    3a61:	68 df 61 00 00       	push   $0x61df
+    3a66:	50                   	push   %eax
+    3a67:	e8 70 0b 00 00       	call   45dc <printf>
+    3a6c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a6f:	e8 64 09 00 00       	call   43d8 <exit>
+  }
+
+  // a killed sleeper must not wait for its deadline
+  pid = fork();
+    3a74:	e8 57 09 00 00       	call   43d0 <fork>
+    3a79:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid == 0){
+    3a7c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3a80:	75 15                	jne    3a97 <sleeptest+0x1e1>
+    sleep(100000);
+    3a82:	83 ec 0c             	sub    $0xc,%esp
+    3a85:	68 a0 86 01 00       	push   $0x186a0
+    3a8a:	e8 d9 09 00 00       	call   4468 <sleep>
+    3a8f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a92:	e8 41 09 00 00       	call   43d8 <exit>
+  }
+  sleep(1);
+    3a97:	83 ec 0c             	sub    $0xc,%esp
+    3a9a:	6a 01                	push   $0x1
+    3a9c:	e8 c7 09 00 00       	call   4468 <sleep>
+    3aa1:	83 c4 10             	add    $0x10,%esp
+  kill(pid);
+    3aa4:	83 ec 0c             	sub    $0xc,%esp
+    3aa7:	ff 75 e8             	push   -0x18(%ebp)
+    3aaa:	e8 59 09 00 00       	call   4408 <kill>
+    3aaf:	83 c4 10             	add    $0x10,%esp
+  wait();
+    3ab2:	e8 29 09 00 00       	call   43e0 <wait>
+
+  printf(stdout, "sleep test ok\n");
+    3ab7:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3abc:	83 ec 08             	sub    $0x8,%esp
+    3abf:	68 f7 61 00 00       	push   $0x61f7
+    3ac4:	50                   	push   %eax
+    3ac5:	e8 12 0b 00 00       	call   45dc <printf>
+    3aca:	83 c4 10             	add    $0x10,%esp
+}
+    3acd:	90                   	nop
+    3ace:	c9                   	leave
+    3acf:	c3                   	ret
+
+00003ad0 <validatetest>:
+
+void
+validatetest(void)
+{
+    3ad0:	55                   	push   %ebp
+    3ad1:	89 e5                	mov    %esp,%ebp
+    3ad3:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    3ad6:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3adb:	83 ec 08             	sub    $0x8,%esp
+    3ade:	68 06 62 00 00       	push   $0x6206
+    3ae3:	50                   	push   %eax
+    3ae4:	e8 f3 0a 00 00       	call   45dc <printf>
+    3ae9:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    3aec:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3af3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3afa:	e9 8a 00 00 00       	jmp    3b89 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    3aff:	e8 cc 08 00 00       	call   43d0 <fork>
+    3b04:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    3b07:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3b0b:	75 14                	jne    3b21 <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    3b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3b10:	83 ec 0c             	sub    $0xc,%esp
+    3b13:	50                   	push   %eax
+    3b14:	e8 7b fd ff ff       	call   3894 <validateint>
+    3b19:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b1c:	e8 b7 08 00 00       	call   43d8 <exit>
+    }
+    sleep(0);
+    3b21:	83 ec 0c             	sub    $0xc,%esp
+    3b24:	6a 00                	push   $0x0
+    3b26:	e8 3d 09 00 00       	call   4468 <sleep>
+    3b2b:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    3b2e:	83 ec 0c             	sub    $0xc,%esp
+    3b31:	6a 00                	push   $0x0
+    3b33:	e8 30 09 00 00       	call   4468 <sleep>
+    3b38:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    3b3b:	83 ec 0c             	sub    $0xc,%esp
+    3b3e:	ff 75 ec             	push   -0x14(%ebp)
+    3b41:	e8 c2 08 00 00       	call   4408 <kill>
+    3b46:	83 c4 10             	add    $0x10,%esp
+    wait();
+    3b49:	e8 92 08 00 00       	call   43e0 <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    3b4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3b51:	83 ec 08             	sub    $0x8,%esp
+    3b54:	50                   	push   %eax
+    3b55:	68 15 62 00 00       	push   $0x6215
+    3b5a:	e8 d9 08 00 00       	call   4438 <link>
+    3b5f:	83 c4 10             	add    $0x10,%esp
+    3b62:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3b65:	74 1b                	je     3b82 <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    3b67:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3b6c:	83 ec 08             	sub    $0x8,%esp
+    3b6f:	68 20 62 00 00       	push   $0x6220
+    3b74:	50                   	push   %eax
+    3b75:	e8 62 0a 00 00       	call   45dc <printf>
+    3b7a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b7d:	e8 56 08 00 00       	call   43d8 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3b82:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    3b89:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    3b8c:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3b8f:	0f 83 6a ff ff ff    	jae    3aff <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    3b95:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3b9a:	83 ec 08             	sub    $0x8,%esp
+    3b9d:	68 39 62 00 00       	push   $0x6239
+    3ba2:	50                   	push   %eax
+    3ba3:	e8 34 0a 00 00       	call   45dc <printf>
+    3ba8:	83 c4 10             	add    $0x10,%esp
+}
+    3bab:	90                   	nop
+    3bac:	c9                   	leave
+    3bad:	c3                   	ret
+
+00003bae <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    3bae:	55                   	push   %ebp
+    3baf:	89 e5                	mov    %esp,%ebp
+    3bb1:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    3bb4:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3bb9:	83 ec 08             	sub    $0x8,%esp
+    3bbc:	68 46 62 00 00       	push   $0x6246
+    3bc1:	50                   	push   %eax
+    3bc2:	e8 15 0a 00 00       	call   45dc <printf>
+    3bc7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3bca:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3bd1:	eb 2e                	jmp    3c01 <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    3bd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3bd6:	05 40 8c 00 00       	add    $0x8c40,%eax
+    3bdb:	0f b6 00             	movzbl (%eax),%eax
+    3bde:	84 c0                	test   %al,%al
+    3be0:	74 1b                	je     3bfd <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    3be2:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3be7:	83 ec 08             	sub    $0x8,%esp
+    3bea:	68 50 62 00 00       	push   $0x6250
+    3bef:	50                   	push   %eax
+    3bf0:	e8 e7 09 00 00       	call   45dc <printf>
+    3bf5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3bf8:	e8 db 07 00 00       	call   43d8 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    3bfd:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3c01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3c04:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    3c09:	76 c8                	jbe    3bd3 <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    3c0b:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3c10:	83 ec 08             	sub    $0x8,%esp
+    3c13:	68 61 62 00 00       	push   $0x6261
+    3c18:	50                   	push   %eax
+    3c19:	e8 be 09 00 00       	call   45dc <printf>
+    3c1e:	83 c4 10             	add    $0x10,%esp
+}
+    3c21:	90                   	nop
+    3c22:	c9                   	leave
+    3c23:	c3                   	ret
+
+00003c24 <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    3c24:	55                   	push   %ebp
+    3c25:	89 e5                	mov    %esp,%ebp
+    3c27:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    3c2a:	83 ec 0c             	sub    $0xc,%esp
+    3c2d:	68 6e 62 00 00       	push   $0x626e
+    3c32:	e8 f1 07 00 00       	call   4428 <unlink>
+    3c37:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    3c3a:	e8 91 07 00 00       	call   43d0 <fork>
+    3c3f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    3c42:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3c46:	0f 85 97 00 00 00    	jne    3ce3 <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    3c4c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3c53:	eb 12                	jmp    3c67 <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3c55:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3c58:	c7 04 85 60 b3 00 00 	movl   $0x6278,0xb360(,%eax,4)
+    3c5f:	78 62 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3c63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3c67:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    3c6b:	7e e8                	jle    3c55 <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    3c6d:	c7 05 dc b3 00 00 00 	movl   $0x0,0xb3dc
+    3c74:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    3c77:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3c7c:	83 ec 08             	sub    $0x8,%esp
+    3c7f:	68 55 63 00 00       	push   $0x6355
+    3c84:	50                   	push   %eax
+    3c85:	e8 52 09 00 00       	call   45dc <printf>
+    3c8a:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    3c8d:	83 ec 08             	sub    $0x8,%esp
+    3c90:	68 60 b3 00 00       	push   $0xb360
+    3c95:	68 0c 4b 00 00       	push   $0x4b0c
+    3c9a:	e8 71 07 00 00       	call   4410 <exec>
+    3c9f:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    3ca2:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3ca7:	83 ec 08             	sub    $0x8,%esp
+    3caa:	68 62 63 00 00       	push   $0x6362
+    3caf:	50                   	push   %eax
+    3cb0:	e8 27 09 00 00       	call   45dc <printf>
+    3cb5:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    3cb8:	83 ec 08             	sub    $0x8,%esp
+    3cbb:	68 00 02 00 00       	push   $0x200
+    3cc0:	68 6e 62 00 00       	push   $0x626e
+    3cc5:	e8 4e 07 00 00       	call   4418 <open>
+    3cca:	83 c4 10             	add    $0x10,%esp
+    3ccd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    3cd0:	83 ec 0c             	sub    $0xc,%esp
+    3cd3:	ff 75 ec             	push   -0x14(%ebp)
+    3cd6:	e8 25 07 00 00       	call   4400 <close>
+    3cdb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cde:	e8 f5 06 00 00       	call   43d8 <exit>
+  } else if(pid < 0){
+    3ce3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3ce7:	79 1b                	jns    3d04 <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    3ce9:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3cee:	83 ec 08             	sub    $0x8,%esp
+    3cf1:	68 72 63 00 00       	push   $0x6372
+    3cf6:	50                   	push   %eax
+    3cf7:	e8 e0 08 00 00       	call   45dc <printf>
+    3cfc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cff:	e8 d4 06 00 00       	call   43d8 <exit>
+  }
+  wait();
+    3d04:	e8 d7 06 00 00       	call   43e0 <wait>
+  fd = open("bigarg-ok", 0);
+    3d09:	83 ec 08             	sub    $0x8,%esp
+    3d0c:	6a 00                	push   $0x0
+    3d0e:	68 6e 62 00 00       	push   $0x626e
+    3d13:	e8 00 07 00 00       	call   4418 <open>
+    3d18:	83 c4 10             	add    $0x10,%esp
+    3d1b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    3d1e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3d22:	79 1b                	jns    3d3f <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    3d24:	a1 e8 6b 00 00       	mov    0x6be8,%eax
+    3d29:	83 ec 08             	sub    $0x8,%esp
+    3d2c:	68 8b 63 00 00       	push   $0x638b
+    3d31:	50                   	push   %eax
+    3d32:	e8 a5 08 00 00       	call   45dc <printf>
+    3d37:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d3a:	e8 99 06 00 00       	call   43d8 <exit>
+  }
+  close(fd);
+    3d3f:	83 ec 0c             	sub    $0xc,%esp
+    3d42:	ff 75 ec             	push   -0x14(%ebp)
+    3d45:	e8 b6 06 00 00       	call   4400 <close>
+    3d4a:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    3d4d:	83 ec 0c             	sub    $0xc,%esp
+    3d50:	68 6e 62 00 00       	push   $0x626e
+    3d55:	e8 ce 06 00 00       	call   4428 <unlink>
+    3d5a:	83 c4 10             	add    $0x10,%esp
+}
+    3d5d:	90                   	nop
+    3d5e:	c9                   	leave
+    3d5f:	c3                   	ret
+
+00003d60 <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    3d60:	55                   	push   %ebp
+    3d61:	89 e5                	mov    %esp,%ebp
+    3d63:	53                   	push   %ebx
+    3d64:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    3d67:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    3d6e:	83 ec 08             	sub    $0x8,%esp
+    3d71:	68 a0 63 00 00       	push   $0x63a0
+    3d76:	6a 01                	push   $0x1
+    3d78:	e8 5f 08 00 00       	call   45dc <printf>
+    3d7d:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    3d80:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    3d87:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3d8b:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3d8e:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3d93:	89 c8                	mov    %ecx,%eax
+    3d95:	f7 ea                	imul   %edx
+    3d97:	c1 fa 06             	sar    $0x6,%edx
+    3d9a:	89 c8                	mov    %ecx,%eax
+    3d9c:	c1 f8 1f             	sar    $0x1f,%eax
+    3d9f:	29 c2                	sub    %eax,%edx
+    3da1:	89 d0                	mov    %edx,%eax
+    3da3:	83 c0 30             	add    $0x30,%eax
+    3da6:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3da9:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3dac:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3db1:	89 d8                	mov    %ebx,%eax
+    3db3:	f7 ea                	imul   %edx
+    3db5:	c1 fa 06             	sar    $0x6,%edx
+    3db8:	89 d8                	mov    %ebx,%eax
+    3dba:	c1 f8 1f             	sar    $0x1f,%eax
+    3dbd:	89 d1                	mov    %edx,%ecx
+    3dbf:	29 c1                	sub    %eax,%ecx
+    3dc1:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    3dc7:	29 c3                	sub    %eax,%ebx
+    3dc9:	89 d9                	mov    %ebx,%ecx
+    3dcb:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    3dd0:	89 c8                	mov    %ecx,%eax
+    3dd2:	f7 ea                	imul   %edx
+    3dd4:	c1 fa 05             	sar    $0x5,%edx
+    3dd7:	89 c8                	mov    %ecx,%eax
+    3dd9:	c1 f8 1f             	sar    $0x1f,%eax
+    3ddc:	29 c2                	sub    %eax,%edx
+    3dde:	89 d0                	mov    %edx,%eax
+    3de0:	83 c0 30             	add    $0x30,%eax
+    3de3:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3de6:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3de9:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    3dee:	89 d8                	mov    %ebx,%eax
+    3df0:	f7 ea                	imul   %edx
+    3df2:	c1 fa 05             	sar    $0x5,%edx
+    3df5:	89 d8                	mov    %ebx,%eax
+    3df7:	c1 f8 1f             	sar    $0x1f,%eax
+    3dfa:	89 d1                	mov    %edx,%ecx
+    3dfc:	29 c1                	sub    %eax,%ecx
+    3dfe:	6b c1 64             	imul   $0x64,%ecx,%eax
+    3e01:	29 c3                	sub    %eax,%ebx
+    3e03:	89 d9                	mov    %ebx,%ecx
+    3e05:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3e0a:	89 c8                	mov    %ecx,%eax
+    3e0c:	f7 ea                	imul   %edx
+    3e0e:	c1 fa 02             	sar    $0x2,%edx
+    3e11:	89 c8                	mov    %ecx,%eax
+    3e13:	c1 f8 1f             	sar    $0x1f,%eax
+    3e16:	29 c2                	sub    %eax,%edx
+    3e18:	89 d0                	mov    %edx,%eax
+    3e1a:	83 c0 30             	add    $0x30,%eax
+    3e1d:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3e20:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3e23:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3e28:	89 c8                	mov    %ecx,%eax
+    3e2a:	f7 ea                	imul   %edx
+    3e2c:	c1 fa 02             	sar    $0x2,%edx
+    3e2f:	89 c8                	mov    %ecx,%eax
+    3e31:	c1 f8 1f             	sar    $0x1f,%eax
+    3e34:	29 c2                	sub    %eax,%edx
+    3e36:	89 d0                	mov    %edx,%eax
+    3e38:	c1 e0 02             	shl    $0x2,%eax
+    3e3b:	01 d0                	add    %edx,%eax
+    3e3d:	01 c0                	add    %eax,%eax
+    3e3f:	29 c1                	sub    %eax,%ecx
+    3e41:	89 ca                	mov    %ecx,%edx
+    3e43:	89 d0                	mov    %edx,%eax
+    3e45:	83 c0 30             	add    $0x30,%eax
+    3e48:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    3e4b:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    3e4f:	83 ec 04             	sub    $0x4,%esp
+    3e52:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    3e55:	50                   	push   %eax
+    3e56:	68 ad 63 00 00       	push   $0x63ad
+    3e5b:	6a 01                	push   $0x1
+    3e5d:	e8 7a 07 00 00       	call   45dc <printf>
+    3e62:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    3e65:	83 ec 08             	sub    $0x8,%esp
+    3e68:	68 02 02 00 00       	push   $0x202
+    3e6d:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    3e70:	50                   	push   %eax
+    3e71:	e8 a2 05 00 00       	call   4418 <open>
+    3e76:	83 c4 10             	add    $0x10,%esp
+    3e79:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    3e7c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3e80:	79 18                	jns    3e9a <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    3e82:	83 ec 04             	sub    $0x4,%esp
+    3e85:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    3e88:	50                   	push   %eax
+    3e89:	68 b9 63 00 00       	push   $0x63b9
+    3e8e:	6a 01                	push   $0x1
+    3e90:	e8 47 07 00 00       	call   45dc <printf>
+    3e95:	83 c4 10             	add    $0x10,%esp
+      break;
+    3e98:	eb 6b                	jmp    3f05 <fsfull+0x1a5>
+    }
+    int total = 0;
+    3e9a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    3ea1:	83 ec 04             	sub    $0x4,%esp
+    3ea4:	68 00 02 00 00       	push   $0x200
+    3ea9:	68 20 6c 00 00       	push   $0x6c20
+    3eae:	ff 75 e8             	push   -0x18(%ebp)
+    3eb1:	e8 42 05 00 00       	call   43f8 <write>
+    3eb6:	83 c4 10             	add    $0x10,%esp
+    3eb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    3ebc:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    3ec3:	7e 0c                	jle    3ed1 <fsfull+0x171>
+        break;
+      total += cc;
+    3ec5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3ec8:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    3ecb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    3ecf:	eb d0                	jmp    3ea1 <fsfull+0x141>
+        break;
+    3ed1:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    3ed2:	83 ec 04             	sub    $0x4,%esp
+    3ed5:	ff 75 ec             	push   -0x14(%ebp)
+    3ed8:	68 c9 63 00 00       	push   $0x63c9
+    3edd:	6a 01                	push   $0x1
+    3edf:	e8 f8 06 00 00       	call   45dc <printf>
+    3ee4:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    3ee7:	83 ec 0c             	sub    $0xc,%esp
+    3eea:	ff 75 e8             	push   -0x18(%ebp)
+    3eed:	e8 0e 05 00 00       	call   4400 <close>
+    3ef2:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    3ef5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3ef9:	74 09                	je     3f04 <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    3efb:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3eff:	e9 83 fe ff ff       	jmp    3d87 <fsfull+0x27>
+      break;
+    3f04:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    3f05:	e9 db 00 00 00       	jmp    3fe5 <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    3f0a:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3f0e:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3f11:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3f16:	89 c8                	mov    %ecx,%eax
+    3f18:	f7 ea                	imul   %edx
+    3f1a:	c1 fa 06             	sar    $0x6,%edx
+    3f1d:	89 c8                	mov    %ecx,%eax
+    3f1f:	c1 f8 1f             	sar    $0x1f,%eax
+    3f22:	29 c2                	sub    %eax,%edx
+    3f24:	89 d0                	mov    %edx,%eax
+    3f26:	83 c0 30             	add    $0x30,%eax
+    3f29:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3f2c:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3f2f:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    3f34:	89 d8                	mov    %ebx,%eax
+    3f36:	f7 ea                	imul   %edx
+    3f38:	c1 fa 06             	sar    $0x6,%edx
+    3f3b:	89 d8                	mov    %ebx,%eax
+    3f3d:	c1 f8 1f             	sar    $0x1f,%eax
+    3f40:	89 d1                	mov    %edx,%ecx
+    3f42:	29 c1                	sub    %eax,%ecx
+    3f44:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    3f4a:	29 c3                	sub    %eax,%ebx
+    3f4c:	89 d9                	mov    %ebx,%ecx
+    3f4e:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    3f53:	89 c8                	mov    %ecx,%eax
+    3f55:	f7 ea                	imul   %edx
+    3f57:	c1 fa 05             	sar    $0x5,%edx
+    3f5a:	89 c8                	mov    %ecx,%eax
+    3f5c:	c1 f8 1f             	sar    $0x1f,%eax
+    3f5f:	29 c2                	sub    %eax,%edx
+    3f61:	89 d0                	mov    %edx,%eax
+    3f63:	83 c0 30             	add    $0x30,%eax
+    3f66:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3f69:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    3f6c:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    3f71:	89 d8                	mov    %ebx,%eax
+    3f73:	f7 ea                	imul   %edx
+    3f75:	c1 fa 05             	sar    $0x5,%edx
+    3f78:	89 d8                	mov    %ebx,%eax
+    3f7a:	c1 f8 1f             	sar    $0x1f,%eax
+    3f7d:	89 d1                	mov    %edx,%ecx
+    3f7f:	29 c1                	sub    %eax,%ecx
+    3f81:	6b c1 64             	imul   $0x64,%ecx,%eax
+    3f84:	29 c3                	sub    %eax,%ebx
+    3f86:	89 d9                	mov    %ebx,%ecx
+    3f88:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3f8d:	89 c8                	mov    %ecx,%eax
+    3f8f:	f7 ea                	imul   %edx
+    3f91:	c1 fa 02             	sar    $0x2,%edx
+    3f94:	89 c8                	mov    %ecx,%eax
+    3f96:	c1 f8 1f             	sar    $0x1f,%eax
+    3f99:	29 c2                	sub    %eax,%edx
+    3f9b:	89 d0                	mov    %edx,%eax
+    3f9d:	83 c0 30             	add    $0x30,%eax
+    3fa0:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3fa3:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    3fa6:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3fab:	89 c8                	mov    %ecx,%eax
+    3fad:	f7 ea                	imul   %edx
+    3faf:	c1 fa 02             	sar    $0x2,%edx
+    3fb2:	89 c8                	mov    %ecx,%eax
+    3fb4:	c1 f8 1f             	sar    $0x1f,%eax
+    3fb7:	29 c2                	sub    %eax,%edx
+    3fb9:	89 d0                	mov    %edx,%eax
+    3fbb:	c1 e0 02             	shl    $0x2,%eax
+    3fbe:	01 d0                	add    %edx,%eax
+    3fc0:	01 c0                	add    %eax,%eax
+    3fc2:	29 c1                	sub    %eax,%ecx
+    3fc4:	89 ca                	mov    %ecx,%edx
+    3fc6:	89 d0                	mov    %edx,%eax
+    3fc8:	83 c0 30             	add    $0x30,%eax
+    3fcb:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    3fce:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    3fd2:	83 ec 0c             	sub    $0xc,%esp
+    3fd5:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    3fd8:	50                   	push   %eax
+    3fd9:	e8 4a 04 00 00       	call   4428 <unlink>
+    3fde:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    3fe1:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    3fe5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3fe9:	0f 89 1b ff ff ff    	jns    3f0a <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    3fef:	83 ec 08             	sub    $0x8,%esp
+    3ff2:	68 d9 63 00 00       	push   $0x63d9
+    3ff7:	6a 01                	push   $0x1
+    3ff9:	e8 de 05 00 00       	call   45dc <printf>
+    3ffe:	83 c4 10             	add    $0x10,%esp
+}
+    4001:	90                   	nop
+    4002:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4005:	c9                   	leave
+    4006:	c3                   	ret
+
+00004007 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    4007:	55                   	push   %ebp
+    4008:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    400a:	a1 ec 6b 00 00       	mov    0x6bec,%eax
+    400f:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    4015:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    401a:	a3 ec 6b 00 00       	mov    %eax,0x6bec
+  return randstate;
+    401f:	a1 ec 6b 00 00       	mov    0x6bec,%eax
+}
+    4024:	5d                   	pop    %ebp
+    4025:	c3                   	ret
+
+00004026 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    4026:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    402a:	83 e4 f0             	and    $0xfffffff0,%esp
+    402d:	ff 71 fc             	push   -0x4(%ecx)
+    4030:	55                   	push   %ebp
+    4031:	89 e5                	mov    %esp,%ebp
+    4033:	51                   	push   %ecx
+    4034:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    4037:	83 ec 08             	sub    $0x8,%esp
+    403a:	68 ef 63 00 00       	push   $0x63ef
+    403f:	6a 01                	push   $0x1
+    4041:	e8 96 05 00 00       	call   45dc <printf>
+    4046:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    4049:	83 ec 08             	sub    $0x8,%esp
+    404c:	6a 00                	push   $0x0
+    404e:	68 03 64 00 00       	push   $0x6403
+    4053:	e8 c0 03 00 00       	call   4418 <open>
+    4058:	83 c4 10             	add    $0x10,%esp
+    405b:	85 c0                	test   %eax,%eax
+    405d:	78 17                	js     4076 <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    405f:	83 ec 08             	sub    $0x8,%esp
+    4062:	68 14 64 00 00       	push   $0x6414
+    4067:	6a 01                	push   $0x1
+    4069:	e8 6e 05 00 00       	call   45dc <printf>
+    406e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4071:	e8 62 03 00 00       	call   43d8 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    4076:	83 ec 08             	sub    $0x8,%esp
+    4079:	68 00 02 00 00       	push   $0x200
+    407e:	68 03 64 00 00       	push   $0x6403
+    4083:	e8 90 03 00 00       	call   4418 <open>
+    4088:	83 c4 10             	add    $0x10,%esp
+    408b:	83 ec 0c             	sub    $0xc,%esp
+    408e:	50                   	push   %eax
+    408f:	e8 6c 03 00 00       	call   4400 <close>
+    4094:	83 c4 10             	add    $0x10,%esp
+
+  createdelete();
+    4097:	e8 bd d4 ff ff       	call   1559 <createdelete>
+  linkunlink();
+    409c:	e8 e2 de ff ff       	call   1f83 <linkunlink>
+  concreate();
+    40a1:	e8 29 db ff ff       	call   1bcf <concreate>
+  fourfiles();
+    40a6:	e8 5d d2 ff ff       	call   1308 <fourfiles>
+  sharedfd();
+    40ab:	e8 75 d0 ff ff       	call   1125 <sharedfd>
+
+  bigargtest();
+    40b0:	e8 6f fb ff ff       	call   3c24 <bigargtest>
+  bigwrite();
+    40b5:	e8 c5 e8 ff ff       	call   297f <bigwrite>
+  bigargtest();
+    40ba:	e8 65 fb ff ff       	call   3c24 <bigargtest>
+  bsstest();
+    40bf:	e8 ea fa ff ff       	call   3bae <bsstest>
+  sbrktest();
+    40c4:	e8 e9 f2 ff ff       	call   33b2 <sbrktest>
+  validatetest();
+    40c9:	e8 02 fa ff ff       	call   3ad0 <validatetest>
+
+  opentest();
+    40ce:	e8 2c c2 ff ff       	call   2ff <opentest>
+  writetest();
+    40d3:	e8 d6 c2 ff ff       	call   3ae <writetest>
+  writetest1();
+    40d8:	e8 e1 c4 ff ff       	call   5be <writetest1>
+  createtest();
+    40dd:	e8 d8 c6 ff ff       	call   7ba <createtest>
+
+  openiputtest();
+    40e2:	e8 09 c1 ff ff       	call   1f0 <openiputtest>
+  exitiputtest();
+    40e7:	e8 05 c0 ff ff       	call   f1 <exitiputtest>
+  iputtest();
+    40ec:	e8 0f bf ff ff       	call   0 <iputtest>
+
+  mem();
+    40f1:	e8 3e cf ff ff       	call   1034 <mem>
+  pipe1();
+    40f6:	e8 c6 c8 ff ff       	call   9c1 <pipe1>
+  preempt();
+    40fb:	e8 aa ca ff ff       	call   baa <preempt>
+  exitwait();
+    4100:	e8 0b cc ff ff       	call   d10 <exitwait>
+  waitpidtest();
+    4105:	e8 1b cd ff ff       	call   e25 <waitpidtest>
+  badpid();
+    410a:	e8 79 cc ff ff       	call   d88 <badpid>
+  sleeptest();
+    410f:	e8 a2 f7 ff ff       	call   38b6 <sleeptest>
+
+  rmdot();
+    4114:	e8 d8 ec ff ff       	call   2df1 <rmdot>
+  fourteen();
+    4119:	e8 77 eb ff ff       	call   2c95 <fourteen>
+  bigfile();
+    411e:	e8 5a e9 ff ff       	call   2a7d <bigfile>
+  subdir();
+    4123:	e8 13 e1 ff ff       	call   223b <subdir>
+  linktest();
+    4128:	e8 60 d8 ff ff       	call   198d <linktest>
+  unlinkread();
+    412d:	e8 99 d6 ff ff       	call   17cb <unlinkread>
+  dirfile();
+    4132:	e8 3f ee ff ff       	call   2f76 <dirfile>
+  iref();
+    4137:	e8 72 f0 ff ff       	call   31ae <iref>
+  forktest();
+    413c:	e8 a7 f1 ff ff       	call   32e8 <forktest>
+  bigdir(); // slow
+    4141:	e8 74 df ff ff       	call   20ba <bigdir>
+  exectest();
+    4146:	e8 23 c8 ff ff       	call   96e <exectest>
+
+  exit();
+    414b:	e8 88 02 00 00       	call   43d8 <exit>
+
+00004150 <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+    4150:	55                   	push   %ebp
+    4151:	89 e5                	mov    %esp,%ebp
+    4153:	57                   	push   %edi
+    4154:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+    4155:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4158:	8b 55 10             	mov    0x10(%ebp),%edx
+    415b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    415e:	89 cb                	mov    %ecx,%ebx
+    4160:	89 df                	mov    %ebx,%edi
+    4162:	89 d1                	mov    %edx,%ecx
+    4164:	fc                   	cld
+    4165:	f3 aa                	rep stos %al,%es:(%edi)
+    4167:	89 ca                	mov    %ecx,%edx
+    4169:	89 fb                	mov    %edi,%ebx
+    416b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    416e:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+    4171:	90                   	nop
+    4172:	5b                   	pop    %ebx
+    4173:	5f                   	pop    %edi
+    4174:	5d                   	pop    %ebp
+    4175:	c3                   	ret
+
+00004176 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+    4176:	55                   	push   %ebp
+    4177:	89 e5                	mov    %esp,%ebp
+    4179:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+    417c:	8b 45 08             	mov    0x8(%ebp),%eax
+    417f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    4182:	90                   	nop
+    4183:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4186:	8d 42 01             	lea    0x1(%edx),%eax
+    4189:	89 45 0c             	mov    %eax,0xc(%ebp)
+    418c:	8b 45 08             	mov    0x8(%ebp),%eax
+    418f:	8d 48 01             	lea    0x1(%eax),%ecx
+    4192:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    4195:	0f b6 12             	movzbl (%edx),%edx
+    4198:	88 10                	mov    %dl,(%eax)
+    419a:	0f b6 00             	movzbl (%eax),%eax
+    419d:	84 c0                	test   %al,%al
+    419f:	75 e2                	jne    4183 <strcpy+0xd>
+    ;
+  return os;
+    41a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    41a4:	c9                   	leave
+    41a5:	c3                   	ret
+
+000041a6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    41a6:	55                   	push   %ebp
+    41a7:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    41a9:	eb 08                	jmp    41b3 <strcmp+0xd>
+    p++, q++;
+    41ab:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    41af:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    41b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    41b6:	0f b6 00             	movzbl (%eax),%eax
+    41b9:	84 c0                	test   %al,%al
+    41bb:	74 10                	je     41cd <strcmp+0x27>
+    41bd:	8b 45 08             	mov    0x8(%ebp),%eax
+    41c0:	0f b6 10             	movzbl (%eax),%edx
+    41c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    41c6:	0f b6 00             	movzbl (%eax),%eax
+    41c9:	38 c2                	cmp    %al,%dl
+    41cb:	74 de                	je     41ab <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    41cd:	8b 45 08             	mov    0x8(%ebp),%eax
+    41d0:	0f b6 00             	movzbl (%eax),%eax
+    41d3:	0f b6 d0             	movzbl %al,%edx
+    41d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    41d9:	0f b6 00             	movzbl (%eax),%eax
+    41dc:	0f b6 c0             	movzbl %al,%eax
+    41df:	29 c2                	sub    %eax,%edx
+    41e1:	89 d0                	mov    %edx,%eax
+}
+    41e3:	5d                   	pop    %ebp
+    41e4:	c3                   	ret
+
+000041e5 <strlen>:
+
+uint
+strlen(char *s)
+{
+    41e5:	55                   	push   %ebp
+    41e6:	89 e5                	mov    %esp,%ebp
+    41e8:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+    41eb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    41f2:	eb 04                	jmp    41f8 <strlen+0x13>
+    41f4:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    41f8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    41fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    41fe:	01 d0                	add    %edx,%eax
+    4200:	0f b6 00             	movzbl (%eax),%eax
+    4203:	84 c0                	test   %al,%al
+    4205:	75 ed                	jne    41f4 <strlen+0xf>
+    ;
+  return n;
+    4207:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    420a:	c9                   	leave
+    420b:	c3                   	ret
+
+0000420c <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    420c:	55                   	push   %ebp
+    420d:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    420f:	8b 45 10             	mov    0x10(%ebp),%eax
+    4212:	50                   	push   %eax
+    4213:	ff 75 0c             	push   0xc(%ebp)
+    4216:	ff 75 08             	push   0x8(%ebp)
+    4219:	e8 32 ff ff ff       	call   4150 <stosb>
+    421e:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    4221:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4224:	c9                   	leave
+    4225:	c3                   	ret
+
+00004226 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4226:	55                   	push   %ebp
+    4227:	89 e5                	mov    %esp,%ebp
+    4229:	83 ec 04             	sub    $0x4,%esp
+    422c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    422f:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    4232:	eb 14                	jmp    4248 <strchr+0x22>
+    if(*s == c)
+    4234:	8b 45 08             	mov    0x8(%ebp),%eax
+    4237:	0f b6 00             	movzbl (%eax),%eax
+    423a:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    423d:	75 05                	jne    4244 <strchr+0x1e>
+      return (char*)s;
+    423f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4242:	eb 13                	jmp    4257 <strchr+0x31>
+  for(; *s; s++)
+    4244:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4248:	8b 45 08             	mov    0x8(%ebp),%eax
+    424b:	0f b6 00             	movzbl (%eax),%eax
+    424e:	84 c0                	test   %al,%al
+    4250:	75 e2                	jne    4234 <strchr+0xe>
+  return 0;
+    4252:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    4257:	c9                   	leave
+    4258:	c3                   	ret
+
+00004259 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4259:	55                   	push   %ebp
+    425a:	89 e5                	mov    %esp,%ebp
+    425c:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    425f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4266:	eb 42                	jmp    42aa <gets+0x51>
+    cc = read(0, &c, 1);
+    4268:	83 ec 04             	sub    $0x4,%esp
+    426b:	6a 01                	push   $0x1
+    426d:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    4270:	50                   	push   %eax
+    4271:	6a 00                	push   $0x0
+    4273:	e8 78 01 00 00       	call   43f0 <read>
+    4278:	83 c4 10             	add    $0x10,%esp
+    427b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    427e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4282:	7e 33                	jle    42b7 <gets+0x5e>
+      break;
+    buf[i++] = c;
+    4284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4287:	8d 50 01             	lea    0x1(%eax),%edx
+    428a:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    428d:	89 c2                	mov    %eax,%edx
+    428f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4292:	01 c2                	add    %eax,%edx
+    4294:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4298:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    429a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    429e:	3c 0a                	cmp    $0xa,%al
+    42a0:	74 16                	je     42b8 <gets+0x5f>
+    42a2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    42a6:	3c 0d                	cmp    $0xd,%al
+    42a8:	74 0e                	je     42b8 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    42aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    42ad:	83 c0 01             	add    $0x1,%eax
+    42b0:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    42b3:	7f b3                	jg     4268 <gets+0xf>
+    42b5:	eb 01                	jmp    42b8 <gets+0x5f>
+      break;
+    42b7:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+    42b8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    42bb:	8b 45 08             	mov    0x8(%ebp),%eax
+    42be:	01 d0                	add    %edx,%eax
+    42c0:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    42c3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    42c6:	c9                   	leave
+    42c7:	c3                   	ret
+
+000042c8 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+    42c8:	55                   	push   %ebp
+    42c9:	89 e5                	mov    %esp,%ebp
+    42cb:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    42ce:	83 ec 08             	sub    $0x8,%esp
+    42d1:	6a 00                	push   $0x0
+    42d3:	ff 75 08             	push   0x8(%ebp)
+    42d6:	e8 3d 01 00 00       	call   4418 <open>
+    42db:	83 c4 10             	add    $0x10,%esp
+    42de:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    42e1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    42e5:	79 07                	jns    42ee <stat+0x26>
+    return -1;
+    42e7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    42ec:	eb 25                	jmp    4313 <stat+0x4b>
+  r = fstat(fd, st);
+    42ee:	83 ec 08             	sub    $0x8,%esp
+    42f1:	ff 75 0c             	push   0xc(%ebp)
+    42f4:	ff 75 f4             	push   -0xc(%ebp)
+    42f7:	e8 34 01 00 00       	call   4430 <fstat>
+    42fc:	83 c4 10             	add    $0x10,%esp
+    42ff:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    4302:	83 ec 0c             	sub    $0xc,%esp
+    4305:	ff 75 f4             	push   -0xc(%ebp)
+    4308:	e8 f3 00 00 00       	call   4400 <close>
+    430d:	83 c4 10             	add    $0x10,%esp
+  return r;
+    4310:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    4313:	c9                   	leave
+    4314:	c3                   	ret
+
+00004315 <atoi>:
+
+int
+atoi(const char *s)
+{
+    4315:	55                   	push   %ebp
+    4316:	89 e5                	mov    %esp,%ebp
+    4318:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+    431b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4322:	eb 25                	jmp    4349 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    4324:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4327:	89 d0                	mov    %edx,%eax
+    4329:	c1 e0 02             	shl    $0x2,%eax
+    432c:	01 d0                	add    %edx,%eax
+    432e:	01 c0                	add    %eax,%eax
+    4330:	89 c1                	mov    %eax,%ecx
+    4332:	8b 45 08             	mov    0x8(%ebp),%eax
+    4335:	8d 50 01             	lea    0x1(%eax),%edx
+    4338:	89 55 08             	mov    %edx,0x8(%ebp)
+    433b:	0f b6 00             	movzbl (%eax),%eax
+    433e:	0f be c0             	movsbl %al,%eax
+    4341:	01 c8                	add    %ecx,%eax
+    4343:	83 e8 30             	sub    $0x30,%eax
+    4346:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4349:	8b 45 08             	mov    0x8(%ebp),%eax
+    434c:	0f b6 00             	movzbl (%eax),%eax
+    434f:	3c 2f                	cmp    $0x2f,%al
+    4351:	7e 0a                	jle    435d <atoi+0x48>
+    4353:	8b 45 08             	mov    0x8(%ebp),%eax
+    4356:	0f b6 00             	movzbl (%eax),%eax
+    4359:	3c 39                	cmp    $0x39,%al
+    435b:	7e c7                	jle    4324 <atoi+0xf>
+  return n;
+    435d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4360:	c9                   	leave
+    4361:	c3                   	ret
+
+00004362 <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+    4362:	55                   	push   %ebp
+    4363:	89 e5                	mov    %esp,%ebp
+    4365:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+    4368:	8b 45 08             	mov    0x8(%ebp),%eax
+    436b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    436e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4371:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    4374:	eb 17                	jmp    438d <memmove+0x2b>
+    *dst++ = *src++;
+    4376:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    4379:	8d 42 01             	lea    0x1(%edx),%eax
+    437c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    437f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4382:	8d 48 01             	lea    0x1(%eax),%ecx
+    4385:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    4388:	0f b6 12             	movzbl (%edx),%edx
+    438b:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    438d:	8b 45 10             	mov    0x10(%ebp),%eax
+    4390:	8d 50 ff             	lea    -0x1(%eax),%edx
+    4393:	89 55 10             	mov    %edx,0x10(%ebp)
+    4396:	85 c0                	test   %eax,%eax
+    4398:	7f dc                	jg     4376 <memmove+0x14>
+  return vdst;
+    439a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    439d:	c9                   	leave
+    439e:	c3                   	ret
+
+0000439f <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+    439f:	55                   	push   %ebp
+    43a0:	89 e5                	mov    %esp,%ebp
+    43a2:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+    43a5:	83 ec 0c             	sub    $0xc,%esp
+    43a8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    43ab:	50                   	push   %eax
+    43ac:	e8 ff 00 00 00       	call   44b0 <nanouptime>
+    43b1:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+    43b4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    43b7:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+    43bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    43c0:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    43c5:	f7 e2                	mul    %edx
+    43c7:	89 d0                	mov    %edx,%eax
+    43c9:	c1 e8 06             	shr    $0x6,%eax
+    43cc:	01 c8                	add    %ecx,%eax
+}
+    43ce:	c9                   	leave
+    43cf:	c3                   	ret
+
+000043d0 <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    43d0:	b8 01 00 00 00       	mov    $0x1,%eax
+    43d5:	cd 40                	int    $0x40
+    43d7:	c3                   	ret
+
+000043d8 <exit>:
+SYSCALL(exit)
+    43d8:	b8 02 00 00 00       	mov    $0x2,%eax
+    43dd:	cd 40                	int    $0x40
+    43df:	c3                   	ret
+
+000043e0 <wait>:
+SYSCALL(wait)
+    43e0:	b8 03 00 00 00       	mov    $0x3,%eax
+    43e5:	cd 40                	int    $0x40
+    43e7:	c3                   	ret
+
+000043e8 <pipe>:
+SYSCALL(pipe)
+    43e8:	b8 04 00 00 00       	mov    $0x4,%eax
+    43ed:	cd 40                	int    $0x40
+    43ef:	c3                   	ret
+
+000043f0 <read>:
+SYSCALL(read)
+    43f0:	b8 05 00 00 00       	mov    $0x5,%eax
+    43f5:	cd 40                	int    $0x40
+    43f7:	c3                   	ret
+
+000043f8 <write>:
+SYSCALL(write)
+    43f8:	b8 10 00 00 00       	mov    $0x10,%eax
+    43fd:	cd 40                	int    $0x40
+    43ff:	c3                   	ret
+
+00004400 <close>:
+SYSCALL(close)
+    4400:	b8 15 00 00 00       	mov    $0x15,%eax
+    4405:	cd 40                	int    $0x40
+    4407:	c3                   	ret
+
+00004408 <kill>:
+SYSCALL(kill)
+    4408:	b8 06 00 00 00       	mov    $0x6,%eax
+    440d:	cd 40                	int    $0x40
+    440f:	c3                   	ret
+
+00004410 <exec>:
+SYSCALL(exec)
+    4410:	b8 07 00 00 00       	mov    $0x7,%eax
+    4415:	cd 40                	int    $0x40
+    4417:	c3                   	ret
+
+00004418 <open>:
+SYSCALL(open)
+    4418:	b8 0f 00 00 00       	mov    $0xf,%eax
+    441d:	cd 40                	int    $0x40
+    441f:	c3                   	ret
+
+00004420 <mknod>:
+SYSCALL(mknod)
+    4420:	b8 11 00 00 00       	mov    $0x11,%eax
+    4425:	cd 40                	int    $0x40
+    4427:	c3                   	ret
+
+00004428 <unlink>:
+SYSCALL(unlink)
+    4428:	b8 12 00 00 00       	mov    $0x12,%eax
+    442d:	cd 40                	int    $0x40
+    442f:	c3                   	ret
+
+00004430 <fstat>:
+SYSCALL(fstat)
+    4430:	b8 08 00 00 00       	mov    $0x8,%eax
+    4435:	cd 40                	int    $0x40
+    4437:	c3                   	ret
+
+00004438 <link>:
+SYSCALL(link)
+    4438:	b8 13 00 00 00       	mov    $0x13,%eax
+    443d:	cd 40                	int    $0x40
+    443f:	c3                   	ret
+
+00004440 <mkdir>:
+SYSCALL(mkdir)
+    4440:	b8 14 00 00 00       	mov    $0x14,%eax
+    4445:	cd 40                	int    $0x40
+    4447:	c3                   	ret
+
+00004448 <chdir>:
+SYSCALL(chdir)
+    4448:	b8 09 00 00 00       	mov    $0x9,%eax
+    444d:	cd 40                	int    $0x40
+    444f:	c3                   	ret
+
+00004450 <dup>:
+SYSCALL(dup)
+    4450:	b8 0a 00 00 00       	mov    $0xa,%eax
+    4455:	cd 40                	int    $0x40
+    4457:	c3                   	ret
+
+00004458 <getpid>:
+SYSCALL(getpid)
+    4458:	b8 0b 00 00 00       	mov    $0xb,%eax
+    445d:	cd 40                	int    $0x40
+    445f:	c3                   	ret
+
+00004460 <sbrk>:
+SYSCALL(sbrk)
+    4460:	b8 0c 00 00 00       	mov    $0xc,%eax
+    4465:	cd 40                	int    $0x40
+    4467:	c3                   	ret
+
+00004468 <sleep>:
+SYSCALL(sleep)
+    4468:	b8 0d 00 00 00       	mov    $0xd,%eax
+    446d:	cd 40                	int    $0x40
+    446f:	c3                   	ret
+
+00004470 <uptime>:
+SYSCALL(uptime)
+    4470:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4475:	cd 40                	int    $0x40
+    4477:	c3                   	ret
+
+00004478 <saveProc>:
+SYSCALL(saveProc)
+    4478:	b8 16 00 00 00       	mov    $0x16,%eax
+    447d:	cd 40                	int    $0x40
+    447f:	c3                   	ret
+
+00004480 <loadProc>:
+SYSCALL(loadProc)
+    4480:	b8 17 00 00 00       	mov    $0x17,%eax
+    4485:	cd 40                	int    $0x40
+    4487:	c3                   	ret
+
+00004488 <setpriority>:
+SYSCALL(setpriority)
+    4488:	b8 19 00 00 00       	mov    $0x19,%eax
+    448d:	cd 40                	int    $0x40
+    448f:	c3                   	ret
+
+00004490 <setaffinity>:
+SYSCALL(setaffinity)
+    4490:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4495:	cd 40                	int    $0x40
+    4497:	c3                   	ret
+
+00004498 <getaffinity>:
+SYSCALL(getaffinity)
+    4498:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    449d:	cd 40                	int    $0x40
+    449f:	c3                   	ret
+
+000044a0 <nanosleep>:
+SYSCALL(nanosleep)
+    44a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    44a5:	cd 40                	int    $0x40
+    44a7:	c3                   	ret
+
+000044a8 <cpustat>:
+SYSCALL(cpustat)
+    44a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    44ad:	cd 40                	int    $0x40
+    44af:	c3                   	ret
+
+000044b0 <nanouptime>:
+SYSCALL(nanouptime)
+    44b0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    44b5:	cd 40                	int    $0x40
+    44b7:	c3                   	ret
+
+000044b8 <settickets>:
+SYSCALL(settickets)
+    44b8:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    44bd:	cd 40                	int    $0x40
+    44bf:	c3                   	ret
+
+000044c0 <setdeadline>:
+SYSCALL(setdeadline)
+    44c0:	b8 20 00 00 00       	mov    $0x20,%eax
+    44c5:	cd 40                	int    $0x40
+    44c7:	c3                   	ret
+
+000044c8 <rtstat>:
+SYSCALL(rtstat)
+    44c8:	b8 21 00 00 00       	mov    $0x21,%eax
+    44cd:	cd 40                	int    $0x40
+    44cf:	c3                   	ret
+
+000044d0 <schedstat>:
+SYSCALL(schedstat)
+    44d0:	b8 22 00 00 00       	mov    $0x22,%eax
+    44d5:	cd 40                	int    $0x40
+    44d7:	c3                   	ret
+
+000044d8 <waitpid>:
+SYSCALL(waitpid)
+    44d8:	b8 23 00 00 00       	mov    $0x23,%eax
+    44dd:	cd 40                	int    $0x40
+    44df:	c3                   	ret
+
+000044e0 <clone>:
+SYSCALL(clone)
+    44e0:	b8 24 00 00 00       	mov    $0x24,%eax
+    44e5:	cd 40                	int    $0x40
+    44e7:	c3                   	ret
+
+000044e8 <futexwait>:
+SYSCALL(futexwait)
+    44e8:	b8 25 00 00 00       	mov    $0x25,%eax
+    44ed:	cd 40                	int    $0x40
+    44ef:	c3                   	ret
+
+000044f0 <futexwake>:
+SYSCALL(futexwake)
+    44f0:	b8 26 00 00 00       	mov    $0x26,%eax
+    44f5:	cd 40                	int    $0x40
+    44f7:	c3                   	ret
+
+000044f8 <lockstat>:
+SYSCALL(lockstat)
+    44f8:	b8 27 00 00 00       	mov    $0x27,%eax
+    44fd:	cd 40                	int    $0x40
+    44ff:	c3                   	ret
+
+00004500 <dcachestat>:
+SYSCALL(dcachestat)
+    4500:	b8 28 00 00 00       	mov    $0x28,%eax
+    4505:	cd 40                	int    $0x40
+    4507:	c3                   	ret
+
+00004508 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    4508:	55                   	push   %ebp
+    4509:	89 e5                	mov    %esp,%ebp
+    450b:	83 ec 18             	sub    $0x18,%esp
+    450e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4511:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    4514:	83 ec 04             	sub    $0x4,%esp
+    4517:	6a 01                	push   $0x1
+    4519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    451c:	50                   	push   %eax
+    451d:	ff 75 08             	push   0x8(%ebp)
+    4520:	e8 d3 fe ff ff       	call   43f8 <write>
+    4525:	83 c4 10             	add    $0x10,%esp
+}
+    4528:	90                   	nop
+    4529:	c9                   	leave
+    452a:	c3                   	ret
+
+0000452b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    452b:	55                   	push   %ebp
+    452c:	89 e5                	mov    %esp,%ebp
+    452e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    4531:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    4538:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    453c:	74 17                	je     4555 <printint+0x2a>
+    453e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    4542:	79 11                	jns    4555 <printint+0x2a>
+    neg = 1;
+    4544:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    454b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    454e:	f7 d8                	neg    %eax
+    4550:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4553:	eb 06                	jmp    455b <printint+0x30>
+  } else {
+    x = xx;
+    4555:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4558:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    455b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    4562:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4565:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4568:	ba 00 00 00 00       	mov    $0x0,%edx
+    456d:	f7 f1                	div    %ecx
+    456f:	89 d1                	mov    %edx,%ecx
+    4571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4574:	8d 50 01             	lea    0x1(%eax),%edx
+    4577:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    457a:	0f b6 91 f0 6b 00 00 	movzbl 0x6bf0(%ecx),%edx
+    4581:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    4585:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    4588:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    458b:	ba 00 00 00 00       	mov    $0x0,%edx
+    4590:	f7 f1                	div    %ecx
+    4592:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4595:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4599:	75 c7                	jne    4562 <printint+0x37>
+  if(neg)
+    459b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    459f:	74 2d                	je     45ce <printint+0xa3>
+    buf[i++] = '-';
+    45a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    45a4:	8d 50 01             	lea    0x1(%eax),%edx
+    45a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    45aa:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    45af:	eb 1d                	jmp    45ce <printint+0xa3>
+    putc(fd, buf[i]);
+    45b1:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    45b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    45b7:	01 d0                	add    %edx,%eax
+    45b9:	0f b6 00             	movzbl (%eax),%eax
+    45bc:	0f be c0             	movsbl %al,%eax
+    45bf:	83 ec 08             	sub    $0x8,%esp
+    45c2:	50                   	push   %eax
+    45c3:	ff 75 08             	push   0x8(%ebp)
+    45c6:	e8 3d ff ff ff       	call   4508 <putc>
+    45cb:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    45ce:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    45d2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    45d6:	79 d9                	jns    45b1 <printint+0x86>
+}
+    45d8:	90                   	nop
+    45d9:	90                   	nop
+    45da:	c9                   	leave
+    45db:	c3                   	ret
+
+000045dc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    45dc:	55                   	push   %ebp
+    45dd:	89 e5                	mov    %esp,%ebp
+    45df:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    45e2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    45e9:	8d 45 0c             	lea    0xc(%ebp),%eax
+    45ec:	83 c0 04             	add    $0x4,%eax
+    45ef:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    45f2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    45f9:	e9 59 01 00 00       	jmp    4757 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    45fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4601:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4604:	01 d0                	add    %edx,%eax
+    4606:	0f b6 00             	movzbl (%eax),%eax
+    4609:	0f be c0             	movsbl %al,%eax
+    460c:	25 ff 00 00 00       	and    $0xff,%eax
+    4611:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    4614:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4618:	75 2c                	jne    4646 <printf+0x6a>
+      if(c == '%'){
+    461a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    461e:	75 0c                	jne    462c <printf+0x50>
+        state = '%';
+    4620:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    4627:	e9 27 01 00 00       	jmp    4753 <printf+0x177>
+      } else {
+        putc(fd, c);
+    462c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    462f:	0f be c0             	movsbl %al,%eax
+    4632:	83 ec 08             	sub    $0x8,%esp
+    4635:	50                   	push   %eax
+    4636:	ff 75 08             	push   0x8(%ebp)
+    4639:	e8 ca fe ff ff       	call   4508 <putc>
+    463e:	83 c4 10             	add    $0x10,%esp
+    4641:	e9 0d 01 00 00       	jmp    4753 <printf+0x177>
+      }
+    } else if(state == '%'){
+    4646:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    464a:	0f 85 03 01 00 00    	jne    4753 <printf+0x177>
+      if(c == 'd'){
+    4650:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    4654:	75 1e                	jne    4674 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    4656:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4659:	8b 00                	mov    (%eax),%eax
+    465b:	6a 01                	push   $0x1
+    465d:	6a 0a                	push   $0xa
+    465f:	50                   	push   %eax
+    4660:	ff 75 08             	push   0x8(%ebp)
+    4663:	e8 c3 fe ff ff       	call   452b <printint>
+    4668:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    466b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    466f:	e9 d8 00 00 00       	jmp    474c <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    4674:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    4678:	74 06                	je     4680 <printf+0xa4>
+    467a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    467e:	75 1e                	jne    469e <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    4680:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    4683:	8b 00                	mov    (%eax),%eax
+    4685:	6a 00                	push   $0x0
+    4687:	6a 10                	push   $0x10
+    4689:	50                   	push   %eax
+    468a:	ff 75 08             	push   0x8(%ebp)
+    468d:	e8 99 fe ff ff       	call   452b <printint>
+    4692:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4695:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4699:	e9 ae 00 00 00       	jmp    474c <printf+0x170>
+      } else if(c == 's'){
+    469e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    46a2:	75 43                	jne    46e7 <printf+0x10b>
+        s = (char*)*ap;
+    46a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    46a7:	8b 00                	mov    (%eax),%eax
+    46a9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    46ac:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    46b0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    46b4:	75 25                	jne    46db <printf+0xff>
+          s = "(null)";
+    46b6:	c7 45 f4 3e 64 00 00 	movl   $0x643e,-0xc(%ebp)
+        while(*s != 0){
+    46bd:	eb 1c                	jmp    46db <printf+0xff>
+          putc(fd, *s);
+    46bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    46c2:	0f b6 00             	movzbl (%eax),%eax
+    46c5:	0f be c0             	movsbl %al,%eax
+    46c8:	83 ec 08             	sub    $0x8,%esp
+    46cb:	50                   	push   %eax
+    46cc:	ff 75 08             	push   0x8(%ebp)
+    46cf:	e8 34 fe ff ff       	call   4508 <putc>
+    46d4:	83 c4 10             	add    $0x10,%esp
+          s++;
+    46d7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    46db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    46de:	0f b6 00             	movzbl (%eax),%eax
+    46e1:	84 c0                	test   %al,%al
+    46e3:	75 da                	jne    46bf <printf+0xe3>
+    46e5:	eb 65                	jmp    474c <printf+0x170>
+        }
+      } else if(c == 'c'){
+    46e7:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    46eb:	75 1d                	jne    470a <printf+0x12e>
+        putc(fd, *ap);
+    46ed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    46f0:	8b 00                	mov    (%eax),%eax
+    46f2:	0f be c0             	movsbl %al,%eax
+    46f5:	83 ec 08             	sub    $0x8,%esp
+    46f8:	50                   	push   %eax
+    46f9:	ff 75 08             	push   0x8(%ebp)
+    46fc:	e8 07 fe ff ff       	call   4508 <putc>
+    4701:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    4704:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    4708:	eb 42                	jmp    474c <printf+0x170>
+      } else if(c == '%'){
+    470a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    470e:	75 17                	jne    4727 <printf+0x14b>
+        putc(fd, c);
+    4710:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4713:	0f be c0             	movsbl %al,%eax
+    4716:	83 ec 08             	sub    $0x8,%esp
+    4719:	50                   	push   %eax
+    471a:	ff 75 08             	push   0x8(%ebp)
+    471d:	e8 e6 fd ff ff       	call   4508 <putc>
+    4722:	83 c4 10             	add    $0x10,%esp
+    4725:	eb 25                	jmp    474c <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    4727:	83 ec 08             	sub    $0x8,%esp
+    472a:	6a 25                	push   $0x25
+    472c:	ff 75 08             	push   0x8(%ebp)
+    472f:	e8 d4 fd ff ff       	call   4508 <putc>
+    4734:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    4737:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    473a:	0f be c0             	movsbl %al,%eax
+    473d:	83 ec 08             	sub    $0x8,%esp
+    4740:	50                   	push   %eax
+    4741:	ff 75 08             	push   0x8(%ebp)
+    4744:	e8 bf fd ff ff       	call   4508 <putc>
+    4749:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    474c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    4753:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4757:	8b 55 0c             	mov    0xc(%ebp),%edx
+    475a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    475d:	01 d0                	add    %edx,%eax
+    475f:	0f b6 00             	movzbl (%eax),%eax
+    4762:	84 c0                	test   %al,%al
+    4764:	0f 85 94 fe ff ff    	jne    45fe <printf+0x22>
+    }
+  }
+}
+    476a:	90                   	nop
+    476b:	90                   	nop
+    476c:	c9                   	leave
+    476d:	c3                   	ret
+
+0000476e <carve>:
+
+// Take size bytes off the top of the heap, growing it first
+// if necessary.
+static Block*
+carve(uint size)
+{
+    476e:	55                   	push   %ebp
+    476f:	89 e5                	mov    %esp,%ebp
+    4771:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  char *p;
+  uint n;
+
+  if(limit - top < size){
+    4774:	8b 15 08 b4 00 00    	mov    0xb408,%edx
+    477a:	a1 04 b4 00 00       	mov    0xb404,%eax
+    477f:	29 c2                	sub    %eax,%edx
+    4781:	89 d0                	mov    %edx,%eax
+    4783:	3b 45 08             	cmp    0x8(%ebp),%eax
+    4786:	0f 83 ed 00 00 00    	jae    4879 <carve+0x10b>
+    n = size > growsz ? size : growsz;
+    478c:	a1 04 6c 00 00       	mov    0x6c04,%eax
+    4791:	8b 55 08             	mov    0x8(%ebp),%edx
+    4794:	39 c2                	cmp    %eax,%edx
+    4796:	0f 43 c2             	cmovae %edx,%eax
+    4799:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    n = (n + 4095) & ~4095;
+    479c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    479f:	05 ff 0f 00 00       	add    $0xfff,%eax
+    47a4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    47a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(growsz < MAXGROW)
+    47ac:	a1 04 6c 00 00       	mov    0x6c04,%eax
+    47b1:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+    47b6:	77 0c                	ja     47c4 <carve+0x56>
+      growsz *= 2;
+    47b8:	a1 04 6c 00 00       	mov    0x6c04,%eax
+    47bd:	01 c0                	add    %eax,%eax
+    47bf:	a3 04 6c 00 00       	mov    %eax,0x6c04
+    p = sbrk(n);
+    47c4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    47c7:	83 ec 0c             	sub    $0xc,%esp
+    47ca:	50                   	push   %eax
+    47cb:	e8 90 fc ff ff       	call   4460 <sbrk>
+    47d0:	83 c4 10             	add    $0x10,%esp
+    47d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p == (char*)-1 && n > size){
+    47d6:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    47da:	75 2a                	jne    4806 <carve+0x98>
+    47dc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    47df:	39 45 08             	cmp    %eax,0x8(%ebp)
+    47e2:	73 22                	jae    4806 <carve+0x98>
+      // Near the memory limit: ask for just enough.
+      n = (size + 4095) & ~4095;
+    47e4:	8b 45 08             	mov    0x8(%ebp),%eax
+    47e7:	05 ff 0f 00 00       	add    $0xfff,%eax
+    47ec:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    47f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+      p = sbrk(n);
+    47f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    47f7:	83 ec 0c             	sub    $0xc,%esp
+    47fa:	50                   	push   %eax
+    47fb:	e8 60 fc ff ff       	call   4460 <sbrk>
+    4800:	83 c4 10             	add    $0x10,%esp
+    4803:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    }
+    if(p == (char*)-1)
+    4806:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    480a:	75 0a                	jne    4816 <carve+0xa8>
+      return 0;
+    480c:	b8 00 00 00 00       	mov    $0x0,%eax
+    4811:	e9 86 00 00 00       	jmp    489c <carve+0x12e>
+    if(p != limit){
+    4816:	a1 08 b4 00 00       	mov    0xb408,%eax
+    481b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    481e:	74 4c                	je     486c <carve+0xfe>
+      // Somebody else moved the break: keep the old tail
+      // as a free large block and start over at p.
+      if(limit - top >= MINBLOCK){
+    4820:	8b 15 08 b4 00 00    	mov    0xb408,%edx
+    4826:	a1 04 b4 00 00       	mov    0xb404,%eax
+    482b:	29 c2                	sub    %eax,%edx
+    482d:	83 fa 0f             	cmp    $0xf,%edx
+    4830:	7e 32                	jle    4864 <carve+0xf6>
+        b = (Block*)top;
+    4832:	a1 04 b4 00 00       	mov    0xb404,%eax
+    4837:	89 45 ec             	mov    %eax,-0x14(%ebp)
+        b->h.size = limit - top;
+    483a:	8b 15 08 b4 00 00    	mov    0xb408,%edx
+    4840:	a1 04 b4 00 00       	mov    0xb404,%eax
+    4845:	29 c2                	sub    %eax,%edx
+    4847:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    484a:	89 10                	mov    %edx,(%eax)
+        b->h.bin = LARGE;
+    484c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    484f:	c7 40 04 08 00 00 00 	movl   $0x8,0x4(%eax)
+        lfree(b);
+    4856:	83 ec 0c             	sub    $0xc,%esp
+    4859:	ff 75 ec             	push   -0x14(%ebp)
+    485c:	e8 3d 00 00 00       	call   489e <lfree>
+    4861:	83 c4 10             	add    $0x10,%esp
+      }
+      top = p;
+    4864:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4867:	a3 04 b4 00 00       	mov    %eax,0xb404
+    }
+    limit = p + n;
+    486c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    486f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4872:	01 d0                	add    %edx,%eax
+    4874:	a3 08 b4 00 00       	mov    %eax,0xb408
+  }
+  b = (Block*)top;
+    4879:	a1 04 b4 00 00       	mov    0xb404,%eax
+    487e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  top += size;
+    4881:	8b 15 04 b4 00 00    	mov    0xb404,%edx
+    4887:	8b 45 08             	mov    0x8(%ebp),%eax
+    488a:	01 d0                	add    %edx,%eax
+    488c:	a3 04 b4 00 00       	mov    %eax,0xb404
+  b->h.size = size;
+    4891:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4894:	8b 55 08             	mov    0x8(%ebp),%edx
+    4897:	89 10                	mov    %edx,(%eax)
+  return b;
+    4899:	8b 45 ec             	mov    -0x14(%ebp),%eax
+}
+    489c:	c9                   	leave
+    489d:	c3                   	ret
+
+0000489e <lfree>:
+
+static void
+lfree(Block *b)
+{
+    489e:	55                   	push   %ebp
+    489f:	89 e5                	mov    %esp,%ebp
+    48a1:	83 ec 10             	sub    $0x10,%esp
+  Block *p, *prev;
+
+  prev = 0;
+    48a4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+    48ab:	a1 00 b4 00 00       	mov    0xb400,%eax
+    48b0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    48b3:	eb 0f                	jmp    48c4 <lfree+0x26>
+    prev = p;
+    48b5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48b8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = large; p && p < b; p = p->next)
+    48bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48be:	8b 40 08             	mov    0x8(%eax),%eax
+    48c1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    48c4:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    48c8:	74 08                	je     48d2 <lfree+0x34>
+    48ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48cd:	3b 45 08             	cmp    0x8(%ebp),%eax
+    48d0:	72 e3                	jb     48b5 <lfree+0x17>
+  b->next = p;
+    48d2:	8b 45 08             	mov    0x8(%ebp),%eax
+    48d5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    48d8:	89 50 08             	mov    %edx,0x8(%eax)
+  if(p && (char*)b + b->h.size == (char*)p){
+    48db:	83 7d fc 00          	cmpl   $0x0,-0x4(%ebp)
+    48df:	74 2c                	je     490d <lfree+0x6f>
+    48e1:	8b 45 08             	mov    0x8(%ebp),%eax
+    48e4:	8b 10                	mov    (%eax),%edx
+    48e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    48e9:	01 d0                	add    %edx,%eax
+    48eb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    48ee:	75 1d                	jne    490d <lfree+0x6f>
+    b->h.size += p->h.size;
+    48f0:	8b 45 08             	mov    0x8(%ebp),%eax
+    48f3:	8b 10                	mov    (%eax),%edx
+    48f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    48f8:	8b 00                	mov    (%eax),%eax
+    48fa:	01 c2                	add    %eax,%edx
+    48fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    48ff:	89 10                	mov    %edx,(%eax)
+    b->next = p->next;
+    4901:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4904:	8b 50 08             	mov    0x8(%eax),%edx
+    4907:	8b 45 08             	mov    0x8(%ebp),%eax
+    490a:	89 50 08             	mov    %edx,0x8(%eax)
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    490d:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+    4911:	74 2e                	je     4941 <lfree+0xa3>
+    4913:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4916:	8b 10                	mov    (%eax),%edx
+    4918:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    491b:	01 d0                	add    %edx,%eax
+    491d:	39 45 08             	cmp    %eax,0x8(%ebp)
+    4920:	75 1f                	jne    4941 <lfree+0xa3>
+    prev->h.size += b->h.size;
+    4922:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4925:	8b 10                	mov    (%eax),%edx
+    4927:	8b 45 08             	mov    0x8(%ebp),%eax
+    492a:	8b 00                	mov    (%eax),%eax
+    492c:	01 c2                	add    %eax,%edx
+    492e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4931:	89 10                	mov    %edx,(%eax)
+    prev->next = b->next;
+    4933:	8b 45 08             	mov    0x8(%ebp),%eax
+    4936:	8b 50 08             	mov    0x8(%eax),%edx
+    4939:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    493c:	89 50 08             	mov    %edx,0x8(%eax)
+  } else if(prev)
+    prev->next = b;
+  else
+    large = b;
+}
+    493f:	eb 19                	jmp    495a <lfree+0xbc>
+  } else if(prev)
+    4941:	83 7d f8 00          	cmpl   $0x0,-0x8(%ebp)
+    4945:	74 0b                	je     4952 <lfree+0xb4>
+    prev->next = b;
+    4947:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    494a:	8b 55 08             	mov    0x8(%ebp),%edx
+    494d:	89 50 08             	mov    %edx,0x8(%eax)
+}
+    4950:	eb 08                	jmp    495a <lfree+0xbc>
+    large = b;
+    4952:	8b 45 08             	mov    0x8(%ebp),%eax
+    4955:	a3 00 b4 00 00       	mov    %eax,0xb400
+}
+    495a:	90                   	nop
+    495b:	c9                   	leave
+    495c:	c3                   	ret
+
+0000495d <lalloc>:
+
+static Block*
+lalloc(uint size)
+{
+    495d:	55                   	push   %ebp
+    495e:	89 e5                	mov    %esp,%ebp
+    4960:	83 ec 18             	sub    $0x18,%esp
+  Block *p, **pp;
+
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+    4963:	c7 45 f0 00 b4 00 00 	movl   $0xb400,-0x10(%ebp)
+    496a:	eb 52                	jmp    49be <lalloc+0x61>
+    if(p->h.size < size)
+    496c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    496f:	8b 00                	mov    (%eax),%eax
+    4971:	3b 45 08             	cmp    0x8(%ebp),%eax
+    4974:	72 3e                	jb     49b4 <lalloc+0x57>
+      continue;
+    if(p->h.size - size >= MINBLOCK){
+    4976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4979:	8b 00                	mov    (%eax),%eax
+    497b:	2b 45 08             	sub    0x8(%ebp),%eax
+    497e:	83 f8 0f             	cmp    $0xf,%eax
+    4981:	76 21                	jbe    49a4 <lalloc+0x47>
+      // Hand out the tail; the head stays on the list.
+      p->h.size -= size;
+    4983:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4986:	8b 00                	mov    (%eax),%eax
+    4988:	2b 45 08             	sub    0x8(%ebp),%eax
+    498b:	89 c2                	mov    %eax,%edx
+    498d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4990:	89 10                	mov    %edx,(%eax)
+      p = (Block*)((char*)p + p->h.size);
+    4992:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4995:	8b 00                	mov    (%eax),%eax
+    4997:	01 45 f4             	add    %eax,-0xc(%ebp)
+      p->h.size = size;
+    499a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    499d:	8b 55 08             	mov    0x8(%ebp),%edx
+    49a0:	89 10                	mov    %edx,(%eax)
+    49a2:	eb 0b                	jmp    49af <lalloc+0x52>
+    } else
+      *pp = p->next;
+    49a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    49a7:	8b 50 08             	mov    0x8(%eax),%edx
+    49aa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    49ad:	89 10                	mov    %edx,(%eax)
+    return p;
+    49af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    49b2:	eb 26                	jmp    49da <lalloc+0x7d>
+      continue;
+    49b4:	90                   	nop
+  for(pp = &large; (p = *pp) != 0; pp = &p->next){
+    49b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    49b8:	83 c0 08             	add    $0x8,%eax
+    49bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    49be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    49c1:	8b 00                	mov    (%eax),%eax
+    49c3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    49c6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    49ca:	75 a0                	jne    496c <lalloc+0xf>
+  }
+  return carve(size);
+    49cc:	83 ec 0c             	sub    $0xc,%esp
+    49cf:	ff 75 08             	push   0x8(%ebp)
+    49d2:	e8 97 fd ff ff       	call   476e <carve>
+    49d7:	83 c4 10             	add    $0x10,%esp
+}
+    49da:	c9                   	leave
+    49db:	c3                   	ret
+
+000049dc <free>:
+
+void
+free(void *ap)
+{
+    49dc:	55                   	push   %ebp
+    49dd:	89 e5                	mov    %esp,%ebp
+    49df:	83 ec 10             	sub    $0x10,%esp
+  Block *b;
+
+  if(ap == 0)
+    49e2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    49e6:	74 46                	je     4a2e <free+0x52>
+    return;
+  b = (Block*)((Header*)ap - 1);
+    49e8:	8b 45 08             	mov    0x8(%ebp),%eax
+    49eb:	83 e8 08             	sub    $0x8,%eax
+    49ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  if(b->h.bin < NBIN){
+    49f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49f4:	8b 40 04             	mov    0x4(%eax),%eax
+    49f7:	83 f8 07             	cmp    $0x7,%eax
+    49fa:	77 25                	ja     4a21 <free+0x45>
+    b->next = bins[b->h.bin];
+    49fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    49ff:	8b 40 04             	mov    0x4(%eax),%eax
+    4a02:	8b 14 85 e0 b3 00 00 	mov    0xb3e0(,%eax,4),%edx
+    4a09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4a0c:	89 50 08             	mov    %edx,0x8(%eax)
+    bins[b->h.bin] = b;
+    4a0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4a12:	8b 40 04             	mov    0x4(%eax),%eax
+    4a15:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4a18:	89 14 85 e0 b3 00 00 	mov    %edx,0xb3e0(,%eax,4)
+    4a1f:	eb 0e                	jmp    4a2f <free+0x53>
+  } else
+    lfree(b);
+    4a21:	ff 75 fc             	push   -0x4(%ebp)
+    4a24:	e8 75 fe ff ff       	call   489e <lfree>
+    4a29:	83 c4 04             	add    $0x4,%esp
+    4a2c:	eb 01                	jmp    4a2f <free+0x53>
+    return;
+    4a2e:	90                   	nop
+}
+    4a2f:	c9                   	leave
+    4a30:	c3                   	ret
+
+00004a31 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    4a31:	55                   	push   %ebp
+    4a32:	89 e5                	mov    %esp,%ebp
+    4a34:	83 ec 18             	sub    $0x18,%esp
+  Block *b;
+  uint size, bin;
+
+  size = nbytes + sizeof(Header);
+    4a37:	8b 45 08             	mov    0x8(%ebp),%eax
+    4a3a:	83 c0 08             	add    $0x8,%eax
+    4a3d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(size < nbytes)
+    4a40:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4a43:	3b 45 08             	cmp    0x8(%ebp),%eax
+    4a46:	73 0a                	jae    4a52 <malloc+0x21>
+    return 0;
+    4a48:	b8 00 00 00 00       	mov    $0x0,%eax
+    4a4d:	e9 b8 00 00 00       	jmp    4b0a <malloc+0xd9>
+  if(size <= MAXSMALL){
+    4a52:	81 7d ec 00 08 00 00 	cmpl   $0x800,-0x14(%ebp)
+    4a59:	77 6f                	ja     4aca <malloc+0x99>
+    for(bin = 0; (MINBLOCK << bin) < size; bin++)
+    4a5b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4a62:	eb 04                	jmp    4a68 <malloc+0x37>
+    4a64:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4a68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a6b:	ba 10 00 00 00       	mov    $0x10,%edx
+    4a70:	89 c1                	mov    %eax,%ecx
+    4a72:	d3 e2                	shl    %cl,%edx
+    4a74:	89 d0                	mov    %edx,%eax
+    4a76:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    4a79:	72 e9                	jb     4a64 <malloc+0x33>
+      ;
+    if((b = bins[bin]) != 0)
+    4a7b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a7e:	8b 04 85 e0 b3 00 00 	mov    0xb3e0(,%eax,4),%eax
+    4a85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4a88:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4a8c:	74 12                	je     4aa0 <malloc+0x6f>
+      bins[bin] = b->next;
+    4a8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4a91:	8b 50 08             	mov    0x8(%eax),%edx
+    4a94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4a97:	89 14 85 e0 b3 00 00 	mov    %edx,0xb3e0(,%eax,4)
+    4a9e:	eb 5b                	jmp    4afb <malloc+0xca>
+    else if((b = carve(MINBLOCK << bin)) == 0)
+    4aa0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4aa3:	ba 10 00 00 00       	mov    $0x10,%edx
+    4aa8:	89 c1                	mov    %eax,%ecx
+    4aaa:	d3 e2                	shl    %cl,%edx
+    4aac:	89 d0                	mov    %edx,%eax
+    4aae:	83 ec 0c             	sub    $0xc,%esp
+    4ab1:	50                   	push   %eax
+    4ab2:	e8 b7 fc ff ff       	call   476e <carve>
+    4ab7:	83 c4 10             	add    $0x10,%esp
+    4aba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4abd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4ac1:	75 38                	jne    4afb <malloc+0xca>
+      return 0;
+    4ac3:	b8 00 00 00 00       	mov    $0x0,%eax
+    4ac8:	eb 40                	jmp    4b0a <malloc+0xd9>
+  } else {
+    size = (size + sizeof(Header) - 1) & ~(sizeof(Header) - 1);
+    4aca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4acd:	83 c0 07             	add    $0x7,%eax
+    4ad0:	83 e0 f8             	and    $0xfffffff8,%eax
+    4ad3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((b = lalloc(size)) == 0)
+    4ad6:	83 ec 0c             	sub    $0xc,%esp
+    4ad9:	ff 75 ec             	push   -0x14(%ebp)
+    4adc:	e8 7c fe ff ff       	call   495d <lalloc>
+    4ae1:	83 c4 10             	add    $0x10,%esp
+    4ae4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4ae7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4aeb:	75 07                	jne    4af4 <malloc+0xc3>
+      return 0;
+    4aed:	b8 00 00 00 00       	mov    $0x0,%eax
+    4af2:	eb 16                	jmp    4b0a <malloc+0xd9>
+    bin = LARGE;
+    4af4:	c7 45 f0 08 00 00 00 	movl   $0x8,-0x10(%ebp)
+  }
+  b->h.bin = bin;
+    4afb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4afe:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    4b01:	89 50 04             	mov    %edx,0x4(%eax)
+  return (void*)(&b->h + 1);
+    4b04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4b07:	83 c0 08             	add    $0x8,%eax
+}
+    4b0a:	c9                   	leave
+    4b0b:	c3                   	ret
@@ -4,6 +4,7 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "wait.h"
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
@@ -424,6 +425,69 @@ exitwait(void)
   printf(1, "exitwait ok\n");
 }
 
+// Calls that name a process must reject pids no process has.
+void
+badpid(void)
+{
+  printf(stdout, "bad pid test\n");
+  if(kill(-1) != -1 || kill(0) != -1 || setpriority(-5, 1) != -1 ||
+     getaffinity(-1000) != -1){
+    printf(stdout, "bad pid accepted\n");
+    exit();
+  }
+  printf(stdout, "bad pid ok\n");
+}
+
+// waitpid() reaps the child asked for and leaves the others;
+// WNOHANG does not wait for a child that is still running.
+void
+waitpidtest(void)
+{
+  int pids[5], fd[2], i;
+  char c;
+
+  printf(stdout, "waitpid test\n");
+  if(pipe(fd) < 0){
+    printf(stdout, "pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 5; i++){
+    if((pids[i] = fork()) < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0){
+      close(fd[1]);
+      read(fd[0], &c, 1);
+      exit();
+    }
+  }
+  close(fd[0]);
+
+  if(waitpid(pids[2], WNOHANG) != 0){
+    printf(stdout, "waitpid WNOHANG reaped a running child\n");
+    exit();
+  }
+  if(waitpid(getpid(), 0) != -1){
+    printf(stdout, "waitpid reaped a non-child\n");
+    exit();
+  }
+  for(i = 0; i < 5; i++)
+    write(fd[1], "x", 1);
+  close(fd[1]);
+  for(i = 4; i >= 0; i--){
+    if(waitpid(pids[i], 0) != pids[i]){
+      printf(stdout, "waitpid wrong pid\n");
+      exit();
+    }
+  }
+  if(wait() != -1 || waitpid(-1, WNOHANG) != -1){
+    printf(stdout, "waitpid found a reaped child\n");
+    exit();
+  }
+  printf(stdout, "waitpid ok\n");
+}
+
 void
 mem(void)
 {
@@ -1374,8 +1438,8 @@ iref(void)
 }
 
 // test that fork fails gracefully
-// the forktest binary also does this, but it runs out of proc entries first.
-// inside the bigger usertests binary, we run out of memory first.
+// the forktest binary also does this.  there is no limit on
+// the number of processes, so fork fails when memory runs out.
 void
 forktest(void)
 {
@@ -1383,7 +1447,7 @@ forktest(void)
 
   printf(1, "fork test\n");
 
-  for(n=0; n<1000; n++){
+  for(n=0; n<100000; n++){
     pid = fork();
     if(pid < 0)
       break;
@@ -1391,8 +1455,8 @@ forktest(void)
       exit();
   }
   
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
+  if(n == 100000){
+    printf(1, "fork claimed to work 100000 times!\n");
     exit();
   }
   
@@ -1559,6 +1623,69 @@ validateint(int *p)
       "ebx");
 }
 
+// do timed sleeps last about as long as asked, and can
+// many sleepers with different deadlines share the timer?
+void
+sleeptest(void)
+{
+  int i, pid, t0, t;
+
+  printf(stdout, "sleep test\n");
+
+  t0 = uptime();
+  sleep(5);
+  if((t = uptime() - t0) < 4){
+    printf(stdout, "sleep(5) took %d ticks\n", t);
+    exit();
+  }
+
+  // 30ms is 3 ticks at 100Hz.
+  t0 = uptime();
+  if(nanosleep(0, 30000000) < 0){
+    printf(stdout, "nanosleep failed\n");
+    exit();
+  }
+  if((t = uptime() - t0) < 2){
+    printf(stdout, "nanosleep 30ms took %d ticks\n", t);
+    exit();
+  }
+  if(nanosleep(0, 1000000000) != -1 || nanosleep(-1, 0) != -1){
+    printf(stdout, "nanosleep accepted a bad time\n");
+    exit();
+  }
+
+  t0 = uptime();
+  for(i = 0; i < 10; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      nanosleep(0, (i+1) * 3000000);
+      exit();
+    }
+  }
+  for(i = 0; i < 10; i++)
+    wait();
+  if((t = uptime() - t0) > 100){
+    printf(stdout, "sleepers took %d ticks\n", t);
+    exit();
+  }
+
+  // a killed sleeper must not wait for its deadline
+  pid = fork();
+  if(pid == 0){
+    sleep(100000);
+    exit();
+  }
+  sleep(1);
+  kill(pid);
+  wait();
+
+  printf(stdout, "sleep test ok\n");
+}
+
 void
 validatetest(void)
 {
@@ -1740,6 +1867,9 @@ main(int argc, char *argv[])
   pipe1();
   preempt();
   exitwait();
+  waitpidtest();
+  badpid();
+  sleeptest();
 
   rmdot();
   fourteen();
@@ -0,0 +1,144 @@
+// Threads on top of clone(), and locks for them on top of
+// futexes.  Each thread gets a one-page stack from malloc(); its
+// start routine and argument live at the bottom of that page,
+// below anything the thread pushes.  Only the creating thread may
+// join a thread, and malloc() is not thread-safe, so threads
+// should be created and joined from one thread.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+
+#define TSTACK  4096  // PGSIZE, as clone() expects
+#define NTHREAD 64
+
+struct tstart {
+  void (*fn)(void*);
+  void *arg;
+};
+
+static struct {
+  int tid;
+  void *stack;
+} threads[NTHREAD];
+
+static void
+threadstart(void *a)
+{
+  struct tstart *t;
+
+  t = a;
+  t->fn(t->arg);
+  exit();
+}
+
+// Start fn(arg) in a new thread and return its id, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  struct tstart *t;
+  int i, tid;
+
+  for(i = 0; i < NTHREAD && threads[i].stack; i++)
+    ;
+  if(i == NTHREAD || (t = malloc(TSTACK)) == 0)
+    return -1;
+  t->fn = fn;
+  t->arg = arg;
+  if((tid = clone(threadstart, t, t)) < 0){
+    free(t);
+    return -1;
+  }
+  threads[i].tid = tid;
+  threads[i].stack = t;
+  return tid;
+}
+
+// Wait for thread tid to finish and free its stack.
+// Return tid, or -1 if it is not a thread we created.
+int
+thread_join(int tid)
+{
+  int i;
+
+  for(i = 0; i < NTHREAD; i++){
+    if(threads[i].stack && threads[i].tid == tid){
+      if(waitpid(tid, 0) != tid)
+        return -1;
+      free(threads[i].stack);
+      threads[i].stack = 0;
+      return tid;
+    }
+  }
+  return -1;
+}
+
+// Mutexes and condition variables on futexes.  Neither
+// enters the kernel unless a thread has to wait.
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    return;
+  // Mark the mutex contended, so the holder's unlock wakes us.
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futexwait(&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    m->state = 0;
+    futexwake(&m->state, 1);
+  }
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Release m and wait for a signal, then take m again.
+// Like any condition variable, it may return spuriously.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futexwait(&c->seq, seq);
+  // Others may be waiting on m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    futexwait(&m->state, 2);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futexwake(&c->seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futexwake(&c->seq, -1);
+}
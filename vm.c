@@ -4,6 +4,7 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
 
@@ -54,10 +55,9 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
         pgtab = (pte_t *) p2v(PTE_ADDR(*pde));
     } else
     {
-        if (!alloc || (pgtab = (pte_t *) kalloc()) == 0)
+        // kalloc_zeroed() makes sure all those PTE_P bits are zero.
+        if (!alloc || (pgtab = (pte_t *) kalloc_zeroed()) == 0)
             return 0;
-        // Make sure all those PTE_P bits are zero.
-        memset(pgtab, 0, PGSIZE);
         // The permissions here are overly generous, but they can
         // be further restricted by the permissions in the page table
         // entries, if necessary.
@@ -141,9 +141,8 @@ setupkvm(void)
     pde_t *pgdir;
     struct kmap *k;
 
-    if ((pgdir = (pde_t *) kalloc()) == 0)
+    if ((pgdir = (pde_t *) kalloc_zeroed()) == 0)
         return 0;
-    memset(pgdir, 0, PGSIZE);
     if (p2v(PHYSTOP) > (void *) DEVSPACE)
         panic("PHYSTOP too high");
     for (k = kmap; k < &kmap[NELEM(kmap)];
@@ -196,8 +195,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
     if (sz >= PGSIZE)
         panic("inituvm: more than a page");
-    mem = kalloc();
-    memset(mem, 0, PGSIZE);
+    mem = kalloc_zeroed();
     mappages(pgdir, 0, PGSIZE, v2p(mem), PTE_W | PTE_U);
     memmove(mem, init, sz);
 }
@@ -243,14 +241,13 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
     a = PGROUNDUP(oldsz);
     for (; a < newsz; a += PGSIZE)
     {
-        mem = kalloc();
+        mem = kalloc_zeroed();
         if (mem == 0)
         {
             cprintf("allocuvm out of memory\n");
             deallocuvm(pgdir, newsz, oldsz);
             return 0;
         }
-        memset(mem, 0, PGSIZE);
         mappages(pgdir, (char *) a, PGSIZE, v2p(mem), PTE_W | PTE_U);
     }
     return newsz;
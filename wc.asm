@@ -0,0 +1,1130 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 60 0a 00 00       	add    $0xa60,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 60 0a 00 00       	add    $0xa60,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 db 07 00 00       	push   $0x7db
+  59:	e8 35 02 00 00       	call   293 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 60 0a 00 00       	push   $0xa60
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 bd 03 00 00       	call   45d <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 e1 07 00 00       	push   $0x7e1
+  be:	6a 01                	push   $0x1
+  c0:	e8 84 05 00 00       	call   649 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 78 03 00 00       	call   445 <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 f1 07 00 00       	push   $0x7f1
+  e1:	6a 01                	push   $0x1
+  e3:	e8 61 05 00 00       	call   649 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 fe 07 00 00       	push   $0x7fe
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 27 03 00 00       	call   445 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 3f 03 00 00       	call   485 <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 ff 07 00 00       	push   $0x7ff
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 d6 04 00 00       	call   649 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 ca 02 00 00       	call   445 <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 c7 02 00 00       	call   46d <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 88 02 00 00       	call   445 <exit>
+
+000001bd <stosb>:
+               "cc");
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+  asm volatile("cld; rep stosb" :
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+               "=D" (addr), "=c" (cnt) :
+               "0" (addr), "1" (cnt), "a" (data) :
+               "memory", "cc");
+}
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, char *t)
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+  char *os;
+
+  os = s;
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1ef:	90                   	nop
+ 1f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1f3:	8d 42 01             	lea    0x1(%edx),%eax
+ 1f6:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fc:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ff:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 202:	0f b6 12             	movzbl (%edx),%edx
+ 205:	88 10                	mov    %dl,(%eax)
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	84 c0                	test   %al,%al
+ 20c:	75 e2                	jne    1f0 <strcpy+0xd>
+    ;
+  return os;
+ 20e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 211:	c9                   	leave
+ 212:	c3                   	ret
+
+00000213 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 213:	55                   	push   %ebp
+ 214:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 216:	eb 08                	jmp    220 <strcmp+0xd>
+    p++, q++;
+ 218:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 21c:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 220:	8b 45 08             	mov    0x8(%ebp),%eax
+ 223:	0f b6 00             	movzbl (%eax),%eax
+ 226:	84 c0                	test   %al,%al
+ 228:	74 10                	je     23a <strcmp+0x27>
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 22d:	0f b6 10             	movzbl (%eax),%edx
+ 230:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 233:	0f b6 00             	movzbl (%eax),%eax
+ 236:	38 c2                	cmp    %al,%dl
+ 238:	74 de                	je     218 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 23a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23d:	0f b6 00             	movzbl (%eax),%eax
+ 240:	0f b6 d0             	movzbl %al,%edx
+ 243:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 246:	0f b6 00             	movzbl (%eax),%eax
+ 249:	0f b6 c0             	movzbl %al,%eax
+ 24c:	29 c2                	sub    %eax,%edx
+ 24e:	89 d0                	mov    %edx,%eax
+}
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+
+00000252 <strlen>:
+
+uint
+strlen(char *s)
+{
+ 252:	55                   	push   %ebp
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 258:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 25f:	eb 04                	jmp    265 <strlen+0x13>
+ 261:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 265:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 268:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26b:	01 d0                	add    %edx,%eax
+ 26d:	0f b6 00             	movzbl (%eax),%eax
+ 270:	84 c0                	test   %al,%al
+ 272:	75 ed                	jne    261 <strlen+0xf>
+    ;
+  return n;
+ 274:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 277:	c9                   	leave
+ 278:	c3                   	ret
+
+00000279 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 279:	55                   	push   %ebp
+ 27a:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 27c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 27f:	50                   	push   %eax
+ 280:	ff 75 0c             	push   0xc(%ebp)
+ 283:	ff 75 08             	push   0x8(%ebp)
+ 286:	e8 32 ff ff ff       	call   1bd <stosb>
+ 28b:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 28e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 291:	c9                   	leave
+ 292:	c3                   	ret
+
+00000293 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	83 ec 04             	sub    $0x4,%esp
+ 299:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29c:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 29f:	eb 14                	jmp    2b5 <strchr+0x22>
+    if(*s == c)
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 00             	movzbl (%eax),%eax
+ 2a7:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2aa:	75 05                	jne    2b1 <strchr+0x1e>
+      return (char*)s;
+ 2ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2af:	eb 13                	jmp    2c4 <strchr+0x31>
+  for(; *s; s++)
+ 2b1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b8:	0f b6 00             	movzbl (%eax),%eax
+ 2bb:	84 c0                	test   %al,%al
+ 2bd:	75 e2                	jne    2a1 <strchr+0xe>
+  return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	c9                   	leave
+ 2c5:	c3                   	ret
+
+000002c6 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c6:	55                   	push   %ebp
+ 2c7:	89 e5                	mov    %esp,%ebp
+ 2c9:	83 ec 18             	sub    $0x18,%esp
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2cc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2d3:	eb 42                	jmp    317 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2d5:	83 ec 04             	sub    $0x4,%esp
+ 2d8:	6a 01                	push   $0x1
+ 2da:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2dd:	50                   	push   %eax
+ 2de:	6a 00                	push   $0x0
+ 2e0:	e8 78 01 00 00       	call   45d <read>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2eb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2ef:	7e 33                	jle    324 <gets+0x5e>
+      break;
+    buf[i++] = c;
+ 2f1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2f7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2fa:	89 c2                	mov    %eax,%edx
+ 2fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ff:	01 c2                	add    %eax,%edx
+ 301:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 305:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 307:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 30b:	3c 0a                	cmp    $0xa,%al
+ 30d:	74 16                	je     325 <gets+0x5f>
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0e                	je     325 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	83 c0 01             	add    $0x1,%eax
+ 31d:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 320:	7f b3                	jg     2d5 <gets+0xf>
+ 322:	eb 01                	jmp    325 <gets+0x5f>
+      break;
+ 324:	90                   	nop
+      break;
+  }
+  buf[i] = '\0';
+ 325:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	01 d0                	add    %edx,%eax
+ 32d:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 330:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+
+00000335 <stat>:
+
+int
+stat(char *n, struct stat *st)
+{
+ 335:	55                   	push   %ebp
+ 336:	89 e5                	mov    %esp,%ebp
+ 338:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 33b:	83 ec 08             	sub    $0x8,%esp
+ 33e:	6a 00                	push   $0x0
+ 340:	ff 75 08             	push   0x8(%ebp)
+ 343:	e8 3d 01 00 00       	call   485 <open>
+ 348:	83 c4 10             	add    $0x10,%esp
+ 34b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 34e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 352:	79 07                	jns    35b <stat+0x26>
+    return -1;
+ 354:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 359:	eb 25                	jmp    380 <stat+0x4b>
+  r = fstat(fd, st);
+ 35b:	83 ec 08             	sub    $0x8,%esp
+ 35e:	ff 75 0c             	push   0xc(%ebp)
+ 361:	ff 75 f4             	push   -0xc(%ebp)
+ 364:	e8 34 01 00 00       	call   49d <fstat>
+ 369:	83 c4 10             	add    $0x10,%esp
+ 36c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 36f:	83 ec 0c             	sub    $0xc,%esp
+ 372:	ff 75 f4             	push   -0xc(%ebp)
+ 375:	e8 f3 00 00 00       	call   46d <close>
+ 37a:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 37d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+  int n;
+
+  n = 0;
+ 388:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 38f:	eb 25                	jmp    3b6 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 391:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 394:	89 d0                	mov    %edx,%eax
+ 396:	c1 e0 02             	shl    $0x2,%eax
+ 399:	01 d0                	add    %edx,%eax
+ 39b:	01 c0                	add    %eax,%eax
+ 39d:	89 c1                	mov    %eax,%ecx
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	8d 50 01             	lea    0x1(%eax),%edx
+ 3a5:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3a8:	0f b6 00             	movzbl (%eax),%eax
+ 3ab:	0f be c0             	movsbl %al,%eax
+ 3ae:	01 c8                	add    %ecx,%eax
+ 3b0:	83 e8 30             	sub    $0x30,%eax
+ 3b3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b9:	0f b6 00             	movzbl (%eax),%eax
+ 3bc:	3c 2f                	cmp    $0x2f,%al
+ 3be:	7e 0a                	jle    3ca <atoi+0x48>
+ 3c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c3:	0f b6 00             	movzbl (%eax),%eax
+ 3c6:	3c 39                	cmp    $0x39,%al
+ 3c8:	7e c7                	jle    391 <atoi+0xf>
+  return n;
+ 3ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3cd:	c9                   	leave
+ 3ce:	c3                   	ret
+
+000003cf <memmove>:
+
+void*
+memmove(void *vdst, void *vsrc, int n)
+{
+ 3cf:	55                   	push   %ebp
+ 3d0:	89 e5                	mov    %esp,%ebp
+ 3d2:	83 ec 10             	sub    $0x10,%esp
+  char *dst, *src;
+  
+  dst = vdst;
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3db:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3e1:	eb 17                	jmp    3fa <memmove+0x2b>
+    *dst++ = *src++;
+ 3e3:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3e6:	8d 42 01             	lea    0x1(%edx),%eax
+ 3e9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ec:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3ef:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3f2:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3f5:	0f b6 12             	movzbl (%edx),%edx
+ 3f8:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3fa:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3fd:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 400:	89 55 10             	mov    %edx,0x10(%ebp)
+ 403:	85 c0                	test   %eax,%eax
+ 405:	7f dc                	jg     3e3 <memmove+0x14>
+  return vdst;
+ 407:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+
+0000040c <uptimeus>:
+
+// Microseconds since boot, for timing.
+// Wraps around after about 71 minutes.
+uint
+uptimeus(void)
+{
+ 40c:	55                   	push   %ebp
+ 40d:	89 e5                	mov    %esp,%ebp
+ 40f:	83 ec 18             	sub    $0x18,%esp
+  struct timespec ts;
+
+  nanouptime(&ts);
+ 412:	83 ec 0c             	sub    $0xc,%esp
+ 415:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ 418:	50                   	push   %eax
+ 419:	e8 ff 00 00 00       	call   51d <nanouptime>
+ 41e:	83 c4 10             	add    $0x10,%esp
+  return ts.sec * 1000000 + ts.nsec / 1000;
+ 421:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 424:	69 c8 40 42 0f 00    	imul   $0xf4240,%eax,%ecx
+ 42a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 42d:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+ 432:	f7 e2                	mul    %edx
+ 434:	89 d0                	mov    %edx,%eax
+ 436:	c1 e8 06             	shr    $0x6,%eax
+ 439:	01 c8                	add    %ecx,%eax
+}
+ 43b:	c9                   	leave
+ 43c:	c3                   	ret
+
+0000043d <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 43d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 442:	cd 40                	int    $0x40
+ 444:	c3                   	ret
+
+00000445 <exit>:
+SYSCALL(exit)
+ 445:	b8 02 00 00 00       	mov    $0x2,%eax
+ 44a:	cd 40                	int    $0x40
+ 44c:	c3                   	ret
+
+0000044d <wait>:
+SYSCALL(wait)
+ 44d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 452:	cd 40                	int    $0x40
+ 454:	c3                   	ret
+
+00000455 <pipe>:
+SYSCALL(pipe)
+ 455:	b8 04 00 00 00       	mov    $0x4,%eax
+ 45a:	cd 40                	int    $0x40
+ 45c:	c3                   	ret
+
+0000045d <read>:
+SYSCALL(read)
+ 45d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 462:	cd 40                	int    $0x40
+ 464:	c3                   	ret
+
+00000465 <write>:
+SYSCALL(write)
+ 465:	b8 10 00 00 00       	mov    $0x10,%eax
+ 46a:	cd 40                	int    $0x40
+ 46c:	c3                   	ret
+
+0000046d <close>:
+SYSCALL(close)
+ 46d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 472:	cd 40                	int    $0x40
+ 474:	c3                   	ret
+
+00000475 <kill>:
+SYSCALL(kill)
+ 475:	b8 06 00 00 00       	mov    $0x6,%eax
+ 47a:	cd 40                	int    $0x40
+ 47c:	c3                   	ret
+
+0000047d <exec>:
+SYSCALL(exec)
+ 47d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 482:	cd 40                	int    $0x40
+ 484:	c3                   	ret
+
+00000485 <open>:
+SYSCALL(open)
+ 485:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 48a:	cd 40                	int    $0x40
+ 48c:	c3                   	ret
+
+0000048d <mknod>:
+SYSCALL(mknod)
+ 48d:	b8 11 00 00 00       	mov    $0x11,%eax
+ 492:	cd 40                	int    $0x40
+ 494:	c3                   	ret
+
+00000495 <unlink>:
+SYSCALL(unlink)
+ 495:	b8 12 00 00 00       	mov    $0x12,%eax
+ 49a:	cd 40                	int    $0x40
+ 49c:	c3                   	ret
+
+0000049d <fstat>:
+SYSCALL(fstat)
+ 49d:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4a2:	cd 40                	int    $0x40
+ 4a4:	c3                   	ret
+
+000004a5 <link>:
+SYSCALL(link)
+ 4a5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4aa:	cd 40                	int    $0x40
+ 4ac:	c3                   	ret
+
+000004ad <mkdir>:
+SYSCALL(mkdir)
+ 4ad:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4b2:	cd 40                	int    $0x40
+ 4b4:	c3                   	ret
+
+000004b5 <chdir>:
+SYSCALL(chdir)
+ 4b5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4ba:	cd 40                	int    $0x40
+ 4bc:	c3                   	ret
+
+000004bd <dup>:
+SYSCALL(dup)
+ 4bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4c2:	cd 40                	int    $0x40
+ 4c4:	c3                   	ret
+
+000004c5 <getpid>:
+SYSCALL(getpid)
+ 4c5:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4ca:	cd 40                	int    $0x40
+ 4cc:	c3                   	ret
+
+000004cd <sbrk>:
+SYSCALL(sbrk)
+ 4cd:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4d2:	cd 40                	int    $0x40
+ 4d4:	c3                   	ret
+
+000004d5 <sleep>:
+SYSCALL(sleep)
+ 4d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4da:	cd 40                	int    $0x40
+ 4dc:	c3                   	ret
+
+000004dd <uptime>:
+SYSCALL(uptime)
+ 4dd:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4e2:	cd 40                	int    $0x40
+ 4e4:	c3                   	ret
+
+000004e5 <saveProc>:
+SYSCALL(saveProc)
+ 4e5:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4ea:	cd 40                	int    $0x40
+ 4ec:	c3                   	ret
+
+000004ed <loadProc>:
+SYSCALL(loadProc)
+ 4ed:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4f2:	cd 40                	int    $0x40
+ 4f4:	c3                   	ret
+
+000004f5 <setpriority>:
+SYSCALL(setpriority)
+ 4f5:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4fa:	cd 40                	int    $0x40
+ 4fc:	c3                   	ret
+
+000004fd <setaffinity>:
+SYSCALL(setaffinity)
+ 4fd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 502:	cd 40                	int    $0x40
+ 504:	c3                   	ret
+
+00000505 <getaffinity>:
+SYSCALL(getaffinity)
+ 505:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 50a:	cd 40                	int    $0x40
+ 50c:	c3                   	ret
+
+0000050d <nanosleep>:
+SYSCALL(nanosleep)
+ 50d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 512:	cd 40                	int    $0x40
+ 514:	c3                   	ret
+
+00000515 <cpustat>:
+SYSCALL(cpustat)
+ 515:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 51a:	cd 40                	int    $0x40
+ 51c:	c3                   	ret
+
+0000051d <nanouptime>:
+SYSCALL(nanouptime)
+ 51d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 522:	cd 40                	int    $0x40
+ 524:	c3                   	ret
+
+00000525 <settickets>:
+SYSCALL(settickets)
+ 525:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 52a:	cd 40                	int    $0x40
+ 52c:	c3                   	ret
+
+0000052d <setdeadline>:
+SYSCALL(setdeadline)
+ 52d:	b8 20 00 00 00       	mov    $0x20,%eax
+ 532:	cd 40                	int    $0x40
+ 534:	c3                   	ret
+
+00000535 <rtstat>:
+SYSCALL(rtstat)
+ 535:	b8 21 00 00 00       	mov    $0x21,%eax
+ 53a:	cd 40                	int    $0x40
+ 53c:	c3                   	ret
+
+0000053d <schedstat>:
+SYSCALL(schedstat)
+ 53d:	b8 22 00 00 00       	mov    $0x22,%eax
+ 542:	cd 40                	int    $0x40
+ 544:	c3                   	ret
+
+00000545 <waitpid>:
+SYSCALL(waitpid)
+ 545:	b8 23 00 00 00       	mov    $0x23,%eax
+ 54a:	cd 40                	int    $0x40
+ 54c:	c3                   	ret
+
+0000054d <clone>:
+SYSCALL(clone)
+ 54d:	b8 24 00 00 00       	mov    $0x24,%eax
+ 552:	cd 40                	int    $0x40
+ 554:	c3                   	ret
+
+00000555 <futexwait>:
+SYSCALL(futexwait)
+ 555:	b8 25 00 00 00       	mov    $0x25,%eax
+ 55a:	cd 40                	int    $0x40
+ 55c:	c3                   	ret
+
+0000055d <futexwake>:
+SYSCALL(futexwake)
+ 55d:	b8 26 00 00 00       	mov    $0x26,%eax
+ 562:	cd 40                	int    $0x40
+ 564:	c3                   	ret
+
+00000565 <lockstat>:
+SYSCALL(lockstat)
+ 565:	b8 27 00 00 00       	mov    $0x27,%eax
+ 56a:	cd 40                	int    $0x40
+ 56c:	c3                   	ret
+
+0000056d <dcachestat>:
+SYSCALL(dcachestat)
+ 56d:	b8 28 00 00 00       	mov    $0x28,%eax
+ 572:	cd 40                	int    $0x40
+ 574:	c3                   	ret
+
+00000575 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 575:	55                   	push   %ebp
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	83 ec 18             	sub    $0x18,%esp
+ 57b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 57e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 581:	83 ec 04             	sub    $0x4,%esp
+ 584:	6a 01                	push   $0x1
+ 586:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 589:	50                   	push   %eax
+ 58a:	ff 75 08             	push   0x8(%ebp)
+ 58d:	e8 d3 fe ff ff       	call   465 <write>
+ 592:	83 c4 10             	add    $0x10,%esp
+}
+ 595:	90                   	nop
+ 596:	c9                   	leave
+ 597:	c3                   	ret
+
+00000598 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 598:	55                   	push   %ebp
+ 599:	89 e5                	mov    %esp,%ebp
+ 59b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 59e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 5a5:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 5a9:	74 17                	je     5c2 <printint+0x2a>
+ 5ab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5af:	79 11                	jns    5c2 <printint+0x2a>
+    neg = 1;
+ 5b1:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 5b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5bb:	f7 d8                	neg    %eax
+ 5bd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 5c0:	eb 06                	jmp    5c8 <printint+0x30>
+  } else {
+    x = xx;
+ 5c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5c5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 5c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 5cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5da:	f7 f1                	div    %ecx
+ 5dc:	89 d1                	mov    %edx,%ecx
+ 5de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5e1:	8d 50 01             	lea    0x1(%eax),%edx
+ 5e4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 5e7:	0f b6 91 44 0a 00 00 	movzbl 0xa44(%ecx),%edx
+ 5ee:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 5f2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 5f5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5f8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5fd:	f7 f1                	div    %ecx
+ 5ff:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 602:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 606:	75 c7                	jne    5cf <printint+0x37>
+  if(neg)
+ 608:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 60c:	74 2d                	je     63b <printint+0xa3>
+    buf[i++] = '-';
+ 60e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 611:	8d 50 01             	lea    0x1(%eax),%edx
+ 614:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 617:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 61c:	eb 1d                	jmp    63b <printint+0xa3>
+    putc(fd, buf[i]);
+ 61e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 621:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 624:	01 d0                	add    %edx,%eax
+ 626:	0f b6 00             	movzbl (%eax),%eax
+ 629:	0f be c0             	movsbl %al,%eax
+ 62c:	83 ec 08             	sub    $0x8,%esp
+ 62f:	50                   	push   %eax
+ 630:	ff 75 08             	push   0x8(%ebp)
+ 633:	e8 3d ff ff ff       	call   575 <putc>
+ 638:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 63b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 63f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 643:	79 d9                	jns    61e <printint+0x86>
+}
+ 645:	90                   	nop
+ 646:	90                   	nop
+ 647:	c9                   	leave
+ 648:	c3                   	ret
+
+00000649 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 649:	55                   	push   %ebp
+ 64a:	89 e5                	mov    %esp,%ebp
+ 64c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 64f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 656:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 659:	83 c0 04             	add    $0x4,%eax
+ 65c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 65f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 666:	e9 59 01 00 00       	jmp    7c4 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 66b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 66e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 671:	01 d0                	add    %edx,%eax
+ 673:	0f b6 00             	movzbl (%eax),%eax
+ 676:	0f be c0             	movsbl %al,%eax
+ 679:	25 ff 00 00 00       	and    $0xff,%eax
+ 67e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 681:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 685:	75 2c                	jne    6b3 <printf+0x6a>
+      if(c == '%'){
+ 687:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 68b:	75 0c                	jne    699 <printf+0x50>
+        state = '%';
+ 68d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 694:	e9 27 01 00 00       	jmp    7c0 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 699:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 69c:	0f be c0             	movsbl %al,%eax
+ 69f:	83 ec 08             	sub    $0x8,%esp
+ 6a2:	50                   	push   %eax
+ 6a3:	ff 75 08             	push   0x8(%ebp)
+ 6a6:	e8 ca fe ff ff       	call   575 <putc>
+ 6ab:	83 c4 10             	add    $0x10,%esp
+ 6ae:	e9 0d 01 00 00       	jmp    7c0 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 6b3:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 6b7:	0f 85 03 01 00 00    	jne    7c0 <printf+0x177>
+      if(c == 'd'){
+ 6bd:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 6c1:	75 1e                	jne    6e1 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 6c3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6c6:	8b 00                	mov    (%eax),%eax
+ 6c8:	6a 01                	push   $0x1
+ 6ca:	6a 0a                	push   $0xa
+ 6cc:	50                   	push   %eax
+ 6cd:	ff 75 08             	push   0x8(%ebp)
+ 6d0:	e8 c3 fe ff ff       	call   598 <printint>
+ 6d5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 6d8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 6dc:	e9 d8 00 00 00       	jmp    7b9 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 6e1:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 6e5:	74 06                	je     6ed <printf+0xa4>
+ 6e7:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 6eb:	75 1e                	jne    70b <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 6ed:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6f0:	8b 00                	mov    (%eax),%eax
+ 6f2:	6a 00                	push   $0x0
+ 6f4:	6a 10                	push   $0x10
+ 6f6:	50                   	push   %eax
+ 6f7:	ff 75 08             	push   0x8(%ebp)
+ 6fa:	e8 99 fe ff ff       	call   598 <printint>
+ 6ff:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 702:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 706:	e9 ae 00 00 00       	jmp    7b9 <printf+0x170>
+      } else if(c == 's'){
+ 70b:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 70f:	75 43                	jne    754 <printf+0x10b>
+        s = (char*)*ap;
+ 711:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 714:	8b 00                	mov    (%eax),%eax
+ 716:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 719:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 71d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 721:	75 25                	jne    748 <printf+0xff>
+          s = "(null)";
+ 723:	c7 45 f4 13 08 00 00 	movl   $0x813,-0xc(%ebp)
+        while(*s != 0){
+ 72a:	eb 1c                	jmp    748 <printf+0xff>
+          putc(fd, *s);
+ 72c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 72f:	0f b6 00             	movzbl (%eax),%eax
+ 732:	0f be c0             	movsbl %al,%eax
+ 735:	83 ec 08             	sub    $0x8,%esp
+ 738:	50                   	push   %eax
+ 739:	ff 75 08             	push   0x8(%ebp)
+ 73c:	e8 34 fe ff ff       	call   575 <putc>
+ 741:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 744:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 748:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 74b:	0f b6 00             	movzbl (%eax),%eax
+ 74e:	84 c0                	test   %al,%al
+ 750:	75 da                	jne    72c <printf+0xe3>
+ 752:	eb 65                	jmp    7b9 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 754:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 758:	75 1d                	jne    777 <printf+0x12e>
+        putc(fd, *ap);
+ 75a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 75d:	8b 00                	mov    (%eax),%eax
+ 75f:	0f be c0             	movsbl %al,%eax
+ 762:	83 ec 08             	sub    $0x8,%esp
+ 765:	50                   	push   %eax
+ 766:	ff 75 08             	push   0x8(%ebp)
+ 769:	e8 07 fe ff ff       	call   575 <putc>
+ 76e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 771:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 775:	eb 42                	jmp    7b9 <printf+0x170>
+      } else if(c == '%'){
+ 777:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 77b:	75 17                	jne    794 <printf+0x14b>
+        putc(fd, c);
+ 77d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 780:	0f be c0             	movsbl %al,%eax
+ 783:	83 ec 08             	sub    $0x8,%esp
+ 786:	50                   	push   %eax
+ 787:	ff 75 08             	push   0x8(%ebp)
+ 78a:	e8 e6 fd ff ff       	call   575 <putc>
+ 78f:	83 c4 10             	add    $0x10,%esp
+ 792:	eb 25                	jmp    7b9 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 794:	83 ec 08             	sub    $0x8,%esp
+ 797:	6a 25                	push   $0x25
+ 799:	ff 75 08             	push   0x8(%ebp)
+ 79c:	e8 d4 fd ff ff       	call   575 <putc>
+ 7a1:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 7a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 7a7:	0f be c0             	movsbl %al,%eax
+ 7aa:	83 ec 08             	sub    $0x8,%esp
+ 7ad:	50                   	push   %eax
+ 7ae:	ff 75 08             	push   0x8(%ebp)
+ 7b1:	e8 bf fd ff ff       	call   575 <putc>
+ 7b6:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 7b9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 7c0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 7c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 7ca:	01 d0                	add    %edx,%eax
+ 7cc:	0f b6 00             	movzbl (%eax),%eax
+ 7cf:	84 c0                	test   %al,%al
+ 7d1:	0f 85 94 fe ff ff    	jne    66b <printf+0x22>
+    }
+  }
+}
+ 7d7:	90                   	nop
+ 7d8:	90                   	nop
+ 7d9:	c9                   	leave
+ 7da:	c3                   	ret
@@ -0,0 +1,270 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 16 00 00 00       	call   2c <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 a0 00 00 00       	call   c4 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 08 00 00 00       	call   34 <exit>
+
+0000002c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+  2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  31:	cd 40                	int    $0x40
+  33:	c3                   	ret
+
+00000034 <exit>:
+SYSCALL(exit)
+  34:	b8 02 00 00 00       	mov    $0x2,%eax
+  39:	cd 40                	int    $0x40
+  3b:	c3                   	ret
+
+0000003c <wait>:
+SYSCALL(wait)
+  3c:	b8 03 00 00 00       	mov    $0x3,%eax
+  41:	cd 40                	int    $0x40
+  43:	c3                   	ret
+
+00000044 <pipe>:
+SYSCALL(pipe)
+  44:	b8 04 00 00 00       	mov    $0x4,%eax
+  49:	cd 40                	int    $0x40
+  4b:	c3                   	ret
+
+0000004c <read>:
+SYSCALL(read)
+  4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  51:	cd 40                	int    $0x40
+  53:	c3                   	ret
+
+00000054 <write>:
+SYSCALL(write)
+  54:	b8 10 00 00 00       	mov    $0x10,%eax
+  59:	cd 40                	int    $0x40
+  5b:	c3                   	ret
+
+0000005c <close>:
+SYSCALL(close)
+  5c:	b8 15 00 00 00       	mov    $0x15,%eax
+  61:	cd 40                	int    $0x40
+  63:	c3                   	ret
+
+00000064 <kill>:
+SYSCALL(kill)
+  64:	b8 06 00 00 00       	mov    $0x6,%eax
+  69:	cd 40                	int    $0x40
+  6b:	c3                   	ret
+
+0000006c <exec>:
+SYSCALL(exec)
+  6c:	b8 07 00 00 00       	mov    $0x7,%eax
+  71:	cd 40                	int    $0x40
+  73:	c3                   	ret
+
+00000074 <open>:
+SYSCALL(open)
+  74:	b8 0f 00 00 00       	mov    $0xf,%eax
+  79:	cd 40                	int    $0x40
+  7b:	c3                   	ret
+
+0000007c <mknod>:
+SYSCALL(mknod)
+  7c:	b8 11 00 00 00       	mov    $0x11,%eax
+  81:	cd 40                	int    $0x40
+  83:	c3                   	ret
+
+00000084 <unlink>:
+SYSCALL(unlink)
+  84:	b8 12 00 00 00       	mov    $0x12,%eax
+  89:	cd 40                	int    $0x40
+  8b:	c3                   	ret
+
+0000008c <fstat>:
+SYSCALL(fstat)
+  8c:	b8 08 00 00 00       	mov    $0x8,%eax
+  91:	cd 40                	int    $0x40
+  93:	c3                   	ret
+
+00000094 <link>:
+SYSCALL(link)
+  94:	b8 13 00 00 00       	mov    $0x13,%eax
+  99:	cd 40                	int    $0x40
+  9b:	c3                   	ret
+
+0000009c <mkdir>:
+SYSCALL(mkdir)
+  9c:	b8 14 00 00 00       	mov    $0x14,%eax
+  a1:	cd 40                	int    $0x40
+  a3:	c3                   	ret
+
+000000a4 <chdir>:
+SYSCALL(chdir)
+  a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  a9:	cd 40                	int    $0x40
+  ab:	c3                   	ret
+
+000000ac <dup>:
+SYSCALL(dup)
+  ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+  b1:	cd 40                	int    $0x40
+  b3:	c3                   	ret
+
+000000b4 <getpid>:
+SYSCALL(getpid)
+  b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  b9:	cd 40                	int    $0x40
+  bb:	c3                   	ret
+
+000000bc <sbrk>:
+SYSCALL(sbrk)
+  bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  c1:	cd 40                	int    $0x40
+  c3:	c3                   	ret
+
+000000c4 <sleep>:
+SYSCALL(sleep)
+  c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  c9:	cd 40                	int    $0x40
+  cb:	c3                   	ret
+
+000000cc <uptime>:
+SYSCALL(uptime)
+  cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  d1:	cd 40                	int    $0x40
+  d3:	c3                   	ret
+
+000000d4 <saveProc>:
+SYSCALL(saveProc)
+  d4:	b8 16 00 00 00       	mov    $0x16,%eax
+  d9:	cd 40                	int    $0x40
+  db:	c3                   	ret
+
+000000dc <loadProc>:
+SYSCALL(loadProc)
+  dc:	b8 17 00 00 00       	mov    $0x17,%eax
+  e1:	cd 40                	int    $0x40
+  e3:	c3                   	ret
+
+000000e4 <setpriority>:
+SYSCALL(setpriority)
+  e4:	b8 19 00 00 00       	mov    $0x19,%eax
+  e9:	cd 40                	int    $0x40
+  eb:	c3                   	ret
+
+000000ec <setaffinity>:
+SYSCALL(setaffinity)
+  ec:	b8 1a 00 00 00       	mov    $0x1a,%eax
+  f1:	cd 40                	int    $0x40
+  f3:	c3                   	ret
+
+000000f4 <getaffinity>:
+SYSCALL(getaffinity)
+  f4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+  f9:	cd 40                	int    $0x40
+  fb:	c3                   	ret
+
+000000fc <nanosleep>:
+SYSCALL(nanosleep)
+  fc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 101:	cd 40                	int    $0x40
+ 103:	c3                   	ret
+
+00000104 <cpustat>:
+SYSCALL(cpustat)
+ 104:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 109:	cd 40                	int    $0x40
+ 10b:	c3                   	ret
+
+0000010c <nanouptime>:
+SYSCALL(nanouptime)
+ 10c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 111:	cd 40                	int    $0x40
+ 113:	c3                   	ret
+
+00000114 <settickets>:
+SYSCALL(settickets)
+ 114:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 119:	cd 40                	int    $0x40
+ 11b:	c3                   	ret
+
+0000011c <setdeadline>:
+SYSCALL(setdeadline)
+ 11c:	b8 20 00 00 00       	mov    $0x20,%eax
+ 121:	cd 40                	int    $0x40
+ 123:	c3                   	ret
+
+00000124 <rtstat>:
+SYSCALL(rtstat)
+ 124:	b8 21 00 00 00       	mov    $0x21,%eax
+ 129:	cd 40                	int    $0x40
+ 12b:	c3                   	ret
+
+0000012c <schedstat>:
+SYSCALL(schedstat)
+ 12c:	b8 22 00 00 00       	mov    $0x22,%eax
+ 131:	cd 40                	int    $0x40
+ 133:	c3                   	ret
+
+00000134 <waitpid>:
+SYSCALL(waitpid)
+ 134:	b8 23 00 00 00       	mov    $0x23,%eax
+ 139:	cd 40                	int    $0x40
+ 13b:	c3                   	ret
+
+0000013c <clone>:
+SYSCALL(clone)
+ 13c:	b8 24 00 00 00       	mov    $0x24,%eax
+ 141:	cd 40                	int    $0x40
+ 143:	c3                   	ret
+
+00000144 <futexwait>:
+SYSCALL(futexwait)
+ 144:	b8 25 00 00 00       	mov    $0x25,%eax
+ 149:	cd 40                	int    $0x40
+ 14b:	c3                   	ret
+
+0000014c <futexwake>:
+SYSCALL(futexwake)
+ 14c:	b8 26 00 00 00       	mov    $0x26,%eax
+ 151:	cd 40                	int    $0x40
+ 153:	c3                   	ret
+
+00000154 <lockstat>:
+SYSCALL(lockstat)
+ 154:	b8 27 00 00 00       	mov    $0x27,%eax
+ 159:	cd 40                	int    $0x40
+ 15b:	c3                   	ret
+
+0000015c <dcachestat>:
+SYSCALL(dcachestat)
+ 15c:	b8 28 00 00 00       	mov    $0x28,%eax
+ 161:	cd 40                	int    $0x40
+ 163:	c3                   	ret